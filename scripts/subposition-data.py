@@ -0,0 +1,177 @@
+#!/usr/bin/env python3
+
+"""Converts the vehicle movement tables between src/OpenLoco/src/Map/Track/SubpositionTables.h,
+which is generated and holds them packed, and a readable listing for editing.
+
+    subposition-data.py unpack listing.txt   writes the listing of the current tables
+    subposition-data.py pack listing.txt     regenerates SubpositionTables.h from a listing
+
+The listing has one block per table. Lines starting with # are comments kept with the table
+that follows, then the table name on its own line followed by one entry per line as
+"x y z yaw pitch", or "name = other" for a table with the same entries as an earlier one.
+"""
+
+import argparse
+import os
+import re
+import sys
+
+TABLES_PATH = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                           '..', 'src', 'OpenLoco', 'src', 'Map', 'Track', 'SubpositionTables.h')
+
+# Must match enum class Pitch in Entities/Entity.h
+PITCHES = ['flat', 'up6deg', 'up12deg', 'up18deg', 'up25deg', 'down6deg', 'down12deg',
+           'down18deg', 'down25deg', 'up10deg', 'down10deg', 'up20deg', 'down20deg']
+
+ENTRIES_PER_LINE = 8
+
+HEADER = '''#pragma once
+
+// Generated by scripts/subposition-data.py, do not edit. Unpack the tables to a readable listing with
+// the script, edit that and pack it again. Entries are PackedMoveInfo values, see SubpositionData.h.
+
+#include "Map/Track/SubpositionData.h"
+
+// clang-format off
+namespace OpenLoco::World::TrackData
+{
+'''
+
+FOOTER = '''}
+// clang-format on
+'''
+
+
+class Table:
+    def __init__(self, name, comments):
+        self.name = name
+        self.comments = comments
+        self.entries = []
+        self.alias = None
+
+
+def pack_entry(x, y, z, yaw, pitch, where):
+    if not (-64 <= x < 192 and -64 <= y < 192 and -32 <= z < 32 and 0 <= yaw < 64 and yaw % 2 == 0):
+        sys.exit('{}: entry does not fit in a PackedMoveInfo'.format(where))
+    return (x + 64) | ((y + 64) << 8) | ((z + 32) << 16) | ((yaw // 2) << 22) | (pitch << 27)
+
+
+def unpack_entry(data):
+    x = (data & 0xFF) - 64
+    y = ((data >> 8) & 0xFF) - 64
+    z = ((data >> 16) & 0x3F) - 32
+    yaw = ((data >> 22) & 0x1F) * 2
+    pitch = (data >> 27) & 0xF
+    return x, y, z, yaw, pitch
+
+
+def read_listing(path):
+    tables = []
+    comments = []
+    with open(path) as f:
+        for line_number, line in enumerate(f, 1):
+            where = '{}:{}'.format(path, line_number)
+            line = line.strip()
+            if not line:
+                continue
+            if line.startswith('#'):
+                comments.append(line[1:].strip())
+                continue
+            if line.startswith('moveInfo'):
+                name, _, alias = line.partition('=')
+                tables.append(Table(name.strip(), comments))
+                tables[-1].alias = alias.strip() or None
+                comments = []
+                continue
+            if not tables or tables[-1].alias is not None:
+                sys.exit('{}: entry outside of a table'.format(where))
+            fields = line.split()
+            if len(fields) != 5 or fields[4] not in PITCHES:
+                sys.exit('{}: expected "x y z yaw pitch"'.format(where))
+            x, y, z, yaw = (int(v) for v in fields[:4])
+            tables[-1].entries.append(pack_entry(x, y, z, yaw, PITCHES.index(fields[4]), where))
+    return tables
+
+
+def write_tables(tables, path):
+    names = set()
+    lines = [HEADER]
+    for table in tables:
+        if table.alias is not None and table.alias not in names:
+            sys.exit('{} refers to {} before it is defined'.format(table.name, table.alias))
+        names.add(table.name)
+
+        lines.extend('    // {}\n'.format(comment) for comment in table.comments)
+        if table.alias is not None:
+            lines.append('    // Same entries as {}\n'.format(table.alias))
+            lines.append('    static constexpr auto& {} = {};\n\n'.format(table.name, table.alias))
+            continue
+        lines.append('    static constexpr PackedMoveInfo {}[] = {{\n'.format(table.name))
+        for i in range(0, len(table.entries), ENTRIES_PER_LINE):
+            chunk = table.entries[i:i + ENTRIES_PER_LINE]
+            lines.append('        {},\n'.format(', '.join('0x{:08X}'.format(v) for v in chunk)))
+        lines.append('    };\n\n')
+    lines[-1] = lines[-1].rstrip('\n') + '\n'
+    lines.append(FOOTER)
+    with open(path, 'w', newline='\n') as f:
+        f.writelines(lines)
+
+
+def read_tables(path):
+    tables = []
+    comments = []
+    with open(path) as f:
+        source = f.read()
+    body = source[source.index('{', source.index('namespace')) + 1:source.rindex('}')]
+    for line in body.splitlines():
+        line = line.strip()
+        if line.startswith('// Same entries as'):
+            continue
+        if line.startswith('//'):
+            comments.append(line[2:].strip())
+            continue
+        match = re.match(r'static constexpr auto& (\w+) = (\w+);', line)
+        if match:
+            tables.append(Table(match.group(1), comments))
+            tables[-1].alias = match.group(2)
+            comments = []
+            continue
+        match = re.match(r'static constexpr PackedMoveInfo (\w+)\[\] = \{', line)
+        if match:
+            tables.append(Table(match.group(1), comments))
+            comments = []
+            continue
+        if line.startswith('0x'):
+            tables[-1].entries.extend(int(v, 16) for v in line.rstrip(',').split(', '))
+    return tables
+
+
+def write_listing(tables, path):
+    with open(path, 'w', newline='\n') as f:
+        for table in tables:
+            for comment in table.comments:
+                f.write('# {}\n'.format(comment))
+            if table.alias is not None:
+                f.write('{} = {}\n\n'.format(table.name, table.alias))
+                continue
+            f.write('{}\n'.format(table.name))
+            for data in table.entries:
+                x, y, z, yaw, pitch = unpack_entry(data)
+                f.write('    {} {} {} {} {}\n'.format(x, y, z, yaw, PITCHES[pitch]))
+            f.write('\n')
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('command', choices=['pack', 'unpack'])
+    parser.add_argument('listing', help='path of the readable listing')
+    args = parser.parse_args()
+
+    if args.command == 'pack':
+        write_tables(read_listing(args.listing), TABLES_PATH)
+    else:
+        write_listing(read_tables(TABLES_PATH), args.listing)
+
+
+if __name__ == '__main__':
+    main()
@@ -15,6 +15,7 @@
 #include <OpenLoco/S5/S5.h>
 #include <OpenLoco/S5/SawyerStream.h>
 #include <OpenLoco/Version.hpp>
+#include <OpenLoco/ZoomLevel.hpp>
 #include <SDL3/SDL_main.h>
 #include <fmt/chrono.h>
 #include <iostream>
@@ -38,6 +39,7 @@ namespace OpenLoco
         std::cout << "                uncompress [options] <path>" << std::endl;
         std::cout << "                simulate [options] <path> <ticks> [path]" << std::endl;
         std::cout << "                compare [options] <path1> <path2>" << std::endl;
+        std::cout << "                screenshot [options] <path>" << std::endl;
         std::cout << std::endl;
         std::cout << "options:" << std::endl;
         std::cout << "--bind                     Address to bind to when hosting a server" << std::endl;
@@ -52,6 +54,7 @@ namespace OpenLoco
         std::cout << "                              Example: --log_levels \"all, -verbose\", logs all but verbose levels" << std::endl;
         std::cout << "                              Default: \"info, warning, error\"" << std::endl;
         std::cout << "--all                -a     For compare, print out all divergences" << std::endl;
+        std::cout << "--zoom                      For screenshot, zoom level from 0 (full) to 3, default 0" << std::endl;
         std::cout << "--locomotion_path           Overrides the path to Locomotion install." << std::endl;
     }
 
@@ -239,6 +242,36 @@ namespace OpenLoco
         return result;
     }
 
+    static int screenshot(const CommandLineOptions& options)
+    {
+        if (options.path.empty())
+        {
+            Logging::error("No file specified.");
+            return EXIT_FAILURE;
+        }
+
+        const auto zoomLevel = options.zoom.value_or(ZoomLevel::full);
+        if (zoomLevel < ZoomLevel::full || zoomLevel > ZoomLevel::max)
+        {
+            Logging::error("Zoom level must be between {} and {}", ZoomLevel::full, ZoomLevel::max);
+            return EXIT_FAILURE;
+        }
+
+        auto inPath = fs::u8path(options.path);
+        auto outPath = options.outputPath.empty() ? fs::path(inPath).replace_extension(".png") : fs::u8path(options.outputPath);
+
+        const auto timeStarted = std::chrono::high_resolution_clock::now();
+        if (!OpenLoco::screenshotGame(inPath, outPath, static_cast<int8_t>(zoomLevel)))
+        {
+            return EXIT_FAILURE;
+        }
+        const auto timeElapsed = std::chrono::high_resolution_clock::now() - timeStarted;
+
+        Logging::info("Saved screenshot to {}", outPath.u8string());
+        Logging::info("Duration: {:%S} sec", timeElapsed);
+        return EXIT_SUCCESS;
+    }
+
     // 0x00406386
     static void run()
     {
@@ -273,6 +306,8 @@ namespace OpenLoco
                 return simulate(options);
             case CommandLineAction::compare:
                 return compare(options);
+            case CommandLineAction::screenshot:
+                return screenshot(options);
             default:
                 return std::nullopt;
         }
@@ -309,6 +344,7 @@ namespace OpenLoco
             CrashHandler::AppInfo appInfo;
             appInfo.name = "OpenLoco";
             appInfo.version = Version::getVersionInfo();
+            appInfo.onCrash = [] { Logging::flush(); };
 
             CrashHandler::init(appInfo);
         }
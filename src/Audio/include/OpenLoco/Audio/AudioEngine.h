@@ -4,6 +4,7 @@
 #include "AudioEffect.h"
 #include "AudioFormat.h"
 #include "AudioHandle.h"
+#include <OpenLoco/Core/FileSystem.hpp>
 #include <cstdint>
 #include <span>
 #include <string>
@@ -31,6 +32,9 @@ namespace OpenLoco::Audio
 
     // Handle management
     AudioHandle create(BufferId buffer, ChannelId channel, const AudioAttributes& attribs = {});
+    // Plays a WAV file as it is read instead of loading it into a buffer first, short files are
+    // kept whole once played (see AudioStream::kMaxCachedTrackSize)
+    AudioHandle createStream(const fs::path& path, ChannelId channel, const AudioAttributes& attribs = {});
     void destroy(AudioHandle handle);
 
     // Playback control
@@ -0,0 +1,92 @@
+#pragma once
+
+#include "AudioFormat.h"
+#include <OpenLoco/Core/FileStream.h>
+#include <OpenLoco/Core/FileSystem.hpp>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+namespace OpenLoco::Audio
+{
+    enum class AudioStreamState : uint8_t
+    {
+        opening,
+        streaming,
+        finished,
+        failed,
+    };
+
+    // PCM data read from a WAV file a chunk at a time on the streaming thread. Playback takes
+    // decoded chunks from the front of the queue so it never has to wait on the file.
+    class AudioStream
+    {
+    public:
+        static constexpr size_t kChunkSize = 64 * 1024;
+        // Caps the decoded data held by each stream, about three seconds of 22kHz 16 bit stereo
+        static constexpr size_t kMaxQueuedChunks = 4;
+        // Tracks up to this size are kept whole once read so replaying them needs no file access,
+        // ambient loops fit but jukebox tracks do not
+        static constexpr size_t kMaxCachedTrackSize = 8 * 1024 * 1024;
+        // Caps the data held by the track cache, the least recently played tracks are dropped first
+        static constexpr size_t kMaxCacheSize = 32 * 1024 * 1024;
+
+    private:
+        mutable std::mutex _mutex;
+        fs::path _path;
+        bool _loop{};
+        AudioStreamState _state = AudioStreamState::opening;
+        AudioFormat _format{};
+        std::deque<std::vector<uint8_t>> _chunks;
+
+        // Only used by the thread calling decode
+        bool _isOpen{};
+        FileStream _file;
+        std::shared_ptr<const std::vector<uint8_t>> _cachedData; // Set when playing from the track cache
+        std::vector<uint8_t> _trackData;                         // The whole track read so far, if it will be cached
+        bool _isCachingTrack{};
+        size_t _dataOffset{};
+        size_t _dataLength{};
+        size_t _dataPosition{};
+
+        AudioFormat open();
+        AudioFormat readHeader();
+        std::vector<uint8_t> readChunk(size_t size);
+        void close();
+
+    public:
+        AudioStream(fs::path path, bool loop);
+
+        AudioStreamState getState() const;
+        std::optional<AudioFormat> getFormat() const;
+        void setLoop(bool loop);
+
+        // Returns the next decoded chunk, or nothing if the streaming thread hasn't caught up
+        std::optional<std::vector<uint8_t>> takeChunk();
+
+        size_t getQueuedBytes() const;
+
+        // True once the end of the data has been reached (or it failed) and every chunk was taken
+        bool isDrained() const;
+
+        // Decodes the next chunk if there is room for it, returns false if there was nothing to do
+        bool decode();
+    };
+
+    // The streaming thread fills the queues of every open stream in the background
+    void startStreaming();
+    void stopStreaming();
+    std::shared_ptr<AudioStream> openStream(const fs::path& path, bool loop);
+    // Wakes the streaming thread, call after taking chunks from a stream
+    void notifyStreaming();
+    // Sets a function the streaming thread runs after each fill, at least every kStreamingUpdateInterval.
+    // Playback is fed from here so it keeps going while the game thread is busy.
+    void setStreamingUpdate(std::function<void()> update);
+    constexpr uint32_t kStreamingUpdateInterval = 50; // ms
+    // Drops every track kept by the track cache
+    void clearTrackCache();
+}
@@ -8,12 +8,16 @@
 #include <AudioFormat.h>
 #include <AudioHandle.h>
 #include <OpenLoco/Audio/AudioEngine.h>
+#include <OpenLoco/Audio/AudioStream.h>
 #include <OpenLoco/Diagnostics/Logging.h>
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cmath>
 #include <cstdint>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <span>
 #include <string>
 #include <vector>
@@ -22,14 +26,28 @@ namespace OpenLoco::Audio
 {
     using namespace Diagnostics;
 
+    // The source of a streamed instance and the small ring of buffers it is fed from. These are refilled
+    // on the streaming thread, so everything here is only touched while holding _streamSourcesMutex.
+    struct StreamSource
+    {
+        uint32_t sourceId{};
+        std::shared_ptr<AudioStream> stream;
+        std::vector<uint32_t> buffers;
+        std::vector<uint32_t> freeBuffers;
+        bool playing = false;
+    };
+
     struct AudioInstance
     {
         uint32_t sourceId{};
         ChannelId channel{};
         AudioAttributes attribs{};
         bool active = false;
+        std::shared_ptr<StreamSource> streamSource;
     };
 
+    static constexpr size_t kNumStreamBuffers = 3;
+
     static ALCdevice* _alcDevice = nullptr;
     static ALCcontext* _alcContext = nullptr;
     static std::vector<uint32_t> _alSources;
@@ -37,9 +55,11 @@ namespace OpenLoco::Audio
     static std::size_t _maxInstances = 0;
 
     static bool _isInitialised = false;
-    static bool _isPaused = false;
+    static std::atomic<bool> _isPaused = false;
 
     static std::vector<AudioInstance> _instances;
+    static std::mutex _streamSourcesMutex;
+    static std::vector<std::shared_ptr<StreamSource>> _streamSources;
     static std::array<int32_t, static_cast<size_t>(ChannelId::count)> _channelVolumes{};
 
     static ALuint _reverbEffect = 0;
@@ -112,6 +132,37 @@ namespace OpenLoco::Audio
         alSource3f(sourceId, AL_POSITION, p, 0.0f, -std::sqrt(1.0f - p * p));
     }
 
+    static ALenum getAlFormat(const AudioFormat& format)
+    {
+        if (format.channels > 1)
+        {
+            return (format.bitsPerSample == 8) ? AL_FORMAT_STEREO8 : AL_FORMAT_STEREO16;
+        }
+        return (format.bitsPerSample == 8) ? AL_FORMAT_MONO8 : AL_FORMAT_MONO16;
+    }
+
+    static void releaseInstance(AudioInstance& inst)
+    {
+        // Taken off the streaming thread first so it can't restart the source once stopped
+        if (inst.streamSource != nullptr)
+        {
+            std::lock_guard lock(_streamSourcesMutex);
+            std::erase(_streamSources, inst.streamSource);
+        }
+        alSourceStop(inst.sourceId);
+        alSourcei(inst.sourceId, AL_BUFFER, 0);
+        if (_reverbAvailable)
+        {
+            alSource3i(inst.sourceId, AL_AUXILIARY_SEND_FILTER, AL_EFFECTSLOT_NULL, 0, AL_FILTER_NULL);
+        }
+        if (inst.streamSource != nullptr)
+        {
+            alDeleteBuffers(static_cast<ALsizei>(inst.streamSource->buffers.size()), inst.streamSource->buffers.data());
+            inst.streamSource = nullptr;
+        }
+        inst.active = false;
+    }
+
     bool openDevice(const std::string& name)
     {
         closeDevice();
@@ -219,16 +270,29 @@ namespace OpenLoco::Audio
         return result;
     }
 
+    static void updateStreams();
+
     void initialize()
     {
         _channelVolumes.fill(0);
         _instances.clear();
         _isPaused = false;
         _isInitialised = true;
+        setStreamingUpdate(updateStreams);
+        startStreaming();
     }
 
     void shutdown()
     {
+        stopStreaming();
+        clearTrackCache();
+        for (auto& inst : _instances)
+        {
+            if (inst.active)
+            {
+                releaseInstance(inst);
+            }
+        }
         for (auto& sourceId : _alSources)
         {
             alSourceStop(sourceId);
@@ -252,16 +316,7 @@ namespace OpenLoco::Audio
         alGenBuffers(1, &id);
         _alBuffers.push_back(id);
 
-        ALenum alFormat;
-        if (format.channels > 1)
-        {
-            alFormat = (format.bitsPerSample == 8) ? AL_FORMAT_STEREO8 : AL_FORMAT_STEREO16;
-        }
-        else
-        {
-            alFormat = (format.bitsPerSample == 8) ? AL_FORMAT_MONO8 : AL_FORMAT_MONO16;
-        }
-        alBufferData(id, alFormat, pcmData.data(), static_cast<ALsizei>(pcmData.size()), format.sampleRate);
+        alBufferData(id, getAlFormat(format), pcmData.data(), static_cast<ALsizei>(pcmData.size()), format.sampleRate);
         return static_cast<BufferId>(id);
     }
 
@@ -284,19 +339,24 @@ namespace OpenLoco::Audio
             }
             int32_t state = 0;
             alGetSourcei(inst.sourceId, AL_SOURCE_STATE, &state);
-            if (state == AL_STOPPED || state == AL_INITIAL)
+            if (state != AL_STOPPED && state != AL_INITIAL)
+            {
+                continue;
+            }
+            // A stream that ran dry is only finished once the whole file has been played
+            if (inst.streamSource != nullptr)
             {
-                alSourcei(inst.sourceId, AL_BUFFER, 0);
-                if (_reverbAvailable)
+                std::lock_guard lock(_streamSourcesMutex);
+                if (inst.streamSource->playing && !inst.streamSource->stream->isDrained())
                 {
-                    alSource3i(inst.sourceId, AL_AUXILIARY_SEND_FILTER, AL_EFFECTSLOT_NULL, 0, AL_FILTER_NULL);
+                    continue;
                 }
-                inst.active = false;
             }
+            releaseInstance(inst);
         }
     }
 
-    AudioHandle create(BufferId buffer, ChannelId channel, const AudioAttributes& attribs)
+    static std::optional<uint32_t> allocateInstance(ChannelId channel, const AudioAttributes& attribs)
     {
         uint32_t idx = static_cast<uint32_t>(_instances.size());
         for (uint32_t i = 0; i < _instances.size(); ++i)
@@ -320,16 +380,13 @@ namespace OpenLoco::Audio
             if (_instances.size() >= _maxInstances)
             {
                 Logging::verbose("Maximum number of audio sources reached, cannot create new audio instance.");
-                return AudioHandle::null;
+                return std::nullopt;
             }
 
             alGenSources(1, &sourceId);
             _alSources.push_back(sourceId);
         }
 
-        // Bind the buffer to the source.
-        alSourcei(sourceId, AL_BUFFER, static_cast<ALint>(buffer));
-
         AudioInstance inst{};
         inst.sourceId = sourceId;
         inst.channel = channel;
@@ -348,9 +405,51 @@ namespace OpenLoco::Audio
         applyVolume(_instances[idx]);
         applyPitch(_instances[idx]);
         applyPan(sourceId, attribs.pan);
+
+        return idx;
+    }
+
+    AudioHandle create(BufferId buffer, ChannelId channel, const AudioAttributes& attribs)
+    {
+        auto idx = allocateInstance(channel, attribs);
+        if (!idx)
+        {
+            return AudioHandle::null;
+        }
+
+        auto sourceId = _instances[*idx].sourceId;
+        alSourcei(sourceId, AL_BUFFER, static_cast<ALint>(buffer));
         alSourcei(sourceId, AL_LOOPING, attribs.loop ? AL_TRUE : AL_FALSE);
 
-        return static_cast<AudioHandle>(idx);
+        return static_cast<AudioHandle>(*idx);
+    }
+
+    AudioHandle createStream(const fs::path& path, ChannelId channel, const AudioAttributes& attribs)
+    {
+        auto idx = allocateInstance(channel, attribs);
+        if (!idx)
+        {
+            return AudioHandle::null;
+        }
+
+        auto& inst = _instances[*idx];
+        alSourcei(inst.sourceId, AL_BUFFER, 0);
+        // Looping is done by the stream, the source only ever sees the queued chunks
+        alSourcei(inst.sourceId, AL_LOOPING, AL_FALSE);
+
+        auto source = std::make_shared<StreamSource>();
+        source->sourceId = inst.sourceId;
+        source->stream = openStream(path, attribs.loop);
+        source->buffers.resize(kNumStreamBuffers);
+        alGenBuffers(static_cast<ALsizei>(source->buffers.size()), source->buffers.data());
+        source->freeBuffers = source->buffers;
+        inst.streamSource = source;
+        {
+            std::lock_guard lock(_streamSourcesMutex);
+            _streamSources.push_back(std::move(source));
+        }
+
+        return static_cast<AudioHandle>(*idx);
     }
 
     void destroy(AudioHandle handle)
@@ -360,13 +459,73 @@ namespace OpenLoco::Audio
         {
             return;
         }
-        alSourceStop(inst->sourceId);
-        alSourcei(inst->sourceId, AL_BUFFER, 0);
-        if (_reverbAvailable)
+        releaseInstance(*inst);
+    }
+
+    // Requires _streamSourcesMutex
+    static void updateStream(StreamSource& source)
+    {
+        ALint numProcessed = 0;
+        alGetSourcei(source.sourceId, AL_BUFFERS_PROCESSED, &numProcessed);
+        for (ALint i = 0; i < numProcessed; i++)
         {
-            alSource3i(inst->sourceId, AL_AUXILIARY_SEND_FILTER, AL_EFFECTSLOT_NULL, 0, AL_FILTER_NULL);
+            uint32_t bufferId = 0;
+            alSourceUnqueueBuffers(source.sourceId, 1, &bufferId);
+            source.freeBuffers.push_back(bufferId);
+        }
+
+        const auto format = source.stream->getFormat();
+        if (!format)
+        {
+            return;
+        }
+
+        bool tookChunks = false;
+        while (!source.freeBuffers.empty())
+        {
+            auto chunk = source.stream->takeChunk();
+            if (!chunk)
+            {
+                break;
+            }
+            auto bufferId = source.freeBuffers.back();
+            source.freeBuffers.pop_back();
+            alBufferData(bufferId, getAlFormat(*format), chunk->data(), static_cast<ALsizei>(chunk->size()), format->sampleRate);
+            alSourceQueueBuffers(source.sourceId, 1, &bufferId);
+            tookChunks = true;
+        }
+        if (tookChunks)
+        {
+            notifyStreaming();
+        }
+
+        if (!source.playing || _isPaused)
+        {
+            return;
+        }
+
+        // Start the source once the first chunks arrive, or restart it if it ran dry
+        int32_t state = 0;
+        alGetSourcei(source.sourceId, AL_SOURCE_STATE, &state);
+        if (state == AL_STOPPED || state == AL_INITIAL)
+        {
+            ALint numQueued = 0;
+            alGetSourcei(source.sourceId, AL_BUFFERS_QUEUED, &numQueued);
+            if (numQueued > 0)
+            {
+                alSourcePlay(source.sourceId);
+            }
+        }
+    }
+
+    // Runs on the streaming thread so playback doesn't depend on the game thread getting to the next frame
+    static void updateStreams()
+    {
+        std::lock_guard lock(_streamSourcesMutex);
+        for (auto& source : _streamSources)
+        {
+            updateStream(*source);
         }
-        inst->active = false;
     }
 
     // Playback control
@@ -374,19 +533,35 @@ namespace OpenLoco::Audio
     void play(AudioHandle handle)
     {
         auto* inst = getInstance(handle);
-        if (inst != nullptr)
+        if (inst == nullptr)
         {
-            alSourcePlay(inst->sourceId);
+            return;
         }
+        if (inst->streamSource != nullptr)
+        {
+            std::lock_guard lock(_streamSourcesMutex);
+            inst->streamSource->playing = true;
+            updateStream(*inst->streamSource);
+            return;
+        }
+        alSourcePlay(inst->sourceId);
     }
 
     void stop(AudioHandle handle)
     {
         auto* inst = getInstance(handle);
-        if (inst != nullptr)
+        if (inst == nullptr)
         {
+            return;
+        }
+        if (inst->streamSource != nullptr)
+        {
+            std::lock_guard lock(_streamSourcesMutex);
+            inst->streamSource->playing = false;
             alSourceStop(inst->sourceId);
+            return;
         }
+        alSourceStop(inst->sourceId);
     }
 
     void pause(AudioHandle handle)
@@ -401,10 +576,25 @@ namespace OpenLoco::Audio
     void unpause(AudioHandle handle)
     {
         auto* inst = getInstance(handle);
-        if (inst != nullptr)
+        if (inst == nullptr)
         {
-            alSourcePlay(inst->sourceId);
+            return;
         }
+        if (inst->streamSource != nullptr)
+        {
+            std::lock_guard lock(_streamSourcesMutex);
+            inst->streamSource->playing = true;
+            updateStream(*inst->streamSource);
+
+            int32_t state = 0;
+            alGetSourcei(inst->sourceId, AL_SOURCE_STATE, &state);
+            if (state == AL_PAUSED)
+            {
+                alSourcePlay(inst->sourceId);
+            }
+            return;
+        }
+        alSourcePlay(inst->sourceId);
     }
 
     bool isPlaying(AudioHandle handle)
@@ -416,6 +606,15 @@ namespace OpenLoco::Audio
         }
         int32_t state = 0;
         alGetSourcei(inst->sourceId, AL_SOURCE_STATE, &state);
+        if (inst->streamSource != nullptr && state != AL_PAUSED)
+        {
+            // Still opening or waiting on the streaming thread counts as playing
+            std::lock_guard lock(_streamSourcesMutex);
+            if (inst->streamSource->playing)
+            {
+                return state == AL_PLAYING || !inst->streamSource->stream->isDrained();
+            }
+        }
         return state == AL_PLAYING;
     }
 
@@ -477,7 +676,14 @@ namespace OpenLoco::Audio
         applyVolume(*inst);
         applyPitch(*inst);
         applyPan(inst->sourceId, attribs.pan);
-        alSourcei(inst->sourceId, AL_LOOPING, attribs.loop ? AL_TRUE : AL_FALSE);
+        if (inst->streamSource != nullptr)
+        {
+            inst->streamSource->stream->setLoop(attribs.loop);
+        }
+        else
+        {
+            alSourcei(inst->sourceId, AL_LOOPING, attribs.loop ? AL_TRUE : AL_FALSE);
+        }
     }
 
     // Channel volume control
@@ -544,13 +750,7 @@ namespace OpenLoco::Audio
         {
             if (inst.active)
             {
-                alSourceStop(inst.sourceId);
-                alSourcei(inst.sourceId, AL_BUFFER, 0);
-                if (_reverbAvailable)
-                {
-                    alSource3i(inst.sourceId, AL_AUXILIARY_SEND_FILTER, AL_EFFECTSLOT_NULL, 0, AL_FILTER_NULL);
-                }
-                inst.active = false;
+                releaseInstance(inst);
             }
         }
     }
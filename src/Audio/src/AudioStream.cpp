@@ -0,0 +1,392 @@
+#include <OpenLoco/Audio/AudioStream.h>
+#include <OpenLoco/Core/Exception.hpp>
+#include <OpenLoco/Diagnostics/Logging.h>
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <list>
+#include <thread>
+
+using namespace OpenLoco::Diagnostics;
+
+namespace OpenLoco::Audio
+{
+    struct CachedTrack
+    {
+        fs::path path;
+        AudioFormat format;
+        std::shared_ptr<const std::vector<uint8_t>> data;
+    };
+
+    static std::mutex _trackCacheMutex;
+    static std::list<CachedTrack> _trackCache; // Most recently played first
+    static size_t _trackCacheSize = 0;
+
+    static std::optional<CachedTrack> findCachedTrack(const fs::path& path)
+    {
+        std::lock_guard lock(_trackCacheMutex);
+        auto it = std::ranges::find(_trackCache, path, &CachedTrack::path);
+        if (it == _trackCache.end())
+        {
+            return std::nullopt;
+        }
+        _trackCache.splice(_trackCache.begin(), _trackCache, it);
+        return _trackCache.front();
+    }
+
+    static void addCachedTrack(const fs::path& path, const AudioFormat& format, std::vector<uint8_t>&& data)
+    {
+        std::lock_guard lock(_trackCacheMutex);
+        if (std::ranges::find(_trackCache, path, &CachedTrack::path) != _trackCache.end())
+        {
+            return;
+        }
+        _trackCacheSize += data.size();
+        _trackCache.push_front(CachedTrack{ path, format, std::make_shared<const std::vector<uint8_t>>(std::move(data)) });
+        while (_trackCacheSize > AudioStream::kMaxCacheSize)
+        {
+            _trackCacheSize -= _trackCache.back().data->size();
+            _trackCache.pop_back();
+        }
+    }
+
+    void clearTrackCache()
+    {
+        std::lock_guard lock(_trackCacheMutex);
+        _trackCache.clear();
+        _trackCacheSize = 0;
+    }
+
+    AudioStream::AudioStream(fs::path path, bool loop)
+        : _path(std::move(path))
+        , _loop(loop)
+    {
+    }
+
+    AudioStreamState AudioStream::getState() const
+    {
+        std::lock_guard lock(_mutex);
+        return _state;
+    }
+
+    std::optional<AudioFormat> AudioStream::getFormat() const
+    {
+        std::lock_guard lock(_mutex);
+        if (_state == AudioStreamState::opening || _state == AudioStreamState::failed)
+        {
+            return std::nullopt;
+        }
+        return _format;
+    }
+
+    void AudioStream::setLoop(bool loop)
+    {
+        std::lock_guard lock(_mutex);
+        _loop = loop;
+    }
+
+    std::optional<std::vector<uint8_t>> AudioStream::takeChunk()
+    {
+        std::lock_guard lock(_mutex);
+        if (_chunks.empty())
+        {
+            return std::nullopt;
+        }
+        auto chunk = std::move(_chunks.front());
+        _chunks.pop_front();
+        return chunk;
+    }
+
+    size_t AudioStream::getQueuedBytes() const
+    {
+        std::lock_guard lock(_mutex);
+        size_t total = 0;
+        for (const auto& chunk : _chunks)
+        {
+            total += chunk.size();
+        }
+        return total;
+    }
+
+    bool AudioStream::isDrained() const
+    {
+        std::lock_guard lock(_mutex);
+        return (_state == AudioStreamState::finished || _state == AudioStreamState::failed) && _chunks.empty();
+    }
+
+    AudioFormat AudioStream::readHeader()
+    {
+        _file.open(_path, StreamMode::read);
+        if (!_file.isOpen())
+        {
+            throw Exception::RuntimeError("Unable to open file.");
+        }
+
+        const auto sig = _file.readValue<uint32_t>();
+        if (sig != 0x46464952)
+        {
+            throw Exception::RuntimeError("Invalid signature.");
+        }
+
+        _file.readValue<uint32_t>();
+
+        const auto riffType = _file.readValue<uint32_t>();
+        if (riffType != 0x45564157)
+        {
+            throw Exception::RuntimeError("Invalid format.");
+        }
+
+        const auto fmtMarker = _file.readValue<uint32_t>();
+        if (fmtMarker != 0x20746d66 && fmtMarker != 0x00746d66)
+        {
+            throw Exception::RuntimeError("Invalid format marker.");
+        }
+
+        _file.readValue<uint32_t>();
+
+        const auto typeFormat = _file.readValue<uint16_t>();
+        if (typeFormat != 1)
+        {
+            throw Exception::RuntimeError("Invalid format type, expected PCM.");
+        }
+
+        AudioFormat format{};
+        format.channels = _file.readValue<uint16_t>();
+        format.sampleRate = _file.readValue<uint32_t>();
+
+        _file.readValue<uint32_t>();
+        _file.readValue<uint16_t>();
+
+        format.bitsPerSample = _file.readValue<uint16_t>();
+
+        const auto dataMarker = _file.readValue<uint32_t>();
+        if (dataMarker != 0x61746164)
+        {
+            throw Exception::RuntimeError("Invalid data marker.");
+        }
+
+        _dataLength = std::min<size_t>(_file.readValue<uint32_t>(), _file.getLength() - _file.getPosition());
+        _dataOffset = _file.getPosition();
+        _dataPosition = 0;
+        return format;
+    }
+
+    AudioFormat AudioStream::open()
+    {
+        _isOpen = true;
+        if (auto cachedTrack = findCachedTrack(_path))
+        {
+            _cachedData = std::move(cachedTrack->data);
+            _dataLength = _cachedData->size();
+            _dataPosition = 0;
+            return cachedTrack->format;
+        }
+
+        const auto format = readHeader();
+        _isCachingTrack = _dataLength <= kMaxCachedTrackSize;
+        if (_isCachingTrack)
+        {
+            _trackData.reserve(_dataLength);
+        }
+        return format;
+    }
+
+    std::vector<uint8_t> AudioStream::readChunk(size_t size)
+    {
+        std::vector<uint8_t> chunk(size);
+        if (_cachedData != nullptr)
+        {
+            std::copy_n(_cachedData->begin() + _dataPosition, size, chunk.begin());
+        }
+        else
+        {
+            _file.read(chunk.data(), chunk.size());
+            if (_isCachingTrack)
+            {
+                _trackData.insert(_trackData.end(), chunk.begin(), chunk.end());
+            }
+        }
+        _dataPosition += size;
+        return chunk;
+    }
+
+    void AudioStream::close()
+    {
+        _file.close();
+        _cachedData = nullptr;
+        _trackData = {};
+        _isCachingTrack = false;
+    }
+
+    bool AudioStream::decode()
+    {
+        {
+            std::lock_guard lock(_mutex);
+            if (_state == AudioStreamState::finished || _state == AudioStreamState::failed || _chunks.size() >= kMaxQueuedChunks)
+            {
+                return false;
+            }
+        }
+
+        try
+        {
+            if (!_isOpen)
+            {
+                const auto format = open();
+
+                std::lock_guard lock(_mutex);
+                _format = format;
+                _state = AudioStreamState::streaming;
+            }
+
+            if (_dataPosition >= _dataLength)
+            {
+                if (_isCachingTrack)
+                {
+                    addCachedTrack(_path, _format, std::move(_trackData));
+                    _trackData = {};
+                    _isCachingTrack = false;
+                }
+
+                std::lock_guard lock(_mutex);
+                if (!_loop || _dataLength == 0)
+                {
+                    _state = AudioStreamState::finished;
+                    close();
+                    return false;
+                }
+                if (_cachedData == nullptr)
+                {
+                    _file.setPosition(_dataOffset);
+                }
+                _dataPosition = 0;
+            }
+
+            auto chunk = readChunk(std::min(kChunkSize, _dataLength - _dataPosition));
+
+            std::lock_guard lock(_mutex);
+            _chunks.push_back(std::move(chunk));
+            return true;
+        }
+        catch (const std::exception& ex)
+        {
+            Logging::error("Unable to stream audio '{}': {}", _path, ex.what());
+
+            std::lock_guard lock(_mutex);
+            _state = AudioStreamState::failed;
+            close();
+            return false;
+        }
+    }
+
+    static std::thread _streamingThread;
+    static std::mutex _streamingMutex;
+    static std::condition_variable _streamingCondition;
+    static std::vector<std::weak_ptr<AudioStream>> _streams;
+    static bool _isStreamingRunning = false;
+    static bool _hasStreamingWork = false;
+    static std::function<void()> _streamingUpdate;
+
+    static void streamingThreadMain()
+    {
+        std::vector<std::shared_ptr<AudioStream>> streams;
+        std::function<void()> update;
+        while (true)
+        {
+            {
+                std::unique_lock lock(_streamingMutex);
+                // New streams and taken chunks wake the thread, the timeout keeps the update running
+                _streamingCondition.wait_for(lock, std::chrono::milliseconds(kStreamingUpdateInterval), [] { return !_isStreamingRunning || _hasStreamingWork; });
+                if (!_isStreamingRunning)
+                {
+                    break;
+                }
+                _hasStreamingWork = false;
+                update = _streamingUpdate;
+
+                std::erase_if(_streams, [](const auto& stream) { return stream.expired(); });
+                streams.clear();
+                for (const auto& weakStream : _streams)
+                {
+                    if (auto stream = weakStream.lock())
+                    {
+                        streams.push_back(std::move(stream));
+                    }
+                }
+            }
+
+            // Keep going until every queue is full or finished
+            bool didWork = true;
+            while (didWork)
+            {
+                didWork = false;
+                for (auto& stream : streams)
+                {
+                    didWork |= stream->decode();
+                }
+            }
+
+            // Don't keep streams alive while waiting
+            streams.clear();
+
+            if (update)
+            {
+                update();
+            }
+        }
+    }
+
+    void startStreaming()
+    {
+        std::lock_guard lock(_streamingMutex);
+        if (_isStreamingRunning)
+        {
+            return;
+        }
+        _isStreamingRunning = true;
+        _streamingThread = std::thread(streamingThreadMain);
+    }
+
+    void stopStreaming()
+    {
+        {
+            std::lock_guard lock(_streamingMutex);
+            if (!_isStreamingRunning)
+            {
+                return;
+            }
+            _isStreamingRunning = false;
+        }
+        _streamingCondition.notify_all();
+        _streamingThread.join();
+
+        std::lock_guard lock(_streamingMutex);
+        _streams.clear();
+    }
+
+    std::shared_ptr<AudioStream> openStream(const fs::path& path, bool loop)
+    {
+        auto stream = std::make_shared<AudioStream>(path, loop);
+        {
+            std::lock_guard lock(_streamingMutex);
+            _streams.push_back(stream);
+        }
+        notifyStreaming();
+        return stream;
+    }
+
+    void setStreamingUpdate(std::function<void()> update)
+    {
+        std::lock_guard lock(_streamingMutex);
+        _streamingUpdate = std::move(update);
+    }
+
+    void notifyStreaming()
+    {
+        {
+            std::lock_guard lock(_streamingMutex);
+            _hasStreamingWork = true;
+        }
+        _streamingCondition.notify_one();
+    }
+}
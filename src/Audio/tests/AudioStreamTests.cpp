@@ -0,0 +1,248 @@
+#include <OpenLoco/Audio/AudioStream.h>
+#include <OpenLoco/Core/FileStream.h>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+using namespace OpenLoco;
+using namespace OpenLoco::Audio;
+
+static fs::path getTempFilePath()
+{
+    char tempNameBuf[L_tmpnam]{};
+#ifdef _MSC_VER
+    tmpnam_s(tempNameBuf, L_tmpnam);
+    const char* tempName = tempNameBuf;
+#else
+    const char* tempName = tmpnam(tempNameBuf);
+#endif
+    auto tempDir = fs::temp_directory_path();
+    auto tempFile = tempDir / tempName;
+    return tempFile;
+}
+
+static std::vector<uint8_t> generateWave(const fs::path& filePath, size_t dataLength)
+{
+    std::vector<uint8_t> pcm(dataLength);
+    for (size_t i = 0; i < dataLength; i++)
+    {
+        pcm[i] = static_cast<uint8_t>((i * 7) % 256);
+    }
+
+    FileStream fs(filePath, StreamMode::write);
+    fs.writeValue<uint32_t>(0x46464952);
+    fs.writeValue<uint32_t>(static_cast<uint32_t>(36 + dataLength));
+    fs.writeValue<uint32_t>(0x45564157);
+    fs.writeValue<uint32_t>(0x20746d66);
+    fs.writeValue<uint32_t>(16);
+    fs.writeValue<uint16_t>(1);
+    fs.writeValue<uint16_t>(2);
+    fs.writeValue<uint32_t>(22050);
+    fs.writeValue<uint32_t>(22050 * 4);
+    fs.writeValue<uint16_t>(4);
+    fs.writeValue<uint16_t>(16);
+    fs.writeValue<uint32_t>(0x61746164);
+    fs.writeValue<uint32_t>(static_cast<uint32_t>(dataLength));
+    fs.write(pcm.data(), pcm.size());
+    return pcm;
+}
+
+// Decodes and takes chunks until the stream is drained or the limit is reached
+static std::vector<uint8_t> readStream(AudioStream& stream, size_t limit)
+{
+    std::vector<uint8_t> result;
+    while (result.size() < limit)
+    {
+        stream.decode();
+        auto chunk = stream.takeChunk();
+        if (!chunk)
+        {
+            break;
+        }
+        result.insert(result.end(), chunk->begin(), chunk->end());
+    }
+    return result;
+}
+
+TEST(AudioStreamTest, testStreamContents)
+{
+    const auto path = getTempFilePath();
+    const auto pcm = generateWave(path, AudioStream::kChunkSize * 3 + 123);
+
+    AudioStream stream(path, false);
+    EXPECT_EQ(stream.getState(), AudioStreamState::opening);
+    EXPECT_FALSE(stream.getFormat().has_value());
+
+    const auto data = readStream(stream, SIZE_MAX);
+    EXPECT_EQ(data, pcm);
+    EXPECT_EQ(stream.getState(), AudioStreamState::finished);
+    EXPECT_TRUE(stream.isDrained());
+
+    const auto format = stream.getFormat();
+    ASSERT_TRUE(format.has_value());
+    EXPECT_EQ(format->channels, 2);
+    EXPECT_EQ(format->sampleRate, 22050U);
+    EXPECT_EQ(format->bitsPerSample, 16);
+
+    fs::remove(path);
+}
+
+TEST(AudioStreamTest, testStreamLoops)
+{
+    const auto path = getTempFilePath();
+    const auto pcm = generateWave(path, AudioStream::kChunkSize + 100);
+
+    AudioStream stream(path, true);
+    const auto data = readStream(stream, pcm.size() * 3);
+    ASSERT_EQ(data.size(), pcm.size() * 3);
+    for (size_t i = 0; i < data.size(); i++)
+    {
+        ASSERT_EQ(data[i], pcm[i % pcm.size()]);
+    }
+    EXPECT_EQ(stream.getState(), AudioStreamState::streaming);
+    EXPECT_FALSE(stream.isDrained());
+
+    stream.setLoop(false);
+    readStream(stream, SIZE_MAX);
+    EXPECT_TRUE(stream.isDrained());
+
+    fs::remove(path);
+}
+
+TEST(AudioStreamTest, testQueueIsBounded)
+{
+    const auto path = getTempFilePath();
+    generateWave(path, AudioStream::kChunkSize * (AudioStream::kMaxQueuedChunks + 4));
+
+    AudioStream stream(path, false);
+    size_t numDecoded = 0;
+    while (stream.decode())
+    {
+        numDecoded++;
+    }
+    EXPECT_EQ(numDecoded, AudioStream::kMaxQueuedChunks);
+    EXPECT_EQ(stream.getQueuedBytes(), AudioStream::kChunkSize * AudioStream::kMaxQueuedChunks);
+
+    // Taking a chunk makes room for exactly one more
+    ASSERT_TRUE(stream.takeChunk().has_value());
+    EXPECT_TRUE(stream.decode());
+    EXPECT_FALSE(stream.decode());
+
+    fs::remove(path);
+}
+
+TEST(AudioStreamTest, testInvalidFile)
+{
+    const auto path = getTempFilePath();
+    {
+        FileStream fs(path, StreamMode::write);
+        fs.writeValue<uint32_t>(0x12345678);
+        fs.writeValue<uint32_t>(0);
+    }
+
+    AudioStream stream(path, true);
+    EXPECT_FALSE(stream.decode());
+    EXPECT_EQ(stream.getState(), AudioStreamState::failed);
+    EXPECT_FALSE(stream.getFormat().has_value());
+    EXPECT_TRUE(stream.isDrained());
+
+    AudioStream missing(path.string() + ".missing", false);
+    EXPECT_FALSE(missing.decode());
+    EXPECT_EQ(missing.getState(), AudioStreamState::failed);
+
+    fs::remove(path);
+}
+
+TEST(AudioStreamTest, testStreamingThread)
+{
+    const auto path = getTempFilePath();
+    const auto pcm = generateWave(path, AudioStream::kChunkSize * 10 + 7);
+
+    startStreaming();
+    auto stream = openStream(path, false);
+
+    std::vector<uint8_t> data;
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (!stream->isDrained() && std::chrono::steady_clock::now() < deadline)
+    {
+        EXPECT_LE(stream->getQueuedBytes(), AudioStream::kChunkSize * AudioStream::kMaxQueuedChunks);
+        if (auto chunk = stream->takeChunk())
+        {
+            data.insert(data.end(), chunk->begin(), chunk->end());
+            notifyStreaming();
+        }
+        else
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+    stopStreaming();
+
+    EXPECT_EQ(data, pcm);
+
+    fs::remove(path);
+}
+
+TEST(AudioStreamTest, testFinishedTrackIsCached)
+{
+    const auto path = getTempFilePath();
+    const auto pcm = generateWave(path, AudioStream::kChunkSize * 2 + 55);
+
+    AudioStream first(path, false);
+    EXPECT_EQ(readStream(first, SIZE_MAX), pcm);
+
+    // Played again from memory, the file is no longer needed
+    fs::remove(path);
+    AudioStream second(path, true);
+    const auto data = readStream(second, pcm.size() * 2);
+    ASSERT_EQ(data.size(), pcm.size() * 2);
+    for (size_t i = 0; i < data.size(); i++)
+    {
+        ASSERT_EQ(data[i], pcm[i % pcm.size()]);
+    }
+    const auto format = second.getFormat();
+    ASSERT_TRUE(format.has_value());
+    EXPECT_EQ(format->sampleRate, 22050U);
+
+    clearTrackCache();
+    AudioStream third(path, false);
+    EXPECT_FALSE(third.decode());
+    EXPECT_EQ(third.getState(), AudioStreamState::failed);
+}
+
+TEST(AudioStreamTest, testLargeTrackIsNotCached)
+{
+    const auto path = getTempFilePath();
+    const auto pcm = generateWave(path, AudioStream::kMaxCachedTrackSize + 1);
+
+    AudioStream first(path, false);
+    EXPECT_EQ(readStream(first, SIZE_MAX).size(), pcm.size());
+
+    fs::remove(path);
+    AudioStream second(path, false);
+    EXPECT_FALSE(second.decode());
+    EXPECT_EQ(second.getState(), AudioStreamState::failed);
+}
+
+TEST(AudioStreamTest, testStreamingUpdateRunsWhileIdle)
+{
+    std::atomic<uint32_t> numUpdates = 0;
+    setStreamingUpdate([&numUpdates] { numUpdates++; });
+    startStreaming();
+
+    // Nothing notifies the thread, the update has to keep running on its own
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (numUpdates < 3 && std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(kStreamingUpdateInterval));
+    }
+    stopStreaming();
+    setStreamingUpdate(nullptr);
+
+    EXPECT_GE(numUpdates, 3U);
+}
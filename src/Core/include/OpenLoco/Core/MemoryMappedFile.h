@@ -0,0 +1,40 @@
+#pragma once
+
+#include "FileSystem.hpp"
+#include <cstddef>
+#include <span>
+
+namespace OpenLoco
+{
+    // Maps a whole file into memory, pages are only read from disk once they are first touched.
+    // The mapping is private copy-on-write so writes through it never reach the file.
+    class MemoryMappedFile final
+    {
+    private:
+        std::byte* _data{};
+        size_t _length{};
+#ifdef _WIN32
+        void* _mapping{};
+#endif
+
+    public:
+        MemoryMappedFile() = default;
+        MemoryMappedFile(const fs::path& path);
+        MemoryMappedFile(const MemoryMappedFile&) = delete;
+        MemoryMappedFile(MemoryMappedFile&& other) noexcept;
+        ~MemoryMappedFile();
+
+        MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+        MemoryMappedFile& operator=(MemoryMappedFile&& other) noexcept;
+
+        bool open(const fs::path& path);
+
+        bool isOpen() const noexcept;
+
+        void close();
+
+        size_t getLength() const noexcept;
+
+        std::span<std::byte> getData() const noexcept;
+    };
+}
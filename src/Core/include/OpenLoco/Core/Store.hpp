@@ -1,5 +1,6 @@
 #pragma once
 
+#include <algorithm>
 #include <bit>
 #include <cassert>
 #include <cstdint>
@@ -52,6 +53,56 @@ namespace OpenLoco
             return (_live[wordOf(i)] & maskOf(i)) != 0;
         }
 
+        // First slot at or after i whose live bit equals IsLive, or the capacity if there is none.
+        // Whole words are skipped at a time so sparse stores are cheap to walk.
+        template<bool IsLive>
+        Index findSlot(Index i) const noexcept
+        {
+            const auto cap = static_cast<Index>(_slots.size());
+            if (i >= cap)
+            {
+                return cap;
+            }
+
+            size_t word = wordOf(i);
+            size_t bits = (IsLive ? _live[word] : ~_live[word]) & ~(maskOf(i) - 1);
+            while (bits == 0)
+            {
+                if (++word >= _live.size())
+                {
+                    return cap;
+                }
+                bits = IsLive ? _live[word] : ~_live[word];
+            }
+            return std::min(static_cast<Index>(word * kBitsPerWord + std::countr_zero(bits)), cap);
+        }
+
+        // Last live slot before i, or kInvalidIndex if there is none
+        Index findLiveBefore(Index i) const noexcept
+        {
+            if (i == 0)
+            {
+                return kInvalidIndex;
+            }
+
+            size_t word = wordOf(i - 1);
+            const size_t bitInWord = (i - 1) % kBitsPerWord;
+            size_t bits = _live[word];
+            if (bitInWord != kBitsPerWord - 1)
+            {
+                bits &= (size_t{ 1 } << (bitInWord + 1)) - 1;
+            }
+            while (bits == 0)
+            {
+                if (word == 0)
+                {
+                    return kInvalidIndex;
+                }
+                bits = _live[--word];
+            }
+            return static_cast<Index>(word * kBitsPerWord + (kBitsPerWord - 1 - std::countl_zero(bits)));
+        }
+
         void ensureLiveBitsFor(size_t slotCount)
         {
             const size_t words = (slotCount + kBitsPerWord - 1) / kBitsPerWord;
@@ -79,11 +130,7 @@ namespace OpenLoco
 
             void advanceToLive() noexcept
             {
-                const auto cap = static_cast<Index>(_store->_slots.size());
-                while (_index < cap && !_store->testLiveBit(_index))
-                {
-                    ++_index;
-                }
+                _index = _store->template findSlot<true>(_index);
             }
 
         public:
@@ -235,6 +282,32 @@ namespace OpenLoco
             ensureLiveBitsFor(n);
         }
 
+        // Moves live elements from the end of the store into the free slots at the front and then
+        // releases everything past the last live element. onMove(from, to) is called for every element
+        // that is relocated so the caller can rewrite whatever refers to it by index.
+        template<typename TOnMove>
+        void compact(TOnMove&& onMove)
+        {
+            Index to = findSlot<false>(0);
+            Index from = findLiveBefore(static_cast<Index>(_slots.size()));
+            while (from != kInvalidIndex && to < from)
+            {
+                _slots[to] = std::move(_slots[from]);
+                setLiveBit(to);
+                clearLiveBit(from);
+                onMove(from, to);
+
+                to = findSlot<false>(to + 1);
+                from = findLiveBefore(from);
+            }
+
+            _slots.resize(_liveCount);
+            _slots.shrink_to_fit();
+            _live.resize((_liveCount + kBitsPerWord - 1) / kBitsPerWord);
+            _live.shrink_to_fit();
+            _firstFreeHint = static_cast<Index>(_liveCount);
+        }
+
         iterator begin() noexcept
         {
             return iterator(this, 0);
@@ -0,0 +1,162 @@
+#include "MemoryMappedFile.h"
+#include "Exception.hpp"
+#include <utility>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace OpenLoco
+{
+    MemoryMappedFile::MemoryMappedFile(const fs::path& path)
+    {
+        if (!open(path))
+        {
+            throw Exception::RuntimeError("Failed to map '" + path.u8string() + "'");
+        }
+    }
+
+    MemoryMappedFile::MemoryMappedFile(MemoryMappedFile&& other) noexcept
+    {
+        *this = std::move(other);
+    }
+
+    MemoryMappedFile::~MemoryMappedFile()
+    {
+        close();
+    }
+
+    MemoryMappedFile& MemoryMappedFile::operator=(MemoryMappedFile&& other) noexcept
+    {
+        if (this != &other)
+        {
+            close();
+            _data = std::exchange(other._data, nullptr);
+            _length = std::exchange(other._length, 0);
+#ifdef _WIN32
+            _mapping = std::exchange(other._mapping, nullptr);
+#endif
+        }
+        return *this;
+    }
+
+#ifdef _WIN32
+    bool MemoryMappedFile::open(const fs::path& path)
+    {
+        close();
+
+        auto file = CreateFileW(path.wstring().c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            return false;
+        }
+
+        LARGE_INTEGER size{};
+        if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+        {
+            CloseHandle(file);
+            return false;
+        }
+
+        // The mapping keeps its own reference to the file
+        auto mapping = CreateFileMappingW(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+        CloseHandle(file);
+        if (mapping == nullptr)
+        {
+            return false;
+        }
+
+        auto* data = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+        if (data == nullptr)
+        {
+            CloseHandle(mapping);
+            return false;
+        }
+
+        _mapping = mapping;
+        _data = static_cast<std::byte*>(data);
+        _length = static_cast<size_t>(size.QuadPart);
+        return true;
+    }
+
+    void MemoryMappedFile::close()
+    {
+        if (_data == nullptr)
+        {
+            return;
+        }
+        UnmapViewOfFile(_data);
+        CloseHandle(_mapping);
+        _mapping = nullptr;
+        _data = nullptr;
+        _length = 0;
+    }
+#else
+    bool MemoryMappedFile::open(const fs::path& path)
+    {
+        close();
+
+        const auto fd = ::open(path.u8string().c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd == -1)
+        {
+            return false;
+        }
+
+        struct stat st{};
+        if (fstat(fd, &st) != 0 || st.st_size == 0)
+        {
+            ::close(fd);
+            return false;
+        }
+
+        // The mapping keeps its own reference to the file
+        auto* data = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (data == MAP_FAILED)
+        {
+            return false;
+        }
+
+        _data = static_cast<std::byte*>(data);
+        _length = static_cast<size_t>(st.st_size);
+        return true;
+    }
+
+    void MemoryMappedFile::close()
+    {
+        if (_data == nullptr)
+        {
+            return;
+        }
+        munmap(_data, _length);
+        _data = nullptr;
+        _length = 0;
+    }
+#endif
+
+    bool MemoryMappedFile::isOpen() const noexcept
+    {
+        return _data != nullptr;
+    }
+
+    size_t MemoryMappedFile::getLength() const noexcept
+    {
+        return _length;
+    }
+
+    std::span<std::byte> MemoryMappedFile::getData() const noexcept
+    {
+        return std::span(_data, _length);
+    }
+}
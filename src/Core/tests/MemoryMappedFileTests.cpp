@@ -0,0 +1,99 @@
+#include <OpenLoco/Core/FileStream.h>
+#include <OpenLoco/Core/MemoryMappedFile.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace OpenLoco;
+
+static fs::path getTempFilePath()
+{
+    char tempNameBuf[L_tmpnam]{};
+#ifdef _MSC_VER
+    tmpnam_s(tempNameBuf, L_tmpnam);
+    const char* tempName = tempNameBuf;
+#else
+    const char* tempName = tmpnam(tempNameBuf);
+#endif
+    auto tempDir = fs::temp_directory_path();
+    auto tempFile = tempDir / tempName;
+    return tempFile;
+}
+
+static std::vector<uint8_t> generateFile(const fs::path& filePath, size_t dataLength)
+{
+    std::vector<uint8_t> data(dataLength);
+    for (size_t i = 0; i < dataLength; i++)
+    {
+        data[i] = static_cast<uint8_t>((i * 7) % 256);
+    }
+
+    FileStream streamOut(filePath, StreamMode::write);
+    streamOut.write(data.data(), data.size());
+    return data;
+}
+
+TEST(MemoryMappedFileTest, testMapContents)
+{
+    const auto filePath = getTempFilePath();
+    // Spans several pages so the tail is only paged in on access
+    const auto testData = generateFile(filePath, 3 * 4096 + 123);
+
+    {
+        MemoryMappedFile file(filePath);
+        ASSERT_TRUE(file.isOpen());
+        ASSERT_EQ(file.getLength(), testData.size());
+
+        const auto data = file.getData();
+        ASSERT_TRUE(std::equal(testData.begin(), testData.end(), reinterpret_cast<const uint8_t*>(data.data())));
+    }
+
+    fs::remove(filePath);
+}
+
+TEST(MemoryMappedFileTest, testWritesDoNotReachFile)
+{
+    const auto filePath = getTempFilePath();
+    const auto testData = generateFile(filePath, 256);
+
+    {
+        MemoryMappedFile file(filePath);
+        ASSERT_TRUE(file.isOpen());
+        file.getData()[10] = std::byte{ 0xAB };
+        ASSERT_EQ(file.getData()[10], std::byte{ 0xAB });
+    }
+
+    MemoryMappedFile file(filePath);
+    ASSERT_TRUE(file.isOpen());
+    ASSERT_EQ(static_cast<uint8_t>(file.getData()[10]), testData[10]);
+    file.close();
+
+    fs::remove(filePath);
+}
+
+TEST(MemoryMappedFileTest, testMove)
+{
+    const auto filePath = getTempFilePath();
+    const auto testData = generateFile(filePath, 64);
+
+    {
+        MemoryMappedFile file(filePath);
+        MemoryMappedFile moved(std::move(file));
+        ASSERT_FALSE(file.isOpen());
+        ASSERT_TRUE(moved.isOpen());
+        ASSERT_EQ(static_cast<uint8_t>(moved.getData()[63]), testData[63]);
+    }
+
+    fs::remove(filePath);
+}
+
+TEST(MemoryMappedFileTest, testOpenMissingFile)
+{
+    MemoryMappedFile file;
+    ASSERT_FALSE(file.open(getTempFilePath()));
+    ASSERT_FALSE(file.isOpen());
+    ASSERT_EQ(file.getLength(), 0);
+}
@@ -1,4 +1,5 @@
 #include <OpenLoco/Core/Store.hpp>
+#include <algorithm>
 #include <gtest/gtest.h>
 #include <limits>
 #include <string>
@@ -591,3 +592,107 @@ TEST(StoreTest, allocateAfterClearRegrowsCleanly)
     }
     ASSERT_EQ(liveSum, expected);
 }
+
+TEST(StoreTest, iteratorSkipsEmptyWords)
+{
+    Store<int> s;
+    for (int v = 0; v < 1000; ++v)
+    {
+        auto i = s.allocate();
+        s[i] = v;
+    }
+    for (Store<int>::Index i = 0; i < 1000; ++i)
+    {
+        if (i != 5 && i != 64 && i != 700 && i != 999)
+        {
+            s.release(i);
+        }
+    }
+
+    std::vector<Store<int>::Index> seen;
+    for (auto it = s.begin(); it != s.end(); ++it)
+    {
+        seen.push_back(it.index());
+        ASSERT_EQ(*it, static_cast<int>(it.index()));
+    }
+    ASSERT_EQ(seen, (std::vector<Store<int>::Index>{ 5, 64, 700, 999 }));
+}
+
+TEST(StoreTest, compactMovesLiveElementsToTheFront)
+{
+    Store<int> s;
+    for (int v = 0; v < 200; ++v)
+    {
+        auto i = s.allocate();
+        s[i] = v;
+    }
+    for (Store<int>::Index i = 0; i < 200; ++i)
+    {
+        if (i % 3 != 0)
+        {
+            s.release(i);
+        }
+    }
+    ASSERT_EQ(s.size(), 67u);
+
+    std::vector<std::pair<Store<int>::Index, Store<int>::Index>> moves;
+    s.compact([&moves](Store<int>::Index from, Store<int>::Index to) {
+        moves.emplace_back(from, to);
+    });
+
+    ASSERT_EQ(s.size(), 67u);
+    ASSERT_EQ(s.capacity(), 67u);
+    for (auto [from, to] : moves)
+    {
+        ASSERT_LT(to, from);
+        ASSERT_EQ(s[to], static_cast<int>(from));
+    }
+
+    std::vector<int> values;
+    for (auto& v : s)
+    {
+        values.push_back(v);
+    }
+    ASSERT_EQ(values.size(), 67u);
+    std::sort(values.begin(), values.end());
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        ASSERT_EQ(values[i], static_cast<int>(i * 3));
+    }
+
+    ASSERT_EQ(s.allocate(), 67u);
+}
+
+TEST(StoreTest, compactDenseStoreMovesNothing)
+{
+    Store<int> s;
+    for (int v = 0; v < 10; ++v)
+    {
+        s.allocate();
+    }
+    s.release(9);
+
+    size_t numMoves = 0;
+    s.compact([&numMoves](Store<int>::Index, Store<int>::Index) { numMoves++; });
+    ASSERT_EQ(numMoves, 0u);
+    ASSERT_EQ(s.capacity(), 9u);
+}
+
+TEST(StoreTest, compactEmptiedStore)
+{
+    Store<int> s;
+    for (int v = 0; v < 100; ++v)
+    {
+        s.allocate();
+    }
+    for (Store<int>::Index i = 0; i < 100; ++i)
+    {
+        s.release(i);
+    }
+
+    s.compact([](Store<int>::Index, Store<int>::Index) { FAIL(); });
+    ASSERT_TRUE(s.empty());
+    ASSERT_EQ(s.capacity(), 0u);
+    ASSERT_EQ(s.begin(), s.end());
+    ASSERT_EQ(s.allocate(), 0u);
+}
@@ -44,6 +44,9 @@ namespace OpenLoco::Diagnostics::Assert
                 Detail::formatValue(lhs),
                 op,
                 Detail::formatValue(rhs));
+
+            // The caller is about to break or abort, make sure the message isn't lost with it
+            Logging::flush();
         }
 
         template<typename Ptr>
@@ -121,6 +124,7 @@ namespace OpenLoco::Diagnostics::Assert
                 "Assertion failure ({}:{}): expected true",
                 loc.file(),
                 loc.line());
+            Logging::flush();
             OPENLOCO_DEBUG_BREAK();
         }
     }
@@ -133,6 +137,7 @@ namespace OpenLoco::Diagnostics::Assert
                 "Assertion failure ({}:{}): expected false",
                 loc.file(),
                 loc.line());
+            Logging::flush();
             OPENLOCO_DEBUG_BREAK();
         }
     }
@@ -147,6 +152,7 @@ namespace OpenLoco::Diagnostics::Assert
                 loc.file(),
                 loc.line(),
                 Detail::formatValue(ptr));
+            Logging::flush();
             OPENLOCO_DEBUG_BREAK();
         }
     }
@@ -160,6 +166,7 @@ namespace OpenLoco::Diagnostics::Assert
                 "Assertion failure ({}:{}): expected non-null pointer",
                 loc.file(),
                 loc.line());
+            Logging::flush();
             OPENLOCO_DEBUG_BREAK();
         }
     }
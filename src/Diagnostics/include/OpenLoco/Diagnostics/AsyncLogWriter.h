@@ -0,0 +1,61 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+
+namespace OpenLoco::Diagnostics::Logging
+{
+    // Writes log text on a background thread so the thread logging never waits on the disk or
+    // console. Lines are pushed onto a lock-free list, the writer thread takes everything pushed so
+    // far in one go and writes it in as few calls as possible before flushing once.
+    class AsyncLogWriter
+    {
+    public:
+        // Receives consecutive lines for the same target joined together
+        using WriteFunc = std::function<void(uint8_t target, std::string_view text)>;
+        using FlushFunc = std::function<void()>;
+
+    private:
+        struct Entry
+        {
+            Entry* next{};
+            uint8_t target{};
+            std::string text;
+        };
+
+        WriteFunc _write;
+        FlushFunc _flush;
+
+        std::atomic<Entry*> _head{};
+        std::atomic<uint64_t> _numPushed{};
+        std::atomic<uint64_t> _numWritten{};
+
+        std::mutex _mutex;
+        std::condition_variable _wakeCondition;
+        std::condition_variable _writtenCondition;
+        bool _isStopping{};
+        std::thread _thread;
+
+        void threadMain();
+        bool writePending();
+
+    public:
+        AsyncLogWriter(WriteFunc write, FlushFunc flush);
+        ~AsyncLogWriter();
+
+        AsyncLogWriter(const AsyncLogWriter&) = delete;
+        AsyncLogWriter& operator=(const AsyncLogWriter&) = delete;
+
+        void push(uint8_t target, std::string text);
+
+        // Waits until everything pushed before the call has been written and flushed.
+        // The wait is bounded so a stuck writer can't hang the crash handler.
+        void flush();
+    };
+}
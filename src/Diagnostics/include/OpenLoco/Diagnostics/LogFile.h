@@ -1,6 +1,7 @@
 #pragma once
 
 #include <OpenLoco/Core/FileSystem.hpp>
+#include <OpenLoco/Diagnostics/AsyncLogWriter.h>
 #include <OpenLoco/Diagnostics/LogSink.h>
 #include <fstream>
 
@@ -9,10 +10,13 @@ namespace OpenLoco::Diagnostics::Logging
     class LogFile final : public LogSink
     {
         std::fstream _file;
+        // Must be destroyed before the file so everything queued is written first
+        AsyncLogWriter _writer;
 
     public:
         LogFile(const fs::path& file);
 
         void print(Level level, std::string_view message) override;
+        void flush() override;
     };
 }
@@ -13,6 +13,9 @@ namespace OpenLoco::Diagnostics::Logging
 
         virtual void print(Level level, std::string_view message) = 0;
 
+        // Writes out anything the sink is still holding on to.
+        virtual void flush() {}
+
         template<typename... TArgs>
         void info(fmt::format_string<TArgs...> fmt, TArgs&&... args)
         {
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <OpenLoco/Diagnostics/AsyncLogWriter.h>
 #include <OpenLoco/Diagnostics/LogSink.h>
 
 namespace OpenLoco::Diagnostics::Logging
@@ -7,10 +8,12 @@ namespace OpenLoco::Diagnostics::Logging
     class LogTerminal final : public LogSink
     {
         bool _vt100Enabled{};
+        AsyncLogWriter _writer;
 
     public:
         LogTerminal();
 
         void print(Level level, std::string_view message) override;
+        void flush() override;
     };
 }
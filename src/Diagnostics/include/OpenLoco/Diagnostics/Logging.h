@@ -70,4 +70,7 @@ namespace OpenLoco::Diagnostics::Logging
     void installSink(std::shared_ptr<LogSink> sink);
 
     void removeSink(std::shared_ptr<LogSink> sink);
+
+    // Sinks may write in the background, this waits until everything logged so far has been written.
+    void flush();
 }
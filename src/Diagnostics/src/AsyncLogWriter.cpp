@@ -0,0 +1,114 @@
+#include "OpenLoco/Diagnostics/AsyncLogWriter.h"
+#include <chrono>
+
+namespace OpenLoco::Diagnostics::Logging
+{
+    // The writer also wakes up on this interval, which covers a push racing with it going to sleep
+    static constexpr auto kWriterInterval = std::chrono::milliseconds(50);
+    static constexpr auto kFlushTimeout = std::chrono::seconds(2);
+
+    AsyncLogWriter::AsyncLogWriter(WriteFunc write, FlushFunc flush)
+        : _write(std::move(write))
+        , _flush(std::move(flush))
+    {
+        _thread = std::thread([this] { threadMain(); });
+    }
+
+    AsyncLogWriter::~AsyncLogWriter()
+    {
+        {
+            std::lock_guard lock(_mutex);
+            _isStopping = true;
+        }
+        _wakeCondition.notify_one();
+        _thread.join();
+
+        // Anything pushed while the thread was stopping
+        writePending();
+    }
+
+    void AsyncLogWriter::push(uint8_t target, std::string text)
+    {
+        auto* entry = new Entry{ nullptr, target, std::move(text) };
+        entry->next = _head.load(std::memory_order_relaxed);
+        while (!_head.compare_exchange_weak(entry->next, entry, std::memory_order_release, std::memory_order_relaxed))
+        {
+        }
+        _numPushed.fetch_add(1, std::memory_order_relaxed);
+        _wakeCondition.notify_one();
+    }
+
+    bool AsyncLogWriter::writePending()
+    {
+        auto* list = _head.exchange(nullptr, std::memory_order_acquire);
+        if (list == nullptr)
+        {
+            return false;
+        }
+
+        // The list is newest first, reverse it to write in the order it was logged
+        Entry* entry = nullptr;
+        while (list != nullptr)
+        {
+            auto* next = list->next;
+            list->next = entry;
+            entry = list;
+            list = next;
+        }
+
+        uint64_t numEntries = 0;
+        std::string batch;
+        while (entry != nullptr)
+        {
+            const auto target = entry->target;
+            batch.clear();
+            while (entry != nullptr && entry->target == target)
+            {
+                batch += entry->text;
+
+                auto* next = entry->next;
+                delete entry;
+                entry = next;
+                numEntries++;
+            }
+            _write(target, batch);
+        }
+        _flush();
+
+        _numWritten.fetch_add(numEntries, std::memory_order_release);
+        return true;
+    }
+
+    void AsyncLogWriter::threadMain()
+    {
+        while (true)
+        {
+            if (writePending())
+            {
+                std::lock_guard lock(_mutex);
+                _writtenCondition.notify_all();
+                continue;
+            }
+
+            std::unique_lock lock(_mutex);
+            if (_isStopping)
+            {
+                break;
+            }
+            _wakeCondition.wait_for(lock, kWriterInterval, [this] {
+                return _isStopping || _head.load(std::memory_order_relaxed) != nullptr;
+            });
+        }
+    }
+
+    void AsyncLogWriter::flush()
+    {
+        const auto target = _numPushed.load(std::memory_order_relaxed);
+        _wakeCondition.notify_one();
+
+        std::unique_lock lock(_mutex);
+        _writtenCondition.wait_for(lock, kFlushTimeout, [this, target] {
+            return _numWritten.load(std::memory_order_acquire) >= target;
+        });
+    }
+}
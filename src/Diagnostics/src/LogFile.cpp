@@ -16,6 +16,9 @@
 namespace OpenLoco::Diagnostics::Logging
 {
     LogFile::LogFile(const fs::path& file)
+        : _writer(
+              [this](uint8_t, std::string_view text) { _file.write(text.data(), text.size()); },
+              [this]() { _file.flush(); })
     {
         // Ensure the directory exists in case the filepath is a relative path and contains a sub directory.
         fs::create_directories(file.parent_path());
@@ -44,9 +47,12 @@ namespace OpenLoco::Diagnostics::Logging
 
         const int intendSize = getIntendSize();
 
-        fmt::print(_file, "{}{}{:<{}}\n", timestamp, getLevelPrefix(level), message, intendSize);
+        // The writer flushes after each batch, and the crash handler flushes the writer.
+        _writer.push(0, fmt::format("{}{}{:<{}}\n", timestamp, getLevelPrefix(level), message, intendSize));
+    }
 
-        // Ensure we are not loosing anything because of buffering in case of a crash.
-        _file.flush();
+    void LogFile::flush()
+    {
+        _writer.flush();
     }
 }
@@ -17,25 +17,42 @@ namespace OpenLoco::Diagnostics::Logging
     static constexpr auto kColourError = fmt::fg(fmt::color::red);
     static constexpr auto kColourVerbose = fmt::fg(fmt::color::gray);
 
-    LogTerminal::LogTerminal()
+    enum OutputStream : uint8_t
     {
-        _vt100Enabled = Platform::enableVT100TerminalMode();
-    }
+        standardOutput,
+        standardError,
+    };
 
-    static FILE* getOutputStream(Level level)
+    static OutputStream getOutputStream(Level level)
     {
         switch (level)
         {
             case Level::info:
             case Level::warning:
             case Level::verbose:
-                return stdout;
+                return standardOutput;
             case Level::error:
-                return stderr;
+                return standardError;
             default:
                 break;
         }
-        return stdout;
+        return standardOutput;
+    }
+
+    static FILE* getOutputFile(uint8_t stream)
+    {
+        return stream == standardError ? stderr : stdout;
+    }
+
+    LogTerminal::LogTerminal()
+        : _writer(
+              [](uint8_t stream, std::string_view text) { std::fwrite(text.data(), 1, text.size(), getOutputFile(stream)); },
+              []() {
+                  std::fflush(stdout);
+                  std::fflush(stderr);
+              })
+    {
+        _vt100Enabled = Platform::enableVT100TerminalMode();
     }
 
     static fmt::text_style getTextStyle(Level level)
@@ -79,12 +96,17 @@ namespace OpenLoco::Diagnostics::Logging
 
         if (_vt100Enabled)
         {
-            fmt::print(getOutputStream(level), getTextStyle(level), "{}{:>{}}\n", timestamp, message, intendSize);
+            _writer.push(getOutputStream(level), fmt::format(getTextStyle(level), "{}{:>{}}\n", timestamp, message, intendSize));
         }
         else
         {
-            fmt::print(getOutputStream(level), "{}{}{:<{}}\n", timestamp, getLevelPrefix(level), message, intendSize);
+            _writer.push(getOutputStream(level), fmt::format("{}{}{:<{}}\n", timestamp, getLevelPrefix(level), message, intendSize));
         }
     }
 
+    void LogTerminal::flush()
+    {
+        _writer.flush();
+    }
+
 }
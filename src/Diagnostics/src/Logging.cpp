@@ -4,23 +4,32 @@
 #include <LogLevel.h>
 #include <algorithm>
 #include <memory>
+#include <mutex>
 #include <string_view>
 #include <vector>
 
 namespace OpenLoco::Diagnostics::Logging
 {
     static std::vector<std::shared_ptr<LogSink>> _sinks;
+    // Messages can come from worker threads, e.g. while building the object index
+    static std::mutex _printMutex;
+
+    // Used when no sinks have been installed
+    static LogTerminal& getDefaultTerminal()
+    {
+        static LogTerminal _logTerminal;
+        return _logTerminal;
+    }
 
     namespace Detail
     {
 
         void print(Level level, std::string_view message)
         {
-            static LogTerminal _logTerminal;
-
+            std::lock_guard lock(_printMutex);
             if (_sinks.empty())
             {
-                _logTerminal.print(level, message);
+                getDefaultTerminal().print(level, message);
                 return;
             }
 
@@ -69,6 +78,22 @@ namespace OpenLoco::Diagnostics::Logging
         }
     }
 
+    // Deliberately doesn't take the print lock, the crash handler may be running on a thread that
+    // crashed while holding it.
+    void flush()
+    {
+        if (_sinks.empty())
+        {
+            getDefaultTerminal().flush();
+            return;
+        }
+
+        for (auto& sink : _sinks)
+        {
+            sink->flush();
+        }
+    }
+
     void incrementIntend()
     {
         for (auto& sink : _sinks)
@@ -0,0 +1,122 @@
+#include <OpenLoco/Diagnostics/AsyncLogWriter.h>
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace OpenLoco::Diagnostics;
+
+namespace
+{
+    struct WriteLog
+    {
+        std::string text[2];
+        int numFlushes = 0;
+    };
+}
+
+TEST(AsyncLogWriterTests, FlushWritesEverything)
+{
+    WriteLog log;
+    Logging::AsyncLogWriter writer(
+        [&log](uint8_t target, std::string_view text) { log.text[target] += text; },
+        [&log]() { log.numFlushes++; });
+
+    std::string expected;
+    for (int i = 0; i < 1000; i++)
+    {
+        auto line = std::to_string(i) + "\n";
+        expected += line;
+        writer.push(0, line);
+    }
+    writer.flush();
+
+    EXPECT_EQ(log.text[0], expected);
+    EXPECT_TRUE(log.text[1].empty());
+    EXPECT_GE(log.numFlushes, 1);
+}
+
+TEST(AsyncLogWriterTests, KeepsOrderAcrossTargets)
+{
+    std::string combined;
+    Logging::AsyncLogWriter writer(
+        [&combined](uint8_t target, std::string_view text) {
+            combined += std::to_string(target);
+            combined += text;
+        },
+        []() {});
+
+    writer.push(0, "a");
+    writer.push(0, "b");
+    writer.push(1, "c");
+    writer.push(0, "d");
+    writer.flush();
+
+    // Consecutive lines for the same target may be joined but never reordered
+    EXPECT_TRUE(combined == "0ab1c0d" || combined == "0a0b1c0d");
+}
+
+TEST(AsyncLogWriterTests, ConcurrentProducers)
+{
+    constexpr int kNumThreads = 4;
+    constexpr int kNumLines = 2000;
+
+    std::vector<std::string> lines;
+    Logging::AsyncLogWriter writer(
+        [&lines](uint8_t, std::string_view text) {
+            size_t start = 0;
+            while (start < text.size())
+            {
+                const auto end = text.find('\n', start);
+                lines.emplace_back(text.substr(start, end - start));
+                start = end + 1;
+            }
+        },
+        []() {});
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kNumThreads; t++)
+    {
+        threads.emplace_back([&writer, t]() {
+            for (int i = 0; i < kNumLines; i++)
+            {
+                writer.push(0, std::to_string(t) + ":" + std::to_string(i) + "\n");
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    writer.flush();
+
+    ASSERT_EQ(lines.size(), static_cast<size_t>(kNumThreads * kNumLines));
+
+    // Lines from each thread must come out in the order that thread pushed them
+    int next[kNumThreads]{};
+    for (const auto& line : lines)
+    {
+        const auto sep = line.find(':');
+        const auto t = std::stoi(line.substr(0, sep));
+        const auto i = std::stoi(line.substr(sep + 1));
+        ASSERT_EQ(i, next[t]);
+        next[t]++;
+    }
+}
+
+TEST(AsyncLogWriterTests, DestructorDrainsQueue)
+{
+    std::string text;
+    int numFlushes = 0;
+    {
+        Logging::AsyncLogWriter writer(
+            [&text](uint8_t, std::string_view batch) { text += batch; },
+            [&numFlushes]() { numFlushes++; });
+        for (int i = 0; i < 100; i++)
+        {
+            writer.push(0, "x");
+        }
+    }
+    EXPECT_EQ(text, std::string(100, 'x'));
+    EXPECT_GE(numFlushes, 1);
+}
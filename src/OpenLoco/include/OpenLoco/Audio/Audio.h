@@ -106,8 +106,6 @@ namespace OpenLoco::Audio
 
     void resetSoundObjects();
 
-    std::optional<BufferId> loadMusicSample(Environment::PathId asset);
-
     int32_t calculatePan(const coord_t coord, const int32_t screenSize);
 
     constexpr int32_t kVolumeDbMin = -6000;
@@ -15,6 +15,7 @@ namespace OpenLoco
         uncompress,
         simulate,
         compare,
+        screenshot,
         help,
         version,
         intro,
@@ -27,6 +28,7 @@ namespace OpenLoco
         std::string path;
         std::string path2;
         std::optional<int32_t> ticks;
+        std::optional<int32_t> zoom;
         std::string outputPath;
         std::string bind;
         std::optional<uint16_t> port{};
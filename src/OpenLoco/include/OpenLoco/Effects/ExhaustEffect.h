@@ -18,7 +18,7 @@ namespace OpenLoco
         const SteamObject* getObject() const;
         void tick();
 
-        static Exhaust* create(World::Pos3 loc, uint8_t type);
+        static bool shouldDisperse(const World::Pos3& pos);
         bool isSubObjType1() const { return objectId & (1 << 7); } // Used for steam / steampuff
     };
     static_assert(sizeof(Exhaust) <= sizeof(Entity));
@@ -9,8 +9,6 @@ namespace OpenLoco
         uint16_t frame; // 0x28
 
         void tick();
-
-        static ExplosionSmoke* create(const World::Pos3& loc);
     };
     static_assert(sizeof(ExplosionSmoke) <= sizeof(Entity));
 }
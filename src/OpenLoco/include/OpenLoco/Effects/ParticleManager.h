@@ -0,0 +1,51 @@
+#pragma once
+
+#include <OpenLoco/Engine/World.hpp>
+#include <OpenLoco/Location.hpp>
+#include <cstdint>
+#include <limits>
+
+// Purely cosmetic effects (exhaust, smoke, splashes and explosion smoke) are kept here rather
+// than in the entity pool. They never influence the simulation, are not saved and are simply
+// not created when their budget is used up, so they can no longer starve vehicles of entities.
+namespace OpenLoco::ParticleManager
+{
+    enum class ParticleType : uint8_t
+    {
+        exhaust,
+        splash,
+        explosionSmoke,
+        smoke,
+    };
+    constexpr size_t kNumParticleTypes = 4;
+
+    using ParticleId = uint16_t;
+    constexpr ParticleId kNullParticle = std::numeric_limits<ParticleId>::max();
+
+    struct Particle
+    {
+        ParticleType type;
+        World::Pos3 position;
+        uint16_t frame;
+        uint8_t objectId; // Exhaust only, bit 7 selects the steam object's second frame set
+        uint8_t spriteWidth;
+        uint8_t spriteHeightNegative;
+        uint8_t spriteHeightPositive;
+    };
+
+    void reset();
+    void tick();
+
+    void createExhaust(const World::Pos3& loc, uint8_t type);
+    void createSmoke(const World::Pos3& loc);
+    void createSplash(const World::Pos3& pos);
+    void createExplosionSmoke(const World::Pos3& loc);
+
+    size_t getCount(ParticleType type);
+    size_t getBudget(ParticleType type);
+
+    // Particles are linked per tile in the same way as the entity spatial index
+    ParticleId firstOnTile(const World::Pos2& loc);
+    ParticleId nextOnTile(ParticleId id);
+    Particle get(ParticleId id);
+}
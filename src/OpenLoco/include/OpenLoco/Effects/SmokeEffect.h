@@ -9,8 +9,6 @@ namespace OpenLoco
         uint16_t frame; // 0x28
 
         void tick();
-
-        static Smoke* create(World::Pos3 loc);
     };
     static_assert(sizeof(Smoke) <= sizeof(Entity));
 }
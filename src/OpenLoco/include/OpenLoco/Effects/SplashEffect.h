@@ -9,8 +9,6 @@ namespace OpenLoco
         uint16_t frame; // 0x28
 
         void tick();
-
-        static Splash* create(const World::Pos3& pos);
     };
     static_assert(sizeof(Splash) <= sizeof(Entity));
 }
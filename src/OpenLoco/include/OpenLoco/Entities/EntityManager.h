@@ -5,6 +5,8 @@
 #include <OpenLoco/Engine/World.hpp>
 #include <cstdio>
 #include <iterator>
+#include <optional>
+#include <span>
 
 namespace OpenLoco::Vehicles
 {
@@ -41,6 +43,10 @@ namespace OpenLoco::EntityManager
     EntityId firstId(EntityListType list);
 
     EntityId firstQuadrantId(const World::Pos2& loc);
+    uint16_t getQuadrantCount(const World::Pos2& loc);
+    bool isQuadrantOccupied(const World::Pos2& loc);
+    // First tile with entities at or after pos within the inclusive range, in the order of OccupiedTileList
+    std::optional<World::TilePos2> findOccupiedQuadrant(const World::TilePos2& pos, const World::TilePos2& bottomLeft, const World::TilePos2& topRight);
     void resetSpatialIndex();
     void updateSpatialIndex();
     void moveSpatialEntry(EntityBase& entity, const World::Pos3& loc);
@@ -51,6 +57,11 @@ namespace OpenLoco::EntityManager
     void freeEntity(EntityBase* const entity);
 
     uint16_t getListCount(const EntityListType list);
+    // The ids of every entity in a list in ascending order, which is also the order they are laid out in
+    // memory. This is not the order of the list itself so only use it where the visiting order does not
+    // matter, and not while entities are being moved between lists.
+    std::span<const EntityId> getListIds(const EntityListType list);
+    void resetListIds();
     void moveEntityToList(EntityBase* const entity, const EntityListType list);
     bool checkNumFreeEntities(const size_t numNewEntities);
     void zeroUnused();
@@ -131,6 +142,86 @@ namespace OpenLoco::EntityManager
         }
     };
 
+    // Tiles within the inclusive range that have any entities on them. Tiles are visited with y varying
+    // fastest, which is the layout of the spatial index, and runs of empty tiles are skipped in bulk.
+    class OccupiedTileList
+    {
+    private:
+        World::TilePos2 _bottomLeft;
+        World::TilePos2 _topRight;
+
+        class Iterator
+        {
+        private:
+            const OccupiedTileList* _list;
+            std::optional<World::TilePos2> _pos;
+
+        public:
+            Iterator(const OccupiedTileList* list, std::optional<World::TilePos2> pos)
+                : _list(list)
+                , _pos(pos)
+            {
+            }
+
+            Iterator& operator++()
+            {
+                auto next = *_pos;
+                if (next.y < _list->_topRight.y)
+                {
+                    next.y++;
+                }
+                else
+                {
+                    next.x++;
+                    next.y = _list->_bottomLeft.y;
+                }
+                _pos = next.x > _list->_topRight.x ? std::nullopt : findOccupiedQuadrant(next, _list->_bottomLeft, _list->_topRight);
+                return *this;
+            }
+
+            Iterator operator++(int)
+            {
+                Iterator retval = *this;
+                ++(*this);
+                return retval;
+            }
+
+            bool operator==(const Iterator& other) const
+            {
+                return _pos == other._pos;
+            }
+
+            const World::TilePos2& operator*() const
+            {
+                return *_pos;
+            }
+
+            // iterator traits
+            using difference_type = std::ptrdiff_t;
+            using value_type = const World::TilePos2;
+            using pointer = const World::TilePos2*;
+            using reference = const World::TilePos2&;
+            using iterator_category = std::forward_iterator_tag;
+        };
+
+    public:
+        // The range must already be clamped to the map
+        OccupiedTileList(const World::TilePos2& bottomLeft, const World::TilePos2& topRight)
+            : _bottomLeft(bottomLeft)
+            , _topRight(topRight)
+        {
+        }
+
+        Iterator begin() const
+        {
+            return Iterator(this, findOccupiedQuadrant(_bottomLeft, _bottomLeft, _topRight));
+        }
+        Iterator end() const
+        {
+            return Iterator(this, std::nullopt);
+        }
+    };
+
     class EntityTileList
     {
     private:
@@ -2,15 +2,24 @@
 
 #include "EntityManager.h"
 #include <OpenLoco/Engine/World.hpp>
+#include <cstdint>
 #include <vector>
 
 namespace OpenLoco
 {
     class EntityTweener
     {
-        std::vector<EntityBase*> _entities;
+        // Entities tracked for the current tick, in the order they were found
+        std::vector<EntityId> _entities;
+
+        // Indexed by EntityId, so that removing an entity is a single write
+        std::vector<uint8_t> _isTracked;
         std::vector<World::Pos3> _prePos;
         std::vector<World::Pos3> _postPos;
+        std::vector<World::Pos3> _renderPos;
+
+        EntityBase* getTracked(EntityId id) const;
+        void setRenderPosition(const EntityBase& entity, const World::Pos3& pos);
 
     public:
         static EntityTweener& get();
@@ -21,5 +30,9 @@ namespace OpenLoco
         void tween(float alpha);
         void restore();
         void reset();
+
+        // Where the entity is drawn. Between ticks this lies between its last two simulated positions,
+        // its actual position and the spatial index are left as the simulation left them.
+        World::Pos3 getRenderPosition(const EntityBase& entity) const;
     };
 }
@@ -84,8 +84,8 @@ namespace OpenLoco
         uint16_t startingLoanSize;                                               // 0x000400 (0x00526218)
         uint16_t maxLoanSize;                                                    // 0x000402 (0x0052621A)
         Core::Prng multiplayerPrng;                                              // 0x000404 (0x0052621C)
-        uint32_t multiplayerChecksumA;                                           // 0x00040C (0x00526224) unused
-        uint32_t multiplayerChecksumB;                                           // 0x000410 (0x00526228) unused
+        uint32_t multiplayerChecksumA;                                           // 0x00040C (0x00526224) running checksum of the current interval
+        uint32_t multiplayerChecksumB;                                           // 0x000410 (0x00526228) checksum of the last completed interval
         VehicleType defaultBuildVehicleType;                                     // 0x000414 (0x0052622C)
         uint8_t numberOfIndustries;                                              // 0x000415 (0x0052622D)
         uint16_t vehiclePreviewRotationFrame;                                    // 0x000416 (0x0052622E)
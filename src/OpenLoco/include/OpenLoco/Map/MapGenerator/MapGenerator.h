@@ -2,6 +2,7 @@
 
 #include <OpenLoco/Core/EnumFlags.hpp>
 #include <OpenLoco/Core/FileSystem.hpp>
+#include <OpenLoco/Core/Prng.h>
 #include <array>
 #include <cstdint>
 #include <optional>
@@ -18,6 +19,8 @@ namespace OpenLoco::World
 
 namespace OpenLoco::World::MapGenerator
 {
+    class HeightMap;
+
     enum class TopographyFlags : uint8_t
     {
         none = 0U,
@@ -41,8 +44,14 @@ namespace OpenLoco::World::MapGenerator
     };
 
     void generate(const Scenario::Options& options);
+    // Shapes the surface tiles to the height map and floods them up to the sea level
+    void generateSurface(HeightMap& heightMap);
     std::optional<uint8_t> getRandomTerrainVariation(const SurfaceElement& surface);
+    std::optional<uint8_t> getRandomTerrainVariation(const SurfaceElement& surface, Core::Prng& rng);
 
     void setPngHeightmapPath(const fs::path& path);
     fs::path getPngHeightmapPath();
+
+    // The per-tile passes run in strips on all cores unless disabled, the map is the same either way
+    void setParallelPasses(bool enabled);
 }
@@ -36,15 +36,16 @@ namespace OpenLoco::World::MapGenerator
 
         static void smooth(int32_t iterations, HeightMapRange heightMap);
 
-        static float noiseFractal(uint8_t* perm, int32_t x, int32_t y, float frequency, int32_t octaves, float lacunarity, float persistence);
+        static void updateProgress(uint8_t value);
 
-        static float generateNoise(uint8_t* perm, float x, float y);
+        // Number of cells of a row evaluated together by generateNoise
+        static constexpr int32_t kNoiseLanes = 8;
 
-        void noise(uint8_t* perm, size_t len);
+        static void noiseFractal(const uint8_t* perm, int32_t x, int32_t y, float frequency, int32_t octaves, float lacunarity, float persistence, float* out);
 
-        static float grad(int32_t hash, float x, float y);
+        static void generateNoise(const uint8_t* perm, const float* x, float y, float* out);
 
-        static int32_t fastFloor(float x);
+        void noise(uint8_t* perm, size_t len);
 
         uint32_t randomNext();
 
@@ -6,10 +6,13 @@
 #include "TileElementEntry.h"
 #include <OpenLoco/Core/EnumFlags.hpp>
 #include <OpenLoco/Core/Store.hpp>
+#include <algorithm>
 #include <array>
 #include <cstdint>
 #include <set>
 #include <span>
+#include <type_traits>
+#include <vector>
 
 namespace OpenLoco::World
 {
@@ -85,8 +88,16 @@ namespace OpenLoco::World::TileManager
     void updateTilePointers();
     // Only disables first call to defrag
     void disablePeriodicDefrag();
-    // Fully defragment the tile element array
+    // Fully defragment the tile element array, elements themselves stay where they are
     void reorganise();
+    // Releases the unused slots of the element stores. This moves elements so must not be called
+    // while anything holds element pointers, it is only done when saving.
+    void compactElementStores();
+    // Starts a full defragment spread over the following calls to reorganiseIncremental
+    void beginReorganiseIncremental();
+    // Defragments the next slice of tiles, starting a new pass once free elements run low so that the
+    // game rarely has to stall on a full reorganise. Returns true while a pass is still in progress.
+    bool reorganiseIncremental();
     // Defragments singular tile (chosen tile updates each call)
     void defragmentTilePeriodic();
     bool checkFreeElementsAndReorganise();
@@ -95,6 +106,13 @@ namespace OpenLoco::World::TileManager
     template<typename T>
     Store<T>& getStore();
 
+    constexpr TilePos2 kNoElementTile{ -1, -1 };
+
+    // Records the tile an element is placed on, kNoElementTile for elements not on the map
+    void setElementTile(const TileElementEntry& entry, TilePos2 pos);
+    // Tile of each store slot of the given element type, indexed by store index
+    std::span<const TilePos2> getElementTiles(ElementType type);
+
     template<typename T>
     TileElementEntry allocElement(const T& element)
     {
@@ -105,11 +123,91 @@ namespace OpenLoco::World::TileManager
         TileElementEntry entry{};
         entry.setType(T::kElementType);
         entry.setIndex(idx);
+        setElementTile(entry, kNoElementTile);
         return entry;
     }
 
     void destroyElement(const TileElementEntry& entry);
 
+    // Calls func(element, tilePos) for every element of type T placed on the map. This only visits the
+    // store so is far cheaper than walking every tile, but the order is that of the store slots which
+    // differs between a running game and a freshly loaded one. Use getTilesWithElement for anything
+    // that modifies the map or depends on the order.
+    template<typename T, typename TFunc>
+    void forEachElement(TFunc&& func)
+    {
+        auto& store = getStore<T>();
+        const auto tiles = getElementTiles(T::kElementType);
+        for (auto it = store.begin(); it != store.end(); ++it)
+        {
+            if (it.index() >= tiles.size() || tiles[it.index()] == kNoElementTile)
+            {
+                continue;
+            }
+            func(*it, tiles[it.index()]);
+        }
+    }
+
+    template<typename T, typename TFunc>
+    void forEachElementOwnedBy(CompanyId owner, TFunc&& func)
+    {
+        forEachElement<T>([owner, &func](T& el, const TilePos2 pos) {
+            if (el.owner() == owner)
+            {
+                func(el, pos);
+            }
+        });
+    }
+
+    // Industry tiles as well as the surfaces claimed by the industry (when T is SurfaceElement)
+    template<typename T, typename TFunc>
+    void forEachElementOfIndustry(IndustryId industryId, TFunc&& func)
+    {
+        forEachElement<T>([industryId, &func](T& el, const TilePos2 pos) {
+            if constexpr (std::is_same_v<T, SurfaceElement>)
+            {
+                if (!el.isIndustrial())
+                {
+                    return;
+                }
+            }
+            if (el.industryId() == industryId)
+            {
+                func(el, pos);
+            }
+        });
+    }
+
+    // The order the tiles are stored and looped over in, y then x
+    constexpr bool isBeforeInMapOrder(const TilePos2 a, const TilePos2 b)
+    {
+        return a.y != b.y ? a.y < b.y : a.x < b.x;
+    }
+
+    // Tiles with at least one element of type T matching pred, sorted in map order
+    template<typename T, typename TPred>
+    std::vector<TilePos2> getTilesWithElement(TPred&& pred)
+    {
+        std::vector<TilePos2> result;
+        forEachElement<T>([&result, &pred](const T& el, const TilePos2 pos) {
+            if (pred(el))
+            {
+                result.push_back(pos);
+            }
+        });
+
+        std::ranges::sort(result, isBeforeInMapOrder);
+        const auto [first, last] = std::ranges::unique(result);
+        result.erase(first, last);
+        return result;
+    }
+
+    template<typename T>
+    std::vector<TilePos2> getTilesWithElement()
+    {
+        return getTilesWithElement<T>([](const T&) { return true; });
+    }
+
     CompanyId getTileOwner(const World::TileElementEntry& el);
     void mapInvalidateTileFull(World::Pos2 pos);
     void resetSurfaceClearance();
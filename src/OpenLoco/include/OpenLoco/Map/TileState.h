@@ -19,6 +19,7 @@
 namespace OpenLoco::World
 {
     constexpr auto kTileStateNumTiles = kMapPitch * kMapColumns;
+    constexpr auto kTileStateNumElementTypes = 9;
 
     struct TileState
     {
@@ -35,5 +36,8 @@ namespace OpenLoco::World
         std::array<TileElementEntry*, kTileStateNumTiles> tiles{};
         std::vector<TileElementEntry> entries;
         std::ptrdiff_t entriesEnd = 0;
+
+        // Tile each store slot is placed on indexed by element type, rebuilt on load so never saved.
+        std::array<std::vector<TilePos2>, kTileStateNumElementTypes> elementTiles;
     };
 }
@@ -19,7 +19,70 @@ namespace OpenLoco::World::TrackData
     };
     static_assert(sizeof(MoveInfo) == 0x8);
 
-    std::span<const MoveInfo> getTrackSubPositon(const uint16_t trackAndDirection);
-    std::span<const MoveInfo> getRoadSubPositon(const uint16_t trackAndDirection);
-    std::span<const MoveInfo> getRoadPlacementSubPositon(const uint16_t trackAndDirection);
+    // A MoveInfo packed into 4 bytes, every table entry is within a tile and a half of the piece origin.
+    // Bits 0-7 x + 64, 8-15 y + 64, 16-21 z + 32, 22-26 yaw / 2 (always even), 27-30 pitch
+    struct PackedMoveInfo
+    {
+        uint32_t data{};
+
+        constexpr PackedMoveInfo() = default;
+        constexpr PackedMoveInfo(uint32_t packed)
+            : data(packed)
+        {
+        }
+
+        static constexpr PackedMoveInfo pack(const MoveInfo& moveInfo)
+        {
+            return PackedMoveInfo(
+                static_cast<uint32_t>(moveInfo.loc.x + 64)
+                | (static_cast<uint32_t>(moveInfo.loc.y + 64) << 8)
+                | (static_cast<uint32_t>(moveInfo.loc.z + 32) << 16)
+                | (static_cast<uint32_t>(moveInfo.yaw / 2) << 22)
+                | (static_cast<uint32_t>(moveInfo.pitch) << 27));
+        }
+
+        constexpr MoveInfo unpack() const
+        {
+            MoveInfo moveInfo{};
+            moveInfo.loc.x = static_cast<coord_t>(data & 0xFF) - 64;
+            moveInfo.loc.y = static_cast<coord_t>((data >> 8) & 0xFF) - 64;
+            moveInfo.loc.z = static_cast<coord_t>((data >> 16) & 0x3F) - 32;
+            moveInfo.yaw = static_cast<uint8_t>(((data >> 22) & 0x1F) * 2);
+            moveInfo.pitch = static_cast<Pitch>((data >> 27) & 0xF);
+            return moveInfo;
+        }
+    };
+    static_assert(sizeof(PackedMoveInfo) == 0x4);
+
+    // Read only view of a movement table, entries are unpacked on access
+    class MoveInfoSpan
+    {
+    private:
+        std::span<const PackedMoveInfo> _data;
+
+    public:
+        constexpr explicit MoveInfoSpan(std::span<const PackedMoveInfo> data)
+            : _data(data)
+        {
+        }
+
+        constexpr size_t size() const
+        {
+            return _data.size();
+        }
+
+        constexpr bool empty() const
+        {
+            return _data.empty();
+        }
+
+        constexpr MoveInfo operator[](size_t index) const
+        {
+            return _data[index].unpack();
+        }
+    };
+
+    MoveInfoSpan getTrackSubPositon(const uint16_t trackAndDirection);
+    MoveInfoSpan getRoadSubPositon(const uint16_t trackAndDirection);
+    MoveInfoSpan getRoadPlacementSubPositon(const uint16_t trackAndDirection);
 }
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <OpenLoco/Engine/World.hpp>
+#include <cstdint>
+
+// Labels every tile with the connected body of water it belongs to so that ships can tell
+// straight away whether a target can be reached at all. Two tiles are connected when they are
+// neighbours and have the same water level, obstacles on the water are not considered so a
+// region is always a superset of what a ship can actually travel through. This is derived from
+// the tile elements, is not part of the game state and is rebuilt lazily.
+namespace OpenLoco::World::WaterRegions
+{
+    using RegionId = uint32_t;
+    constexpr RegionId kNullRegion = 0;
+
+    // Discards all regions, call when the tile elements are replaced
+    void reset();
+
+    // Call whenever the water level of a tile changes
+    void invalidateTile(const TilePos2& pos);
+
+    // kNullRegion for tiles without water
+    RegionId getRegion(const TilePos2& pos);
+}
@@ -2,6 +2,7 @@
 
 #include "Types.hpp"
 #include <cstdint>
+#include <functional>
 #include <string_view>
 
 namespace OpenLoco::GameCommands
@@ -17,7 +18,7 @@ namespace OpenLoco::Network
 
     constexpr port_t kDefaultPort = 11754;
     constexpr uint16_t kMaxPacketSize = 4096;
-    constexpr uint16_t kNetworkVersion = 1;
+    constexpr uint16_t kNetworkVersion = 4;
 
     void openServer();
     bool joinServer(std::string_view host);
@@ -32,6 +33,11 @@ namespace OpenLoco::Network
     bool shouldProcessTick(uint32_t tick);
     void processGameCommands(uint32_t tick);
 
+    /**
+     * Updates the desync checksum at the end of a tick, the server broadcasts it and clients verify it.
+     */
+    void updateChecksum(uint32_t tick);
+
     /**
      * Whether the game state is networked.
      * This will return false if the client is still receiving the map from the server.
@@ -42,4 +48,11 @@ namespace OpenLoco::Network
      * Gets the current tick the server is on.
      */
     uint32_t getServerTick();
+
+    /**
+     * Milliseconds used for connection timeouts, resends and pings. Comes from Platform::getTime
+     * unless replaced, tests replace it so that they do not depend on how fast they run.
+     */
+    uint32_t getTime();
+    void setTimeSource(std::function<uint32_t()> timeSource);
 }
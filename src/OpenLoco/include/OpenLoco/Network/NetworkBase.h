@@ -3,6 +3,7 @@
 #include "Network.h"
 #include "Packet.h"
 #include "Socket.h"
+#include <atomic>
 #include <cstdint>
 #include <memory>
 #include <thread>
@@ -13,9 +14,12 @@ namespace OpenLoco::Network
     {
     private:
         std::thread _receivePacketThread;
-        bool _endReceivePacketLoop{};
+        std::unique_ptr<ISocketPoller> _poller;
+        std::atomic<bool> _endReceivePacketLoop{};
         bool _isClosed{};
+        bool _receiveOnUpdate{};
 
+        bool receivePackets();
         void receivePacketLoop();
 
     protected:
@@ -24,6 +28,9 @@ namespace OpenLoco::Network
         void beginReceivePacketLoop();
         void endReceivePacketLoop();
 
+        virtual std::unique_ptr<IUdpSocket> createSocket();
+        virtual std::unique_ptr<INetworkEndpoint> resolve(Protocol protocol, const std::string& address, port_t port);
+
         virtual void onClose();
         virtual void onUpdate();
         virtual void onReceivePacket(IUdpSocket& socket, std::unique_ptr<INetworkEndpoint> endpoint, const Packet& packet);
@@ -36,6 +43,12 @@ namespace OpenLoco::Network
         void close();
         void update();
 
+        /**
+         * Receive packets at the start of each update instead of on a background thread, so that
+         * everything happens in a fixed order. Must be set before listening or connecting.
+         */
+        void setReceiveOnUpdate(bool value);
+
         virtual void sendChatMessage(std::string_view message) = 0;
     };
 }
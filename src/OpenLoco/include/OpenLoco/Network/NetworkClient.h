@@ -2,9 +2,14 @@
 
 #include "Network.h"
 #include "NetworkBase.h"
+#include "NetworkConnection.h"
 #include "Socket.h"
+#include "StateTransfer.h"
+#include <OpenLoco/Core/FileSystem.hpp>
 #include <cstdint>
 #include <list>
+#include <map>
+#include <optional>
 #include <span>
 #include <vector>
 
@@ -29,36 +34,35 @@ namespace OpenLoco::Network
         std::unique_ptr<NetworkConnection> _serverConnection;
         NetworkClientStatus _status{};
         uint32_t _timeout{};
-        uint32_t _localGameCommandIndex;
-        uint32_t _serverGameCommandIndex;
-        uint32_t _localTick;
-        uint32_t _serverTick;
+        uint32_t _localGameCommandIndex{};
+        uint32_t _serverGameCommandIndex{};
+        uint32_t _localTick{};
+        uint32_t _serverTick{};
+        // From the latest ping, the server had sent every command for this tick and none after this index
+        uint32_t _pingTick{};
+        uint32_t _pingGameCommandIndex{};
         std::list<GameCommandPacket> _receivedGameCommands;
 
-        struct ReceivedChunk
-        {
-            uint32_t offset{};
-            std::vector<uint8_t> data;
-        };
+        // Checksums by tick, kept until the matching checksum from the other side arrives
+        std::map<uint32_t, uint32_t> _localChecksums;
+        std::map<uint32_t, uint32_t> _serverChecksums;
+        std::optional<uint32_t> _desyncTick;
 
-        uint32_t _requestStateCookie{};
-        uint32_t _requestStateTotalSize{};
-        uint16_t _requestStateNumChunks{};
-        std::vector<ReceivedChunk> _requestStateChunksReceived;
-        uint32_t _requestStateReceivedBytes{};
-        uint32_t _requestStateReceivedChunks{};
+        StatePayloadReceiver _stateReceiver;
+
+        // The last state received from the server, used as the base for a delta when reconnecting
+        std::unique_ptr<StateSnapshot> _receivedState;
 
         void onCancel();
         void processReceivedPackets();
         bool hasTimedOut() const;
         void onReceivePacketFromServer(const Packet& packet);
+        void processReceivedState();
         void processFullState(std::span<uint8_t const> data);
         void updateLocalTick();
-
-        void initStatus(std::string_view text);
-        void setStatus(std::string_view text);
-        void clearStatus();
-        void endStatus(std::string_view text);
+        void compareChecksums(uint32_t tick);
+        void onDesync(uint32_t tick);
+        static fs::path getDesyncSavePath(uint32_t desyncTick, uint32_t stateTick, std::string_view side);
 
         void sendConnectPacket();
         void sendRequestStatePacket();
@@ -69,23 +73,36 @@ namespace OpenLoco::Network
         void receiveChatMessagePacket(const ReceiveChatMessage& packet);
         void receivePingPacket(const PingPacket& packet);
         void receiveGameCommandPacket(const GameCommandPacket& packet);
+        void receiveChecksumPacket(const ChecksumPacket& packet);
 
     protected:
         void onClose() override;
         void onUpdate() override;
         void onReceivePacket(IUdpSocket& socket, std::unique_ptr<INetworkEndpoint> endpoint, const Packet& packet) override;
 
+        // Access to the game and the UI, overridden by tests that run clients without them
+        virtual void loadState(std::span<uint8_t const> data);
+        virtual void runGameCommand(const GameCommandPacket& packet);
+        virtual void initStatus(std::string_view text);
+        virtual void setStatus(std::string_view text);
+        virtual void clearStatus();
+        virtual void endStatus(std::string_view text);
+
     public:
         ~NetworkClient() override;
 
         NetworkClientStatus getStatus() const;
         uint32_t getLocalTick() const;
+        NetworkConnectionStats getStats() const;
 
         void connect(std::string_view host, port_t port);
+        void setReceivedState(std::unique_ptr<StateSnapshot> state);
+        std::unique_ptr<StateSnapshot> takeReceivedState();
         void sendChatMessage(std::string_view message) override;
         void sendGameCommand(CompanyId company, const OpenLoco::GameCommands::registers& regs, const uint8_t flags);
 
         bool shouldProcessTick(uint32_t tick) const;
         void runGameCommandsForTick(uint32_t tick);
+        void verifyChecksum(uint32_t tick, uint32_t checksum);
     };
 }
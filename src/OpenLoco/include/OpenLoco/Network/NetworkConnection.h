@@ -3,36 +3,66 @@
 #include "Network.h"
 #include "Packet.h"
 #include "Socket.h"
+#include <atomic>
 #include <cassert>
 #include <cstdint>
-#include <deque>
+#include <functional>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <optional>
 #include <queue>
+#include <set>
 #include <thread>
 
 namespace OpenLoco::Network
 {
+    struct NetworkConnectionStats
+    {
+        uint64_t packetsSent{};
+        uint64_t packetsResent{};
+        uint64_t packetsReceived{};
+        uint64_t bytesSent{};
+        uint64_t bytesReceived{};
+    };
+
     class NetworkConnection
     {
     private:
-        struct SentPacket
+        struct ResendTimer
         {
-            uint32_t timestamp;
-            Packet packet;
+            uint32_t time;
+            sequence_t sequence;
+
+            bool operator>(const ResendTimer& other) const
+            {
+                // Wrap safe comparison of millisecond timestamps
+                return static_cast<int32_t>(time - other.time) > 0;
+            }
         };
 
         IUdpSocket* _socket;
         std::unique_ptr<INetworkEndpoint> _endpoint;
         std::mutex _sentPacketsSync;
         std::mutex _receivedPacketsSync;
-        std::vector<SentPacket> _sentPackets;
+        // Unacknowledged packets by sequence, and when each should next be resent. Timers for packets that
+        // have since been acknowledged are left in the queue and skipped once they expire.
+        std::map<sequence_t, Packet> _sentPackets;
+        std::priority_queue<ResendTimer, std::vector<ResendTimer>, std::greater<ResendTimer>> _resendTimers;
         std::queue<Packet> _receivedPackets;
-        std::deque<sequence_t> _receivedSequences;
-        uint16_t _sendSequence{};
+        // Every sequence below this has been received, along with those in the set that arrived out of order
+        sequence_t _receivedSequenceFloor{};
+        std::set<sequence_t> _receivedSequencesAboveFloor;
+        sequence_t _sendSequence{};
         uint32_t _timeOfLastReceivedPacket{};
 
+        // Updated from both the receive thread and the game thread
+        std::atomic<uint64_t> _packetsSent{};
+        std::atomic<uint64_t> _packetsResent{};
+        std::atomic<uint64_t> _packetsReceived{};
+        std::atomic<uint64_t> _bytesSent{};
+        std::atomic<uint64_t> _bytesReceived{};
+
         static uint32_t getTime();
         bool checkOrRecordReceivedSequence(sequence_t sequence);
         void receiveAcknowledgePacket(sequence_t sequence);
@@ -46,6 +76,7 @@ namespace OpenLoco::Network
 
         const INetworkEndpoint& getEndpoint() const;
         bool hasTimedOut() const;
+        NetworkConnectionStats getStats() const;
         void update();
         void receivePacket(const Packet& packet);
         void sendPacket(const Packet& packet);
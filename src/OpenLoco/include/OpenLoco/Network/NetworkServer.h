@@ -4,7 +4,11 @@
 #include "NetworkBase.h"
 #include "NetworkConnection.h"
 #include "Socket.h"
+#include "StateTransfer.h"
+#include <OpenLoco/Core/MemoryStream.h>
+#include <deque>
 #include <mutex>
+#include <unordered_map>
 
 namespace OpenLoco::Network
 {
@@ -35,12 +39,21 @@ namespace OpenLoco::Network
         client_id_t _nextClientId = 1;
         uint32_t _lastPing{};
         uint32_t _gameCommandIndex{};
+        uint32_t _lastRunGameCommandIndex{};
         std::queue<GameCommandPacket> _gameCommands;
 
+        // Recently sent snapshots, newest last, kept so reconnecting clients can be sent a delta
+        std::deque<std::unique_ptr<StateSnapshot>> _stateSnapshots;
+        std::unordered_map<snapshot_hash_t, std::vector<uint8_t>> _statePayloads;
+        uint32_t _stateSnapshotTick{};
+        uint32_t _stateSnapshotGameCommandIndex{};
+
         Client* findClient(const INetworkEndpoint& endpoint);
         void createNewClient(std::unique_ptr<NetworkConnection> conn, const ConnectPacket& packet);
         void onReceivePacketFromClient(Client& client, const Packet& packet);
         void onReceiveStateRequestPacket(Client& client, const RequestStatePacket& packet);
+        StateSnapshot& getCurrentStateSnapshot();
+        StateSnapshot* findStateSnapshot(snapshot_hash_t hash);
         void onReceiveSendChatMessagePacket(Client& client, const SendChatMessage& packet);
         void onReceiveGameCommandPacket(Client& client, const GameCommandPacket& packet);
         void removedTimedOutClients();
@@ -64,11 +77,18 @@ namespace OpenLoco::Network
         void onReceivePacket(IUdpSocket& socket, std::unique_ptr<INetworkEndpoint> endpoint, const Packet& packet) override;
         void onUpdate() override;
 
+        // Access to the game, overridden by tests that run the server without one
+        virtual void exportState(MemoryStream& stream);
+        virtual void runGameCommand(const GameCommandPacket& packet);
+
     public:
         ~NetworkServer() override;
 
         void listen(const std::string& bind, port_t port);
+        port_t getPort() const;
+        NetworkConnectionStats getStats() const;
         void sendChatMessage(std::string_view message) override;
+        void sendChecksum(uint32_t tick, uint32_t checksum);
         void sendGameCommand(uint32_t index, uint32_t tick, CompanyId company, const OpenLoco::GameCommands::registers& regs, const uint8_t flags);
 
         void queueGameCommand(CompanyId company, const OpenLoco::GameCommands::registers& regs, const uint8_t flags);
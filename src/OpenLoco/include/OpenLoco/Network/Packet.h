@@ -8,7 +8,8 @@
 
 namespace OpenLoco::Network
 {
-    using sequence_t = uint16_t;
+    // Wide enough that a connection never runs out, so a sequence identifies a packet for the whole connection
+    using sequence_t = uint32_t;
 
 #pragma pack(push, 1)
     enum class PacketKind : uint16_t
@@ -24,6 +25,7 @@ namespace OpenLoco::Network
         sendChatMessage,
         receiveChatMessage,
         gameCommand,
+        checksum,
     };
 
     struct PacketHeader
@@ -98,6 +100,7 @@ namespace OpenLoco::Network
         size_t size() const { return sizeof(RequestStatePacket); }
 
         uint32_t cookie{};
+        uint64_t baseHash{}; // Hash of a snapshot previously received from this server, 0 for none
     };
 
     struct RequestStateResponse
@@ -174,5 +177,14 @@ namespace OpenLoco::Network
         OpenLoco::GameCommands::registers regs;
         uint8_t flags{};
     };
+
+    struct ChecksumPacket
+    {
+        static constexpr PacketKind kind = PacketKind::checksum;
+        size_t size() const { return sizeof(ChecksumPacket); }
+
+        uint32_t tick{};
+        uint32_t checksum{};
+    };
 #pragma pack(pop)
 }
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <cstdint>
 #include <memory>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -47,6 +49,26 @@ namespace OpenLoco::Network
         virtual bool equals(const INetworkEndpoint& other) const = 0;
     };
 
+    struct IUdpSocket;
+
+    /**
+     * Waits for incoming data on a set of sockets so that a receive loop can block rather than poll.
+     */
+    struct ISocketPoller
+    {
+        virtual ~ISocketPoller() = default;
+
+        /**
+         * Blocks until one of the sockets has data to receive, wakeup is called or the timeout elapses.
+         */
+        virtual void wait(std::span<const std::unique_ptr<IUdpSocket>> sockets, uint32_t timeoutMs) = 0;
+
+        /**
+         * Makes the current or next call to wait return immediately, safe to call from any thread.
+         */
+        virtual void wakeup() = 0;
+    };
+
     /**
      * Represents a UDP socket / listener.
      */
@@ -61,6 +83,11 @@ namespace OpenLoco::Network
         virtual Protocol getProtocol() const = 0;
         virtual std::string getIpAddress() const = 0;
 
+        /**
+         * The local port, also when it was picked by the system when listening on port 0. 0 if not bound.
+         */
+        virtual uint16_t getPort() const = 0;
+
         virtual void listen(Protocol procotol, uint16_t port) = 0;
         virtual void listen(Protocol procotol, const std::string& address, uint16_t port) = 0;
 
@@ -71,11 +98,29 @@ namespace OpenLoco::Network
             = 0;
 
         virtual void close() = 0;
+
+        /**
+         * Creates a poller that can wait on this kind of socket.
+         */
+        virtual std::unique_ptr<ISocketPoller> createPoller() const = 0;
     };
 
     namespace Socket
     {
         [[nodiscard]] std::unique_ptr<IUdpSocket> createUdp();
         std::unique_ptr<INetworkEndpoint> resolve(Protocol protocol, const std::string& address, uint16_t port);
+
+        /**
+         * Creates a socket that only exchanges packets with other loopback sockets in the same process.
+         * Used to exercise the network code without going through the operating system.
+         */
+        [[nodiscard]] std::unique_ptr<IUdpSocket> createLoopbackUdp();
+        std::unique_ptr<INetworkEndpoint> resolveLoopback(uint16_t port);
+
+        /**
+         * Makes loopback sockets drop the given percentage of datagrams, chosen by a PRNG with the given
+         * seed, so that packet loss can be reproduced.
+         */
+        void setLoopbackPacketLoss(uint32_t percent, uint32_t seed = 0);
     }
 }
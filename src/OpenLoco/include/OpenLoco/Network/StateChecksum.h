@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstdint>
+
+namespace OpenLoco::Network::StateChecksum
+{
+    // Number of ticks folded into one checksum, the server sends the checksum of each completed interval
+    constexpr uint32_t kInterval = 32;
+
+    /**
+     * Folds part of the game state into the running checksum for the current interval. The rng and all
+     * entities are included every tick, companies, stations and tile rows are spread over the interval
+     * so the cost per tick stays small on large maps. Returns true if the tick completed an interval.
+     */
+    bool update(uint32_t tick);
+
+    /**
+     * Gets the checksum of the last completed interval.
+     */
+    uint32_t getLastChecksum();
+
+    /**
+     * Starts a fresh interval, called when a server is opened so the first checksum is not seeded
+     * by whatever was left in the loaded save.
+     */
+    void reset();
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+#include "Packet.h"
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace OpenLoco::Network
+{
+    class NetworkConnection;
+
+    using snapshot_hash_t = uint64_t;
+
+    /**
+     * A copy of the serialised game state that is sent to joining clients. The data is split into
+     * fixed size blocks which are hashed and compressed individually, so a client that already holds
+     * an older snapshot only has to be sent the blocks that have changed since.
+     */
+    class StateSnapshot
+    {
+    public:
+        static constexpr uint32_t kBlockSize = 64 * 1024;
+
+    private:
+        struct Block
+        {
+            snapshot_hash_t hash{};
+            std::vector<uint8_t> compressed;
+            bool isCompressed{};
+        };
+
+        std::vector<uint8_t> _data;
+        std::vector<Block> _blocks;
+        snapshot_hash_t _hash{};
+
+        std::span<const uint8_t> getBlockData(size_t index) const;
+        void compressBlocks(std::span<const uint32_t> indices);
+
+    public:
+        explicit StateSnapshot(std::vector<uint8_t> data);
+
+        snapshot_hash_t getHash() const;
+        std::span<const uint8_t> getData() const;
+
+        /**
+         * Encodes the snapshot into a payload for sending. When a base snapshot is given only the
+         * blocks that differ from it are included. Compressed blocks are cached so encoding the same
+         * snapshot for several clients only compresses each block once.
+         */
+        std::vector<uint8_t> encode(const StateSnapshot* base);
+
+        /**
+         * Decodes a payload produced by encode. The base must be the snapshot the payload was encoded
+         * against, returns std::nullopt if it is not, if the payload is corrupt or if it claims a state
+         * larger than the server can produce.
+         */
+        static std::optional<std::vector<uint8_t>> decode(std::span<const uint8_t> payload, const StateSnapshot* base);
+    };
+
+    /**
+     * Sends a state payload as a RequestStateResponse followed by as many chunks as required.
+     */
+    void sendStatePayload(NetworkConnection& connection, uint32_t cookie, std::span<const uint8_t> payload);
+
+    /**
+     * Reassembles a state payload from the chunks sent by sendStatePayload.
+     */
+    class StatePayloadReceiver
+    {
+    private:
+        struct ReceivedChunk
+        {
+            uint32_t offset{};
+            std::vector<uint8_t> data;
+        };
+
+        uint32_t _cookie{};
+        uint32_t _totalSize{};
+        uint16_t _numChunks{};
+        std::vector<ReceivedChunk> _chunks;
+        uint32_t _receivedBytes{};
+        uint32_t _receivedChunks{};
+
+    public:
+        void reset(uint32_t cookie);
+
+        uint32_t getCookie() const;
+        uint32_t getTotalSize() const;
+        uint32_t getReceivedBytes() const;
+        bool isComplete() const;
+
+        void receive(const RequestStateResponse& response);
+
+        /**
+         * Returns true if the chunk belongs to the current transfer and had not been received before.
+         */
+        bool receive(const RequestStateResponseChunk& responseChunk);
+
+        std::vector<uint8_t> takePayload();
+    };
+}
@@ -2,9 +2,11 @@
 
 #include "Engine/Limits.h"
 #include "Object.h"
+#include <OpenLoco/Core/FileSystem.hpp>
 #include <OpenLoco/Engine/Ui/Point.hpp>
 #include <optional>
 #include <span>
+#include <string>
 #include <type_traits>
 #include <vector>
 
@@ -153,11 +155,22 @@ namespace OpenLoco::ObjectManager
         DependentObjects dependentObjects;
     };
 
+    struct IndexLoadResult
+    {
+        std::string name;
+        TempLoadMetaData metaData;
+    };
+
     void freeTemporaryObject();
     std::optional<TempLoadMetaData> loadTemporaryObject(const ObjectHeader& header);
     Object* getTemporaryObject();
     bool isTemporaryObjectLoad();
 
+    // Loads the object file into a private copy just long enough to gather its index metadata.
+    // Leaves the G1 and string tables untouched so may be called from several threads at once.
+    std::optional<IndexLoadResult> loadObjectForIndex(const ObjectHeader& header, const fs::path& filePath);
+    bool isIndexObjectLoad();
+
     std::optional<LoadedObjectHandle> findObjectHandle(const ObjectHeader& header);
     // Calls findObjectHandle and if can't find performs a secondary check with slightly looser
     // definitions of what a matching custom header is (no checksum, partial flags)
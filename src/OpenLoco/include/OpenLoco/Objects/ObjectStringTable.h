@@ -1,6 +1,7 @@
 #pragma once
 #include "Types.hpp"
 #include <span>
+#include <string>
 
 namespace OpenLoco
 {
@@ -14,4 +15,6 @@ namespace OpenLoco::ObjectManager
         uint32_t tableLength;
     };
     StringTableResult loadStringTable(std::span<const std::byte> data, const LoadedObjectHandle& handle, uint8_t index);
+    // Returns and clears the name string loaded by the last index load on this thread
+    std::string takeIndexObjectName();
 }
@@ -20,6 +20,7 @@ namespace OpenLoco
     void* hInstance();
     void resetSubsystems();
     void simulateGame(const fs::path& path, int32_t ticks);
+    bool screenshotGame(const fs::path& path, const fs::path& outputPath, int8_t zoomLevel);
 
     void initialise();
     void update();
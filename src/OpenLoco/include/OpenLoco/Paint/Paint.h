@@ -288,7 +288,8 @@ namespace OpenLoco::Paint
         void setItemType(const Ui::ViewportInteraction::InteractionItem type) { _itemType = type; }
         Ui::ViewportInteraction::InteractionItem getItemType() const { return _itemType; }
         void setTrackModId(const uint8_t mod) { _trackModId = mod; }
-        void setEntityPosition(const World::Pos2& pos);
+        // The height offset is added to the heights given to the plot list functions, for entities drawn between ticks
+        void setEntityPosition(const World::Pos2& pos, coord_t heightOffset = 0);
         void setMapPosition(const World::Pos2& pos);
         void setUnkPosition(const World::Pos2& pos);
         void setVpPosition(const Ui::Point& pos);
@@ -460,6 +461,7 @@ namespace OpenLoco::Paint
         coord_t _unkPositionY{};
         int16_t _vpPositionY{};
         int16_t _unkVpPositionY{};
+        coord_t _spriteHeightOffset{};
         bool _didPassSurface{};
         World::Pos3 _boundingBoxOffset{};
         int16_t _foregroundCullingHeight{};
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Effects/Effect.h"
+#include "Effects/ParticleManager.h"
 #include "Paint.h"
 
 namespace OpenLoco::Paint
@@ -14,4 +15,6 @@ namespace OpenLoco::Paint
      * @param base @<esi>
      */
     void paintEffectEntity(PaintSession& session, EffectEntity* base);
+
+    void paintParticle(PaintSession& session, const ParticleManager::Particle& particle);
 }
@@ -102,6 +102,7 @@ namespace OpenLoco::S5
         packCustomObjects = 1U << 0,
         scenario = 1U << 1,
         landscape = 1U << 2,
+        uncompressed = 1U << 27, // Skip the run length encoding, used when the data is compressed further by the caller
         isAutosave = 1U << 28,
         noWindowClose = 1U << 29,
         raw = 1U << 30,  // Save raw data including pointers with no clean up
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <OpenLoco/ZoomLevel.hpp>
+#include <OpenLoco/Core/FileSystem.hpp>
 #include <cstdint>
 
 namespace OpenLoco::Ui
@@ -12,4 +14,10 @@ namespace OpenLoco::Ui
 
     void triggerScreenshotCountdown(int8_t numTicks, ScreenshotType type);
     void handleScreenshotCountdown();
+
+    /**
+     * Renders the whole map at the given zoom level to a PNG file. The image is painted and written in
+     * bands of rows, so memory use does not grow with the size of the image.
+     */
+    void saveGiantScreenshot(const fs::path& path, ZoomLevel zoomLevel);
 }
@@ -24,6 +24,8 @@ namespace OpenLoco::Vehicles::RoutingManager
     void resetRoutings(const RoutingHandle handle);
     bool isEmptyRoutingSlotAvailable();
     void resetRoutingTable();
+    // Rebuilds the free slot index from the routing table, call after the table is loaded
+    void rebuildFreeSlots();
 
     struct RingView
     {
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <OpenLoco/Engine/World.hpp>
+#include <array>
+#include <compare>
+#include <cstdint>
+
+namespace OpenLoco::Vehicles
+{
+    struct NearbyBoats
+    {
+        std::array<std::array<bool, 16>, 16> searchResult; // 0x00525BEC
+        World::TilePos2 startTile;                         // 0x00525BE8
+    };
+
+    struct PathFindingResult
+    {
+        uint16_t bestScore;
+        uint8_t cost;
+
+        constexpr auto operator<=>(const PathFindingResult& rhs) const = default;
+    };
+
+    bool isWaterTilePassable(const World::TilePos2 tilePos, const World::MicroZ waterMicroZ, const NearbyBoats& nearbyVehicles);
+    PathFindingResult waterPathfindToTarget(const World::TilePos2 tilePos, const World::MicroZ waterMicroZ, const World::TilePos2 targetOrderPos, const NearbyBoats& nearbyVehicles, const PathFindingResult& bestResult);
+}
@@ -18,5 +18,6 @@ namespace OpenLoco::Ui::ViewportManager
     void destroy(Viewport* vp);
     void invalidate(Station* station);
     void invalidate(EntityBase* t, ZoomLevel zoom);
+    void invalidateSprite(const World::Pos3& pos, int16_t spriteWidth, int16_t spriteHeightNegative, int16_t spriteHeightPositive);
     void invalidate(World::Pos2 pos, coord_t zMin, coord_t zMax, ZoomLevel zoom = ZoomLevel::eighth, int radius = 32);
 }
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "Objects/AirportObject.h"
+#include <OpenLoco/Engine/World.hpp>
+#include <OpenLoco/Types.hpp>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace OpenLoco
+{
+    // An airport's movement nodes resolved to world coordinates for its position and rotation, along
+    // with the edges leaving each node. Built from the airport object the first time an aircraft needs
+    // it, which edges are occupied remains part of the station's game state.
+    struct AirportMovementGraph
+    {
+        struct Node
+        {
+            World::Pos3 loc;
+            AirportMovementNodeFlags flags;
+
+            constexpr bool hasFlags(AirportMovementNodeFlags flagsToTest) const
+            {
+                return (flags & flagsToTest) != AirportMovementNodeFlags::none;
+            }
+        };
+
+        World::Pos3 startPos;
+        uint8_t objectId;
+        uint8_t rotation;
+        std::vector<Node> nodes;
+        std::vector<AirportObject::MovementEdge> edges;
+        std::vector<std::vector<uint8_t>> edgesFromNode; // Ascending edge index
+        std::vector<uint8_t> entryEdges;                 // Edges leaving a flag2 node, ascending
+
+        void build(const AirportObject& airportObj, uint8_t airportObjectId, const World::Pos3& airportStartPos, uint8_t airportRotation);
+
+        std::span<const uint8_t> getEdgesFrom(uint8_t node) const
+        {
+            return edgesFromNode[node];
+        }
+
+        const Node& getEdgeTarget(uint8_t edge) const
+        {
+            return nodes[edges[edge].nextNode];
+        }
+
+        bool canUseEdge(uint8_t edge, uint32_t occupiedEdges) const
+        {
+            const auto& transition = edges[edge];
+            if (occupiedEdges & transition.mustBeClearEdges)
+            {
+                return false;
+            }
+            if (transition.atLeastOneClearEdges == 0)
+            {
+                return true;
+            }
+            return (occupiedEdges & transition.atLeastOneClearEdges) != transition.atLeastOneClearEdges;
+        }
+
+        // The first usable edge after curEdge, or an entry edge if curEdge is kAirportMovementNodeNull.
+        // kAirportMovementNodeNull once a take off reaches its end, kAirportMovementNoValidEdge if every
+        // edge is blocked.
+        uint8_t getNextEdge(uint8_t curEdge, uint32_t occupiedEdges, bool isTakingOff, bool isHelicopter) const;
+    };
+
+    // nullptr if the station has no airport element at its airport start position
+    const AirportMovementGraph* getAirportMovementGraph(const StationId stationId);
+    void invalidateAirportMovementGraph(const StationId stationId);
+    void resetAirportMovementGraphs();
+}
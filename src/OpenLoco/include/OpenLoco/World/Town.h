@@ -52,6 +52,14 @@ namespace OpenLoco
         struct RenderTarget;
     }
 
+    // The road a town grows from, see Town::findRoadExtent
+    struct TownRoadExtent
+    {
+        World::Pos3 roadStart;
+        uint16_t tad;
+        bool isBridge;
+    };
+
     struct Town
     {
         StringId name;                      // 0x00
@@ -87,6 +95,7 @@ namespace OpenLoco
         void adjustCompanyRating(CompanyId cid, int amount);
         void recalculateSize();
         void grow(TownGrowFlags growFlags);
+        std::optional<TownRoadExtent> findRoadExtent() const;
         StringId getTownSizeString() const;
     };
 }
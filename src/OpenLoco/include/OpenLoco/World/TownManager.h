@@ -18,4 +18,10 @@ namespace OpenLoco::TownManager
     void updateMonthly();
     Town* updateTownInfo(const World::Pos2& loc, uint32_t population, uint32_t populationCapacity, int16_t rating, int16_t numBuildings);
     void resetBuildingsInfluence();
+
+    // In-memory index of the roads near each town centre used by Town::grow
+    void resetRoadIndex();
+    void registerRoadTile(const World::Pos2& loc);
+    // Town::findRoadExtent walks every tile around the centre instead when disabled, for tests
+    void setRoadIndexEnabled(bool enabled);
 }
@@ -140,21 +140,17 @@ namespace OpenLoco::Audio
 
         if (_chosenAmbientNoisePathId != *newAmbientSound)
         {
-            auto musicBuffer = loadMusicSample(*newAmbientSound);
-            if (musicBuffer.has_value())
+            if (_ambientHandle != AudioHandle::null)
             {
-                if (_ambientHandle != AudioHandle::null)
-                {
-                    destroy(_ambientHandle);
-                }
-                AudioAttributes attribs{};
-                attribs.volume = kAmbientMinVolume;
-                attribs.loop = true;
-                _ambientHandle = create(*musicBuffer, ChannelId::ambient, attribs);
-                Audio::play(_ambientHandle);
-                _ambientVolume = kAmbientMinVolume;
-                _chosenAmbientNoisePathId = *newAmbientSound;
+                destroy(_ambientHandle);
             }
+            AudioAttributes attribs{};
+            attribs.volume = kAmbientMinVolume;
+            attribs.loop = true;
+            _ambientHandle = createStream(Environment::getPath(*newAmbientSound), ChannelId::ambient, attribs);
+            Audio::play(_ambientHandle);
+            _ambientVolume = kAmbientMinVolume;
+            _chosenAmbientNoisePathId = *newAmbientSound;
         }
         else
         {
@@ -12,7 +12,6 @@
 #include "SceneManager.h"
 #include "Ui/WindowManager.h"
 #include <OpenLoco/Audio/AudioEngine.h>
-#include <OpenLoco/Core/Exception.hpp>
 #include <OpenLoco/Core/FileStream.h>
 #include <array>
 #include <cassert>
@@ -38,7 +37,6 @@ namespace OpenLoco::Audio
 
     static std::vector<BufferId> _samples;
     static std::unordered_map<uint16_t, BufferId> _objectSamples;
-    static std::unordered_map<PathId, BufferId> _musicSamples;
 
     static void playSound(SoundId id, ChannelId channel, const World::Pos3& loc, int32_t volume, int32_t pan, int32_t frequency);
 
@@ -88,82 +86,6 @@ namespace OpenLoco::Audio
         }
     }
 
-    std::optional<BufferId> loadMusicSample(PathId asset)
-    {
-        auto res = _musicSamples.find(asset);
-        if (res != std::end(_musicSamples))
-        {
-            return res->second;
-        }
-
-        const auto path = Environment::getPath(asset);
-        try
-        {
-            FileStream fs(path, StreamMode::read);
-
-            const auto sig = fs.readValue<uint32_t>();
-            if (sig != 0x46464952)
-            {
-                throw Exception::RuntimeError("Invalid signature.");
-            }
-
-            fs.readValue<uint32_t>();
-
-            const auto riffType = fs.readValue<uint32_t>();
-            if (riffType != 0x45564157)
-            {
-                throw Exception::RuntimeError("Invalid format.");
-            }
-
-            const auto fmtMarker = fs.readValue<uint32_t>();
-            if (fmtMarker != 0x20746d66 && fmtMarker != 0x00746d66)
-            {
-                throw Exception::RuntimeError("Invalid format marker.");
-            }
-
-            fs.readValue<uint32_t>();
-
-            const auto typeFormat = fs.readValue<uint16_t>();
-            if (typeFormat != 1)
-            {
-                throw Exception::RuntimeError("Invalid format type, expected PCM.");
-            }
-
-            const auto channels = fs.readValue<uint16_t>();
-            const auto sampleRate = fs.readValue<uint32_t>();
-
-            fs.readValue<uint32_t>();
-            fs.readValue<uint16_t>();
-
-            const auto bits = fs.readValue<uint16_t>();
-
-            const auto dataMarker = fs.readValue<uint32_t>();
-            if (dataMarker != 0x61746164)
-            {
-                throw Exception::RuntimeError("Invalid data marker.");
-            }
-
-            const auto pcmLen = fs.readValue<uint32_t>();
-
-            std::vector<std::uint8_t> pcm(pcmLen);
-            fs.read(pcm.data(), pcmLen);
-
-            AudioFormat fmt{};
-            fmt.sampleRate = sampleRate;
-            fmt.channels = channels;
-            fmt.bitsPerSample = bits;
-            auto id = loadBuffer(std::span<const uint8_t>(pcm.data(), pcmLen), fmt);
-            _musicSamples[asset] = id;
-
-            return id;
-        }
-        catch (const std::exception& ex)
-        {
-            Logging::error("Unable to load music sample '{}': {}", path, ex.what());
-            return std::nullopt;
-        }
-    }
-
     static void disposeSamples()
     {
         for (auto& buf : _samples)
@@ -176,11 +98,6 @@ namespace OpenLoco::Audio
             unloadBuffer(buf);
         }
         _objectSamples.clear();
-        for (auto& [_, buf] : _musicSamples)
-        {
-            unloadBuffer(buf);
-        }
-        _musicSamples.clear();
     }
 
     static void reinitialise()
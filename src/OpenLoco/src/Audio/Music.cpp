@@ -1,6 +1,7 @@
 #include "Audio/Audio.h"
 #include "Config.h"
 #include "Date.h"
+#include "Environment.h"
 #include "Jukebox.h"
 #include "SceneManager.h"
 #include "Ui/WindowManager.h"
@@ -85,15 +86,11 @@ namespace OpenLoco::Audio
             _musicHandle = AudioHandle::null;
         }
 
-        auto musicSample = loadMusicSample(sample);
-        if (musicSample.has_value())
-        {
-            AudioAttributes attribs{};
-            attribs.volume = volume;
-            attribs.loop = loop;
-            _musicHandle = create(*musicSample, ChannelId::music, attribs);
-            Audio::play(_musicHandle);
-        }
+        AudioAttributes attribs{};
+        attribs.volume = volume;
+        attribs.loop = loop;
+        _musicHandle = createStream(Environment::getPath(sample), ChannelId::music, attribs);
+        Audio::play(_musicHandle);
     }
 
     void resetMusic()
@@ -306,6 +306,7 @@ namespace OpenLoco
                           .registerOption("--intro")
                           .registerOption("--log_levels", 1)
                           .registerOption("--all", "-a")
+                          .registerOption("--zoom", 1)
                           .registerOption("--locomotion_path", 1);
 
         if (!parser.parse())
@@ -367,6 +368,11 @@ namespace OpenLoco
                     options.path2 = parser.getArg(2);
                 }
             }
+            else if (firstArg == "screenshot")
+            {
+                options.action = CommandLineAction::screenshot;
+                options.path = parser.getArg(1);
+            }
             else
             {
                 options.path = parser.getArg(0);
@@ -380,6 +386,7 @@ namespace OpenLoco
             options.port = parser.getArg<int32_t>("-p");
         }
         options.outputPath = parser.getArg("-o");
+        options.zoom = parser.getArg<int32_t>("--zoom");
 
         if (parser.hasOption("--log_levels"))
         {
@@ -1,4 +1,5 @@
 #include "Effects/EffectsManager.h"
+#include "Effects/ParticleManager.h"
 #include "GameState.h"
 #include "GameStateFlags.h"
 
@@ -14,6 +15,7 @@ namespace OpenLoco::EffectsManager
             {
                 misc->tick();
             }
+            ParticleManager::tick();
         }
     }
 
@@ -1,7 +1,6 @@
 #include "Effects/ExhaustEffect.h"
 #include "Entities/EntityManager.h"
 #include "Map/StationElement.h"
-#include "Map/SurfaceElement.h"
 #include "Map/TileManager.h"
 #include "Map/TrackElement.h"
 #include "Objects/ObjectManager.h"
@@ -56,8 +55,17 @@ namespace OpenLoco
             return;
         }
 
-        const auto tile = World::TileManager::get(position);
-        const auto lowZ = (position.z / World::kSmallZStep) - 3;
+        if (shouldDisperse(position))
+        {
+            EntityManager::freeEntity(this);
+        }
+    }
+
+    // Part of 0x004408C2, exhaust that hits something solid (e.g. a station canopy) dissipates
+    bool Exhaust::shouldDisperse(const World::Pos3& pos)
+    {
+        const auto tile = World::TileManager::get(pos);
+        const auto lowZ = (pos.z / World::kSmallZStep) - 3;
         const auto highZ = lowZ + 6;
         for (const auto& el : tile)
         {
@@ -67,8 +75,7 @@ namespace OpenLoco
             }
             if (lowZ < el.baseZ() && highZ > el.baseZ())
             {
-                EntityManager::freeEntity(this);
-                return;
+                return true;
             }
 
             auto* elTrack = el.as<World::TrackElement>();
@@ -111,48 +118,8 @@ namespace OpenLoco
                 continue;
             }
 
-            EntityManager::freeEntity(this);
-            return;
-        }
-    }
-
-    // 0x0044080C
-    Exhaust* Exhaust::create(World::Pos3 loc, uint8_t type)
-    {
-        if (!World::validCoords(loc))
-        {
-            return nullptr;
-        }
-        auto surface = World::TileManager::get(loc.x & 0xFFE0, loc.y & 0xFFE0).surface();
-
-        if (surface == nullptr)
-        {
-            return nullptr;
-        }
-
-        if (loc.z <= surface->baseHeight())
-        {
-            return nullptr;
-        }
-
-        auto _exhaust = static_cast<Exhaust*>(EntityManager::createEntityMisc());
-
-        if (_exhaust != nullptr)
-        {
-            _exhaust->baseType = EntityBaseType::effect;
-            _exhaust->objectId = type;
-            const auto* obj = _exhaust->getObject();
-            _exhaust->spriteWidth = obj->spriteWidth;
-            _exhaust->spriteHeightNegative = obj->spriteHeightNegative;
-            _exhaust->spriteHeightPositive = obj->spriteHeightPositive;
-            _exhaust->setSubType(EffectType::exhaust);
-            _exhaust->frameNum = 0;
-            _exhaust->stationaryProgress = 0;
-            _exhaust->windProgress = 0;
-            _exhaust->var_34 = 0;
-            _exhaust->var_36 = 0;
-            _exhaust->moveTo(loc);
+            return true;
         }
-        return _exhaust;
+        return false;
     }
 }
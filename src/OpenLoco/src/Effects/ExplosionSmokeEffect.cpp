@@ -13,21 +13,4 @@ namespace OpenLoco
             EntityManager::freeEntity(this);
         }
     }
-
-    // 0x00440BBF
-    ExplosionSmoke* ExplosionSmoke::create(const World::Pos3& loc)
-    {
-        auto t = static_cast<ExplosionSmoke*>(EntityManager::createEntityMisc());
-        if (t != nullptr)
-        {
-            t->spriteWidth = 44;
-            t->spriteHeightNegative = 32;
-            t->spriteHeightPositive = 34;
-            t->baseType = EntityBaseType::effect;
-            t->moveTo(loc + World::Pos3{ 0, 0, 4 });
-            t->setSubType(EffectType::explosionSmoke);
-            t->frame = 0;
-        }
-        return t;
-    }
 }
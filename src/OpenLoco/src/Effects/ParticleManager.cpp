@@ -0,0 +1,411 @@
+#include "Effects/ParticleManager.h"
+#include "Effects/ExhaustEffect.h"
+#include "Map/SurfaceElement.h"
+#include "Map/TileManager.h"
+#include "Objects/ObjectManager.h"
+#include "Objects/SteamObject.h"
+#include "ViewportManager.h"
+#include <OpenLoco/Engine/Types.hpp>
+#include <array>
+#include <numeric>
+#include <vector>
+
+namespace OpenLoco::ParticleManager
+{
+    // Vanilla shared 4000 misc entities between these and the few gameplay relevant effects,
+    // exhaust is by far the most common so it gets the bulk of the budget.
+    static constexpr std::array<size_t, kNumParticleTypes> kParticleBudgets = {
+        3000, // exhaust
+        200,  // splash
+        400,  // explosionSmoke
+        400,  // smoke
+    };
+    static constexpr size_t kMaxParticles = std::accumulate(kParticleBudgets.begin(), kParticleBudgets.end(), size_t{ 0 });
+    static_assert(kMaxParticles < kNullParticle);
+
+    static constexpr size_t kTileIndexSize = (World::kMapPitch * World::kMapPitch) + 1;
+    static constexpr size_t kTileIndexNull = kTileIndexSize - 1;
+
+    // Particle state, one array per field so that each batch tick only touches what it needs
+    static std::array<ParticleType, kMaxParticles> _type;
+    static std::array<coord_t, kMaxParticles> _x;
+    static std::array<coord_t, kMaxParticles> _y;
+    static std::array<coord_t, kMaxParticles> _z;
+    static std::array<uint16_t, kMaxParticles> _frame;
+    static std::array<ParticleId, kMaxParticles> _nextOnTile;
+    static std::array<uint16_t, kMaxParticles> _activeIndex;
+
+    // Exhaust only
+    static std::array<uint8_t, kMaxParticles> _objectId;
+    static std::array<uint8_t, kMaxParticles> _stationaryProgress;
+    static std::array<uint16_t, kMaxParticles> _windProgress;
+
+    static std::array<std::vector<ParticleId>, kNumParticleTypes> _active;
+    static std::vector<ParticleId> _freeIds;
+    static std::vector<ParticleId> _tileHeads;
+
+    static void invalidate(ParticleId id);
+
+    void reset()
+    {
+        for (auto& active : _active)
+        {
+            for (const auto id : active)
+            {
+                invalidate(id);
+            }
+            active.clear();
+        }
+
+        // Hand out low ids first, not that it matters for anything but debugging
+        _freeIds.resize(kMaxParticles);
+        std::iota(_freeIds.rbegin(), _freeIds.rend(), ParticleId{ 0 });
+
+        _tileHeads.assign(kTileIndexSize, kNullParticle);
+    }
+
+    static size_t getTileIndex(coord_t x, coord_t y)
+    {
+        if (x == Location::null)
+        {
+            return kTileIndexNull;
+        }
+
+        const auto tileX = std::abs(x) / World::kTileSize;
+        const auto tileY = std::abs(y) / World::kTileSize;
+        if (tileX >= World::kMapPitch || tileY >= World::kMapPitch)
+        {
+            return kTileIndexNull;
+        }
+        return (World::kMapPitch * tileX) + tileY;
+    }
+
+    static void linkToTile(ParticleId id)
+    {
+        auto& head = _tileHeads[getTileIndex(_x[id], _y[id])];
+        _nextOnTile[id] = head;
+        head = id;
+    }
+
+    static void unlinkFromTile(ParticleId id)
+    {
+        auto* link = &_tileHeads[getTileIndex(_x[id], _y[id])];
+        while (*link != kNullParticle)
+        {
+            if (*link == id)
+            {
+                *link = _nextOnTile[id];
+                return;
+            }
+            link = &_nextOnTile[*link];
+        }
+    }
+
+    struct SpriteSize
+    {
+        uint8_t width;
+        uint8_t heightNegative;
+        uint8_t heightPositive;
+    };
+
+    static SpriteSize getSpriteSize(ParticleId id)
+    {
+        switch (_type[id])
+        {
+            case ParticleType::exhaust:
+            {
+                const auto* steamObj = ObjectManager::get<SteamObject>(_objectId[id] & 0x7F);
+                if (steamObj == nullptr)
+                {
+                    return {};
+                }
+                return { steamObj->spriteWidth, steamObj->spriteHeightNegative, steamObj->spriteHeightPositive };
+            }
+            case ParticleType::splash:
+                return { 33, 51, 16 };
+            case ParticleType::explosionSmoke:
+            case ParticleType::smoke:
+                return { 44, 32, 34 };
+        }
+        return {};
+    }
+
+    static void invalidate(ParticleId id)
+    {
+        const auto size = getSpriteSize(id);
+        Ui::ViewportManager::invalidateSprite(World::Pos3(_x[id], _y[id], _z[id]), size.width, size.heightNegative, size.heightPositive);
+    }
+
+    static void moveTo(ParticleId id, const World::Pos3& loc)
+    {
+        invalidate(id);
+        if (getTileIndex(loc.x, loc.y) != getTileIndex(_x[id], _y[id]))
+        {
+            unlinkFromTile(id);
+            _x[id] = loc.x;
+            _y[id] = loc.y;
+            linkToTile(id);
+        }
+        else
+        {
+            _x[id] = loc.x;
+            _y[id] = loc.y;
+        }
+        _z[id] = loc.z;
+        invalidate(id);
+    }
+
+    // Cosmetic effects are simply dropped once their type is over budget
+    static ParticleId allocate(ParticleType type, const World::Pos3& loc)
+    {
+        if (_tileHeads.empty())
+        {
+            reset();
+        }
+
+        auto& active = _active[enumValue(type)];
+        if (active.size() >= kParticleBudgets[enumValue(type)] || _freeIds.empty())
+        {
+            return kNullParticle;
+        }
+
+        const auto id = _freeIds.back();
+        _freeIds.pop_back();
+
+        _type[id] = type;
+        _activeIndex[id] = static_cast<uint16_t>(active.size());
+        active.push_back(id);
+
+        _x[id] = loc.x;
+        _y[id] = loc.y;
+        _z[id] = loc.z;
+        _frame[id] = 0;
+        _objectId[id] = 0;
+        linkToTile(id);
+        return id;
+    }
+
+    static void freeParticle(ParticleId id)
+    {
+        invalidate(id);
+        unlinkFromTile(id);
+
+        auto& active = _active[enumValue(_type[id])];
+        const auto index = _activeIndex[id];
+        active[index] = active.back();
+        _activeIndex[active[index]] = index;
+        active.pop_back();
+
+        _freeIds.push_back(id);
+    }
+
+    // Runs func on every particle of the type, func returns false once it has freed the particle
+    template<typename TFunc>
+    static void tickEach(ParticleType type, TFunc&& func)
+    {
+        auto& active = _active[enumValue(type)];
+        for (size_t i = 0; i < active.size();)
+        {
+            // A freed particle has the last one swapped into its place
+            if (func(active[i]))
+            {
+                i++;
+            }
+        }
+    }
+
+    // 0x004408C2
+    static bool tickExhaust(ParticleId id)
+    {
+        const auto* steamObj = ObjectManager::get<SteamObject>(_objectId[id] & 0x7F);
+        if (steamObj == nullptr)
+        {
+            freeParticle(id);
+            return false;
+        }
+        if (steamObj->hasFlags(SteamObjectFlags::applyWind))
+        {
+            // Wind is applied by applying a slight modification (~1 in 10 ticks a pixel change) to the x component of the exhaust
+            const auto res = _windProgress[id] + 7000;
+            _windProgress[id] = static_cast<uint16_t>(res);
+            if (res > std::numeric_limits<uint16_t>::max())
+            {
+                moveTo(id, World::Pos3(_x[id] + 1, _y[id], _z[id]));
+            }
+        }
+        _stationaryProgress[id]++;
+        if (_stationaryProgress[id] < steamObj->numStationaryTicks)
+        {
+            return true;
+        }
+        _stationaryProgress[id] = 0;
+        _frame[id]++;
+
+        auto [totalNumFrames, frameInfo] = steamObj->getFramesInfo(_objectId[id] & (1 << 7));
+        if (_frame[id] >= totalNumFrames)
+        {
+            freeParticle(id);
+            return false;
+        }
+
+        const auto pos = World::Pos3(_x[id], _y[id], _z[id] + frameInfo[_frame[id]].height);
+        moveTo(id, pos);
+
+        if (steamObj->hasFlags(SteamObjectFlags::disperseOnCollision) && Exhaust::shouldDisperse(pos))
+        {
+            freeParticle(id);
+            return false;
+        }
+        return true;
+    }
+
+    // 0x004407E0
+    static bool tickSplash(ParticleId id)
+    {
+        invalidate(id);
+        _frame[id] += 0x55;
+        if (_frame[id] >= 0x1C00)
+        {
+            freeParticle(id);
+            return false;
+        }
+        return true;
+    }
+
+    // 0x00440078D
+    static bool tickExplosionSmoke(ParticleId id)
+    {
+        invalidate(id);
+        _frame[id] += 0x80;
+        if (_frame[id] >= 0xA00)
+        {
+            freeParticle(id);
+            return false;
+        }
+        return true;
+    }
+
+    // 0x004407A1
+    static bool tickSmoke(ParticleId id)
+    {
+        moveTo(id, World::Pos3(_x[id], _y[id], _z[id] + 1));
+
+        _frame[id] += 0x55;
+        if (_frame[id] >= 0xC00)
+        {
+            freeParticle(id);
+            return false;
+        }
+        return true;
+    }
+
+    void tick()
+    {
+        tickEach(ParticleType::exhaust, tickExhaust);
+        tickEach(ParticleType::splash, tickSplash);
+        tickEach(ParticleType::explosionSmoke, tickExplosionSmoke);
+        tickEach(ParticleType::smoke, tickSmoke);
+    }
+
+    // 0x0044080C
+    void createExhaust(const World::Pos3& loc, uint8_t type)
+    {
+        if (!World::validCoords(loc))
+        {
+            return;
+        }
+        auto surface = World::TileManager::get(loc.x & 0xFFE0, loc.y & 0xFFE0).surface();
+        if (surface == nullptr)
+        {
+            return;
+        }
+        if (loc.z <= surface->baseHeight())
+        {
+            return;
+        }
+
+        const auto id = allocate(ParticleType::exhaust, loc);
+        if (id == kNullParticle)
+        {
+            return;
+        }
+        _objectId[id] = type;
+        _stationaryProgress[id] = 0;
+        _windProgress[id] = 0;
+        invalidate(id);
+    }
+
+    // 0x00440BEB
+    void createSmoke(const World::Pos3& loc)
+    {
+        const auto id = allocate(ParticleType::smoke, loc);
+        if (id != kNullParticle)
+        {
+            invalidate(id);
+        }
+    }
+
+    // 0x00440C6B
+    void createSplash(const World::Pos3& pos)
+    {
+        if (!World::validCoords(pos))
+        {
+            return;
+        }
+
+        const auto id = allocate(ParticleType::splash, pos + World::Pos3{ 0, 3, 0 });
+        if (id != kNullParticle)
+        {
+            invalidate(id);
+        }
+    }
+
+    // 0x00440BBF
+    void createExplosionSmoke(const World::Pos3& loc)
+    {
+        const auto id = allocate(ParticleType::explosionSmoke, loc + World::Pos3{ 0, 0, 4 });
+        if (id != kNullParticle)
+        {
+            invalidate(id);
+        }
+    }
+
+    size_t getCount(ParticleType type)
+    {
+        return _active[enumValue(type)].size();
+    }
+
+    size_t getBudget(ParticleType type)
+    {
+        return kParticleBudgets[enumValue(type)];
+    }
+
+    ParticleId firstOnTile(const World::Pos2& loc)
+    {
+        if (_tileHeads.empty())
+        {
+            return kNullParticle;
+        }
+        return _tileHeads[getTileIndex(loc.x, loc.y)];
+    }
+
+    ParticleId nextOnTile(ParticleId id)
+    {
+        return _nextOnTile[id];
+    }
+
+    Particle get(ParticleId id)
+    {
+        const auto size = getSpriteSize(id);
+
+        Particle particle{};
+        particle.type = _type[id];
+        particle.position = World::Pos3(_x[id], _y[id], _z[id]);
+        particle.frame = _frame[id];
+        particle.objectId = _objectId[id];
+        particle.spriteWidth = size.width;
+        particle.spriteHeightNegative = size.heightNegative;
+        particle.spriteHeightPositive = size.heightPositive;
+        return particle;
+    }
+}
@@ -16,21 +16,4 @@ namespace OpenLoco
             EntityManager::freeEntity(this);
         }
     }
-
-    // 0x00440BEB
-    Smoke* Smoke::create(World::Pos3 loc)
-    {
-        auto t = static_cast<Smoke*>(EntityManager::createEntityMisc());
-        if (t != nullptr)
-        {
-            t->spriteWidth = 44;
-            t->spriteHeightNegative = 32;
-            t->spriteHeightPositive = 34;
-            t->baseType = EntityBaseType::effect;
-            t->setSubType(EffectType::smoke);
-            t->frame = 0;
-            t->moveTo(loc);
-        }
-        return t;
-    }
 }
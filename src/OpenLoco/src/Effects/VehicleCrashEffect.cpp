@@ -1,6 +1,6 @@
 #include "Effects/VehicleCrashEffect.h"
 #include "Audio/Audio.h"
-#include "Effects/SplashEffect.h"
+#include "Effects/ParticleManager.h"
 #include "Entities/EntityManager.h"
 #include "Map/TileManager.h"
 #include "Random.h"
@@ -56,7 +56,7 @@ namespace OpenLoco
             const auto splashPos = World::Pos3{ position.x, position.y, waterZ };
 
             Audio::playSound(Audio::SoundId::splash2, Audio::ChannelId::vehicles, splashPos);
-            Splash::create({ position.x, position.y, waterZ });
+            ParticleManager::createSplash(splashPos);
 
             EntityManager::freeEntity(this);
             return;
@@ -6,6 +6,10 @@
 #include "Localisation/StringIds.h"
 #include "Logging.h"
 #include <OpenLoco/Core/LocoFixedVector.hpp>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <vector>
 
 using namespace OpenLoco::Diagnostics;
 
@@ -20,11 +24,22 @@ namespace OpenLoco::EntityManager
     static EntityId _entitySpatialIndex[kSpatialEntityMapSize]; // 0x01025A8C
     static uint32_t _entitySpatialCount;                        // 0x01025A88
 
+    // Kept in step with the quadrant lists so empty tiles can be skipped without walking them
+    static std::array<uint16_t, kSpatialEntityMapSize> _entitySpatialTileCounts;
+    static std::array<uint64_t, (kSpatialEntityMapSize + 63) / 64> _entitySpatialOccupancy;
+
     static auto& rawEntities() { return getGameState().entities; }
     static auto entities() { return FixedVector(rawEntities()); }
     static auto& rawListHeads() { return getGameState().entityListHeads; }
     static auto& rawListCounts() { return getGameState().entityListCounts; }
 
+    // The ids of each list stored contiguously, with each entity's position in its list's array. The linked
+    // lists stay the source of truth for the order entities are ticked in, these are for code that can visit
+    // a list in any order. Not saved, rebuilt from the links whenever the entities are replaced.
+    static std::array<std::vector<EntityId>, Limits::kNumEntityLists> _listIds;
+    static std::array<uint16_t, Limits::kMaxEntities> _listIdPositions;
+    static std::array<bool, Limits::kNumEntityLists> _listIdsUnsorted;
+
     constexpr uint8_t getLinkedListOffset(EntityListType list)
     {
         return enumValue(list) * static_cast<uint8_t>(sizeof(uint16_t));
@@ -35,6 +50,65 @@ namespace OpenLoco::EntityManager
         return offset / static_cast<uint8_t>(sizeof(uint16_t));
     }
 
+    static void addToListIds(const EntityId id, const size_t list)
+    {
+        auto& ids = _listIds[list];
+        if (!ids.empty() && ids.back() > id)
+        {
+            _listIdsUnsorted[list] = true;
+        }
+        _listIdPositions[enumValue(id)] = static_cast<uint16_t>(ids.size());
+        ids.push_back(id);
+    }
+
+    static void removeFromListIds(const EntityId id, const size_t list)
+    {
+        auto& ids = _listIds[list];
+        const auto pos = _listIdPositions[enumValue(id)];
+        if (pos != ids.size() - 1)
+        {
+            ids[pos] = ids.back();
+            _listIdPositions[enumValue(ids[pos])] = pos;
+            _listIdsUnsorted[list] = true;
+        }
+        ids.pop_back();
+    }
+
+    void resetListIds()
+    {
+        for (auto& ids : _listIds)
+        {
+            ids.clear();
+        }
+        _listIdsUnsorted = {};
+
+        // Going through the entities in id order leaves every list sorted
+        for (auto& ent : rawEntities())
+        {
+            const auto list = getLinkedListIndex(ent.linkedListOffset);
+            if (list < _listIds.size())
+            {
+                addToListIds(ent.id, list);
+            }
+        }
+    }
+
+    std::span<const EntityId> getListIds(const EntityListType list)
+    {
+        const auto index = enumValue(list);
+        auto& ids = _listIds[index];
+        if (_listIdsUnsorted[index])
+        {
+            std::ranges::sort(ids);
+            for (size_t i = 0; i < ids.size(); ++i)
+            {
+                _listIdPositions[enumValue(ids[i])] = static_cast<uint16_t>(i);
+            }
+            _listIdsUnsorted[index] = false;
+        }
+        return ids;
+    }
+
     // 0x0046FDFD
     void reset()
     {
@@ -91,6 +165,7 @@ namespace OpenLoco::EntityManager
         }
         rawListCounts()[enumValue(EntityListType::nullMoney)] = Limits::kMaxMoneyEntities;
 
+        resetListIds();
         resetSpatialIndex();
         EntityTweener::get().reset();
     }
@@ -153,10 +228,68 @@ namespace OpenLoco::EntityManager
         return _entitySpatialIndex[index];
     }
 
+    uint16_t getQuadrantCount(const World::Pos2& loc)
+    {
+        return _entitySpatialTileCounts[getSpatialIndexOffset(loc)];
+    }
+
+    bool isQuadrantOccupied(const World::Pos2& loc)
+    {
+        const auto index = getSpatialIndexOffset(loc);
+        return (_entitySpatialOccupancy[index / 64] & (1ULL << (index % 64))) != 0;
+    }
+
+    // Index of the first occupied tile in the inclusive index range
+    static std::optional<size_t> findOccupiedIndex(const size_t first, const size_t last)
+    {
+        auto word = first / 64;
+        const auto lastWord = last / 64;
+        auto bits = _entitySpatialOccupancy[word] & (~0ULL << (first % 64));
+        while (true)
+        {
+            if (word == lastWord)
+            {
+                bits &= ~0ULL >> (63 - (last % 64));
+            }
+            if (bits != 0)
+            {
+                return word * 64 + std::countr_zero(bits);
+            }
+            if (word == lastWord)
+            {
+                return std::nullopt;
+            }
+            bits = _entitySpatialOccupancy[++word];
+        }
+    }
+
+    std::optional<World::TilePos2> findOccupiedQuadrant(const World::TilePos2& pos, const World::TilePos2& bottomLeft, const World::TilePos2& topRight)
+    {
+        // The index is x major so each x is one contiguous run of y
+        for (auto x = pos.x; x <= topRight.x; ++x)
+        {
+            const auto firstY = x == pos.x ? pos.y : bottomLeft.y;
+            if (firstY > topRight.y)
+            {
+                continue;
+            }
+
+            const auto column = static_cast<size_t>(x) * World::kMapPitch;
+            if (auto index = findOccupiedIndex(column + firstY, column + topRight.y))
+            {
+                return World::TilePos2(x, static_cast<tile_coord_t>(*index - column));
+            }
+        }
+        return std::nullopt;
+    }
+
     static void insertToSpatialIndex(EntityBase& entity, const size_t newIndex)
     {
         entity.nextQuadrantId = _entitySpatialIndex[newIndex];
         _entitySpatialIndex[newIndex] = entity.id;
+
+        _entitySpatialTileCounts[newIndex]++;
+        _entitySpatialOccupancy[newIndex / 64] |= 1ULL << (newIndex % 64);
     }
 
     static void insertToSpatialIndex(EntityBase& entity)
@@ -170,6 +303,8 @@ namespace OpenLoco::EntityManager
     {
         // Clear existing array
         std::fill(std::begin(_entitySpatialIndex), std::end(_entitySpatialIndex), EntityId::null);
+        _entitySpatialTileCounts.fill(0);
+        _entitySpatialOccupancy.fill(0);
 
         // Original filled an unreferenced array at 0x010A5A8E as well then overwrote part of it???
 
@@ -199,6 +334,10 @@ namespace OpenLoco::EntityManager
             if (quadEnt == &entity)
             {
                 *quadId = entity.nextQuadrantId;
+                if (--_entitySpatialTileCounts[index] == 0)
+                {
+                    _entitySpatialOccupancy[index / 64] &= ~(1ULL << (index % 64));
+                }
                 return true;
             }
             _entitySpatialCount++;
@@ -384,6 +523,9 @@ namespace OpenLoco::EntityManager
 
         rawListCounts()[oldListIndex]--;
         rawListCounts()[newListIndex]++;
+
+        removeFromListIds(entity->id, oldListIndex);
+        addToListIds(entity->id, newListIndex);
     }
 
     // 0x00470188
@@ -414,13 +556,13 @@ namespace OpenLoco::EntityManager
     // 0x0046FED5
     void zeroUnused()
     {
-        for (auto* ent : EntityList<EntityListIterator<EntityBase>, EntityListType::null>())
+        for (auto id : getListIds(EntityListType::null))
         {
-            zeroEntity(ent);
+            zeroEntity(get<EntityBase>(id));
         }
-        for (auto* ent : EntityList<EntityListIterator<EntityBase>, EntityListType::nullMoney>())
+        for (auto id : getListIds(EntityListType::nullMoney))
         {
-            zeroEntity(ent);
+            zeroEntity(get<EntityBase>(id));
         }
     }
 }
@@ -1,28 +1,31 @@
 #include "Entities/EntityTweener.h"
+#include "Engine/Limits.h"
 #include "Entities/Entity.h"
 #include "OpenLoco.h"
 #include "Vehicles/Vehicle.h"
+#include "ViewportManager.h"
 #include <cmath>
-#include <iostream>
 
 namespace OpenLoco
 {
     using EntityListType = EntityManager::EntityListType;
-    using EntityListIterator = EntityManager::ListIterator<EntityBase, &EntityBase::nextEntityId>;
 
-    template<EntityListType id, typename Pred>
-    void PopulateEntities(std::vector<EntityBase*>& list, std::vector<World::Pos3>& posList, const Pred& pred)
+    // The order does not matter here so the entities are visited in memory order rather than list order
+    template<typename Pred>
+    void PopulateEntities(EntityListType listType, std::vector<EntityId>& list, std::vector<uint8_t>& isTracked, std::vector<World::Pos3>& posList, const Pred& pred)
     {
-        auto entsView = EntityManager::EntityList<EntityListIterator, id>();
-        for (auto* ent : entsView)
+        for (auto id : EntityManager::getListIds(listType))
         {
+            auto* ent = EntityManager::get<EntityBase>(id);
             if (!pred(ent))
             {
                 continue;
             }
 
-            list.push_back(ent);
-            posList.emplace_back(ent->position);
+            const auto index = enumValue(id);
+            list.push_back(id);
+            isTracked[index] = 1;
+            posList[index] = ent->position;
         }
     }
 
@@ -33,12 +36,30 @@ namespace OpenLoco
         return _tweener;
     }
 
+    EntityBase* EntityTweener::getTracked(EntityId id) const
+    {
+        if (!_isTracked[enumValue(id)])
+        {
+            return nullptr;
+        }
+        return EntityManager::get<EntityBase>(id);
+    }
+
     void EntityTweener::preTick()
     {
         restore();
         reset();
-        PopulateEntities<EntityListType::misc>(_entities, _prePos, [](auto*) { return true; });
-        PopulateEntities<EntityListType::vehicle>(_entities, _prePos, [](auto* ent) {
+
+        if (_isTracked.empty())
+        {
+            _isTracked.resize(Limits::kMaxEntities, 0);
+            _prePos.resize(Limits::kMaxEntities);
+            _postPos.resize(Limits::kMaxEntities);
+            _renderPos.resize(Limits::kMaxEntities);
+        }
+
+        PopulateEntities(EntityListType::misc, _entities, _isTracked, _prePos, [](auto*) { return true; });
+        PopulateEntities(EntityListType::vehicle, _entities, _isTracked, _prePos, [](auto* ent) {
             const auto* vehicle = ent->template asBase<Vehicles::VehicleBase>();
             if (vehicle == nullptr)
             {
@@ -47,47 +68,52 @@ namespace OpenLoco
             }
             return vehicle->isVehicleBody() || vehicle->isVehicleBogie();
         });
+
+        // Until the tick is over the entities are drawn where they are
+        for (auto id : _entities)
+        {
+            _postPos[enumValue(id)] = _prePos[enumValue(id)];
+            _renderPos[enumValue(id)] = _prePos[enumValue(id)];
+        }
     }
 
     void EntityTweener::postTick()
     {
-        for (auto* ent : _entities)
+        for (auto id : _entities)
         {
-            if (ent == nullptr || ent->id == EntityId::null)
+            if (auto* ent = getTracked(id); ent != nullptr)
             {
-                // Sprite was removed, add a dummy position to keep the index aligned.
-                _postPos.emplace_back(0, 0, 0);
-            }
-            else
-            {
-                _postPos.emplace_back(ent->position);
+                _postPos[enumValue(id)] = ent->position;
+                _renderPos[enumValue(id)] = ent->position;
             }
         }
     }
 
     void EntityTweener::removeEntity(const EntityBase* entity)
     {
-        auto it = std::find(_entities.begin(), _entities.end(), entity);
-        if (it != _entities.end())
+        const auto index = enumValue(entity->id);
+        if (index < _isTracked.size())
         {
-            *it = nullptr;
+            _isTracked[index] = 0;
         }
     }
 
+    // Only the drawn position is interpolated, the entity itself stays where the last tick put it
+    // so that the spatial index and everything reading the game state never see a tweened position.
     void EntityTweener::tween(float alpha)
     {
         const float inv = (1.0f - alpha);
 
-        for (size_t i = 0; i < _entities.size(); ++i)
+        for (auto id : _entities)
         {
-            auto* ent = _entities[i];
+            auto* ent = getTracked(id);
             if (ent == nullptr)
             {
                 continue;
             }
 
-            auto& posA = _prePos[i];
-            auto& posB = _postPos[i];
+            const auto& posA = _prePos[enumValue(id)];
+            const auto& posB = _postPos[enumValue(id)];
 
             if (posA == posB)
             {
@@ -98,41 +124,64 @@ namespace OpenLoco
                                        static_cast<int16_t>(std::round(posB.y * alpha + posA.y * inv)),
                                        static_cast<int16_t>(std::round(posB.z * alpha + posA.z * inv)) };
 
-            if (ent->position == newPos)
-            {
-                continue;
-            }
-
-            ent->moveTo(newPos);
+            setRenderPosition(*ent, newPos);
         }
     }
 
     void EntityTweener::restore()
     {
-        for (size_t i = 0; i < _entities.size(); ++i)
+        for (auto id : _entities)
         {
-            auto* ent = _entities[i];
+            auto* ent = getTracked(id);
             if (ent == nullptr)
             {
                 continue;
             }
 
-            auto& newPos = _postPos[i];
+            setRenderPosition(*ent, _postPos[enumValue(id)]);
+        }
+    }
 
-            if (ent->position == newPos)
-            {
-                continue;
-            }
+    // Redraws the sprite where it was drawn and where it will be drawn next
+    void EntityTweener::setRenderPosition(const EntityBase& entity, const World::Pos3& pos)
+    {
+        auto& renderPos = _renderPos[enumValue(entity.id)];
+        if (renderPos == pos || pos.x == Location::null)
+        {
+            return;
+        }
+
+        if (renderPos.x != Location::null)
+        {
+            Ui::ViewportManager::invalidateSprite(renderPos, entity.spriteWidth, entity.spriteHeightNegative, entity.spriteHeightPositive);
+        }
+        renderPos = pos;
+        Ui::ViewportManager::invalidateSprite(renderPos, entity.spriteWidth, entity.spriteHeightNegative, entity.spriteHeightPositive);
+    }
 
-            ent->moveTo(newPos);
+    World::Pos3 EntityTweener::getRenderPosition(const EntityBase& entity) const
+    {
+        const auto index = enumValue(entity.id);
+        if (index >= _isTracked.size() || !_isTracked[index])
+        {
+            return entity.position;
         }
+
+        // Moved outside of a tick, e.g. by a game command, so the tween no longer applies
+        if (_postPos[index] != entity.position)
+        {
+            return entity.position;
+        }
+        return _renderPos[index];
     }
 
     void EntityTweener::reset()
     {
+        for (auto id : _entities)
+        {
+            _isTracked[enumValue(id)] = 0;
+        }
         _entities.clear();
-        _prePos.clear();
-        _postPos.clear();
     }
 
 }
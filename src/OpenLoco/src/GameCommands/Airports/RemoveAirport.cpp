@@ -12,6 +12,7 @@
 #include "Vehicles/VehicleHead.h"
 #include "Vehicles/VehicleManager.h"
 #include "ViewportManager.h"
+#include "World/AirportMovementGraph.h"
 #include "World/Industry.h"
 #include "World/Station.h"
 #include "World/StationManager.h"
@@ -189,6 +190,7 @@ namespace OpenLoco::GameCommands
 
             removeTileFromStationAndRecalcCargo(stationId, pos, rotation);
             station->flags &= ~StationFlags::flag_6;
+            invalidateAirportMovementGraph(stationId);
             station->invalidate();
 
             recalculateStationModes(stationId);
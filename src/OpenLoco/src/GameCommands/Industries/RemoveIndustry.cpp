@@ -94,28 +94,14 @@ namespace OpenLoco::GameCommands
     // 0x00455A5C
     static void revokeAllSurfaceClaims(const IndustryId id)
     {
-        for (auto& pos : World::getWorldRange())
-        {
-            auto tile = World::TileManager::get(pos);
-            auto* surface = tile.surface();
-            if (surface == nullptr)
-            {
-                continue;
-            }
-            if (!surface->isIndustrial())
-            {
-                continue;
-            }
-            if (surface->industryId() != id)
-            {
-                continue;
-            }
-            surface->setIsIndustrialFlag(false);
-            surface->setGrowthStage(0);
-            surface->setVariation(0);
-            Ui::ViewportManager::invalidate(World::toWorldSpace(pos), surface->baseHeight(), surface->baseHeight() + 32);
-            World::TileManager::removeAllWallsOnTileAbove(pos, surface->baseZ());
-        }
+        // Each tile is handled on its own so there is no need to visit them in map order
+        World::TileManager::forEachElementOfIndustry<World::SurfaceElement>(id, [](World::SurfaceElement& surface, const World::TilePos2 pos) {
+            surface.setIsIndustrialFlag(false);
+            surface.setGrowthStage(0);
+            surface.setVariation(0);
+            Ui::ViewportManager::invalidate(World::toWorldSpace(pos), surface.baseHeight(), surface.baseHeight() + 32);
+            World::TileManager::removeAllWallsOnTileAbove(pos, surface.baseZ());
+        });
     }
 
     // 0x00455943
@@ -20,6 +20,9 @@
 #include "World/IndustryManager.h"
 #include "World/StationManager.h"
 #include "World/TownManager.h"
+#include <algorithm>
+#include <iterator>
+#include <vector>
 
 using namespace OpenLoco::World;
 
@@ -45,9 +48,19 @@ namespace OpenLoco::GameCommands
         // NB: vanilla did not set an expenditure type
         GameCommands::setExpenditureType(ExpenditureType::Construction);
 
-        // Iterate over the entire map to find town tiles
-        // TODO: can't we do better than vanilla for this? e.g. a radius around the town centre?
-        for (auto& tilePos : getWorldRange())
+        // Vanilla iterated over the entire map to find town tiles. Only tiles with a building or a neutral road
+        // can have anything removed and removals never add new ones, so visiting just those in map order is the same.
+        // Elements do not record their town so the closest town check below still has to be done per tile.
+        const auto buildingTiles = TileManager::getTilesWithElement<BuildingElement>([](const BuildingElement& el) {
+            return !el.isGhost() && !el.isMiscBuilding() && el.sequenceIndex() == 0;
+        });
+        const auto roadTiles = TileManager::getTilesWithElement<RoadElement>([](const RoadElement& el) {
+            return !el.isGhost() && el.owner() == CompanyId::neutral;
+        });
+        std::vector<TilePos2> townTiles;
+        std::ranges::set_union(buildingTiles, roadTiles, std::back_inserter(townTiles), TileManager::isBeforeInMapOrder);
+
+        for (auto& tilePos : townTiles)
         {
             auto tile = TileManager::get(tilePos);
 
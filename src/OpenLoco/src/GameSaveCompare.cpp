@@ -463,8 +463,8 @@ namespace OpenLoco::GameSaveCompare
         foundDivergence |= isLoggedDivergentGameStateField("startingLoanSize", 0, gameState1.general.startingLoanSize, gameState2.general.startingLoanSize);
         foundDivergence |= isLoggedDivergentGameStateField("maxLoanSize", 0, gameState1.general.maxLoanSize, gameState2.general.maxLoanSize);
         foundDivergence |= isLoggedDivergence("multiplayerPrng", gameState1.general.multiplayerPrng, gameState2.general.multiplayerPrng, 2, displayAllDivergences);
-        foundDivergence |= isLoggedDivergentGameStateField("var_40C", 0, gameState1.general.multiplayerChecksumA, gameState2.general.multiplayerChecksumA);
-        foundDivergence |= isLoggedDivergentGameStateField("var_410", 0, gameState1.general.multiplayerChecksumB, gameState2.general.multiplayerChecksumB);
+        foundDivergence |= isLoggedDivergentGameStateField("multiplayerChecksumA", 0, gameState1.general.multiplayerChecksumA, gameState2.general.multiplayerChecksumA);
+        foundDivergence |= isLoggedDivergentGameStateField("multiplayerChecksumB", 0, gameState1.general.multiplayerChecksumB, gameState2.general.multiplayerChecksumB);
         foundDivergence |= isLoggedDivergentGameStateField("defaultBuildVehicleType", 0, gameState1.general.defaultBuildVehicleType, gameState2.general.defaultBuildVehicleType);
         foundDivergence |= isLoggedDivergentGameStateField("numberOfIndustries", 0, gameState1.general.numberOfIndustries, gameState2.general.numberOfIndustries);
         foundDivergence |= isLoggedDivergentGameStateField("vehiclePreviewRotationFrame", 0, gameState1.general.vehiclePreviewRotationFrame, gameState2.general.vehiclePreviewRotationFrame);
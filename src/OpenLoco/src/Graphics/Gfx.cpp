@@ -20,13 +20,15 @@
 #include "Ui.h"
 #include "Ui/WindowManager.h"
 #include <OpenLoco/Core/Exception.hpp>
+#include <OpenLoco/Core/MemoryMappedFile.h>
 #include <OpenLoco/Core/Stream.hpp>
 #include <algorithm>
 #include <cassert>
-#include <fstream>
+#include <cstring>
 #include <iostream>
 #include <memory>
 #include <numeric>
+#include <span>
 
 using namespace OpenLoco::Utility;
 using namespace OpenLoco::Gfx;
@@ -38,7 +40,8 @@ namespace OpenLoco::Gfx
     // 0x009E2424
     static std::array<G1Element, G1ExpectedCount::kDisc + G1ExpectedCount::kTemporaryObjects + G1ExpectedCount::kObjects> _g1Elements;
 
-    static std::unique_ptr<std::byte[]> _g1Buffer;
+    // Pixel data is only paged in when a sprite is first drawn
+    static MemoryMappedFile _g1File;
 
     // 0x0112C884
     static std::array<std::array<uint8_t, 224>, 4> _characterWidths;
@@ -59,7 +62,7 @@ namespace OpenLoco::Gfx
         }
     }
 
-    static std::vector<G1Element> convertElements(const std::vector<G1Element32>& elements32)
+    static std::vector<G1Element> convertElements(std::span<const G1Element32> elements32)
     {
         auto elements = std::vector<G1Element>();
         elements.reserve(elements32.size());
@@ -75,17 +78,20 @@ namespace OpenLoco::Gfx
     void loadG1()
     {
         auto g1Path = Environment::getPath(Environment::PathId::g1);
-        std::ifstream stream(g1Path, std::ios::in | std::ios::binary);
-        if (!stream)
+        MemoryMappedFile file;
+        if (!file.open(g1Path))
         {
             throw Exception::RuntimeError("Opening g1 file failed.");
         }
+        auto remainingData = file.getData();
 
         G1Header header;
-        if (!readData(stream, header))
+        if (remainingData.size() < sizeof(header))
         {
             throw Exception::RuntimeError("Reading g1 file header failed.");
         }
+        std::memcpy(&header, remainingData.data(), sizeof(header));
+        remainingData = remainingData.subspan(sizeof(header));
 
         if (header.numEntries != G1ExpectedCount::kDisc)
         {
@@ -99,21 +105,23 @@ namespace OpenLoco::Gfx
             }
         }
 
-        // Read element headers
-        auto elements32 = std::vector<G1Element32>(header.numEntries);
-        if (!readData(stream, elements32.data(), header.numEntries))
+        // Convert element headers, these are small and all needed up front
+        const auto elementsSize = static_cast<size_t>(header.numEntries) * sizeof(G1Element32);
+        if (remainingData.size() < elementsSize)
         {
             throw Exception::RuntimeError("Reading g1 element headers failed.");
         }
+        std::vector<G1Element32> elements32(header.numEntries);
+        std::memcpy(elements32.data(), remainingData.data(), elementsSize);
         auto elements = convertElements(elements32);
+        remainingData = remainingData.subspan(elementsSize);
 
-        // Read element data
-        auto elementData = std::make_unique<std::byte[]>(header.totalSize);
-        if (!readData(stream, elementData.get(), header.totalSize))
+        // Element data stays in the mapping
+        if (remainingData.size() < header.totalSize)
         {
             throw Exception::RuntimeError("Reading g1 elements failed.");
         }
-        stream.close();
+        auto* elementData = reinterpret_cast<std::uint8_t*>(remainingData.data());
 
         // The steam G1.DAT is missing two localised tutorial icons, and a smaller font variant
         // This code copies the closest variants into their place, and moves other elements accordingly
@@ -151,10 +159,10 @@ namespace OpenLoco::Gfx
         // Adjust memory offsets
         for (auto& element : elements)
         {
-            element.offset = reinterpret_cast<std::uint8_t*>(elementData.get()) + element.offset32;
+            element.offset = elementData + element.offset32;
         }
 
-        _g1Buffer = std::move(elementData);
+        _g1File = std::move(file);
         std::copy(elements.begin(), elements.end(), _g1Elements.begin());
     }
 
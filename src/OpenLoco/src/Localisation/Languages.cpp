@@ -10,14 +10,14 @@
 
 namespace OpenLoco::Localisation
 {
+    static const LanguageDescriptor kUndefinedLanguage = { "", "", "", LocoLanguageId::english_uk };
     static std::vector<LanguageDescriptor> _languageDescriptors;
 
     void enumerateLanguages()
     {
         // (Re-)initialise the languages table.
         _languageDescriptors.clear();
-        LanguageDescriptor undefinedLanguage = { "", "", "", LocoLanguageId::english_uk };
-        _languageDescriptors.emplace_back(undefinedLanguage);
+        _languageDescriptors.emplace_back(kUndefinedLanguage);
 
         // Search the languages dir for YAML language files.
         fs::path languageDir = Environment::getPath(Environment::PathId::languageFiles);
@@ -80,6 +80,11 @@ namespace OpenLoco::Localisation
             return *it;
         }
 
+        // Nothing has been enumerated when running without the game data, e.g. in the tests
+        if (_languageDescriptors.empty())
+        {
+            return kUndefinedLanguage;
+        }
         return _languageDescriptors[0];
     }
 }
@@ -117,6 +117,7 @@ namespace OpenLoco::Diagnostics::Logging
 
     void shutdown()
     {
+        Logging::flush();
         Logging::removeSink(_fileLogSink);
         Logging::removeSink(_terminalLogSink);
     }
@@ -15,6 +15,7 @@
 #include "Map/TileManager.h"
 #include "Map/Tree.h"
 #include "Map/TreeElement.h"
+#include "Map/WaterRegions.h"
 #include "Objects/BuildingObject.h"
 #include "Objects/HillShapesObject.h"
 #include "Objects/IndustryObject.h"
@@ -26,8 +27,11 @@
 #include "Ui/ProgressBar.h"
 #include "Ui/WindowManager.h"
 #include "World/TownManager.h"
+#include <algorithm>
 #include <cassert>
 #include <cstdint>
+#include <execution>
+#include <numeric>
 #include <random>
 #include <vector>
 
@@ -42,6 +46,7 @@ namespace OpenLoco::World::MapGenerator
     static constexpr auto kMountainTerrainHeight = 26;
 
     static fs::path _pngHeightmapPath{};
+    static bool _parallelPasses = true;
 
     static void updateProgress(uint8_t value)
     {
@@ -49,6 +54,51 @@ namespace OpenLoco::World::MapGenerator
         Ui::ProgressBar::setProgress(value);
     }
 
+    // Number of rows of tiles processed together by the per-tile passes
+    static constexpr auto kStripHeight = 16;
+
+    // Runs func in parallel over the drawable tiles split into strips of kStripHeight rows.
+    // The strips only depend on the map size, not on the number of threads, so anything
+    // derived from the strip index (see getStripPrng) is the same on every machine.
+    template<typename Func>
+    static void forEachDrawableStrip(Func&& func)
+    {
+        static constexpr auto kFirstRow = 1;
+        static constexpr auto kLastRow = kMapRows - 2;
+        static constexpr auto kNumStrips = (kLastRow - kFirstRow + kStripHeight) / kStripHeight;
+
+        std::array<uint32_t, kNumStrips> strips;
+        std::iota(strips.begin(), strips.end(), 0);
+        const auto runStrip = [&func](uint32_t strip) {
+            const auto firstRow = kFirstRow + strip * kStripHeight;
+            const auto lastRow = std::min<int32_t>(firstRow + kStripHeight - 1, kLastRow);
+            func(strip, TilePosRangeView({ 1, static_cast<tile_coord_t>(firstRow) }, { kMapColumns - 2, static_cast<tile_coord_t>(lastRow) }));
+        };
+        if (_parallelPasses)
+        {
+            std::for_each(std::execution::par, strips.begin(), strips.end(), runStrip);
+        }
+        else
+        {
+            std::for_each(strips.begin(), strips.end(), runStrip);
+        }
+    }
+
+    // Random number generator for one strip of a pass, seeded from a single draw of the
+    // game rng so the whole pass still only advances the global state by one step.
+    static Core::Prng getStripPrng(uint32_t seed, uint32_t strip)
+    {
+        auto mix = [](uint32_t x) {
+            x ^= x >> 16;
+            x *= 0x7FEB352DU;
+            x ^= x >> 15;
+            x *= 0x846CA68BU;
+            x ^= x >> 16;
+            return x;
+        };
+        return Core::Prng(mix(seed + strip), mix(seed ^ (strip * 0x9E3779B9U)));
+    }
+
     // 0x004624F0
     static void generateHeightMap(const Scenario::Options& options, HeightMap& heightMap)
     {
@@ -147,67 +197,69 @@ namespace OpenLoco::World::MapGenerator
     // 0x004625D0
     static void generateLand(HeightMap& heightMap)
     {
-        for (auto& pos : World::getDrawableTileRange())
-        {
-            const MicroZ q00 = heightMap[pos + TilePos2{ -1, -1 }];
-            const MicroZ q01 = heightMap[pos + TilePos2{ 0, -1 }];
-            const MicroZ q10 = heightMap[pos + TilePos2{ -1, 0 }];
-            const MicroZ q11 = heightMap[pos + TilePos2{ 0, 0 }];
-
-            const auto tile = TileManager::get(pos);
-            auto* surfaceElement = tile.surface();
-            if (surfaceElement == nullptr)
+        forEachDrawableStrip([&heightMap](uint32_t, const TilePosRangeView& strip) {
+            for (auto& pos : strip)
             {
-                continue;
-            }
+                const MicroZ q00 = heightMap[pos + TilePos2{ -1, -1 }];
+                const MicroZ q01 = heightMap[pos + TilePos2{ 0, -1 }];
+                const MicroZ q10 = heightMap[pos + TilePos2{ -1, 0 }];
+                const MicroZ q11 = heightMap[pos + TilePos2{ 0, 0 }];
+
+                const auto tile = TileManager::get(pos);
+                auto* surfaceElement = tile.surface();
+                if (surfaceElement == nullptr)
+                {
+                    continue;
+                }
 
-            const MicroZ baseHeight = std::min({ q00, q01, q10, q11 });
-            surfaceElement->setBaseZ(baseHeight * kMicroToSmallZStep);
+                const MicroZ baseHeight = std::min({ q00, q01, q10, q11 });
+                surfaceElement->setBaseZ(baseHeight * kMicroToSmallZStep);
 
-            uint8_t currentSlope = SurfaceSlope::flat;
+                uint8_t currentSlope = SurfaceSlope::flat;
 
-            // First, figure out basic corner style
-            if (q00 > baseHeight)
-            {
-                currentSlope |= SurfaceSlope::CornerUp::south;
-            }
-            if (q01 > baseHeight)
-            {
-                currentSlope |= SurfaceSlope::CornerUp::east;
-            }
-            if (q10 > baseHeight)
-            {
-                currentSlope |= SurfaceSlope::CornerUp::west;
-            }
-            if (q11 > baseHeight)
-            {
-                currentSlope |= SurfaceSlope::CornerUp::north;
-            }
+                // First, figure out basic corner style
+                if (q00 > baseHeight)
+                {
+                    currentSlope |= SurfaceSlope::CornerUp::south;
+                }
+                if (q01 > baseHeight)
+                {
+                    currentSlope |= SurfaceSlope::CornerUp::east;
+                }
+                if (q10 > baseHeight)
+                {
+                    currentSlope |= SurfaceSlope::CornerUp::west;
+                }
+                if (q11 > baseHeight)
+                {
+                    currentSlope |= SurfaceSlope::CornerUp::north;
+                }
 
-            // Now, deduce if we should go for double height
-            // clang-format off
-            if ((currentSlope == SurfaceSlope::CornerDown::north && q00 - baseHeight >= 2) ||
-                (currentSlope == SurfaceSlope::CornerDown::west  && q01 - baseHeight >= 2) ||
-                (currentSlope == SurfaceSlope::CornerDown::east  && q10 - baseHeight >= 2) ||
-                (currentSlope == SurfaceSlope::CornerDown::south && q11 - baseHeight >= 2))
-            {
-                currentSlope |= SurfaceSlope::doubleHeight;
-            }
-            // clang-format on
+                // Now, deduce if we should go for double height
+                // clang-format off
+                if ((currentSlope == SurfaceSlope::CornerDown::north && q00 - baseHeight >= 2) ||
+                    (currentSlope == SurfaceSlope::CornerDown::west  && q01 - baseHeight >= 2) ||
+                    (currentSlope == SurfaceSlope::CornerDown::east  && q10 - baseHeight >= 2) ||
+                    (currentSlope == SurfaceSlope::CornerDown::south && q11 - baseHeight >= 2))
+                {
+                    currentSlope |= SurfaceSlope::doubleHeight;
+                }
+                // clang-format on
 
-            surfaceElement->setSlope(currentSlope);
+                surfaceElement->setSlope(currentSlope);
 
-            auto clearZ = surfaceElement->baseZ();
-            if (surfaceElement->slopeCorners())
-            {
-                clearZ += kSmallZStep;
-            }
-            if (surfaceElement->isSlopeDoubleHeight())
-            {
-                clearZ += kSmallZStep;
+                auto clearZ = surfaceElement->baseZ();
+                if (surfaceElement->slopeCorners())
+                {
+                    clearZ += kSmallZStep;
+                }
+                if (surfaceElement->isSlopeDoubleHeight())
+                {
+                    clearZ += kSmallZStep;
+                }
+                surfaceElement->setClearZ(clearZ);
             }
-            surfaceElement->setClearZ(clearZ);
-        }
+        });
     }
 
     // 0x004C4BD7
@@ -215,16 +267,25 @@ namespace OpenLoco::World::MapGenerator
     {
         auto seaLevel = getGameState().seaLevel;
 
-        for (auto& pos : World::getDrawableTileRange())
-        {
-            auto tile = TileManager::get(pos);
-            auto* surface = tile.surface();
-
-            if (surface != nullptr && surface->baseZ() < (seaLevel << 2))
+        forEachDrawableStrip([seaLevel](uint32_t, const TilePosRangeView& strip) {
+            for (auto& pos : strip)
             {
-                surface->setWater(seaLevel);
+                auto tile = TileManager::get(pos);
+                auto* surface = tile.surface();
+
+                if (surface != nullptr && surface->baseZ() < (seaLevel << 2))
+                {
+                    surface->setWater(seaLevel);
+                }
             }
-        }
+        });
+        WaterRegions::reset();
+    }
+
+    void generateSurface(HeightMap& heightMap)
+    {
+        generateLand(heightMap);
+        generateWater(heightMap);
     }
 
     static std::optional<uint8_t> getEverywhereSurfaceStyle()
@@ -250,6 +311,11 @@ namespace OpenLoco::World::MapGenerator
 
     // 0x00469FC8
     std::optional<uint8_t> getRandomTerrainVariation(const SurfaceElement& surface)
+    {
+        return getRandomTerrainVariation(surface, gPrng1());
+    }
+
+    std::optional<uint8_t> getRandomTerrainVariation(const SurfaceElement& surface, Core::Prng& rng)
     {
         if (surface.water())
         {
@@ -272,7 +338,7 @@ namespace OpenLoco::World::MapGenerator
         }
 
         // TODO: split into two randNext calls
-        uint16_t randVal = gPrng1().randNext();
+        uint16_t randVal = rng.randNext();
         if (landObj->variationLikelihood <= (randVal >> 8))
         {
             return 0;
@@ -282,28 +348,32 @@ namespace OpenLoco::World::MapGenerator
 
     static void applySurfaceStyleToMarkedTiles(HeightMap& heightMap, uint8_t surfaceStyle, bool requireMark)
     {
-        for (auto& pos : World::getDrawableTileRange())
-        {
-            const bool tileIsMarked = heightMap.isMarkerSet({ pos.x, pos.y });
-            if (requireMark != tileIsMarked)
+        const auto seed = gPrng1().randNext();
+        forEachDrawableStrip([&heightMap, surfaceStyle, requireMark, seed](uint32_t stripIndex, const TilePosRangeView& strip) {
+            auto rng = getStripPrng(seed, stripIndex);
+            for (auto& pos : strip)
             {
-                continue;
-            }
+                const bool tileIsMarked = heightMap.isMarkerSet({ pos.x, pos.y });
+                if (requireMark != tileIsMarked)
+                {
+                    continue;
+                }
 
-            auto tile = TileManager::get(pos);
-            auto* surface = tile.surface();
-            if (surface == nullptr)
-            {
-                continue;
-            }
+                auto tile = TileManager::get(pos);
+                auto* surface = tile.surface();
+                if (surface == nullptr)
+                {
+                    continue;
+                }
 
-            surface->setTerrain(surfaceStyle);
-            auto res = getRandomTerrainVariation(*surface);
-            if (res)
-            {
-                surface->setVariation(*res);
+                surface->setTerrain(surfaceStyle);
+                auto res = getRandomTerrainVariation(*surface, rng);
+                if (res)
+                {
+                    surface->setVariation(*res);
+                }
             }
-        }
+        });
     }
 
     // 0x0046A379
@@ -518,23 +588,26 @@ namespace OpenLoco::World::MapGenerator
             return;
         }
 
-        const TilePosRangeView tileLoop = getDrawableTileRange();
-        for (const auto& tilePos : tileLoop)
-        {
-            auto* surface = World::TileManager::get(tilePos).surface();
-            if (surface == nullptr)
+        const auto seed = gPrng1().randNext();
+        forEachDrawableStrip([style = *style, seed](uint32_t stripIndex, const TilePosRangeView& strip) {
+            auto rng = getStripPrng(seed, stripIndex);
+            for (const auto& tilePos : strip)
             {
-                continue;
-            }
-            surface->setTerrain(*style);
-            surface->setGrowthStage(0);
+                auto* surface = World::TileManager::get(tilePos).surface();
+                if (surface == nullptr)
+                {
+                    continue;
+                }
+                surface->setTerrain(style);
+                surface->setGrowthStage(0);
 
-            const auto variation = getRandomTerrainVariation(*surface);
-            if (variation.has_value())
-            {
-                surface->setVariation(*variation);
+                const auto variation = getRandomTerrainVariation(*surface, rng);
+                if (variation.has_value())
+                {
+                    surface->setVariation(*variation);
+                }
             }
-        }
+        });
 
         constexpr std::array landDistributionPatterns = {
             Scenario::LandDistributionPattern::farFromWater,
@@ -573,52 +646,55 @@ namespace OpenLoco::World::MapGenerator
     // 0x004611DF
     static void generateSurfaceVariation()
     {
-        for (auto& pos : World::getDrawableTileRange())
-        {
-            auto tile = TileManager::get(pos);
-            auto* surface = tile.surface();
+        const auto snowLine = Scenario::getCurrentSnowLine() / kMicroToSmallZStep;
 
-            if (surface == nullptr)
+        forEachDrawableStrip([snowLine](uint32_t, const TilePosRangeView& strip) {
+            for (auto& pos : strip)
             {
-                continue;
-            }
+                auto tile = TileManager::get(pos);
+                auto* surface = tile.surface();
 
-            if (!surface->isIndustrial())
-            {
-                auto* landObj = ObjectManager::get<LandObject>(surface->terrain());
-                if (landObj->hasFlags(LandObjectFlags::hasGrowthStages))
+                if (surface == nullptr)
                 {
-                    bool setVariation = false;
-                    if (surface->water())
+                    continue;
+                }
+
+                if (!surface->isIndustrial())
+                {
+                    auto* landObj = ObjectManager::get<LandObject>(surface->terrain());
+                    if (landObj->hasFlags(LandObjectFlags::hasGrowthStages))
                     {
-                        auto waterBaseZ = surface->water() * kMicroToSmallZStep;
-                        if (surface->slope())
+                        bool setVariation = false;
+                        if (surface->water())
                         {
-                            waterBaseZ -= 4;
-                        }
+                            auto waterBaseZ = surface->water() * kMicroToSmallZStep;
+                            if (surface->slope())
+                            {
+                                waterBaseZ -= 4;
+                            }
 
-                        if (waterBaseZ > surface->baseZ())
-                        {
-                            if (surface->terrain() != 0)
+                            if (waterBaseZ > surface->baseZ())
                             {
-                                surface->setGrowthStage(0);
-                                setVariation = true;
+                                if (surface->terrain() != 0)
+                                {
+                                    surface->setGrowthStage(0);
+                                    setVariation = true;
+                                }
                             }
                         }
-                    }
 
-                    if (!setVariation)
-                    {
-                        surface->setGrowthStage(landObj->numGrowthStages - 1);
+                        if (!setVariation)
+                        {
+                            surface->setGrowthStage(landObj->numGrowthStages - 1);
+                        }
                     }
                 }
-            }
 
-            auto snowLine = Scenario::getCurrentSnowLine() / kMicroToSmallZStep;
-            MicroZ baseMicroZ = (surface->baseZ() / kMicroToSmallZStep) + 1;
-            auto unk = std::clamp(baseMicroZ - snowLine, 0, 5);
-            surface->setSnowCoverage(unk);
-        }
+                MicroZ baseMicroZ = (surface->baseZ() / kMicroToSmallZStep) + 1;
+                auto unk = std::clamp(baseMicroZ - snowLine, 0, 5);
+                surface->setSnowCoverage(unk);
+            }
+        });
     }
 
     // 0x004BE0C7
@@ -626,25 +702,39 @@ namespace OpenLoco::World::MapGenerator
     {
         auto currentSeason = getGameState().currentSeason;
 
-        for (auto& pos : World::getDrawableTileRange())
-        {
-            auto tile = TileManager::get(pos);
-            for (auto& el : tile)
+        // Only tiles with trees need visiting, which is a small part of the map even after forests are placed.
+        // The tiles are in map order so the ones in each strip's rows are next to each other.
+        const auto treeTiles = TileManager::getTilesWithElement<TreeElement>();
+        forEachDrawableStrip([&treeTiles, currentSeason](uint32_t, const TilePosRangeView& strip) {
+            const TilePos2 stripStart = *strip.begin();
+            const TilePos2 stripEnd = *strip.end();
+            const auto first = std::ranges::lower_bound(treeTiles, stripStart, TileManager::isBeforeInMapOrder);
+            const auto last = std::ranges::lower_bound(first, treeTiles.end(), stripEnd, TileManager::isBeforeInMapOrder);
+            for (auto it = first; it != last; ++it)
             {
-                auto* treeEl = el.as<TreeElement>();
-                if (treeEl == nullptr)
+                if (it->x < 1 || it->x > kMapColumns - 2)
                 {
                     continue;
                 }
 
-                if (treeEl->season() < 4 && !treeEl->isDying())
+                auto tile = TileManager::get(*it);
+                for (auto& el : tile)
                 {
-                    treeEl->setSeason(enumValue(currentSeason));
-                    treeEl->setUnk7l(0x7);
+                    auto* treeEl = el.as<TreeElement>();
+                    if (treeEl == nullptr)
+                    {
+                        continue;
+                    }
+
+                    if (treeEl->season() < 4 && !treeEl->isDying())
+                    {
+                        treeEl->setSeason(enumValue(currentSeason));
+                        treeEl->setUnk7l(0x7);
+                    }
+                    break;
                 }
-                break;
             }
-        }
+        });
     }
 
     // 0x004BDA49
@@ -1102,10 +1192,7 @@ namespace OpenLoco::World::MapGenerator
             generateRivers(options, heightMap);
             updateProgress(30);
 
-            generateLand(heightMap);
-            updateProgress(35);
-
-            generateWater(heightMap);
+            generateSurface(heightMap);
             updateProgress(45);
 
             generateTerrain(heightMap);
@@ -1147,4 +1234,9 @@ namespace OpenLoco::World::MapGenerator
     {
         return _pngHeightmapPath;
     }
+
+    void setParallelPasses(bool enabled)
+    {
+        _parallelPasses = enabled;
+    }
 }
@@ -1,7 +1,11 @@
 #include "Map/MapGenerator/SimplexTerrainGenerator.h"
 #include "Scenario/ScenarioOptions.h"
+#include "SceneManager.h"
 #include "Ui/ProgressBar.h"
 #include <algorithm>
+#include <execution>
+#include <numeric>
+#include <vector>
 
 namespace OpenLoco::World::MapGenerator
 {
@@ -59,26 +63,45 @@ namespace OpenLoco::World::MapGenerator
     void SimplexTerrainGenerator::generate(const SimplexSettings& settings, HeightMapRange heightMap)
     {
         generateSimplex(settings, heightMap);
-        Ui::ProgressBar::setProgress(15);
+        updateProgress(15);
 
         smooth(settings.smooth, heightMap);
     }
 
+    void SimplexTerrainGenerator::updateProgress(uint8_t value)
+    {
+        // The generator can also be run without the map generator's progress bar
+        if (SceneManager::isProgressBarActive())
+        {
+            Ui::ProgressBar::setProgress(value);
+        }
+    }
+
     void SimplexTerrainGenerator::generateSimplex(const SimplexSettings& settings, HeightMapRange heightMap)
     {
         auto freq = settings.baseFreq * (1.0f / std::max(heightMap.width, heightMap.height));
         uint8_t perm[512];
         noise(perm, std::size(perm));
-        for (int32_t y = 0; y < heightMap.height; y++)
-        {
-            for (int32_t x = 0; x < heightMap.width; x++)
+
+        // Rows only read from perm so can be sampled in any order
+        std::vector<int32_t> rows(heightMap.height);
+        std::iota(rows.begin(), rows.end(), 0);
+        std::for_each(std::execution::par, rows.begin(), rows.end(), [&](int32_t y) {
+            for (int32_t x = 0; x < heightMap.width; x += kNoiseLanes)
             {
-                auto noiseValue = std::clamp(noiseFractal(perm, x, y, freq, settings.octaves, 2.0f, 0.65f), -1.0f, 1.0f);
-                auto normalisedNoiseValue = (noiseValue + 1.0f) / 2.0f;
-                auto height = settings.low + static_cast<int32_t>(normalisedNoiseValue * settings.high);
-                heightMap[TilePos2(x, y)] = height;
+                float noiseValues[kNoiseLanes];
+                noiseFractal(perm, x, y, freq, settings.octaves, 2.0f, 0.65f, noiseValues);
+
+                const auto count = std::min(kNoiseLanes, heightMap.width - x);
+                for (int32_t i = 0; i < count; i++)
+                {
+                    auto noiseValue = std::clamp(noiseValues[i], -1.0f, 1.0f);
+                    auto normalisedNoiseValue = (noiseValue + 1.0f) / 2.0f;
+                    auto height = settings.low + static_cast<int32_t>(normalisedNoiseValue * settings.high);
+                    heightMap[TilePos2(x + i, y)] = height;
+                }
             }
-        }
+        });
     }
 
     void SimplexTerrainGenerator::smooth(int32_t iterations, HeightMapRange heightMap)
@@ -91,127 +114,139 @@ namespace OpenLoco::World::MapGenerator
         const auto progressSteps = (25 - 15) / iterations;
         auto currentProgress = 15;
 
+        // Each cell is the average of the 3x3 block around it, updated in place so the cells above and
+        // to the left are already smoothed. The block is summed as three column sums: a row's column
+        // sums are taken once, and each one is corrected when the cell in its middle is smoothed.
+        std::vector<int32_t> columnSums(heightMap.height);
         for (int32_t i = 0; i < iterations; i++)
         {
-            auto copyHeight = heightMap;
             for (int32_t y = 1; y < heightMap.width - 1; y++)
             {
+                for (int32_t x = 0; x < heightMap.height; x++)
+                {
+                    columnSums[x] = heightMap[TilePos2(x, y - 1)] + heightMap[TilePos2(x, y)] + heightMap[TilePos2(x, y + 1)];
+                }
                 for (int32_t x = 1; x < heightMap.height - 1; x++)
                 {
-                    int32_t total = 0;
-                    for (int32_t yy = -1; yy <= 1; yy++)
-                    {
-                        for (int32_t xx = -1; xx <= 1; xx++)
-                        {
-                            total += copyHeight[TilePos2(x + xx, y + yy)];
-                        }
-                    }
-                    heightMap[TilePos2(x, y)] = total / 9;
+                    auto& cell = heightMap[TilePos2(x, y)];
+                    const auto smoothed = static_cast<uint8_t>((columnSums[x - 1] + columnSums[x] + columnSums[x + 1]) / 9);
+                    columnSums[x] += smoothed - cell;
+                    cell = smoothed;
                 }
             }
 
             currentProgress += progressSteps;
-            Ui::ProgressBar::setProgress(currentProgress);
+            updateProgress(currentProgress);
         }
     }
 
-    float SimplexTerrainGenerator::noiseFractal(uint8_t* perm, int32_t x, int32_t y, float frequency, int32_t octaves, float lacunarity, float persistence)
+    void SimplexTerrainGenerator::noiseFractal(const uint8_t* perm, int32_t x, int32_t y, float frequency, int32_t octaves, float lacunarity, float persistence, float* out)
     {
-        float total = 0.0f;
+        float total[kNoiseLanes] = {};
         float amplitude = persistence;
         for (int32_t i = 0; i < octaves; i++)
         {
-            total += generateNoise(perm, x * frequency, y * frequency) * amplitude;
+            float xs[kNoiseLanes];
+            for (int32_t lane = 0; lane < kNoiseLanes; lane++)
+            {
+                xs[lane] = (x + lane) * frequency;
+            }
+
+            float noise[kNoiseLanes];
+            generateNoise(perm, xs, y * frequency, noise);
+            for (int32_t lane = 0; lane < kNoiseLanes; lane++)
+            {
+                total[lane] += noise[lane] * amplitude;
+            }
             frequency *= lacunarity;
             amplitude *= persistence;
         }
-        return total;
+        std::copy_n(total, kNoiseLanes, out);
     }
 
-    float SimplexTerrainGenerator::generateNoise(uint8_t* perm, float x, float y)
+    // 2D simplex noise for kNoiseLanes points on the same row. The loops have no branches and
+    // the lanes do not depend on each other so the compiler can vectorise them. Every float
+    // operation is done in the same order as the original per cell implementation, so the
+    // results are bit-identical to it.
+    void SimplexTerrainGenerator::generateNoise(const uint8_t* perm, const float* x, float y, float* out)
     {
-        const float F2 = 0.366025403f; // F2 = 0.5*(sqrt(3.0)-1.0)
-        const float G2 = 0.211324865f; // G2 = (3.0-sqrt(3.0))/6.0
-
-        float n0, n1, n2; // Noise contributions from the three corners
-
-        // Skew the input space to determine which simplex cell we're in
-        float s = (x + y) * F2; // Hairy factor for 2D
-        float xs = x + s;
-        float ys = y + s;
-        int32_t i = fastFloor(xs);
-        int32_t j = fastFloor(ys);
-
-        float t = static_cast<float>(i + j) * G2;
-        float X0 = i - t; // Unskew the cell origin back to (x,y) space
-        float Y0 = j - t;
-        float x0 = x - X0; // The x,y distances from the cell origin
-        float y0 = y - Y0;
-
-        // For the 2D case, the simplex shape is an equilateral triangle.
-        // Determine which simplex we are in.
-        int32_t i1, j1; // Offsets for second (middle) corner of simplex in (i,j) coords
-        if (x0 > y0)
-        {
-            i1 = 1;
-            j1 = 0;
-        } // lower triangle, XY order: (0,0)->(1,0)->(1,1)
-        else
-        {
-            i1 = 0;
-            j1 = 1;
-        } // upper triangle, YX order: (0,0)->(0,1)->(1,1)
-
-        // A step of (1,0) in (i,j) means a step of (1-c,-c) in (x,y), and
-        // a step of (0,1) in (i,j) means a step of (-c,1-c) in (x,y), where
-        // c = (3-sqrt(3))/6
-
-        float x1 = x0 - i1 + G2; // Offsets for middle corner in (x,y) unskewed coords
-        float y1 = y0 - j1 + G2;
-        float x2 = x0 - 1.0f + 2.0f * G2; // Offsets for last corner in (x,y) unskewed coords
-        float y2 = y0 - 1.0f + 2.0f * G2;
-
-        // Wrap the integer indices at 256, to avoid indexing perm[] out of bounds
-        int32_t ii = i % 256;
-        int32_t jj = j % 256;
-
-        // Calculate the contribution from the three corners
-        float t0 = 0.5f - x0 * x0 - y0 * y0;
-        if (t0 < 0.0f)
-        {
-            n0 = 0.0f;
-        }
-        else
-        {
-            t0 *= t0;
-            n0 = t0 * t0 * grad(perm[ii + perm[jj]], x0, y0);
-        }
+        constexpr float F2 = 0.366025403f; // F2 = 0.5*(sqrt(3.0)-1.0)
+        constexpr float G2 = 0.211324865f; // G2 = (3.0-sqrt(3.0))/6.0
 
-        float t1 = 0.5f - x1 * x1 - y1 * y1;
-        if (t1 < 0.0f)
-        {
-            n1 = 0.0f;
-        }
-        else
+        // The x,y distances from the three corners of the simplex cell
+        float x0[kNoiseLanes], y0[kNoiseLanes];
+        float x1[kNoiseLanes], y1[kNoiseLanes];
+        float x2[kNoiseLanes], y2[kNoiseLanes];
+        int32_t ii[kNoiseLanes], jj[kNoiseLanes], i1[kNoiseLanes];
+
+        for (int32_t lane = 0; lane < kNoiseLanes; lane++)
         {
-            t1 *= t1;
-            n1 = t1 * t1 * grad(perm[ii + i1 + perm[jj + j1]], x1, y1);
+            // Skew the input space to determine which simplex cell we're in
+            const float s = (x[lane] + y) * F2;
+            const float xs = x[lane] + s;
+            const float ys = y + s;
+
+            // NB: not a true floor, whole numbers <= 0 are rounded down by one more
+            const int32_t i = static_cast<int32_t>(xs) - (xs > 0 ? 0 : 1);
+            const int32_t j = static_cast<int32_t>(ys) - (ys > 0 ? 0 : 1);
+
+            const float t = static_cast<float>(i + j) * G2;
+            const float X0 = i - t; // Unskew the cell origin back to (x,y) space
+            const float Y0 = j - t;
+            x0[lane] = x[lane] - X0;
+            y0[lane] = y - Y0;
+
+            // Offsets for the middle corner, (1,0) in the lower triangle and (0,1) in the upper
+            i1[lane] = x0[lane] > y0[lane] ? 1 : 0;
+            const int32_t j1 = 1 - i1[lane];
+
+            x1[lane] = x0[lane] - i1[lane] + G2;
+            y1[lane] = y0[lane] - j1 + G2;
+            x2[lane] = x0[lane] - 1.0f + 2.0f * G2;
+            y2[lane] = y0[lane] - 1.0f + 2.0f * G2;
+
+            ii[lane] = i % 256;
+            jj[lane] = j % 256;
         }
 
-        float t2 = 0.5f - x2 * x2 - y2 * y2;
-        if (t2 < 0.0f)
+        // Gradient hashes. The mask keeps the lookups in bounds for corners that end up
+        // not contributing, it does not change the index of those that do.
+        uint8_t h0[kNoiseLanes], h1[kNoiseLanes], h2[kNoiseLanes];
+        for (int32_t lane = 0; lane < kNoiseLanes; lane++)
         {
-            n2 = 0.0f;
+            const auto i = ii[lane];
+            const auto j = jj[lane];
+            const auto j1 = 1 - i1[lane];
+            h0[lane] = perm[(i + perm[j & 511]) & 511];
+            h1[lane] = perm[(i + i1[lane] + perm[(j + j1) & 511]) & 511];
+            h2[lane] = perm[(i + 1 + perm[(j + 1) & 511]) & 511];
         }
-        else
+
+        auto grad = [](int32_t hash, float gx, float gy) {
+            const int32_t h = hash & 7;    // Convert low 3 bits of hash code
+            const float u = h < 4 ? gx : gy; // into 8 simple gradient directions,
+            const float v = h < 4 ? gy : gx; // and compute the dot product with (x,y).
+            return ((h & 1) != 0 ? -u : u) + ((h & 2) != 0 ? -2.0f * v : 2.0f * v);
+        };
+
+        auto contribution = [&grad](int32_t hash, float cx, float cy) {
+            float t = 0.5f - cx * cx - cy * cy;
+            const bool outside = t < 0.0f;
+            t *= t;
+            const float n = t * t * grad(hash, cx, cy);
+            return outside ? 0.0f : n;
+        };
+
+        for (int32_t lane = 0; lane < kNoiseLanes; lane++)
         {
-            t2 *= t2;
-            n2 = t2 * t2 * grad(perm[ii + 1 + perm[jj + 1]], x2, y2);
-        }
+            const float n0 = contribution(h0[lane], x0[lane], y0[lane]);
+            const float n1 = contribution(h1[lane], x1[lane], y1[lane]);
+            const float n2 = contribution(h2[lane], x2[lane], y2[lane]);
 
-        // Add contributions from each corner to get the final noise value.
-        // The result is scaled to return values in the interval [-1,1].
-        return 40.0f * (n0 + n1 + n2); // TODO: The scale factor is preliminary!
+            // Add contributions from each corner to get the final noise value.
+            // The result is scaled to return values in the interval [-1,1].
+            out[lane] = 40.0f * (n0 + n1 + n2); // TODO: The scale factor is preliminary!
+        }
     }
 
     void SimplexTerrainGenerator::noise(uint8_t* perm, size_t len)
@@ -222,19 +257,6 @@ namespace OpenLoco::World::MapGenerator
         }
     }
 
-    float SimplexTerrainGenerator::grad(int32_t hash, float x, float y)
-    {
-        int32_t h = hash & 7;    // Convert low 3 bits of hash code
-        float u = h < 4 ? x : y; // into 8 simple gradient directions,
-        float v = h < 4 ? y : x; // and compute the dot product with (x,y).
-        return ((h & 1) != 0 ? -u : u) + ((h & 2) != 0 ? -2.0f * v : 2.0f * v);
-    }
-
-    int32_t SimplexTerrainGenerator::fastFloor(float x)
-    {
-        return (x > 0) ? (static_cast<int32_t>(x)) : ((static_cast<int32_t>(x)) - 1);
-    }
-
     uint32_t SimplexTerrainGenerator::randomNext()
     {
         return _pprng();
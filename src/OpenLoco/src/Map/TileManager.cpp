@@ -2,7 +2,7 @@
 #include "Audio/Audio.h"
 #include "Economy/Economy.h"
 #include "Effects/Effect.h"
-#include "Effects/ExplosionSmokeEffect.h"
+#include "Effects/ParticleManager.h"
 #include "Game.h"
 #include "GameCommands/GameCommands.h"
 #include "GameState.h"
@@ -21,6 +21,7 @@
 #include "Map/TrackElement.h"
 #include "Map/TreeElement.h"
 #include "Map/WallElement.h"
+#include "Map/WaterRegions.h"
 #include "Objects/BridgeObject.h"
 #include "Objects/BuildingObject.h"
 #include "Objects/LandObject.h"
@@ -60,6 +61,23 @@ namespace OpenLoco::World::TileManager
     static uint32_t _periodicDefragStartTile;
     static bool _disablePeriodicDefrag;
 
+    // Start spreading a full defragment over the following ticks once this few elements are left,
+    // provided that at least kReorganiseIncrementalMinGarbage of the used entries would be freed by it
+    static constexpr uint32_t kReorganiseIncrementalThreshold = kMaxElements / 8;
+    static constexpr uint32_t kReorganiseIncrementalMinGarbage = kMaxElements / 32;
+    static constexpr uint32_t kReorganiseIncrementalTilesPerSlice = 4096;
+
+    struct ReorganiseIncrementalState
+    {
+        bool inProgress = false;
+        uint32_t nextTile = 0;
+        size_t packedEnd = 0;
+    };
+    static ReorganiseIncrementalState _reorganiseIncremental;
+
+    // Scratch space for reorganise, kept between calls and only grown to the used part of the element array
+    static std::vector<TileElementEntry> _reorganiseBuffer;
+
     template<>
     Store<SurfaceElement>& getStore<SurfaceElement>()
     {
@@ -159,6 +177,25 @@ namespace OpenLoco::World::TileManager
         tileState().wall.clear();
         tileState().road.clear();
         tileState().industry.clear();
+        for (auto& tiles : tileState().elementTiles)
+        {
+            tiles.clear();
+        }
+    }
+
+    void setElementTile(const TileElementEntry& entry, TilePos2 pos)
+    {
+        auto& tiles = tileState().elementTiles[enumValue(entry.type())];
+        if (entry.index() >= tiles.size())
+        {
+            tiles.resize(entry.index() + 1, kNoElementTile);
+        }
+        tiles[entry.index()] = pos;
+    }
+
+    std::span<const TilePos2> getElementTiles(ElementType type)
+    {
+        return tileState().elementTiles[enumValue(type)];
     }
 
     void disablePeriodicDefrag()
@@ -242,6 +279,8 @@ namespace OpenLoco::World::TileManager
         tileState().entriesEnd = kInitialEntries;
 
         updateTilePointers();
+        TownManager::resetRoadIndex();
+        WaterRegions::reset();
         getGameState().flags |= GameStateFlags::tileManagerLoaded;
     }
 
@@ -394,7 +433,7 @@ namespace OpenLoco::World::TileManager
         return std::make_pair(source, dest);
     }
 
-    static TileElementEntry* insertElementEnd(ElementType type, uint8_t baseZ, uint8_t occupiedQuads, TileElementEntry* source, TileElementEntry* dest, bool lastFound)
+    static TileElementEntry* insertElementEnd(ElementType type, const TilePos2 pos, uint8_t baseZ, uint8_t occupiedQuads, TileElementEntry* source, TileElementEntry* dest, bool lastFound)
     {
         auto* newEntry = dest++;
 
@@ -423,11 +462,13 @@ namespace OpenLoco::World::TileManager
                 break;
             case ElementType::road:
                 *newEntry = allocElement(RoadElement{});
+                TownManager::registerRoadTile(toWorldSpace(pos));
                 break;
             case ElementType::industry:
                 *newEntry = allocElement(IndustryElement{});
                 break;
         }
+        setElementTile(*newEntry, pos);
         newEntry->setBaseZ(baseZ);
         newEntry->setClearZ(baseZ);
         newEntry->setOccupiedQuarter(occupiedQuads);
@@ -478,7 +519,7 @@ namespace OpenLoco::World::TileManager
             dest++;
         }
 
-        return insertElementEnd(type, baseZ, occupiedQuads, source, dest, lastFound);
+        return insertElementEnd(type, toTileSpace(pos), baseZ, occupiedQuads, source, dest, lastFound);
     }
 
     // 0x0046166C
@@ -524,7 +565,7 @@ namespace OpenLoco::World::TileManager
             dest++;
         }
 
-        return insertElementEnd(ElementType::road, baseZ, occupiedQuads, source, dest, lastFound);
+        return insertElementEnd(ElementType::road, toTileSpace(pos), baseZ, occupiedQuads, source, dest, lastFound);
     }
 
     // 0x00461578
@@ -555,7 +596,7 @@ namespace OpenLoco::World::TileManager
             dest++;
         }
 
-        return insertElementEnd(type, baseZ, occupiedQuads, source, dest, lastFound);
+        return insertElementEnd(type, toTileSpace(pos), baseZ, occupiedQuads, source, dest, lastFound);
     }
 
     constexpr uint8_t kTileSize = 31;
@@ -797,11 +838,48 @@ namespace OpenLoco::World::TileManager
         return baseZ;
     }
 
+    static void cancelReorganiseIncremental()
+    {
+        _reorganiseIncremental.inProgress = false;
+    }
+
     static void clearTilePointers()
     {
         std::ranges::fill(tileState().tiles, nullptr);
     }
 
+    // Rebuilds the element tiles from the tile pointers, used after the entries have been replaced wholesale
+    static void updateElementTiles()
+    {
+        auto& ts = tileState();
+        ts.elementTiles[enumValue(ElementType::surface)].assign(ts.surface.capacity(), kNoElementTile);
+        ts.elementTiles[enumValue(ElementType::track)].assign(ts.track.capacity(), kNoElementTile);
+        ts.elementTiles[enumValue(ElementType::station)].assign(ts.station.capacity(), kNoElementTile);
+        ts.elementTiles[enumValue(ElementType::signal)].assign(ts.signal.capacity(), kNoElementTile);
+        ts.elementTiles[enumValue(ElementType::building)].assign(ts.building.capacity(), kNoElementTile);
+        ts.elementTiles[enumValue(ElementType::tree)].assign(ts.tree.capacity(), kNoElementTile);
+        ts.elementTiles[enumValue(ElementType::wall)].assign(ts.wall.capacity(), kNoElementTile);
+        ts.elementTiles[enumValue(ElementType::road)].assign(ts.road.capacity(), kNoElementTile);
+        ts.elementTiles[enumValue(ElementType::industry)].assign(ts.industry.capacity(), kNoElementTile);
+
+        for (tile_coord_t y = 0; y < kMapRows; y++)
+        {
+            for (tile_coord_t x = 0; x < kMapColumns; x++)
+            {
+                const auto pos = TilePos2(x, y);
+                const auto* entry = ts.tiles[getTileIndex(pos)];
+                if (entry == nullptr)
+                {
+                    continue;
+                }
+                do
+                {
+                    setElementTile(*entry, pos);
+                } while (!entry++->isLast());
+            }
+        }
+    }
+
     // 0x00461348
     void updateTilePointers()
     {
@@ -823,6 +901,58 @@ namespace OpenLoco::World::TileManager
         }
 
         tileState().entriesEnd = static_cast<ptrdiff_t>(i);
+        updateElementTiles();
+        cancelReorganiseIncremental();
+    }
+
+    template<typename T>
+    static void compactStore(Store<T>& store, std::vector<uint32_t>& remap)
+    {
+        remap.clear();
+        if (store.size() == store.capacity())
+        {
+            return;
+        }
+        remap.resize(store.capacity(), Store<T>::kInvalidIndex);
+
+        auto& elementTiles = tileState().elementTiles[enumValue(T::kElementType)];
+        elementTiles.resize(store.capacity(), kNoElementTile);
+        store.compact([&remap, &elementTiles](uint32_t from, uint32_t to) {
+            remap[from] = to;
+            elementTiles[to] = elementTiles[from];
+        });
+        elementTiles.resize(store.capacity());
+    }
+
+    // Packs the live elements of every store to the front so that memory and iteration follow the
+    // live element count rather than the peak. Every live element must be referenced by an entry.
+    // The element tiles are moved along with the elements so they do not need rebuilding.
+    void compactElementStores()
+    {
+        auto& ts = tileState();
+        std::array<std::vector<uint32_t>, kTileStateNumElementTypes> remaps;
+        compactStore(ts.surface, remaps[enumValue(ElementType::surface)]);
+        compactStore(ts.track, remaps[enumValue(ElementType::track)]);
+        compactStore(ts.station, remaps[enumValue(ElementType::station)]);
+        compactStore(ts.signal, remaps[enumValue(ElementType::signal)]);
+        compactStore(ts.building, remaps[enumValue(ElementType::building)]);
+        compactStore(ts.tree, remaps[enumValue(ElementType::tree)]);
+        compactStore(ts.wall, remaps[enumValue(ElementType::wall)]);
+        compactStore(ts.road, remaps[enumValue(ElementType::road)]);
+        compactStore(ts.industry, remaps[enumValue(ElementType::industry)]);
+
+        for (auto& entry : std::span(ts.entries.data(), static_cast<size_t>(ts.entriesEnd)))
+        {
+            if (entry.isEmpty())
+            {
+                continue;
+            }
+            const auto& remap = remaps[enumValue(entry.type())];
+            if (entry.index() < remap.size() && remap[entry.index()] != Store<SurfaceElement>::kInvalidIndex)
+            {
+                entry.setIndex(remap[entry.index()]);
+            }
+        }
     }
 
     // 0x0046148F
@@ -831,42 +961,208 @@ namespace OpenLoco::World::TileManager
         const auto curCursor = Ui::getCursor();
         Ui::setCursor(Ui::CursorId::busy);
 
-        try
+        // The used part of the element array is all the buffer can need
+        auto& ts = tileState();
+        const auto oldEntriesEnd = static_cast<size_t>(ts.entriesEnd);
+        if (_reorganiseBuffer.size() < oldEntriesEnd)
         {
-            // Allocate a temporary buffer and tightly pack all the tile elements in the map
-            std::vector<TileElementEntry> temp;
-            temp.resize(kMaxElements, TileElementEntry::empty());
+            try
+            {
+                _reorganiseBuffer.resize(oldEntriesEnd, TileElementEntry::empty());
+            }
+            catch (const std::bad_alloc&)
+            {
+                exitWithError(StringIds::unable_to_allocate_enough_memory, StringIds::game_init_failure);
+            }
+        }
+        auto& temp = _reorganiseBuffer;
 
-            size_t numEntries = 0;
-            for (tile_coord_t y = 0; y < kMapRows; y++)
+        // Tightly pack all the tile elements in the map into the buffer. Each tile is read before its pointer
+        // is moved to where its elements will be once copied back, saving a second pass over the map.
+        size_t numEntries = 0;
+        for (tile_coord_t y = 0; y < kMapRows; y++)
+        {
+            for (tile_coord_t x = 0; x < kMapColumns; x++)
             {
-                for (tile_coord_t x = 0; x < kMapColumns; x++)
+                const auto pos = TilePos2(x, y);
+                const auto* source = ts.tiles[getTileIndex(pos)];
+                set(pos, &ts.entries[numEntries]);
+                do
                 {
-                    auto tile = get(TilePos2(x, y));
-                    for (auto& el : tile)
-                    {
-                        temp[numEntries] = el;
-                        numEntries++;
-                    }
-                }
+                    temp[numEntries++] = *source;
+                } while (!source++->isLast());
             }
-
-            // Copy organised elements back to original element buffer
-            Diagnostics::Assert::eq(tileState().entries.size(), kMaxElements);
-            std::ranges::copy(temp, tileState().entries.begin());
-            tileState().entriesEnd = static_cast<ptrdiff_t>(numEntries);
-
-            updateTilePointers();
         }
-        catch (const std::bad_alloc&)
+
+        // Copy organised elements back to original element buffer, everything past the old end is already empty
+        Diagnostics::Assert::eq(ts.entries.size(), kMaxElements);
+        std::copy_n(temp.begin(), numEntries, ts.entries.begin());
+        if (oldEntriesEnd > numEntries)
         {
-            exitWithError(StringIds::unable_to_allocate_enough_memory, StringIds::game_init_failure);
+            std::fill(ts.entries.begin() + numEntries, ts.entries.begin() + oldEntriesEnd, TileElementEntry::empty());
         }
+        ts.entriesEnd = static_cast<ptrdiff_t>(numEntries);
+
+        cancelReorganiseIncremental();
 
         // Note: original implementation did not revert the cursor
         Ui::setCursor(curCursor);
     }
 
+    static size_t getTileNumEntries(const TileElementEntry* first)
+    {
+        size_t numEntries = 1;
+        while (!first[numEntries - 1].isLast())
+        {
+            numEntries++;
+        }
+        return numEntries;
+    }
+
+    // Moves the tile holding the element at `entry` to the free space at the end of the element array
+    static bool relocateTileToEnd(TileElementEntry* entry)
+    {
+        auto& ts = tileState();
+
+        auto* first = entry;
+        while (first != &ts.entries[0] && !(first - 1)->isEmpty() && !(first - 1)->isLast())
+        {
+            first--;
+        }
+        const auto numEntries = getTileNumEntries(first);
+        if (static_cast<size_t>(ts.entriesEnd) + numEntries > kMaxElements)
+        {
+            return false;
+        }
+
+        // Entries do not know their tile but every element placed on the map does
+        const auto elementTiles = getElementTiles(first->type());
+        if (first->index() >= elementTiles.size())
+        {
+            return false;
+        }
+        const auto pos = elementTiles[first->index()];
+        if (pos == kNoElementTile || ts.tiles[getTileIndex(pos)] != first)
+        {
+            return false;
+        }
+
+        auto* dest = &ts.entries[ts.entriesEnd];
+        std::copy_n(first, numEntries, dest);
+        std::fill_n(first, numEntries, TileElementEntry::empty());
+        set(pos, dest);
+        ts.entriesEnd += numEntries;
+        return true;
+    }
+
+    // Relocates every tile with elements in [begin, end) to the end of the element array
+    static bool clearEntries(TileElementEntry* begin, TileElementEntry* end)
+    {
+        for (auto* entry = begin; entry < end; entry++)
+        {
+            if (!entry->isEmpty() && !relocateTileToEnd(entry))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static void trimEntriesEnd()
+    {
+        auto newEnd = tileState().entriesEnd - 1;
+        while (newEnd >= 0 && tileState().entries[newEnd].isEmpty())
+        {
+            newEnd--;
+        }
+        tileState().entriesEnd = newEnd + 1;
+    }
+
+    // Entries below the end of the element array that hold no element, i.e. what a reorganise would free.
+    // Elements allocated for construction previews have no entry so this can be a few short.
+    static size_t getNumGarbageEntries()
+    {
+        const auto& ts = tileState();
+        const auto numLive = ts.surface.size() + ts.track.size() + ts.station.size() + ts.signal.size()
+            + ts.building.size() + ts.tree.size() + ts.wall.size() + ts.road.size() + ts.industry.size();
+        const auto numUsed = static_cast<size_t>(ts.entriesEnd);
+        return numUsed > numLive ? numUsed - numLive : 0;
+    }
+
+    void beginReorganiseIncremental()
+    {
+        _reorganiseIncremental.inProgress = true;
+        _reorganiseIncremental.nextTile = 0;
+        _reorganiseIncremental.packedEnd = 0;
+    }
+
+    // Does the same as reorganise in place, a slice of tiles at a time. Tiles before the cursor are packed
+    // in map order at the start of the element array, the next tile is slid down after them and anything
+    // in its way is moved to the end of the array to be picked up again when its own turn comes. If the map
+    // is not changed until the pass finishes the layout is exactly what reorganise would have produced.
+    bool reorganiseIncremental()
+    {
+        if (!_reorganiseIncremental.inProgress)
+        {
+            if (!Game::hasFlags(GameStateFlags::tileManagerLoaded) || numFreeElements() > kReorganiseIncrementalThreshold)
+            {
+                return false;
+            }
+            // A dense map can be low on free elements without any to reclaim, a pass would only start over
+            if (getNumGarbageEntries() < kReorganiseIncrementalMinGarbage)
+            {
+                return false;
+            }
+            beginReorganiseIncremental();
+        }
+
+        auto& ts = tileState();
+        auto& state = _reorganiseIncremental;
+        constexpr uint32_t kNumMapTiles = kMapColumns * kMapRows;
+        const auto lastTile = std::min(state.nextTile + kReorganiseIncrementalTilesPerSlice, kNumMapTiles);
+        for (; state.nextTile < lastTile; state.nextTile++)
+        {
+            const auto pos = TilePos2(state.nextTile % kMapColumns, state.nextTile / kMapColumns);
+            const auto tileIndex = getTileIndex(pos);
+            auto* source = ts.tiles[tileIndex];
+            auto* dest = &ts.entries[state.packedEnd];
+            const auto numEntries = getTileNumEntries(source);
+
+            if (source > dest && source < dest + numEntries)
+            {
+                // Overlapping, only the entries before the tile need clearing before sliding it down
+                if (!clearEntries(dest, source))
+                {
+                    break;
+                }
+                std::copy_n(source, numEntries, dest);
+                std::fill(dest + numEntries, source + numEntries, TileElementEntry::empty());
+            }
+            else if (source != dest)
+            {
+                // This may move the tile itself if it straddles the destination
+                if (!clearEntries(dest, dest + numEntries))
+                {
+                    break;
+                }
+                source = ts.tiles[tileIndex];
+                std::copy_n(source, numEntries, dest);
+                std::fill_n(source, numEntries, TileElementEntry::empty());
+            }
+            set(pos, dest);
+            state.packedEnd += numEntries;
+            ts.entriesEnd = std::max<ptrdiff_t>(ts.entriesEnd, state.packedEnd);
+        }
+
+        if (state.nextTile < lastTile || state.nextTile == kNumMapTiles)
+        {
+            // Either finished or out of room to move tiles out of the way, try again when next needed
+            state.inProgress = false;
+        }
+        trimEntriesEnd();
+        return state.inProgress;
+    }
+
     // 0x004613F0
     void defragmentTilePeriodic()
     {
@@ -918,12 +1214,7 @@ namespace OpenLoco::World::TileManager
 
         // Its possible we have freed up elements at the end so this
         // looks to see if we should move the element end
-        auto newEnd = tileState().entriesEnd - 1;
-        while (newEnd >= 0 && tileState().entries[newEnd].isEmpty())
-        {
-            newEnd--;
-        }
-        tileState().entriesEnd = newEnd + 1;
+        trimEntriesEnd();
     }
 
     // 0x00461393
@@ -1285,7 +1576,7 @@ namespace OpenLoco::World::TileManager
     // 0x0048B0C7
     void createDestructExplosion(const World::Pos3& pos)
     {
-        ExplosionSmoke::create(pos + World::Pos3{ 0, 0, 13 });
+        ParticleManager::createExplosionSmoke(pos + World::Pos3{ 0, 0, 13 });
         const auto randFreq = gPrng2().randNext(20'003, 24'098);
         Audio::playSound(Audio::SoundId::demolishBuilding, Audio::ChannelId::effects, pos, -1400, randFreq);
     }
@@ -1663,9 +1954,10 @@ namespace OpenLoco::World::TileManager
             surface->setTerrain(landObj->replacementLandHeader);
         }
 
-        if (surface->water() * kMicroToSmallZStep <= targetBaseZ)
+        if (surface->water() != 0 && surface->water() * kMicroToSmallZStep <= targetBaseZ)
         {
             surface->setWater(0);
+            WaterRegions::invalidateTile(toTileSpace(pos));
         }
 
         mapInvalidateTileFull(pos);
@@ -1748,6 +2040,7 @@ namespace OpenLoco::World::TileManager
             {
                 surface->setWater(targetHeight / kMicroToSmallZStep);
             }
+            WaterRegions::invalidateTile(toTileSpace(pos));
             surface->setType6Flag(false);
             surface->setVariation(0);
 
@@ -1,17816 +1,14 @@
 #include "Map/Track/SubpositionData.h"
-#include "Entities/Entity.h"
 #include "GameState.h"
+#include "Map/Track/SubpositionTables.h"
 
 #include <array>
-#include <vector>
+#include <span>
 
 namespace OpenLoco::World::TrackData
 {
-#pragma region TrackData
-    // 0x4da526
-    // Track 0. Reversed 0. Direction 0
-    static constexpr auto moveInfoT0R0D0 = std::to_array<MoveInfo>(
-        {
-            { { 31, 16, 0 }, 0, Pitch::flat },
-            { { 30, 16, 0 }, 0, Pitch::flat },
-            { { 29, 16, 0 }, 0, Pitch::flat },
-            { { 28, 16, 0 }, 0, Pitch::flat },
-            { { 27, 16, 0 }, 0, Pitch::flat },
-            { { 26, 16, 0 }, 0, Pitch::flat },
-            { { 25, 16, 0 }, 0, Pitch::flat },
-            { { 24, 16, 0 }, 0, Pitch::flat },
-            { { 23, 16, 0 }, 0, Pitch::flat },
-            { { 22, 16, 0 }, 0, Pitch::flat },
-            { { 21, 16, 0 }, 0, Pitch::flat },
-            { { 20, 16, 0 }, 0, Pitch::flat },
-            { { 19, 16, 0 }, 0, Pitch::flat },
-            { { 18, 16, 0 }, 0, Pitch::flat },
-            { { 17, 16, 0 }, 0, Pitch::flat },
-            { { 16, 16, 0 }, 0, Pitch::flat },
-            { { 15, 16, 0 }, 0, Pitch::flat },
-            { { 14, 16, 0 }, 0, Pitch::flat },
-            { { 13, 16, 0 }, 0, Pitch::flat },
-            { { 12, 16, 0 }, 0, Pitch::flat },
-            { { 11, 16, 0 }, 0, Pitch::flat },
-            { { 10, 16, 0 }, 0, Pitch::flat },
-            { { 9, 16, 0 }, 0, Pitch::flat },
-            { { 8, 16, 0 }, 0, Pitch::flat },
-            { { 7, 16, 0 }, 0, Pitch::flat },
-            { { 6, 16, 0 }, 0, Pitch::flat },
-            { { 5, 16, 0 }, 0, Pitch::flat },
-            { { 4, 16, 0 }, 0, Pitch::flat },
-            { { 3, 16, 0 }, 0, Pitch::flat },
-            { { 2, 16, 0 }, 0, Pitch::flat },
-            { { 1, 16, 0 }, 0, Pitch::flat },
-            { { 0, 16, 0 }, 0, Pitch::flat },
-        });
-
-    // 0x4da628
-    // Track 0. Reversed 0. Direction 1
-    static constexpr auto moveInfoT0R0D1 = std::to_array<MoveInfo>(
-        {
-            { { 16, 0, 0 }, 16, Pitch::flat },
-            { { 16, 1, 0 }, 16, Pitch::flat },
-            { { 16, 2, 0 }, 16, Pitch::flat },
-            { { 16, 3, 0 }, 16, Pitch::flat },
-            { { 16, 4, 0 }, 16, Pitch::flat },
-            { { 16, 5, 0 }, 16, Pitch::flat },
-            { { 16, 6, 0 }, 16, Pitch::flat },
-            { { 16, 7, 0 }, 16, Pitch::flat },
-            { { 16, 8, 0 }, 16, Pitch::flat },
-            { { 16, 9, 0 }, 16, Pitch::flat },
-            { { 16, 10, 0 }, 16, Pitch::flat },
-            { { 16, 11, 0 }, 16, Pitch::flat },
-            { { 16, 12, 0 }, 16, Pitch::flat },
-            { { 16, 13, 0 }, 16, Pitch::flat },
-            { { 16, 14, 0 }, 16, Pitch::flat },
-            { { 16, 15, 0 }, 16, Pitch::flat },
-            { { 16, 16, 0 }, 16, Pitch::flat },
-            { { 16, 17, 0 }, 16, Pitch::flat },
-            { { 16, 18, 0 }, 16, Pitch::flat },
-            { { 16, 19, 0 }, 16, Pitch::flat },
-            { { 16, 20, 0 }, 16, Pitch::flat },
-            { { 16, 21, 0 }, 16, Pitch::flat },
-            { { 16, 22, 0 }, 16, Pitch::flat },
-            { { 16, 23, 0 }, 16, Pitch::flat },
-            { { 16, 24, 0 }, 16, Pitch::flat },
-            { { 16, 25, 0 }, 16, Pitch::flat },
-            { { 16, 26, 0 }, 16, Pitch::flat },
-            { { 16, 27, 0 }, 16, Pitch::flat },
-            { { 16, 28, 0 }, 16, Pitch::flat },
-            { { 16, 29, 0 }, 16, Pitch::flat },
-            { { 16, 30, 0 }, 16, Pitch::flat },
-            { { 16, 31, 0 }, 16, Pitch::flat },
-        });
-
-    // 0x4da72a
-    // Track 0. Reversed 0. Direction 2
-    static constexpr auto moveInfoT0R0D2 = std::to_array<MoveInfo>(
-        {
-            { { 0, 16, 0 }, 32, Pitch::flat },
-            { { 1, 16, 0 }, 32, Pitch::flat },
-            { { 2, 16, 0 }, 32, Pitch::flat },
-            { { 3, 16, 0 }, 32, Pitch::flat },
-            { { 4, 16, 0 }, 32, Pitch::flat },
-            { { 5, 16, 0 }, 32, Pitch::flat },
-            { { 6, 16, 0 }, 32, Pitch::flat },
-            { { 7, 16, 0 }, 32, Pitch::flat },
-            { { 8, 16, 0 }, 32, Pitch::flat },
-            { { 9, 16, 0 }, 32, Pitch::flat },
-            { { 10, 16, 0 }, 32, Pitch::flat },
-            { { 11, 16, 0 }, 32, Pitch::flat },
-            { { 12, 16, 0 }, 32, Pitch::flat },
-            { { 13, 16, 0 }, 32, Pitch::flat },
-            { { 14, 16, 0 }, 32, Pitch::flat },
-            { { 15, 16, 0 }, 32, Pitch::flat },
-            { { 16, 16, 0 }, 32, Pitch::flat },
-            { { 17, 16, 0 }, 32, Pitch::flat },
-            { { 18, 16, 0 }, 32, Pitch::flat },
-            { { 19, 16, 0 }, 32, Pitch::flat },
-            { { 20, 16, 0 }, 32, Pitch::flat },
-            { { 21, 16, 0 }, 32, Pitch::flat },
-            { { 22, 16, 0 }, 32, Pitch::flat },
-            { { 23, 16, 0 }, 32, Pitch::flat },
-            { { 24, 16, 0 }, 32, Pitch::flat },
-            { { 25, 16, 0 }, 32, Pitch::flat },
-            { { 26, 16, 0 }, 32, Pitch::flat },
-            { { 27, 16, 0 }, 32, Pitch::flat },
-            { { 28, 16, 0 }, 32, Pitch::flat },
-            { { 29, 16, 0 }, 32, Pitch::flat },
-            { { 30, 16, 0 }, 32, Pitch::flat },
-            { { 31, 16, 0 }, 32, Pitch::flat },
-        });
-
-    // 0x4da82c
-    // Track 0. Reversed 0. Direction 3
-    static constexpr auto moveInfoT0R0D3 = std::to_array<MoveInfo>(
-        {
-            { { 16, 31, 0 }, 48, Pitch::flat },
-            { { 16, 30, 0 }, 48, Pitch::flat },
-            { { 16, 29, 0 }, 48, Pitch::flat },
-            { { 16, 28, 0 }, 48, Pitch::flat },
-            { { 16, 27, 0 }, 48, Pitch::flat },
-            { { 16, 26, 0 }, 48, Pitch::flat },
-            { { 16, 25, 0 }, 48, Pitch::flat },
-            { { 16, 24, 0 }, 48, Pitch::flat },
-            { { 16, 23, 0 }, 48, Pitch::flat },
-            { { 16, 22, 0 }, 48, Pitch::flat },
-            { { 16, 21, 0 }, 48, Pitch::flat },
-            { { 16, 20, 0 }, 48, Pitch::flat },
-            { { 16, 19, 0 }, 48, Pitch::flat },
-            { { 16, 18, 0 }, 48, Pitch::flat },
-            { { 16, 17, 0 }, 48, Pitch::flat },
-            { { 16, 16, 0 }, 48, Pitch::flat },
-            { { 16, 15, 0 }, 48, Pitch::flat },
-            { { 16, 14, 0 }, 48, Pitch::flat },
-            { { 16, 13, 0 }, 48, Pitch::flat },
-            { { 16, 12, 0 }, 48, Pitch::flat },
-            { { 16, 11, 0 }, 48, Pitch::flat },
-            { { 16, 10, 0 }, 48, Pitch::flat },
-            { { 16, 9, 0 }, 48, Pitch::flat },
-            { { 16, 8, 0 }, 48, Pitch::flat },
-            { { 16, 7, 0 }, 48, Pitch::flat },
-            { { 16, 6, 0 }, 48, Pitch::flat },
-            { { 16, 5, 0 }, 48, Pitch::flat },
-            { { 16, 4, 0 }, 48, Pitch::flat },
-            { { 16, 3, 0 }, 48, Pitch::flat },
-            { { 16, 2, 0 }, 48, Pitch::flat },
-            { { 16, 1, 0 }, 48, Pitch::flat },
-            { { 16, 0, 0 }, 48, Pitch::flat },
-        });
-
-    // 0x4dc14e
-    // Track 1. Reversed 0. Direction 0
-    static constexpr auto moveInfoT1R0D0 = std::to_array<MoveInfo>(
-        {
-            { { 15, 16, 0 }, 8, Pitch::flat },
-            { { 14, 17, 0 }, 8, Pitch::flat },
-            { { 13, 18, 0 }, 8, Pitch::flat },
-            { { 12, 19, 0 }, 8, Pitch::flat },
-            { { 11, 20, 0 }, 8, Pitch::flat },
-            { { 10, 21, 0 }, 8, Pitch::flat },
-            { { 9, 22, 0 }, 8, Pitch::flat },
-            { { 8, 23, 0 }, 8, Pitch::flat },
-            { { 7, 24, 0 }, 8, Pitch::flat },
-            { { 6, 25, 0 }, 8, Pitch::flat },
-            { { 5, 26, 0 }, 8, Pitch::flat },
-            { { 4, 27, 0 }, 8, Pitch::flat },
-            { { 3, 28, 0 }, 8, Pitch::flat },
-            { { 2, 29, 0 }, 8, Pitch::flat },
-            { { 1, 30, 0 }, 8, Pitch::flat },
-            { { 0, 31, 0 }, 8, Pitch::flat },
-            { { -1, 32, 0 }, 8, Pitch::flat },
-            { { -2, 33, 0 }, 8, Pitch::flat },
-            { { -3, 34, 0 }, 8, Pitch::flat },
-            { { -4, 35, 0 }, 8, Pitch::flat },
-            { { -5, 36, 0 }, 8, Pitch::flat },
-            { { -6, 37, 0 }, 8, Pitch::flat },
-            { { -7, 38, 0 }, 8, Pitch::flat },
-            { { -8, 39, 0 }, 8, Pitch::flat },
-            { { -9, 40, 0 }, 8, Pitch::flat },
-            { { -10, 41, 0 }, 8, Pitch::flat },
-            { { -11, 42, 0 }, 8, Pitch::flat },
-            { { -12, 43, 0 }, 8, Pitch::flat },
-            { { -13, 44, 0 }, 8, Pitch::flat },
-            { { -14, 45, 0 }, 8, Pitch::flat },
-            { { -15, 46, 0 }, 8, Pitch::flat },
-            { { -16, 47, 0 }, 8, Pitch::flat },
-        });
-
-    // 0x4dc250
-    // Track 1. Reversed 0. Direction 1
-    static constexpr auto moveInfoT1R0D1 = std::to_array<MoveInfo>(
-        {
-            { { 16, 16, 0 }, 24, Pitch::flat },
-            { { 17, 17, 0 }, 24, Pitch::flat },
-            { { 18, 18, 0 }, 24, Pitch::flat },
-            { { 19, 19, 0 }, 24, Pitch::flat },
-            { { 20, 20, 0 }, 24, Pitch::flat },
-            { { 21, 21, 0 }, 24, Pitch::flat },
-            { { 22, 22, 0 }, 24, Pitch::flat },
-            { { 23, 23, 0 }, 24, Pitch::flat },
-            { { 24, 24, 0 }, 24, Pitch::flat },
-            { { 25, 25, 0 }, 24, Pitch::flat },
-            { { 26, 26, 0 }, 24, Pitch::flat },
-            { { 27, 27, 0 }, 24, Pitch::flat },
-            { { 28, 28, 0 }, 24, Pitch::flat },
-            { { 29, 29, 0 }, 24, Pitch::flat },
-            { { 30, 30, 0 }, 24, Pitch::flat },
-            { { 31, 31, 0 }, 24, Pitch::flat },
-            { { 32, 32, 0 }, 24, Pitch::flat },
-            { { 33, 33, 0 }, 24, Pitch::flat },
-            { { 34, 34, 0 }, 24, Pitch::flat },
-            { { 35, 35, 0 }, 24, Pitch::flat },
-            { { 36, 36, 0 }, 24, Pitch::flat },
-            { { 37, 37, 0 }, 24, Pitch::flat },
-            { { 38, 38, 0 }, 24, Pitch::flat },
-            { { 39, 39, 0 }, 24, Pitch::flat },
-            { { 40, 40, 0 }, 24, Pitch::flat },
-            { { 41, 41, 0 }, 24, Pitch::flat },
-            { { 42, 42, 0 }, 24, Pitch::flat },
-            { { 43, 43, 0 }, 24, Pitch::flat },
-            { { 44, 44, 0 }, 24, Pitch::flat },
-            { { 45, 45, 0 }, 24, Pitch::flat },
-            { { 46, 46, 0 }, 24, Pitch::flat },
-            { { 47, 47, 0 }, 24, Pitch::flat },
-        });
-
-    // 0x4dc352
-    // Track 1. Reversed 0. Direction 2
-    static constexpr auto moveInfoT1R0D2 = std::to_array<MoveInfo>(
-        {
-            { { 16, 15, 0 }, 40, Pitch::flat },
-            { { 17, 14, 0 }, 40, Pitch::flat },
-            { { 18, 13, 0 }, 40, Pitch::flat },
-            { { 19, 12, 0 }, 40, Pitch::flat },
-            { { 20, 11, 0 }, 40, Pitch::flat },
-            { { 21, 10, 0 }, 40, Pitch::flat },
-            { { 22, 9, 0 }, 40, Pitch::flat },
-            { { 23, 8, 0 }, 40, Pitch::flat },
-            { { 24, 7, 0 }, 40, Pitch::flat },
-            { { 25, 6, 0 }, 40, Pitch::flat },
-            { { 26, 5, 0 }, 40, Pitch::flat },
-            { { 27, 4, 0 }, 40, Pitch::flat },
-            { { 28, 3, 0 }, 40, Pitch::flat },
-            { { 29, 2, 0 }, 40, Pitch::flat },
-            { { 30, 1, 0 }, 40, Pitch::flat },
-            { { 31, 0, 0 }, 40, Pitch::flat },
-            { { 32, -1, 0 }, 40, Pitch::flat },
-            { { 33, -2, 0 }, 40, Pitch::flat },
-            { { 34, -3, 0 }, 40, Pitch::flat },
-            { { 35, -4, 0 }, 40, Pitch::flat },
-            { { 36, -5, 0 }, 40, Pitch::flat },
-            { { 37, -6, 0 }, 40, Pitch::flat },
-            { { 38, -7, 0 }, 40, Pitch::flat },
-            { { 39, -8, 0 }, 40, Pitch::flat },
-            { { 40, -9, 0 }, 40, Pitch::flat },
-            { { 41, -10, 0 }, 40, Pitch::flat },
-            { { 42, -11, 0 }, 40, Pitch::flat },
-            { { 43, -12, 0 }, 40, Pitch::flat },
-            { { 44, -13, 0 }, 40, Pitch::flat },
-            { { 45, -14, 0 }, 40, Pitch::flat },
-            { { 46, -15, 0 }, 40, Pitch::flat },
-            { { 47, -16, 0 }, 40, Pitch::flat },
-        });
-
-    // 0x4dc454
-    // Track 1. Reversed 0. Direction 3
-    static constexpr auto moveInfoT1R0D3 = std::to_array<MoveInfo>(
-        {
-            { { 15, 15, 0 }, 56, Pitch::flat },
-            { { 14, 14, 0 }, 56, Pitch::flat },
-            { { 13, 13, 0 }, 56, Pitch::flat },
-            { { 12, 12, 0 }, 56, Pitch::flat },
-            { { 11, 11, 0 }, 56, Pitch::flat },
-            { { 10, 10, 0 }, 56, Pitch::flat },
-            { { 9, 9, 0 }, 56, Pitch::flat },
-            { { 8, 8, 0 }, 56, Pitch::flat },
-            { { 7, 7, 0 }, 56, Pitch::flat },
-            { { 6, 6, 0 }, 56, Pitch::flat },
-            { { 5, 5, 0 }, 56, Pitch::flat },
-            { { 4, 4, 0 }, 56, Pitch::flat },
-            { { 3, 3, 0 }, 56, Pitch::flat },
-            { { 2, 2, 0 }, 56, Pitch::flat },
-            { { 1, 1, 0 }, 56, Pitch::flat },
-            { { 0, 0, 0 }, 56, Pitch::flat },
-            { { -1, -1, 0 }, 56, Pitch::flat },
-            { { -2, -2, 0 }, 56, Pitch::flat },
-            { { -3, -3, 0 }, 56, Pitch::flat },
-            { { -4, -4, 0 }, 56, Pitch::flat },
-            { { -5, -5, 0 }, 56, Pitch::flat },
-            { { -6, -6, 0 }, 56, Pitch::flat },
-            { { -7, -7, 0 }, 56, Pitch::flat },
-            { { -8, -8, 0 }, 56, Pitch::flat },
-            { { -9, -9, 0 }, 56, Pitch::flat },
-            { { -10, -10, 0 }, 56, Pitch::flat },
-            { { -11, -11, 0 }, 56, Pitch::flat },
-            { { -12, -12, 0 }, 56, Pitch::flat },
-            { { -13, -13, 0 }, 56, Pitch::flat },
-            { { -14, -14, 0 }, 56, Pitch::flat },
-            { { -15, -15, 0 }, 56, Pitch::flat },
-            { { -16, -16, 0 }, 56, Pitch::flat },
-        });
-
-    // 0x4df376
-    // Track 2. Reversed 0. Direction 0
-    static constexpr auto moveInfoT2R0D0 = std::to_array<MoveInfo>(
-        {
-            { { 31, 16, 0 }, 0, Pitch::flat },
-            { { 30, 16, 0 }, 0, Pitch::flat },
-            { { 29, 16, 0 }, 62, Pitch::flat },
-            { { 28, 15, 0 }, 62, Pitch::flat },
-            { { 27, 15, 0 }, 60, Pitch::flat },
-            { { 26, 15, 0 }, 60, Pitch::flat },
-            { { 25, 14, 0 }, 60, Pitch::flat },
-            { { 24, 14, 0 }, 58, Pitch::flat },
-            { { 23, 13, 0 }, 58, Pitch::flat },
-            { { 22, 12, 0 }, 56, Pitch::flat },
-            { { 21, 11, 0 }, 56, Pitch::flat },
-            { { 20, 10, 0 }, 56, Pitch::flat },
-            { { 19, 9, 0 }, 54, Pitch::flat },
-            { { 18, 8, 0 }, 54, Pitch::flat },
-            { { 18, 7, 0 }, 52, Pitch::flat },
-            { { 17, 6, 0 }, 52, Pitch::flat },
-            { { 17, 5, 0 }, 52, Pitch::flat },
-            { { 17, 4, 0 }, 50, Pitch::flat },
-            { { 16, 3, 0 }, 50, Pitch::flat },
-            { { 16, 2, 0 }, 48, Pitch::flat },
-            { { 16, 1, 0 }, 48, Pitch::flat },
-            { { 16, 0, 0 }, 48, Pitch::flat },
-        });
-
-    // 0x4df428
-    // Track 2. Reversed 0. Direction 1
-    static constexpr auto moveInfoT2R0D1 = std::to_array<MoveInfo>(
-        {
-            { { 16, 0, 0 }, 16, Pitch::flat },
-            { { 16, 1, 0 }, 16, Pitch::flat },
-            { { 16, 2, 0 }, 16, Pitch::flat },
-            { { 16, 3, 0 }, 14, Pitch::flat },
-            { { 15, 4, 0 }, 14, Pitch::flat },
-            { { 15, 5, 0 }, 12, Pitch::flat },
-            { { 15, 6, 0 }, 12, Pitch::flat },
-            { { 14, 7, 0 }, 12, Pitch::flat },
-            { { 14, 8, 0 }, 10, Pitch::flat },
-            { { 13, 9, 0 }, 10, Pitch::flat },
-            { { 12, 10, 0 }, 8, Pitch::flat },
-            { { 11, 11, 0 }, 8, Pitch::flat },
-            { { 10, 12, 0 }, 8, Pitch::flat },
-            { { 9, 13, 0 }, 6, Pitch::flat },
-            { { 8, 14, 0 }, 6, Pitch::flat },
-            { { 7, 14, 0 }, 4, Pitch::flat },
-            { { 6, 15, 0 }, 4, Pitch::flat },
-            { { 5, 15, 0 }, 4, Pitch::flat },
-            { { 4, 15, 0 }, 2, Pitch::flat },
-            { { 3, 16, 0 }, 2, Pitch::flat },
-            { { 2, 16, 0 }, 0, Pitch::flat },
-            { { 1, 16, 0 }, 0, Pitch::flat },
-            { { 0, 16, 0 }, 0, Pitch::flat },
-        });
-
-    // 0x4df4e2
-    // Track 2. Reversed 0. Direction 2
-    static constexpr auto moveInfoT2R0D2 = std::to_array<MoveInfo>(
-        {
-            { { 0, 16, 0 }, 32, Pitch::flat },
-            { { 1, 16, 0 }, 32, Pitch::flat },
-            { { 2, 16, 0 }, 32, Pitch::flat },
-            { { 3, 16, 0 }, 30, Pitch::flat },
-            { { 4, 17, 0 }, 30, Pitch::flat },
-            { { 5, 17, 0 }, 28, Pitch::flat },
-            { { 6, 17, 0 }, 28, Pitch::flat },
-            { { 7, 18, 0 }, 28, Pitch::flat },
-            { { 8, 18, 0 }, 26, Pitch::flat },
-            { { 9, 19, 0 }, 26, Pitch::flat },
-            { { 10, 20, 0 }, 24, Pitch::flat },
-            { { 11, 21, 0 }, 24, Pitch::flat },
-            { { 12, 22, 0 }, 24, Pitch::flat },
-            { { 13, 23, 0 }, 22, Pitch::flat },
-            { { 14, 24, 0 }, 22, Pitch::flat },
-            { { 14, 25, 0 }, 20, Pitch::flat },
-            { { 15, 26, 0 }, 20, Pitch::flat },
-            { { 15, 27, 0 }, 20, Pitch::flat },
-            { { 15, 28, 0 }, 18, Pitch::flat },
-            { { 16, 29, 0 }, 18, Pitch::flat },
-            { { 16, 30, 0 }, 16, Pitch::flat },
-            { { 16, 31, 0 }, 16, Pitch::flat },
-        });
-
-    // 0x4df594
-    // Track 2. Reversed 0. Direction 3
-    static constexpr auto moveInfoT2R0D3 = std::to_array<MoveInfo>(
-        {
-            { { 16, 31, 0 }, 48, Pitch::flat },
-            { { 16, 30, 0 }, 48, Pitch::flat },
-            { { 16, 29, 0 }, 46, Pitch::flat },
-            { { 17, 28, 0 }, 46, Pitch::flat },
-            { { 17, 27, 0 }, 44, Pitch::flat },
-            { { 17, 26, 0 }, 44, Pitch::flat },
-            { { 18, 25, 0 }, 44, Pitch::flat },
-            { { 18, 24, 0 }, 42, Pitch::flat },
-            { { 19, 23, 0 }, 42, Pitch::flat },
-            { { 20, 22, 0 }, 40, Pitch::flat },
-            { { 21, 21, 0 }, 40, Pitch::flat },
-            { { 22, 20, 0 }, 40, Pitch::flat },
-            { { 23, 19, 0 }, 38, Pitch::flat },
-            { { 24, 18, 0 }, 38, Pitch::flat },
-            { { 25, 18, 0 }, 36, Pitch::flat },
-            { { 26, 17, 0 }, 36, Pitch::flat },
-            { { 27, 17, 0 }, 36, Pitch::flat },
-            { { 28, 17, 0 }, 34, Pitch::flat },
-            { { 29, 16, 0 }, 34, Pitch::flat },
-            { { 30, 16, 0 }, 32, Pitch::flat },
-            { { 31, 16, 0 }, 32, Pitch::flat },
-        });
-
-    // 0x4df6e8
-    // Track 2. Reversed 1. Direction 0
-    static constexpr auto moveInfoT2R1D0 = std::to_array<MoveInfo>(
-        {
-            { { 16, 0, 0 }, 16, Pitch::flat },
-            { { 16, 1, 0 }, 16, Pitch::flat },
-            { { 16, 2, 0 }, 16, Pitch::flat },
-            { { 16, 3, 0 }, 18, Pitch::flat },
-            { { 17, 4, 0 }, 18, Pitch::flat },
-            { { 17, 5, 0 }, 20, Pitch::flat },
-            { { 17, 6, 0 }, 20, Pitch::flat },
-            { { 18, 7, 0 }, 20, Pitch::flat },
-            { { 18, 8, 0 }, 22, Pitch::flat },
-            { { 19, 9, 0 }, 22, Pitch::flat },
-            { { 20, 10, 0 }, 24, Pitch::flat },
-            { { 21, 11, 0 }, 24, Pitch::flat },
-            { { 22, 12, 0 }, 24, Pitch::flat },
-            { { 23, 13, 0 }, 26, Pitch::flat },
-            { { 24, 14, 0 }, 26, Pitch::flat },
-            { { 25, 14, 0 }, 28, Pitch::flat },
-            { { 26, 15, 0 }, 28, Pitch::flat },
-            { { 27, 15, 0 }, 28, Pitch::flat },
-            { { 28, 15, 0 }, 30, Pitch::flat },
-            { { 29, 16, 0 }, 30, Pitch::flat },
-            { { 30, 16, 0 }, 32, Pitch::flat },
-            { { 31, 16, 0 }, 32, Pitch::flat },
-        });
-
-    // 0x4df79a
-    // Track 2. Reversed 1. Direction 1
-    static constexpr auto moveInfoT2R1D1 = std::to_array<MoveInfo>(
-        {
-            { { 0, 16, 0 }, 32, Pitch::flat },
-            { { 1, 16, 0 }, 32, Pitch::flat },
-            { { 2, 16, 0 }, 32, Pitch::flat },
-            { { 3, 16, 0 }, 34, Pitch::flat },
-            { { 4, 15, 0 }, 34, Pitch::flat },
-            { { 5, 15, 0 }, 36, Pitch::flat },
-            { { 6, 15, 0 }, 36, Pitch::flat },
-            { { 7, 14, 0 }, 36, Pitch::flat },
-            { { 8, 14, 0 }, 38, Pitch::flat },
-            { { 9, 13, 0 }, 38, Pitch::flat },
-            { { 10, 12, 0 }, 40, Pitch::flat },
-            { { 11, 11, 0 }, 40, Pitch::flat },
-            { { 12, 10, 0 }, 40, Pitch::flat },
-            { { 13, 9, 0 }, 42, Pitch::flat },
-            { { 14, 8, 0 }, 42, Pitch::flat },
-            { { 14, 7, 0 }, 44, Pitch::flat },
-            { { 15, 6, 0 }, 44, Pitch::flat },
-            { { 15, 5, 0 }, 44, Pitch::flat },
-            { { 15, 4, 0 }, 46, Pitch::flat },
-            { { 16, 3, 0 }, 46, Pitch::flat },
-            { { 16, 2, 0 }, 48, Pitch::flat },
-            { { 16, 1, 0 }, 48, Pitch::flat },
-            { { 16, 0, 0 }, 48, Pitch::flat },
-        });
-
-    // 0x4df854
-    // Track 2. Reversed 1. Direction 2
-    static constexpr auto moveInfoT2R1D2 = std::to_array<MoveInfo>(
-        {
-            { { 16, 31, 0 }, 48, Pitch::flat },
-            { { 16, 30, 0 }, 48, Pitch::flat },
-            { { 16, 29, 0 }, 50, Pitch::flat },
-            { { 15, 28, 0 }, 50, Pitch::flat },
-            { { 15, 27, 0 }, 52, Pitch::flat },
-            { { 15, 26, 0 }, 52, Pitch::flat },
-            { { 14, 25, 0 }, 52, Pitch::flat },
-            { { 14, 24, 0 }, 54, Pitch::flat },
-            { { 13, 23, 0 }, 54, Pitch::flat },
-            { { 12, 22, 0 }, 56, Pitch::flat },
-            { { 11, 21, 0 }, 56, Pitch::flat },
-            { { 10, 20, 0 }, 56, Pitch::flat },
-            { { 9, 19, 0 }, 58, Pitch::flat },
-            { { 8, 18, 0 }, 58, Pitch::flat },
-            { { 7, 18, 0 }, 60, Pitch::flat },
-            { { 6, 17, 0 }, 60, Pitch::flat },
-            { { 5, 17, 0 }, 60, Pitch::flat },
-            { { 4, 17, 0 }, 62, Pitch::flat },
-            { { 3, 16, 0 }, 62, Pitch::flat },
-            { { 2, 16, 0 }, 0, Pitch::flat },
-            { { 1, 16, 0 }, 0, Pitch::flat },
-            { { 0, 16, 0 }, 0, Pitch::flat },
-        });
-
-    // 0x4df63e
-    // Track 2. Reversed 1. Direction 3
-    static constexpr auto moveInfoT2R1D3 = std::to_array<MoveInfo>(
-        {
-            { { 31, 16, 0 }, 0, Pitch::flat },
-            { { 30, 16, 0 }, 0, Pitch::flat },
-            { { 29, 16, 0 }, 2, Pitch::flat },
-            { { 28, 17, 0 }, 2, Pitch::flat },
-            { { 27, 17, 0 }, 4, Pitch::flat },
-            { { 26, 17, 0 }, 4, Pitch::flat },
-            { { 25, 18, 0 }, 4, Pitch::flat },
-            { { 24, 18, 0 }, 6, Pitch::flat },
-            { { 23, 19, 0 }, 6, Pitch::flat },
-            { { 22, 20, 0 }, 8, Pitch::flat },
-            { { 21, 21, 0 }, 8, Pitch::flat },
-            { { 20, 22, 0 }, 8, Pitch::flat },
-            { { 19, 23, 0 }, 10, Pitch::flat },
-            { { 18, 24, 0 }, 10, Pitch::flat },
-            { { 18, 25, 0 }, 12, Pitch::flat },
-            { { 17, 26, 0 }, 12, Pitch::flat },
-            { { 17, 27, 0 }, 12, Pitch::flat },
-            { { 17, 28, 0 }, 14, Pitch::flat },
-            { { 16, 29, 0 }, 14, Pitch::flat },
-            { { 16, 30, 0 }, 16, Pitch::flat },
-            { { 16, 31, 0 }, 16, Pitch::flat },
-        });
-
-    // 0x4df906
-    // Track 4. Reversed 0. Direction 0
-    static constexpr auto moveInfoT4R0D0 = std::to_array<MoveInfo>(
-        {
-            { { 31, 16, 0 }, 0, Pitch::flat },
-            { { 30, 16, 0 }, 0, Pitch::flat },
-            { { 29, 16, 0 }, 0, Pitch::flat },
-            { { 28, 16, 0 }, 0, Pitch::flat },
-            { { 27, 16, 0 }, 62, Pitch::flat },
-            { { 26, 16, 0 }, 62, Pitch::flat },
-            { { 25, 15, 0 }, 62, Pitch::flat },
-            { { 24, 15, 0 }, 62, Pitch::flat },
-            { { 23, 15, 0 }, 62, Pitch::flat },
-            { { 22, 15, 0 }, 62, Pitch::flat },
-            { { 21, 15, 0 }, 62, Pitch::flat },
-            { { 20, 15, 0 }, 62, Pitch::flat },
-            { { 19, 14, 0 }, 62, Pitch::flat },
-            { { 18, 14, 0 }, 60, Pitch::flat },
-            { { 17, 14, 0 }, 60, Pitch::flat },
-            { { 16, 13, 0 }, 60, Pitch::flat },
-            { { 15, 13, 0 }, 60, Pitch::flat },
-            { { 14, 13, 0 }, 60, Pitch::flat },
-            { { 13, 12, 0 }, 60, Pitch::flat },
-            { { 12, 12, 0 }, 60, Pitch::flat },
-            { { 11, 11, 0 }, 60, Pitch::flat },
-            { { 10, 11, 0 }, 60, Pitch::flat },
-            { { 9, 10, 0 }, 58, Pitch::flat },
-            { { 8, 10, 0 }, 58, Pitch::flat },
-            { { 7, 9, 0 }, 58, Pitch::flat },
-            { { 6, 9, 0 }, 58, Pitch::flat },
-            { { 5, 8, 0 }, 58, Pitch::flat },
-            { { 4, 7, 0 }, 58, Pitch::flat },
-            { { 3, 7, 0 }, 58, Pitch::flat },
-            { { 2, 6, 0 }, 58, Pitch::flat },
-            { { 1, 5, 0 }, 56, Pitch::flat },
-            { { 0, 4, 0 }, 56, Pitch::flat },
-            { { -1, 3, 0 }, 56, Pitch::flat },
-            { { -3, 3, 0 }, 56, Pitch::flat },
-            { { -4, 2, 0 }, 56, Pitch::flat },
-            { { -5, 1, 0 }, 56, Pitch::flat },
-            { { -6, 0, 0 }, 56, Pitch::flat },
-            { { -7, -1, 0 }, 54, Pitch::flat },
-            { { -7, -2, 0 }, 54, Pitch::flat },
-            { { -8, -3, 0 }, 54, Pitch::flat },
-            { { -9, -4, 0 }, 54, Pitch::flat },
-            { { -9, -5, 0 }, 54, Pitch::flat },
-            { { -10, -6, 0 }, 54, Pitch::flat },
-            { { -10, -7, 0 }, 54, Pitch::flat },
-            { { -11, -8, 0 }, 54, Pitch::flat },
-            { { -11, -9, 0 }, 52, Pitch::flat },
-            { { -12, -10, 0 }, 52, Pitch::flat },
-            { { -12, -11, 0 }, 52, Pitch::flat },
-            { { -13, -12, 0 }, 52, Pitch::flat },
-            { { -13, -13, 0 }, 52, Pitch::flat },
-            { { -13, -14, 0 }, 52, Pitch::flat },
-            { { -14, -15, 0 }, 52, Pitch::flat },
-            { { -14, -16, 0 }, 52, Pitch::flat },
-            { { -14, -17, 0 }, 52, Pitch::flat },
-            { { -15, -18, 0 }, 50, Pitch::flat },
-            { { -15, -19, 0 }, 50, Pitch::flat },
-            { { -15, -20, 0 }, 50, Pitch::flat },
-            { { -15, -21, 0 }, 50, Pitch::flat },
-            { { -15, -22, 0 }, 50, Pitch::flat },
-            { { -15, -23, 0 }, 50, Pitch::flat },
-            { { -16, -24, 0 }, 50, Pitch::flat },
-            { { -16, -25, 0 }, 50, Pitch::flat },
-            { { -16, -26, 0 }, 50, Pitch::flat },
-            { { -16, -27, 0 }, 48, Pitch::flat },
-            { { -16, -28, 0 }, 48, Pitch::flat },
-            { { -16, -29, 0 }, 48, Pitch::flat },
-            { { -16, -30, 0 }, 48, Pitch::flat },
-            { { -16, -31, 0 }, 48, Pitch::flat },
-        });
-
-    // 0x4dfb28
-    // Track 4. Reversed 0. Direction 1
-    static constexpr auto moveInfoT4R0D1 = std::to_array<MoveInfo>(
-        {
-            { { 16, 0, 0 }, 16, Pitch::flat },
-            { { 16, 1, 0 }, 16, Pitch::flat },
-            { { 16, 2, 0 }, 16, Pitch::flat },
-            { { 16, 3, 0 }, 16, Pitch::flat },
-            { { 16, 4, 0 }, 16, Pitch::flat },
-            { { 16, 5, 0 }, 14, Pitch::flat },
-            { { 16, 6, 0 }, 14, Pitch::flat },
-            { { 15, 7, 0 }, 14, Pitch::flat },
-            { { 15, 8, 0 }, 14, Pitch::flat },
-            { { 15, 9, 0 }, 14, Pitch::flat },
-            { { 15, 10, 0 }, 14, Pitch::flat },
-            { { 15, 11, 0 }, 14, Pitch::flat },
-            { { 15, 12, 0 }, 14, Pitch::flat },
-            { { 14, 13, 0 }, 14, Pitch::flat },
-            { { 14, 14, 0 }, 12, Pitch::flat },
-            { { 14, 15, 0 }, 12, Pitch::flat },
-            { { 13, 16, 0 }, 12, Pitch::flat },
-            { { 13, 17, 0 }, 12, Pitch::flat },
-            { { 13, 18, 0 }, 12, Pitch::flat },
-            { { 12, 19, 0 }, 12, Pitch::flat },
-            { { 12, 20, 0 }, 12, Pitch::flat },
-            { { 11, 21, 0 }, 12, Pitch::flat },
-            { { 11, 22, 0 }, 12, Pitch::flat },
-            { { 10, 23, 0 }, 10, Pitch::flat },
-            { { 10, 24, 0 }, 10, Pitch::flat },
-            { { 9, 25, 0 }, 10, Pitch::flat },
-            { { 9, 26, 0 }, 10, Pitch::flat },
-            { { 8, 27, 0 }, 10, Pitch::flat },
-            { { 7, 28, 0 }, 10, Pitch::flat },
-            { { 7, 29, 0 }, 10, Pitch::flat },
-            { { 6, 30, 0 }, 10, Pitch::flat },
-            { { 5, 31, 0 }, 8, Pitch::flat },
-            { { 4, 32, 0 }, 8, Pitch::flat },
-            { { 3, 33, 0 }, 8, Pitch::flat },
-            { { 3, 35, 0 }, 8, Pitch::flat },
-            { { 2, 36, 0 }, 8, Pitch::flat },
-            { { 1, 37, 0 }, 8, Pitch::flat },
-            { { 0, 38, 0 }, 8, Pitch::flat },
-            { { -1, 39, 0 }, 6, Pitch::flat },
-            { { -2, 39, 0 }, 6, Pitch::flat },
-            { { -3, 40, 0 }, 6, Pitch::flat },
-            { { -4, 41, 0 }, 6, Pitch::flat },
-            { { -5, 41, 0 }, 6, Pitch::flat },
-            { { -6, 42, 0 }, 6, Pitch::flat },
-            { { -7, 42, 0 }, 6, Pitch::flat },
-            { { -8, 43, 0 }, 6, Pitch::flat },
-            { { -9, 43, 0 }, 4, Pitch::flat },
-            { { -10, 44, 0 }, 4, Pitch::flat },
-            { { -11, 44, 0 }, 4, Pitch::flat },
-            { { -12, 45, 0 }, 4, Pitch::flat },
-            { { -13, 45, 0 }, 4, Pitch::flat },
-            { { -14, 45, 0 }, 4, Pitch::flat },
-            { { -15, 46, 0 }, 4, Pitch::flat },
-            { { -16, 46, 0 }, 4, Pitch::flat },
-            { { -17, 46, 0 }, 4, Pitch::flat },
-            { { -18, 47, 0 }, 2, Pitch::flat },
-            { { -19, 47, 0 }, 2, Pitch::flat },
-            { { -20, 47, 0 }, 2, Pitch::flat },
-            { { -21, 47, 0 }, 2, Pitch::flat },
-            { { -22, 47, 0 }, 2, Pitch::flat },
-            { { -23, 47, 0 }, 2, Pitch::flat },
-            { { -24, 48, 0 }, 2, Pitch::flat },
-            { { -25, 48, 0 }, 2, Pitch::flat },
-            { { -26, 48, 0 }, 2, Pitch::flat },
-            { { -27, 48, 0 }, 0, Pitch::flat },
-            { { -28, 48, 0 }, 0, Pitch::flat },
-            { { -29, 48, 0 }, 0, Pitch::flat },
-            { { -30, 48, 0 }, 0, Pitch::flat },
-            { { -31, 48, 0 }, 0, Pitch::flat },
-        });
-
-    // 0x4dfd52
-    // Track 4. Reversed 0. Direction 2
-    static constexpr auto moveInfoT4R0D2 = std::to_array<MoveInfo>(
-        {
-            { { 0, 16, 0 }, 32, Pitch::flat },
-            { { 1, 16, 0 }, 32, Pitch::flat },
-            { { 2, 16, 0 }, 32, Pitch::flat },
-            { { 3, 16, 0 }, 32, Pitch::flat },
-            { { 4, 16, 0 }, 32, Pitch::flat },
-            { { 5, 16, 0 }, 30, Pitch::flat },
-            { { 6, 16, 0 }, 30, Pitch::flat },
-            { { 7, 17, 0 }, 30, Pitch::flat },
-            { { 8, 17, 0 }, 30, Pitch::flat },
-            { { 9, 17, 0 }, 30, Pitch::flat },
-            { { 10, 17, 0 }, 30, Pitch::flat },
-            { { 11, 17, 0 }, 30, Pitch::flat },
-            { { 12, 17, 0 }, 30, Pitch::flat },
-            { { 13, 18, 0 }, 30, Pitch::flat },
-            { { 14, 18, 0 }, 28, Pitch::flat },
-            { { 15, 18, 0 }, 28, Pitch::flat },
-            { { 16, 19, 0 }, 28, Pitch::flat },
-            { { 17, 19, 0 }, 28, Pitch::flat },
-            { { 18, 19, 0 }, 28, Pitch::flat },
-            { { 19, 20, 0 }, 28, Pitch::flat },
-            { { 20, 20, 0 }, 28, Pitch::flat },
-            { { 21, 21, 0 }, 28, Pitch::flat },
-            { { 22, 21, 0 }, 28, Pitch::flat },
-            { { 23, 22, 0 }, 26, Pitch::flat },
-            { { 24, 22, 0 }, 26, Pitch::flat },
-            { { 25, 23, 0 }, 26, Pitch::flat },
-            { { 26, 23, 0 }, 26, Pitch::flat },
-            { { 27, 24, 0 }, 26, Pitch::flat },
-            { { 28, 25, 0 }, 26, Pitch::flat },
-            { { 29, 25, 0 }, 26, Pitch::flat },
-            { { 30, 26, 0 }, 26, Pitch::flat },
-            { { 31, 27, 0 }, 24, Pitch::flat },
-            { { 32, 28, 0 }, 24, Pitch::flat },
-            { { 33, 29, 0 }, 24, Pitch::flat },
-            { { 35, 29, 0 }, 24, Pitch::flat },
-            { { 36, 30, 0 }, 24, Pitch::flat },
-            { { 37, 31, 0 }, 24, Pitch::flat },
-            { { 38, 32, 0 }, 24, Pitch::flat },
-            { { 39, 33, 0 }, 22, Pitch::flat },
-            { { 39, 34, 0 }, 22, Pitch::flat },
-            { { 40, 35, 0 }, 22, Pitch::flat },
-            { { 41, 36, 0 }, 22, Pitch::flat },
-            { { 41, 37, 0 }, 22, Pitch::flat },
-            { { 42, 38, 0 }, 22, Pitch::flat },
-            { { 42, 39, 0 }, 22, Pitch::flat },
-            { { 43, 40, 0 }, 22, Pitch::flat },
-            { { 43, 41, 0 }, 20, Pitch::flat },
-            { { 44, 42, 0 }, 20, Pitch::flat },
-            { { 44, 43, 0 }, 20, Pitch::flat },
-            { { 45, 44, 0 }, 20, Pitch::flat },
-            { { 45, 45, 0 }, 20, Pitch::flat },
-            { { 45, 46, 0 }, 20, Pitch::flat },
-            { { 46, 47, 0 }, 20, Pitch::flat },
-            { { 46, 48, 0 }, 20, Pitch::flat },
-            { { 46, 49, 0 }, 20, Pitch::flat },
-            { { 47, 50, 0 }, 18, Pitch::flat },
-            { { 47, 51, 0 }, 18, Pitch::flat },
-            { { 47, 52, 0 }, 18, Pitch::flat },
-            { { 47, 53, 0 }, 18, Pitch::flat },
-            { { 47, 54, 0 }, 18, Pitch::flat },
-            { { 47, 55, 0 }, 18, Pitch::flat },
-            { { 48, 56, 0 }, 18, Pitch::flat },
-            { { 48, 57, 0 }, 18, Pitch::flat },
-            { { 48, 58, 0 }, 18, Pitch::flat },
-            { { 48, 59, 0 }, 16, Pitch::flat },
-            { { 48, 60, 0 }, 16, Pitch::flat },
-            { { 48, 61, 0 }, 16, Pitch::flat },
-            { { 48, 62, 0 }, 16, Pitch::flat },
-        });
-
-    // 0x4dff74
-    // Track 4. Reversed 0. Direction 3
-    static constexpr auto moveInfoT4R0D3 = std::to_array<MoveInfo>(
-        {
-            { { 16, 31, 0 }, 48, Pitch::flat },
-            { { 16, 30, 0 }, 48, Pitch::flat },
-            { { 16, 29, 0 }, 48, Pitch::flat },
-            { { 16, 28, 0 }, 48, Pitch::flat },
-            { { 16, 27, 0 }, 46, Pitch::flat },
-            { { 16, 26, 0 }, 46, Pitch::flat },
-            { { 17, 25, 0 }, 46, Pitch::flat },
-            { { 17, 24, 0 }, 46, Pitch::flat },
-            { { 17, 23, 0 }, 46, Pitch::flat },
-            { { 17, 22, 0 }, 46, Pitch::flat },
-            { { 17, 21, 0 }, 46, Pitch::flat },
-            { { 17, 20, 0 }, 46, Pitch::flat },
-            { { 18, 19, 0 }, 46, Pitch::flat },
-            { { 18, 18, 0 }, 44, Pitch::flat },
-            { { 18, 17, 0 }, 44, Pitch::flat },
-            { { 19, 16, 0 }, 44, Pitch::flat },
-            { { 19, 15, 0 }, 44, Pitch::flat },
-            { { 19, 14, 0 }, 44, Pitch::flat },
-            { { 20, 13, 0 }, 44, Pitch::flat },
-            { { 20, 12, 0 }, 44, Pitch::flat },
-            { { 21, 11, 0 }, 44, Pitch::flat },
-            { { 21, 10, 0 }, 44, Pitch::flat },
-            { { 22, 9, 0 }, 42, Pitch::flat },
-            { { 22, 8, 0 }, 42, Pitch::flat },
-            { { 23, 7, 0 }, 42, Pitch::flat },
-            { { 23, 6, 0 }, 42, Pitch::flat },
-            { { 24, 5, 0 }, 42, Pitch::flat },
-            { { 25, 4, 0 }, 42, Pitch::flat },
-            { { 25, 3, 0 }, 42, Pitch::flat },
-            { { 26, 2, 0 }, 42, Pitch::flat },
-            { { 27, 1, 0 }, 40, Pitch::flat },
-            { { 28, 0, 0 }, 40, Pitch::flat },
-            { { 29, -1, 0 }, 40, Pitch::flat },
-            { { 29, -3, 0 }, 40, Pitch::flat },
-            { { 30, -4, 0 }, 40, Pitch::flat },
-            { { 31, -5, 0 }, 40, Pitch::flat },
-            { { 32, -6, 0 }, 40, Pitch::flat },
-            { { 33, -7, 0 }, 38, Pitch::flat },
-            { { 34, -7, 0 }, 38, Pitch::flat },
-            { { 35, -8, 0 }, 38, Pitch::flat },
-            { { 36, -9, 0 }, 38, Pitch::flat },
-            { { 37, -9, 0 }, 38, Pitch::flat },
-            { { 38, -10, 0 }, 38, Pitch::flat },
-            { { 39, -10, 0 }, 38, Pitch::flat },
-            { { 40, -11, 0 }, 38, Pitch::flat },
-            { { 41, -11, 0 }, 36, Pitch::flat },
-            { { 42, -12, 0 }, 36, Pitch::flat },
-            { { 43, -12, 0 }, 36, Pitch::flat },
-            { { 44, -13, 0 }, 36, Pitch::flat },
-            { { 45, -13, 0 }, 36, Pitch::flat },
-            { { 46, -13, 0 }, 36, Pitch::flat },
-            { { 47, -14, 0 }, 36, Pitch::flat },
-            { { 48, -14, 0 }, 36, Pitch::flat },
-            { { 49, -14, 0 }, 36, Pitch::flat },
-            { { 50, -15, 0 }, 34, Pitch::flat },
-            { { 51, -15, 0 }, 34, Pitch::flat },
-            { { 52, -15, 0 }, 34, Pitch::flat },
-            { { 53, -15, 0 }, 34, Pitch::flat },
-            { { 54, -15, 0 }, 34, Pitch::flat },
-            { { 55, -15, 0 }, 34, Pitch::flat },
-            { { 56, -16, 0 }, 34, Pitch::flat },
-            { { 57, -16, 0 }, 34, Pitch::flat },
-            { { 58, -16, 0 }, 34, Pitch::flat },
-            { { 59, -16, 0 }, 32, Pitch::flat },
-            { { 60, -16, 0 }, 32, Pitch::flat },
-            { { 61, -16, 0 }, 32, Pitch::flat },
-            { { 62, -16, 0 }, 32, Pitch::flat },
-        });
-
-    // 0x4e03a8
-    // Track 4. Reversed 1. Direction 0
-    static constexpr auto moveInfoT4R1D0 = std::to_array<MoveInfo>(
-        {
-            { { 16, 0, 0 }, 16, Pitch::flat },
-            { { 16, 1, 0 }, 16, Pitch::flat },
-            { { 16, 2, 0 }, 16, Pitch::flat },
-            { { 16, 3, 0 }, 16, Pitch::flat },
-            { { 16, 4, 0 }, 16, Pitch::flat },
-            { { 16, 5, 0 }, 18, Pitch::flat },
-            { { 16, 6, 0 }, 18, Pitch::flat },
-            { { 17, 7, 0 }, 18, Pitch::flat },
-            { { 17, 8, 0 }, 18, Pitch::flat },
-            { { 17, 9, 0 }, 18, Pitch::flat },
-            { { 17, 10, 0 }, 18, Pitch::flat },
-            { { 17, 11, 0 }, 18, Pitch::flat },
-            { { 17, 12, 0 }, 18, Pitch::flat },
-            { { 18, 13, 0 }, 18, Pitch::flat },
-            { { 18, 14, 0 }, 20, Pitch::flat },
-            { { 18, 15, 0 }, 20, Pitch::flat },
-            { { 19, 16, 0 }, 20, Pitch::flat },
-            { { 19, 17, 0 }, 20, Pitch::flat },
-            { { 19, 18, 0 }, 20, Pitch::flat },
-            { { 20, 19, 0 }, 20, Pitch::flat },
-            { { 20, 20, 0 }, 20, Pitch::flat },
-            { { 21, 21, 0 }, 20, Pitch::flat },
-            { { 21, 22, 0 }, 20, Pitch::flat },
-            { { 22, 23, 0 }, 22, Pitch::flat },
-            { { 22, 24, 0 }, 22, Pitch::flat },
-            { { 23, 25, 0 }, 22, Pitch::flat },
-            { { 23, 26, 0 }, 22, Pitch::flat },
-            { { 24, 27, 0 }, 22, Pitch::flat },
-            { { 25, 28, 0 }, 22, Pitch::flat },
-            { { 25, 29, 0 }, 22, Pitch::flat },
-            { { 26, 30, 0 }, 22, Pitch::flat },
-            { { 27, 31, 0 }, 24, Pitch::flat },
-            { { 28, 32, 0 }, 24, Pitch::flat },
-            { { 29, 33, 0 }, 24, Pitch::flat },
-            { { 29, 35, 0 }, 24, Pitch::flat },
-            { { 30, 36, 0 }, 24, Pitch::flat },
-            { { 31, 37, 0 }, 24, Pitch::flat },
-            { { 32, 38, 0 }, 24, Pitch::flat },
-            { { 33, 39, 0 }, 26, Pitch::flat },
-            { { 34, 39, 0 }, 26, Pitch::flat },
-            { { 35, 40, 0 }, 26, Pitch::flat },
-            { { 36, 41, 0 }, 26, Pitch::flat },
-            { { 37, 41, 0 }, 26, Pitch::flat },
-            { { 38, 42, 0 }, 26, Pitch::flat },
-            { { 39, 42, 0 }, 26, Pitch::flat },
-            { { 40, 43, 0 }, 26, Pitch::flat },
-            { { 41, 43, 0 }, 28, Pitch::flat },
-            { { 42, 44, 0 }, 28, Pitch::flat },
-            { { 43, 44, 0 }, 28, Pitch::flat },
-            { { 44, 45, 0 }, 28, Pitch::flat },
-            { { 45, 45, 0 }, 28, Pitch::flat },
-            { { 46, 45, 0 }, 28, Pitch::flat },
-            { { 47, 46, 0 }, 28, Pitch::flat },
-            { { 48, 46, 0 }, 28, Pitch::flat },
-            { { 49, 46, 0 }, 28, Pitch::flat },
-            { { 50, 47, 0 }, 30, Pitch::flat },
-            { { 51, 47, 0 }, 30, Pitch::flat },
-            { { 52, 47, 0 }, 30, Pitch::flat },
-            { { 53, 47, 0 }, 30, Pitch::flat },
-            { { 54, 47, 0 }, 30, Pitch::flat },
-            { { 55, 47, 0 }, 30, Pitch::flat },
-            { { 56, 48, 0 }, 30, Pitch::flat },
-            { { 57, 48, 0 }, 30, Pitch::flat },
-            { { 58, 48, 0 }, 30, Pitch::flat },
-            { { 59, 48, 0 }, 32, Pitch::flat },
-            { { 60, 48, 0 }, 32, Pitch::flat },
-            { { 61, 48, 0 }, 32, Pitch::flat },
-            { { 62, 48, 0 }, 32, Pitch::flat },
-        });
-
-    // 0x4e05ca
-    // Track 4. Reversed 1. Direction 1
-    static constexpr auto moveInfoT4R1D1 = std::to_array<MoveInfo>(
-        {
-            { { 0, 16, 0 }, 32, Pitch::flat },
-            { { 1, 16, 0 }, 32, Pitch::flat },
-            { { 2, 16, 0 }, 32, Pitch::flat },
-            { { 3, 16, 0 }, 32, Pitch::flat },
-            { { 4, 16, 0 }, 32, Pitch::flat },
-            { { 5, 16, 0 }, 34, Pitch::flat },
-            { { 6, 16, 0 }, 34, Pitch::flat },
-            { { 7, 15, 0 }, 34, Pitch::flat },
-            { { 8, 15, 0 }, 34, Pitch::flat },
-            { { 9, 15, 0 }, 34, Pitch::flat },
-            { { 10, 15, 0 }, 34, Pitch::flat },
-            { { 11, 15, 0 }, 34, Pitch::flat },
-            { { 12, 15, 0 }, 34, Pitch::flat },
-            { { 13, 14, 0 }, 34, Pitch::flat },
-            { { 14, 14, 0 }, 36, Pitch::flat },
-            { { 15, 14, 0 }, 36, Pitch::flat },
-            { { 16, 13, 0 }, 36, Pitch::flat },
-            { { 17, 13, 0 }, 36, Pitch::flat },
-            { { 18, 13, 0 }, 36, Pitch::flat },
-            { { 19, 12, 0 }, 36, Pitch::flat },
-            { { 20, 12, 0 }, 36, Pitch::flat },
-            { { 21, 11, 0 }, 36, Pitch::flat },
-            { { 22, 11, 0 }, 36, Pitch::flat },
-            { { 23, 10, 0 }, 38, Pitch::flat },
-            { { 24, 10, 0 }, 38, Pitch::flat },
-            { { 25, 9, 0 }, 38, Pitch::flat },
-            { { 26, 9, 0 }, 38, Pitch::flat },
-            { { 27, 8, 0 }, 38, Pitch::flat },
-            { { 28, 7, 0 }, 38, Pitch::flat },
-            { { 29, 7, 0 }, 38, Pitch::flat },
-            { { 30, 6, 0 }, 38, Pitch::flat },
-            { { 31, 5, 0 }, 40, Pitch::flat },
-            { { 32, 4, 0 }, 40, Pitch::flat },
-            { { 33, 3, 0 }, 40, Pitch::flat },
-            { { 35, 3, 0 }, 40, Pitch::flat },
-            { { 36, 2, 0 }, 40, Pitch::flat },
-            { { 37, 1, 0 }, 40, Pitch::flat },
-            { { 38, 0, 0 }, 40, Pitch::flat },
-            { { 39, -1, 0 }, 42, Pitch::flat },
-            { { 39, -2, 0 }, 42, Pitch::flat },
-            { { 40, -3, 0 }, 42, Pitch::flat },
-            { { 41, -4, 0 }, 42, Pitch::flat },
-            { { 41, -5, 0 }, 42, Pitch::flat },
-            { { 42, -6, 0 }, 42, Pitch::flat },
-            { { 42, -7, 0 }, 42, Pitch::flat },
-            { { 43, -8, 0 }, 42, Pitch::flat },
-            { { 43, -9, 0 }, 44, Pitch::flat },
-            { { 44, -10, 0 }, 44, Pitch::flat },
-            { { 44, -11, 0 }, 44, Pitch::flat },
-            { { 45, -12, 0 }, 44, Pitch::flat },
-            { { 45, -13, 0 }, 44, Pitch::flat },
-            { { 45, -14, 0 }, 44, Pitch::flat },
-            { { 46, -15, 0 }, 44, Pitch::flat },
-            { { 46, -16, 0 }, 44, Pitch::flat },
-            { { 46, -17, 0 }, 44, Pitch::flat },
-            { { 47, -18, 0 }, 46, Pitch::flat },
-            { { 47, -19, 0 }, 46, Pitch::flat },
-            { { 47, -20, 0 }, 46, Pitch::flat },
-            { { 47, -21, 0 }, 46, Pitch::flat },
-            { { 47, -22, 0 }, 46, Pitch::flat },
-            { { 47, -23, 0 }, 46, Pitch::flat },
-            { { 48, -24, 0 }, 46, Pitch::flat },
-            { { 48, -25, 0 }, 46, Pitch::flat },
-            { { 48, -26, 0 }, 46, Pitch::flat },
-            { { 48, -27, 0 }, 48, Pitch::flat },
-            { { 48, -28, 0 }, 48, Pitch::flat },
-            { { 48, -29, 0 }, 48, Pitch::flat },
-            { { 48, -30, 0 }, 48, Pitch::flat },
-            { { 48, -31, 0 }, 48, Pitch::flat },
-        });
-
-    // 0x4e07f4
-    // Track 4. Reversed 1. Direction 2
-    static constexpr auto moveInfoT4R1D2 = std::to_array<MoveInfo>(
-        {
-            { { 16, 31, 0 }, 48, Pitch::flat },
-            { { 16, 30, 0 }, 48, Pitch::flat },
-            { { 16, 29, 0 }, 48, Pitch::flat },
-            { { 16, 28, 0 }, 48, Pitch::flat },
-            { { 16, 27, 0 }, 50, Pitch::flat },
-            { { 16, 26, 0 }, 50, Pitch::flat },
-            { { 15, 25, 0 }, 50, Pitch::flat },
-            { { 15, 24, 0 }, 50, Pitch::flat },
-            { { 15, 23, 0 }, 50, Pitch::flat },
-            { { 15, 22, 0 }, 50, Pitch::flat },
-            { { 15, 21, 0 }, 50, Pitch::flat },
-            { { 15, 20, 0 }, 50, Pitch::flat },
-            { { 14, 19, 0 }, 50, Pitch::flat },
-            { { 14, 18, 0 }, 52, Pitch::flat },
-            { { 14, 17, 0 }, 52, Pitch::flat },
-            { { 13, 16, 0 }, 52, Pitch::flat },
-            { { 13, 15, 0 }, 52, Pitch::flat },
-            { { 13, 14, 0 }, 52, Pitch::flat },
-            { { 12, 13, 0 }, 52, Pitch::flat },
-            { { 12, 12, 0 }, 52, Pitch::flat },
-            { { 11, 11, 0 }, 52, Pitch::flat },
-            { { 11, 10, 0 }, 52, Pitch::flat },
-            { { 10, 9, 0 }, 54, Pitch::flat },
-            { { 10, 8, 0 }, 54, Pitch::flat },
-            { { 9, 7, 0 }, 54, Pitch::flat },
-            { { 9, 6, 0 }, 54, Pitch::flat },
-            { { 8, 5, 0 }, 54, Pitch::flat },
-            { { 7, 4, 0 }, 54, Pitch::flat },
-            { { 7, 3, 0 }, 54, Pitch::flat },
-            { { 6, 2, 0 }, 54, Pitch::flat },
-            { { 5, 1, 0 }, 56, Pitch::flat },
-            { { 4, 0, 0 }, 56, Pitch::flat },
-            { { 3, -1, 0 }, 56, Pitch::flat },
-            { { 3, -3, 0 }, 56, Pitch::flat },
-            { { 2, -4, 0 }, 56, Pitch::flat },
-            { { 1, -5, 0 }, 56, Pitch::flat },
-            { { 0, -6, 0 }, 56, Pitch::flat },
-            { { -1, -7, 0 }, 58, Pitch::flat },
-            { { -2, -7, 0 }, 58, Pitch::flat },
-            { { -3, -8, 0 }, 58, Pitch::flat },
-            { { -4, -9, 0 }, 58, Pitch::flat },
-            { { -5, -9, 0 }, 58, Pitch::flat },
-            { { -6, -10, 0 }, 58, Pitch::flat },
-            { { -7, -10, 0 }, 58, Pitch::flat },
-            { { -8, -11, 0 }, 58, Pitch::flat },
-            { { -9, -11, 0 }, 60, Pitch::flat },
-            { { -10, -12, 0 }, 60, Pitch::flat },
-            { { -11, -12, 0 }, 60, Pitch::flat },
-            { { -12, -13, 0 }, 60, Pitch::flat },
-            { { -13, -13, 0 }, 60, Pitch::flat },
-            { { -14, -13, 0 }, 60, Pitch::flat },
-            { { -15, -14, 0 }, 60, Pitch::flat },
-            { { -16, -14, 0 }, 60, Pitch::flat },
-            { { -17, -14, 0 }, 60, Pitch::flat },
-            { { -18, -15, 0 }, 62, Pitch::flat },
-            { { -19, -15, 0 }, 62, Pitch::flat },
-            { { -20, -15, 0 }, 62, Pitch::flat },
-            { { -21, -15, 0 }, 62, Pitch::flat },
-            { { -22, -15, 0 }, 62, Pitch::flat },
-            { { -23, -15, 0 }, 62, Pitch::flat },
-            { { -24, -16, 0 }, 62, Pitch::flat },
-            { { -25, -16, 0 }, 62, Pitch::flat },
-            { { -26, -16, 0 }, 62, Pitch::flat },
-            { { -27, -16, 0 }, 0, Pitch::flat },
-            { { -28, -16, 0 }, 0, Pitch::flat },
-            { { -29, -16, 0 }, 0, Pitch::flat },
-            { { -30, -16, 0 }, 0, Pitch::flat },
-            { { -31, -16, 0 }, 0, Pitch::flat },
-        });
-
-    // 0x4e018e
-    // Track 4. Reversed 1. Direction 3
-    static constexpr auto moveInfoT4R1D3 = std::to_array<MoveInfo>(
-        {
-            { { 31, 16, 0 }, 0, Pitch::flat },
-            { { 30, 16, 0 }, 0, Pitch::flat },
-            { { 29, 16, 0 }, 0, Pitch::flat },
-            { { 28, 16, 0 }, 0, Pitch::flat },
-            { { 27, 16, 0 }, 2, Pitch::flat },
-            { { 26, 16, 0 }, 2, Pitch::flat },
-            { { 25, 17, 0 }, 2, Pitch::flat },
-            { { 24, 17, 0 }, 2, Pitch::flat },
-            { { 23, 17, 0 }, 2, Pitch::flat },
-            { { 22, 17, 0 }, 2, Pitch::flat },
-            { { 21, 17, 0 }, 2, Pitch::flat },
-            { { 20, 17, 0 }, 2, Pitch::flat },
-            { { 19, 18, 0 }, 2, Pitch::flat },
-            { { 18, 18, 0 }, 4, Pitch::flat },
-            { { 17, 18, 0 }, 4, Pitch::flat },
-            { { 16, 19, 0 }, 4, Pitch::flat },
-            { { 15, 19, 0 }, 4, Pitch::flat },
-            { { 14, 19, 0 }, 4, Pitch::flat },
-            { { 13, 20, 0 }, 4, Pitch::flat },
-            { { 12, 20, 0 }, 4, Pitch::flat },
-            { { 11, 21, 0 }, 4, Pitch::flat },
-            { { 10, 21, 0 }, 4, Pitch::flat },
-            { { 9, 22, 0 }, 6, Pitch::flat },
-            { { 8, 22, 0 }, 6, Pitch::flat },
-            { { 7, 23, 0 }, 6, Pitch::flat },
-            { { 6, 23, 0 }, 6, Pitch::flat },
-            { { 5, 24, 0 }, 6, Pitch::flat },
-            { { 4, 25, 0 }, 6, Pitch::flat },
-            { { 3, 25, 0 }, 6, Pitch::flat },
-            { { 2, 26, 0 }, 6, Pitch::flat },
-            { { 1, 27, 0 }, 8, Pitch::flat },
-            { { 0, 28, 0 }, 8, Pitch::flat },
-            { { -1, 29, 0 }, 8, Pitch::flat },
-            { { -3, 29, 0 }, 8, Pitch::flat },
-            { { -4, 30, 0 }, 8, Pitch::flat },
-            { { -5, 31, 0 }, 8, Pitch::flat },
-            { { -6, 32, 0 }, 8, Pitch::flat },
-            { { -7, 33, 0 }, 10, Pitch::flat },
-            { { -7, 34, 0 }, 10, Pitch::flat },
-            { { -8, 35, 0 }, 10, Pitch::flat },
-            { { -9, 36, 0 }, 10, Pitch::flat },
-            { { -9, 37, 0 }, 10, Pitch::flat },
-            { { -10, 38, 0 }, 10, Pitch::flat },
-            { { -10, 39, 0 }, 10, Pitch::flat },
-            { { -11, 40, 0 }, 10, Pitch::flat },
-            { { -11, 41, 0 }, 12, Pitch::flat },
-            { { -12, 42, 0 }, 12, Pitch::flat },
-            { { -12, 43, 0 }, 12, Pitch::flat },
-            { { -13, 44, 0 }, 12, Pitch::flat },
-            { { -13, 45, 0 }, 12, Pitch::flat },
-            { { -13, 46, 0 }, 12, Pitch::flat },
-            { { -14, 47, 0 }, 12, Pitch::flat },
-            { { -14, 48, 0 }, 12, Pitch::flat },
-            { { -14, 49, 0 }, 12, Pitch::flat },
-            { { -15, 50, 0 }, 14, Pitch::flat },
-            { { -15, 51, 0 }, 14, Pitch::flat },
-            { { -15, 52, 0 }, 14, Pitch::flat },
-            { { -15, 53, 0 }, 14, Pitch::flat },
-            { { -15, 54, 0 }, 14, Pitch::flat },
-            { { -15, 55, 0 }, 14, Pitch::flat },
-            { { -16, 56, 0 }, 14, Pitch::flat },
-            { { -16, 57, 0 }, 14, Pitch::flat },
-            { { -16, 58, 0 }, 14, Pitch::flat },
-            { { -16, 59, 0 }, 16, Pitch::flat },
-            { { -16, 60, 0 }, 16, Pitch::flat },
-            { { -16, 61, 0 }, 16, Pitch::flat },
-            { { -16, 62, 0 }, 16, Pitch::flat },
-        });
-
-    // 0x4e0a16
-    // Track 6. Reversed 0. Direction 0
-    static constexpr auto moveInfoT6R0D0 = std::to_array<MoveInfo>(
-        {
-            { { 31, 16, 0 }, 0, Pitch::flat },
-            { { 30, 16, 0 }, 0, Pitch::flat },
-            { { 29, 16, 0 }, 0, Pitch::flat },
-            { { 28, 16, 0 }, 0, Pitch::flat },
-            { { 27, 16, 0 }, 0, Pitch::flat },
-            { { 26, 16, 0 }, 0, Pitch::flat },
-            { { 25, 16, 0 }, 0, Pitch::flat },
-            { { 24, 16, 0 }, 62, Pitch::flat },
-            { { 23, 15, 0 }, 62, Pitch::flat },
-            { { 22, 15, 0 }, 62, Pitch::flat },
-            { { 21, 15, 0 }, 62, Pitch::flat },
-            { { 20, 15, 0 }, 62, Pitch::flat },
-            { { 19, 15, 0 }, 62, Pitch::flat },
-            { { 18, 15, 0 }, 62, Pitch::flat },
-            { { 17, 14, 0 }, 62, Pitch::flat },
-            { { 16, 14, 0 }, 62, Pitch::flat },
-            { { 15, 14, 0 }, 62, Pitch::flat },
-            { { 14, 14, 0 }, 62, Pitch::flat },
-            { { 13, 14, 0 }, 62, Pitch::flat },
-            { { 12, 13, 0 }, 62, Pitch::flat },
-            { { 11, 13, 0 }, 62, Pitch::flat },
-            { { 10, 13, 0 }, 62, Pitch::flat },
-            { { 9, 13, 0 }, 62, Pitch::flat },
-            { { 8, 12, 0 }, 60, Pitch::flat },
-            { { 7, 12, 0 }, 60, Pitch::flat },
-            { { 6, 12, 0 }, 60, Pitch::flat },
-            { { 5, 11, 0 }, 60, Pitch::flat },
-            { { 4, 11, 0 }, 60, Pitch::flat },
-            { { 3, 11, 0 }, 60, Pitch::flat },
-            { { 2, 10, 0 }, 60, Pitch::flat },
-            { { 1, 10, 0 }, 60, Pitch::flat },
-            { { 0, 9, 0 }, 60, Pitch::flat },
-            { { -1, 9, 0 }, 60, Pitch::flat },
-            { { -2, 8, 0 }, 60, Pitch::flat },
-            { { -3, 8, 0 }, 60, Pitch::flat },
-            { { -4, 7, 0 }, 60, Pitch::flat },
-            { { -5, 7, 0 }, 60, Pitch::flat },
-            { { -6, 6, 0 }, 60, Pitch::flat },
-            { { -7, 6, 0 }, 58, Pitch::flat },
-            { { -8, 5, 0 }, 58, Pitch::flat },
-            { { -9, 4, 0 }, 58, Pitch::flat },
-            { { -10, 4, 0 }, 58, Pitch::flat },
-            { { -11, 3, 0 }, 58, Pitch::flat },
-            { { -12, 2, 0 }, 58, Pitch::flat },
-            { { -13, 2, 0 }, 58, Pitch::flat },
-            { { -14, 1, 0 }, 58, Pitch::flat },
-            { { -15, 0, 0 }, 58, Pitch::flat },
-            { { -16, 0, 0 }, 58, Pitch::flat },
-            { { -17, -1, 0 }, 58, Pitch::flat },
-            { { -18, -2, 0 }, 58, Pitch::flat },
-            { { -19, -3, 0 }, 56, Pitch::flat },
-            { { -20, -3, 0 }, 56, Pitch::flat },
-            { { -21, -4, 0 }, 56, Pitch::flat },
-            { { -22, -5, 0 }, 56, Pitch::flat },
-            { { -23, -6, 0 }, 56, Pitch::flat },
-            { { -24, -7, 0 }, 56, Pitch::flat },
-            { { -25, -7, 0 }, 56, Pitch::flat },
-            { { -26, -8, 0 }, 56, Pitch::flat },
-            { { -27, -9, 0 }, 56, Pitch::flat },
-            { { -28, -10, 0 }, 56, Pitch::flat },
-            { { -29, -11, 0 }, 56, Pitch::flat },
-            { { -29, -12, 0 }, 56, Pitch::flat },
-            { { -30, -13, 0 }, 54, Pitch::flat },
-            { { -31, -14, 0 }, 54, Pitch::flat },
-            { { -32, -15, 0 }, 54, Pitch::flat },
-            { { -32, -16, 0 }, 54, Pitch::flat },
-            { { -33, -17, 0 }, 54, Pitch::flat },
-            { { -34, -18, 0 }, 54, Pitch::flat },
-            { { -34, -19, 0 }, 54, Pitch::flat },
-            { { -35, -20, 0 }, 54, Pitch::flat },
-            { { -36, -21, 0 }, 54, Pitch::flat },
-            { { -36, -22, 0 }, 54, Pitch::flat },
-            { { -37, -23, 0 }, 54, Pitch::flat },
-            { { -38, -24, 0 }, 54, Pitch::flat },
-            { { -38, -25, 0 }, 52, Pitch::flat },
-            { { -39, -26, 0 }, 52, Pitch::flat },
-            { { -39, -27, 0 }, 52, Pitch::flat },
-            { { -40, -28, 0 }, 52, Pitch::flat },
-            { { -40, -29, 0 }, 52, Pitch::flat },
-            { { -41, -30, 0 }, 52, Pitch::flat },
-            { { -41, -31, 0 }, 52, Pitch::flat },
-            { { -42, -32, 0 }, 52, Pitch::flat },
-            { { -42, -33, 0 }, 52, Pitch::flat },
-            { { -43, -34, 0 }, 52, Pitch::flat },
-            { { -43, -35, 0 }, 52, Pitch::flat },
-            { { -43, -36, 0 }, 52, Pitch::flat },
-            { { -44, -37, 0 }, 52, Pitch::flat },
-            { { -44, -38, 0 }, 50, Pitch::flat },
-            { { -44, -39, 0 }, 50, Pitch::flat },
-            { { -45, -40, 0 }, 50, Pitch::flat },
-            { { -45, -41, 0 }, 50, Pitch::flat },
-            { { -45, -42, 0 }, 50, Pitch::flat },
-            { { -45, -43, 0 }, 50, Pitch::flat },
-            { { -46, -44, 0 }, 50, Pitch::flat },
-            { { -46, -45, 0 }, 50, Pitch::flat },
-            { { -46, -46, 0 }, 50, Pitch::flat },
-            { { -46, -47, 0 }, 50, Pitch::flat },
-            { { -46, -48, 0 }, 50, Pitch::flat },
-            { { -47, -49, 0 }, 50, Pitch::flat },
-            { { -47, -50, 0 }, 50, Pitch::flat },
-            { { -47, -51, 0 }, 50, Pitch::flat },
-            { { -47, -52, 0 }, 50, Pitch::flat },
-            { { -47, -53, 0 }, 50, Pitch::flat },
-            { { -47, -54, 0 }, 50, Pitch::flat },
-            { { -48, -55, 0 }, 50, Pitch::flat },
-            { { -48, -56, 0 }, 48, Pitch::flat },
-            { { -48, -57, 0 }, 48, Pitch::flat },
-            { { -48, -58, 0 }, 48, Pitch::flat },
-            { { -48, -59, 0 }, 48, Pitch::flat },
-            { { -48, -60, 0 }, 48, Pitch::flat },
-            { { -48, -61, 0 }, 48, Pitch::flat },
-            { { -48, -62, 0 }, 48, Pitch::flat },
-            { { -48, -63, 0 }, 48, Pitch::flat },
-            { { -48, -64, 0 }, 48, Pitch::flat },
-        });
-
-    // 0x4e0da8
-    // Track 6. Reversed 0. Direction 1
-    static constexpr auto moveInfoT6R0D1 = std::to_array<MoveInfo>(
-        {
-            { { 16, 0, 0 }, 16, Pitch::flat },
-            { { 16, 1, 0 }, 16, Pitch::flat },
-            { { 16, 2, 0 }, 16, Pitch::flat },
-            { { 16, 3, 0 }, 16, Pitch::flat },
-            { { 16, 4, 0 }, 16, Pitch::flat },
-            { { 16, 5, 0 }, 16, Pitch::flat },
-            { { 16, 6, 0 }, 16, Pitch::flat },
-            { { 16, 7, 0 }, 16, Pitch::flat },
-            { { 16, 8, 0 }, 14, Pitch::flat },
-            { { 15, 9, 0 }, 14, Pitch::flat },
-            { { 15, 10, 0 }, 14, Pitch::flat },
-            { { 15, 11, 0 }, 14, Pitch::flat },
-            { { 15, 12, 0 }, 14, Pitch::flat },
-            { { 15, 13, 0 }, 14, Pitch::flat },
-            { { 15, 14, 0 }, 14, Pitch::flat },
-            { { 14, 15, 0 }, 14, Pitch::flat },
-            { { 14, 16, 0 }, 14, Pitch::flat },
-            { { 14, 17, 0 }, 14, Pitch::flat },
-            { { 14, 18, 0 }, 14, Pitch::flat },
-            { { 14, 19, 0 }, 14, Pitch::flat },
-            { { 13, 20, 0 }, 14, Pitch::flat },
-            { { 13, 21, 0 }, 14, Pitch::flat },
-            { { 13, 22, 0 }, 14, Pitch::flat },
-            { { 13, 23, 0 }, 14, Pitch::flat },
-            { { 12, 24, 0 }, 12, Pitch::flat },
-            { { 12, 25, 0 }, 12, Pitch::flat },
-            { { 12, 26, 0 }, 12, Pitch::flat },
-            { { 11, 27, 0 }, 12, Pitch::flat },
-            { { 11, 28, 0 }, 12, Pitch::flat },
-            { { 11, 29, 0 }, 12, Pitch::flat },
-            { { 10, 30, 0 }, 12, Pitch::flat },
-            { { 10, 31, 0 }, 12, Pitch::flat },
-            { { 9, 32, 0 }, 12, Pitch::flat },
-            { { 9, 33, 0 }, 12, Pitch::flat },
-            { { 8, 34, 0 }, 12, Pitch::flat },
-            { { 8, 35, 0 }, 12, Pitch::flat },
-            { { 7, 36, 0 }, 12, Pitch::flat },
-            { { 7, 37, 0 }, 12, Pitch::flat },
-            { { 6, 38, 0 }, 12, Pitch::flat },
-            { { 6, 39, 0 }, 10, Pitch::flat },
-            { { 5, 40, 0 }, 10, Pitch::flat },
-            { { 4, 41, 0 }, 10, Pitch::flat },
-            { { 4, 42, 0 }, 10, Pitch::flat },
-            { { 3, 43, 0 }, 10, Pitch::flat },
-            { { 2, 44, 0 }, 10, Pitch::flat },
-            { { 2, 45, 0 }, 10, Pitch::flat },
-            { { 1, 46, 0 }, 10, Pitch::flat },
-            { { 0, 47, 0 }, 10, Pitch::flat },
-            { { 0, 48, 0 }, 10, Pitch::flat },
-            { { -1, 49, 0 }, 10, Pitch::flat },
-            { { -2, 50, 0 }, 10, Pitch::flat },
-            { { -3, 51, 0 }, 8, Pitch::flat },
-            { { -3, 52, 0 }, 8, Pitch::flat },
-            { { -4, 53, 0 }, 8, Pitch::flat },
-            { { -5, 54, 0 }, 8, Pitch::flat },
-            { { -6, 55, 0 }, 8, Pitch::flat },
-            { { -7, 56, 0 }, 8, Pitch::flat },
-            { { -7, 57, 0 }, 8, Pitch::flat },
-            { { -8, 58, 0 }, 8, Pitch::flat },
-            { { -9, 59, 0 }, 8, Pitch::flat },
-            { { -10, 60, 0 }, 8, Pitch::flat },
-            { { -11, 61, 0 }, 8, Pitch::flat },
-            { { -12, 61, 0 }, 8, Pitch::flat },
-            { { -13, 62, 0 }, 6, Pitch::flat },
-            { { -14, 63, 0 }, 6, Pitch::flat },
-            { { -15, 64, 0 }, 6, Pitch::flat },
-            { { -16, 64, 0 }, 6, Pitch::flat },
-            { { -17, 65, 0 }, 6, Pitch::flat },
-            { { -18, 66, 0 }, 6, Pitch::flat },
-            { { -19, 66, 0 }, 6, Pitch::flat },
-            { { -20, 67, 0 }, 6, Pitch::flat },
-            { { -21, 68, 0 }, 6, Pitch::flat },
-            { { -22, 68, 0 }, 6, Pitch::flat },
-            { { -23, 69, 0 }, 6, Pitch::flat },
-            { { -24, 70, 0 }, 6, Pitch::flat },
-            { { -25, 70, 0 }, 4, Pitch::flat },
-            { { -26, 71, 0 }, 4, Pitch::flat },
-            { { -27, 71, 0 }, 4, Pitch::flat },
-            { { -28, 72, 0 }, 4, Pitch::flat },
-            { { -29, 72, 0 }, 4, Pitch::flat },
-            { { -30, 73, 0 }, 4, Pitch::flat },
-            { { -31, 73, 0 }, 4, Pitch::flat },
-            { { -32, 74, 0 }, 4, Pitch::flat },
-            { { -33, 74, 0 }, 4, Pitch::flat },
-            { { -34, 75, 0 }, 4, Pitch::flat },
-            { { -35, 75, 0 }, 4, Pitch::flat },
-            { { -36, 75, 0 }, 4, Pitch::flat },
-            { { -37, 76, 0 }, 4, Pitch::flat },
-            { { -38, 76, 0 }, 2, Pitch::flat },
-            { { -39, 76, 0 }, 2, Pitch::flat },
-            { { -40, 77, 0 }, 2, Pitch::flat },
-            { { -41, 77, 0 }, 2, Pitch::flat },
-            { { -42, 77, 0 }, 2, Pitch::flat },
-            { { -43, 77, 0 }, 2, Pitch::flat },
-            { { -44, 78, 0 }, 2, Pitch::flat },
-            { { -45, 78, 0 }, 2, Pitch::flat },
-            { { -46, 78, 0 }, 2, Pitch::flat },
-            { { -47, 78, 0 }, 2, Pitch::flat },
-            { { -48, 78, 0 }, 2, Pitch::flat },
-            { { -49, 79, 0 }, 2, Pitch::flat },
-            { { -50, 79, 0 }, 2, Pitch::flat },
-            { { -51, 79, 0 }, 2, Pitch::flat },
-            { { -52, 79, 0 }, 2, Pitch::flat },
-            { { -53, 79, 0 }, 2, Pitch::flat },
-            { { -54, 79, 0 }, 2, Pitch::flat },
-            { { -55, 80, 0 }, 2, Pitch::flat },
-            { { -56, 80, 0 }, 0, Pitch::flat },
-            { { -57, 80, 0 }, 0, Pitch::flat },
-            { { -58, 80, 0 }, 0, Pitch::flat },
-            { { -59, 80, 0 }, 0, Pitch::flat },
-            { { -60, 80, 0 }, 0, Pitch::flat },
-            { { -61, 80, 0 }, 0, Pitch::flat },
-            { { -62, 80, 0 }, 0, Pitch::flat },
-            { { -63, 80, 0 }, 0, Pitch::flat },
-            { { -64, 80, 0 }, 0, Pitch::flat },
-        });
-
-    // 0x4e1142
-    // Track 6. Reversed 0. Direction 2
-    static constexpr auto moveInfoT6R0D2 = std::to_array<MoveInfo>(
-        {
-            { { 0, 16, 0 }, 32, Pitch::flat },
-            { { 1, 16, 0 }, 32, Pitch::flat },
-            { { 2, 16, 0 }, 32, Pitch::flat },
-            { { 3, 16, 0 }, 32, Pitch::flat },
-            { { 4, 16, 0 }, 32, Pitch::flat },
-            { { 5, 16, 0 }, 32, Pitch::flat },
-            { { 6, 16, 0 }, 32, Pitch::flat },
-            { { 7, 16, 0 }, 32, Pitch::flat },
-            { { 8, 16, 0 }, 30, Pitch::flat },
-            { { 9, 17, 0 }, 30, Pitch::flat },
-            { { 10, 17, 0 }, 30, Pitch::flat },
-            { { 11, 17, 0 }, 30, Pitch::flat },
-            { { 12, 17, 0 }, 30, Pitch::flat },
-            { { 13, 17, 0 }, 30, Pitch::flat },
-            { { 14, 17, 0 }, 30, Pitch::flat },
-            { { 15, 18, 0 }, 30, Pitch::flat },
-            { { 16, 18, 0 }, 30, Pitch::flat },
-            { { 17, 18, 0 }, 30, Pitch::flat },
-            { { 18, 18, 0 }, 30, Pitch::flat },
-            { { 19, 18, 0 }, 30, Pitch::flat },
-            { { 20, 19, 0 }, 30, Pitch::flat },
-            { { 21, 19, 0 }, 30, Pitch::flat },
-            { { 22, 19, 0 }, 30, Pitch::flat },
-            { { 23, 19, 0 }, 30, Pitch::flat },
-            { { 24, 20, 0 }, 28, Pitch::flat },
-            { { 25, 20, 0 }, 28, Pitch::flat },
-            { { 26, 20, 0 }, 28, Pitch::flat },
-            { { 27, 21, 0 }, 28, Pitch::flat },
-            { { 28, 21, 0 }, 28, Pitch::flat },
-            { { 29, 21, 0 }, 28, Pitch::flat },
-            { { 30, 22, 0 }, 28, Pitch::flat },
-            { { 31, 22, 0 }, 28, Pitch::flat },
-            { { 32, 23, 0 }, 28, Pitch::flat },
-            { { 33, 23, 0 }, 28, Pitch::flat },
-            { { 34, 24, 0 }, 28, Pitch::flat },
-            { { 35, 24, 0 }, 28, Pitch::flat },
-            { { 36, 25, 0 }, 28, Pitch::flat },
-            { { 37, 25, 0 }, 28, Pitch::flat },
-            { { 38, 26, 0 }, 28, Pitch::flat },
-            { { 39, 26, 0 }, 26, Pitch::flat },
-            { { 40, 27, 0 }, 26, Pitch::flat },
-            { { 41, 28, 0 }, 26, Pitch::flat },
-            { { 42, 28, 0 }, 26, Pitch::flat },
-            { { 43, 29, 0 }, 26, Pitch::flat },
-            { { 44, 30, 0 }, 26, Pitch::flat },
-            { { 45, 30, 0 }, 26, Pitch::flat },
-            { { 46, 31, 0 }, 26, Pitch::flat },
-            { { 47, 32, 0 }, 26, Pitch::flat },
-            { { 48, 32, 0 }, 26, Pitch::flat },
-            { { 49, 33, 0 }, 26, Pitch::flat },
-            { { 50, 34, 0 }, 26, Pitch::flat },
-            { { 51, 35, 0 }, 24, Pitch::flat },
-            { { 52, 35, 0 }, 24, Pitch::flat },
-            { { 53, 36, 0 }, 24, Pitch::flat },
-            { { 54, 37, 0 }, 24, Pitch::flat },
-            { { 55, 38, 0 }, 24, Pitch::flat },
-            { { 56, 39, 0 }, 24, Pitch::flat },
-            { { 57, 39, 0 }, 24, Pitch::flat },
-            { { 58, 40, 0 }, 24, Pitch::flat },
-            { { 59, 41, 0 }, 24, Pitch::flat },
-            { { 60, 42, 0 }, 24, Pitch::flat },
-            { { 61, 43, 0 }, 24, Pitch::flat },
-            { { 61, 44, 0 }, 24, Pitch::flat },
-            { { 62, 45, 0 }, 22, Pitch::flat },
-            { { 63, 46, 0 }, 22, Pitch::flat },
-            { { 64, 47, 0 }, 22, Pitch::flat },
-            { { 64, 48, 0 }, 22, Pitch::flat },
-            { { 65, 49, 0 }, 22, Pitch::flat },
-            { { 66, 50, 0 }, 22, Pitch::flat },
-            { { 66, 51, 0 }, 22, Pitch::flat },
-            { { 67, 52, 0 }, 22, Pitch::flat },
-            { { 68, 53, 0 }, 22, Pitch::flat },
-            { { 68, 54, 0 }, 22, Pitch::flat },
-            { { 69, 55, 0 }, 22, Pitch::flat },
-            { { 70, 56, 0 }, 22, Pitch::flat },
-            { { 70, 57, 0 }, 20, Pitch::flat },
-            { { 71, 58, 0 }, 20, Pitch::flat },
-            { { 71, 59, 0 }, 20, Pitch::flat },
-            { { 72, 60, 0 }, 20, Pitch::flat },
-            { { 72, 61, 0 }, 20, Pitch::flat },
-            { { 73, 62, 0 }, 20, Pitch::flat },
-            { { 73, 63, 0 }, 20, Pitch::flat },
-            { { 74, 64, 0 }, 20, Pitch::flat },
-            { { 74, 65, 0 }, 20, Pitch::flat },
-            { { 75, 66, 0 }, 20, Pitch::flat },
-            { { 75, 67, 0 }, 20, Pitch::flat },
-            { { 75, 68, 0 }, 20, Pitch::flat },
-            { { 76, 69, 0 }, 20, Pitch::flat },
-            { { 76, 70, 0 }, 18, Pitch::flat },
-            { { 76, 71, 0 }, 18, Pitch::flat },
-            { { 77, 72, 0 }, 18, Pitch::flat },
-            { { 77, 73, 0 }, 18, Pitch::flat },
-            { { 77, 74, 0 }, 18, Pitch::flat },
-            { { 77, 75, 0 }, 18, Pitch::flat },
-            { { 78, 76, 0 }, 18, Pitch::flat },
-            { { 78, 77, 0 }, 18, Pitch::flat },
-            { { 78, 78, 0 }, 18, Pitch::flat },
-            { { 78, 79, 0 }, 18, Pitch::flat },
-            { { 78, 80, 0 }, 18, Pitch::flat },
-            { { 79, 81, 0 }, 18, Pitch::flat },
-            { { 79, 82, 0 }, 18, Pitch::flat },
-            { { 79, 83, 0 }, 18, Pitch::flat },
-            { { 79, 84, 0 }, 18, Pitch::flat },
-            { { 79, 85, 0 }, 18, Pitch::flat },
-            { { 79, 86, 0 }, 18, Pitch::flat },
-            { { 80, 87, 0 }, 18, Pitch::flat },
-            { { 80, 88, 0 }, 16, Pitch::flat },
-            { { 80, 89, 0 }, 16, Pitch::flat },
-            { { 80, 90, 0 }, 16, Pitch::flat },
-            { { 80, 91, 0 }, 16, Pitch::flat },
-            { { 80, 92, 0 }, 16, Pitch::flat },
-            { { 80, 93, 0 }, 16, Pitch::flat },
-            { { 80, 94, 0 }, 16, Pitch::flat },
-            { { 80, 95, 0 }, 16, Pitch::flat },
-        });
-
-    // 0x4e14d4
-    // Track 6. Reversed 0. Direction 3
-    static constexpr auto moveInfoT6R0D3 = std::to_array<MoveInfo>(
-        {
-            { { 16, 31, 0 }, 48, Pitch::flat },
-            { { 16, 30, 0 }, 48, Pitch::flat },
-            { { 16, 29, 0 }, 48, Pitch::flat },
-            { { 16, 28, 0 }, 48, Pitch::flat },
-            { { 16, 27, 0 }, 48, Pitch::flat },
-            { { 16, 26, 0 }, 48, Pitch::flat },
-            { { 16, 25, 0 }, 48, Pitch::flat },
-            { { 16, 24, 0 }, 46, Pitch::flat },
-            { { 17, 23, 0 }, 46, Pitch::flat },
-            { { 17, 22, 0 }, 46, Pitch::flat },
-            { { 17, 21, 0 }, 46, Pitch::flat },
-            { { 17, 20, 0 }, 46, Pitch::flat },
-            { { 17, 19, 0 }, 46, Pitch::flat },
-            { { 17, 18, 0 }, 46, Pitch::flat },
-            { { 18, 17, 0 }, 46, Pitch::flat },
-            { { 18, 16, 0 }, 46, Pitch::flat },
-            { { 18, 15, 0 }, 46, Pitch::flat },
-            { { 18, 14, 0 }, 46, Pitch::flat },
-            { { 18, 13, 0 }, 46, Pitch::flat },
-            { { 19, 12, 0 }, 46, Pitch::flat },
-            { { 19, 11, 0 }, 46, Pitch::flat },
-            { { 19, 10, 0 }, 46, Pitch::flat },
-            { { 19, 9, 0 }, 46, Pitch::flat },
-            { { 20, 8, 0 }, 44, Pitch::flat },
-            { { 20, 7, 0 }, 44, Pitch::flat },
-            { { 20, 6, 0 }, 44, Pitch::flat },
-            { { 21, 5, 0 }, 44, Pitch::flat },
-            { { 21, 4, 0 }, 44, Pitch::flat },
-            { { 21, 3, 0 }, 44, Pitch::flat },
-            { { 22, 2, 0 }, 44, Pitch::flat },
-            { { 22, 1, 0 }, 44, Pitch::flat },
-            { { 23, 0, 0 }, 44, Pitch::flat },
-            { { 23, -1, 0 }, 44, Pitch::flat },
-            { { 24, -2, 0 }, 44, Pitch::flat },
-            { { 24, -3, 0 }, 44, Pitch::flat },
-            { { 25, -4, 0 }, 44, Pitch::flat },
-            { { 25, -5, 0 }, 44, Pitch::flat },
-            { { 26, -6, 0 }, 44, Pitch::flat },
-            { { 26, -7, 0 }, 42, Pitch::flat },
-            { { 27, -8, 0 }, 42, Pitch::flat },
-            { { 28, -9, 0 }, 42, Pitch::flat },
-            { { 28, -10, 0 }, 42, Pitch::flat },
-            { { 29, -11, 0 }, 42, Pitch::flat },
-            { { 30, -12, 0 }, 42, Pitch::flat },
-            { { 30, -13, 0 }, 42, Pitch::flat },
-            { { 31, -14, 0 }, 42, Pitch::flat },
-            { { 32, -15, 0 }, 42, Pitch::flat },
-            { { 32, -16, 0 }, 42, Pitch::flat },
-            { { 33, -17, 0 }, 42, Pitch::flat },
-            { { 34, -18, 0 }, 42, Pitch::flat },
-            { { 35, -19, 0 }, 40, Pitch::flat },
-            { { 35, -20, 0 }, 40, Pitch::flat },
-            { { 36, -21, 0 }, 40, Pitch::flat },
-            { { 37, -22, 0 }, 40, Pitch::flat },
-            { { 38, -23, 0 }, 40, Pitch::flat },
-            { { 39, -24, 0 }, 40, Pitch::flat },
-            { { 39, -25, 0 }, 40, Pitch::flat },
-            { { 40, -26, 0 }, 40, Pitch::flat },
-            { { 41, -27, 0 }, 40, Pitch::flat },
-            { { 42, -28, 0 }, 40, Pitch::flat },
-            { { 43, -29, 0 }, 40, Pitch::flat },
-            { { 44, -29, 0 }, 40, Pitch::flat },
-            { { 45, -30, 0 }, 38, Pitch::flat },
-            { { 46, -31, 0 }, 38, Pitch::flat },
-            { { 47, -32, 0 }, 38, Pitch::flat },
-            { { 48, -32, 0 }, 38, Pitch::flat },
-            { { 49, -33, 0 }, 38, Pitch::flat },
-            { { 50, -34, 0 }, 38, Pitch::flat },
-            { { 51, -34, 0 }, 38, Pitch::flat },
-            { { 52, -35, 0 }, 38, Pitch::flat },
-            { { 53, -36, 0 }, 38, Pitch::flat },
-            { { 54, -36, 0 }, 38, Pitch::flat },
-            { { 55, -37, 0 }, 38, Pitch::flat },
-            { { 56, -38, 0 }, 38, Pitch::flat },
-            { { 57, -38, 0 }, 36, Pitch::flat },
-            { { 58, -39, 0 }, 36, Pitch::flat },
-            { { 59, -39, 0 }, 36, Pitch::flat },
-            { { 60, -40, 0 }, 36, Pitch::flat },
-            { { 61, -40, 0 }, 36, Pitch::flat },
-            { { 62, -41, 0 }, 36, Pitch::flat },
-            { { 63, -41, 0 }, 36, Pitch::flat },
-            { { 64, -42, 0 }, 36, Pitch::flat },
-            { { 65, -42, 0 }, 36, Pitch::flat },
-            { { 66, -43, 0 }, 36, Pitch::flat },
-            { { 67, -43, 0 }, 36, Pitch::flat },
-            { { 68, -43, 0 }, 36, Pitch::flat },
-            { { 69, -44, 0 }, 36, Pitch::flat },
-            { { 70, -44, 0 }, 34, Pitch::flat },
-            { { 71, -44, 0 }, 34, Pitch::flat },
-            { { 72, -45, 0 }, 34, Pitch::flat },
-            { { 73, -45, 0 }, 34, Pitch::flat },
-            { { 74, -45, 0 }, 34, Pitch::flat },
-            { { 75, -45, 0 }, 34, Pitch::flat },
-            { { 76, -46, 0 }, 34, Pitch::flat },
-            { { 77, -46, 0 }, 34, Pitch::flat },
-            { { 78, -46, 0 }, 34, Pitch::flat },
-            { { 79, -46, 0 }, 34, Pitch::flat },
-            { { 80, -46, 0 }, 34, Pitch::flat },
-            { { 81, -47, 0 }, 34, Pitch::flat },
-            { { 82, -47, 0 }, 34, Pitch::flat },
-            { { 83, -47, 0 }, 34, Pitch::flat },
-            { { 84, -47, 0 }, 34, Pitch::flat },
-            { { 85, -47, 0 }, 34, Pitch::flat },
-            { { 86, -47, 0 }, 34, Pitch::flat },
-            { { 87, -48, 0 }, 34, Pitch::flat },
-            { { 88, -48, 0 }, 32, Pitch::flat },
-            { { 89, -48, 0 }, 32, Pitch::flat },
-            { { 90, -48, 0 }, 32, Pitch::flat },
-            { { 91, -48, 0 }, 32, Pitch::flat },
-            { { 92, -48, 0 }, 32, Pitch::flat },
-            { { 93, -48, 0 }, 32, Pitch::flat },
-            { { 94, -48, 0 }, 32, Pitch::flat },
-            { { 95, -48, 0 }, 32, Pitch::flat },
-        });
-
-    // 0x4e1be8
-    // Track 6. Reversed 1. Direction 0
-    static constexpr auto moveInfoT6R1D0 = std::to_array<MoveInfo>(
-        {
-            { { 16, 0, 0 }, 16, Pitch::flat },
-            { { 16, 1, 0 }, 16, Pitch::flat },
-            { { 16, 2, 0 }, 16, Pitch::flat },
-            { { 16, 3, 0 }, 16, Pitch::flat },
-            { { 16, 4, 0 }, 16, Pitch::flat },
-            { { 16, 5, 0 }, 16, Pitch::flat },
-            { { 16, 6, 0 }, 16, Pitch::flat },
-            { { 16, 7, 0 }, 16, Pitch::flat },
-            { { 16, 8, 0 }, 18, Pitch::flat },
-            { { 17, 9, 0 }, 18, Pitch::flat },
-            { { 17, 10, 0 }, 18, Pitch::flat },
-            { { 17, 11, 0 }, 18, Pitch::flat },
-            { { 17, 12, 0 }, 18, Pitch::flat },
-            { { 17, 13, 0 }, 18, Pitch::flat },
-            { { 17, 14, 0 }, 18, Pitch::flat },
-            { { 18, 15, 0 }, 18, Pitch::flat },
-            { { 18, 16, 0 }, 18, Pitch::flat },
-            { { 18, 17, 0 }, 18, Pitch::flat },
-            { { 18, 18, 0 }, 18, Pitch::flat },
-            { { 18, 19, 0 }, 18, Pitch::flat },
-            { { 19, 20, 0 }, 18, Pitch::flat },
-            { { 19, 21, 0 }, 18, Pitch::flat },
-            { { 19, 22, 0 }, 18, Pitch::flat },
-            { { 19, 23, 0 }, 18, Pitch::flat },
-            { { 20, 24, 0 }, 20, Pitch::flat },
-            { { 20, 25, 0 }, 20, Pitch::flat },
-            { { 20, 26, 0 }, 20, Pitch::flat },
-            { { 21, 27, 0 }, 20, Pitch::flat },
-            { { 21, 28, 0 }, 20, Pitch::flat },
-            { { 21, 29, 0 }, 20, Pitch::flat },
-            { { 22, 30, 0 }, 20, Pitch::flat },
-            { { 22, 31, 0 }, 20, Pitch::flat },
-            { { 23, 32, 0 }, 20, Pitch::flat },
-            { { 23, 33, 0 }, 20, Pitch::flat },
-            { { 24, 34, 0 }, 20, Pitch::flat },
-            { { 24, 35, 0 }, 20, Pitch::flat },
-            { { 25, 36, 0 }, 20, Pitch::flat },
-            { { 25, 37, 0 }, 20, Pitch::flat },
-            { { 26, 38, 0 }, 20, Pitch::flat },
-            { { 26, 39, 0 }, 22, Pitch::flat },
-            { { 27, 40, 0 }, 22, Pitch::flat },
-            { { 28, 41, 0 }, 22, Pitch::flat },
-            { { 28, 42, 0 }, 22, Pitch::flat },
-            { { 29, 43, 0 }, 22, Pitch::flat },
-            { { 30, 44, 0 }, 22, Pitch::flat },
-            { { 30, 45, 0 }, 22, Pitch::flat },
-            { { 31, 46, 0 }, 22, Pitch::flat },
-            { { 32, 47, 0 }, 22, Pitch::flat },
-            { { 32, 48, 0 }, 22, Pitch::flat },
-            { { 33, 49, 0 }, 22, Pitch::flat },
-            { { 34, 50, 0 }, 22, Pitch::flat },
-            { { 35, 51, 0 }, 24, Pitch::flat },
-            { { 35, 52, 0 }, 24, Pitch::flat },
-            { { 36, 53, 0 }, 24, Pitch::flat },
-            { { 37, 54, 0 }, 24, Pitch::flat },
-            { { 38, 55, 0 }, 24, Pitch::flat },
-            { { 39, 56, 0 }, 24, Pitch::flat },
-            { { 39, 57, 0 }, 24, Pitch::flat },
-            { { 40, 58, 0 }, 24, Pitch::flat },
-            { { 41, 59, 0 }, 24, Pitch::flat },
-            { { 42, 60, 0 }, 24, Pitch::flat },
-            { { 43, 61, 0 }, 24, Pitch::flat },
-            { { 44, 61, 0 }, 24, Pitch::flat },
-            { { 45, 62, 0 }, 26, Pitch::flat },
-            { { 46, 63, 0 }, 26, Pitch::flat },
-            { { 47, 64, 0 }, 26, Pitch::flat },
-            { { 48, 64, 0 }, 26, Pitch::flat },
-            { { 49, 65, 0 }, 26, Pitch::flat },
-            { { 50, 66, 0 }, 26, Pitch::flat },
-            { { 51, 66, 0 }, 26, Pitch::flat },
-            { { 52, 67, 0 }, 26, Pitch::flat },
-            { { 53, 68, 0 }, 26, Pitch::flat },
-            { { 54, 68, 0 }, 26, Pitch::flat },
-            { { 55, 69, 0 }, 26, Pitch::flat },
-            { { 56, 70, 0 }, 26, Pitch::flat },
-            { { 57, 70, 0 }, 28, Pitch::flat },
-            { { 58, 71, 0 }, 28, Pitch::flat },
-            { { 59, 71, 0 }, 28, Pitch::flat },
-            { { 60, 72, 0 }, 28, Pitch::flat },
-            { { 61, 72, 0 }, 28, Pitch::flat },
-            { { 62, 73, 0 }, 28, Pitch::flat },
-            { { 63, 73, 0 }, 28, Pitch::flat },
-            { { 64, 74, 0 }, 28, Pitch::flat },
-            { { 65, 74, 0 }, 28, Pitch::flat },
-            { { 66, 75, 0 }, 28, Pitch::flat },
-            { { 67, 75, 0 }, 28, Pitch::flat },
-            { { 68, 75, 0 }, 28, Pitch::flat },
-            { { 69, 76, 0 }, 28, Pitch::flat },
-            { { 70, 76, 0 }, 30, Pitch::flat },
-            { { 71, 76, 0 }, 30, Pitch::flat },
-            { { 72, 77, 0 }, 30, Pitch::flat },
-            { { 73, 77, 0 }, 30, Pitch::flat },
-            { { 74, 77, 0 }, 30, Pitch::flat },
-            { { 75, 77, 0 }, 30, Pitch::flat },
-            { { 76, 78, 0 }, 30, Pitch::flat },
-            { { 77, 78, 0 }, 30, Pitch::flat },
-            { { 78, 78, 0 }, 30, Pitch::flat },
-            { { 79, 78, 0 }, 30, Pitch::flat },
-            { { 80, 78, 0 }, 30, Pitch::flat },
-            { { 81, 79, 0 }, 30, Pitch::flat },
-            { { 82, 79, 0 }, 30, Pitch::flat },
-            { { 83, 79, 0 }, 30, Pitch::flat },
-            { { 84, 79, 0 }, 30, Pitch::flat },
-            { { 85, 79, 0 }, 30, Pitch::flat },
-            { { 86, 79, 0 }, 30, Pitch::flat },
-            { { 87, 80, 0 }, 30, Pitch::flat },
-            { { 88, 80, 0 }, 32, Pitch::flat },
-            { { 89, 80, 0 }, 32, Pitch::flat },
-            { { 90, 80, 0 }, 32, Pitch::flat },
-            { { 91, 80, 0 }, 32, Pitch::flat },
-            { { 92, 80, 0 }, 32, Pitch::flat },
-            { { 93, 80, 0 }, 32, Pitch::flat },
-            { { 94, 80, 0 }, 32, Pitch::flat },
-            { { 95, 80, 0 }, 32, Pitch::flat },
-        });
-
-    // 0x4e1f7a
-    // Track 6. Reversed 1. Direction 1
-    static constexpr auto moveInfoT6R1D1 = std::to_array<MoveInfo>(
-        {
-            { { 0, 16, 0 }, 32, Pitch::flat },
-            { { 1, 16, 0 }, 32, Pitch::flat },
-            { { 2, 16, 0 }, 32, Pitch::flat },
-            { { 3, 16, 0 }, 32, Pitch::flat },
-            { { 4, 16, 0 }, 32, Pitch::flat },
-            { { 5, 16, 0 }, 32, Pitch::flat },
-            { { 6, 16, 0 }, 32, Pitch::flat },
-            { { 7, 16, 0 }, 32, Pitch::flat },
-            { { 8, 16, 0 }, 34, Pitch::flat },
-            { { 9, 15, 0 }, 34, Pitch::flat },
-            { { 10, 15, 0 }, 34, Pitch::flat },
-            { { 11, 15, 0 }, 34, Pitch::flat },
-            { { 12, 15, 0 }, 34, Pitch::flat },
-            { { 13, 15, 0 }, 34, Pitch::flat },
-            { { 14, 15, 0 }, 34, Pitch::flat },
-            { { 15, 14, 0 }, 34, Pitch::flat },
-            { { 16, 14, 0 }, 34, Pitch::flat },
-            { { 17, 14, 0 }, 34, Pitch::flat },
-            { { 18, 14, 0 }, 34, Pitch::flat },
-            { { 19, 14, 0 }, 34, Pitch::flat },
-            { { 20, 13, 0 }, 34, Pitch::flat },
-            { { 21, 13, 0 }, 34, Pitch::flat },
-            { { 22, 13, 0 }, 34, Pitch::flat },
-            { { 23, 13, 0 }, 34, Pitch::flat },
-            { { 24, 12, 0 }, 36, Pitch::flat },
-            { { 25, 12, 0 }, 36, Pitch::flat },
-            { { 26, 12, 0 }, 36, Pitch::flat },
-            { { 27, 11, 0 }, 36, Pitch::flat },
-            { { 28, 11, 0 }, 36, Pitch::flat },
-            { { 29, 11, 0 }, 36, Pitch::flat },
-            { { 30, 10, 0 }, 36, Pitch::flat },
-            { { 31, 10, 0 }, 36, Pitch::flat },
-            { { 32, 9, 0 }, 36, Pitch::flat },
-            { { 33, 9, 0 }, 36, Pitch::flat },
-            { { 34, 8, 0 }, 36, Pitch::flat },
-            { { 35, 8, 0 }, 36, Pitch::flat },
-            { { 36, 7, 0 }, 36, Pitch::flat },
-            { { 37, 7, 0 }, 36, Pitch::flat },
-            { { 38, 6, 0 }, 36, Pitch::flat },
-            { { 39, 6, 0 }, 38, Pitch::flat },
-            { { 40, 5, 0 }, 38, Pitch::flat },
-            { { 41, 4, 0 }, 38, Pitch::flat },
-            { { 42, 4, 0 }, 38, Pitch::flat },
-            { { 43, 3, 0 }, 38, Pitch::flat },
-            { { 44, 2, 0 }, 38, Pitch::flat },
-            { { 45, 2, 0 }, 38, Pitch::flat },
-            { { 46, 1, 0 }, 38, Pitch::flat },
-            { { 47, 0, 0 }, 38, Pitch::flat },
-            { { 48, 0, 0 }, 38, Pitch::flat },
-            { { 49, -1, 0 }, 38, Pitch::flat },
-            { { 50, -2, 0 }, 38, Pitch::flat },
-            { { 51, -3, 0 }, 40, Pitch::flat },
-            { { 52, -3, 0 }, 40, Pitch::flat },
-            { { 53, -4, 0 }, 40, Pitch::flat },
-            { { 54, -5, 0 }, 40, Pitch::flat },
-            { { 55, -6, 0 }, 40, Pitch::flat },
-            { { 56, -7, 0 }, 40, Pitch::flat },
-            { { 57, -7, 0 }, 40, Pitch::flat },
-            { { 58, -8, 0 }, 40, Pitch::flat },
-            { { 59, -9, 0 }, 40, Pitch::flat },
-            { { 60, -10, 0 }, 40, Pitch::flat },
-            { { 61, -11, 0 }, 40, Pitch::flat },
-            { { 61, -12, 0 }, 40, Pitch::flat },
-            { { 62, -13, 0 }, 42, Pitch::flat },
-            { { 63, -14, 0 }, 42, Pitch::flat },
-            { { 64, -15, 0 }, 42, Pitch::flat },
-            { { 64, -16, 0 }, 42, Pitch::flat },
-            { { 65, -17, 0 }, 42, Pitch::flat },
-            { { 66, -18, 0 }, 42, Pitch::flat },
-            { { 66, -19, 0 }, 42, Pitch::flat },
-            { { 67, -20, 0 }, 42, Pitch::flat },
-            { { 68, -21, 0 }, 42, Pitch::flat },
-            { { 68, -22, 0 }, 42, Pitch::flat },
-            { { 69, -23, 0 }, 42, Pitch::flat },
-            { { 70, -24, 0 }, 42, Pitch::flat },
-            { { 70, -25, 0 }, 44, Pitch::flat },
-            { { 71, -26, 0 }, 44, Pitch::flat },
-            { { 71, -27, 0 }, 44, Pitch::flat },
-            { { 72, -28, 0 }, 44, Pitch::flat },
-            { { 72, -29, 0 }, 44, Pitch::flat },
-            { { 73, -30, 0 }, 44, Pitch::flat },
-            { { 73, -31, 0 }, 44, Pitch::flat },
-            { { 74, -32, 0 }, 44, Pitch::flat },
-            { { 74, -33, 0 }, 44, Pitch::flat },
-            { { 75, -34, 0 }, 44, Pitch::flat },
-            { { 75, -35, 0 }, 44, Pitch::flat },
-            { { 75, -36, 0 }, 44, Pitch::flat },
-            { { 76, -37, 0 }, 44, Pitch::flat },
-            { { 76, -38, 0 }, 46, Pitch::flat },
-            { { 76, -39, 0 }, 46, Pitch::flat },
-            { { 77, -40, 0 }, 46, Pitch::flat },
-            { { 77, -41, 0 }, 46, Pitch::flat },
-            { { 77, -42, 0 }, 46, Pitch::flat },
-            { { 77, -43, 0 }, 46, Pitch::flat },
-            { { 78, -44, 0 }, 46, Pitch::flat },
-            { { 78, -45, 0 }, 46, Pitch::flat },
-            { { 78, -46, 0 }, 46, Pitch::flat },
-            { { 78, -47, 0 }, 46, Pitch::flat },
-            { { 78, -48, 0 }, 46, Pitch::flat },
-            { { 79, -49, 0 }, 46, Pitch::flat },
-            { { 79, -50, 0 }, 46, Pitch::flat },
-            { { 79, -51, 0 }, 46, Pitch::flat },
-            { { 79, -52, 0 }, 46, Pitch::flat },
-            { { 79, -53, 0 }, 46, Pitch::flat },
-            { { 79, -54, 0 }, 46, Pitch::flat },
-            { { 80, -55, 0 }, 46, Pitch::flat },
-            { { 80, -56, 0 }, 48, Pitch::flat },
-            { { 80, -57, 0 }, 48, Pitch::flat },
-            { { 80, -58, 0 }, 48, Pitch::flat },
-            { { 80, -59, 0 }, 48, Pitch::flat },
-            { { 80, -60, 0 }, 48, Pitch::flat },
-            { { 80, -61, 0 }, 48, Pitch::flat },
-            { { 80, -62, 0 }, 48, Pitch::flat },
-            { { 80, -63, 0 }, 48, Pitch::flat },
-            { { 80, -64, 0 }, 48, Pitch::flat },
-        });
-
-    // 0x4e2314
-    // Track 6. Reversed 1. Direction 2
-    static constexpr auto moveInfoT6R1D2 = std::to_array<MoveInfo>(
-        {
-            { { 16, 31, 0 }, 48, Pitch::flat },
-            { { 16, 30, 0 }, 48, Pitch::flat },
-            { { 16, 29, 0 }, 48, Pitch::flat },
-            { { 16, 28, 0 }, 48, Pitch::flat },
-            { { 16, 27, 0 }, 48, Pitch::flat },
-            { { 16, 26, 0 }, 48, Pitch::flat },
-            { { 16, 25, 0 }, 48, Pitch::flat },
-            { { 16, 24, 0 }, 50, Pitch::flat },
-            { { 15, 23, 0 }, 50, Pitch::flat },
-            { { 15, 22, 0 }, 50, Pitch::flat },
-            { { 15, 21, 0 }, 50, Pitch::flat },
-            { { 15, 20, 0 }, 50, Pitch::flat },
-            { { 15, 19, 0 }, 50, Pitch::flat },
-            { { 15, 18, 0 }, 50, Pitch::flat },
-            { { 14, 17, 0 }, 50, Pitch::flat },
-            { { 14, 16, 0 }, 50, Pitch::flat },
-            { { 14, 15, 0 }, 50, Pitch::flat },
-            { { 14, 14, 0 }, 50, Pitch::flat },
-            { { 14, 13, 0 }, 50, Pitch::flat },
-            { { 13, 12, 0 }, 50, Pitch::flat },
-            { { 13, 11, 0 }, 50, Pitch::flat },
-            { { 13, 10, 0 }, 50, Pitch::flat },
-            { { 13, 9, 0 }, 50, Pitch::flat },
-            { { 12, 8, 0 }, 52, Pitch::flat },
-            { { 12, 7, 0 }, 52, Pitch::flat },
-            { { 12, 6, 0 }, 52, Pitch::flat },
-            { { 11, 5, 0 }, 52, Pitch::flat },
-            { { 11, 4, 0 }, 52, Pitch::flat },
-            { { 11, 3, 0 }, 52, Pitch::flat },
-            { { 10, 2, 0 }, 52, Pitch::flat },
-            { { 10, 1, 0 }, 52, Pitch::flat },
-            { { 9, 0, 0 }, 52, Pitch::flat },
-            { { 9, -1, 0 }, 52, Pitch::flat },
-            { { 8, -2, 0 }, 52, Pitch::flat },
-            { { 8, -3, 0 }, 52, Pitch::flat },
-            { { 7, -4, 0 }, 52, Pitch::flat },
-            { { 7, -5, 0 }, 52, Pitch::flat },
-            { { 6, -6, 0 }, 52, Pitch::flat },
-            { { 6, -7, 0 }, 54, Pitch::flat },
-            { { 5, -8, 0 }, 54, Pitch::flat },
-            { { 4, -9, 0 }, 54, Pitch::flat },
-            { { 4, -10, 0 }, 54, Pitch::flat },
-            { { 3, -11, 0 }, 54, Pitch::flat },
-            { { 2, -12, 0 }, 54, Pitch::flat },
-            { { 2, -13, 0 }, 54, Pitch::flat },
-            { { 1, -14, 0 }, 54, Pitch::flat },
-            { { 0, -15, 0 }, 54, Pitch::flat },
-            { { 0, -16, 0 }, 54, Pitch::flat },
-            { { -1, -17, 0 }, 54, Pitch::flat },
-            { { -2, -18, 0 }, 54, Pitch::flat },
-            { { -3, -19, 0 }, 56, Pitch::flat },
-            { { -3, -20, 0 }, 56, Pitch::flat },
-            { { -4, -21, 0 }, 56, Pitch::flat },
-            { { -5, -22, 0 }, 56, Pitch::flat },
-            { { -6, -23, 0 }, 56, Pitch::flat },
-            { { -7, -24, 0 }, 56, Pitch::flat },
-            { { -7, -25, 0 }, 56, Pitch::flat },
-            { { -8, -26, 0 }, 56, Pitch::flat },
-            { { -9, -27, 0 }, 56, Pitch::flat },
-            { { -10, -28, 0 }, 56, Pitch::flat },
-            { { -11, -29, 0 }, 56, Pitch::flat },
-            { { -12, -29, 0 }, 56, Pitch::flat },
-            { { -13, -30, 0 }, 58, Pitch::flat },
-            { { -14, -31, 0 }, 58, Pitch::flat },
-            { { -15, -32, 0 }, 58, Pitch::flat },
-            { { -16, -32, 0 }, 58, Pitch::flat },
-            { { -17, -33, 0 }, 58, Pitch::flat },
-            { { -18, -34, 0 }, 58, Pitch::flat },
-            { { -19, -34, 0 }, 58, Pitch::flat },
-            { { -20, -35, 0 }, 58, Pitch::flat },
-            { { -21, -36, 0 }, 58, Pitch::flat },
-            { { -22, -36, 0 }, 58, Pitch::flat },
-            { { -23, -37, 0 }, 58, Pitch::flat },
-            { { -24, -38, 0 }, 58, Pitch::flat },
-            { { -25, -38, 0 }, 60, Pitch::flat },
-            { { -26, -39, 0 }, 60, Pitch::flat },
-            { { -27, -39, 0 }, 60, Pitch::flat },
-            { { -28, -40, 0 }, 60, Pitch::flat },
-            { { -29, -40, 0 }, 60, Pitch::flat },
-            { { -30, -41, 0 }, 60, Pitch::flat },
-            { { -31, -41, 0 }, 60, Pitch::flat },
-            { { -32, -42, 0 }, 60, Pitch::flat },
-            { { -33, -42, 0 }, 60, Pitch::flat },
-            { { -34, -43, 0 }, 60, Pitch::flat },
-            { { -35, -43, 0 }, 60, Pitch::flat },
-            { { -36, -43, 0 }, 60, Pitch::flat },
-            { { -37, -44, 0 }, 60, Pitch::flat },
-            { { -38, -44, 0 }, 62, Pitch::flat },
-            { { -39, -44, 0 }, 62, Pitch::flat },
-            { { -40, -45, 0 }, 62, Pitch::flat },
-            { { -41, -45, 0 }, 62, Pitch::flat },
-            { { -42, -45, 0 }, 62, Pitch::flat },
-            { { -43, -45, 0 }, 62, Pitch::flat },
-            { { -44, -46, 0 }, 62, Pitch::flat },
-            { { -45, -46, 0 }, 62, Pitch::flat },
-            { { -46, -46, 0 }, 62, Pitch::flat },
-            { { -47, -46, 0 }, 62, Pitch::flat },
-            { { -48, -46, 0 }, 62, Pitch::flat },
-            { { -49, -47, 0 }, 62, Pitch::flat },
-            { { -50, -47, 0 }, 62, Pitch::flat },
-            { { -51, -47, 0 }, 62, Pitch::flat },
-            { { -52, -47, 0 }, 62, Pitch::flat },
-            { { -53, -47, 0 }, 62, Pitch::flat },
-            { { -54, -47, 0 }, 62, Pitch::flat },
-            { { -55, -48, 0 }, 62, Pitch::flat },
-            { { -56, -48, 0 }, 0, Pitch::flat },
-            { { -57, -48, 0 }, 0, Pitch::flat },
-            { { -58, -48, 0 }, 0, Pitch::flat },
-            { { -59, -48, 0 }, 0, Pitch::flat },
-            { { -60, -48, 0 }, 0, Pitch::flat },
-            { { -61, -48, 0 }, 0, Pitch::flat },
-            { { -62, -48, 0 }, 0, Pitch::flat },
-            { { -63, -48, 0 }, 0, Pitch::flat },
-            { { -64, -48, 0 }, 0, Pitch::flat },
-        });
-
-    // 0x4e185e
-    // Track 6. Reversed 1. Direction 3
-    static constexpr auto moveInfoT6R1D3 = std::to_array<MoveInfo>(
-        {
-            { { 31, 16, 0 }, 0, Pitch::flat },
-            { { 30, 16, 0 }, 0, Pitch::flat },
-            { { 29, 16, 0 }, 0, Pitch::flat },
-            { { 28, 16, 0 }, 0, Pitch::flat },
-            { { 27, 16, 0 }, 0, Pitch::flat },
-            { { 26, 16, 0 }, 0, Pitch::flat },
-            { { 25, 16, 0 }, 0, Pitch::flat },
-            { { 24, 16, 0 }, 2, Pitch::flat },
-            { { 23, 17, 0 }, 2, Pitch::flat },
-            { { 22, 17, 0 }, 2, Pitch::flat },
-            { { 21, 17, 0 }, 2, Pitch::flat },
-            { { 20, 17, 0 }, 2, Pitch::flat },
-            { { 19, 17, 0 }, 2, Pitch::flat },
-            { { 18, 17, 0 }, 2, Pitch::flat },
-            { { 17, 18, 0 }, 2, Pitch::flat },
-            { { 16, 18, 0 }, 2, Pitch::flat },
-            { { 15, 18, 0 }, 2, Pitch::flat },
-            { { 14, 18, 0 }, 2, Pitch::flat },
-            { { 13, 18, 0 }, 2, Pitch::flat },
-            { { 12, 19, 0 }, 2, Pitch::flat },
-            { { 11, 19, 0 }, 2, Pitch::flat },
-            { { 10, 19, 0 }, 2, Pitch::flat },
-            { { 9, 19, 0 }, 2, Pitch::flat },
-            { { 8, 20, 0 }, 4, Pitch::flat },
-            { { 7, 20, 0 }, 4, Pitch::flat },
-            { { 6, 20, 0 }, 4, Pitch::flat },
-            { { 5, 21, 0 }, 4, Pitch::flat },
-            { { 4, 21, 0 }, 4, Pitch::flat },
-            { { 3, 21, 0 }, 4, Pitch::flat },
-            { { 2, 22, 0 }, 4, Pitch::flat },
-            { { 1, 22, 0 }, 4, Pitch::flat },
-            { { 0, 23, 0 }, 4, Pitch::flat },
-            { { -1, 23, 0 }, 4, Pitch::flat },
-            { { -2, 24, 0 }, 4, Pitch::flat },
-            { { -3, 24, 0 }, 4, Pitch::flat },
-            { { -4, 25, 0 }, 4, Pitch::flat },
-            { { -5, 25, 0 }, 4, Pitch::flat },
-            { { -6, 26, 0 }, 4, Pitch::flat },
-            { { -7, 26, 0 }, 6, Pitch::flat },
-            { { -8, 27, 0 }, 6, Pitch::flat },
-            { { -9, 28, 0 }, 6, Pitch::flat },
-            { { -10, 28, 0 }, 6, Pitch::flat },
-            { { -11, 29, 0 }, 6, Pitch::flat },
-            { { -12, 30, 0 }, 6, Pitch::flat },
-            { { -13, 30, 0 }, 6, Pitch::flat },
-            { { -14, 31, 0 }, 6, Pitch::flat },
-            { { -15, 32, 0 }, 6, Pitch::flat },
-            { { -16, 32, 0 }, 6, Pitch::flat },
-            { { -17, 33, 0 }, 6, Pitch::flat },
-            { { -18, 34, 0 }, 6, Pitch::flat },
-            { { -19, 35, 0 }, 8, Pitch::flat },
-            { { -20, 35, 0 }, 8, Pitch::flat },
-            { { -21, 36, 0 }, 8, Pitch::flat },
-            { { -22, 37, 0 }, 8, Pitch::flat },
-            { { -23, 38, 0 }, 8, Pitch::flat },
-            { { -24, 39, 0 }, 8, Pitch::flat },
-            { { -25, 39, 0 }, 8, Pitch::flat },
-            { { -26, 40, 0 }, 8, Pitch::flat },
-            { { -27, 41, 0 }, 8, Pitch::flat },
-            { { -28, 42, 0 }, 8, Pitch::flat },
-            { { -29, 43, 0 }, 8, Pitch::flat },
-            { { -29, 44, 0 }, 8, Pitch::flat },
-            { { -30, 45, 0 }, 10, Pitch::flat },
-            { { -31, 46, 0 }, 10, Pitch::flat },
-            { { -32, 47, 0 }, 10, Pitch::flat },
-            { { -32, 48, 0 }, 10, Pitch::flat },
-            { { -33, 49, 0 }, 10, Pitch::flat },
-            { { -34, 50, 0 }, 10, Pitch::flat },
-            { { -34, 51, 0 }, 10, Pitch::flat },
-            { { -35, 52, 0 }, 10, Pitch::flat },
-            { { -36, 53, 0 }, 10, Pitch::flat },
-            { { -36, 54, 0 }, 10, Pitch::flat },
-            { { -37, 55, 0 }, 10, Pitch::flat },
-            { { -38, 56, 0 }, 10, Pitch::flat },
-            { { -38, 57, 0 }, 12, Pitch::flat },
-            { { -39, 58, 0 }, 12, Pitch::flat },
-            { { -39, 59, 0 }, 12, Pitch::flat },
-            { { -40, 60, 0 }, 12, Pitch::flat },
-            { { -40, 61, 0 }, 12, Pitch::flat },
-            { { -41, 62, 0 }, 12, Pitch::flat },
-            { { -41, 63, 0 }, 12, Pitch::flat },
-            { { -42, 64, 0 }, 12, Pitch::flat },
-            { { -42, 65, 0 }, 12, Pitch::flat },
-            { { -43, 66, 0 }, 12, Pitch::flat },
-            { { -43, 67, 0 }, 12, Pitch::flat },
-            { { -43, 68, 0 }, 12, Pitch::flat },
-            { { -44, 69, 0 }, 12, Pitch::flat },
-            { { -44, 70, 0 }, 14, Pitch::flat },
-            { { -44, 71, 0 }, 14, Pitch::flat },
-            { { -45, 72, 0 }, 14, Pitch::flat },
-            { { -45, 73, 0 }, 14, Pitch::flat },
-            { { -45, 74, 0 }, 14, Pitch::flat },
-            { { -45, 75, 0 }, 14, Pitch::flat },
-            { { -46, 76, 0 }, 14, Pitch::flat },
-            { { -46, 77, 0 }, 14, Pitch::flat },
-            { { -46, 78, 0 }, 14, Pitch::flat },
-            { { -46, 79, 0 }, 14, Pitch::flat },
-            { { -46, 80, 0 }, 14, Pitch::flat },
-            { { -47, 81, 0 }, 14, Pitch::flat },
-            { { -47, 82, 0 }, 14, Pitch::flat },
-            { { -47, 83, 0 }, 14, Pitch::flat },
-            { { -47, 84, 0 }, 14, Pitch::flat },
-            { { -47, 85, 0 }, 14, Pitch::flat },
-            { { -47, 86, 0 }, 14, Pitch::flat },
-            { { -48, 87, 0 }, 14, Pitch::flat },
-            { { -48, 88, 0 }, 16, Pitch::flat },
-            { { -48, 89, 0 }, 16, Pitch::flat },
-            { { -48, 90, 0 }, 16, Pitch::flat },
-            { { -48, 91, 0 }, 16, Pitch::flat },
-            { { -48, 92, 0 }, 16, Pitch::flat },
-            { { -48, 93, 0 }, 16, Pitch::flat },
-            { { -48, 94, 0 }, 16, Pitch::flat },
-            { { -48, 95, 0 }, 16, Pitch::flat },
-        });
-
-    // 0x4e26a6
-    // Track 8. Reversed 0. Direction 0
-    static constexpr auto moveInfoT8R0D0 = std::to_array<MoveInfo>(
-        {
-            { { 31, 16, 0 }, 0, Pitch::flat },
-            { { 30, 16, 0 }, 0, Pitch::flat },
-            { { 29, 16, 0 }, 0, Pitch::flat },
-            { { 28, 16, 0 }, 0, Pitch::flat },
-            { { 27, 16, 0 }, 0, Pitch::flat },
-            { { 26, 16, 0 }, 0, Pitch::flat },
-            { { 25, 16, 0 }, 0, Pitch::flat },
-            { { 24, 16, 0 }, 0, Pitch::flat },
-            { { 23, 16, 0 }, 0, Pitch::flat },
-            { { 22, 16, 0 }, 0, Pitch::flat },
-            { { 21, 16, 0 }, 62, Pitch::flat },
-            { { 20, 16, 0 }, 62, Pitch::flat },
-            { { 19, 15, 0 }, 62, Pitch::flat },
-            { { 18, 15, 0 }, 62, Pitch::flat },
-            { { 17, 15, 0 }, 62, Pitch::flat },
-            { { 16, 15, 0 }, 62, Pitch::flat },
-            { { 15, 15, 0 }, 62, Pitch::flat },
-            { { 14, 14, 0 }, 62, Pitch::flat },
-            { { 13, 14, 0 }, 62, Pitch::flat },
-            { { 12, 14, 0 }, 62, Pitch::flat },
-            { { 11, 14, 0 }, 62, Pitch::flat },
-            { { 10, 14, 0 }, 62, Pitch::flat },
-            { { 9, 13, 0 }, 62, Pitch::flat },
-            { { 8, 13, 0 }, 62, Pitch::flat },
-            { { 7, 13, 0 }, 62, Pitch::flat },
-            { { 6, 13, 0 }, 62, Pitch::flat },
-            { { 5, 13, 0 }, 62, Pitch::flat },
-            { { 4, 12, 0 }, 62, Pitch::flat },
-            { { 3, 12, 0 }, 62, Pitch::flat },
-            { { 2, 12, 0 }, 62, Pitch::flat },
-            { { 1, 12, 0 }, 62, Pitch::flat },
-            { { 0, 11, 0 }, 60, Pitch::flat },
-            { { -1, 11, 0 }, 60, Pitch::flat },
-            { { -2, 11, 0 }, 60, Pitch::flat },
-            { { -3, 11, 0 }, 60, Pitch::flat },
-            { { -4, 10, 0 }, 60, Pitch::flat },
-            { { -5, 10, 0 }, 60, Pitch::flat },
-            { { -6, 10, 0 }, 60, Pitch::flat },
-            { { -7, 9, 0 }, 60, Pitch::flat },
-            { { -8, 9, 0 }, 60, Pitch::flat },
-            { { -9, 9, 0 }, 60, Pitch::flat },
-            { { -10, 8, 0 }, 60, Pitch::flat },
-            { { -11, 8, 0 }, 60, Pitch::flat },
-            { { -12, 8, 0 }, 60, Pitch::flat },
-            { { -13, 7, 0 }, 60, Pitch::flat },
-            { { -14, 7, 0 }, 60, Pitch::flat },
-            { { -15, 6, 0 }, 60, Pitch::flat },
-            { { -16, 6, 0 }, 60, Pitch::flat },
-            { { -17, 5, 0 }, 60, Pitch::flat },
-            { { -18, 5, 0 }, 60, Pitch::flat },
-            { { -19, 4, 0 }, 60, Pitch::flat },
-            { { -20, 4, 0 }, 60, Pitch::flat },
-            { { -21, 3, 0 }, 58, Pitch::flat },
-            { { -22, 3, 0 }, 58, Pitch::flat },
-            { { -23, 2, 0 }, 58, Pitch::flat },
-            { { -24, 2, 0 }, 58, Pitch::flat },
-            { { -25, 1, 0 }, 58, Pitch::flat },
-            { { -26, 0, 0 }, 58, Pitch::flat },
-            { { -27, 0, 0 }, 58, Pitch::flat },
-            { { -28, -1, 0 }, 58, Pitch::flat },
-            { { -29, -2, 0 }, 58, Pitch::flat },
-            { { -30, -2, 0 }, 58, Pitch::flat },
-            { { -31, -3, 0 }, 58, Pitch::flat },
-            { { -32, -4, 0 }, 58, Pitch::flat },
-            { { -33, -4, 0 }, 58, Pitch::flat },
-            { { -34, -5, 0 }, 58, Pitch::flat },
-            { { -35, -6, 0 }, 58, Pitch::flat },
-            { { -36, -7, 0 }, 58, Pitch::flat },
-            { { -37, -7, 0 }, 58, Pitch::flat },
-            { { -38, -8, 0 }, 58, Pitch::flat },
-            { { -39, -9, 0 }, 56, Pitch::flat },
-            { { -40, -10, 0 }, 56, Pitch::flat },
-            { { -41, -11, 0 }, 56, Pitch::flat },
-            { { -42, -12, 0 }, 56, Pitch::flat },
-            { { -43, -12, 0 }, 56, Pitch::flat },
-            { { -44, -13, 0 }, 56, Pitch::flat },
-            { { -45, -14, 0 }, 56, Pitch::flat },
-            { { -46, -15, 0 }, 56, Pitch::flat },
-            { { -47, -16, 0 }, 56, Pitch::flat },
-        });
-
-    // 0x4e2920
-    // Track 8. Reversed 0. Direction 1
-    static constexpr auto moveInfoT8R0D1 = std::to_array<MoveInfo>(
-        {
-            { { 16, 0, 0 }, 16, Pitch::flat },
-            { { 16, 1, 0 }, 16, Pitch::flat },
-            { { 16, 2, 0 }, 16, Pitch::flat },
-            { { 16, 3, 0 }, 16, Pitch::flat },
-            { { 16, 4, 0 }, 16, Pitch::flat },
-            { { 16, 5, 0 }, 16, Pitch::flat },
-            { { 16, 6, 0 }, 16, Pitch::flat },
-            { { 16, 7, 0 }, 16, Pitch::flat },
-            { { 16, 8, 0 }, 16, Pitch::flat },
-            { { 16, 9, 0 }, 16, Pitch::flat },
-            { { 16, 10, 0 }, 16, Pitch::flat },
-            { { 16, 11, 0 }, 14, Pitch::flat },
-            { { 16, 12, 0 }, 14, Pitch::flat },
-            { { 15, 13, 0 }, 14, Pitch::flat },
-            { { 15, 14, 0 }, 14, Pitch::flat },
-            { { 15, 15, 0 }, 14, Pitch::flat },
-            { { 15, 16, 0 }, 14, Pitch::flat },
-            { { 15, 17, 0 }, 14, Pitch::flat },
-            { { 14, 18, 0 }, 14, Pitch::flat },
-            { { 14, 19, 0 }, 14, Pitch::flat },
-            { { 14, 20, 0 }, 14, Pitch::flat },
-            { { 14, 21, 0 }, 14, Pitch::flat },
-            { { 14, 22, 0 }, 14, Pitch::flat },
-            { { 13, 23, 0 }, 14, Pitch::flat },
-            { { 13, 24, 0 }, 14, Pitch::flat },
-            { { 13, 25, 0 }, 14, Pitch::flat },
-            { { 13, 26, 0 }, 14, Pitch::flat },
-            { { 13, 27, 0 }, 14, Pitch::flat },
-            { { 12, 28, 0 }, 14, Pitch::flat },
-            { { 12, 29, 0 }, 14, Pitch::flat },
-            { { 12, 30, 0 }, 14, Pitch::flat },
-            { { 12, 31, 0 }, 14, Pitch::flat },
-            { { 11, 32, 0 }, 12, Pitch::flat },
-            { { 11, 33, 0 }, 12, Pitch::flat },
-            { { 11, 34, 0 }, 12, Pitch::flat },
-            { { 11, 35, 0 }, 12, Pitch::flat },
-            { { 10, 36, 0 }, 12, Pitch::flat },
-            { { 10, 37, 0 }, 12, Pitch::flat },
-            { { 10, 38, 0 }, 12, Pitch::flat },
-            { { 9, 39, 0 }, 12, Pitch::flat },
-            { { 9, 40, 0 }, 12, Pitch::flat },
-            { { 9, 41, 0 }, 12, Pitch::flat },
-            { { 8, 42, 0 }, 12, Pitch::flat },
-            { { 8, 43, 0 }, 12, Pitch::flat },
-            { { 8, 44, 0 }, 12, Pitch::flat },
-            { { 7, 45, 0 }, 12, Pitch::flat },
-            { { 7, 46, 0 }, 12, Pitch::flat },
-            { { 6, 47, 0 }, 12, Pitch::flat },
-            { { 6, 48, 0 }, 12, Pitch::flat },
-            { { 5, 49, 0 }, 12, Pitch::flat },
-            { { 5, 50, 0 }, 12, Pitch::flat },
-            { { 4, 51, 0 }, 12, Pitch::flat },
-            { { 4, 52, 0 }, 12, Pitch::flat },
-            { { 3, 53, 0 }, 10, Pitch::flat },
-            { { 3, 54, 0 }, 10, Pitch::flat },
-            { { 2, 55, 0 }, 10, Pitch::flat },
-            { { 2, 56, 0 }, 10, Pitch::flat },
-            { { 1, 57, 0 }, 10, Pitch::flat },
-            { { 0, 58, 0 }, 10, Pitch::flat },
-            { { 0, 59, 0 }, 10, Pitch::flat },
-            { { -1, 60, 0 }, 10, Pitch::flat },
-            { { -2, 61, 0 }, 10, Pitch::flat },
-            { { -2, 62, 0 }, 10, Pitch::flat },
-            { { -3, 63, 0 }, 10, Pitch::flat },
-            { { -4, 64, 0 }, 10, Pitch::flat },
-            { { -4, 65, 0 }, 10, Pitch::flat },
-            { { -5, 66, 0 }, 10, Pitch::flat },
-            { { -6, 67, 0 }, 10, Pitch::flat },
-            { { -7, 68, 0 }, 10, Pitch::flat },
-            { { -7, 69, 0 }, 10, Pitch::flat },
-            { { -8, 70, 0 }, 10, Pitch::flat },
-            { { -9, 71, 0 }, 8, Pitch::flat },
-            { { -10, 72, 0 }, 8, Pitch::flat },
-            { { -11, 73, 0 }, 8, Pitch::flat },
-            { { -12, 74, 0 }, 8, Pitch::flat },
-            { { -12, 75, 0 }, 8, Pitch::flat },
-            { { -13, 76, 0 }, 8, Pitch::flat },
-            { { -14, 77, 0 }, 8, Pitch::flat },
-            { { -15, 78, 0 }, 8, Pitch::flat },
-            { { -16, 79, 0 }, 8, Pitch::flat },
-        });
-
-    // 0x4e2ba2
-    // Track 8. Reversed 0. Direction 2
-    static constexpr auto moveInfoT8R0D2 = std::to_array<MoveInfo>(
-        {
-            { { 0, 16, 0 }, 32, Pitch::flat },
-            { { 1, 16, 0 }, 32, Pitch::flat },
-            { { 2, 16, 0 }, 32, Pitch::flat },
-            { { 3, 16, 0 }, 32, Pitch::flat },
-            { { 4, 16, 0 }, 32, Pitch::flat },
-            { { 5, 16, 0 }, 32, Pitch::flat },
-            { { 6, 16, 0 }, 32, Pitch::flat },
-            { { 7, 16, 0 }, 32, Pitch::flat },
-            { { 8, 16, 0 }, 32, Pitch::flat },
-            { { 9, 16, 0 }, 32, Pitch::flat },
-            { { 10, 16, 0 }, 32, Pitch::flat },
-            { { 11, 16, 0 }, 30, Pitch::flat },
-            { { 12, 16, 0 }, 30, Pitch::flat },
-            { { 13, 16, 0 }, 30, Pitch::flat },
-            { { 14, 17, 0 }, 30, Pitch::flat },
-            { { 15, 17, 0 }, 30, Pitch::flat },
-            { { 16, 17, 0 }, 30, Pitch::flat },
-            { { 17, 17, 0 }, 30, Pitch::flat },
-            { { 18, 17, 0 }, 30, Pitch::flat },
-            { { 19, 18, 0 }, 30, Pitch::flat },
-            { { 20, 18, 0 }, 30, Pitch::flat },
-            { { 21, 18, 0 }, 30, Pitch::flat },
-            { { 22, 18, 0 }, 30, Pitch::flat },
-            { { 23, 18, 0 }, 30, Pitch::flat },
-            { { 24, 19, 0 }, 30, Pitch::flat },
-            { { 25, 19, 0 }, 30, Pitch::flat },
-            { { 26, 19, 0 }, 30, Pitch::flat },
-            { { 27, 19, 0 }, 30, Pitch::flat },
-            { { 28, 19, 0 }, 30, Pitch::flat },
-            { { 29, 20, 0 }, 30, Pitch::flat },
-            { { 30, 20, 0 }, 30, Pitch::flat },
-            { { 31, 20, 0 }, 30, Pitch::flat },
-            { { 32, 20, 0 }, 28, Pitch::flat },
-            { { 33, 21, 0 }, 28, Pitch::flat },
-            { { 34, 21, 0 }, 28, Pitch::flat },
-            { { 35, 21, 0 }, 28, Pitch::flat },
-            { { 36, 21, 0 }, 28, Pitch::flat },
-            { { 37, 22, 0 }, 28, Pitch::flat },
-            { { 38, 22, 0 }, 28, Pitch::flat },
-            { { 39, 22, 0 }, 28, Pitch::flat },
-            { { 40, 23, 0 }, 28, Pitch::flat },
-            { { 41, 23, 0 }, 28, Pitch::flat },
-            { { 42, 23, 0 }, 28, Pitch::flat },
-            { { 43, 24, 0 }, 28, Pitch::flat },
-            { { 44, 24, 0 }, 28, Pitch::flat },
-            { { 45, 24, 0 }, 28, Pitch::flat },
-            { { 46, 25, 0 }, 28, Pitch::flat },
-            { { 47, 25, 0 }, 28, Pitch::flat },
-            { { 48, 26, 0 }, 28, Pitch::flat },
-            { { 49, 26, 0 }, 28, Pitch::flat },
-            { { 50, 27, 0 }, 28, Pitch::flat },
-            { { 51, 27, 0 }, 28, Pitch::flat },
-            { { 52, 28, 0 }, 28, Pitch::flat },
-            { { 53, 28, 0 }, 26, Pitch::flat },
-            { { 54, 29, 0 }, 26, Pitch::flat },
-            { { 55, 29, 0 }, 26, Pitch::flat },
-            { { 56, 30, 0 }, 26, Pitch::flat },
-            { { 57, 30, 0 }, 26, Pitch::flat },
-            { { 58, 31, 0 }, 26, Pitch::flat },
-            { { 59, 32, 0 }, 26, Pitch::flat },
-            { { 60, 32, 0 }, 26, Pitch::flat },
-            { { 61, 33, 0 }, 26, Pitch::flat },
-            { { 62, 34, 0 }, 26, Pitch::flat },
-            { { 63, 34, 0 }, 26, Pitch::flat },
-            { { 64, 35, 0 }, 26, Pitch::flat },
-            { { 65, 36, 0 }, 26, Pitch::flat },
-            { { 66, 36, 0 }, 26, Pitch::flat },
-            { { 67, 37, 0 }, 26, Pitch::flat },
-            { { 68, 38, 0 }, 26, Pitch::flat },
-            { { 69, 39, 0 }, 26, Pitch::flat },
-            { { 70, 39, 0 }, 26, Pitch::flat },
-            { { 71, 40, 0 }, 24, Pitch::flat },
-            { { 72, 41, 0 }, 24, Pitch::flat },
-            { { 73, 42, 0 }, 24, Pitch::flat },
-            { { 74, 43, 0 }, 24, Pitch::flat },
-            { { 75, 44, 0 }, 24, Pitch::flat },
-            { { 76, 44, 0 }, 24, Pitch::flat },
-            { { 77, 45, 0 }, 24, Pitch::flat },
-            { { 78, 46, 0 }, 24, Pitch::flat },
-            { { 79, 47, 0 }, 24, Pitch::flat },
-        });
-
-    // 0x4e2e24
-    // Track 8. Reversed 0. Direction 3
-    static constexpr auto moveInfoT8R0D3 = std::to_array<MoveInfo>(
-        {
-            { { 16, 31, 0 }, 48, Pitch::flat },
-            { { 16, 30, 0 }, 48, Pitch::flat },
-            { { 16, 29, 0 }, 48, Pitch::flat },
-            { { 16, 28, 0 }, 48, Pitch::flat },
-            { { 16, 27, 0 }, 48, Pitch::flat },
-            { { 16, 26, 0 }, 48, Pitch::flat },
-            { { 16, 25, 0 }, 48, Pitch::flat },
-            { { 16, 24, 0 }, 48, Pitch::flat },
-            { { 16, 23, 0 }, 48, Pitch::flat },
-            { { 16, 22, 0 }, 48, Pitch::flat },
-            { { 16, 21, 0 }, 46, Pitch::flat },
-            { { 16, 20, 0 }, 46, Pitch::flat },
-            { { 16, 19, 0 }, 46, Pitch::flat },
-            { { 16, 18, 0 }, 46, Pitch::flat },
-            { { 17, 17, 0 }, 46, Pitch::flat },
-            { { 17, 16, 0 }, 46, Pitch::flat },
-            { { 17, 15, 0 }, 46, Pitch::flat },
-            { { 17, 14, 0 }, 46, Pitch::flat },
-            { { 17, 13, 0 }, 46, Pitch::flat },
-            { { 18, 12, 0 }, 46, Pitch::flat },
-            { { 18, 11, 0 }, 46, Pitch::flat },
-            { { 18, 10, 0 }, 46, Pitch::flat },
-            { { 18, 9, 0 }, 46, Pitch::flat },
-            { { 18, 8, 0 }, 46, Pitch::flat },
-            { { 19, 7, 0 }, 46, Pitch::flat },
-            { { 19, 6, 0 }, 46, Pitch::flat },
-            { { 19, 5, 0 }, 46, Pitch::flat },
-            { { 19, 4, 0 }, 46, Pitch::flat },
-            { { 19, 3, 0 }, 46, Pitch::flat },
-            { { 20, 2, 0 }, 46, Pitch::flat },
-            { { 20, 1, 0 }, 46, Pitch::flat },
-            { { 20, 0, 0 }, 44, Pitch::flat },
-            { { 20, -1, 0 }, 44, Pitch::flat },
-            { { 21, -2, 0 }, 44, Pitch::flat },
-            { { 21, -3, 0 }, 44, Pitch::flat },
-            { { 21, -4, 0 }, 44, Pitch::flat },
-            { { 21, -5, 0 }, 44, Pitch::flat },
-            { { 22, -6, 0 }, 44, Pitch::flat },
-            { { 22, -7, 0 }, 44, Pitch::flat },
-            { { 22, -8, 0 }, 44, Pitch::flat },
-            { { 23, -9, 0 }, 44, Pitch::flat },
-            { { 23, -10, 0 }, 44, Pitch::flat },
-            { { 23, -11, 0 }, 44, Pitch::flat },
-            { { 24, -12, 0 }, 44, Pitch::flat },
-            { { 24, -13, 0 }, 44, Pitch::flat },
-            { { 24, -14, 0 }, 44, Pitch::flat },
-            { { 25, -15, 0 }, 44, Pitch::flat },
-            { { 25, -16, 0 }, 44, Pitch::flat },
-            { { 26, -17, 0 }, 44, Pitch::flat },
-            { { 26, -18, 0 }, 44, Pitch::flat },
-            { { 27, -19, 0 }, 44, Pitch::flat },
-            { { 27, -20, 0 }, 44, Pitch::flat },
-            { { 28, -21, 0 }, 42, Pitch::flat },
-            { { 28, -22, 0 }, 42, Pitch::flat },
-            { { 29, -23, 0 }, 42, Pitch::flat },
-            { { 29, -24, 0 }, 42, Pitch::flat },
-            { { 30, -25, 0 }, 42, Pitch::flat },
-            { { 30, -26, 0 }, 42, Pitch::flat },
-            { { 31, -27, 0 }, 42, Pitch::flat },
-            { { 32, -28, 0 }, 42, Pitch::flat },
-            { { 32, -29, 0 }, 42, Pitch::flat },
-            { { 33, -30, 0 }, 42, Pitch::flat },
-            { { 34, -31, 0 }, 42, Pitch::flat },
-            { { 34, -32, 0 }, 42, Pitch::flat },
-            { { 35, -33, 0 }, 42, Pitch::flat },
-            { { 36, -34, 0 }, 42, Pitch::flat },
-            { { 36, -35, 0 }, 42, Pitch::flat },
-            { { 37, -36, 0 }, 42, Pitch::flat },
-            { { 38, -37, 0 }, 42, Pitch::flat },
-            { { 39, -38, 0 }, 42, Pitch::flat },
-            { { 39, -39, 0 }, 40, Pitch::flat },
-            { { 40, -40, 0 }, 40, Pitch::flat },
-            { { 41, -41, 0 }, 40, Pitch::flat },
-            { { 42, -42, 0 }, 40, Pitch::flat },
-            { { 43, -43, 0 }, 40, Pitch::flat },
-            { { 44, -44, 0 }, 40, Pitch::flat },
-            { { 44, -45, 0 }, 40, Pitch::flat },
-            { { 45, -46, 0 }, 40, Pitch::flat },
-            { { 46, -47, 0 }, 40, Pitch::flat },
-            { { 47, -48, 0 }, 40, Pitch::flat },
-        });
-
-    // 0x4e4728
-    // Track 8. Reversed 1. Direction 0
-    static constexpr auto moveInfoT8R1D0 = std::to_array<MoveInfo>(
-        {
-            { { 16, 16, 0 }, 24, Pitch::flat },
-            { { 17, 17, 0 }, 24, Pitch::flat },
-            { { 18, 18, 0 }, 24, Pitch::flat },
-            { { 19, 19, 0 }, 24, Pitch::flat },
-            { { 20, 20, 0 }, 24, Pitch::flat },
-            { { 21, 20, 0 }, 24, Pitch::flat },
-            { { 22, 21, 0 }, 24, Pitch::flat },
-            { { 23, 22, 0 }, 24, Pitch::flat },
-            { { 24, 23, 0 }, 26, Pitch::flat },
-            { { 25, 24, 0 }, 26, Pitch::flat },
-            { { 26, 25, 0 }, 26, Pitch::flat },
-            { { 27, 25, 0 }, 26, Pitch::flat },
-            { { 28, 26, 0 }, 26, Pitch::flat },
-            { { 29, 27, 0 }, 26, Pitch::flat },
-            { { 30, 28, 0 }, 26, Pitch::flat },
-            { { 31, 28, 0 }, 26, Pitch::flat },
-            { { 32, 29, 0 }, 26, Pitch::flat },
-            { { 33, 30, 0 }, 26, Pitch::flat },
-            { { 34, 30, 0 }, 26, Pitch::flat },
-            { { 35, 31, 0 }, 26, Pitch::flat },
-            { { 36, 32, 0 }, 26, Pitch::flat },
-            { { 37, 32, 0 }, 26, Pitch::flat },
-            { { 38, 33, 0 }, 26, Pitch::flat },
-            { { 39, 34, 0 }, 26, Pitch::flat },
-            { { 40, 34, 0 }, 26, Pitch::flat },
-            { { 41, 35, 0 }, 26, Pitch::flat },
-            { { 42, 35, 0 }, 26, Pitch::flat },
-            { { 43, 36, 0 }, 28, Pitch::flat },
-            { { 44, 36, 0 }, 28, Pitch::flat },
-            { { 45, 37, 0 }, 28, Pitch::flat },
-            { { 46, 37, 0 }, 28, Pitch::flat },
-            { { 47, 38, 0 }, 28, Pitch::flat },
-            { { 48, 38, 0 }, 28, Pitch::flat },
-            { { 49, 39, 0 }, 28, Pitch::flat },
-            { { 50, 39, 0 }, 28, Pitch::flat },
-            { { 51, 40, 0 }, 28, Pitch::flat },
-            { { 52, 40, 0 }, 28, Pitch::flat },
-            { { 53, 40, 0 }, 28, Pitch::flat },
-            { { 54, 41, 0 }, 28, Pitch::flat },
-            { { 55, 41, 0 }, 28, Pitch::flat },
-            { { 56, 41, 0 }, 28, Pitch::flat },
-            { { 57, 42, 0 }, 28, Pitch::flat },
-            { { 58, 42, 0 }, 28, Pitch::flat },
-            { { 59, 42, 0 }, 28, Pitch::flat },
-            { { 60, 43, 0 }, 28, Pitch::flat },
-            { { 61, 43, 0 }, 28, Pitch::flat },
-            { { 62, 43, 0 }, 28, Pitch::flat },
-            { { 63, 43, 0 }, 30, Pitch::flat },
-            { { 64, 44, 0 }, 30, Pitch::flat },
-            { { 65, 44, 0 }, 30, Pitch::flat },
-            { { 66, 44, 0 }, 30, Pitch::flat },
-            { { 67, 44, 0 }, 30, Pitch::flat },
-            { { 68, 45, 0 }, 30, Pitch::flat },
-            { { 69, 45, 0 }, 30, Pitch::flat },
-            { { 70, 45, 0 }, 30, Pitch::flat },
-            { { 71, 45, 0 }, 30, Pitch::flat },
-            { { 72, 45, 0 }, 30, Pitch::flat },
-            { { 73, 46, 0 }, 30, Pitch::flat },
-            { { 74, 46, 0 }, 30, Pitch::flat },
-            { { 75, 46, 0 }, 30, Pitch::flat },
-            { { 76, 46, 0 }, 30, Pitch::flat },
-            { { 77, 46, 0 }, 30, Pitch::flat },
-            { { 78, 47, 0 }, 30, Pitch::flat },
-            { { 79, 47, 0 }, 30, Pitch::flat },
-            { { 80, 47, 0 }, 30, Pitch::flat },
-            { { 81, 47, 0 }, 30, Pitch::flat },
-            { { 82, 47, 0 }, 30, Pitch::flat },
-            { { 83, 48, 0 }, 32, Pitch::flat },
-            { { 84, 48, 0 }, 32, Pitch::flat },
-            { { 85, 48, 0 }, 32, Pitch::flat },
-            { { 86, 48, 0 }, 32, Pitch::flat },
-            { { 87, 48, 0 }, 32, Pitch::flat },
-            { { 88, 48, 0 }, 32, Pitch::flat },
-            { { 89, 48, 0 }, 32, Pitch::flat },
-            { { 90, 48, 0 }, 32, Pitch::flat },
-            { { 91, 48, 0 }, 32, Pitch::flat },
-            { { 92, 48, 0 }, 32, Pitch::flat },
-            { { 93, 48, 0 }, 32, Pitch::flat },
-            { { 94, 48, 0 }, 32, Pitch::flat },
-            { { 95, 48, 0 }, 32, Pitch::flat },
-        });
-
-    // 0x4e49aa
-    // Track 8. Reversed 1. Direction 1
-    static constexpr auto moveInfoT8R1D1 = std::to_array<MoveInfo>(
-        {
-            { { 16, 15, 0 }, 40, Pitch::flat },
-            { { 17, 14, 0 }, 40, Pitch::flat },
-            { { 18, 13, 0 }, 40, Pitch::flat },
-            { { 19, 12, 0 }, 40, Pitch::flat },
-            { { 19, 11, 0 }, 40, Pitch::flat },
-            { { 20, 10, 0 }, 40, Pitch::flat },
-            { { 21, 9, 0 }, 40, Pitch::flat },
-            { { 22, 8, 0 }, 42, Pitch::flat },
-            { { 23, 7, 0 }, 42, Pitch::flat },
-            { { 24, 6, 0 }, 42, Pitch::flat },
-            { { 24, 5, 0 }, 42, Pitch::flat },
-            { { 25, 4, 0 }, 42, Pitch::flat },
-            { { 26, 3, 0 }, 42, Pitch::flat },
-            { { 27, 2, 0 }, 42, Pitch::flat },
-            { { 27, 1, 0 }, 42, Pitch::flat },
-            { { 28, 0, 0 }, 42, Pitch::flat },
-            { { 29, -1, 0 }, 42, Pitch::flat },
-            { { 29, -2, 0 }, 42, Pitch::flat },
-            { { 30, -3, 0 }, 42, Pitch::flat },
-            { { 31, -4, 0 }, 42, Pitch::flat },
-            { { 31, -5, 0 }, 42, Pitch::flat },
-            { { 32, -6, 0 }, 42, Pitch::flat },
-            { { 33, -7, 0 }, 42, Pitch::flat },
-            { { 33, -8, 0 }, 42, Pitch::flat },
-            { { 34, -9, 0 }, 42, Pitch::flat },
-            { { 34, -10, 0 }, 42, Pitch::flat },
-            { { 35, -11, 0 }, 44, Pitch::flat },
-            { { 35, -12, 0 }, 44, Pitch::flat },
-            { { 36, -13, 0 }, 44, Pitch::flat },
-            { { 36, -14, 0 }, 44, Pitch::flat },
-            { { 37, -15, 0 }, 44, Pitch::flat },
-            { { 37, -16, 0 }, 44, Pitch::flat },
-            { { 38, -17, 0 }, 44, Pitch::flat },
-            { { 38, -18, 0 }, 44, Pitch::flat },
-            { { 39, -19, 0 }, 44, Pitch::flat },
-            { { 39, -20, 0 }, 44, Pitch::flat },
-            { { 39, -21, 0 }, 44, Pitch::flat },
-            { { 40, -22, 0 }, 44, Pitch::flat },
-            { { 40, -23, 0 }, 44, Pitch::flat },
-            { { 40, -24, 0 }, 44, Pitch::flat },
-            { { 41, -25, 0 }, 44, Pitch::flat },
-            { { 41, -26, 0 }, 44, Pitch::flat },
-            { { 41, -27, 0 }, 44, Pitch::flat },
-            { { 42, -28, 0 }, 44, Pitch::flat },
-            { { 42, -29, 0 }, 44, Pitch::flat },
-            { { 42, -30, 0 }, 44, Pitch::flat },
-            { { 42, -31, 0 }, 46, Pitch::flat },
-            { { 43, -32, 0 }, 46, Pitch::flat },
-            { { 43, -33, 0 }, 46, Pitch::flat },
-            { { 43, -34, 0 }, 46, Pitch::flat },
-            { { 43, -35, 0 }, 46, Pitch::flat },
-            { { 44, -36, 0 }, 46, Pitch::flat },
-            { { 44, -37, 0 }, 46, Pitch::flat },
-            { { 44, -38, 0 }, 46, Pitch::flat },
-            { { 44, -39, 0 }, 46, Pitch::flat },
-            { { 44, -40, 0 }, 46, Pitch::flat },
-            { { 45, -41, 0 }, 46, Pitch::flat },
-            { { 45, -42, 0 }, 46, Pitch::flat },
-            { { 45, -43, 0 }, 46, Pitch::flat },
-            { { 45, -44, 0 }, 46, Pitch::flat },
-            { { 45, -45, 0 }, 46, Pitch::flat },
-            { { 46, -46, 0 }, 46, Pitch::flat },
-            { { 46, -47, 0 }, 46, Pitch::flat },
-            { { 46, -48, 0 }, 46, Pitch::flat },
-            { { 46, -49, 0 }, 46, Pitch::flat },
-            { { 46, -50, 0 }, 46, Pitch::flat },
-            { { 47, -51, 0 }, 48, Pitch::flat },
-            { { 47, -52, 0 }, 48, Pitch::flat },
-            { { 47, -53, 0 }, 48, Pitch::flat },
-            { { 47, -54, 0 }, 48, Pitch::flat },
-            { { 47, -55, 0 }, 48, Pitch::flat },
-            { { 47, -56, 0 }, 48, Pitch::flat },
-            { { 47, -57, 0 }, 48, Pitch::flat },
-            { { 47, -58, 0 }, 48, Pitch::flat },
-            { { 47, -59, 0 }, 48, Pitch::flat },
-            { { 47, -60, 0 }, 48, Pitch::flat },
-            { { 47, -61, 0 }, 48, Pitch::flat },
-            { { 47, -62, 0 }, 48, Pitch::flat },
-            { { 47, -63, 0 }, 48, Pitch::flat },
-            { { 47, -64, 0 }, 48, Pitch::flat },
-        });
-
-    // 0x4e4c2c
-    // Track 8. Reversed 1. Direction 2
-    static constexpr auto moveInfoT8R1D2 = std::to_array<MoveInfo>(
-        {
-            { { 15, 15, 0 }, 56, Pitch::flat },
-            { { 14, 14, 0 }, 56, Pitch::flat },
-            { { 13, 13, 0 }, 56, Pitch::flat },
-            { { 12, 12, 0 }, 56, Pitch::flat },
-            { { 11, 12, 0 }, 56, Pitch::flat },
-            { { 10, 11, 0 }, 56, Pitch::flat },
-            { { 9, 10, 0 }, 56, Pitch::flat },
-            { { 8, 9, 0 }, 58, Pitch::flat },
-            { { 7, 8, 0 }, 58, Pitch::flat },
-            { { 6, 7, 0 }, 58, Pitch::flat },
-            { { 5, 7, 0 }, 58, Pitch::flat },
-            { { 4, 6, 0 }, 58, Pitch::flat },
-            { { 3, 5, 0 }, 58, Pitch::flat },
-            { { 2, 4, 0 }, 58, Pitch::flat },
-            { { 1, 4, 0 }, 58, Pitch::flat },
-            { { 0, 3, 0 }, 58, Pitch::flat },
-            { { -1, 2, 0 }, 58, Pitch::flat },
-            { { -2, 2, 0 }, 58, Pitch::flat },
-            { { -3, 1, 0 }, 58, Pitch::flat },
-            { { -4, 0, 0 }, 58, Pitch::flat },
-            { { -5, 0, 0 }, 58, Pitch::flat },
-            { { -6, -1, 0 }, 58, Pitch::flat },
-            { { -7, -2, 0 }, 58, Pitch::flat },
-            { { -8, -2, 0 }, 58, Pitch::flat },
-            { { -9, -3, 0 }, 58, Pitch::flat },
-            { { -10, -3, 0 }, 58, Pitch::flat },
-            { { -11, -4, 0 }, 60, Pitch::flat },
-            { { -12, -4, 0 }, 60, Pitch::flat },
-            { { -13, -5, 0 }, 60, Pitch::flat },
-            { { -14, -5, 0 }, 60, Pitch::flat },
-            { { -15, -6, 0 }, 60, Pitch::flat },
-            { { -16, -6, 0 }, 60, Pitch::flat },
-            { { -17, -7, 0 }, 60, Pitch::flat },
-            { { -18, -7, 0 }, 60, Pitch::flat },
-            { { -19, -8, 0 }, 60, Pitch::flat },
-            { { -20, -8, 0 }, 60, Pitch::flat },
-            { { -21, -8, 0 }, 60, Pitch::flat },
-            { { -22, -9, 0 }, 60, Pitch::flat },
-            { { -23, -9, 0 }, 60, Pitch::flat },
-            { { -24, -9, 0 }, 60, Pitch::flat },
-            { { -25, -10, 0 }, 60, Pitch::flat },
-            { { -26, -10, 0 }, 60, Pitch::flat },
-            { { -27, -10, 0 }, 60, Pitch::flat },
-            { { -28, -11, 0 }, 60, Pitch::flat },
-            { { -29, -11, 0 }, 60, Pitch::flat },
-            { { -30, -11, 0 }, 60, Pitch::flat },
-            { { -31, -11, 0 }, 62, Pitch::flat },
-            { { -32, -12, 0 }, 62, Pitch::flat },
-            { { -33, -12, 0 }, 62, Pitch::flat },
-            { { -34, -12, 0 }, 62, Pitch::flat },
-            { { -35, -12, 0 }, 62, Pitch::flat },
-            { { -36, -13, 0 }, 62, Pitch::flat },
-            { { -37, -13, 0 }, 62, Pitch::flat },
-            { { -38, -13, 0 }, 62, Pitch::flat },
-            { { -39, -13, 0 }, 62, Pitch::flat },
-            { { -40, -13, 0 }, 62, Pitch::flat },
-            { { -41, -14, 0 }, 62, Pitch::flat },
-            { { -42, -14, 0 }, 62, Pitch::flat },
-            { { -43, -14, 0 }, 62, Pitch::flat },
-            { { -44, -14, 0 }, 62, Pitch::flat },
-            { { -45, -14, 0 }, 62, Pitch::flat },
-            { { -46, -15, 0 }, 62, Pitch::flat },
-            { { -47, -15, 0 }, 62, Pitch::flat },
-            { { -48, -15, 0 }, 62, Pitch::flat },
-            { { -49, -15, 0 }, 62, Pitch::flat },
-            { { -50, -15, 0 }, 62, Pitch::flat },
-            { { -51, -16, 0 }, 0, Pitch::flat },
-            { { -52, -16, 0 }, 0, Pitch::flat },
-            { { -53, -16, 0 }, 0, Pitch::flat },
-            { { -54, -16, 0 }, 0, Pitch::flat },
-            { { -55, -16, 0 }, 0, Pitch::flat },
-            { { -56, -16, 0 }, 0, Pitch::flat },
-            { { -57, -16, 0 }, 0, Pitch::flat },
-            { { -58, -16, 0 }, 0, Pitch::flat },
-            { { -59, -16, 0 }, 0, Pitch::flat },
-            { { -60, -16, 0 }, 0, Pitch::flat },
-            { { -61, -16, 0 }, 0, Pitch::flat },
-            { { -62, -16, 0 }, 0, Pitch::flat },
-            { { -63, -16, 0 }, 0, Pitch::flat },
-            { { -64, -16, 0 }, 0, Pitch::flat },
-        });
-
-    // 0x4e44ae
-    // Track 8. Reversed 1. Direction 3
-    static constexpr auto moveInfoT8R1D3 = std::to_array<MoveInfo>(
-        {
-            { { 15, 17, 0 }, 8, Pitch::flat },
-            { { 14, 18, 0 }, 8, Pitch::flat },
-            { { 13, 19, 0 }, 8, Pitch::flat },
-            { { 12, 20, 0 }, 8, Pitch::flat },
-            { { 12, 21, 0 }, 8, Pitch::flat },
-            { { 11, 22, 0 }, 8, Pitch::flat },
-            { { 10, 23, 0 }, 8, Pitch::flat },
-            { { 9, 24, 0 }, 10, Pitch::flat },
-            { { 8, 25, 0 }, 10, Pitch::flat },
-            { { 7, 26, 0 }, 10, Pitch::flat },
-            { { 7, 27, 0 }, 10, Pitch::flat },
-            { { 6, 28, 0 }, 10, Pitch::flat },
-            { { 5, 29, 0 }, 10, Pitch::flat },
-            { { 4, 30, 0 }, 10, Pitch::flat },
-            { { 4, 31, 0 }, 10, Pitch::flat },
-            { { 3, 32, 0 }, 10, Pitch::flat },
-            { { 2, 33, 0 }, 10, Pitch::flat },
-            { { 2, 34, 0 }, 10, Pitch::flat },
-            { { 1, 35, 0 }, 10, Pitch::flat },
-            { { 0, 36, 0 }, 10, Pitch::flat },
-            { { 0, 37, 0 }, 10, Pitch::flat },
-            { { -1, 38, 0 }, 10, Pitch::flat },
-            { { -2, 39, 0 }, 10, Pitch::flat },
-            { { -2, 40, 0 }, 10, Pitch::flat },
-            { { -3, 41, 0 }, 10, Pitch::flat },
-            { { -3, 42, 0 }, 10, Pitch::flat },
-            { { -4, 43, 0 }, 12, Pitch::flat },
-            { { -4, 44, 0 }, 12, Pitch::flat },
-            { { -5, 45, 0 }, 12, Pitch::flat },
-            { { -5, 46, 0 }, 12, Pitch::flat },
-            { { -6, 47, 0 }, 12, Pitch::flat },
-            { { -6, 48, 0 }, 12, Pitch::flat },
-            { { -7, 49, 0 }, 12, Pitch::flat },
-            { { -7, 50, 0 }, 12, Pitch::flat },
-            { { -8, 51, 0 }, 12, Pitch::flat },
-            { { -8, 52, 0 }, 12, Pitch::flat },
-            { { -8, 53, 0 }, 12, Pitch::flat },
-            { { -9, 54, 0 }, 12, Pitch::flat },
-            { { -9, 55, 0 }, 12, Pitch::flat },
-            { { -9, 56, 0 }, 12, Pitch::flat },
-            { { -10, 57, 0 }, 12, Pitch::flat },
-            { { -10, 58, 0 }, 12, Pitch::flat },
-            { { -10, 59, 0 }, 12, Pitch::flat },
-            { { -11, 60, 0 }, 12, Pitch::flat },
-            { { -11, 61, 0 }, 12, Pitch::flat },
-            { { -11, 62, 0 }, 12, Pitch::flat },
-            { { -11, 63, 0 }, 14, Pitch::flat },
-            { { -12, 64, 0 }, 14, Pitch::flat },
-            { { -12, 65, 0 }, 14, Pitch::flat },
-            { { -12, 66, 0 }, 14, Pitch::flat },
-            { { -12, 67, 0 }, 14, Pitch::flat },
-            { { -13, 68, 0 }, 14, Pitch::flat },
-            { { -13, 69, 0 }, 14, Pitch::flat },
-            { { -13, 70, 0 }, 14, Pitch::flat },
-            { { -13, 71, 0 }, 14, Pitch::flat },
-            { { -13, 72, 0 }, 14, Pitch::flat },
-            { { -14, 73, 0 }, 14, Pitch::flat },
-            { { -14, 74, 0 }, 14, Pitch::flat },
-            { { -14, 75, 0 }, 14, Pitch::flat },
-            { { -14, 76, 0 }, 14, Pitch::flat },
-            { { -14, 77, 0 }, 14, Pitch::flat },
-            { { -15, 78, 0 }, 14, Pitch::flat },
-            { { -15, 79, 0 }, 14, Pitch::flat },
-            { { -15, 80, 0 }, 14, Pitch::flat },
-            { { -15, 81, 0 }, 14, Pitch::flat },
-            { { -15, 82, 0 }, 14, Pitch::flat },
-            { { -16, 83, 0 }, 16, Pitch::flat },
-            { { -16, 84, 0 }, 16, Pitch::flat },
-            { { -16, 85, 0 }, 16, Pitch::flat },
-            { { -16, 86, 0 }, 16, Pitch::flat },
-            { { -16, 87, 0 }, 16, Pitch::flat },
-            { { -16, 88, 0 }, 16, Pitch::flat },
-            { { -16, 89, 0 }, 16, Pitch::flat },
-            { { -16, 90, 0 }, 16, Pitch::flat },
-            { { -16, 91, 0 }, 16, Pitch::flat },
-            { { -16, 92, 0 }, 16, Pitch::flat },
-            { { -16, 93, 0 }, 16, Pitch::flat },
-            { { -16, 94, 0 }, 16, Pitch::flat },
-            { { -16, 95, 0 }, 16, Pitch::flat },
-        });
-
-    // 0x4e3aa6
-    // Track 9. Reversed 0. Direction 0
-    static constexpr auto moveInfoT9R0D0 = std::to_array<MoveInfo>(
-        {
-            { { 31, 16, 0 }, 0, Pitch::flat },
-            { { 30, 16, 0 }, 0, Pitch::flat },
-            { { 29, 16, 0 }, 0, Pitch::flat },
-            { { 28, 16, 0 }, 0, Pitch::flat },
-            { { 27, 16, 0 }, 0, Pitch::flat },
-            { { 26, 16, 0 }, 0, Pitch::flat },
-            { { 25, 16, 0 }, 0, Pitch::flat },
-            { { 24, 16, 0 }, 0, Pitch::flat },
-            { { 23, 16, 0 }, 0, Pitch::flat },
-            { { 22, 16, 0 }, 0, Pitch::flat },
-            { { 21, 16, 0 }, 2, Pitch::flat },
-            { { 20, 16, 0 }, 2, Pitch::flat },
-            { { 19, 16, 0 }, 2, Pitch::flat },
-            { { 18, 16, 0 }, 2, Pitch::flat },
-            { { 17, 17, 0 }, 2, Pitch::flat },
-            { { 16, 17, 0 }, 2, Pitch::flat },
-            { { 15, 17, 0 }, 2, Pitch::flat },
-            { { 14, 17, 0 }, 2, Pitch::flat },
-            { { 13, 17, 0 }, 2, Pitch::flat },
-            { { 12, 18, 0 }, 2, Pitch::flat },
-            { { 11, 18, 0 }, 2, Pitch::flat },
-            { { 10, 18, 0 }, 2, Pitch::flat },
-            { { 9, 18, 0 }, 2, Pitch::flat },
-            { { 8, 18, 0 }, 2, Pitch::flat },
-            { { 7, 19, 0 }, 2, Pitch::flat },
-            { { 6, 19, 0 }, 2, Pitch::flat },
-            { { 5, 19, 0 }, 2, Pitch::flat },
-            { { 4, 19, 0 }, 2, Pitch::flat },
-            { { 3, 19, 0 }, 2, Pitch::flat },
-            { { 2, 20, 0 }, 2, Pitch::flat },
-            { { 1, 20, 0 }, 2, Pitch::flat },
-            { { 0, 20, 0 }, 4, Pitch::flat },
-            { { -1, 20, 0 }, 4, Pitch::flat },
-            { { -2, 21, 0 }, 4, Pitch::flat },
-            { { -3, 21, 0 }, 4, Pitch::flat },
-            { { -4, 21, 0 }, 4, Pitch::flat },
-            { { -5, 21, 0 }, 4, Pitch::flat },
-            { { -6, 22, 0 }, 4, Pitch::flat },
-            { { -7, 22, 0 }, 4, Pitch::flat },
-            { { -8, 22, 0 }, 4, Pitch::flat },
-            { { -9, 23, 0 }, 4, Pitch::flat },
-            { { -10, 23, 0 }, 4, Pitch::flat },
-            { { -11, 23, 0 }, 4, Pitch::flat },
-            { { -12, 24, 0 }, 4, Pitch::flat },
-            { { -13, 24, 0 }, 4, Pitch::flat },
-            { { -14, 24, 0 }, 4, Pitch::flat },
-            { { -15, 25, 0 }, 4, Pitch::flat },
-            { { -16, 25, 0 }, 4, Pitch::flat },
-            { { -17, 26, 0 }, 4, Pitch::flat },
-            { { -18, 26, 0 }, 4, Pitch::flat },
-            { { -19, 27, 0 }, 4, Pitch::flat },
-            { { -20, 27, 0 }, 4, Pitch::flat },
-            { { -21, 28, 0 }, 6, Pitch::flat },
-            { { -22, 28, 0 }, 6, Pitch::flat },
-            { { -23, 29, 0 }, 6, Pitch::flat },
-            { { -24, 29, 0 }, 6, Pitch::flat },
-            { { -25, 30, 0 }, 6, Pitch::flat },
-            { { -26, 30, 0 }, 6, Pitch::flat },
-            { { -27, 31, 0 }, 6, Pitch::flat },
-            { { -28, 32, 0 }, 6, Pitch::flat },
-            { { -29, 32, 0 }, 6, Pitch::flat },
-            { { -30, 33, 0 }, 6, Pitch::flat },
-            { { -31, 34, 0 }, 6, Pitch::flat },
-            { { -32, 34, 0 }, 6, Pitch::flat },
-            { { -33, 35, 0 }, 6, Pitch::flat },
-            { { -34, 36, 0 }, 6, Pitch::flat },
-            { { -35, 36, 0 }, 6, Pitch::flat },
-            { { -36, 37, 0 }, 6, Pitch::flat },
-            { { -37, 38, 0 }, 6, Pitch::flat },
-            { { -38, 39, 0 }, 6, Pitch::flat },
-            { { -39, 39, 0 }, 8, Pitch::flat },
-            { { -40, 40, 0 }, 8, Pitch::flat },
-            { { -41, 41, 0 }, 8, Pitch::flat },
-            { { -42, 42, 0 }, 8, Pitch::flat },
-            { { -43, 43, 0 }, 8, Pitch::flat },
-            { { -44, 44, 0 }, 8, Pitch::flat },
-            { { -45, 44, 0 }, 8, Pitch::flat },
-            { { -46, 45, 0 }, 8, Pitch::flat },
-            { { -47, 46, 0 }, 8, Pitch::flat },
-            { { -48, 47, 0 }, 8, Pitch::flat },
-        });
-
-    // 0x4e3d28
-    // Track 9. Reversed 0. Direction 1
-    static constexpr auto moveInfoT9R0D1 = std::to_array<MoveInfo>(
-        {
-            { { 16, 0, 0 }, 16, Pitch::flat },
-            { { 16, 1, 0 }, 16, Pitch::flat },
-            { { 16, 2, 0 }, 16, Pitch::flat },
-            { { 16, 3, 0 }, 16, Pitch::flat },
-            { { 16, 4, 0 }, 16, Pitch::flat },
-            { { 16, 5, 0 }, 16, Pitch::flat },
-            { { 16, 6, 0 }, 16, Pitch::flat },
-            { { 16, 7, 0 }, 16, Pitch::flat },
-            { { 16, 8, 0 }, 16, Pitch::flat },
-            { { 16, 9, 0 }, 16, Pitch::flat },
-            { { 16, 10, 0 }, 16, Pitch::flat },
-            { { 16, 11, 0 }, 18, Pitch::flat },
-            { { 16, 12, 0 }, 18, Pitch::flat },
-            { { 16, 13, 0 }, 18, Pitch::flat },
-            { { 17, 14, 0 }, 18, Pitch::flat },
-            { { 17, 15, 0 }, 18, Pitch::flat },
-            { { 17, 16, 0 }, 18, Pitch::flat },
-            { { 17, 17, 0 }, 18, Pitch::flat },
-            { { 17, 18, 0 }, 18, Pitch::flat },
-            { { 18, 19, 0 }, 18, Pitch::flat },
-            { { 18, 20, 0 }, 18, Pitch::flat },
-            { { 18, 21, 0 }, 18, Pitch::flat },
-            { { 18, 22, 0 }, 18, Pitch::flat },
-            { { 18, 23, 0 }, 18, Pitch::flat },
-            { { 19, 24, 0 }, 18, Pitch::flat },
-            { { 19, 25, 0 }, 18, Pitch::flat },
-            { { 19, 26, 0 }, 18, Pitch::flat },
-            { { 19, 27, 0 }, 18, Pitch::flat },
-            { { 19, 28, 0 }, 18, Pitch::flat },
-            { { 20, 29, 0 }, 18, Pitch::flat },
-            { { 20, 30, 0 }, 18, Pitch::flat },
-            { { 20, 31, 0 }, 18, Pitch::flat },
-            { { 20, 32, 0 }, 20, Pitch::flat },
-            { { 21, 33, 0 }, 20, Pitch::flat },
-            { { 21, 34, 0 }, 20, Pitch::flat },
-            { { 21, 35, 0 }, 20, Pitch::flat },
-            { { 21, 36, 0 }, 20, Pitch::flat },
-            { { 22, 37, 0 }, 20, Pitch::flat },
-            { { 22, 38, 0 }, 20, Pitch::flat },
-            { { 22, 39, 0 }, 20, Pitch::flat },
-            { { 23, 40, 0 }, 20, Pitch::flat },
-            { { 23, 41, 0 }, 20, Pitch::flat },
-            { { 23, 42, 0 }, 20, Pitch::flat },
-            { { 24, 43, 0 }, 20, Pitch::flat },
-            { { 24, 44, 0 }, 20, Pitch::flat },
-            { { 24, 45, 0 }, 20, Pitch::flat },
-            { { 25, 46, 0 }, 20, Pitch::flat },
-            { { 25, 47, 0 }, 20, Pitch::flat },
-            { { 26, 48, 0 }, 20, Pitch::flat },
-            { { 26, 49, 0 }, 20, Pitch::flat },
-            { { 27, 50, 0 }, 20, Pitch::flat },
-            { { 27, 51, 0 }, 20, Pitch::flat },
-            { { 28, 52, 0 }, 20, Pitch::flat },
-            { { 28, 53, 0 }, 22, Pitch::flat },
-            { { 29, 54, 0 }, 22, Pitch::flat },
-            { { 29, 55, 0 }, 22, Pitch::flat },
-            { { 30, 56, 0 }, 22, Pitch::flat },
-            { { 30, 57, 0 }, 22, Pitch::flat },
-            { { 31, 58, 0 }, 22, Pitch::flat },
-            { { 32, 59, 0 }, 22, Pitch::flat },
-            { { 32, 60, 0 }, 22, Pitch::flat },
-            { { 33, 61, 0 }, 22, Pitch::flat },
-            { { 34, 62, 0 }, 22, Pitch::flat },
-            { { 34, 63, 0 }, 22, Pitch::flat },
-            { { 35, 64, 0 }, 22, Pitch::flat },
-            { { 36, 65, 0 }, 22, Pitch::flat },
-            { { 36, 66, 0 }, 22, Pitch::flat },
-            { { 37, 67, 0 }, 22, Pitch::flat },
-            { { 38, 68, 0 }, 22, Pitch::flat },
-            { { 39, 69, 0 }, 22, Pitch::flat },
-            { { 39, 70, 0 }, 22, Pitch::flat },
-            { { 40, 71, 0 }, 24, Pitch::flat },
-            { { 41, 72, 0 }, 24, Pitch::flat },
-            { { 42, 73, 0 }, 24, Pitch::flat },
-            { { 43, 74, 0 }, 24, Pitch::flat },
-            { { 44, 75, 0 }, 24, Pitch::flat },
-            { { 44, 76, 0 }, 24, Pitch::flat },
-            { { 45, 77, 0 }, 24, Pitch::flat },
-            { { 46, 78, 0 }, 24, Pitch::flat },
-            { { 47, 79, 0 }, 24, Pitch::flat },
-        });
-
-    // 0x4e3faa
-    // Track 9. Reversed 0. Direction 2
-    static constexpr auto moveInfoT9R0D2 = std::to_array<MoveInfo>(
-        {
-            { { 0, 16, 0 }, 32, Pitch::flat },
-            { { 1, 16, 0 }, 32, Pitch::flat },
-            { { 2, 16, 0 }, 32, Pitch::flat },
-            { { 3, 16, 0 }, 32, Pitch::flat },
-            { { 4, 16, 0 }, 32, Pitch::flat },
-            { { 5, 16, 0 }, 32, Pitch::flat },
-            { { 6, 16, 0 }, 32, Pitch::flat },
-            { { 7, 16, 0 }, 32, Pitch::flat },
-            { { 8, 16, 0 }, 32, Pitch::flat },
-            { { 9, 16, 0 }, 32, Pitch::flat },
-            { { 10, 16, 0 }, 32, Pitch::flat },
-            { { 11, 16, 0 }, 34, Pitch::flat },
-            { { 12, 16, 0 }, 34, Pitch::flat },
-            { { 13, 15, 0 }, 34, Pitch::flat },
-            { { 14, 15, 0 }, 34, Pitch::flat },
-            { { 15, 15, 0 }, 34, Pitch::flat },
-            { { 16, 15, 0 }, 34, Pitch::flat },
-            { { 17, 15, 0 }, 34, Pitch::flat },
-            { { 18, 14, 0 }, 34, Pitch::flat },
-            { { 19, 14, 0 }, 34, Pitch::flat },
-            { { 20, 14, 0 }, 34, Pitch::flat },
-            { { 21, 14, 0 }, 34, Pitch::flat },
-            { { 22, 14, 0 }, 34, Pitch::flat },
-            { { 23, 13, 0 }, 34, Pitch::flat },
-            { { 24, 13, 0 }, 34, Pitch::flat },
-            { { 25, 13, 0 }, 34, Pitch::flat },
-            { { 26, 13, 0 }, 34, Pitch::flat },
-            { { 27, 13, 0 }, 34, Pitch::flat },
-            { { 28, 12, 0 }, 34, Pitch::flat },
-            { { 29, 12, 0 }, 34, Pitch::flat },
-            { { 30, 12, 0 }, 34, Pitch::flat },
-            { { 31, 12, 0 }, 34, Pitch::flat },
-            { { 32, 11, 0 }, 36, Pitch::flat },
-            { { 33, 11, 0 }, 36, Pitch::flat },
-            { { 34, 11, 0 }, 36, Pitch::flat },
-            { { 35, 11, 0 }, 36, Pitch::flat },
-            { { 36, 10, 0 }, 36, Pitch::flat },
-            { { 37, 10, 0 }, 36, Pitch::flat },
-            { { 38, 10, 0 }, 36, Pitch::flat },
-            { { 39, 9, 0 }, 36, Pitch::flat },
-            { { 40, 9, 0 }, 36, Pitch::flat },
-            { { 41, 9, 0 }, 36, Pitch::flat },
-            { { 42, 8, 0 }, 36, Pitch::flat },
-            { { 43, 8, 0 }, 36, Pitch::flat },
-            { { 44, 8, 0 }, 36, Pitch::flat },
-            { { 45, 7, 0 }, 36, Pitch::flat },
-            { { 46, 7, 0 }, 36, Pitch::flat },
-            { { 47, 6, 0 }, 36, Pitch::flat },
-            { { 48, 6, 0 }, 36, Pitch::flat },
-            { { 49, 5, 0 }, 36, Pitch::flat },
-            { { 50, 5, 0 }, 36, Pitch::flat },
-            { { 51, 4, 0 }, 36, Pitch::flat },
-            { { 52, 4, 0 }, 36, Pitch::flat },
-            { { 53, 3, 0 }, 38, Pitch::flat },
-            { { 54, 3, 0 }, 38, Pitch::flat },
-            { { 55, 2, 0 }, 38, Pitch::flat },
-            { { 56, 2, 0 }, 38, Pitch::flat },
-            { { 57, 1, 0 }, 38, Pitch::flat },
-            { { 58, 0, 0 }, 38, Pitch::flat },
-            { { 59, 0, 0 }, 38, Pitch::flat },
-            { { 60, -1, 0 }, 38, Pitch::flat },
-            { { 61, -2, 0 }, 38, Pitch::flat },
-            { { 62, -2, 0 }, 38, Pitch::flat },
-            { { 63, -3, 0 }, 38, Pitch::flat },
-            { { 64, -4, 0 }, 38, Pitch::flat },
-            { { 65, -4, 0 }, 38, Pitch::flat },
-            { { 66, -5, 0 }, 38, Pitch::flat },
-            { { 67, -6, 0 }, 38, Pitch::flat },
-            { { 68, -7, 0 }, 38, Pitch::flat },
-            { { 69, -7, 0 }, 38, Pitch::flat },
-            { { 70, -8, 0 }, 38, Pitch::flat },
-            { { 71, -9, 0 }, 40, Pitch::flat },
-            { { 72, -10, 0 }, 40, Pitch::flat },
-            { { 73, -11, 0 }, 40, Pitch::flat },
-            { { 74, -12, 0 }, 40, Pitch::flat },
-            { { 75, -12, 0 }, 40, Pitch::flat },
-            { { 76, -13, 0 }, 40, Pitch::flat },
-            { { 77, -14, 0 }, 40, Pitch::flat },
-            { { 78, -15, 0 }, 40, Pitch::flat },
-            { { 79, -16, 0 }, 40, Pitch::flat },
-        });
-
-    // 0x4e422c
-    // Track 9. Reversed 0. Direction 3
-    static constexpr auto moveInfoT9R0D3 = std::to_array<MoveInfo>(
-        {
-            { { 16, 31, 0 }, 48, Pitch::flat },
-            { { 16, 30, 0 }, 48, Pitch::flat },
-            { { 16, 29, 0 }, 48, Pitch::flat },
-            { { 16, 28, 0 }, 48, Pitch::flat },
-            { { 16, 27, 0 }, 48, Pitch::flat },
-            { { 16, 26, 0 }, 48, Pitch::flat },
-            { { 16, 25, 0 }, 48, Pitch::flat },
-            { { 16, 24, 0 }, 48, Pitch::flat },
-            { { 16, 23, 0 }, 48, Pitch::flat },
-            { { 16, 22, 0 }, 48, Pitch::flat },
-            { { 16, 21, 0 }, 50, Pitch::flat },
-            { { 16, 20, 0 }, 50, Pitch::flat },
-            { { 16, 19, 0 }, 50, Pitch::flat },
-            { { 15, 18, 0 }, 50, Pitch::flat },
-            { { 15, 17, 0 }, 50, Pitch::flat },
-            { { 15, 16, 0 }, 50, Pitch::flat },
-            { { 15, 15, 0 }, 50, Pitch::flat },
-            { { 15, 14, 0 }, 50, Pitch::flat },
-            { { 14, 13, 0 }, 50, Pitch::flat },
-            { { 14, 12, 0 }, 50, Pitch::flat },
-            { { 14, 11, 0 }, 50, Pitch::flat },
-            { { 14, 10, 0 }, 50, Pitch::flat },
-            { { 14, 9, 0 }, 50, Pitch::flat },
-            { { 13, 8, 0 }, 50, Pitch::flat },
-            { { 13, 7, 0 }, 50, Pitch::flat },
-            { { 13, 6, 0 }, 50, Pitch::flat },
-            { { 13, 5, 0 }, 50, Pitch::flat },
-            { { 13, 4, 0 }, 50, Pitch::flat },
-            { { 12, 3, 0 }, 50, Pitch::flat },
-            { { 12, 2, 0 }, 50, Pitch::flat },
-            { { 12, 1, 0 }, 50, Pitch::flat },
-            { { 12, 0, 0 }, 52, Pitch::flat },
-            { { 11, -1, 0 }, 52, Pitch::flat },
-            { { 11, -2, 0 }, 52, Pitch::flat },
-            { { 11, -3, 0 }, 52, Pitch::flat },
-            { { 11, -4, 0 }, 52, Pitch::flat },
-            { { 10, -5, 0 }, 52, Pitch::flat },
-            { { 10, -6, 0 }, 52, Pitch::flat },
-            { { 10, -7, 0 }, 52, Pitch::flat },
-            { { 9, -8, 0 }, 52, Pitch::flat },
-            { { 9, -9, 0 }, 52, Pitch::flat },
-            { { 9, -10, 0 }, 52, Pitch::flat },
-            { { 8, -11, 0 }, 52, Pitch::flat },
-            { { 8, -12, 0 }, 52, Pitch::flat },
-            { { 8, -13, 0 }, 52, Pitch::flat },
-            { { 7, -14, 0 }, 52, Pitch::flat },
-            { { 7, -15, 0 }, 52, Pitch::flat },
-            { { 6, -16, 0 }, 52, Pitch::flat },
-            { { 6, -17, 0 }, 52, Pitch::flat },
-            { { 5, -18, 0 }, 52, Pitch::flat },
-            { { 5, -19, 0 }, 52, Pitch::flat },
-            { { 4, -20, 0 }, 52, Pitch::flat },
-            { { 4, -21, 0 }, 54, Pitch::flat },
-            { { 3, -22, 0 }, 54, Pitch::flat },
-            { { 3, -23, 0 }, 54, Pitch::flat },
-            { { 2, -24, 0 }, 54, Pitch::flat },
-            { { 2, -25, 0 }, 54, Pitch::flat },
-            { { 1, -26, 0 }, 54, Pitch::flat },
-            { { 0, -27, 0 }, 54, Pitch::flat },
-            { { 0, -28, 0 }, 54, Pitch::flat },
-            { { -1, -29, 0 }, 54, Pitch::flat },
-            { { -2, -30, 0 }, 54, Pitch::flat },
-            { { -2, -31, 0 }, 54, Pitch::flat },
-            { { -3, -32, 0 }, 54, Pitch::flat },
-            { { -4, -33, 0 }, 54, Pitch::flat },
-            { { -4, -34, 0 }, 54, Pitch::flat },
-            { { -5, -35, 0 }, 54, Pitch::flat },
-            { { -6, -36, 0 }, 54, Pitch::flat },
-            { { -7, -37, 0 }, 54, Pitch::flat },
-            { { -7, -38, 0 }, 54, Pitch::flat },
-            { { -8, -39, 0 }, 56, Pitch::flat },
-            { { -9, -40, 0 }, 56, Pitch::flat },
-            { { -10, -41, 0 }, 56, Pitch::flat },
-            { { -11, -42, 0 }, 56, Pitch::flat },
-            { { -12, -43, 0 }, 56, Pitch::flat },
-            { { -12, -44, 0 }, 56, Pitch::flat },
-            { { -13, -45, 0 }, 56, Pitch::flat },
-            { { -14, -46, 0 }, 56, Pitch::flat },
-            { { -15, -47, 0 }, 56, Pitch::flat },
-            { { -16, -48, 0 }, 56, Pitch::flat },
-        });
-
-    // 0x4e35a2
-    // Track 9. Reversed 1. Direction 0
-    static constexpr auto moveInfoT9R1D0 = std::to_array<MoveInfo>(
-        {
-            { { 16, 15, 0 }, 40, Pitch::flat },
-            { { 17, 14, 0 }, 40, Pitch::flat },
-            { { 18, 13, 0 }, 40, Pitch::flat },
-            { { 19, 12, 0 }, 40, Pitch::flat },
-            { { 20, 12, 0 }, 40, Pitch::flat },
-            { { 21, 11, 0 }, 40, Pitch::flat },
-            { { 22, 10, 0 }, 40, Pitch::flat },
-            { { 23, 9, 0 }, 38, Pitch::flat },
-            { { 24, 8, 0 }, 38, Pitch::flat },
-            { { 25, 7, 0 }, 38, Pitch::flat },
-            { { 26, 7, 0 }, 38, Pitch::flat },
-            { { 27, 6, 0 }, 38, Pitch::flat },
-            { { 28, 5, 0 }, 38, Pitch::flat },
-            { { 29, 4, 0 }, 38, Pitch::flat },
-            { { 30, 4, 0 }, 38, Pitch::flat },
-            { { 31, 3, 0 }, 38, Pitch::flat },
-            { { 32, 2, 0 }, 38, Pitch::flat },
-            { { 33, 2, 0 }, 38, Pitch::flat },
-            { { 34, 1, 0 }, 38, Pitch::flat },
-            { { 35, 0, 0 }, 38, Pitch::flat },
-            { { 36, 0, 0 }, 38, Pitch::flat },
-            { { 37, -1, 0 }, 38, Pitch::flat },
-            { { 38, -2, 0 }, 38, Pitch::flat },
-            { { 39, -2, 0 }, 38, Pitch::flat },
-            { { 40, -3, 0 }, 38, Pitch::flat },
-            { { 41, -3, 0 }, 38, Pitch::flat },
-            { { 42, -4, 0 }, 36, Pitch::flat },
-            { { 43, -4, 0 }, 36, Pitch::flat },
-            { { 44, -5, 0 }, 36, Pitch::flat },
-            { { 45, -5, 0 }, 36, Pitch::flat },
-            { { 46, -6, 0 }, 36, Pitch::flat },
-            { { 47, -6, 0 }, 36, Pitch::flat },
-            { { 48, -7, 0 }, 36, Pitch::flat },
-            { { 49, -7, 0 }, 36, Pitch::flat },
-            { { 50, -8, 0 }, 36, Pitch::flat },
-            { { 51, -8, 0 }, 36, Pitch::flat },
-            { { 52, -8, 0 }, 36, Pitch::flat },
-            { { 53, -9, 0 }, 36, Pitch::flat },
-            { { 54, -9, 0 }, 36, Pitch::flat },
-            { { 55, -9, 0 }, 36, Pitch::flat },
-            { { 56, -10, 0 }, 36, Pitch::flat },
-            { { 57, -10, 0 }, 36, Pitch::flat },
-            { { 58, -10, 0 }, 36, Pitch::flat },
-            { { 59, -11, 0 }, 36, Pitch::flat },
-            { { 60, -11, 0 }, 36, Pitch::flat },
-            { { 61, -11, 0 }, 36, Pitch::flat },
-            { { 62, -11, 0 }, 34, Pitch::flat },
-            { { 63, -12, 0 }, 34, Pitch::flat },
-            { { 64, -12, 0 }, 34, Pitch::flat },
-            { { 65, -12, 0 }, 34, Pitch::flat },
-            { { 66, -12, 0 }, 34, Pitch::flat },
-            { { 67, -13, 0 }, 34, Pitch::flat },
-            { { 68, -13, 0 }, 34, Pitch::flat },
-            { { 69, -13, 0 }, 34, Pitch::flat },
-            { { 70, -13, 0 }, 34, Pitch::flat },
-            { { 71, -13, 0 }, 34, Pitch::flat },
-            { { 72, -14, 0 }, 34, Pitch::flat },
-            { { 73, -14, 0 }, 34, Pitch::flat },
-            { { 74, -14, 0 }, 34, Pitch::flat },
-            { { 75, -14, 0 }, 34, Pitch::flat },
-            { { 76, -14, 0 }, 34, Pitch::flat },
-            { { 77, -15, 0 }, 34, Pitch::flat },
-            { { 78, -15, 0 }, 34, Pitch::flat },
-            { { 79, -15, 0 }, 34, Pitch::flat },
-            { { 80, -15, 0 }, 34, Pitch::flat },
-            { { 81, -15, 0 }, 34, Pitch::flat },
-            { { 82, -16, 0 }, 32, Pitch::flat },
-            { { 83, -16, 0 }, 32, Pitch::flat },
-            { { 84, -16, 0 }, 32, Pitch::flat },
-            { { 85, -16, 0 }, 32, Pitch::flat },
-            { { 86, -16, 0 }, 32, Pitch::flat },
-            { { 87, -16, 0 }, 32, Pitch::flat },
-            { { 88, -16, 0 }, 32, Pitch::flat },
-            { { 89, -16, 0 }, 32, Pitch::flat },
-            { { 90, -16, 0 }, 32, Pitch::flat },
-            { { 91, -16, 0 }, 32, Pitch::flat },
-            { { 92, -16, 0 }, 32, Pitch::flat },
-            { { 93, -16, 0 }, 32, Pitch::flat },
-            { { 94, -16, 0 }, 32, Pitch::flat },
-            { { 95, -16, 0 }, 32, Pitch::flat },
-        });
-
-    // 0x4e3824
-    // Track 9. Reversed 1. Direction 1
-    static constexpr auto moveInfoT9R1D1 = std::to_array<MoveInfo>(
-        {
-            { { 15, 15, 0 }, 56, Pitch::flat },
-            { { 14, 14, 0 }, 56, Pitch::flat },
-            { { 13, 13, 0 }, 56, Pitch::flat },
-            { { 12, 12, 0 }, 56, Pitch::flat },
-            { { 12, 11, 0 }, 56, Pitch::flat },
-            { { 11, 10, 0 }, 56, Pitch::flat },
-            { { 10, 9, 0 }, 56, Pitch::flat },
-            { { 9, 8, 0 }, 54, Pitch::flat },
-            { { 8, 7, 0 }, 54, Pitch::flat },
-            { { 7, 6, 0 }, 54, Pitch::flat },
-            { { 7, 5, 0 }, 54, Pitch::flat },
-            { { 6, 4, 0 }, 54, Pitch::flat },
-            { { 5, 3, 0 }, 54, Pitch::flat },
-            { { 4, 2, 0 }, 54, Pitch::flat },
-            { { 4, 1, 0 }, 54, Pitch::flat },
-            { { 3, 0, 0 }, 54, Pitch::flat },
-            { { 2, -1, 0 }, 54, Pitch::flat },
-            { { 2, -2, 0 }, 54, Pitch::flat },
-            { { 1, -3, 0 }, 54, Pitch::flat },
-            { { 0, -4, 0 }, 54, Pitch::flat },
-            { { 0, -5, 0 }, 54, Pitch::flat },
-            { { -1, -6, 0 }, 54, Pitch::flat },
-            { { -2, -7, 0 }, 54, Pitch::flat },
-            { { -2, -8, 0 }, 54, Pitch::flat },
-            { { -3, -9, 0 }, 54, Pitch::flat },
-            { { -3, -10, 0 }, 54, Pitch::flat },
-            { { -4, -11, 0 }, 52, Pitch::flat },
-            { { -4, -12, 0 }, 52, Pitch::flat },
-            { { -5, -13, 0 }, 52, Pitch::flat },
-            { { -5, -14, 0 }, 52, Pitch::flat },
-            { { -6, -15, 0 }, 52, Pitch::flat },
-            { { -6, -16, 0 }, 52, Pitch::flat },
-            { { -7, -17, 0 }, 52, Pitch::flat },
-            { { -7, -18, 0 }, 52, Pitch::flat },
-            { { -8, -19, 0 }, 52, Pitch::flat },
-            { { -8, -20, 0 }, 52, Pitch::flat },
-            { { -8, -21, 0 }, 52, Pitch::flat },
-            { { -9, -22, 0 }, 52, Pitch::flat },
-            { { -9, -23, 0 }, 52, Pitch::flat },
-            { { -9, -24, 0 }, 52, Pitch::flat },
-            { { -10, -25, 0 }, 52, Pitch::flat },
-            { { -10, -26, 0 }, 52, Pitch::flat },
-            { { -10, -27, 0 }, 52, Pitch::flat },
-            { { -11, -28, 0 }, 52, Pitch::flat },
-            { { -11, -29, 0 }, 52, Pitch::flat },
-            { { -11, -30, 0 }, 52, Pitch::flat },
-            { { -11, -31, 0 }, 50, Pitch::flat },
-            { { -12, -32, 0 }, 50, Pitch::flat },
-            { { -12, -33, 0 }, 50, Pitch::flat },
-            { { -12, -34, 0 }, 50, Pitch::flat },
-            { { -12, -35, 0 }, 50, Pitch::flat },
-            { { -13, -36, 0 }, 50, Pitch::flat },
-            { { -13, -37, 0 }, 50, Pitch::flat },
-            { { -13, -38, 0 }, 50, Pitch::flat },
-            { { -13, -39, 0 }, 50, Pitch::flat },
-            { { -13, -40, 0 }, 50, Pitch::flat },
-            { { -14, -41, 0 }, 50, Pitch::flat },
-            { { -14, -42, 0 }, 50, Pitch::flat },
-            { { -14, -43, 0 }, 50, Pitch::flat },
-            { { -14, -44, 0 }, 50, Pitch::flat },
-            { { -14, -45, 0 }, 50, Pitch::flat },
-            { { -15, -46, 0 }, 50, Pitch::flat },
-            { { -15, -47, 0 }, 50, Pitch::flat },
-            { { -15, -48, 0 }, 50, Pitch::flat },
-            { { -15, -49, 0 }, 50, Pitch::flat },
-            { { -15, -50, 0 }, 50, Pitch::flat },
-            { { -16, -51, 0 }, 48, Pitch::flat },
-            { { -16, -52, 0 }, 48, Pitch::flat },
-            { { -16, -53, 0 }, 48, Pitch::flat },
-            { { -16, -54, 0 }, 48, Pitch::flat },
-            { { -16, -55, 0 }, 48, Pitch::flat },
-            { { -16, -56, 0 }, 48, Pitch::flat },
-            { { -16, -57, 0 }, 48, Pitch::flat },
-            { { -16, -58, 0 }, 48, Pitch::flat },
-            { { -16, -59, 0 }, 48, Pitch::flat },
-            { { -16, -60, 0 }, 48, Pitch::flat },
-            { { -16, -61, 0 }, 48, Pitch::flat },
-            { { -16, -62, 0 }, 48, Pitch::flat },
-            { { -16, -63, 0 }, 48, Pitch::flat },
-            { { -16, -64, 0 }, 48, Pitch::flat },
-        });
-
-    // 0x4e30a6
-    // Track 9. Reversed 1. Direction 2
-    static constexpr auto moveInfoT9R1D2 = std::to_array<MoveInfo>(
-        {
-            { { 15, 17, 0 }, 8, Pitch::flat },
-            { { 14, 18, 0 }, 8, Pitch::flat },
-            { { 13, 19, 0 }, 8, Pitch::flat },
-            { { 12, 20, 0 }, 8, Pitch::flat },
-            { { 11, 20, 0 }, 8, Pitch::flat },
-            { { 10, 21, 0 }, 8, Pitch::flat },
-            { { 9, 22, 0 }, 8, Pitch::flat },
-            { { 8, 23, 0 }, 6, Pitch::flat },
-            { { 7, 24, 0 }, 6, Pitch::flat },
-            { { 6, 25, 0 }, 6, Pitch::flat },
-            { { 5, 25, 0 }, 6, Pitch::flat },
-            { { 4, 26, 0 }, 6, Pitch::flat },
-            { { 3, 27, 0 }, 6, Pitch::flat },
-            { { 2, 28, 0 }, 6, Pitch::flat },
-            { { 1, 28, 0 }, 6, Pitch::flat },
-            { { 0, 29, 0 }, 6, Pitch::flat },
-            { { -1, 30, 0 }, 6, Pitch::flat },
-            { { -2, 30, 0 }, 6, Pitch::flat },
-            { { -3, 31, 0 }, 6, Pitch::flat },
-            { { -4, 32, 0 }, 6, Pitch::flat },
-            { { -5, 32, 0 }, 6, Pitch::flat },
-            { { -6, 33, 0 }, 6, Pitch::flat },
-            { { -7, 34, 0 }, 6, Pitch::flat },
-            { { -8, 34, 0 }, 6, Pitch::flat },
-            { { -9, 35, 0 }, 6, Pitch::flat },
-            { { -10, 35, 0 }, 6, Pitch::flat },
-            { { -11, 36, 0 }, 4, Pitch::flat },
-            { { -12, 36, 0 }, 4, Pitch::flat },
-            { { -13, 37, 0 }, 4, Pitch::flat },
-            { { -14, 37, 0 }, 4, Pitch::flat },
-            { { -15, 38, 0 }, 4, Pitch::flat },
-            { { -16, 38, 0 }, 4, Pitch::flat },
-            { { -17, 39, 0 }, 4, Pitch::flat },
-            { { -18, 39, 0 }, 4, Pitch::flat },
-            { { -19, 40, 0 }, 4, Pitch::flat },
-            { { -20, 40, 0 }, 4, Pitch::flat },
-            { { -21, 40, 0 }, 4, Pitch::flat },
-            { { -22, 41, 0 }, 4, Pitch::flat },
-            { { -23, 41, 0 }, 4, Pitch::flat },
-            { { -24, 41, 0 }, 4, Pitch::flat },
-            { { -25, 42, 0 }, 4, Pitch::flat },
-            { { -26, 42, 0 }, 4, Pitch::flat },
-            { { -27, 42, 0 }, 4, Pitch::flat },
-            { { -28, 43, 0 }, 4, Pitch::flat },
-            { { -29, 43, 0 }, 4, Pitch::flat },
-            { { -30, 43, 0 }, 4, Pitch::flat },
-            { { -31, 43, 0 }, 2, Pitch::flat },
-            { { -32, 44, 0 }, 2, Pitch::flat },
-            { { -33, 44, 0 }, 2, Pitch::flat },
-            { { -34, 44, 0 }, 2, Pitch::flat },
-            { { -35, 44, 0 }, 2, Pitch::flat },
-            { { -36, 45, 0 }, 2, Pitch::flat },
-            { { -37, 45, 0 }, 2, Pitch::flat },
-            { { -38, 45, 0 }, 2, Pitch::flat },
-            { { -39, 45, 0 }, 2, Pitch::flat },
-            { { -40, 45, 0 }, 2, Pitch::flat },
-            { { -41, 46, 0 }, 2, Pitch::flat },
-            { { -42, 46, 0 }, 2, Pitch::flat },
-            { { -43, 46, 0 }, 2, Pitch::flat },
-            { { -44, 46, 0 }, 2, Pitch::flat },
-            { { -45, 46, 0 }, 2, Pitch::flat },
-            { { -46, 47, 0 }, 2, Pitch::flat },
-            { { -47, 47, 0 }, 2, Pitch::flat },
-            { { -48, 47, 0 }, 2, Pitch::flat },
-            { { -49, 47, 0 }, 2, Pitch::flat },
-            { { -50, 47, 0 }, 2, Pitch::flat },
-            { { -51, 48, 0 }, 0, Pitch::flat },
-            { { -52, 48, 0 }, 0, Pitch::flat },
-            { { -53, 48, 0 }, 0, Pitch::flat },
-            { { -54, 48, 0 }, 0, Pitch::flat },
-            { { -55, 48, 0 }, 0, Pitch::flat },
-            { { -56, 48, 0 }, 0, Pitch::flat },
-            { { -57, 48, 0 }, 0, Pitch::flat },
-            { { -58, 48, 0 }, 0, Pitch::flat },
-            { { -59, 48, 0 }, 0, Pitch::flat },
-            { { -60, 48, 0 }, 0, Pitch::flat },
-            { { -61, 48, 0 }, 0, Pitch::flat },
-            { { -62, 48, 0 }, 0, Pitch::flat },
-            { { -63, 48, 0 }, 0, Pitch::flat },
-        });
-
-    // 0x4e3320
-    // Track 9. Reversed 1. Direction 3
-    static constexpr auto moveInfoT9R1D3 = std::to_array<MoveInfo>(
-        {
-            { { 16, 16, 0 }, 24, Pitch::flat },
-            { { 17, 17, 0 }, 24, Pitch::flat },
-            { { 18, 18, 0 }, 24, Pitch::flat },
-            { { 19, 19, 0 }, 24, Pitch::flat },
-            { { 20, 20, 0 }, 24, Pitch::flat },
-            { { 20, 21, 0 }, 24, Pitch::flat },
-            { { 21, 22, 0 }, 24, Pitch::flat },
-            { { 22, 23, 0 }, 24, Pitch::flat },
-            { { 23, 24, 0 }, 22, Pitch::flat },
-            { { 24, 25, 0 }, 22, Pitch::flat },
-            { { 25, 26, 0 }, 22, Pitch::flat },
-            { { 25, 27, 0 }, 22, Pitch::flat },
-            { { 26, 28, 0 }, 22, Pitch::flat },
-            { { 27, 29, 0 }, 22, Pitch::flat },
-            { { 28, 30, 0 }, 22, Pitch::flat },
-            { { 28, 31, 0 }, 22, Pitch::flat },
-            { { 29, 32, 0 }, 22, Pitch::flat },
-            { { 30, 33, 0 }, 22, Pitch::flat },
-            { { 30, 34, 0 }, 22, Pitch::flat },
-            { { 31, 35, 0 }, 22, Pitch::flat },
-            { { 32, 36, 0 }, 22, Pitch::flat },
-            { { 32, 37, 0 }, 22, Pitch::flat },
-            { { 33, 38, 0 }, 22, Pitch::flat },
-            { { 34, 39, 0 }, 22, Pitch::flat },
-            { { 34, 40, 0 }, 22, Pitch::flat },
-            { { 35, 41, 0 }, 22, Pitch::flat },
-            { { 35, 42, 0 }, 22, Pitch::flat },
-            { { 36, 43, 0 }, 20, Pitch::flat },
-            { { 36, 44, 0 }, 20, Pitch::flat },
-            { { 37, 45, 0 }, 20, Pitch::flat },
-            { { 37, 46, 0 }, 20, Pitch::flat },
-            { { 38, 47, 0 }, 20, Pitch::flat },
-            { { 38, 48, 0 }, 20, Pitch::flat },
-            { { 39, 49, 0 }, 20, Pitch::flat },
-            { { 39, 50, 0 }, 20, Pitch::flat },
-            { { 40, 51, 0 }, 20, Pitch::flat },
-            { { 40, 52, 0 }, 20, Pitch::flat },
-            { { 40, 53, 0 }, 20, Pitch::flat },
-            { { 41, 54, 0 }, 20, Pitch::flat },
-            { { 41, 55, 0 }, 20, Pitch::flat },
-            { { 41, 56, 0 }, 20, Pitch::flat },
-            { { 42, 57, 0 }, 20, Pitch::flat },
-            { { 42, 58, 0 }, 20, Pitch::flat },
-            { { 42, 59, 0 }, 20, Pitch::flat },
-            { { 43, 60, 0 }, 20, Pitch::flat },
-            { { 43, 61, 0 }, 20, Pitch::flat },
-            { { 43, 62, 0 }, 20, Pitch::flat },
-            { { 43, 63, 0 }, 18, Pitch::flat },
-            { { 44, 64, 0 }, 18, Pitch::flat },
-            { { 44, 65, 0 }, 18, Pitch::flat },
-            { { 44, 66, 0 }, 18, Pitch::flat },
-            { { 44, 67, 0 }, 18, Pitch::flat },
-            { { 45, 68, 0 }, 18, Pitch::flat },
-            { { 45, 69, 0 }, 18, Pitch::flat },
-            { { 45, 70, 0 }, 18, Pitch::flat },
-            { { 45, 71, 0 }, 18, Pitch::flat },
-            { { 45, 72, 0 }, 18, Pitch::flat },
-            { { 46, 73, 0 }, 18, Pitch::flat },
-            { { 46, 74, 0 }, 18, Pitch::flat },
-            { { 46, 75, 0 }, 18, Pitch::flat },
-            { { 46, 76, 0 }, 18, Pitch::flat },
-            { { 46, 77, 0 }, 18, Pitch::flat },
-            { { 47, 78, 0 }, 18, Pitch::flat },
-            { { 47, 79, 0 }, 18, Pitch::flat },
-            { { 47, 80, 0 }, 18, Pitch::flat },
-            { { 47, 81, 0 }, 18, Pitch::flat },
-            { { 47, 82, 0 }, 18, Pitch::flat },
-            { { 48, 83, 0 }, 16, Pitch::flat },
-            { { 48, 84, 0 }, 16, Pitch::flat },
-            { { 48, 85, 0 }, 16, Pitch::flat },
-            { { 48, 86, 0 }, 16, Pitch::flat },
-            { { 48, 87, 0 }, 16, Pitch::flat },
-            { { 48, 88, 0 }, 16, Pitch::flat },
-            { { 48, 89, 0 }, 16, Pitch::flat },
-            { { 48, 90, 0 }, 16, Pitch::flat },
-            { { 48, 91, 0 }, 16, Pitch::flat },
-            { { 48, 92, 0 }, 16, Pitch::flat },
-            { { 48, 93, 0 }, 16, Pitch::flat },
-            { { 48, 94, 0 }, 16, Pitch::flat },
-            { { 48, 95, 0 }, 16, Pitch::flat },
-        });
-
-    // 0x4e4eae
-    // Track 12. Reversed 0. Direction 0
-    static constexpr auto moveInfoT12R0D0 = std::to_array<MoveInfo>(
-        {
-            { { 32, 16, 0 }, 0, Pitch::flat },
-            { { 31, 16, 0 }, 0, Pitch::flat },
-            { { 30, 16, 0 }, 0, Pitch::flat },
-            { { 29, 16, 0 }, 0, Pitch::flat },
-            { { 28, 16, 0 }, 0, Pitch::flat },
-            { { 27, 16, 0 }, 0, Pitch::flat },
-            { { 26, 16, 0 }, 0, Pitch::flat },
-            { { 25, 16, 0 }, 0, Pitch::flat },
-            { { 24, 16, 0 }, 62, Pitch::flat },
-            { { 23, 15, 0 }, 62, Pitch::flat },
-            { { 22, 15, 0 }, 62, Pitch::flat },
-            { { 21, 15, 0 }, 62, Pitch::flat },
-            { { 20, 15, 0 }, 62, Pitch::flat },
-            { { 19, 15, 0 }, 62, Pitch::flat },
-            { { 18, 15, 0 }, 62, Pitch::flat },
-            { { 17, 14, 0 }, 62, Pitch::flat },
-            { { 16, 14, 0 }, 62, Pitch::flat },
-            { { 15, 14, 0 }, 62, Pitch::flat },
-            { { 14, 14, 0 }, 62, Pitch::flat },
-            { { 13, 14, 0 }, 62, Pitch::flat },
-            { { 12, 13, 0 }, 62, Pitch::flat },
-            { { 11, 13, 0 }, 62, Pitch::flat },
-            { { 10, 13, 0 }, 62, Pitch::flat },
-            { { 9, 13, 0 }, 62, Pitch::flat },
-            { { 8, 12, 0 }, 60, Pitch::flat },
-            { { 7, 12, 0 }, 60, Pitch::flat },
-            { { 6, 12, 0 }, 60, Pitch::flat },
-            { { 5, 11, 0 }, 60, Pitch::flat },
-            { { 4, 11, 0 }, 60, Pitch::flat },
-            { { 3, 11, 0 }, 60, Pitch::flat },
-            { { 2, 10, 0 }, 60, Pitch::flat },
-            { { 1, 10, 0 }, 60, Pitch::flat },
-            { { 0, 9, 0 }, 60, Pitch::flat },
-            { { -1, 9, 0 }, 60, Pitch::flat },
-            { { -2, 8, 0 }, 60, Pitch::flat },
-            { { -3, 8, 0 }, 60, Pitch::flat },
-            { { -4, 7, 0 }, 60, Pitch::flat },
-            { { -5, 7, 0 }, 58, Pitch::flat },
-            { { -6, 6, 0 }, 58, Pitch::flat },
-            { { -7, 6, 0 }, 58, Pitch::flat },
-            { { -8, 5, 0 }, 58, Pitch::flat },
-            { { -9, 4, 0 }, 58, Pitch::flat },
-            { { -10, 4, 0 }, 58, Pitch::flat },
-            { { -11, 3, 0 }, 58, Pitch::flat },
-            { { -12, 2, 0 }, 58, Pitch::flat },
-            { { -13, 2, 0 }, 56, Pitch::flat },
-            { { -14, 1, 0 }, 56, Pitch::flat },
-            { { -15, 0, 0 }, 56, Pitch::flat },
-            { { -16, 0, 0 }, 56, Pitch::flat },
-            { { -17, -1, 0 }, 56, Pitch::flat },
-            { { -18, -2, 0 }, 56, Pitch::flat },
-            { { -19, -2, 0 }, 58, Pitch::flat },
-            { { -20, -3, 0 }, 58, Pitch::flat },
-            { { -21, -4, 0 }, 58, Pitch::flat },
-            { { -22, -4, 0 }, 58, Pitch::flat },
-            { { -23, -5, 0 }, 58, Pitch::flat },
-            { { -24, -6, 0 }, 58, Pitch::flat },
-            { { -25, -6, 0 }, 58, Pitch::flat },
-            { { -26, -7, 0 }, 58, Pitch::flat },
-            { { -27, -7, 0 }, 58, Pitch::flat },
-            { { -28, -8, 0 }, 60, Pitch::flat },
-            { { -29, -8, 0 }, 60, Pitch::flat },
-            { { -30, -9, 0 }, 60, Pitch::flat },
-            { { -31, -9, 0 }, 60, Pitch::flat },
-            { { -32, -10, 0 }, 60, Pitch::flat },
-            { { -33, -10, 0 }, 60, Pitch::flat },
-            { { -34, -11, 0 }, 60, Pitch::flat },
-            { { -35, -11, 0 }, 60, Pitch::flat },
-            { { -36, -11, 0 }, 60, Pitch::flat },
-            { { -37, -12, 0 }, 60, Pitch::flat },
-            { { -38, -12, 0 }, 60, Pitch::flat },
-            { { -39, -12, 0 }, 60, Pitch::flat },
-            { { -40, -13, 0 }, 62, Pitch::flat },
-            { { -41, -13, 0 }, 62, Pitch::flat },
-            { { -42, -13, 0 }, 62, Pitch::flat },
-            { { -43, -13, 0 }, 62, Pitch::flat },
-            { { -44, -14, 0 }, 62, Pitch::flat },
-            { { -45, -14, 0 }, 62, Pitch::flat },
-            { { -46, -14, 0 }, 62, Pitch::flat },
-            { { -47, -14, 0 }, 62, Pitch::flat },
-            { { -48, -14, 0 }, 62, Pitch::flat },
-            { { -49, -15, 0 }, 62, Pitch::flat },
-            { { -50, -15, 0 }, 62, Pitch::flat },
-            { { -51, -15, 0 }, 62, Pitch::flat },
-            { { -52, -15, 0 }, 62, Pitch::flat },
-            { { -53, -15, 0 }, 62, Pitch::flat },
-            { { -54, -15, 0 }, 62, Pitch::flat },
-            { { -55, -16, 0 }, 62, Pitch::flat },
-            { { -56, -16, 0 }, 0, Pitch::flat },
-            { { -57, -16, 0 }, 0, Pitch::flat },
-            { { -58, -16, 0 }, 0, Pitch::flat },
-            { { -59, -16, 0 }, 0, Pitch::flat },
-            { { -60, -16, 0 }, 0, Pitch::flat },
-            { { -61, -16, 0 }, 0, Pitch::flat },
-            { { -62, -16, 0 }, 0, Pitch::flat },
-            { { -63, -16, 0 }, 0, Pitch::flat },
-        });
-
-    // 0x4e51b0
-    // Track 12. Reversed 0. Direction 1
-    static constexpr auto moveInfoT12R0D1 = std::to_array<MoveInfo>(
-        {
-            { { 16, 0, 0 }, 16, Pitch::flat },
-            { { 16, 1, 0 }, 16, Pitch::flat },
-            { { 16, 2, 0 }, 16, Pitch::flat },
-            { { 16, 3, 0 }, 16, Pitch::flat },
-            { { 16, 4, 0 }, 16, Pitch::flat },
-            { { 16, 5, 0 }, 16, Pitch::flat },
-            { { 16, 6, 0 }, 16, Pitch::flat },
-            { { 16, 7, 0 }, 16, Pitch::flat },
-            { { 16, 8, 0 }, 14, Pitch::flat },
-            { { 15, 9, 0 }, 14, Pitch::flat },
-            { { 15, 10, 0 }, 14, Pitch::flat },
-            { { 15, 11, 0 }, 14, Pitch::flat },
-            { { 15, 12, 0 }, 14, Pitch::flat },
-            { { 15, 13, 0 }, 14, Pitch::flat },
-            { { 15, 14, 0 }, 14, Pitch::flat },
-            { { 14, 15, 0 }, 14, Pitch::flat },
-            { { 14, 16, 0 }, 14, Pitch::flat },
-            { { 14, 17, 0 }, 14, Pitch::flat },
-            { { 14, 18, 0 }, 14, Pitch::flat },
-            { { 14, 19, 0 }, 14, Pitch::flat },
-            { { 13, 20, 0 }, 14, Pitch::flat },
-            { { 13, 21, 0 }, 14, Pitch::flat },
-            { { 13, 22, 0 }, 14, Pitch::flat },
-            { { 13, 23, 0 }, 14, Pitch::flat },
-            { { 12, 24, 0 }, 12, Pitch::flat },
-            { { 12, 25, 0 }, 12, Pitch::flat },
-            { { 12, 26, 0 }, 12, Pitch::flat },
-            { { 11, 27, 0 }, 12, Pitch::flat },
-            { { 11, 28, 0 }, 12, Pitch::flat },
-            { { 11, 29, 0 }, 12, Pitch::flat },
-            { { 10, 30, 0 }, 12, Pitch::flat },
-            { { 10, 31, 0 }, 12, Pitch::flat },
-            { { 9, 32, 0 }, 12, Pitch::flat },
-            { { 9, 33, 0 }, 12, Pitch::flat },
-            { { 8, 34, 0 }, 12, Pitch::flat },
-            { { 8, 35, 0 }, 12, Pitch::flat },
-            { { 7, 36, 0 }, 12, Pitch::flat },
-            { { 7, 37, 0 }, 10, Pitch::flat },
-            { { 6, 38, 0 }, 10, Pitch::flat },
-            { { 6, 39, 0 }, 10, Pitch::flat },
-            { { 5, 40, 0 }, 10, Pitch::flat },
-            { { 4, 41, 0 }, 10, Pitch::flat },
-            { { 4, 42, 0 }, 10, Pitch::flat },
-            { { 3, 43, 0 }, 10, Pitch::flat },
-            { { 2, 44, 0 }, 10, Pitch::flat },
-            { { 2, 45, 0 }, 8, Pitch::flat },
-            { { 1, 46, 0 }, 8, Pitch::flat },
-            { { 0, 47, 0 }, 8, Pitch::flat },
-            { { 0, 48, 0 }, 8, Pitch::flat },
-            { { -1, 49, 0 }, 8, Pitch::flat },
-            { { -2, 50, 0 }, 8, Pitch::flat },
-            { { -2, 51, 0 }, 10, Pitch::flat },
-            { { -3, 52, 0 }, 10, Pitch::flat },
-            { { -4, 53, 0 }, 10, Pitch::flat },
-            { { -4, 54, 0 }, 10, Pitch::flat },
-            { { -5, 55, 0 }, 10, Pitch::flat },
-            { { -6, 56, 0 }, 10, Pitch::flat },
-            { { -6, 57, 0 }, 10, Pitch::flat },
-            { { -7, 58, 0 }, 10, Pitch::flat },
-            { { -7, 59, 0 }, 10, Pitch::flat },
-            { { -8, 60, 0 }, 12, Pitch::flat },
-            { { -8, 61, 0 }, 12, Pitch::flat },
-            { { -9, 62, 0 }, 12, Pitch::flat },
-            { { -9, 63, 0 }, 12, Pitch::flat },
-            { { -10, 64, 0 }, 12, Pitch::flat },
-            { { -10, 65, 0 }, 12, Pitch::flat },
-            { { -11, 66, 0 }, 12, Pitch::flat },
-            { { -11, 67, 0 }, 12, Pitch::flat },
-            { { -11, 68, 0 }, 12, Pitch::flat },
-            { { -12, 69, 0 }, 12, Pitch::flat },
-            { { -12, 70, 0 }, 12, Pitch::flat },
-            { { -12, 71, 0 }, 12, Pitch::flat },
-            { { -13, 72, 0 }, 14, Pitch::flat },
-            { { -13, 73, 0 }, 14, Pitch::flat },
-            { { -13, 74, 0 }, 14, Pitch::flat },
-            { { -13, 75, 0 }, 14, Pitch::flat },
-            { { -14, 76, 0 }, 14, Pitch::flat },
-            { { -14, 77, 0 }, 14, Pitch::flat },
-            { { -14, 78, 0 }, 14, Pitch::flat },
-            { { -14, 79, 0 }, 14, Pitch::flat },
-            { { -14, 80, 0 }, 14, Pitch::flat },
-            { { -15, 81, 0 }, 14, Pitch::flat },
-            { { -15, 82, 0 }, 14, Pitch::flat },
-            { { -15, 83, 0 }, 14, Pitch::flat },
-            { { -15, 84, 0 }, 14, Pitch::flat },
-            { { -15, 85, 0 }, 14, Pitch::flat },
-            { { -15, 86, 0 }, 14, Pitch::flat },
-            { { -16, 87, 0 }, 14, Pitch::flat },
-            { { -16, 88, 0 }, 16, Pitch::flat },
-            { { -16, 89, 0 }, 16, Pitch::flat },
-            { { -16, 90, 0 }, 16, Pitch::flat },
-            { { -16, 91, 0 }, 16, Pitch::flat },
-            { { -16, 92, 0 }, 16, Pitch::flat },
-            { { -16, 93, 0 }, 16, Pitch::flat },
-            { { -16, 94, 0 }, 16, Pitch::flat },
-            { { -16, 95, 0 }, 16, Pitch::flat },
-        });
-
-    // 0x4e54b2
-    // Track 12. Reversed 0. Direction 2
-    static constexpr auto moveInfoT12R0D2 = std::to_array<MoveInfo>(
-        {
-            { { 0, 16, 0 }, 32, Pitch::flat },
-            { { 1, 16, 0 }, 32, Pitch::flat },
-            { { 2, 16, 0 }, 32, Pitch::flat },
-            { { 3, 16, 0 }, 32, Pitch::flat },
-            { { 4, 16, 0 }, 32, Pitch::flat },
-            { { 5, 16, 0 }, 32, Pitch::flat },
-            { { 6, 16, 0 }, 32, Pitch::flat },
-            { { 7, 16, 0 }, 32, Pitch::flat },
-            { { 8, 16, 0 }, 30, Pitch::flat },
-            { { 9, 17, 0 }, 30, Pitch::flat },
-            { { 10, 17, 0 }, 30, Pitch::flat },
-            { { 11, 17, 0 }, 30, Pitch::flat },
-            { { 12, 17, 0 }, 30, Pitch::flat },
-            { { 13, 17, 0 }, 30, Pitch::flat },
-            { { 14, 17, 0 }, 30, Pitch::flat },
-            { { 15, 18, 0 }, 30, Pitch::flat },
-            { { 16, 18, 0 }, 30, Pitch::flat },
-            { { 17, 18, 0 }, 30, Pitch::flat },
-            { { 18, 18, 0 }, 30, Pitch::flat },
-            { { 19, 18, 0 }, 30, Pitch::flat },
-            { { 20, 19, 0 }, 30, Pitch::flat },
-            { { 21, 19, 0 }, 30, Pitch::flat },
-            { { 22, 19, 0 }, 30, Pitch::flat },
-            { { 23, 19, 0 }, 30, Pitch::flat },
-            { { 24, 20, 0 }, 28, Pitch::flat },
-            { { 25, 20, 0 }, 28, Pitch::flat },
-            { { 26, 20, 0 }, 28, Pitch::flat },
-            { { 27, 21, 0 }, 28, Pitch::flat },
-            { { 28, 21, 0 }, 28, Pitch::flat },
-            { { 29, 21, 0 }, 28, Pitch::flat },
-            { { 30, 22, 0 }, 28, Pitch::flat },
-            { { 31, 22, 0 }, 28, Pitch::flat },
-            { { 32, 23, 0 }, 28, Pitch::flat },
-            { { 33, 23, 0 }, 28, Pitch::flat },
-            { { 34, 24, 0 }, 28, Pitch::flat },
-            { { 35, 24, 0 }, 28, Pitch::flat },
-            { { 36, 25, 0 }, 28, Pitch::flat },
-            { { 37, 25, 0 }, 26, Pitch::flat },
-            { { 38, 26, 0 }, 26, Pitch::flat },
-            { { 39, 26, 0 }, 26, Pitch::flat },
-            { { 40, 27, 0 }, 26, Pitch::flat },
-            { { 41, 28, 0 }, 26, Pitch::flat },
-            { { 42, 28, 0 }, 26, Pitch::flat },
-            { { 43, 29, 0 }, 26, Pitch::flat },
-            { { 44, 30, 0 }, 26, Pitch::flat },
-            { { 45, 30, 0 }, 24, Pitch::flat },
-            { { 46, 31, 0 }, 24, Pitch::flat },
-            { { 47, 32, 0 }, 24, Pitch::flat },
-            { { 48, 32, 0 }, 24, Pitch::flat },
-            { { 49, 33, 0 }, 24, Pitch::flat },
-            { { 50, 34, 0 }, 24, Pitch::flat },
-            { { 51, 34, 0 }, 26, Pitch::flat },
-            { { 52, 35, 0 }, 26, Pitch::flat },
-            { { 53, 36, 0 }, 26, Pitch::flat },
-            { { 54, 36, 0 }, 26, Pitch::flat },
-            { { 55, 37, 0 }, 26, Pitch::flat },
-            { { 56, 38, 0 }, 26, Pitch::flat },
-            { { 57, 38, 0 }, 26, Pitch::flat },
-            { { 58, 39, 0 }, 26, Pitch::flat },
-            { { 59, 39, 0 }, 26, Pitch::flat },
-            { { 60, 40, 0 }, 28, Pitch::flat },
-            { { 61, 40, 0 }, 28, Pitch::flat },
-            { { 62, 41, 0 }, 28, Pitch::flat },
-            { { 63, 41, 0 }, 28, Pitch::flat },
-            { { 64, 42, 0 }, 28, Pitch::flat },
-            { { 65, 42, 0 }, 28, Pitch::flat },
-            { { 66, 43, 0 }, 28, Pitch::flat },
-            { { 67, 43, 0 }, 28, Pitch::flat },
-            { { 68, 43, 0 }, 28, Pitch::flat },
-            { { 69, 44, 0 }, 28, Pitch::flat },
-            { { 70, 44, 0 }, 28, Pitch::flat },
-            { { 71, 44, 0 }, 28, Pitch::flat },
-            { { 72, 45, 0 }, 30, Pitch::flat },
-            { { 73, 45, 0 }, 30, Pitch::flat },
-            { { 74, 45, 0 }, 30, Pitch::flat },
-            { { 75, 45, 0 }, 30, Pitch::flat },
-            { { 76, 46, 0 }, 30, Pitch::flat },
-            { { 77, 46, 0 }, 30, Pitch::flat },
-            { { 78, 46, 0 }, 30, Pitch::flat },
-            { { 79, 46, 0 }, 30, Pitch::flat },
-            { { 80, 46, 0 }, 30, Pitch::flat },
-            { { 81, 47, 0 }, 30, Pitch::flat },
-            { { 82, 47, 0 }, 30, Pitch::flat },
-            { { 83, 47, 0 }, 30, Pitch::flat },
-            { { 84, 47, 0 }, 30, Pitch::flat },
-            { { 85, 47, 0 }, 30, Pitch::flat },
-            { { 86, 47, 0 }, 30, Pitch::flat },
-            { { 87, 48, 0 }, 30, Pitch::flat },
-            { { 88, 48, 0 }, 32, Pitch::flat },
-            { { 89, 48, 0 }, 32, Pitch::flat },
-            { { 90, 48, 0 }, 32, Pitch::flat },
-            { { 91, 48, 0 }, 32, Pitch::flat },
-            { { 92, 48, 0 }, 32, Pitch::flat },
-            { { 93, 48, 0 }, 32, Pitch::flat },
-            { { 94, 48, 0 }, 32, Pitch::flat },
-            { { 95, 48, 0 }, 32, Pitch::flat },
-        });
-
-    // 0x4e57b4
-    // Track 12. Reversed 0. Direction 3
-    static constexpr auto moveInfoT12R0D3 = std::to_array<MoveInfo>(
-        {
-            { { 16, 32, 0 }, 48, Pitch::flat },
-            { { 16, 31, 0 }, 48, Pitch::flat },
-            { { 16, 30, 0 }, 48, Pitch::flat },
-            { { 16, 29, 0 }, 48, Pitch::flat },
-            { { 16, 28, 0 }, 48, Pitch::flat },
-            { { 16, 27, 0 }, 48, Pitch::flat },
-            { { 16, 26, 0 }, 48, Pitch::flat },
-            { { 16, 25, 0 }, 48, Pitch::flat },
-            { { 16, 24, 0 }, 46, Pitch::flat },
-            { { 17, 23, 0 }, 46, Pitch::flat },
-            { { 17, 22, 0 }, 46, Pitch::flat },
-            { { 17, 21, 0 }, 46, Pitch::flat },
-            { { 17, 20, 0 }, 46, Pitch::flat },
-            { { 17, 19, 0 }, 46, Pitch::flat },
-            { { 17, 18, 0 }, 46, Pitch::flat },
-            { { 18, 17, 0 }, 46, Pitch::flat },
-            { { 18, 16, 0 }, 46, Pitch::flat },
-            { { 18, 15, 0 }, 46, Pitch::flat },
-            { { 18, 14, 0 }, 46, Pitch::flat },
-            { { 18, 13, 0 }, 46, Pitch::flat },
-            { { 19, 12, 0 }, 46, Pitch::flat },
-            { { 19, 11, 0 }, 46, Pitch::flat },
-            { { 19, 10, 0 }, 46, Pitch::flat },
-            { { 19, 9, 0 }, 46, Pitch::flat },
-            { { 20, 8, 0 }, 44, Pitch::flat },
-            { { 20, 7, 0 }, 44, Pitch::flat },
-            { { 20, 6, 0 }, 44, Pitch::flat },
-            { { 21, 5, 0 }, 44, Pitch::flat },
-            { { 21, 4, 0 }, 44, Pitch::flat },
-            { { 21, 3, 0 }, 44, Pitch::flat },
-            { { 22, 2, 0 }, 44, Pitch::flat },
-            { { 22, 1, 0 }, 44, Pitch::flat },
-            { { 23, 0, 0 }, 44, Pitch::flat },
-            { { 23, -1, 0 }, 44, Pitch::flat },
-            { { 24, -2, 0 }, 44, Pitch::flat },
-            { { 24, -3, 0 }, 44, Pitch::flat },
-            { { 25, -4, 0 }, 44, Pitch::flat },
-            { { 25, -5, 0 }, 42, Pitch::flat },
-            { { 26, -6, 0 }, 42, Pitch::flat },
-            { { 26, -7, 0 }, 42, Pitch::flat },
-            { { 27, -8, 0 }, 42, Pitch::flat },
-            { { 28, -9, 0 }, 42, Pitch::flat },
-            { { 28, -10, 0 }, 42, Pitch::flat },
-            { { 29, -11, 0 }, 42, Pitch::flat },
-            { { 30, -12, 0 }, 42, Pitch::flat },
-            { { 30, -13, 0 }, 40, Pitch::flat },
-            { { 31, -14, 0 }, 40, Pitch::flat },
-            { { 32, -15, 0 }, 40, Pitch::flat },
-            { { 32, -16, 0 }, 40, Pitch::flat },
-            { { 33, -17, 0 }, 40, Pitch::flat },
-            { { 34, -18, 0 }, 40, Pitch::flat },
-            { { 34, -19, 0 }, 42, Pitch::flat },
-            { { 35, -20, 0 }, 42, Pitch::flat },
-            { { 36, -21, 0 }, 42, Pitch::flat },
-            { { 36, -22, 0 }, 42, Pitch::flat },
-            { { 37, -23, 0 }, 42, Pitch::flat },
-            { { 38, -24, 0 }, 42, Pitch::flat },
-            { { 38, -25, 0 }, 42, Pitch::flat },
-            { { 39, -26, 0 }, 42, Pitch::flat },
-            { { 39, -27, 0 }, 42, Pitch::flat },
-            { { 40, -28, 0 }, 44, Pitch::flat },
-            { { 40, -29, 0 }, 44, Pitch::flat },
-            { { 41, -30, 0 }, 44, Pitch::flat },
-            { { 41, -31, 0 }, 44, Pitch::flat },
-            { { 42, -32, 0 }, 44, Pitch::flat },
-            { { 42, -33, 0 }, 44, Pitch::flat },
-            { { 43, -34, 0 }, 44, Pitch::flat },
-            { { 43, -35, 0 }, 44, Pitch::flat },
-            { { 43, -36, 0 }, 44, Pitch::flat },
-            { { 44, -37, 0 }, 44, Pitch::flat },
-            { { 44, -38, 0 }, 44, Pitch::flat },
-            { { 44, -39, 0 }, 44, Pitch::flat },
-            { { 45, -40, 0 }, 46, Pitch::flat },
-            { { 45, -41, 0 }, 46, Pitch::flat },
-            { { 45, -42, 0 }, 46, Pitch::flat },
-            { { 45, -43, 0 }, 46, Pitch::flat },
-            { { 46, -44, 0 }, 46, Pitch::flat },
-            { { 46, -45, 0 }, 46, Pitch::flat },
-            { { 46, -46, 0 }, 46, Pitch::flat },
-            { { 46, -47, 0 }, 46, Pitch::flat },
-            { { 46, -48, 0 }, 46, Pitch::flat },
-            { { 47, -49, 0 }, 46, Pitch::flat },
-            { { 47, -50, 0 }, 46, Pitch::flat },
-            { { 47, -51, 0 }, 46, Pitch::flat },
-            { { 47, -52, 0 }, 46, Pitch::flat },
-            { { 47, -53, 0 }, 46, Pitch::flat },
-            { { 47, -54, 0 }, 46, Pitch::flat },
-            { { 48, -55, 0 }, 46, Pitch::flat },
-            { { 48, -56, 0 }, 48, Pitch::flat },
-            { { 48, -57, 0 }, 48, Pitch::flat },
-            { { 48, -58, 0 }, 48, Pitch::flat },
-            { { 48, -59, 0 }, 48, Pitch::flat },
-            { { 48, -60, 0 }, 48, Pitch::flat },
-            { { 48, -61, 0 }, 48, Pitch::flat },
-            { { 48, -62, 0 }, 48, Pitch::flat },
-            { { 48, -63, 0 }, 48, Pitch::flat },
-        });
-
-    // 0x4e5ab6
-    // Track 13. Reversed 0. Direction 0
-    static constexpr auto moveInfoT13R0D0 = std::to_array<MoveInfo>(
-        {
-            { { 32, 16, 0 }, 0, Pitch::flat },
-            { { 31, 16, 0 }, 0, Pitch::flat },
-            { { 30, 16, 0 }, 0, Pitch::flat },
-            { { 29, 16, 0 }, 0, Pitch::flat },
-            { { 28, 16, 0 }, 0, Pitch::flat },
-            { { 27, 16, 0 }, 0, Pitch::flat },
-            { { 26, 16, 0 }, 0, Pitch::flat },
-            { { 25, 16, 0 }, 0, Pitch::flat },
-            { { 24, 16, 0 }, 2, Pitch::flat },
-            { { 23, 17, 0 }, 2, Pitch::flat },
-            { { 22, 17, 0 }, 2, Pitch::flat },
-            { { 21, 17, 0 }, 2, Pitch::flat },
-            { { 20, 17, 0 }, 2, Pitch::flat },
-            { { 19, 17, 0 }, 2, Pitch::flat },
-            { { 18, 17, 0 }, 2, Pitch::flat },
-            { { 17, 18, 0 }, 2, Pitch::flat },
-            { { 16, 18, 0 }, 2, Pitch::flat },
-            { { 15, 18, 0 }, 2, Pitch::flat },
-            { { 14, 18, 0 }, 2, Pitch::flat },
-            { { 13, 18, 0 }, 2, Pitch::flat },
-            { { 12, 19, 0 }, 2, Pitch::flat },
-            { { 11, 19, 0 }, 2, Pitch::flat },
-            { { 10, 19, 0 }, 2, Pitch::flat },
-            { { 9, 19, 0 }, 2, Pitch::flat },
-            { { 8, 20, 0 }, 4, Pitch::flat },
-            { { 7, 20, 0 }, 4, Pitch::flat },
-            { { 6, 20, 0 }, 4, Pitch::flat },
-            { { 5, 21, 0 }, 4, Pitch::flat },
-            { { 4, 21, 0 }, 4, Pitch::flat },
-            { { 3, 21, 0 }, 4, Pitch::flat },
-            { { 2, 22, 0 }, 4, Pitch::flat },
-            { { 1, 22, 0 }, 4, Pitch::flat },
-            { { 0, 23, 0 }, 4, Pitch::flat },
-            { { -1, 23, 0 }, 4, Pitch::flat },
-            { { -2, 24, 0 }, 4, Pitch::flat },
-            { { -3, 24, 0 }, 4, Pitch::flat },
-            { { -4, 25, 0 }, 4, Pitch::flat },
-            { { -5, 25, 0 }, 10, Pitch::flat },
-            { { -6, 26, 0 }, 10, Pitch::flat },
-            { { -7, 26, 0 }, 10, Pitch::flat },
-            { { -8, 27, 0 }, 10, Pitch::flat },
-            { { -9, 28, 0 }, 10, Pitch::flat },
-            { { -10, 28, 0 }, 10, Pitch::flat },
-            { { -11, 29, 0 }, 10, Pitch::flat },
-            { { -12, 30, 0 }, 10, Pitch::flat },
-            { { -13, 30, 0 }, 8, Pitch::flat },
-            { { -14, 31, 0 }, 8, Pitch::flat },
-            { { -15, 32, 0 }, 8, Pitch::flat },
-            { { -16, 32, 0 }, 8, Pitch::flat },
-            { { -17, 33, 0 }, 8, Pitch::flat },
-            { { -18, 34, 0 }, 8, Pitch::flat },
-            { { -19, 34, 0 }, 6, Pitch::flat },
-            { { -20, 35, 0 }, 6, Pitch::flat },
-            { { -21, 36, 0 }, 6, Pitch::flat },
-            { { -22, 36, 0 }, 6, Pitch::flat },
-            { { -23, 37, 0 }, 6, Pitch::flat },
-            { { -24, 38, 0 }, 6, Pitch::flat },
-            { { -25, 38, 0 }, 6, Pitch::flat },
-            { { -26, 39, 0 }, 6, Pitch::flat },
-            { { -27, 39, 0 }, 6, Pitch::flat },
-            { { -28, 40, 0 }, 4, Pitch::flat },
-            { { -29, 40, 0 }, 4, Pitch::flat },
-            { { -30, 41, 0 }, 4, Pitch::flat },
-            { { -31, 41, 0 }, 4, Pitch::flat },
-            { { -32, 42, 0 }, 4, Pitch::flat },
-            { { -33, 42, 0 }, 4, Pitch::flat },
-            { { -34, 43, 0 }, 4, Pitch::flat },
-            { { -35, 43, 0 }, 4, Pitch::flat },
-            { { -36, 43, 0 }, 4, Pitch::flat },
-            { { -37, 44, 0 }, 4, Pitch::flat },
-            { { -38, 44, 0 }, 4, Pitch::flat },
-            { { -39, 44, 0 }, 4, Pitch::flat },
-            { { -40, 45, 0 }, 2, Pitch::flat },
-            { { -41, 45, 0 }, 2, Pitch::flat },
-            { { -42, 45, 0 }, 2, Pitch::flat },
-            { { -43, 45, 0 }, 2, Pitch::flat },
-            { { -44, 46, 0 }, 2, Pitch::flat },
-            { { -45, 46, 0 }, 2, Pitch::flat },
-            { { -46, 46, 0 }, 2, Pitch::flat },
-            { { -47, 46, 0 }, 2, Pitch::flat },
-            { { -48, 46, 0 }, 2, Pitch::flat },
-            { { -49, 47, 0 }, 2, Pitch::flat },
-            { { -50, 47, 0 }, 2, Pitch::flat },
-            { { -51, 47, 0 }, 2, Pitch::flat },
-            { { -52, 47, 0 }, 2, Pitch::flat },
-            { { -53, 47, 0 }, 2, Pitch::flat },
-            { { -54, 47, 0 }, 2, Pitch::flat },
-            { { -55, 48, 0 }, 2, Pitch::flat },
-            { { -56, 48, 0 }, 0, Pitch::flat },
-            { { -57, 48, 0 }, 0, Pitch::flat },
-            { { -58, 48, 0 }, 0, Pitch::flat },
-            { { -59, 48, 0 }, 0, Pitch::flat },
-            { { -60, 48, 0 }, 0, Pitch::flat },
-            { { -61, 48, 0 }, 0, Pitch::flat },
-            { { -62, 48, 0 }, 0, Pitch::flat },
-            { { -63, 48, 0 }, 0, Pitch::flat },
-        });
-
-    // 0x4e5db8
-    // Track 13. Reversed 0. Direction 1
-    static constexpr auto moveInfoT13R0D1 = std::to_array<MoveInfo>(
-        {
-            { { 16, 0, 0 }, 16, Pitch::flat },
-            { { 16, 1, 0 }, 16, Pitch::flat },
-            { { 16, 2, 0 }, 16, Pitch::flat },
-            { { 16, 3, 0 }, 16, Pitch::flat },
-            { { 16, 4, 0 }, 16, Pitch::flat },
-            { { 16, 5, 0 }, 16, Pitch::flat },
-            { { 16, 6, 0 }, 16, Pitch::flat },
-            { { 16, 7, 0 }, 16, Pitch::flat },
-            { { 16, 8, 0 }, 18, Pitch::flat },
-            { { 17, 9, 0 }, 18, Pitch::flat },
-            { { 17, 10, 0 }, 18, Pitch::flat },
-            { { 17, 11, 0 }, 18, Pitch::flat },
-            { { 17, 12, 0 }, 18, Pitch::flat },
-            { { 17, 13, 0 }, 18, Pitch::flat },
-            { { 17, 14, 0 }, 18, Pitch::flat },
-            { { 18, 15, 0 }, 18, Pitch::flat },
-            { { 18, 16, 0 }, 18, Pitch::flat },
-            { { 18, 17, 0 }, 18, Pitch::flat },
-            { { 18, 18, 0 }, 18, Pitch::flat },
-            { { 18, 19, 0 }, 18, Pitch::flat },
-            { { 19, 20, 0 }, 18, Pitch::flat },
-            { { 19, 21, 0 }, 18, Pitch::flat },
-            { { 19, 22, 0 }, 18, Pitch::flat },
-            { { 19, 23, 0 }, 18, Pitch::flat },
-            { { 20, 24, 0 }, 20, Pitch::flat },
-            { { 20, 25, 0 }, 20, Pitch::flat },
-            { { 20, 26, 0 }, 20, Pitch::flat },
-            { { 21, 27, 0 }, 20, Pitch::flat },
-            { { 21, 28, 0 }, 20, Pitch::flat },
-            { { 21, 29, 0 }, 20, Pitch::flat },
-            { { 22, 30, 0 }, 20, Pitch::flat },
-            { { 22, 31, 0 }, 20, Pitch::flat },
-            { { 23, 32, 0 }, 20, Pitch::flat },
-            { { 23, 33, 0 }, 20, Pitch::flat },
-            { { 24, 34, 0 }, 20, Pitch::flat },
-            { { 24, 35, 0 }, 20, Pitch::flat },
-            { { 25, 36, 0 }, 20, Pitch::flat },
-            { { 25, 37, 0 }, 26, Pitch::flat },
-            { { 26, 38, 0 }, 26, Pitch::flat },
-            { { 26, 39, 0 }, 26, Pitch::flat },
-            { { 27, 40, 0 }, 26, Pitch::flat },
-            { { 28, 41, 0 }, 26, Pitch::flat },
-            { { 28, 42, 0 }, 26, Pitch::flat },
-            { { 29, 43, 0 }, 26, Pitch::flat },
-            { { 30, 44, 0 }, 26, Pitch::flat },
-            { { 30, 45, 0 }, 24, Pitch::flat },
-            { { 31, 46, 0 }, 24, Pitch::flat },
-            { { 32, 47, 0 }, 24, Pitch::flat },
-            { { 32, 48, 0 }, 24, Pitch::flat },
-            { { 33, 49, 0 }, 24, Pitch::flat },
-            { { 34, 50, 0 }, 24, Pitch::flat },
-            { { 34, 51, 0 }, 22, Pitch::flat },
-            { { 35, 52, 0 }, 22, Pitch::flat },
-            { { 36, 53, 0 }, 22, Pitch::flat },
-            { { 36, 54, 0 }, 22, Pitch::flat },
-            { { 37, 55, 0 }, 22, Pitch::flat },
-            { { 38, 56, 0 }, 22, Pitch::flat },
-            { { 38, 57, 0 }, 22, Pitch::flat },
-            { { 39, 58, 0 }, 22, Pitch::flat },
-            { { 39, 59, 0 }, 22, Pitch::flat },
-            { { 40, 60, 0 }, 20, Pitch::flat },
-            { { 40, 61, 0 }, 20, Pitch::flat },
-            { { 41, 62, 0 }, 20, Pitch::flat },
-            { { 41, 63, 0 }, 20, Pitch::flat },
-            { { 42, 64, 0 }, 20, Pitch::flat },
-            { { 42, 65, 0 }, 20, Pitch::flat },
-            { { 43, 66, 0 }, 20, Pitch::flat },
-            { { 43, 67, 0 }, 20, Pitch::flat },
-            { { 43, 68, 0 }, 20, Pitch::flat },
-            { { 44, 69, 0 }, 20, Pitch::flat },
-            { { 44, 70, 0 }, 20, Pitch::flat },
-            { { 44, 71, 0 }, 20, Pitch::flat },
-            { { 45, 72, 0 }, 18, Pitch::flat },
-            { { 45, 73, 0 }, 18, Pitch::flat },
-            { { 45, 74, 0 }, 18, Pitch::flat },
-            { { 45, 75, 0 }, 18, Pitch::flat },
-            { { 46, 76, 0 }, 18, Pitch::flat },
-            { { 46, 77, 0 }, 18, Pitch::flat },
-            { { 46, 78, 0 }, 18, Pitch::flat },
-            { { 46, 79, 0 }, 18, Pitch::flat },
-            { { 46, 80, 0 }, 18, Pitch::flat },
-            { { 47, 81, 0 }, 18, Pitch::flat },
-            { { 47, 82, 0 }, 18, Pitch::flat },
-            { { 47, 83, 0 }, 18, Pitch::flat },
-            { { 47, 84, 0 }, 18, Pitch::flat },
-            { { 47, 85, 0 }, 18, Pitch::flat },
-            { { 47, 86, 0 }, 18, Pitch::flat },
-            { { 48, 87, 0 }, 18, Pitch::flat },
-            { { 48, 88, 0 }, 16, Pitch::flat },
-            { { 48, 89, 0 }, 16, Pitch::flat },
-            { { 48, 90, 0 }, 16, Pitch::flat },
-            { { 48, 91, 0 }, 16, Pitch::flat },
-            { { 48, 92, 0 }, 16, Pitch::flat },
-            { { 48, 93, 0 }, 16, Pitch::flat },
-            { { 48, 94, 0 }, 16, Pitch::flat },
-            { { 48, 95, 0 }, 16, Pitch::flat },
-        });
-
-    // 0x4e60ba
-    // Track 13. Reversed 0. Direction 2
-    static constexpr auto moveInfoT13R0D2 = std::to_array<MoveInfo>(
-        {
-            { { 0, 16, 0 }, 32, Pitch::flat },
-            { { 1, 16, 0 }, 32, Pitch::flat },
-            { { 2, 16, 0 }, 32, Pitch::flat },
-            { { 3, 16, 0 }, 32, Pitch::flat },
-            { { 4, 16, 0 }, 32, Pitch::flat },
-            { { 5, 16, 0 }, 32, Pitch::flat },
-            { { 6, 16, 0 }, 32, Pitch::flat },
-            { { 7, 16, 0 }, 32, Pitch::flat },
-            { { 8, 16, 0 }, 34, Pitch::flat },
-            { { 9, 15, 0 }, 34, Pitch::flat },
-            { { 10, 15, 0 }, 34, Pitch::flat },
-            { { 11, 15, 0 }, 34, Pitch::flat },
-            { { 12, 15, 0 }, 34, Pitch::flat },
-            { { 13, 15, 0 }, 34, Pitch::flat },
-            { { 14, 15, 0 }, 34, Pitch::flat },
-            { { 15, 14, 0 }, 34, Pitch::flat },
-            { { 16, 14, 0 }, 34, Pitch::flat },
-            { { 17, 14, 0 }, 34, Pitch::flat },
-            { { 18, 14, 0 }, 34, Pitch::flat },
-            { { 19, 14, 0 }, 34, Pitch::flat },
-            { { 20, 13, 0 }, 34, Pitch::flat },
-            { { 21, 13, 0 }, 34, Pitch::flat },
-            { { 22, 13, 0 }, 34, Pitch::flat },
-            { { 23, 13, 0 }, 34, Pitch::flat },
-            { { 24, 12, 0 }, 36, Pitch::flat },
-            { { 25, 12, 0 }, 36, Pitch::flat },
-            { { 26, 12, 0 }, 36, Pitch::flat },
-            { { 27, 11, 0 }, 36, Pitch::flat },
-            { { 28, 11, 0 }, 36, Pitch::flat },
-            { { 29, 11, 0 }, 36, Pitch::flat },
-            { { 30, 10, 0 }, 36, Pitch::flat },
-            { { 31, 10, 0 }, 36, Pitch::flat },
-            { { 32, 9, 0 }, 36, Pitch::flat },
-            { { 33, 9, 0 }, 36, Pitch::flat },
-            { { 34, 8, 0 }, 36, Pitch::flat },
-            { { 35, 8, 0 }, 36, Pitch::flat },
-            { { 36, 7, 0 }, 36, Pitch::flat },
-            { { 37, 7, 0 }, 42, Pitch::flat },
-            { { 38, 6, 0 }, 42, Pitch::flat },
-            { { 39, 6, 0 }, 42, Pitch::flat },
-            { { 40, 5, 0 }, 42, Pitch::flat },
-            { { 41, 4, 0 }, 42, Pitch::flat },
-            { { 42, 4, 0 }, 42, Pitch::flat },
-            { { 43, 3, 0 }, 42, Pitch::flat },
-            { { 44, 2, 0 }, 42, Pitch::flat },
-            { { 45, 2, 0 }, 40, Pitch::flat },
-            { { 46, 1, 0 }, 40, Pitch::flat },
-            { { 47, 0, 0 }, 40, Pitch::flat },
-            { { 48, 0, 0 }, 40, Pitch::flat },
-            { { 49, -1, 0 }, 40, Pitch::flat },
-            { { 50, -2, 0 }, 40, Pitch::flat },
-            { { 51, -2, 0 }, 38, Pitch::flat },
-            { { 52, -3, 0 }, 38, Pitch::flat },
-            { { 53, -4, 0 }, 38, Pitch::flat },
-            { { 54, -4, 0 }, 38, Pitch::flat },
-            { { 55, -5, 0 }, 38, Pitch::flat },
-            { { 56, -6, 0 }, 38, Pitch::flat },
-            { { 57, -6, 0 }, 38, Pitch::flat },
-            { { 58, -7, 0 }, 38, Pitch::flat },
-            { { 59, -7, 0 }, 38, Pitch::flat },
-            { { 60, -8, 0 }, 36, Pitch::flat },
-            { { 61, -8, 0 }, 36, Pitch::flat },
-            { { 62, -9, 0 }, 36, Pitch::flat },
-            { { 63, -9, 0 }, 36, Pitch::flat },
-            { { 64, -10, 0 }, 36, Pitch::flat },
-            { { 65, -10, 0 }, 36, Pitch::flat },
-            { { 66, -11, 0 }, 36, Pitch::flat },
-            { { 67, -11, 0 }, 36, Pitch::flat },
-            { { 68, -11, 0 }, 36, Pitch::flat },
-            { { 69, -12, 0 }, 36, Pitch::flat },
-            { { 70, -12, 0 }, 36, Pitch::flat },
-            { { 71, -12, 0 }, 36, Pitch::flat },
-            { { 72, -13, 0 }, 34, Pitch::flat },
-            { { 73, -13, 0 }, 34, Pitch::flat },
-            { { 74, -13, 0 }, 34, Pitch::flat },
-            { { 75, -13, 0 }, 34, Pitch::flat },
-            { { 76, -14, 0 }, 34, Pitch::flat },
-            { { 77, -14, 0 }, 34, Pitch::flat },
-            { { 78, -14, 0 }, 34, Pitch::flat },
-            { { 79, -14, 0 }, 34, Pitch::flat },
-            { { 80, -14, 0 }, 34, Pitch::flat },
-            { { 81, -15, 0 }, 34, Pitch::flat },
-            { { 82, -15, 0 }, 34, Pitch::flat },
-            { { 83, -15, 0 }, 34, Pitch::flat },
-            { { 84, -15, 0 }, 34, Pitch::flat },
-            { { 85, -15, 0 }, 34, Pitch::flat },
-            { { 86, -15, 0 }, 34, Pitch::flat },
-            { { 87, -16, 0 }, 34, Pitch::flat },
-            { { 88, -16, 0 }, 32, Pitch::flat },
-            { { 89, -16, 0 }, 32, Pitch::flat },
-            { { 90, -16, 0 }, 32, Pitch::flat },
-            { { 91, -16, 0 }, 32, Pitch::flat },
-            { { 92, -16, 0 }, 32, Pitch::flat },
-            { { 93, -16, 0 }, 32, Pitch::flat },
-            { { 94, -16, 0 }, 32, Pitch::flat },
-            { { 95, -16, 0 }, 32, Pitch::flat },
-        });
-
-    // 0x4e63bc
-    // Track 13. Reversed 0. Direction 3
-    static constexpr auto moveInfoT13R0D3 = std::to_array<MoveInfo>(
-        {
-            { { 16, 32, 0 }, 48, Pitch::flat },
-            { { 16, 31, 0 }, 48, Pitch::flat },
-            { { 16, 30, 0 }, 48, Pitch::flat },
-            { { 16, 29, 0 }, 48, Pitch::flat },
-            { { 16, 28, 0 }, 48, Pitch::flat },
-            { { 16, 27, 0 }, 48, Pitch::flat },
-            { { 16, 26, 0 }, 48, Pitch::flat },
-            { { 16, 25, 0 }, 48, Pitch::flat },
-            { { 16, 24, 0 }, 50, Pitch::flat },
-            { { 15, 23, 0 }, 50, Pitch::flat },
-            { { 15, 22, 0 }, 50, Pitch::flat },
-            { { 15, 21, 0 }, 50, Pitch::flat },
-            { { 15, 20, 0 }, 50, Pitch::flat },
-            { { 15, 19, 0 }, 50, Pitch::flat },
-            { { 15, 18, 0 }, 50, Pitch::flat },
-            { { 14, 17, 0 }, 50, Pitch::flat },
-            { { 14, 16, 0 }, 50, Pitch::flat },
-            { { 14, 15, 0 }, 50, Pitch::flat },
-            { { 14, 14, 0 }, 50, Pitch::flat },
-            { { 14, 13, 0 }, 50, Pitch::flat },
-            { { 13, 12, 0 }, 50, Pitch::flat },
-            { { 13, 11, 0 }, 50, Pitch::flat },
-            { { 13, 10, 0 }, 50, Pitch::flat },
-            { { 13, 9, 0 }, 50, Pitch::flat },
-            { { 12, 8, 0 }, 52, Pitch::flat },
-            { { 12, 7, 0 }, 52, Pitch::flat },
-            { { 12, 6, 0 }, 52, Pitch::flat },
-            { { 11, 5, 0 }, 52, Pitch::flat },
-            { { 11, 4, 0 }, 52, Pitch::flat },
-            { { 11, 3, 0 }, 52, Pitch::flat },
-            { { 10, 2, 0 }, 52, Pitch::flat },
-            { { 10, 1, 0 }, 52, Pitch::flat },
-            { { 9, 0, 0 }, 52, Pitch::flat },
-            { { 9, -1, 0 }, 52, Pitch::flat },
-            { { 8, -2, 0 }, 52, Pitch::flat },
-            { { 8, -3, 0 }, 52, Pitch::flat },
-            { { 7, -4, 0 }, 52, Pitch::flat },
-            { { 7, -5, 0 }, 58, Pitch::flat },
-            { { 6, -6, 0 }, 58, Pitch::flat },
-            { { 6, -7, 0 }, 58, Pitch::flat },
-            { { 5, -8, 0 }, 58, Pitch::flat },
-            { { 4, -9, 0 }, 58, Pitch::flat },
-            { { 4, -10, 0 }, 58, Pitch::flat },
-            { { 3, -11, 0 }, 58, Pitch::flat },
-            { { 2, -12, 0 }, 58, Pitch::flat },
-            { { 2, -13, 0 }, 56, Pitch::flat },
-            { { 1, -14, 0 }, 56, Pitch::flat },
-            { { 0, -15, 0 }, 56, Pitch::flat },
-            { { 0, -16, 0 }, 56, Pitch::flat },
-            { { -1, -17, 0 }, 56, Pitch::flat },
-            { { -2, -18, 0 }, 56, Pitch::flat },
-            { { -2, -19, 0 }, 54, Pitch::flat },
-            { { -3, -20, 0 }, 54, Pitch::flat },
-            { { -4, -21, 0 }, 54, Pitch::flat },
-            { { -4, -22, 0 }, 54, Pitch::flat },
-            { { -5, -23, 0 }, 54, Pitch::flat },
-            { { -6, -24, 0 }, 54, Pitch::flat },
-            { { -6, -25, 0 }, 54, Pitch::flat },
-            { { -7, -26, 0 }, 54, Pitch::flat },
-            { { -7, -27, 0 }, 54, Pitch::flat },
-            { { -8, -28, 0 }, 52, Pitch::flat },
-            { { -8, -29, 0 }, 52, Pitch::flat },
-            { { -9, -30, 0 }, 52, Pitch::flat },
-            { { -9, -31, 0 }, 52, Pitch::flat },
-            { { -10, -32, 0 }, 52, Pitch::flat },
-            { { -10, -33, 0 }, 52, Pitch::flat },
-            { { -11, -34, 0 }, 52, Pitch::flat },
-            { { -11, -35, 0 }, 52, Pitch::flat },
-            { { -11, -36, 0 }, 52, Pitch::flat },
-            { { -12, -37, 0 }, 52, Pitch::flat },
-            { { -12, -38, 0 }, 52, Pitch::flat },
-            { { -12, -39, 0 }, 52, Pitch::flat },
-            { { -13, -40, 0 }, 50, Pitch::flat },
-            { { -13, -41, 0 }, 50, Pitch::flat },
-            { { -13, -42, 0 }, 50, Pitch::flat },
-            { { -13, -43, 0 }, 50, Pitch::flat },
-            { { -14, -44, 0 }, 50, Pitch::flat },
-            { { -14, -45, 0 }, 50, Pitch::flat },
-            { { -14, -46, 0 }, 50, Pitch::flat },
-            { { -14, -47, 0 }, 50, Pitch::flat },
-            { { -14, -48, 0 }, 50, Pitch::flat },
-            { { -15, -49, 0 }, 50, Pitch::flat },
-            { { -15, -50, 0 }, 50, Pitch::flat },
-            { { -15, -51, 0 }, 50, Pitch::flat },
-            { { -15, -52, 0 }, 50, Pitch::flat },
-            { { -15, -53, 0 }, 50, Pitch::flat },
-            { { -15, -54, 0 }, 50, Pitch::flat },
-            { { -16, -55, 0 }, 50, Pitch::flat },
-            { { -16, -56, 0 }, 48, Pitch::flat },
-            { { -16, -57, 0 }, 48, Pitch::flat },
-            { { -16, -58, 0 }, 48, Pitch::flat },
-            { { -16, -59, 0 }, 48, Pitch::flat },
-            { { -16, -60, 0 }, 48, Pitch::flat },
-            { { -16, -61, 0 }, 48, Pitch::flat },
-            { { -16, -62, 0 }, 48, Pitch::flat },
-            { { -16, -63, 0 }, 48, Pitch::flat },
-        });
-
-    // 0x4da92e
-    // Track 14. Reversed 0. Direction 0
-    static constexpr auto moveInfoT14R0D0 = std::to_array<MoveInfo>(
-        {
-            { { 31, 16, 0 }, 0, Pitch::up12deg },
-            { { 30, 16, 0 }, 0, Pitch::up12deg },
-            { { 29, 16, 0 }, 0, Pitch::up12deg },
-            { { 28, 16, 0 }, 0, Pitch::up12deg },
-            { { 27, 16, 1 }, 0, Pitch::up12deg },
-            { { 26, 16, 1 }, 0, Pitch::up12deg },
-            { { 25, 16, 1 }, 0, Pitch::up12deg },
-            { { 24, 16, 1 }, 0, Pitch::up12deg },
-            { { 23, 16, 2 }, 0, Pitch::up12deg },
-            { { 22, 16, 2 }, 0, Pitch::up12deg },
-            { { 21, 16, 2 }, 0, Pitch::up12deg },
-            { { 20, 16, 2 }, 0, Pitch::up12deg },
-            { { 19, 16, 3 }, 0, Pitch::up12deg },
-            { { 18, 16, 3 }, 0, Pitch::up12deg },
-            { { 17, 16, 3 }, 0, Pitch::up12deg },
-            { { 16, 16, 3 }, 0, Pitch::up12deg },
-            { { 15, 16, 4 }, 0, Pitch::up12deg },
-            { { 14, 16, 4 }, 0, Pitch::up12deg },
-            { { 13, 16, 4 }, 0, Pitch::up12deg },
-            { { 12, 16, 4 }, 0, Pitch::up12deg },
-            { { 11, 16, 5 }, 0, Pitch::up12deg },
-            { { 10, 16, 5 }, 0, Pitch::up12deg },
-            { { 9, 16, 5 }, 0, Pitch::up12deg },
-            { { 8, 16, 5 }, 0, Pitch::up12deg },
-            { { 7, 16, 6 }, 0, Pitch::up12deg },
-            { { 6, 16, 6 }, 0, Pitch::up12deg },
-            { { 5, 16, 6 }, 0, Pitch::up12deg },
-            { { 4, 16, 6 }, 0, Pitch::up12deg },
-            { { 3, 16, 7 }, 0, Pitch::up12deg },
-            { { 2, 16, 7 }, 0, Pitch::up12deg },
-            { { 1, 16, 7 }, 0, Pitch::up12deg },
-            { { 0, 16, 7 }, 0, Pitch::up12deg },
-            { { -1, 16, 8 }, 0, Pitch::up12deg },
-            { { -2, 16, 8 }, 0, Pitch::up12deg },
-            { { -3, 16, 8 }, 0, Pitch::up12deg },
-            { { -4, 16, 8 }, 0, Pitch::up12deg },
-            { { -5, 16, 9 }, 0, Pitch::up12deg },
-            { { -6, 16, 9 }, 0, Pitch::up12deg },
-            { { -7, 16, 9 }, 0, Pitch::up12deg },
-            { { -8, 16, 9 }, 0, Pitch::up12deg },
-            { { -9, 16, 10 }, 0, Pitch::up12deg },
-            { { -10, 16, 10 }, 0, Pitch::up12deg },
-            { { -11, 16, 10 }, 0, Pitch::up12deg },
-            { { -12, 16, 10 }, 0, Pitch::up12deg },
-            { { -13, 16, 11 }, 0, Pitch::up12deg },
-            { { -14, 16, 11 }, 0, Pitch::up12deg },
-            { { -15, 16, 11 }, 0, Pitch::up12deg },
-            { { -16, 16, 11 }, 0, Pitch::up12deg },
-            { { -17, 16, 12 }, 0, Pitch::up12deg },
-            { { -18, 16, 12 }, 0, Pitch::up12deg },
-            { { -19, 16, 12 }, 0, Pitch::up12deg },
-            { { -20, 16, 12 }, 0, Pitch::up12deg },
-            { { -21, 16, 13 }, 0, Pitch::up12deg },
-            { { -22, 16, 13 }, 0, Pitch::up12deg },
-            { { -23, 16, 13 }, 0, Pitch::up12deg },
-            { { -24, 16, 13 }, 0, Pitch::up12deg },
-            { { -25, 16, 14 }, 0, Pitch::up12deg },
-            { { -26, 16, 14 }, 0, Pitch::up12deg },
-            { { -27, 16, 14 }, 0, Pitch::up12deg },
-            { { -28, 16, 14 }, 0, Pitch::up12deg },
-            { { -29, 16, 15 }, 0, Pitch::up12deg },
-            { { -30, 16, 15 }, 0, Pitch::up12deg },
-            { { -31, 16, 15 }, 0, Pitch::up12deg },
-            { { -32, 16, 15 }, 0, Pitch::up12deg },
-        });
-
-    // 0x4dab30
-    // Track 14. Reversed 0. Direction 1
-    static constexpr auto moveInfoT14R0D1 = std::to_array<MoveInfo>(
-        {
-            { { 16, 0, 0 }, 16, Pitch::up12deg },
-            { { 16, 1, 0 }, 16, Pitch::up12deg },
-            { { 16, 2, 0 }, 16, Pitch::up12deg },
-            { { 16, 3, 0 }, 16, Pitch::up12deg },
-            { { 16, 4, 1 }, 16, Pitch::up12deg },
-            { { 16, 5, 1 }, 16, Pitch::up12deg },
-            { { 16, 6, 1 }, 16, Pitch::up12deg },
-            { { 16, 7, 1 }, 16, Pitch::up12deg },
-            { { 16, 8, 2 }, 16, Pitch::up12deg },
-            { { 16, 9, 2 }, 16, Pitch::up12deg },
-            { { 16, 10, 2 }, 16, Pitch::up12deg },
-            { { 16, 11, 2 }, 16, Pitch::up12deg },
-            { { 16, 12, 3 }, 16, Pitch::up12deg },
-            { { 16, 13, 3 }, 16, Pitch::up12deg },
-            { { 16, 14, 3 }, 16, Pitch::up12deg },
-            { { 16, 15, 3 }, 16, Pitch::up12deg },
-            { { 16, 16, 4 }, 16, Pitch::up12deg },
-            { { 16, 17, 4 }, 16, Pitch::up12deg },
-            { { 16, 18, 4 }, 16, Pitch::up12deg },
-            { { 16, 19, 4 }, 16, Pitch::up12deg },
-            { { 16, 20, 5 }, 16, Pitch::up12deg },
-            { { 16, 21, 5 }, 16, Pitch::up12deg },
-            { { 16, 22, 5 }, 16, Pitch::up12deg },
-            { { 16, 23, 5 }, 16, Pitch::up12deg },
-            { { 16, 24, 6 }, 16, Pitch::up12deg },
-            { { 16, 25, 6 }, 16, Pitch::up12deg },
-            { { 16, 26, 6 }, 16, Pitch::up12deg },
-            { { 16, 27, 6 }, 16, Pitch::up12deg },
-            { { 16, 28, 7 }, 16, Pitch::up12deg },
-            { { 16, 29, 7 }, 16, Pitch::up12deg },
-            { { 16, 30, 7 }, 16, Pitch::up12deg },
-            { { 16, 31, 7 }, 16, Pitch::up12deg },
-            { { 16, 32, 8 }, 16, Pitch::up12deg },
-            { { 16, 33, 8 }, 16, Pitch::up12deg },
-            { { 16, 34, 8 }, 16, Pitch::up12deg },
-            { { 16, 35, 8 }, 16, Pitch::up12deg },
-            { { 16, 36, 9 }, 16, Pitch::up12deg },
-            { { 16, 37, 9 }, 16, Pitch::up12deg },
-            { { 16, 38, 9 }, 16, Pitch::up12deg },
-            { { 16, 39, 9 }, 16, Pitch::up12deg },
-            { { 16, 40, 10 }, 16, Pitch::up12deg },
-            { { 16, 41, 10 }, 16, Pitch::up12deg },
-            { { 16, 42, 10 }, 16, Pitch::up12deg },
-            { { 16, 43, 10 }, 16, Pitch::up12deg },
-            { { 16, 44, 11 }, 16, Pitch::up12deg },
-            { { 16, 45, 11 }, 16, Pitch::up12deg },
-            { { 16, 46, 11 }, 16, Pitch::up12deg },
-            { { 16, 47, 11 }, 16, Pitch::up12deg },
-            { { 16, 48, 12 }, 16, Pitch::up12deg },
-            { { 16, 49, 12 }, 16, Pitch::up12deg },
-            { { 16, 50, 12 }, 16, Pitch::up12deg },
-            { { 16, 51, 12 }, 16, Pitch::up12deg },
-            { { 16, 52, 13 }, 16, Pitch::up12deg },
-            { { 16, 53, 13 }, 16, Pitch::up12deg },
-            { { 16, 54, 13 }, 16, Pitch::up12deg },
-            { { 16, 55, 13 }, 16, Pitch::up12deg },
-            { { 16, 56, 14 }, 16, Pitch::up12deg },
-            { { 16, 57, 14 }, 16, Pitch::up12deg },
-            { { 16, 58, 14 }, 16, Pitch::up12deg },
-            { { 16, 59, 14 }, 16, Pitch::up12deg },
-            { { 16, 60, 15 }, 16, Pitch::up12deg },
-            { { 16, 61, 15 }, 16, Pitch::up12deg },
-            { { 16, 62, 15 }, 16, Pitch::up12deg },
-            { { 16, 63, 15 }, 16, Pitch::up12deg },
-        });
-
-    // 0x4dad32
-    // Track 14. Reversed 0. Direction 2
-    static constexpr auto moveInfoT14R0D2 = std::to_array<MoveInfo>(
-        {
-            { { 0, 16, 0 }, 32, Pitch::up12deg },
-            { { 1, 16, 0 }, 32, Pitch::up12deg },
-            { { 2, 16, 0 }, 32, Pitch::up12deg },
-            { { 3, 16, 0 }, 32, Pitch::up12deg },
-            { { 4, 16, 1 }, 32, Pitch::up12deg },
-            { { 5, 16, 1 }, 32, Pitch::up12deg },
-            { { 6, 16, 1 }, 32, Pitch::up12deg },
-            { { 7, 16, 1 }, 32, Pitch::up12deg },
-            { { 8, 16, 2 }, 32, Pitch::up12deg },
-            { { 9, 16, 2 }, 32, Pitch::up12deg },
-            { { 10, 16, 2 }, 32, Pitch::up12deg },
-            { { 11, 16, 2 }, 32, Pitch::up12deg },
-            { { 12, 16, 3 }, 32, Pitch::up12deg },
-            { { 13, 16, 3 }, 32, Pitch::up12deg },
-            { { 14, 16, 3 }, 32, Pitch::up12deg },
-            { { 15, 16, 3 }, 32, Pitch::up12deg },
-            { { 16, 16, 4 }, 32, Pitch::up12deg },
-            { { 17, 16, 4 }, 32, Pitch::up12deg },
-            { { 18, 16, 4 }, 32, Pitch::up12deg },
-            { { 19, 16, 4 }, 32, Pitch::up12deg },
-            { { 20, 16, 5 }, 32, Pitch::up12deg },
-            { { 21, 16, 5 }, 32, Pitch::up12deg },
-            { { 22, 16, 5 }, 32, Pitch::up12deg },
-            { { 23, 16, 5 }, 32, Pitch::up12deg },
-            { { 24, 16, 6 }, 32, Pitch::up12deg },
-            { { 25, 16, 6 }, 32, Pitch::up12deg },
-            { { 26, 16, 6 }, 32, Pitch::up12deg },
-            { { 27, 16, 6 }, 32, Pitch::up12deg },
-            { { 28, 16, 7 }, 32, Pitch::up12deg },
-            { { 29, 16, 7 }, 32, Pitch::up12deg },
-            { { 30, 16, 7 }, 32, Pitch::up12deg },
-            { { 31, 16, 7 }, 32, Pitch::up12deg },
-            { { 32, 16, 8 }, 32, Pitch::up12deg },
-            { { 33, 16, 8 }, 32, Pitch::up12deg },
-            { { 34, 16, 8 }, 32, Pitch::up12deg },
-            { { 35, 16, 8 }, 32, Pitch::up12deg },
-            { { 36, 16, 9 }, 32, Pitch::up12deg },
-            { { 37, 16, 9 }, 32, Pitch::up12deg },
-            { { 38, 16, 9 }, 32, Pitch::up12deg },
-            { { 39, 16, 9 }, 32, Pitch::up12deg },
-            { { 40, 16, 10 }, 32, Pitch::up12deg },
-            { { 41, 16, 10 }, 32, Pitch::up12deg },
-            { { 42, 16, 10 }, 32, Pitch::up12deg },
-            { { 43, 16, 10 }, 32, Pitch::up12deg },
-            { { 44, 16, 11 }, 32, Pitch::up12deg },
-            { { 45, 16, 11 }, 32, Pitch::up12deg },
-            { { 46, 16, 11 }, 32, Pitch::up12deg },
-            { { 47, 16, 11 }, 32, Pitch::up12deg },
-            { { 48, 16, 12 }, 32, Pitch::up12deg },
-            { { 49, 16, 12 }, 32, Pitch::up12deg },
-            { { 50, 16, 12 }, 32, Pitch::up12deg },
-            { { 51, 16, 12 }, 32, Pitch::up12deg },
-            { { 52, 16, 13 }, 32, Pitch::up12deg },
-            { { 53, 16, 13 }, 32, Pitch::up12deg },
-            { { 54, 16, 13 }, 32, Pitch::up12deg },
-            { { 55, 16, 13 }, 32, Pitch::up12deg },
-            { { 56, 16, 14 }, 32, Pitch::up12deg },
-            { { 57, 16, 14 }, 32, Pitch::up12deg },
-            { { 58, 16, 14 }, 32, Pitch::up12deg },
-            { { 59, 16, 14 }, 32, Pitch::up12deg },
-            { { 60, 16, 15 }, 32, Pitch::up12deg },
-            { { 61, 16, 15 }, 32, Pitch::up12deg },
-            { { 62, 16, 15 }, 32, Pitch::up12deg },
-            { { 63, 16, 15 }, 32, Pitch::up12deg },
-        });
-
-    // 0x4daf34
-    // Track 14. Reversed 0. Direction 3
-    static constexpr auto moveInfoT14R0D3 = std::to_array<MoveInfo>(
-        {
-            { { 16, 31, 0 }, 48, Pitch::up12deg },
-            { { 16, 30, 0 }, 48, Pitch::up12deg },
-            { { 16, 29, 0 }, 48, Pitch::up12deg },
-            { { 16, 28, 0 }, 48, Pitch::up12deg },
-            { { 16, 27, 1 }, 48, Pitch::up12deg },
-            { { 16, 26, 1 }, 48, Pitch::up12deg },
-            { { 16, 25, 1 }, 48, Pitch::up12deg },
-            { { 16, 24, 1 }, 48, Pitch::up12deg },
-            { { 16, 23, 2 }, 48, Pitch::up12deg },
-            { { 16, 22, 2 }, 48, Pitch::up12deg },
-            { { 16, 21, 2 }, 48, Pitch::up12deg },
-            { { 16, 20, 2 }, 48, Pitch::up12deg },
-            { { 16, 19, 3 }, 48, Pitch::up12deg },
-            { { 16, 18, 3 }, 48, Pitch::up12deg },
-            { { 16, 17, 3 }, 48, Pitch::up12deg },
-            { { 16, 16, 3 }, 48, Pitch::up12deg },
-            { { 16, 15, 4 }, 48, Pitch::up12deg },
-            { { 16, 14, 4 }, 48, Pitch::up12deg },
-            { { 16, 13, 4 }, 48, Pitch::up12deg },
-            { { 16, 12, 4 }, 48, Pitch::up12deg },
-            { { 16, 11, 5 }, 48, Pitch::up12deg },
-            { { 16, 10, 5 }, 48, Pitch::up12deg },
-            { { 16, 9, 5 }, 48, Pitch::up12deg },
-            { { 16, 8, 5 }, 48, Pitch::up12deg },
-            { { 16, 7, 6 }, 48, Pitch::up12deg },
-            { { 16, 6, 6 }, 48, Pitch::up12deg },
-            { { 16, 5, 6 }, 48, Pitch::up12deg },
-            { { 16, 4, 6 }, 48, Pitch::up12deg },
-            { { 16, 3, 7 }, 48, Pitch::up12deg },
-            { { 16, 2, 7 }, 48, Pitch::up12deg },
-            { { 16, 1, 7 }, 48, Pitch::up12deg },
-            { { 16, 0, 7 }, 48, Pitch::up12deg },
-            { { 16, -1, 8 }, 48, Pitch::up12deg },
-            { { 16, -2, 8 }, 48, Pitch::up12deg },
-            { { 16, -3, 8 }, 48, Pitch::up12deg },
-            { { 16, -4, 8 }, 48, Pitch::up12deg },
-            { { 16, -5, 9 }, 48, Pitch::up12deg },
-            { { 16, -6, 9 }, 48, Pitch::up12deg },
-            { { 16, -7, 9 }, 48, Pitch::up12deg },
-            { { 16, -8, 9 }, 48, Pitch::up12deg },
-            { { 16, -9, 10 }, 48, Pitch::up12deg },
-            { { 16, -10, 10 }, 48, Pitch::up12deg },
-            { { 16, -11, 10 }, 48, Pitch::up12deg },
-            { { 16, -12, 10 }, 48, Pitch::up12deg },
-            { { 16, -13, 11 }, 48, Pitch::up12deg },
-            { { 16, -14, 11 }, 48, Pitch::up12deg },
-            { { 16, -15, 11 }, 48, Pitch::up12deg },
-            { { 16, -16, 11 }, 48, Pitch::up12deg },
-            { { 16, -17, 12 }, 48, Pitch::up12deg },
-            { { 16, -18, 12 }, 48, Pitch::up12deg },
-            { { 16, -19, 12 }, 48, Pitch::up12deg },
-            { { 16, -20, 12 }, 48, Pitch::up12deg },
-            { { 16, -21, 13 }, 48, Pitch::up12deg },
-            { { 16, -22, 13 }, 48, Pitch::up12deg },
-            { { 16, -23, 13 }, 48, Pitch::up12deg },
-            { { 16, -24, 13 }, 48, Pitch::up12deg },
-            { { 16, -25, 14 }, 48, Pitch::up12deg },
-            { { 16, -26, 14 }, 48, Pitch::up12deg },
-            { { 16, -27, 14 }, 48, Pitch::up12deg },
-            { { 16, -28, 14 }, 48, Pitch::up12deg },
-            { { 16, -29, 15 }, 48, Pitch::up12deg },
-            { { 16, -30, 15 }, 48, Pitch::up12deg },
-            { { 16, -31, 15 }, 48, Pitch::up12deg },
-            { { 16, -32, 15 }, 48, Pitch::up12deg },
-        });
-
-    // 0x4db53a
-    // Track 14. Reversed 1. Direction 0
-    static constexpr auto moveInfoT14R1D0 = std::to_array<MoveInfo>(
-        {
-            { { 0, 16, 0 }, 32, Pitch::down12deg },
-            { { 1, 16, 0 }, 32, Pitch::down12deg },
-            { { 2, 16, 0 }, 32, Pitch::down12deg },
-            { { 3, 16, 0 }, 32, Pitch::down12deg },
-            { { 4, 16, -1 }, 32, Pitch::down12deg },
-            { { 5, 16, -1 }, 32, Pitch::down12deg },
-            { { 6, 16, -1 }, 32, Pitch::down12deg },
-            { { 7, 16, -1 }, 32, Pitch::down12deg },
-            { { 8, 16, -2 }, 32, Pitch::down12deg },
-            { { 9, 16, -2 }, 32, Pitch::down12deg },
-            { { 10, 16, -2 }, 32, Pitch::down12deg },
-            { { 11, 16, -2 }, 32, Pitch::down12deg },
-            { { 12, 16, -3 }, 32, Pitch::down12deg },
-            { { 13, 16, -3 }, 32, Pitch::down12deg },
-            { { 14, 16, -3 }, 32, Pitch::down12deg },
-            { { 15, 16, -3 }, 32, Pitch::down12deg },
-            { { 16, 16, -4 }, 32, Pitch::down12deg },
-            { { 17, 16, -4 }, 32, Pitch::down12deg },
-            { { 18, 16, -4 }, 32, Pitch::down12deg },
-            { { 19, 16, -4 }, 32, Pitch::down12deg },
-            { { 20, 16, -5 }, 32, Pitch::down12deg },
-            { { 21, 16, -5 }, 32, Pitch::down12deg },
-            { { 22, 16, -5 }, 32, Pitch::down12deg },
-            { { 23, 16, -5 }, 32, Pitch::down12deg },
-            { { 24, 16, -6 }, 32, Pitch::down12deg },
-            { { 25, 16, -6 }, 32, Pitch::down12deg },
-            { { 26, 16, -6 }, 32, Pitch::down12deg },
-            { { 27, 16, -6 }, 32, Pitch::down12deg },
-            { { 28, 16, -7 }, 32, Pitch::down12deg },
-            { { 29, 16, -7 }, 32, Pitch::down12deg },
-            { { 30, 16, -7 }, 32, Pitch::down12deg },
-            { { 31, 16, -7 }, 32, Pitch::down12deg },
-            { { 32, 16, -8 }, 32, Pitch::down12deg },
-            { { 33, 16, -8 }, 32, Pitch::down12deg },
-            { { 34, 16, -8 }, 32, Pitch::down12deg },
-            { { 35, 16, -8 }, 32, Pitch::down12deg },
-            { { 36, 16, -9 }, 32, Pitch::down12deg },
-            { { 37, 16, -9 }, 32, Pitch::down12deg },
-            { { 38, 16, -9 }, 32, Pitch::down12deg },
-            { { 39, 16, -9 }, 32, Pitch::down12deg },
-            { { 40, 16, -10 }, 32, Pitch::down12deg },
-            { { 41, 16, -10 }, 32, Pitch::down12deg },
-            { { 42, 16, -10 }, 32, Pitch::down12deg },
-            { { 43, 16, -10 }, 32, Pitch::down12deg },
-            { { 44, 16, -11 }, 32, Pitch::down12deg },
-            { { 45, 16, -11 }, 32, Pitch::down12deg },
-            { { 46, 16, -11 }, 32, Pitch::down12deg },
-            { { 47, 16, -11 }, 32, Pitch::down12deg },
-            { { 48, 16, -12 }, 32, Pitch::down12deg },
-            { { 49, 16, -12 }, 32, Pitch::down12deg },
-            { { 50, 16, -12 }, 32, Pitch::down12deg },
-            { { 51, 16, -12 }, 32, Pitch::down12deg },
-            { { 52, 16, -13 }, 32, Pitch::down12deg },
-            { { 53, 16, -13 }, 32, Pitch::down12deg },
-            { { 54, 16, -13 }, 32, Pitch::down12deg },
-            { { 55, 16, -13 }, 32, Pitch::down12deg },
-            { { 56, 16, -14 }, 32, Pitch::down12deg },
-            { { 57, 16, -14 }, 32, Pitch::down12deg },
-            { { 58, 16, -14 }, 32, Pitch::down12deg },
-            { { 59, 16, -14 }, 32, Pitch::down12deg },
-            { { 60, 16, -15 }, 32, Pitch::down12deg },
-            { { 61, 16, -15 }, 32, Pitch::down12deg },
-            { { 62, 16, -15 }, 32, Pitch::down12deg },
-            { { 63, 16, -15 }, 32, Pitch::down12deg },
-        });
-
-    // 0x4db73c
-    // Track 14. Reversed 1. Direction 1
-    static constexpr auto moveInfoT14R1D1 = std::to_array<MoveInfo>(
-        {
-            { { 16, 31, 0 }, 48, Pitch::down12deg },
-            { { 16, 30, 0 }, 48, Pitch::down12deg },
-            { { 16, 29, 0 }, 48, Pitch::down12deg },
-            { { 16, 28, 0 }, 48, Pitch::down12deg },
-            { { 16, 27, -1 }, 48, Pitch::down12deg },
-            { { 16, 26, -1 }, 48, Pitch::down12deg },
-            { { 16, 25, -1 }, 48, Pitch::down12deg },
-            { { 16, 24, -1 }, 48, Pitch::down12deg },
-            { { 16, 23, -2 }, 48, Pitch::down12deg },
-            { { 16, 22, -2 }, 48, Pitch::down12deg },
-            { { 16, 21, -2 }, 48, Pitch::down12deg },
-            { { 16, 20, -2 }, 48, Pitch::down12deg },
-            { { 16, 19, -3 }, 48, Pitch::down12deg },
-            { { 16, 18, -3 }, 48, Pitch::down12deg },
-            { { 16, 17, -3 }, 48, Pitch::down12deg },
-            { { 16, 16, -3 }, 48, Pitch::down12deg },
-            { { 16, 15, -4 }, 48, Pitch::down12deg },
-            { { 16, 14, -4 }, 48, Pitch::down12deg },
-            { { 16, 13, -4 }, 48, Pitch::down12deg },
-            { { 16, 12, -4 }, 48, Pitch::down12deg },
-            { { 16, 11, -5 }, 48, Pitch::down12deg },
-            { { 16, 10, -5 }, 48, Pitch::down12deg },
-            { { 16, 9, -5 }, 48, Pitch::down12deg },
-            { { 16, 8, -5 }, 48, Pitch::down12deg },
-            { { 16, 7, -6 }, 48, Pitch::down12deg },
-            { { 16, 6, -6 }, 48, Pitch::down12deg },
-            { { 16, 5, -6 }, 48, Pitch::down12deg },
-            { { 16, 4, -6 }, 48, Pitch::down12deg },
-            { { 16, 3, -7 }, 48, Pitch::down12deg },
-            { { 16, 2, -7 }, 48, Pitch::down12deg },
-            { { 16, 1, -7 }, 48, Pitch::down12deg },
-            { { 16, 0, -7 }, 48, Pitch::down12deg },
-            { { 16, -1, -8 }, 48, Pitch::down12deg },
-            { { 16, -2, -8 }, 48, Pitch::down12deg },
-            { { 16, -3, -8 }, 48, Pitch::down12deg },
-            { { 16, -4, -8 }, 48, Pitch::down12deg },
-            { { 16, -5, -9 }, 48, Pitch::down12deg },
-            { { 16, -6, -9 }, 48, Pitch::down12deg },
-            { { 16, -7, -9 }, 48, Pitch::down12deg },
-            { { 16, -8, -9 }, 48, Pitch::down12deg },
-            { { 16, -9, -10 }, 48, Pitch::down12deg },
-            { { 16, -10, -10 }, 48, Pitch::down12deg },
-            { { 16, -11, -10 }, 48, Pitch::down12deg },
-            { { 16, -12, -10 }, 48, Pitch::down12deg },
-            { { 16, -13, -11 }, 48, Pitch::down12deg },
-            { { 16, -14, -11 }, 48, Pitch::down12deg },
-            { { 16, -15, -11 }, 48, Pitch::down12deg },
-            { { 16, -16, -11 }, 48, Pitch::down12deg },
-            { { 16, -17, -12 }, 48, Pitch::down12deg },
-            { { 16, -18, -12 }, 48, Pitch::down12deg },
-            { { 16, -19, -12 }, 48, Pitch::down12deg },
-            { { 16, -20, -12 }, 48, Pitch::down12deg },
-            { { 16, -21, -13 }, 48, Pitch::down12deg },
-            { { 16, -22, -13 }, 48, Pitch::down12deg },
-            { { 16, -23, -13 }, 48, Pitch::down12deg },
-            { { 16, -24, -13 }, 48, Pitch::down12deg },
-            { { 16, -25, -14 }, 48, Pitch::down12deg },
-            { { 16, -26, -14 }, 48, Pitch::down12deg },
-            { { 16, -27, -14 }, 48, Pitch::down12deg },
-            { { 16, -28, -14 }, 48, Pitch::down12deg },
-            { { 16, -29, -15 }, 48, Pitch::down12deg },
-            { { 16, -30, -15 }, 48, Pitch::down12deg },
-            { { 16, -31, -15 }, 48, Pitch::down12deg },
-            { { 16, -32, -15 }, 48, Pitch::down12deg },
-        });
-
-    // 0x4db136
-    // Track 14. Reversed 1. Direction 2
-    static constexpr auto moveInfoT14R1D2 = std::to_array<MoveInfo>(
-        {
-            { { 31, 16, 0 }, 0, Pitch::down12deg },
-            { { 30, 16, 0 }, 0, Pitch::down12deg },
-            { { 29, 16, 0 }, 0, Pitch::down12deg },
-            { { 28, 16, 0 }, 0, Pitch::down12deg },
-            { { 27, 16, -1 }, 0, Pitch::down12deg },
-            { { 26, 16, -1 }, 0, Pitch::down12deg },
-            { { 25, 16, -1 }, 0, Pitch::down12deg },
-            { { 24, 16, -1 }, 0, Pitch::down12deg },
-            { { 23, 16, -2 }, 0, Pitch::down12deg },
-            { { 22, 16, -2 }, 0, Pitch::down12deg },
-            { { 21, 16, -2 }, 0, Pitch::down12deg },
-            { { 20, 16, -2 }, 0, Pitch::down12deg },
-            { { 19, 16, -3 }, 0, Pitch::down12deg },
-            { { 18, 16, -3 }, 0, Pitch::down12deg },
-            { { 17, 16, -3 }, 0, Pitch::down12deg },
-            { { 16, 16, -3 }, 0, Pitch::down12deg },
-            { { 15, 16, -4 }, 0, Pitch::down12deg },
-            { { 14, 16, -4 }, 0, Pitch::down12deg },
-            { { 13, 16, -4 }, 0, Pitch::down12deg },
-            { { 12, 16, -4 }, 0, Pitch::down12deg },
-            { { 11, 16, -5 }, 0, Pitch::down12deg },
-            { { 10, 16, -5 }, 0, Pitch::down12deg },
-            { { 9, 16, -5 }, 0, Pitch::down12deg },
-            { { 8, 16, -5 }, 0, Pitch::down12deg },
-            { { 7, 16, -6 }, 0, Pitch::down12deg },
-            { { 6, 16, -6 }, 0, Pitch::down12deg },
-            { { 5, 16, -6 }, 0, Pitch::down12deg },
-            { { 4, 16, -6 }, 0, Pitch::down12deg },
-            { { 3, 16, -7 }, 0, Pitch::down12deg },
-            { { 2, 16, -7 }, 0, Pitch::down12deg },
-            { { 1, 16, -7 }, 0, Pitch::down12deg },
-            { { 0, 16, -7 }, 0, Pitch::down12deg },
-            { { -1, 16, -8 }, 0, Pitch::down12deg },
-            { { -2, 16, -8 }, 0, Pitch::down12deg },
-            { { -3, 16, -8 }, 0, Pitch::down12deg },
-            { { -4, 16, -8 }, 0, Pitch::down12deg },
-            { { -5, 16, -9 }, 0, Pitch::down12deg },
-            { { -6, 16, -9 }, 0, Pitch::down12deg },
-            { { -7, 16, -9 }, 0, Pitch::down12deg },
-            { { -8, 16, -9 }, 0, Pitch::down12deg },
-            { { -9, 16, -10 }, 0, Pitch::down12deg },
-            { { -10, 16, -10 }, 0, Pitch::down12deg },
-            { { -11, 16, -10 }, 0, Pitch::down12deg },
-            { { -12, 16, -10 }, 0, Pitch::down12deg },
-            { { -13, 16, -11 }, 0, Pitch::down12deg },
-            { { -14, 16, -11 }, 0, Pitch::down12deg },
-            { { -15, 16, -11 }, 0, Pitch::down12deg },
-            { { -16, 16, -11 }, 0, Pitch::down12deg },
-            { { -17, 16, -12 }, 0, Pitch::down12deg },
-            { { -18, 16, -12 }, 0, Pitch::down12deg },
-            { { -19, 16, -12 }, 0, Pitch::down12deg },
-            { { -20, 16, -12 }, 0, Pitch::down12deg },
-            { { -21, 16, -13 }, 0, Pitch::down12deg },
-            { { -22, 16, -13 }, 0, Pitch::down12deg },
-            { { -23, 16, -13 }, 0, Pitch::down12deg },
-            { { -24, 16, -13 }, 0, Pitch::down12deg },
-            { { -25, 16, -14 }, 0, Pitch::down12deg },
-            { { -26, 16, -14 }, 0, Pitch::down12deg },
-            { { -27, 16, -14 }, 0, Pitch::down12deg },
-            { { -28, 16, -14 }, 0, Pitch::down12deg },
-            { { -29, 16, -15 }, 0, Pitch::down12deg },
-            { { -30, 16, -15 }, 0, Pitch::down12deg },
-            { { -31, 16, -15 }, 0, Pitch::down12deg },
-            { { -32, 16, -15 }, 0, Pitch::down12deg },
-        });
-
-    // 0x4db338
-    // Track 14. Reversed 1. Direction 3
-    static constexpr auto moveInfoT14R1D3 = std::to_array<MoveInfo>(
-        {
-            { { 16, 0, 0 }, 16, Pitch::down12deg },
-            { { 16, 1, 0 }, 16, Pitch::down12deg },
-            { { 16, 2, 0 }, 16, Pitch::down12deg },
-            { { 16, 3, 0 }, 16, Pitch::down12deg },
-            { { 16, 4, -1 }, 16, Pitch::down12deg },
-            { { 16, 5, -1 }, 16, Pitch::down12deg },
-            { { 16, 6, -1 }, 16, Pitch::down12deg },
-            { { 16, 7, -1 }, 16, Pitch::down12deg },
-            { { 16, 8, -2 }, 16, Pitch::down12deg },
-            { { 16, 9, -2 }, 16, Pitch::down12deg },
-            { { 16, 10, -2 }, 16, Pitch::down12deg },
-            { { 16, 11, -2 }, 16, Pitch::down12deg },
-            { { 16, 12, -3 }, 16, Pitch::down12deg },
-            { { 16, 13, -3 }, 16, Pitch::down12deg },
-            { { 16, 14, -3 }, 16, Pitch::down12deg },
-            { { 16, 15, -3 }, 16, Pitch::down12deg },
-            { { 16, 16, -4 }, 16, Pitch::down12deg },
-            { { 16, 17, -4 }, 16, Pitch::down12deg },
-            { { 16, 18, -4 }, 16, Pitch::down12deg },
-            { { 16, 19, -4 }, 16, Pitch::down12deg },
-            { { 16, 20, -5 }, 16, Pitch::down12deg },
-            { { 16, 21, -5 }, 16, Pitch::down12deg },
-            { { 16, 22, -5 }, 16, Pitch::down12deg },
-            { { 16, 23, -5 }, 16, Pitch::down12deg },
-            { { 16, 24, -6 }, 16, Pitch::down12deg },
-            { { 16, 25, -6 }, 16, Pitch::down12deg },
-            { { 16, 26, -6 }, 16, Pitch::down12deg },
-            { { 16, 27, -6 }, 16, Pitch::down12deg },
-            { { 16, 28, -7 }, 16, Pitch::down12deg },
-            { { 16, 29, -7 }, 16, Pitch::down12deg },
-            { { 16, 30, -7 }, 16, Pitch::down12deg },
-            { { 16, 31, -7 }, 16, Pitch::down12deg },
-            { { 16, 32, -8 }, 16, Pitch::down12deg },
-            { { 16, 33, -8 }, 16, Pitch::down12deg },
-            { { 16, 34, -8 }, 16, Pitch::down12deg },
-            { { 16, 35, -8 }, 16, Pitch::down12deg },
-            { { 16, 36, -9 }, 16, Pitch::down12deg },
-            { { 16, 37, -9 }, 16, Pitch::down12deg },
-            { { 16, 38, -9 }, 16, Pitch::down12deg },
-            { { 16, 39, -9 }, 16, Pitch::down12deg },
-            { { 16, 40, -10 }, 16, Pitch::down12deg },
-            { { 16, 41, -10 }, 16, Pitch::down12deg },
-            { { 16, 42, -10 }, 16, Pitch::down12deg },
-            { { 16, 43, -10 }, 16, Pitch::down12deg },
-            { { 16, 44, -11 }, 16, Pitch::down12deg },
-            { { 16, 45, -11 }, 16, Pitch::down12deg },
-            { { 16, 46, -11 }, 16, Pitch::down12deg },
-            { { 16, 47, -11 }, 16, Pitch::down12deg },
-            { { 16, 48, -12 }, 16, Pitch::down12deg },
-            { { 16, 49, -12 }, 16, Pitch::down12deg },
-            { { 16, 50, -12 }, 16, Pitch::down12deg },
-            { { 16, 51, -12 }, 16, Pitch::down12deg },
-            { { 16, 52, -13 }, 16, Pitch::down12deg },
-            { { 16, 53, -13 }, 16, Pitch::down12deg },
-            { { 16, 54, -13 }, 16, Pitch::down12deg },
-            { { 16, 55, -13 }, 16, Pitch::down12deg },
-            { { 16, 56, -14 }, 16, Pitch::down12deg },
-            { { 16, 57, -14 }, 16, Pitch::down12deg },
-            { { 16, 58, -14 }, 16, Pitch::down12deg },
-            { { 16, 59, -14 }, 16, Pitch::down12deg },
-            { { 16, 60, -15 }, 16, Pitch::down12deg },
-            { { 16, 61, -15 }, 16, Pitch::down12deg },
-            { { 16, 62, -15 }, 16, Pitch::down12deg },
-            { { 16, 63, -15 }, 16, Pitch::down12deg },
-        });
-
-    // 0x4db93e
-    // Track 16. Reversed 0. Direction 0
-    static constexpr auto moveInfoT16R0D0 = std::to_array<MoveInfo>(
-        {
-            { { 31, 16, 0 }, 0, Pitch::up25deg },
-            { { 30, 16, 0 }, 0, Pitch::up25deg },
-            { { 29, 16, 1 }, 0, Pitch::up25deg },
-            { { 28, 16, 1 }, 0, Pitch::up25deg },
-            { { 27, 16, 2 }, 0, Pitch::up25deg },
-            { { 26, 16, 2 }, 0, Pitch::up25deg },
-            { { 25, 16, 3 }, 0, Pitch::up25deg },
-            { { 24, 16, 3 }, 0, Pitch::up25deg },
-            { { 23, 16, 4 }, 0, Pitch::up25deg },
-            { { 22, 16, 4 }, 0, Pitch::up25deg },
-            { { 21, 16, 5 }, 0, Pitch::up25deg },
-            { { 20, 16, 5 }, 0, Pitch::up25deg },
-            { { 19, 16, 6 }, 0, Pitch::up25deg },
-            { { 18, 16, 6 }, 0, Pitch::up25deg },
-            { { 17, 16, 7 }, 0, Pitch::up25deg },
-            { { 16, 16, 7 }, 0, Pitch::up25deg },
-            { { 15, 16, 8 }, 0, Pitch::up25deg },
-            { { 14, 16, 8 }, 0, Pitch::up25deg },
-            { { 13, 16, 9 }, 0, Pitch::up25deg },
-            { { 12, 16, 9 }, 0, Pitch::up25deg },
-            { { 11, 16, 10 }, 0, Pitch::up25deg },
-            { { 10, 16, 10 }, 0, Pitch::up25deg },
-            { { 9, 16, 11 }, 0, Pitch::up25deg },
-            { { 8, 16, 11 }, 0, Pitch::up25deg },
-            { { 7, 16, 12 }, 0, Pitch::up25deg },
-            { { 6, 16, 12 }, 0, Pitch::up25deg },
-            { { 5, 16, 13 }, 0, Pitch::up25deg },
-            { { 4, 16, 13 }, 0, Pitch::up25deg },
-            { { 3, 16, 14 }, 0, Pitch::up25deg },
-            { { 2, 16, 14 }, 0, Pitch::up25deg },
-            { { 1, 16, 15 }, 0, Pitch::up25deg },
-            { { 0, 16, 15 }, 0, Pitch::up25deg },
-        });
-
-    // 0x4dba40
-    // Track 16. Reversed 0. Direction 1
-    static constexpr auto moveInfoT16R0D1 = std::to_array<MoveInfo>(
-        {
-            { { 16, 0, 0 }, 16, Pitch::up25deg },
-            { { 16, 1, 0 }, 16, Pitch::up25deg },
-            { { 16, 2, 1 }, 16, Pitch::up25deg },
-            { { 16, 3, 1 }, 16, Pitch::up25deg },
-            { { 16, 4, 2 }, 16, Pitch::up25deg },
-            { { 16, 5, 2 }, 16, Pitch::up25deg },
-            { { 16, 6, 3 }, 16, Pitch::up25deg },
-            { { 16, 7, 3 }, 16, Pitch::up25deg },
-            { { 16, 8, 4 }, 16, Pitch::up25deg },
-            { { 16, 9, 4 }, 16, Pitch::up25deg },
-            { { 16, 10, 5 }, 16, Pitch::up25deg },
-            { { 16, 11, 5 }, 16, Pitch::up25deg },
-            { { 16, 12, 6 }, 16, Pitch::up25deg },
-            { { 16, 13, 6 }, 16, Pitch::up25deg },
-            { { 16, 14, 7 }, 16, Pitch::up25deg },
-            { { 16, 15, 7 }, 16, Pitch::up25deg },
-            { { 16, 16, 8 }, 16, Pitch::up25deg },
-            { { 16, 17, 8 }, 16, Pitch::up25deg },
-            { { 16, 18, 9 }, 16, Pitch::up25deg },
-            { { 16, 19, 9 }, 16, Pitch::up25deg },
-            { { 16, 20, 10 }, 16, Pitch::up25deg },
-            { { 16, 21, 10 }, 16, Pitch::up25deg },
-            { { 16, 22, 11 }, 16, Pitch::up25deg },
-            { { 16, 23, 11 }, 16, Pitch::up25deg },
-            { { 16, 24, 12 }, 16, Pitch::up25deg },
-            { { 16, 25, 12 }, 16, Pitch::up25deg },
-            { { 16, 26, 13 }, 16, Pitch::up25deg },
-            { { 16, 27, 13 }, 16, Pitch::up25deg },
-            { { 16, 28, 14 }, 16, Pitch::up25deg },
-            { { 16, 29, 14 }, 16, Pitch::up25deg },
-            { { 16, 30, 15 }, 16, Pitch::up25deg },
-            { { 16, 31, 15 }, 16, Pitch::up25deg },
-        });
-
-    // 0x4dbb42
-    // Track 16. Reversed 0. Direction 2
-    static constexpr auto moveInfoT16R0D2 = std::to_array<MoveInfo>(
-        {
-            { { 0, 16, 0 }, 32, Pitch::up25deg },
-            { { 1, 16, 0 }, 32, Pitch::up25deg },
-            { { 2, 16, 1 }, 32, Pitch::up25deg },
-            { { 3, 16, 1 }, 32, Pitch::up25deg },
-            { { 4, 16, 2 }, 32, Pitch::up25deg },
-            { { 5, 16, 2 }, 32, Pitch::up25deg },
-            { { 6, 16, 3 }, 32, Pitch::up25deg },
-            { { 7, 16, 3 }, 32, Pitch::up25deg },
-            { { 8, 16, 4 }, 32, Pitch::up25deg },
-            { { 9, 16, 4 }, 32, Pitch::up25deg },
-            { { 10, 16, 5 }, 32, Pitch::up25deg },
-            { { 11, 16, 5 }, 32, Pitch::up25deg },
-            { { 12, 16, 6 }, 32, Pitch::up25deg },
-            { { 13, 16, 6 }, 32, Pitch::up25deg },
-            { { 14, 16, 7 }, 32, Pitch::up25deg },
-            { { 15, 16, 7 }, 32, Pitch::up25deg },
-            { { 16, 16, 8 }, 32, Pitch::up25deg },
-            { { 17, 16, 8 }, 32, Pitch::up25deg },
-            { { 18, 16, 9 }, 32, Pitch::up25deg },
-            { { 19, 16, 9 }, 32, Pitch::up25deg },
-            { { 20, 16, 10 }, 32, Pitch::up25deg },
-            { { 21, 16, 10 }, 32, Pitch::up25deg },
-            { { 22, 16, 11 }, 32, Pitch::up25deg },
-            { { 23, 16, 11 }, 32, Pitch::up25deg },
-            { { 24, 16, 12 }, 32, Pitch::up25deg },
-            { { 25, 16, 12 }, 32, Pitch::up25deg },
-            { { 26, 16, 13 }, 32, Pitch::up25deg },
-            { { 27, 16, 13 }, 32, Pitch::up25deg },
-            { { 28, 16, 14 }, 32, Pitch::up25deg },
-            { { 29, 16, 14 }, 32, Pitch::up25deg },
-            { { 30, 16, 15 }, 32, Pitch::up25deg },
-            { { 31, 16, 15 }, 32, Pitch::up25deg },
-        });
-
-    // 0x4dbc44
-    // Track 16. Reversed 0. Direction 3
-    static constexpr auto moveInfoT16R0D3 = std::to_array<MoveInfo>(
-        {
-            { { 16, 31, 0 }, 48, Pitch::up25deg },
-            { { 16, 30, 0 }, 48, Pitch::up25deg },
-            { { 16, 29, 1 }, 48, Pitch::up25deg },
-            { { 16, 28, 1 }, 48, Pitch::up25deg },
-            { { 16, 27, 2 }, 48, Pitch::up25deg },
-            { { 16, 26, 2 }, 48, Pitch::up25deg },
-            { { 16, 25, 3 }, 48, Pitch::up25deg },
-            { { 16, 24, 3 }, 48, Pitch::up25deg },
-            { { 16, 23, 4 }, 48, Pitch::up25deg },
-            { { 16, 22, 4 }, 48, Pitch::up25deg },
-            { { 16, 21, 5 }, 48, Pitch::up25deg },
-            { { 16, 20, 5 }, 48, Pitch::up25deg },
-            { { 16, 19, 6 }, 48, Pitch::up25deg },
-            { { 16, 18, 6 }, 48, Pitch::up25deg },
-            { { 16, 17, 7 }, 48, Pitch::up25deg },
-            { { 16, 16, 7 }, 48, Pitch::up25deg },
-            { { 16, 15, 8 }, 48, Pitch::up25deg },
-            { { 16, 14, 8 }, 48, Pitch::up25deg },
-            { { 16, 13, 9 }, 48, Pitch::up25deg },
-            { { 16, 12, 9 }, 48, Pitch::up25deg },
-            { { 16, 11, 10 }, 48, Pitch::up25deg },
-            { { 16, 10, 10 }, 48, Pitch::up25deg },
-            { { 16, 9, 11 }, 48, Pitch::up25deg },
-            { { 16, 8, 11 }, 48, Pitch::up25deg },
-            { { 16, 7, 12 }, 48, Pitch::up25deg },
-            { { 16, 6, 12 }, 48, Pitch::up25deg },
-            { { 16, 5, 13 }, 48, Pitch::up25deg },
-            { { 16, 4, 13 }, 48, Pitch::up25deg },
-            { { 16, 3, 14 }, 48, Pitch::up25deg },
-            { { 16, 2, 14 }, 48, Pitch::up25deg },
-            { { 16, 1, 15 }, 48, Pitch::up25deg },
-            { { 16, 0, 15 }, 48, Pitch::up25deg },
-        });
-
-    // 0x4dbf4a
-    // Track 16. Reversed 1. Direction 0
-    static constexpr auto moveInfoT16R1D0 = std::to_array<MoveInfo>(
-        {
-            { { 0, 16, 0 }, 32, Pitch::down25deg },
-            { { 1, 16, 0 }, 32, Pitch::down25deg },
-            { { 2, 16, -1 }, 32, Pitch::down25deg },
-            { { 3, 16, -1 }, 32, Pitch::down25deg },
-            { { 4, 16, -2 }, 32, Pitch::down25deg },
-            { { 5, 16, -2 }, 32, Pitch::down25deg },
-            { { 6, 16, -3 }, 32, Pitch::down25deg },
-            { { 7, 16, -3 }, 32, Pitch::down25deg },
-            { { 8, 16, -4 }, 32, Pitch::down25deg },
-            { { 9, 16, -4 }, 32, Pitch::down25deg },
-            { { 10, 16, -5 }, 32, Pitch::down25deg },
-            { { 11, 16, -5 }, 32, Pitch::down25deg },
-            { { 12, 16, -6 }, 32, Pitch::down25deg },
-            { { 13, 16, -6 }, 32, Pitch::down25deg },
-            { { 14, 16, -7 }, 32, Pitch::down25deg },
-            { { 15, 16, -7 }, 32, Pitch::down25deg },
-            { { 16, 16, -8 }, 32, Pitch::down25deg },
-            { { 17, 16, -8 }, 32, Pitch::down25deg },
-            { { 18, 16, -9 }, 32, Pitch::down25deg },
-            { { 19, 16, -9 }, 32, Pitch::down25deg },
-            { { 20, 16, -10 }, 32, Pitch::down25deg },
-            { { 21, 16, -10 }, 32, Pitch::down25deg },
-            { { 22, 16, -11 }, 32, Pitch::down25deg },
-            { { 23, 16, -11 }, 32, Pitch::down25deg },
-            { { 24, 16, -12 }, 32, Pitch::down25deg },
-            { { 25, 16, -12 }, 32, Pitch::down25deg },
-            { { 26, 16, -13 }, 32, Pitch::down25deg },
-            { { 27, 16, -13 }, 32, Pitch::down25deg },
-            { { 28, 16, -14 }, 32, Pitch::down25deg },
-            { { 29, 16, -14 }, 32, Pitch::down25deg },
-            { { 30, 16, -15 }, 32, Pitch::down25deg },
-            { { 31, 16, -15 }, 32, Pitch::down25deg },
-        });
-
-    // 0x4dc04c
-    // Track 16. Reversed 1. Direction 1
-    static constexpr auto moveInfoT16R1D1 = std::to_array<MoveInfo>(
-        {
-            { { 16, 31, 0 }, 48, Pitch::down25deg },
-            { { 16, 30, 0 }, 48, Pitch::down25deg },
-            { { 16, 29, -1 }, 48, Pitch::down25deg },
-            { { 16, 28, -1 }, 48, Pitch::down25deg },
-            { { 16, 27, -2 }, 48, Pitch::down25deg },
-            { { 16, 26, -2 }, 48, Pitch::down25deg },
-            { { 16, 25, -3 }, 48, Pitch::down25deg },
-            { { 16, 24, -3 }, 48, Pitch::down25deg },
-            { { 16, 23, -4 }, 48, Pitch::down25deg },
-            { { 16, 22, -4 }, 48, Pitch::down25deg },
-            { { 16, 21, -5 }, 48, Pitch::down25deg },
-            { { 16, 20, -5 }, 48, Pitch::down25deg },
-            { { 16, 19, -6 }, 48, Pitch::down25deg },
-            { { 16, 18, -6 }, 48, Pitch::down25deg },
-            { { 16, 17, -7 }, 48, Pitch::down25deg },
-            { { 16, 16, -7 }, 48, Pitch::down25deg },
-            { { 16, 15, -8 }, 48, Pitch::down25deg },
-            { { 16, 14, -8 }, 48, Pitch::down25deg },
-            { { 16, 13, -9 }, 48, Pitch::down25deg },
-            { { 16, 12, -9 }, 48, Pitch::down25deg },
-            { { 16, 11, -10 }, 48, Pitch::down25deg },
-            { { 16, 10, -10 }, 48, Pitch::down25deg },
-            { { 16, 9, -11 }, 48, Pitch::down25deg },
-            { { 16, 8, -11 }, 48, Pitch::down25deg },
-            { { 16, 7, -12 }, 48, Pitch::down25deg },
-            { { 16, 6, -12 }, 48, Pitch::down25deg },
-            { { 16, 5, -13 }, 48, Pitch::down25deg },
-            { { 16, 4, -13 }, 48, Pitch::down25deg },
-            { { 16, 3, -14 }, 48, Pitch::down25deg },
-            { { 16, 2, -14 }, 48, Pitch::down25deg },
-            { { 16, 1, -15 }, 48, Pitch::down25deg },
-            { { 16, 0, -15 }, 48, Pitch::down25deg },
-        });
-
-    // 0x4dbd46
-    // Track 16. Reversed 1. Direction 2
-    static constexpr auto moveInfoT16R1D2 = std::to_array<MoveInfo>(
-        {
-            { { 31, 16, 0 }, 0, Pitch::down25deg },
-            { { 30, 16, 0 }, 0, Pitch::down25deg },
-            { { 29, 16, -1 }, 0, Pitch::down25deg },
-            { { 28, 16, -1 }, 0, Pitch::down25deg },
-            { { 27, 16, -2 }, 0, Pitch::down25deg },
-            { { 26, 16, -2 }, 0, Pitch::down25deg },
-            { { 25, 16, -3 }, 0, Pitch::down25deg },
-            { { 24, 16, -3 }, 0, Pitch::down25deg },
-            { { 23, 16, -4 }, 0, Pitch::down25deg },
-            { { 22, 16, -4 }, 0, Pitch::down25deg },
-            { { 21, 16, -5 }, 0, Pitch::down25deg },
-            { { 20, 16, -5 }, 0, Pitch::down25deg },
-            { { 19, 16, -6 }, 0, Pitch::down25deg },
-            { { 18, 16, -6 }, 0, Pitch::down25deg },
-            { { 17, 16, -7 }, 0, Pitch::down25deg },
-            { { 16, 16, -7 }, 0, Pitch::down25deg },
-            { { 15, 16, -8 }, 0, Pitch::down25deg },
-            { { 14, 16, -8 }, 0, Pitch::down25deg },
-            { { 13, 16, -9 }, 0, Pitch::down25deg },
-            { { 12, 16, -9 }, 0, Pitch::down25deg },
-            { { 11, 16, -10 }, 0, Pitch::down25deg },
-            { { 10, 16, -10 }, 0, Pitch::down25deg },
-            { { 9, 16, -11 }, 0, Pitch::down25deg },
-            { { 8, 16, -11 }, 0, Pitch::down25deg },
-            { { 7, 16, -12 }, 0, Pitch::down25deg },
-            { { 6, 16, -12 }, 0, Pitch::down25deg },
-            { { 5, 16, -13 }, 0, Pitch::down25deg },
-            { { 4, 16, -13 }, 0, Pitch::down25deg },
-            { { 3, 16, -14 }, 0, Pitch::down25deg },
-            { { 2, 16, -14 }, 0, Pitch::down25deg },
-            { { 1, 16, -15 }, 0, Pitch::down25deg },
-            { { 0, 16, -15 }, 0, Pitch::down25deg },
-        });
-
-    // 0x4dbe48
-    // Track 16. Reversed 1. Direction 3
-    static constexpr auto moveInfoT16R1D3 = std::to_array<MoveInfo>(
-        {
-            { { 16, 0, 0 }, 16, Pitch::down25deg },
-            { { 16, 1, 0 }, 16, Pitch::down25deg },
-            { { 16, 2, -1 }, 16, Pitch::down25deg },
-            { { 16, 3, -1 }, 16, Pitch::down25deg },
-            { { 16, 4, -2 }, 16, Pitch::down25deg },
-            { { 16, 5, -2 }, 16, Pitch::down25deg },
-            { { 16, 6, -3 }, 16, Pitch::down25deg },
-            { { 16, 7, -3 }, 16, Pitch::down25deg },
-            { { 16, 8, -4 }, 16, Pitch::down25deg },
-            { { 16, 9, -4 }, 16, Pitch::down25deg },
-            { { 16, 10, -5 }, 16, Pitch::down25deg },
-            { { 16, 11, -5 }, 16, Pitch::down25deg },
-            { { 16, 12, -6 }, 16, Pitch::down25deg },
-            { { 16, 13, -6 }, 16, Pitch::down25deg },
-            { { 16, 14, -7 }, 16, Pitch::down25deg },
-            { { 16, 15, -7 }, 16, Pitch::down25deg },
-            { { 16, 16, -8 }, 16, Pitch::down25deg },
-            { { 16, 17, -8 }, 16, Pitch::down25deg },
-            { { 16, 18, -9 }, 16, Pitch::down25deg },
-            { { 16, 19, -9 }, 16, Pitch::down25deg },
-            { { 16, 20, -10 }, 16, Pitch::down25deg },
-            { { 16, 21, -10 }, 16, Pitch::down25deg },
-            { { 16, 22, -11 }, 16, Pitch::down25deg },
-            { { 16, 23, -11 }, 16, Pitch::down25deg },
-            { { 16, 24, -12 }, 16, Pitch::down25deg },
-            { { 16, 25, -12 }, 16, Pitch::down25deg },
-            { { 16, 26, -13 }, 16, Pitch::down25deg },
-            { { 16, 27, -13 }, 16, Pitch::down25deg },
-            { { 16, 28, -14 }, 16, Pitch::down25deg },
-            { { 16, 29, -14 }, 16, Pitch::down25deg },
-            { { 16, 30, -15 }, 16, Pitch::down25deg },
-            { { 16, 31, -15 }, 16, Pitch::down25deg },
-        });
-
-    // 0x4e66be
-    // Track 18. Reversed 0. Direction 0
-    static constexpr auto moveInfoT18R0D0 = std::to_array<MoveInfo>(
-        {
-            { { 31, 16, 0 }, 0, Pitch::up10deg },
-            { { 30, 16, 0 }, 0, Pitch::up10deg },
-            { { 29, 16, 0 }, 0, Pitch::up10deg },
-            { { 28, 16, 0 }, 0, Pitch::up10deg },
-            { { 27, 16, 1 }, 62, Pitch::up10deg },
-            { { 26, 16, 1 }, 62, Pitch::up10deg },
-            { { 25, 15, 1 }, 62, Pitch::up10deg },
-            { { 24, 15, 1 }, 62, Pitch::up10deg },
-            { { 23, 15, 1 }, 62, Pitch::up10deg },
-            { { 22, 15, 2 }, 62, Pitch::up10deg },
-            { { 21, 15, 2 }, 62, Pitch::up10deg },
-            { { 20, 15, 2 }, 62, Pitch::up10deg },
-            { { 19, 14, 2 }, 62, Pitch::up10deg },
-            { { 18, 14, 2 }, 60, Pitch::up10deg },
-            { { 17, 14, 3 }, 60, Pitch::up10deg },
-            { { 16, 13, 3 }, 60, Pitch::up10deg },
-            { { 15, 13, 3 }, 60, Pitch::up10deg },
-            { { 14, 13, 3 }, 60, Pitch::up10deg },
-            { { 13, 12, 4 }, 60, Pitch::up10deg },
-            { { 12, 12, 4 }, 60, Pitch::up10deg },
-            { { 11, 11, 4 }, 60, Pitch::up10deg },
-            { { 10, 11, 4 }, 60, Pitch::up10deg },
-            { { 9, 10, 5 }, 58, Pitch::up10deg },
-            { { 8, 10, 5 }, 58, Pitch::up10deg },
-            { { 7, 9, 5 }, 58, Pitch::up10deg },
-            { { 6, 9, 5 }, 58, Pitch::up10deg },
-            { { 5, 8, 5 }, 58, Pitch::up10deg },
-            { { 4, 7, 6 }, 58, Pitch::up10deg },
-            { { 3, 7, 6 }, 58, Pitch::up10deg },
-            { { 2, 6, 6 }, 58, Pitch::up10deg },
-            { { 1, 5, 7 }, 56, Pitch::up10deg },
-            { { 0, 4, 7 }, 56, Pitch::up10deg },
-            { { -1, 3, 7 }, 56, Pitch::up10deg },
-            { { -3, 3, 7 }, 56, Pitch::up10deg },
-            { { -4, 2, 8 }, 56, Pitch::up10deg },
-            { { -5, 1, 8 }, 56, Pitch::up10deg },
-            { { -6, 0, 8 }, 56, Pitch::up10deg },
-            { { -7, -1, 8 }, 54, Pitch::up10deg },
-            { { -7, -2, 9 }, 54, Pitch::up10deg },
-            { { -8, -3, 9 }, 54, Pitch::up10deg },
-            { { -9, -4, 9 }, 54, Pitch::up10deg },
-            { { -9, -5, 9 }, 54, Pitch::up10deg },
-            { { -10, -6, 10 }, 54, Pitch::up10deg },
-            { { -10, -7, 10 }, 54, Pitch::up10deg },
-            { { -11, -8, 10 }, 54, Pitch::up10deg },
-            { { -11, -9, 10 }, 52, Pitch::up10deg },
-            { { -12, -10, 11 }, 52, Pitch::up10deg },
-            { { -12, -11, 11 }, 52, Pitch::up10deg },
-            { { -13, -12, 11 }, 52, Pitch::up10deg },
-            { { -13, -13, 11 }, 52, Pitch::up10deg },
-            { { -13, -14, 12 }, 52, Pitch::up10deg },
-            { { -14, -15, 12 }, 52, Pitch::up10deg },
-            { { -14, -16, 12 }, 52, Pitch::up10deg },
-            { { -14, -17, 12 }, 52, Pitch::up10deg },
-            { { -15, -18, 12 }, 50, Pitch::up10deg },
-            { { -15, -19, 13 }, 50, Pitch::up10deg },
-            { { -15, -20, 13 }, 50, Pitch::up10deg },
-            { { -15, -21, 13 }, 50, Pitch::up10deg },
-            { { -15, -22, 13 }, 50, Pitch::up10deg },
-            { { -15, -23, 14 }, 50, Pitch::up10deg },
-            { { -16, -24, 14 }, 50, Pitch::up10deg },
-            { { -16, -25, 14 }, 50, Pitch::up10deg },
-            { { -16, -26, 14 }, 50, Pitch::up10deg },
-            { { -16, -27, 14 }, 48, Pitch::up10deg },
-            { { -16, -28, 15 }, 48, Pitch::up10deg },
-            { { -16, -29, 15 }, 48, Pitch::up10deg },
-            { { -16, -30, 15 }, 48, Pitch::up10deg },
-            { { -16, -31, 15 }, 48, Pitch::up10deg },
-        });
-
-    // 0x4e68e0
-    // Track 18. Reversed 0. Direction 1
-    static constexpr auto moveInfoT18R0D1 = std::to_array<MoveInfo>(
-        {
-            { { 16, 0, 0 }, 16, Pitch::up10deg },
-            { { 16, 1, 0 }, 16, Pitch::up10deg },
-            { { 16, 2, 0 }, 16, Pitch::up10deg },
-            { { 16, 3, 0 }, 16, Pitch::up10deg },
-            { { 16, 4, 0 }, 16, Pitch::up10deg },
-            { { 16, 5, 1 }, 14, Pitch::up10deg },
-            { { 16, 6, 1 }, 14, Pitch::up10deg },
-            { { 15, 7, 1 }, 14, Pitch::up10deg },
-            { { 15, 8, 1 }, 14, Pitch::up10deg },
-            { { 15, 9, 1 }, 14, Pitch::up10deg },
-            { { 15, 10, 2 }, 14, Pitch::up10deg },
-            { { 15, 11, 2 }, 14, Pitch::up10deg },
-            { { 15, 12, 2 }, 14, Pitch::up10deg },
-            { { 14, 13, 2 }, 14, Pitch::up10deg },
-            { { 14, 14, 2 }, 12, Pitch::up10deg },
-            { { 14, 15, 3 }, 12, Pitch::up10deg },
-            { { 13, 16, 3 }, 12, Pitch::up10deg },
-            { { 13, 17, 3 }, 12, Pitch::up10deg },
-            { { 13, 18, 3 }, 12, Pitch::up10deg },
-            { { 12, 19, 4 }, 12, Pitch::up10deg },
-            { { 12, 20, 4 }, 12, Pitch::up10deg },
-            { { 11, 21, 4 }, 12, Pitch::up10deg },
-            { { 11, 22, 4 }, 12, Pitch::up10deg },
-            { { 10, 23, 5 }, 10, Pitch::up10deg },
-            { { 10, 24, 5 }, 10, Pitch::up10deg },
-            { { 9, 25, 5 }, 10, Pitch::up10deg },
-            { { 9, 26, 5 }, 10, Pitch::up10deg },
-            { { 8, 27, 5 }, 10, Pitch::up10deg },
-            { { 7, 28, 6 }, 10, Pitch::up10deg },
-            { { 7, 29, 6 }, 10, Pitch::up10deg },
-            { { 6, 30, 6 }, 10, Pitch::up10deg },
-            { { 5, 31, 7 }, 8, Pitch::up10deg },
-            { { 4, 32, 7 }, 8, Pitch::up10deg },
-            { { 3, 33, 7 }, 8, Pitch::up10deg },
-            { { 3, 35, 7 }, 8, Pitch::up10deg },
-            { { 2, 36, 8 }, 8, Pitch::up10deg },
-            { { 1, 37, 8 }, 8, Pitch::up10deg },
-            { { 0, 38, 8 }, 8, Pitch::up10deg },
-            { { -1, 39, 8 }, 6, Pitch::up10deg },
-            { { -2, 39, 9 }, 6, Pitch::up10deg },
-            { { -3, 40, 9 }, 6, Pitch::up10deg },
-            { { -4, 41, 9 }, 6, Pitch::up10deg },
-            { { -5, 41, 9 }, 6, Pitch::up10deg },
-            { { -6, 42, 10 }, 6, Pitch::up10deg },
-            { { -7, 42, 10 }, 6, Pitch::up10deg },
-            { { -8, 43, 10 }, 6, Pitch::up10deg },
-            { { -9, 43, 10 }, 4, Pitch::up10deg },
-            { { -10, 44, 11 }, 4, Pitch::up10deg },
-            { { -11, 44, 11 }, 4, Pitch::up10deg },
-            { { -12, 45, 11 }, 4, Pitch::up10deg },
-            { { -13, 45, 11 }, 4, Pitch::up10deg },
-            { { -14, 45, 12 }, 4, Pitch::up10deg },
-            { { -15, 46, 12 }, 4, Pitch::up10deg },
-            { { -16, 46, 12 }, 4, Pitch::up10deg },
-            { { -17, 46, 12 }, 4, Pitch::up10deg },
-            { { -18, 47, 12 }, 2, Pitch::up10deg },
-            { { -19, 47, 13 }, 2, Pitch::up10deg },
-            { { -20, 47, 13 }, 2, Pitch::up10deg },
-            { { -21, 47, 13 }, 2, Pitch::up10deg },
-            { { -22, 47, 13 }, 2, Pitch::up10deg },
-            { { -23, 47, 14 }, 2, Pitch::up10deg },
-            { { -24, 48, 14 }, 2, Pitch::up10deg },
-            { { -25, 48, 14 }, 2, Pitch::up10deg },
-            { { -26, 48, 14 }, 2, Pitch::up10deg },
-            { { -27, 48, 14 }, 0, Pitch::up10deg },
-            { { -28, 48, 15 }, 0, Pitch::up10deg },
-            { { -29, 48, 15 }, 0, Pitch::up10deg },
-            { { -30, 48, 15 }, 0, Pitch::up10deg },
-            { { -31, 48, 15 }, 0, Pitch::up10deg },
-        });
-
-    // 0x4e6b0a
-    // Track 18. Reversed 0. Direction 2
-    static constexpr auto moveInfoT18R0D2 = std::to_array<MoveInfo>(
-        {
-            { { 0, 16, 0 }, 32, Pitch::up10deg },
-            { { 1, 16, 0 }, 32, Pitch::up10deg },
-            { { 2, 16, 0 }, 32, Pitch::up10deg },
-            { { 3, 16, 0 }, 32, Pitch::up10deg },
-            { { 4, 16, 0 }, 32, Pitch::up10deg },
-            { { 5, 16, 1 }, 30, Pitch::up10deg },
-            { { 6, 16, 1 }, 30, Pitch::up10deg },
-            { { 7, 17, 1 }, 30, Pitch::up10deg },
-            { { 8, 17, 1 }, 30, Pitch::up10deg },
-            { { 9, 17, 1 }, 30, Pitch::up10deg },
-            { { 10, 17, 2 }, 30, Pitch::up10deg },
-            { { 11, 17, 2 }, 30, Pitch::up10deg },
-            { { 12, 17, 2 }, 30, Pitch::up10deg },
-            { { 13, 18, 2 }, 30, Pitch::up10deg },
-            { { 14, 18, 3 }, 28, Pitch::up10deg },
-            { { 15, 18, 3 }, 28, Pitch::up10deg },
-            { { 16, 19, 3 }, 28, Pitch::up10deg },
-            { { 17, 19, 3 }, 28, Pitch::up10deg },
-            { { 18, 19, 3 }, 28, Pitch::up10deg },
-            { { 19, 20, 4 }, 28, Pitch::up10deg },
-            { { 20, 20, 4 }, 28, Pitch::up10deg },
-            { { 21, 21, 4 }, 28, Pitch::up10deg },
-            { { 22, 21, 4 }, 28, Pitch::up10deg },
-            { { 23, 22, 5 }, 26, Pitch::up10deg },
-            { { 24, 22, 5 }, 26, Pitch::up10deg },
-            { { 25, 23, 5 }, 26, Pitch::up10deg },
-            { { 26, 23, 5 }, 26, Pitch::up10deg },
-            { { 27, 24, 6 }, 26, Pitch::up10deg },
-            { { 28, 25, 6 }, 26, Pitch::up10deg },
-            { { 29, 25, 6 }, 26, Pitch::up10deg },
-            { { 30, 26, 6 }, 26, Pitch::up10deg },
-            { { 31, 27, 7 }, 24, Pitch::up10deg },
-            { { 32, 28, 7 }, 24, Pitch::up10deg },
-            { { 33, 29, 7 }, 24, Pitch::up10deg },
-            { { 35, 29, 7 }, 24, Pitch::up10deg },
-            { { 36, 30, 8 }, 24, Pitch::up10deg },
-            { { 37, 31, 8 }, 24, Pitch::up10deg },
-            { { 38, 32, 8 }, 24, Pitch::up10deg },
-            { { 39, 33, 9 }, 22, Pitch::up10deg },
-            { { 39, 34, 9 }, 22, Pitch::up10deg },
-            { { 40, 35, 9 }, 22, Pitch::up10deg },
-            { { 41, 36, 9 }, 22, Pitch::up10deg },
-            { { 41, 37, 10 }, 22, Pitch::up10deg },
-            { { 42, 38, 10 }, 22, Pitch::up10deg },
-            { { 42, 39, 10 }, 22, Pitch::up10deg },
-            { { 43, 40, 10 }, 22, Pitch::up10deg },
-            { { 43, 41, 11 }, 20, Pitch::up10deg },
-            { { 44, 42, 11 }, 20, Pitch::up10deg },
-            { { 44, 43, 11 }, 20, Pitch::up10deg },
-            { { 45, 44, 11 }, 20, Pitch::up10deg },
-            { { 45, 45, 12 }, 20, Pitch::up10deg },
-            { { 45, 46, 12 }, 20, Pitch::up10deg },
-            { { 46, 47, 12 }, 20, Pitch::up10deg },
-            { { 46, 48, 12 }, 20, Pitch::up10deg },
-            { { 46, 49, 12 }, 20, Pitch::up10deg },
-            { { 47, 50, 13 }, 18, Pitch::up10deg },
-            { { 47, 51, 13 }, 18, Pitch::up10deg },
-            { { 47, 52, 13 }, 18, Pitch::up10deg },
-            { { 47, 53, 13 }, 18, Pitch::up10deg },
-            { { 47, 54, 14 }, 18, Pitch::up10deg },
-            { { 47, 55, 14 }, 18, Pitch::up10deg },
-            { { 48, 56, 14 }, 18, Pitch::up10deg },
-            { { 48, 57, 14 }, 18, Pitch::up10deg },
-            { { 48, 58, 14 }, 18, Pitch::up10deg },
-            { { 48, 59, 15 }, 16, Pitch::up10deg },
-            { { 48, 60, 15 }, 16, Pitch::up10deg },
-            { { 48, 61, 15 }, 16, Pitch::up10deg },
-            { { 48, 62, 15 }, 16, Pitch::up10deg },
-        });
-
-    // 0x4e6d2c
-    // Track 18. Reversed 0. Direction 3
-    static constexpr auto moveInfoT18R0D3 = std::to_array<MoveInfo>(
-        {
-            { { 16, 31, 0 }, 48, Pitch::up10deg },
-            { { 16, 30, 0 }, 48, Pitch::up10deg },
-            { { 16, 29, 0 }, 48, Pitch::up10deg },
-            { { 16, 28, 0 }, 48, Pitch::up10deg },
-            { { 16, 27, 1 }, 46, Pitch::up10deg },
-            { { 16, 26, 1 }, 46, Pitch::up10deg },
-            { { 17, 25, 1 }, 46, Pitch::up10deg },
-            { { 17, 24, 1 }, 46, Pitch::up10deg },
-            { { 17, 23, 1 }, 46, Pitch::up10deg },
-            { { 17, 22, 2 }, 46, Pitch::up10deg },
-            { { 17, 21, 2 }, 46, Pitch::up10deg },
-            { { 17, 20, 2 }, 46, Pitch::up10deg },
-            { { 18, 19, 2 }, 46, Pitch::up10deg },
-            { { 18, 18, 3 }, 44, Pitch::up10deg },
-            { { 18, 17, 3 }, 44, Pitch::up10deg },
-            { { 19, 16, 3 }, 44, Pitch::up10deg },
-            { { 19, 15, 3 }, 44, Pitch::up10deg },
-            { { 19, 14, 3 }, 44, Pitch::up10deg },
-            { { 20, 13, 4 }, 44, Pitch::up10deg },
-            { { 20, 12, 4 }, 44, Pitch::up10deg },
-            { { 21, 11, 4 }, 44, Pitch::up10deg },
-            { { 21, 10, 4 }, 44, Pitch::up10deg },
-            { { 22, 9, 5 }, 42, Pitch::up10deg },
-            { { 22, 8, 5 }, 42, Pitch::up10deg },
-            { { 23, 7, 5 }, 42, Pitch::up10deg },
-            { { 23, 6, 5 }, 42, Pitch::up10deg },
-            { { 24, 5, 6 }, 42, Pitch::up10deg },
-            { { 25, 4, 6 }, 42, Pitch::up10deg },
-            { { 25, 3, 6 }, 42, Pitch::up10deg },
-            { { 26, 2, 6 }, 42, Pitch::up10deg },
-            { { 27, 1, 7 }, 40, Pitch::up10deg },
-            { { 28, 0, 7 }, 40, Pitch::up10deg },
-            { { 29, -1, 7 }, 40, Pitch::up10deg },
-            { { 29, -3, 7 }, 40, Pitch::up10deg },
-            { { 30, -4, 8 }, 40, Pitch::up10deg },
-            { { 31, -5, 8 }, 40, Pitch::up10deg },
-            { { 32, -6, 8 }, 40, Pitch::up10deg },
-            { { 33, -7, 9 }, 38, Pitch::up10deg },
-            { { 34, -7, 9 }, 38, Pitch::up10deg },
-            { { 35, -8, 9 }, 38, Pitch::up10deg },
-            { { 36, -9, 9 }, 38, Pitch::up10deg },
-            { { 37, -9, 10 }, 38, Pitch::up10deg },
-            { { 38, -10, 10 }, 38, Pitch::up10deg },
-            { { 39, -10, 10 }, 38, Pitch::up10deg },
-            { { 40, -11, 10 }, 38, Pitch::up10deg },
-            { { 41, -11, 11 }, 36, Pitch::up10deg },
-            { { 42, -12, 11 }, 36, Pitch::up10deg },
-            { { 43, -12, 11 }, 36, Pitch::up10deg },
-            { { 44, -13, 11 }, 36, Pitch::up10deg },
-            { { 45, -13, 12 }, 36, Pitch::up10deg },
-            { { 46, -13, 12 }, 36, Pitch::up10deg },
-            { { 47, -14, 12 }, 36, Pitch::up10deg },
-            { { 48, -14, 12 }, 36, Pitch::up10deg },
-            { { 49, -14, 12 }, 36, Pitch::up10deg },
-            { { 50, -15, 13 }, 34, Pitch::up10deg },
-            { { 51, -15, 13 }, 34, Pitch::up10deg },
-            { { 52, -15, 13 }, 34, Pitch::up10deg },
-            { { 53, -15, 13 }, 34, Pitch::up10deg },
-            { { 54, -15, 14 }, 34, Pitch::up10deg },
-            { { 55, -15, 14 }, 34, Pitch::up10deg },
-            { { 56, -16, 14 }, 34, Pitch::up10deg },
-            { { 57, -16, 14 }, 34, Pitch::up10deg },
-            { { 58, -16, 14 }, 34, Pitch::up10deg },
-            { { 59, -16, 15 }, 32, Pitch::up10deg },
-            { { 60, -16, 15 }, 32, Pitch::up10deg },
-            { { 61, -16, 15 }, 32, Pitch::up10deg },
-            { { 62, -16, 15 }, 32, Pitch::up10deg },
-        });
-
-    // 0x4e8270
-    // Track 18. Reversed 1. Direction 0
-    static constexpr auto moveInfoT18R1D0 = std::to_array<MoveInfo>(
-        {
-            { { 16, 0, 0 }, 16, Pitch::down10deg },
-            { { 16, 1, 0 }, 16, Pitch::down10deg },
-            { { 16, 2, 0 }, 16, Pitch::down10deg },
-            { { 16, 3, 0 }, 16, Pitch::down10deg },
-            { { 16, 4, 0 }, 16, Pitch::down10deg },
-            { { 16, 5, -1 }, 18, Pitch::down10deg },
-            { { 16, 6, -1 }, 18, Pitch::down10deg },
-            { { 17, 7, -1 }, 18, Pitch::down10deg },
-            { { 17, 8, -1 }, 18, Pitch::down10deg },
-            { { 17, 9, -1 }, 18, Pitch::down10deg },
-            { { 17, 10, -2 }, 18, Pitch::down10deg },
-            { { 17, 11, -2 }, 18, Pitch::down10deg },
-            { { 17, 12, -2 }, 18, Pitch::down10deg },
-            { { 18, 13, -2 }, 18, Pitch::down10deg },
-            { { 18, 14, -3 }, 20, Pitch::down10deg },
-            { { 18, 15, -3 }, 20, Pitch::down10deg },
-            { { 19, 16, -3 }, 20, Pitch::down10deg },
-            { { 19, 17, -3 }, 20, Pitch::down10deg },
-            { { 19, 18, -3 }, 20, Pitch::down10deg },
-            { { 20, 19, -4 }, 20, Pitch::down10deg },
-            { { 20, 20, -4 }, 20, Pitch::down10deg },
-            { { 21, 21, -4 }, 20, Pitch::down10deg },
-            { { 21, 22, -4 }, 20, Pitch::down10deg },
-            { { 22, 23, -5 }, 22, Pitch::down10deg },
-            { { 22, 24, -5 }, 22, Pitch::down10deg },
-            { { 23, 25, -5 }, 22, Pitch::down10deg },
-            { { 23, 26, -5 }, 22, Pitch::down10deg },
-            { { 24, 27, -6 }, 22, Pitch::down10deg },
-            { { 25, 28, -6 }, 22, Pitch::down10deg },
-            { { 25, 29, -6 }, 22, Pitch::down10deg },
-            { { 26, 30, -6 }, 22, Pitch::down10deg },
-            { { 27, 31, -7 }, 24, Pitch::down10deg },
-            { { 28, 32, -7 }, 24, Pitch::down10deg },
-            { { 29, 33, -7 }, 24, Pitch::down10deg },
-            { { 29, 35, -8 }, 24, Pitch::down10deg },
-            { { 30, 36, -8 }, 24, Pitch::down10deg },
-            { { 31, 37, -8 }, 24, Pitch::down10deg },
-            { { 32, 38, -8 }, 24, Pitch::down10deg },
-            { { 33, 39, -9 }, 26, Pitch::down10deg },
-            { { 34, 39, -9 }, 26, Pitch::down10deg },
-            { { 35, 40, -9 }, 26, Pitch::down10deg },
-            { { 36, 41, -9 }, 26, Pitch::down10deg },
-            { { 37, 41, -10 }, 26, Pitch::down10deg },
-            { { 38, 42, -10 }, 26, Pitch::down10deg },
-            { { 39, 42, -10 }, 26, Pitch::down10deg },
-            { { 40, 43, -10 }, 26, Pitch::down10deg },
-            { { 41, 43, -11 }, 28, Pitch::down10deg },
-            { { 42, 44, -11 }, 28, Pitch::down10deg },
-            { { 43, 44, -11 }, 28, Pitch::down10deg },
-            { { 44, 45, -11 }, 28, Pitch::down10deg },
-            { { 45, 45, -12 }, 28, Pitch::down10deg },
-            { { 46, 45, -12 }, 28, Pitch::down10deg },
-            { { 47, 46, -12 }, 28, Pitch::down10deg },
-            { { 48, 46, -12 }, 28, Pitch::down10deg },
-            { { 49, 46, -12 }, 28, Pitch::down10deg },
-            { { 50, 47, -13 }, 30, Pitch::down10deg },
-            { { 51, 47, -13 }, 30, Pitch::down10deg },
-            { { 52, 47, -13 }, 30, Pitch::down10deg },
-            { { 53, 47, -13 }, 30, Pitch::down10deg },
-            { { 54, 47, -14 }, 30, Pitch::down10deg },
-            { { 55, 47, -14 }, 30, Pitch::down10deg },
-            { { 56, 48, -14 }, 30, Pitch::down10deg },
-            { { 57, 48, -14 }, 30, Pitch::down10deg },
-            { { 58, 48, -14 }, 30, Pitch::down10deg },
-            { { 59, 48, -15 }, 32, Pitch::down10deg },
-            { { 60, 48, -15 }, 32, Pitch::down10deg },
-            { { 61, 48, -15 }, 32, Pitch::down10deg },
-            { { 62, 48, -15 }, 32, Pitch::down10deg },
-        });
-
-    // 0x4e8492
-    // Track 18. Reversed 1. Direction 1
-    static constexpr auto moveInfoT18R1D1 = std::to_array<MoveInfo>(
-        {
-            { { 0, 16, 0 }, 32, Pitch::down10deg },
-            { { 1, 16, 0 }, 32, Pitch::down10deg },
-            { { 2, 16, 0 }, 32, Pitch::down10deg },
-            { { 3, 16, 0 }, 32, Pitch::down10deg },
-            { { 4, 16, 0 }, 32, Pitch::down10deg },
-            { { 5, 16, -1 }, 34, Pitch::down10deg },
-            { { 6, 16, -1 }, 34, Pitch::down10deg },
-            { { 7, 15, -1 }, 34, Pitch::down10deg },
-            { { 8, 15, -1 }, 34, Pitch::down10deg },
-            { { 9, 15, -1 }, 34, Pitch::down10deg },
-            { { 10, 15, -2 }, 34, Pitch::down10deg },
-            { { 11, 15, -2 }, 34, Pitch::down10deg },
-            { { 12, 15, -2 }, 34, Pitch::down10deg },
-            { { 13, 14, -2 }, 34, Pitch::down10deg },
-            { { 14, 14, -2 }, 36, Pitch::down10deg },
-            { { 15, 14, -3 }, 36, Pitch::down10deg },
-            { { 16, 13, -3 }, 36, Pitch::down10deg },
-            { { 17, 13, -3 }, 36, Pitch::down10deg },
-            { { 18, 13, -3 }, 36, Pitch::down10deg },
-            { { 19, 12, -4 }, 36, Pitch::down10deg },
-            { { 20, 12, -4 }, 36, Pitch::down10deg },
-            { { 21, 11, -4 }, 36, Pitch::down10deg },
-            { { 22, 11, -4 }, 36, Pitch::down10deg },
-            { { 23, 10, -5 }, 38, Pitch::down10deg },
-            { { 24, 10, -5 }, 38, Pitch::down10deg },
-            { { 25, 9, -5 }, 38, Pitch::down10deg },
-            { { 26, 9, -5 }, 38, Pitch::down10deg },
-            { { 27, 8, -5 }, 38, Pitch::down10deg },
-            { { 28, 7, -6 }, 38, Pitch::down10deg },
-            { { 29, 7, -6 }, 38, Pitch::down10deg },
-            { { 30, 6, -6 }, 38, Pitch::down10deg },
-            { { 31, 5, -7 }, 40, Pitch::down10deg },
-            { { 32, 4, -7 }, 40, Pitch::down10deg },
-            { { 33, 3, -7 }, 40, Pitch::down10deg },
-            { { 35, 3, -7 }, 40, Pitch::down10deg },
-            { { 36, 2, -8 }, 40, Pitch::down10deg },
-            { { 37, 1, -8 }, 40, Pitch::down10deg },
-            { { 38, 0, -8 }, 40, Pitch::down10deg },
-            { { 39, -1, -8 }, 42, Pitch::down10deg },
-            { { 39, -2, -9 }, 42, Pitch::down10deg },
-            { { 40, -3, -9 }, 42, Pitch::down10deg },
-            { { 41, -4, -9 }, 42, Pitch::down10deg },
-            { { 41, -5, -9 }, 42, Pitch::down10deg },
-            { { 42, -6, -10 }, 42, Pitch::down10deg },
-            { { 42, -7, -10 }, 42, Pitch::down10deg },
-            { { 43, -8, -10 }, 42, Pitch::down10deg },
-            { { 43, -9, -10 }, 44, Pitch::down10deg },
-            { { 44, -10, -11 }, 44, Pitch::down10deg },
-            { { 44, -11, -11 }, 44, Pitch::down10deg },
-            { { 45, -12, -11 }, 44, Pitch::down10deg },
-            { { 45, -13, -11 }, 44, Pitch::down10deg },
-            { { 45, -14, -12 }, 44, Pitch::down10deg },
-            { { 46, -15, -12 }, 44, Pitch::down10deg },
-            { { 46, -16, -12 }, 44, Pitch::down10deg },
-            { { 46, -17, -12 }, 44, Pitch::down10deg },
-            { { 47, -18, -12 }, 46, Pitch::down10deg },
-            { { 47, -19, -13 }, 46, Pitch::down10deg },
-            { { 47, -20, -13 }, 46, Pitch::down10deg },
-            { { 47, -21, -13 }, 46, Pitch::down10deg },
-            { { 47, -22, -13 }, 46, Pitch::down10deg },
-            { { 47, -23, -14 }, 46, Pitch::down10deg },
-            { { 48, -24, -14 }, 46, Pitch::down10deg },
-            { { 48, -25, -14 }, 46, Pitch::down10deg },
-            { { 48, -26, -14 }, 46, Pitch::down10deg },
-            { { 48, -27, -14 }, 48, Pitch::down10deg },
-            { { 48, -28, -15 }, 48, Pitch::down10deg },
-            { { 48, -29, -15 }, 48, Pitch::down10deg },
-            { { 48, -30, -15 }, 48, Pitch::down10deg },
-            { { 48, -31, -15 }, 48, Pitch::down10deg },
-        });
-
-    // 0x4e86bc
-    // Track 18. Reversed 1. Direction 2
-    static constexpr auto moveInfoT18R1D2 = std::to_array<MoveInfo>(
-        {
-            { { 16, 31, 0 }, 48, Pitch::down10deg },
-            { { 16, 30, 0 }, 48, Pitch::down10deg },
-            { { 16, 29, 0 }, 48, Pitch::down10deg },
-            { { 16, 28, 0 }, 48, Pitch::down10deg },
-            { { 16, 27, -1 }, 50, Pitch::down10deg },
-            { { 16, 26, -1 }, 50, Pitch::down10deg },
-            { { 15, 25, -1 }, 50, Pitch::down10deg },
-            { { 15, 24, -1 }, 50, Pitch::down10deg },
-            { { 15, 23, -1 }, 50, Pitch::down10deg },
-            { { 15, 22, -2 }, 50, Pitch::down10deg },
-            { { 15, 21, -2 }, 50, Pitch::down10deg },
-            { { 15, 20, -2 }, 50, Pitch::down10deg },
-            { { 14, 19, -2 }, 50, Pitch::down10deg },
-            { { 14, 18, -2 }, 52, Pitch::down10deg },
-            { { 14, 17, -3 }, 52, Pitch::down10deg },
-            { { 13, 16, -3 }, 52, Pitch::down10deg },
-            { { 13, 15, -3 }, 52, Pitch::down10deg },
-            { { 13, 14, -3 }, 52, Pitch::down10deg },
-            { { 12, 13, -4 }, 52, Pitch::down10deg },
-            { { 12, 12, -4 }, 52, Pitch::down10deg },
-            { { 11, 11, -4 }, 52, Pitch::down10deg },
-            { { 11, 10, -4 }, 52, Pitch::down10deg },
-            { { 10, 9, -5 }, 54, Pitch::down10deg },
-            { { 10, 8, -5 }, 54, Pitch::down10deg },
-            { { 9, 7, -5 }, 54, Pitch::down10deg },
-            { { 9, 6, -5 }, 54, Pitch::down10deg },
-            { { 8, 5, -5 }, 54, Pitch::down10deg },
-            { { 7, 4, -6 }, 54, Pitch::down10deg },
-            { { 7, 3, -6 }, 54, Pitch::down10deg },
-            { { 6, 2, -6 }, 54, Pitch::down10deg },
-            { { 5, 1, -7 }, 56, Pitch::down10deg },
-            { { 4, 0, -7 }, 56, Pitch::down10deg },
-            { { 3, -1, -7 }, 56, Pitch::down10deg },
-            { { 3, -3, -7 }, 56, Pitch::down10deg },
-            { { 2, -4, -8 }, 56, Pitch::down10deg },
-            { { 1, -5, -8 }, 56, Pitch::down10deg },
-            { { 0, -6, -8 }, 56, Pitch::down10deg },
-            { { -1, -7, -8 }, 58, Pitch::down10deg },
-            { { -2, -7, -9 }, 58, Pitch::down10deg },
-            { { -3, -8, -9 }, 58, Pitch::down10deg },
-            { { -4, -9, -9 }, 58, Pitch::down10deg },
-            { { -5, -9, -9 }, 58, Pitch::down10deg },
-            { { -6, -10, -10 }, 58, Pitch::down10deg },
-            { { -7, -10, -10 }, 58, Pitch::down10deg },
-            { { -8, -11, -10 }, 58, Pitch::down10deg },
-            { { -9, -11, -10 }, 60, Pitch::down10deg },
-            { { -10, -12, -11 }, 60, Pitch::down10deg },
-            { { -11, -12, -11 }, 60, Pitch::down10deg },
-            { { -12, -13, -11 }, 60, Pitch::down10deg },
-            { { -13, -13, -11 }, 60, Pitch::down10deg },
-            { { -14, -13, -12 }, 60, Pitch::down10deg },
-            { { -15, -14, -12 }, 60, Pitch::down10deg },
-            { { -16, -14, -12 }, 60, Pitch::down10deg },
-            { { -17, -14, -12 }, 60, Pitch::down10deg },
-            { { -18, -15, -12 }, 62, Pitch::down10deg },
-            { { -19, -15, -13 }, 62, Pitch::down10deg },
-            { { -20, -15, -13 }, 62, Pitch::down10deg },
-            { { -21, -15, -13 }, 62, Pitch::down10deg },
-            { { -22, -15, -13 }, 62, Pitch::down10deg },
-            { { -23, -15, -14 }, 62, Pitch::down10deg },
-            { { -24, -16, -14 }, 62, Pitch::down10deg },
-            { { -25, -16, -14 }, 62, Pitch::down10deg },
-            { { -26, -16, -14 }, 62, Pitch::down10deg },
-            { { -27, -16, -14 }, 0, Pitch::down10deg },
-            { { -28, -16, -15 }, 0, Pitch::down10deg },
-            { { -29, -16, -15 }, 0, Pitch::down10deg },
-            { { -30, -16, -15 }, 0, Pitch::down10deg },
-            { { -31, -16, -15 }, 0, Pitch::down10deg },
-        });
-
-    // 0x4e8056
-    // Track 18. Reversed 1. Direction 3
-    static constexpr auto moveInfoT18R1D3 = std::to_array<MoveInfo>(
-        {
-            { { 31, 16, 0 }, 0, Pitch::down10deg },
-            { { 30, 16, 0 }, 0, Pitch::down10deg },
-            { { 29, 16, 0 }, 0, Pitch::down10deg },
-            { { 28, 16, 0 }, 0, Pitch::down10deg },
-            { { 27, 16, -1 }, 2, Pitch::down10deg },
-            { { 26, 16, -1 }, 2, Pitch::down10deg },
-            { { 25, 17, -1 }, 2, Pitch::down10deg },
-            { { 24, 17, -1 }, 2, Pitch::down10deg },
-            { { 23, 17, -1 }, 2, Pitch::down10deg },
-            { { 22, 17, -2 }, 2, Pitch::down10deg },
-            { { 21, 17, -2 }, 2, Pitch::down10deg },
-            { { 20, 17, -2 }, 2, Pitch::down10deg },
-            { { 19, 18, -2 }, 2, Pitch::down10deg },
-            { { 18, 18, -3 }, 4, Pitch::down10deg },
-            { { 17, 18, -3 }, 4, Pitch::down10deg },
-            { { 16, 19, -3 }, 4, Pitch::down10deg },
-            { { 15, 19, -3 }, 4, Pitch::down10deg },
-            { { 14, 19, -3 }, 4, Pitch::down10deg },
-            { { 13, 20, -4 }, 4, Pitch::down10deg },
-            { { 12, 20, -4 }, 4, Pitch::down10deg },
-            { { 11, 21, -4 }, 4, Pitch::down10deg },
-            { { 10, 21, -4 }, 4, Pitch::down10deg },
-            { { 9, 22, -5 }, 6, Pitch::down10deg },
-            { { 8, 22, -5 }, 6, Pitch::down10deg },
-            { { 7, 23, -5 }, 6, Pitch::down10deg },
-            { { 6, 23, -5 }, 6, Pitch::down10deg },
-            { { 5, 24, -6 }, 6, Pitch::down10deg },
-            { { 4, 25, -6 }, 6, Pitch::down10deg },
-            { { 3, 25, -6 }, 6, Pitch::down10deg },
-            { { 2, 26, -6 }, 6, Pitch::down10deg },
-            { { 1, 27, -7 }, 8, Pitch::down10deg },
-            { { 0, 28, -7 }, 8, Pitch::down10deg },
-            { { -1, 29, -7 }, 8, Pitch::down10deg },
-            { { -3, 29, -8 }, 8, Pitch::down10deg },
-            { { -4, 30, -8 }, 8, Pitch::down10deg },
-            { { -5, 31, -8 }, 8, Pitch::down10deg },
-            { { -6, 32, -8 }, 8, Pitch::down10deg },
-            { { -7, 33, -9 }, 10, Pitch::down10deg },
-            { { -7, 34, -9 }, 10, Pitch::down10deg },
-            { { -8, 35, -9 }, 10, Pitch::down10deg },
-            { { -9, 36, -9 }, 10, Pitch::down10deg },
-            { { -9, 37, -10 }, 10, Pitch::down10deg },
-            { { -10, 38, -10 }, 10, Pitch::down10deg },
-            { { -10, 39, -10 }, 10, Pitch::down10deg },
-            { { -11, 40, -10 }, 10, Pitch::down10deg },
-            { { -11, 41, -11 }, 12, Pitch::down10deg },
-            { { -12, 42, -11 }, 12, Pitch::down10deg },
-            { { -12, 43, -11 }, 12, Pitch::down10deg },
-            { { -13, 44, -11 }, 12, Pitch::down10deg },
-            { { -13, 45, -12 }, 12, Pitch::down10deg },
-            { { -13, 46, -12 }, 12, Pitch::down10deg },
-            { { -14, 47, -12 }, 12, Pitch::down10deg },
-            { { -14, 48, -12 }, 12, Pitch::down10deg },
-            { { -14, 49, -12 }, 12, Pitch::down10deg },
-            { { -15, 50, -13 }, 14, Pitch::down10deg },
-            { { -15, 51, -13 }, 14, Pitch::down10deg },
-            { { -15, 52, -13 }, 14, Pitch::down10deg },
-            { { -15, 53, -13 }, 14, Pitch::down10deg },
-            { { -15, 54, -14 }, 14, Pitch::down10deg },
-            { { -15, 55, -14 }, 14, Pitch::down10deg },
-            { { -16, 56, -14 }, 14, Pitch::down10deg },
-            { { -16, 57, -14 }, 14, Pitch::down10deg },
-            { { -16, 58, -14 }, 14, Pitch::down10deg },
-            { { -16, 59, -15 }, 16, Pitch::down10deg },
-            { { -16, 60, -15 }, 16, Pitch::down10deg },
-            { { -16, 61, -15 }, 16, Pitch::down10deg },
-            { { -16, 62, -15 }, 16, Pitch::down10deg },
-        });
-
-    // 0x4e6f46
-    // Track 19. Reversed 0. Direction 0
-    static constexpr auto moveInfoT19R0D0 = std::to_array<MoveInfo>(
-        {
-            { { 31, 16, 0 }, 0, Pitch::up10deg },
-            { { 30, 16, 0 }, 0, Pitch::up10deg },
-            { { 29, 16, 0 }, 0, Pitch::up10deg },
-            { { 28, 16, 0 }, 0, Pitch::up10deg },
-            { { 27, 16, 1 }, 2, Pitch::up10deg },
-            { { 26, 16, 1 }, 2, Pitch::up10deg },
-            { { 25, 17, 1 }, 2, Pitch::up10deg },
-            { { 24, 17, 1 }, 2, Pitch::up10deg },
-            { { 23, 17, 1 }, 2, Pitch::up10deg },
-            { { 22, 17, 2 }, 2, Pitch::up10deg },
-            { { 21, 17, 2 }, 2, Pitch::up10deg },
-            { { 20, 17, 2 }, 2, Pitch::up10deg },
-            { { 19, 18, 2 }, 2, Pitch::up10deg },
-            { { 18, 18, 3 }, 4, Pitch::up10deg },
-            { { 17, 18, 3 }, 4, Pitch::up10deg },
-            { { 16, 19, 3 }, 4, Pitch::up10deg },
-            { { 15, 19, 3 }, 4, Pitch::up10deg },
-            { { 14, 19, 3 }, 4, Pitch::up10deg },
-            { { 13, 20, 4 }, 4, Pitch::up10deg },
-            { { 12, 20, 4 }, 4, Pitch::up10deg },
-            { { 11, 21, 4 }, 4, Pitch::up10deg },
-            { { 10, 21, 4 }, 4, Pitch::up10deg },
-            { { 9, 22, 5 }, 6, Pitch::up10deg },
-            { { 8, 22, 5 }, 6, Pitch::up10deg },
-            { { 7, 23, 5 }, 6, Pitch::up10deg },
-            { { 6, 23, 5 }, 6, Pitch::up10deg },
-            { { 5, 24, 6 }, 6, Pitch::up10deg },
-            { { 4, 25, 6 }, 6, Pitch::up10deg },
-            { { 3, 25, 6 }, 6, Pitch::up10deg },
-            { { 2, 26, 6 }, 6, Pitch::up10deg },
-            { { 1, 27, 7 }, 8, Pitch::up10deg },
-            { { 0, 28, 7 }, 8, Pitch::up10deg },
-            { { -1, 29, 7 }, 8, Pitch::up10deg },
-            { { -3, 29, 7 }, 8, Pitch::up10deg },
-            { { -4, 30, 8 }, 8, Pitch::up10deg },
-            { { -5, 31, 8 }, 8, Pitch::up10deg },
-            { { -6, 32, 8 }, 8, Pitch::up10deg },
-            { { -7, 33, 9 }, 10, Pitch::up10deg },
-            { { -7, 34, 9 }, 10, Pitch::up10deg },
-            { { -8, 35, 9 }, 10, Pitch::up10deg },
-            { { -9, 36, 9 }, 10, Pitch::up10deg },
-            { { -9, 37, 10 }, 10, Pitch::up10deg },
-            { { -10, 38, 10 }, 10, Pitch::up10deg },
-            { { -10, 39, 10 }, 10, Pitch::up10deg },
-            { { -11, 40, 10 }, 10, Pitch::up10deg },
-            { { -11, 41, 11 }, 12, Pitch::up10deg },
-            { { -12, 42, 11 }, 12, Pitch::up10deg },
-            { { -12, 43, 11 }, 12, Pitch::up10deg },
-            { { -13, 44, 11 }, 12, Pitch::up10deg },
-            { { -13, 45, 12 }, 12, Pitch::up10deg },
-            { { -13, 46, 12 }, 12, Pitch::up10deg },
-            { { -14, 47, 12 }, 12, Pitch::up10deg },
-            { { -14, 48, 12 }, 12, Pitch::up10deg },
-            { { -14, 49, 12 }, 12, Pitch::up10deg },
-            { { -15, 50, 13 }, 14, Pitch::up10deg },
-            { { -15, 51, 13 }, 14, Pitch::up10deg },
-            { { -15, 52, 13 }, 14, Pitch::up10deg },
-            { { -15, 53, 13 }, 14, Pitch::up10deg },
-            { { -15, 54, 14 }, 14, Pitch::up10deg },
-            { { -15, 55, 14 }, 14, Pitch::up10deg },
-            { { -16, 56, 14 }, 14, Pitch::up10deg },
-            { { -16, 57, 14 }, 14, Pitch::up10deg },
-            { { -16, 58, 14 }, 14, Pitch::up10deg },
-            { { -16, 59, 15 }, 16, Pitch::up10deg },
-            { { -16, 60, 15 }, 16, Pitch::up10deg },
-            { { -16, 61, 15 }, 16, Pitch::up10deg },
-            { { -16, 62, 15 }, 16, Pitch::up10deg },
-        });
-
-    // 0x4e7160
-    // Track 19. Reversed 0. Direction 1
-    static constexpr auto moveInfoT19R0D1 = std::to_array<MoveInfo>(
-        {
-            { { 16, 0, 0 }, 16, Pitch::up10deg },
-            { { 16, 1, 0 }, 16, Pitch::up10deg },
-            { { 16, 2, 0 }, 16, Pitch::up10deg },
-            { { 16, 3, 0 }, 16, Pitch::up10deg },
-            { { 16, 4, 0 }, 16, Pitch::up10deg },
-            { { 16, 5, 1 }, 18, Pitch::up10deg },
-            { { 16, 6, 1 }, 18, Pitch::up10deg },
-            { { 17, 7, 1 }, 18, Pitch::up10deg },
-            { { 17, 8, 1 }, 18, Pitch::up10deg },
-            { { 17, 9, 1 }, 18, Pitch::up10deg },
-            { { 17, 10, 2 }, 18, Pitch::up10deg },
-            { { 17, 11, 2 }, 18, Pitch::up10deg },
-            { { 17, 12, 2 }, 18, Pitch::up10deg },
-            { { 18, 13, 2 }, 18, Pitch::up10deg },
-            { { 18, 14, 3 }, 20, Pitch::up10deg },
-            { { 18, 15, 3 }, 20, Pitch::up10deg },
-            { { 19, 16, 3 }, 20, Pitch::up10deg },
-            { { 19, 17, 3 }, 20, Pitch::up10deg },
-            { { 19, 18, 3 }, 20, Pitch::up10deg },
-            { { 20, 19, 4 }, 20, Pitch::up10deg },
-            { { 20, 20, 4 }, 20, Pitch::up10deg },
-            { { 21, 21, 4 }, 20, Pitch::up10deg },
-            { { 21, 22, 4 }, 20, Pitch::up10deg },
-            { { 22, 23, 5 }, 22, Pitch::up10deg },
-            { { 22, 24, 5 }, 22, Pitch::up10deg },
-            { { 23, 25, 5 }, 22, Pitch::up10deg },
-            { { 23, 26, 5 }, 22, Pitch::up10deg },
-            { { 24, 27, 6 }, 22, Pitch::up10deg },
-            { { 25, 28, 6 }, 22, Pitch::up10deg },
-            { { 25, 29, 6 }, 22, Pitch::up10deg },
-            { { 26, 30, 6 }, 22, Pitch::up10deg },
-            { { 27, 31, 7 }, 24, Pitch::up10deg },
-            { { 28, 32, 7 }, 24, Pitch::up10deg },
-            { { 29, 33, 7 }, 24, Pitch::up10deg },
-            { { 29, 35, 7 }, 24, Pitch::up10deg },
-            { { 30, 36, 8 }, 24, Pitch::up10deg },
-            { { 31, 37, 8 }, 24, Pitch::up10deg },
-            { { 32, 38, 8 }, 24, Pitch::up10deg },
-            { { 33, 39, 9 }, 26, Pitch::up10deg },
-            { { 34, 39, 9 }, 26, Pitch::up10deg },
-            { { 35, 40, 9 }, 26, Pitch::up10deg },
-            { { 36, 41, 9 }, 26, Pitch::up10deg },
-            { { 37, 41, 10 }, 26, Pitch::up10deg },
-            { { 38, 42, 10 }, 26, Pitch::up10deg },
-            { { 39, 42, 10 }, 26, Pitch::up10deg },
-            { { 40, 43, 10 }, 26, Pitch::up10deg },
-            { { 41, 43, 11 }, 28, Pitch::up10deg },
-            { { 42, 44, 11 }, 28, Pitch::up10deg },
-            { { 43, 44, 11 }, 28, Pitch::up10deg },
-            { { 44, 45, 11 }, 28, Pitch::up10deg },
-            { { 45, 45, 12 }, 28, Pitch::up10deg },
-            { { 46, 45, 12 }, 28, Pitch::up10deg },
-            { { 47, 46, 12 }, 28, Pitch::up10deg },
-            { { 48, 46, 12 }, 28, Pitch::up10deg },
-            { { 49, 46, 12 }, 28, Pitch::up10deg },
-            { { 50, 47, 13 }, 30, Pitch::up10deg },
-            { { 51, 47, 13 }, 30, Pitch::up10deg },
-            { { 52, 47, 13 }, 30, Pitch::up10deg },
-            { { 53, 47, 13 }, 30, Pitch::up10deg },
-            { { 54, 47, 14 }, 30, Pitch::up10deg },
-            { { 55, 47, 14 }, 30, Pitch::up10deg },
-            { { 56, 48, 14 }, 30, Pitch::up10deg },
-            { { 57, 48, 14 }, 30, Pitch::up10deg },
-            { { 58, 48, 14 }, 30, Pitch::up10deg },
-            { { 59, 48, 15 }, 32, Pitch::up10deg },
-            { { 60, 48, 15 }, 32, Pitch::up10deg },
-            { { 61, 48, 15 }, 32, Pitch::up10deg },
-            { { 62, 48, 15 }, 32, Pitch::up10deg },
-        });
-
-    // 0x4e7382
-    // Track 19. Reversed 0. Direction 2
-    static constexpr auto moveInfoT19R0D2 = std::to_array<MoveInfo>(
-        {
-            { { 0, 16, 0 }, 32, Pitch::up10deg },
-            { { 1, 16, 0 }, 32, Pitch::up10deg },
-            { { 2, 16, 0 }, 32, Pitch::up10deg },
-            { { 3, 16, 0 }, 32, Pitch::up10deg },
-            { { 4, 16, 0 }, 32, Pitch::up10deg },
-            { { 5, 16, 1 }, 34, Pitch::up10deg },
-            { { 6, 16, 1 }, 34, Pitch::up10deg },
-            { { 7, 15, 1 }, 34, Pitch::up10deg },
-            { { 8, 15, 1 }, 34, Pitch::up10deg },
-            { { 9, 15, 1 }, 34, Pitch::up10deg },
-            { { 10, 15, 2 }, 34, Pitch::up10deg },
-            { { 11, 15, 2 }, 34, Pitch::up10deg },
-            { { 12, 15, 2 }, 34, Pitch::up10deg },
-            { { 13, 14, 2 }, 34, Pitch::up10deg },
-            { { 14, 14, 2 }, 36, Pitch::up10deg },
-            { { 15, 14, 3 }, 36, Pitch::up10deg },
-            { { 16, 13, 3 }, 36, Pitch::up10deg },
-            { { 17, 13, 3 }, 36, Pitch::up10deg },
-            { { 18, 13, 3 }, 36, Pitch::up10deg },
-            { { 19, 12, 4 }, 36, Pitch::up10deg },
-            { { 20, 12, 4 }, 36, Pitch::up10deg },
-            { { 21, 11, 4 }, 36, Pitch::up10deg },
-            { { 22, 11, 4 }, 36, Pitch::up10deg },
-            { { 23, 10, 5 }, 38, Pitch::up10deg },
-            { { 24, 10, 5 }, 38, Pitch::up10deg },
-            { { 25, 9, 5 }, 38, Pitch::up10deg },
-            { { 26, 9, 5 }, 38, Pitch::up10deg },
-            { { 27, 8, 5 }, 38, Pitch::up10deg },
-            { { 28, 7, 6 }, 38, Pitch::up10deg },
-            { { 29, 7, 6 }, 38, Pitch::up10deg },
-            { { 30, 6, 6 }, 38, Pitch::up10deg },
-            { { 31, 5, 7 }, 40, Pitch::up10deg },
-            { { 32, 4, 7 }, 40, Pitch::up10deg },
-            { { 33, 3, 7 }, 40, Pitch::up10deg },
-            { { 35, 3, 7 }, 40, Pitch::up10deg },
-            { { 36, 2, 8 }, 40, Pitch::up10deg },
-            { { 37, 1, 8 }, 40, Pitch::up10deg },
-            { { 38, 0, 8 }, 40, Pitch::up10deg },
-            { { 39, -1, 8 }, 42, Pitch::up10deg },
-            { { 39, -2, 9 }, 42, Pitch::up10deg },
-            { { 40, -3, 9 }, 42, Pitch::up10deg },
-            { { 41, -4, 9 }, 42, Pitch::up10deg },
-            { { 41, -5, 9 }, 42, Pitch::up10deg },
-            { { 42, -6, 10 }, 42, Pitch::up10deg },
-            { { 42, -7, 10 }, 42, Pitch::up10deg },
-            { { 43, -8, 10 }, 42, Pitch::up10deg },
-            { { 43, -9, 10 }, 44, Pitch::up10deg },
-            { { 44, -10, 11 }, 44, Pitch::up10deg },
-            { { 44, -11, 11 }, 44, Pitch::up10deg },
-            { { 45, -12, 11 }, 44, Pitch::up10deg },
-            { { 45, -13, 11 }, 44, Pitch::up10deg },
-            { { 45, -14, 12 }, 44, Pitch::up10deg },
-            { { 46, -15, 12 }, 44, Pitch::up10deg },
-            { { 46, -16, 12 }, 44, Pitch::up10deg },
-            { { 46, -17, 12 }, 44, Pitch::up10deg },
-            { { 47, -18, 12 }, 46, Pitch::up10deg },
-            { { 47, -19, 13 }, 46, Pitch::up10deg },
-            { { 47, -20, 13 }, 46, Pitch::up10deg },
-            { { 47, -21, 13 }, 46, Pitch::up10deg },
-            { { 47, -22, 13 }, 46, Pitch::up10deg },
-            { { 47, -23, 14 }, 46, Pitch::up10deg },
-            { { 48, -24, 14 }, 46, Pitch::up10deg },
-            { { 48, -25, 14 }, 46, Pitch::up10deg },
-            { { 48, -26, 14 }, 46, Pitch::up10deg },
-            { { 48, -27, 14 }, 48, Pitch::up10deg },
-            { { 48, -28, 15 }, 48, Pitch::up10deg },
-            { { 48, -29, 15 }, 48, Pitch::up10deg },
-            { { 48, -30, 15 }, 48, Pitch::up10deg },
-            { { 48, -31, 15 }, 48, Pitch::up10deg },
-        });
-
-    // 0x4e75ac
-    // Track 19. Reversed 0. Direction 3
-    static constexpr auto moveInfoT19R0D3 = std::to_array<MoveInfo>(
-        {
-            { { 16, 31, 0 }, 48, Pitch::up10deg },
-            { { 16, 30, 0 }, 48, Pitch::up10deg },
-            { { 16, 29, 0 }, 48, Pitch::up10deg },
-            { { 16, 28, 0 }, 48, Pitch::up10deg },
-            { { 16, 27, 1 }, 50, Pitch::up10deg },
-            { { 16, 26, 1 }, 50, Pitch::up10deg },
-            { { 15, 25, 1 }, 50, Pitch::up10deg },
-            { { 15, 24, 1 }, 50, Pitch::up10deg },
-            { { 15, 23, 1 }, 50, Pitch::up10deg },
-            { { 15, 22, 2 }, 50, Pitch::up10deg },
-            { { 15, 21, 2 }, 50, Pitch::up10deg },
-            { { 15, 20, 2 }, 50, Pitch::up10deg },
-            { { 14, 19, 2 }, 50, Pitch::up10deg },
-            { { 14, 18, 2 }, 52, Pitch::up10deg },
-            { { 14, 17, 3 }, 52, Pitch::up10deg },
-            { { 13, 16, 3 }, 52, Pitch::up10deg },
-            { { 13, 15, 3 }, 52, Pitch::up10deg },
-            { { 13, 14, 3 }, 52, Pitch::up10deg },
-            { { 12, 13, 4 }, 52, Pitch::up10deg },
-            { { 12, 12, 4 }, 52, Pitch::up10deg },
-            { { 11, 11, 4 }, 52, Pitch::up10deg },
-            { { 11, 10, 4 }, 52, Pitch::up10deg },
-            { { 10, 9, 5 }, 54, Pitch::up10deg },
-            { { 10, 8, 5 }, 54, Pitch::up10deg },
-            { { 9, 7, 5 }, 54, Pitch::up10deg },
-            { { 9, 6, 5 }, 54, Pitch::up10deg },
-            { { 8, 5, 5 }, 54, Pitch::up10deg },
-            { { 7, 4, 6 }, 54, Pitch::up10deg },
-            { { 7, 3, 6 }, 54, Pitch::up10deg },
-            { { 6, 2, 6 }, 54, Pitch::up10deg },
-            { { 5, 1, 7 }, 56, Pitch::up10deg },
-            { { 4, 0, 7 }, 56, Pitch::up10deg },
-            { { 3, -1, 7 }, 56, Pitch::up10deg },
-            { { 3, -3, 7 }, 56, Pitch::up10deg },
-            { { 2, -4, 8 }, 56, Pitch::up10deg },
-            { { 1, -5, 8 }, 56, Pitch::up10deg },
-            { { 0, -6, 8 }, 56, Pitch::up10deg },
-            { { -1, -7, 8 }, 58, Pitch::up10deg },
-            { { -2, -7, 9 }, 58, Pitch::up10deg },
-            { { -3, -8, 9 }, 58, Pitch::up10deg },
-            { { -4, -9, 9 }, 58, Pitch::up10deg },
-            { { -5, -9, 9 }, 58, Pitch::up10deg },
-            { { -6, -10, 10 }, 58, Pitch::up10deg },
-            { { -7, -10, 10 }, 58, Pitch::up10deg },
-            { { -8, -11, 10 }, 58, Pitch::up10deg },
-            { { -9, -11, 10 }, 60, Pitch::up10deg },
-            { { -10, -12, 11 }, 60, Pitch::up10deg },
-            { { -11, -12, 11 }, 60, Pitch::up10deg },
-            { { -12, -13, 11 }, 60, Pitch::up10deg },
-            { { -13, -13, 11 }, 60, Pitch::up10deg },
-            { { -14, -13, 12 }, 60, Pitch::up10deg },
-            { { -15, -14, 12 }, 60, Pitch::up10deg },
-            { { -16, -14, 12 }, 60, Pitch::up10deg },
-            { { -17, -14, 12 }, 60, Pitch::up10deg },
-            { { -18, -15, 12 }, 62, Pitch::up10deg },
-            { { -19, -15, 13 }, 62, Pitch::up10deg },
-            { { -20, -15, 13 }, 62, Pitch::up10deg },
-            { { -21, -15, 13 }, 62, Pitch::up10deg },
-            { { -22, -15, 13 }, 62, Pitch::up10deg },
-            { { -23, -15, 14 }, 62, Pitch::up10deg },
-            { { -24, -16, 14 }, 62, Pitch::up10deg },
-            { { -25, -16, 14 }, 62, Pitch::up10deg },
-            { { -26, -16, 14 }, 62, Pitch::up10deg },
-            { { -27, -16, 14 }, 0, Pitch::up10deg },
-            { { -28, -16, 15 }, 0, Pitch::up10deg },
-            { { -29, -16, 15 }, 0, Pitch::up10deg },
-            { { -30, -16, 15 }, 0, Pitch::up10deg },
-            { { -31, -16, 15 }, 0, Pitch::up10deg },
-        });
-
-    // 0x4e7e3c
-    // Track 19. Reversed 1. Direction 0
-    static constexpr auto moveInfoT19R1D0 = std::to_array<MoveInfo>(
-        {
-            { { 16, 31, 0 }, 48, Pitch::down10deg },
-            { { 16, 30, 0 }, 48, Pitch::down10deg },
-            { { 16, 29, 0 }, 48, Pitch::down10deg },
-            { { 16, 28, 0 }, 48, Pitch::down10deg },
-            { { 16, 27, -1 }, 46, Pitch::down10deg },
-            { { 16, 26, -1 }, 46, Pitch::down10deg },
-            { { 17, 25, -1 }, 46, Pitch::down10deg },
-            { { 17, 24, -1 }, 46, Pitch::down10deg },
-            { { 17, 23, -1 }, 46, Pitch::down10deg },
-            { { 17, 22, -2 }, 46, Pitch::down10deg },
-            { { 17, 21, -2 }, 46, Pitch::down10deg },
-            { { 17, 20, -2 }, 46, Pitch::down10deg },
-            { { 18, 19, -2 }, 46, Pitch::down10deg },
-            { { 18, 18, -3 }, 44, Pitch::down10deg },
-            { { 18, 17, -3 }, 44, Pitch::down10deg },
-            { { 19, 16, -3 }, 44, Pitch::down10deg },
-            { { 19, 15, -3 }, 44, Pitch::down10deg },
-            { { 19, 14, -3 }, 44, Pitch::down10deg },
-            { { 20, 13, -4 }, 44, Pitch::down10deg },
-            { { 20, 12, -4 }, 44, Pitch::down10deg },
-            { { 21, 11, -4 }, 44, Pitch::down10deg },
-            { { 21, 10, -4 }, 44, Pitch::down10deg },
-            { { 22, 9, -5 }, 42, Pitch::down10deg },
-            { { 22, 8, -5 }, 42, Pitch::down10deg },
-            { { 23, 7, -5 }, 42, Pitch::down10deg },
-            { { 23, 6, -5 }, 42, Pitch::down10deg },
-            { { 24, 5, -6 }, 42, Pitch::down10deg },
-            { { 25, 4, -6 }, 42, Pitch::down10deg },
-            { { 25, 3, -6 }, 42, Pitch::down10deg },
-            { { 26, 2, -6 }, 42, Pitch::down10deg },
-            { { 27, 1, -7 }, 40, Pitch::down10deg },
-            { { 28, 0, -7 }, 40, Pitch::down10deg },
-            { { 29, -1, -7 }, 40, Pitch::down10deg },
-            { { 29, -3, -8 }, 40, Pitch::down10deg },
-            { { 30, -4, -8 }, 40, Pitch::down10deg },
-            { { 31, -5, -8 }, 40, Pitch::down10deg },
-            { { 32, -6, -8 }, 40, Pitch::down10deg },
-            { { 33, -7, -9 }, 38, Pitch::down10deg },
-            { { 34, -7, -9 }, 38, Pitch::down10deg },
-            { { 35, -8, -9 }, 38, Pitch::down10deg },
-            { { 36, -9, -9 }, 38, Pitch::down10deg },
-            { { 37, -9, -10 }, 38, Pitch::down10deg },
-            { { 38, -10, -10 }, 38, Pitch::down10deg },
-            { { 39, -10, -10 }, 38, Pitch::down10deg },
-            { { 40, -11, -10 }, 38, Pitch::down10deg },
-            { { 41, -11, -11 }, 36, Pitch::down10deg },
-            { { 42, -12, -11 }, 36, Pitch::down10deg },
-            { { 43, -12, -11 }, 36, Pitch::down10deg },
-            { { 44, -13, -11 }, 36, Pitch::down10deg },
-            { { 45, -13, -12 }, 36, Pitch::down10deg },
-            { { 46, -13, -12 }, 36, Pitch::down10deg },
-            { { 47, -14, -12 }, 36, Pitch::down10deg },
-            { { 48, -14, -12 }, 36, Pitch::down10deg },
-            { { 49, -14, -12 }, 36, Pitch::down10deg },
-            { { 50, -15, -13 }, 34, Pitch::down10deg },
-            { { 51, -15, -13 }, 34, Pitch::down10deg },
-            { { 52, -15, -13 }, 34, Pitch::down10deg },
-            { { 53, -15, -13 }, 34, Pitch::down10deg },
-            { { 54, -15, -14 }, 34, Pitch::down10deg },
-            { { 55, -15, -14 }, 34, Pitch::down10deg },
-            { { 56, -16, -14 }, 34, Pitch::down10deg },
-            { { 57, -16, -14 }, 34, Pitch::down10deg },
-            { { 58, -16, -14 }, 34, Pitch::down10deg },
-            { { 59, -16, -15 }, 32, Pitch::down10deg },
-            { { 60, -16, -15 }, 32, Pitch::down10deg },
-            { { 61, -16, -15 }, 32, Pitch::down10deg },
-            { { 62, -16, -15 }, 32, Pitch::down10deg },
-        });
-
-    // 0x4e77ce
-    // Track 19. Reversed 1. Direction 1
-    static constexpr auto moveInfoT19R1D1 = std::to_array<MoveInfo>(
-        {
-            { { 31, 16, 0 }, 0, Pitch::down10deg },
-            { { 30, 16, 0 }, 0, Pitch::down10deg },
-            { { 29, 16, 0 }, 0, Pitch::down10deg },
-            { { 28, 16, 0 }, 0, Pitch::down10deg },
-            { { 27, 16, -1 }, 62, Pitch::down10deg },
-            { { 26, 16, -1 }, 62, Pitch::down10deg },
-            { { 25, 15, -1 }, 62, Pitch::down10deg },
-            { { 24, 15, -1 }, 62, Pitch::down10deg },
-            { { 23, 15, -1 }, 62, Pitch::down10deg },
-            { { 22, 15, -2 }, 62, Pitch::down10deg },
-            { { 21, 15, -2 }, 62, Pitch::down10deg },
-            { { 20, 15, -2 }, 62, Pitch::down10deg },
-            { { 19, 14, -2 }, 62, Pitch::down10deg },
-            { { 18, 14, -2 }, 60, Pitch::down10deg },
-            { { 17, 14, -3 }, 60, Pitch::down10deg },
-            { { 16, 13, -3 }, 60, Pitch::down10deg },
-            { { 15, 13, -3 }, 60, Pitch::down10deg },
-            { { 14, 13, -3 }, 60, Pitch::down10deg },
-            { { 13, 12, -4 }, 60, Pitch::down10deg },
-            { { 12, 12, -4 }, 60, Pitch::down10deg },
-            { { 11, 11, -4 }, 60, Pitch::down10deg },
-            { { 10, 11, -4 }, 60, Pitch::down10deg },
-            { { 9, 10, -5 }, 58, Pitch::down10deg },
-            { { 8, 10, -5 }, 58, Pitch::down10deg },
-            { { 7, 9, -5 }, 58, Pitch::down10deg },
-            { { 6, 9, -5 }, 58, Pitch::down10deg },
-            { { 5, 8, -5 }, 58, Pitch::down10deg },
-            { { 4, 7, -6 }, 58, Pitch::down10deg },
-            { { 3, 7, -6 }, 58, Pitch::down10deg },
-            { { 2, 6, -6 }, 58, Pitch::down10deg },
-            { { 1, 5, -7 }, 56, Pitch::down10deg },
-            { { 0, 4, -7 }, 56, Pitch::down10deg },
-            { { -1, 3, -7 }, 56, Pitch::down10deg },
-            { { -3, 3, -7 }, 56, Pitch::down10deg },
-            { { -4, 2, -8 }, 56, Pitch::down10deg },
-            { { -5, 1, -8 }, 56, Pitch::down10deg },
-            { { -6, 0, -8 }, 56, Pitch::down10deg },
-            { { -7, -1, -8 }, 54, Pitch::down10deg },
-            { { -7, -2, -9 }, 54, Pitch::down10deg },
-            { { -8, -3, -9 }, 54, Pitch::down10deg },
-            { { -9, -4, -9 }, 54, Pitch::down10deg },
-            { { -9, -5, -10 }, 54, Pitch::down10deg },
-            { { -10, -6, -10 }, 54, Pitch::down10deg },
-            { { -10, -7, -10 }, 54, Pitch::down10deg },
-            { { -11, -8, -10 }, 54, Pitch::down10deg },
-            { { -11, -9, -10 }, 52, Pitch::down10deg },
-            { { -12, -10, -11 }, 52, Pitch::down10deg },
-            { { -12, -11, -11 }, 52, Pitch::down10deg },
-            { { -13, -12, -11 }, 52, Pitch::down10deg },
-            { { -13, -13, -11 }, 52, Pitch::down10deg },
-            { { -13, -14, -12 }, 52, Pitch::down10deg },
-            { { -14, -15, -12 }, 52, Pitch::down10deg },
-            { { -14, -16, -12 }, 52, Pitch::down10deg },
-            { { -14, -17, -12 }, 52, Pitch::down10deg },
-            { { -15, -18, -13 }, 50, Pitch::down10deg },
-            { { -15, -19, -13 }, 50, Pitch::down10deg },
-            { { -15, -20, -13 }, 50, Pitch::down10deg },
-            { { -15, -21, -13 }, 50, Pitch::down10deg },
-            { { -15, -22, -13 }, 50, Pitch::down10deg },
-            { { -15, -23, -14 }, 50, Pitch::down10deg },
-            { { -16, -24, -14 }, 50, Pitch::down10deg },
-            { { -16, -25, -14 }, 50, Pitch::down10deg },
-            { { -16, -26, -14 }, 50, Pitch::down10deg },
-            { { -16, -27, -14 }, 48, Pitch::down10deg },
-            { { -16, -28, -15 }, 48, Pitch::down10deg },
-            { { -16, -29, -15 }, 48, Pitch::down10deg },
-            { { -16, -30, -15 }, 48, Pitch::down10deg },
-            { { -16, -31, -16 }, 48, Pitch::down10deg },
-        });
-
-    // 0x4e79f0
-    // Track 19. Reversed 1. Direction 2
-    static constexpr auto moveInfoT19R1D2 = std::to_array<MoveInfo>(
-        {
-            { { 16, 0, 0 }, 16, Pitch::down10deg },
-            { { 16, 1, 0 }, 16, Pitch::down10deg },
-            { { 16, 2, 0 }, 16, Pitch::down10deg },
-            { { 16, 3, 0 }, 16, Pitch::down10deg },
-            { { 16, 4, 0 }, 16, Pitch::down10deg },
-            { { 16, 5, -1 }, 14, Pitch::down10deg },
-            { { 16, 6, -1 }, 14, Pitch::down10deg },
-            { { 15, 7, -1 }, 14, Pitch::down10deg },
-            { { 15, 8, -1 }, 14, Pitch::down10deg },
-            { { 15, 9, -1 }, 14, Pitch::down10deg },
-            { { 15, 10, -2 }, 14, Pitch::down10deg },
-            { { 15, 11, -2 }, 14, Pitch::down10deg },
-            { { 15, 12, -2 }, 14, Pitch::down10deg },
-            { { 14, 13, -2 }, 14, Pitch::down10deg },
-            { { 14, 14, -2 }, 12, Pitch::down10deg },
-            { { 14, 15, -3 }, 12, Pitch::down10deg },
-            { { 13, 16, -3 }, 12, Pitch::down10deg },
-            { { 13, 17, -3 }, 12, Pitch::down10deg },
-            { { 13, 18, -3 }, 12, Pitch::down10deg },
-            { { 12, 19, -4 }, 12, Pitch::down10deg },
-            { { 12, 20, -4 }, 12, Pitch::down10deg },
-            { { 11, 21, -4 }, 12, Pitch::down10deg },
-            { { 11, 22, -4 }, 12, Pitch::down10deg },
-            { { 10, 23, -5 }, 10, Pitch::down10deg },
-            { { 10, 24, -5 }, 10, Pitch::down10deg },
-            { { 9, 25, -5 }, 10, Pitch::down10deg },
-            { { 9, 26, -5 }, 10, Pitch::down10deg },
-            { { 8, 27, -5 }, 10, Pitch::down10deg },
-            { { 7, 28, -6 }, 10, Pitch::down10deg },
-            { { 7, 29, -6 }, 10, Pitch::down10deg },
-            { { 6, 30, -6 }, 10, Pitch::down10deg },
-            { { 5, 31, -7 }, 8, Pitch::down10deg },
-            { { 4, 32, -7 }, 8, Pitch::down10deg },
-            { { 3, 33, -7 }, 8, Pitch::down10deg },
-            { { 3, 35, -7 }, 8, Pitch::down10deg },
-            { { 2, 36, -8 }, 8, Pitch::down10deg },
-            { { 1, 37, -8 }, 8, Pitch::down10deg },
-            { { 0, 38, -8 }, 8, Pitch::down10deg },
-            { { -1, 39, -8 }, 6, Pitch::down10deg },
-            { { -2, 39, -9 }, 6, Pitch::down10deg },
-            { { -3, 40, -9 }, 6, Pitch::down10deg },
-            { { -4, 41, -9 }, 6, Pitch::down10deg },
-            { { -5, 41, -10 }, 6, Pitch::down10deg },
-            { { -6, 42, -10 }, 6, Pitch::down10deg },
-            { { -7, 42, -10 }, 6, Pitch::down10deg },
-            { { -8, 43, -10 }, 6, Pitch::down10deg },
-            { { -9, 43, -10 }, 4, Pitch::down10deg },
-            { { -10, 44, -11 }, 4, Pitch::down10deg },
-            { { -11, 44, -11 }, 4, Pitch::down10deg },
-            { { -12, 45, -11 }, 4, Pitch::down10deg },
-            { { -13, 45, -11 }, 4, Pitch::down10deg },
-            { { -14, 45, -12 }, 4, Pitch::down10deg },
-            { { -15, 46, -12 }, 4, Pitch::down10deg },
-            { { -16, 46, -12 }, 4, Pitch::down10deg },
-            { { -17, 46, -12 }, 4, Pitch::down10deg },
-            { { -18, 47, -13 }, 2, Pitch::down10deg },
-            { { -19, 47, -13 }, 2, Pitch::down10deg },
-            { { -20, 47, -13 }, 2, Pitch::down10deg },
-            { { -21, 47, -13 }, 2, Pitch::down10deg },
-            { { -22, 47, -13 }, 2, Pitch::down10deg },
-            { { -23, 47, -14 }, 2, Pitch::down10deg },
-            { { -24, 48, -14 }, 2, Pitch::down10deg },
-            { { -25, 48, -14 }, 2, Pitch::down10deg },
-            { { -26, 48, -14 }, 2, Pitch::down10deg },
-            { { -27, 48, -14 }, 0, Pitch::down10deg },
-            { { -28, 48, -15 }, 0, Pitch::down10deg },
-            { { -29, 48, -15 }, 0, Pitch::down10deg },
-            { { -30, 48, -15 }, 0, Pitch::down10deg },
-            { { -31, 48, -16 }, 0, Pitch::down10deg },
-        });
-
-    // 0x4e7c1a
-    // Track 19. Reversed 1. Direction 3
-    static constexpr auto moveInfoT19R1D3 = std::to_array<MoveInfo>(
-        {
-            { { 0, 16, 0 }, 32, Pitch::down10deg },
-            { { 1, 16, 0 }, 32, Pitch::down10deg },
-            { { 2, 16, 0 }, 32, Pitch::down10deg },
-            { { 3, 16, 0 }, 32, Pitch::down10deg },
-            { { 4, 16, 0 }, 32, Pitch::down10deg },
-            { { 5, 16, -1 }, 30, Pitch::down10deg },
-            { { 6, 16, -1 }, 30, Pitch::down10deg },
-            { { 7, 17, -1 }, 30, Pitch::down10deg },
-            { { 8, 17, -1 }, 30, Pitch::down10deg },
-            { { 9, 17, -1 }, 30, Pitch::down10deg },
-            { { 10, 17, -2 }, 30, Pitch::down10deg },
-            { { 11, 17, -2 }, 30, Pitch::down10deg },
-            { { 12, 17, -2 }, 30, Pitch::down10deg },
-            { { 13, 18, -2 }, 30, Pitch::down10deg },
-            { { 14, 18, -3 }, 28, Pitch::down10deg },
-            { { 15, 18, -3 }, 28, Pitch::down10deg },
-            { { 16, 19, -3 }, 28, Pitch::down10deg },
-            { { 17, 19, -3 }, 28, Pitch::down10deg },
-            { { 18, 19, -3 }, 28, Pitch::down10deg },
-            { { 19, 20, -4 }, 28, Pitch::down10deg },
-            { { 20, 20, -4 }, 28, Pitch::down10deg },
-            { { 21, 21, -4 }, 28, Pitch::down10deg },
-            { { 22, 21, -4 }, 28, Pitch::down10deg },
-            { { 23, 22, -5 }, 26, Pitch::down10deg },
-            { { 24, 22, -5 }, 26, Pitch::down10deg },
-            { { 25, 23, -5 }, 26, Pitch::down10deg },
-            { { 26, 23, -5 }, 26, Pitch::down10deg },
-            { { 27, 24, -6 }, 26, Pitch::down10deg },
-            { { 28, 25, -6 }, 26, Pitch::down10deg },
-            { { 29, 25, -6 }, 26, Pitch::down10deg },
-            { { 30, 26, -6 }, 26, Pitch::down10deg },
-            { { 31, 27, -7 }, 24, Pitch::down10deg },
-            { { 32, 28, -7 }, 24, Pitch::down10deg },
-            { { 33, 29, -7 }, 24, Pitch::down10deg },
-            { { 35, 29, -8 }, 24, Pitch::down10deg },
-            { { 36, 30, -8 }, 24, Pitch::down10deg },
-            { { 37, 31, -8 }, 24, Pitch::down10deg },
-            { { 38, 32, -8 }, 24, Pitch::down10deg },
-            { { 39, 33, -9 }, 22, Pitch::down10deg },
-            { { 39, 34, -9 }, 22, Pitch::down10deg },
-            { { 40, 35, -9 }, 22, Pitch::down10deg },
-            { { 41, 36, -9 }, 22, Pitch::down10deg },
-            { { 41, 37, -10 }, 22, Pitch::down10deg },
-            { { 42, 38, -10 }, 22, Pitch::down10deg },
-            { { 42, 39, -10 }, 22, Pitch::down10deg },
-            { { 43, 40, -10 }, 22, Pitch::down10deg },
-            { { 43, 41, -11 }, 20, Pitch::down10deg },
-            { { 44, 42, -11 }, 20, Pitch::down10deg },
-            { { 44, 43, -11 }, 20, Pitch::down10deg },
-            { { 45, 44, -11 }, 20, Pitch::down10deg },
-            { { 45, 45, -12 }, 20, Pitch::down10deg },
-            { { 45, 46, -12 }, 20, Pitch::down10deg },
-            { { 46, 47, -12 }, 20, Pitch::down10deg },
-            { { 46, 48, -12 }, 20, Pitch::down10deg },
-            { { 46, 49, -12 }, 20, Pitch::down10deg },
-            { { 47, 50, -13 }, 18, Pitch::down10deg },
-            { { 47, 51, -13 }, 18, Pitch::down10deg },
-            { { 47, 52, -13 }, 18, Pitch::down10deg },
-            { { 47, 53, -13 }, 18, Pitch::down10deg },
-            { { 47, 54, -14 }, 18, Pitch::down10deg },
-            { { 47, 55, -14 }, 18, Pitch::down10deg },
-            { { 48, 56, -14 }, 18, Pitch::down10deg },
-            { { 48, 57, -14 }, 18, Pitch::down10deg },
-            { { 48, 58, -14 }, 18, Pitch::down10deg },
-            { { 48, 59, -15 }, 16, Pitch::down10deg },
-            { { 48, 60, -15 }, 16, Pitch::down10deg },
-            { { 48, 61, -15 }, 16, Pitch::down10deg },
-            { { 48, 62, -15 }, 16, Pitch::down10deg },
-        });
-
-    // 0x4e88de
-    // Track 22. Reversed 0. Direction 0
-    static constexpr auto moveInfoT22R0D0 = std::to_array<MoveInfo>(
-        {
-            { { 31, 16, 0 }, 0, Pitch::up20deg },
-            { { 30, 16, 0 }, 0, Pitch::up20deg },
-            { { 29, 16, 1 }, 0, Pitch::up20deg },
-            { { 28, 16, 1 }, 0, Pitch::up20deg },
-            { { 27, 16, 2 }, 62, Pitch::up20deg },
-            { { 26, 16, 2 }, 62, Pitch::up20deg },
-            { { 25, 15, 2 }, 62, Pitch::up20deg },
-            { { 24, 15, 3 }, 62, Pitch::up20deg },
-            { { 23, 15, 3 }, 62, Pitch::up20deg },
-            { { 22, 15, 4 }, 62, Pitch::up20deg },
-            { { 21, 15, 4 }, 62, Pitch::up20deg },
-            { { 20, 15, 4 }, 62, Pitch::up20deg },
-            { { 19, 14, 5 }, 62, Pitch::up20deg },
-            { { 18, 14, 5 }, 60, Pitch::up20deg },
-            { { 17, 14, 6 }, 60, Pitch::up20deg },
-            { { 16, 13, 6 }, 60, Pitch::up20deg },
-            { { 15, 13, 7 }, 60, Pitch::up20deg },
-            { { 14, 13, 7 }, 60, Pitch::up20deg },
-            { { 13, 12, 8 }, 60, Pitch::up20deg },
-            { { 12, 12, 8 }, 60, Pitch::up20deg },
-            { { 11, 11, 9 }, 60, Pitch::up20deg },
-            { { 10, 11, 9 }, 60, Pitch::up20deg },
-            { { 9, 10, 10 }, 58, Pitch::up20deg },
-            { { 8, 10, 10 }, 58, Pitch::up20deg },
-            { { 7, 9, 11 }, 58, Pitch::up20deg },
-            { { 6, 9, 11 }, 58, Pitch::up20deg },
-            { { 5, 8, 11 }, 58, Pitch::up20deg },
-            { { 4, 7, 12 }, 58, Pitch::up20deg },
-            { { 3, 7, 13 }, 58, Pitch::up20deg },
-            { { 2, 6, 13 }, 58, Pitch::up20deg },
-            { { 1, 5, 14 }, 56, Pitch::up20deg },
-            { { 0, 4, 14 }, 56, Pitch::up20deg },
-            { { -1, 3, 15 }, 56, Pitch::up20deg },
-            { { -3, 3, 15 }, 56, Pitch::up20deg },
-            { { -4, 2, 16 }, 56, Pitch::up20deg },
-            { { -5, 1, 16 }, 56, Pitch::up20deg },
-            { { -6, 0, 17 }, 56, Pitch::up20deg },
-            { { -7, -1, 17 }, 54, Pitch::up20deg },
-            { { -7, -2, 18 }, 54, Pitch::up20deg },
-            { { -8, -3, 18 }, 54, Pitch::up20deg },
-            { { -9, -4, 19 }, 54, Pitch::up20deg },
-            { { -9, -5, 19 }, 54, Pitch::up20deg },
-            { { -10, -6, 20 }, 54, Pitch::up20deg },
-            { { -10, -7, 20 }, 54, Pitch::up20deg },
-            { { -11, -8, 21 }, 54, Pitch::up20deg },
-            { { -11, -9, 21 }, 52, Pitch::up20deg },
-            { { -12, -10, 22 }, 52, Pitch::up20deg },
-            { { -12, -11, 22 }, 52, Pitch::up20deg },
-            { { -13, -12, 23 }, 52, Pitch::up20deg },
-            { { -13, -13, 23 }, 52, Pitch::up20deg },
-            { { -13, -14, 24 }, 52, Pitch::up20deg },
-            { { -14, -15, 24 }, 52, Pitch::up20deg },
-            { { -14, -16, 25 }, 52, Pitch::up20deg },
-            { { -14, -17, 25 }, 52, Pitch::up20deg },
-            { { -15, -18, 25 }, 50, Pitch::up20deg },
-            { { -15, -19, 26 }, 50, Pitch::up20deg },
-            { { -15, -20, 26 }, 50, Pitch::up20deg },
-            { { -15, -21, 27 }, 50, Pitch::up20deg },
-            { { -15, -22, 27 }, 50, Pitch::up20deg },
-            { { -15, -23, 28 }, 50, Pitch::up20deg },
-            { { -16, -24, 28 }, 50, Pitch::up20deg },
-            { { -16, -25, 29 }, 50, Pitch::up20deg },
-            { { -16, -26, 29 }, 50, Pitch::up20deg },
-            { { -16, -27, 29 }, 48, Pitch::up20deg },
-            { { -16, -28, 30 }, 48, Pitch::up20deg },
-            { { -16, -29, 30 }, 48, Pitch::up20deg },
-            { { -16, -30, 31 }, 48, Pitch::up20deg },
-            { { -16, -31, 31 }, 48, Pitch::up20deg },
-        });
-
-    // 0x4e8b00
-    // Track 22. Reversed 0. Direction 1
-    static constexpr auto moveInfoT22R0D1 = std::to_array<MoveInfo>(
-        {
-            { { 16, 0, 0 }, 16, Pitch::up20deg },
-            { { 16, 1, 0 }, 16, Pitch::up20deg },
-            { { 16, 2, 0 }, 16, Pitch::up20deg },
-            { { 16, 3, 1 }, 16, Pitch::up20deg },
-            { { 16, 4, 1 }, 16, Pitch::up20deg },
-            { { 16, 5, 2 }, 14, Pitch::up20deg },
-            { { 16, 6, 2 }, 14, Pitch::up20deg },
-            { { 15, 7, 2 }, 14, Pitch::up20deg },
-            { { 15, 8, 3 }, 14, Pitch::up20deg },
-            { { 15, 9, 3 }, 14, Pitch::up20deg },
-            { { 15, 10, 4 }, 14, Pitch::up20deg },
-            { { 15, 11, 4 }, 14, Pitch::up20deg },
-            { { 15, 12, 4 }, 14, Pitch::up20deg },
-            { { 14, 13, 5 }, 14, Pitch::up20deg },
-            { { 14, 14, 5 }, 12, Pitch::up20deg },
-            { { 14, 15, 6 }, 12, Pitch::up20deg },
-            { { 13, 16, 6 }, 12, Pitch::up20deg },
-            { { 13, 17, 7 }, 12, Pitch::up20deg },
-            { { 13, 18, 7 }, 12, Pitch::up20deg },
-            { { 12, 19, 8 }, 12, Pitch::up20deg },
-            { { 12, 20, 8 }, 12, Pitch::up20deg },
-            { { 11, 21, 9 }, 12, Pitch::up20deg },
-            { { 11, 22, 9 }, 12, Pitch::up20deg },
-            { { 10, 23, 10 }, 10, Pitch::up20deg },
-            { { 10, 24, 10 }, 10, Pitch::up20deg },
-            { { 9, 25, 11 }, 10, Pitch::up20deg },
-            { { 9, 26, 11 }, 10, Pitch::up20deg },
-            { { 8, 27, 11 }, 10, Pitch::up20deg },
-            { { 7, 28, 12 }, 10, Pitch::up20deg },
-            { { 7, 29, 13 }, 10, Pitch::up20deg },
-            { { 6, 30, 13 }, 10, Pitch::up20deg },
-            { { 5, 31, 14 }, 8, Pitch::up20deg },
-            { { 4, 32, 14 }, 8, Pitch::up20deg },
-            { { 3, 33, 15 }, 8, Pitch::up20deg },
-            { { 3, 35, 15 }, 8, Pitch::up20deg },
-            { { 2, 36, 16 }, 8, Pitch::up20deg },
-            { { 1, 37, 16 }, 8, Pitch::up20deg },
-            { { 0, 38, 17 }, 8, Pitch::up20deg },
-            { { -1, 39, 17 }, 6, Pitch::up20deg },
-            { { -2, 39, 18 }, 6, Pitch::up20deg },
-            { { -3, 40, 18 }, 6, Pitch::up20deg },
-            { { -4, 41, 19 }, 6, Pitch::up20deg },
-            { { -5, 41, 19 }, 6, Pitch::up20deg },
-            { { -6, 42, 20 }, 6, Pitch::up20deg },
-            { { -7, 42, 20 }, 6, Pitch::up20deg },
-            { { -8, 43, 21 }, 6, Pitch::up20deg },
-            { { -9, 43, 21 }, 4, Pitch::up20deg },
-            { { -10, 44, 22 }, 4, Pitch::up20deg },
-            { { -11, 44, 22 }, 4, Pitch::up20deg },
-            { { -12, 45, 23 }, 4, Pitch::up20deg },
-            { { -13, 45, 23 }, 4, Pitch::up20deg },
-            { { -14, 45, 24 }, 4, Pitch::up20deg },
-            { { -15, 46, 24 }, 4, Pitch::up20deg },
-            { { -16, 46, 25 }, 4, Pitch::up20deg },
-            { { -17, 46, 25 }, 4, Pitch::up20deg },
-            { { -18, 47, 25 }, 2, Pitch::up20deg },
-            { { -19, 47, 26 }, 2, Pitch::up20deg },
-            { { -20, 47, 26 }, 2, Pitch::up20deg },
-            { { -21, 47, 27 }, 2, Pitch::up20deg },
-            { { -22, 47, 27 }, 2, Pitch::up20deg },
-            { { -23, 47, 28 }, 2, Pitch::up20deg },
-            { { -24, 48, 28 }, 2, Pitch::up20deg },
-            { { -25, 48, 29 }, 2, Pitch::up20deg },
-            { { -26, 48, 29 }, 2, Pitch::up20deg },
-            { { -27, 48, 29 }, 0, Pitch::up20deg },
-            { { -28, 48, 30 }, 0, Pitch::up20deg },
-            { { -29, 48, 30 }, 0, Pitch::up20deg },
-            { { -30, 48, 31 }, 0, Pitch::up20deg },
-            { { -31, 48, 31 }, 0, Pitch::up20deg },
-        });
-
-    // 0x4e8d2a
-    // Track 22. Reversed 0. Direction 2
-    static constexpr auto moveInfoT22R0D2 = std::to_array<MoveInfo>(
-        {
-            { { 0, 16, 0 }, 32, Pitch::up20deg },
-            { { 1, 16, 0 }, 32, Pitch::up20deg },
-            { { 2, 16, 0 }, 32, Pitch::up20deg },
-            { { 3, 16, 1 }, 32, Pitch::up20deg },
-            { { 4, 16, 1 }, 32, Pitch::up20deg },
-            { { 5, 16, 2 }, 30, Pitch::up20deg },
-            { { 6, 16, 2 }, 30, Pitch::up20deg },
-            { { 7, 17, 2 }, 30, Pitch::up20deg },
-            { { 8, 17, 3 }, 30, Pitch::up20deg },
-            { { 9, 17, 3 }, 30, Pitch::up20deg },
-            { { 10, 17, 4 }, 30, Pitch::up20deg },
-            { { 11, 17, 4 }, 30, Pitch::up20deg },
-            { { 12, 17, 5 }, 30, Pitch::up20deg },
-            { { 13, 18, 5 }, 30, Pitch::up20deg },
-            { { 14, 18, 6 }, 28, Pitch::up20deg },
-            { { 15, 18, 6 }, 28, Pitch::up20deg },
-            { { 16, 19, 6 }, 28, Pitch::up20deg },
-            { { 17, 19, 7 }, 28, Pitch::up20deg },
-            { { 18, 19, 7 }, 28, Pitch::up20deg },
-            { { 19, 20, 8 }, 28, Pitch::up20deg },
-            { { 20, 20, 8 }, 28, Pitch::up20deg },
-            { { 21, 21, 9 }, 28, Pitch::up20deg },
-            { { 22, 21, 9 }, 28, Pitch::up20deg },
-            { { 23, 22, 10 }, 26, Pitch::up20deg },
-            { { 24, 22, 10 }, 26, Pitch::up20deg },
-            { { 25, 23, 11 }, 26, Pitch::up20deg },
-            { { 26, 23, 11 }, 26, Pitch::up20deg },
-            { { 27, 24, 12 }, 26, Pitch::up20deg },
-            { { 28, 25, 12 }, 26, Pitch::up20deg },
-            { { 29, 25, 13 }, 26, Pitch::up20deg },
-            { { 30, 26, 13 }, 26, Pitch::up20deg },
-            { { 31, 27, 14 }, 24, Pitch::up20deg },
-            { { 32, 28, 14 }, 24, Pitch::up20deg },
-            { { 33, 29, 15 }, 24, Pitch::up20deg },
-            { { 35, 29, 15 }, 24, Pitch::up20deg },
-            { { 36, 30, 16 }, 24, Pitch::up20deg },
-            { { 37, 31, 16 }, 24, Pitch::up20deg },
-            { { 38, 32, 17 }, 24, Pitch::up20deg },
-            { { 39, 33, 18 }, 22, Pitch::up20deg },
-            { { 39, 34, 18 }, 22, Pitch::up20deg },
-            { { 40, 35, 19 }, 22, Pitch::up20deg },
-            { { 41, 36, 19 }, 22, Pitch::up20deg },
-            { { 41, 37, 20 }, 22, Pitch::up20deg },
-            { { 42, 38, 20 }, 22, Pitch::up20deg },
-            { { 42, 39, 21 }, 22, Pitch::up20deg },
-            { { 43, 40, 21 }, 22, Pitch::up20deg },
-            { { 43, 41, 22 }, 20, Pitch::up20deg },
-            { { 44, 42, 22 }, 20, Pitch::up20deg },
-            { { 44, 43, 23 }, 20, Pitch::up20deg },
-            { { 45, 44, 23 }, 20, Pitch::up20deg },
-            { { 45, 45, 24 }, 20, Pitch::up20deg },
-            { { 45, 46, 24 }, 20, Pitch::up20deg },
-            { { 46, 47, 24 }, 20, Pitch::up20deg },
-            { { 46, 48, 25 }, 20, Pitch::up20deg },
-            { { 46, 49, 25 }, 20, Pitch::up20deg },
-            { { 47, 50, 26 }, 18, Pitch::up20deg },
-            { { 47, 51, 26 }, 18, Pitch::up20deg },
-            { { 47, 52, 27 }, 18, Pitch::up20deg },
-            { { 47, 53, 27 }, 18, Pitch::up20deg },
-            { { 47, 54, 28 }, 18, Pitch::up20deg },
-            { { 47, 55, 28 }, 18, Pitch::up20deg },
-            { { 48, 56, 28 }, 18, Pitch::up20deg },
-            { { 48, 57, 29 }, 18, Pitch::up20deg },
-            { { 48, 58, 29 }, 18, Pitch::up20deg },
-            { { 48, 59, 30 }, 16, Pitch::up20deg },
-            { { 48, 60, 30 }, 16, Pitch::up20deg },
-            { { 48, 61, 31 }, 16, Pitch::up20deg },
-            { { 48, 62, 31 }, 16, Pitch::up20deg },
-        });
-
-    // 0x4e8f4c
-    // Track 22. Reversed 0. Direction 3
-    static constexpr auto moveInfoT22R0D3 = std::to_array<MoveInfo>(
-        {
-            { { 16, 31, 0 }, 48, Pitch::up20deg },
-            { { 16, 30, 0 }, 48, Pitch::up20deg },
-            { { 16, 29, 1 }, 48, Pitch::up20deg },
-            { { 16, 28, 1 }, 48, Pitch::up20deg },
-            { { 16, 27, 2 }, 46, Pitch::up20deg },
-            { { 16, 26, 2 }, 46, Pitch::up20deg },
-            { { 17, 25, 2 }, 46, Pitch::up20deg },
-            { { 17, 24, 3 }, 46, Pitch::up20deg },
-            { { 17, 23, 3 }, 46, Pitch::up20deg },
-            { { 17, 22, 4 }, 46, Pitch::up20deg },
-            { { 17, 21, 4 }, 46, Pitch::up20deg },
-            { { 17, 20, 5 }, 46, Pitch::up20deg },
-            { { 18, 19, 5 }, 46, Pitch::up20deg },
-            { { 18, 18, 6 }, 44, Pitch::up20deg },
-            { { 18, 17, 6 }, 44, Pitch::up20deg },
-            { { 19, 16, 6 }, 44, Pitch::up20deg },
-            { { 19, 15, 7 }, 44, Pitch::up20deg },
-            { { 19, 14, 7 }, 44, Pitch::up20deg },
-            { { 20, 13, 8 }, 44, Pitch::up20deg },
-            { { 20, 12, 8 }, 44, Pitch::up20deg },
-            { { 21, 11, 9 }, 44, Pitch::up20deg },
-            { { 21, 10, 9 }, 44, Pitch::up20deg },
-            { { 22, 9, 10 }, 42, Pitch::up20deg },
-            { { 22, 8, 10 }, 42, Pitch::up20deg },
-            { { 23, 7, 11 }, 42, Pitch::up20deg },
-            { { 23, 6, 11 }, 42, Pitch::up20deg },
-            { { 24, 5, 12 }, 42, Pitch::up20deg },
-            { { 25, 4, 12 }, 42, Pitch::up20deg },
-            { { 25, 3, 13 }, 42, Pitch::up20deg },
-            { { 26, 2, 13 }, 42, Pitch::up20deg },
-            { { 27, 1, 14 }, 40, Pitch::up20deg },
-            { { 28, 0, 14 }, 40, Pitch::up20deg },
-            { { 29, -1, 15 }, 40, Pitch::up20deg },
-            { { 29, -3, 15 }, 40, Pitch::up20deg },
-            { { 30, -4, 16 }, 40, Pitch::up20deg },
-            { { 31, -5, 16 }, 40, Pitch::up20deg },
-            { { 32, -6, 17 }, 40, Pitch::up20deg },
-            { { 33, -7, 18 }, 38, Pitch::up20deg },
-            { { 34, -7, 18 }, 38, Pitch::up20deg },
-            { { 35, -8, 19 }, 38, Pitch::up20deg },
-            { { 36, -9, 19 }, 38, Pitch::up20deg },
-            { { 37, -9, 20 }, 38, Pitch::up20deg },
-            { { 38, -10, 20 }, 38, Pitch::up20deg },
-            { { 39, -10, 21 }, 38, Pitch::up20deg },
-            { { 40, -11, 21 }, 38, Pitch::up20deg },
-            { { 41, -11, 22 }, 36, Pitch::up20deg },
-            { { 42, -12, 22 }, 36, Pitch::up20deg },
-            { { 43, -12, 23 }, 36, Pitch::up20deg },
-            { { 44, -13, 23 }, 36, Pitch::up20deg },
-            { { 45, -13, 24 }, 36, Pitch::up20deg },
-            { { 46, -13, 24 }, 36, Pitch::up20deg },
-            { { 47, -14, 24 }, 36, Pitch::up20deg },
-            { { 48, -14, 25 }, 36, Pitch::up20deg },
-            { { 49, -14, 25 }, 36, Pitch::up20deg },
-            { { 50, -15, 26 }, 34, Pitch::up20deg },
-            { { 51, -15, 26 }, 34, Pitch::up20deg },
-            { { 52, -15, 27 }, 34, Pitch::up20deg },
-            { { 53, -15, 27 }, 34, Pitch::up20deg },
-            { { 54, -15, 28 }, 34, Pitch::up20deg },
-            { { 55, -15, 28 }, 34, Pitch::up20deg },
-            { { 56, -16, 28 }, 34, Pitch::up20deg },
-            { { 57, -16, 29 }, 34, Pitch::up20deg },
-            { { 58, -16, 29 }, 34, Pitch::up20deg },
-            { { 59, -16, 30 }, 32, Pitch::up20deg },
-            { { 60, -16, 30 }, 32, Pitch::up20deg },
-            { { 61, -16, 31 }, 32, Pitch::up20deg },
-            { { 62, -16, 31 }, 32, Pitch::up20deg },
-        });
-
-    // 0x4ea490
-    // Track 22. Reversed 1. Direction 0
-    static constexpr auto moveInfoT22R1D0 = std::to_array<MoveInfo>(
-        {
-            { { 16, 0, 0 }, 16, Pitch::down20deg },
-            { { 16, 1, 0 }, 16, Pitch::down20deg },
-            { { 16, 2, 0 }, 16, Pitch::down20deg },
-            { { 16, 3, -1 }, 16, Pitch::down20deg },
-            { { 16, 4, -1 }, 16, Pitch::down20deg },
-            { { 16, 5, -2 }, 18, Pitch::down20deg },
-            { { 16, 6, -2 }, 18, Pitch::down20deg },
-            { { 17, 7, -2 }, 18, Pitch::down20deg },
-            { { 17, 8, -3 }, 18, Pitch::down20deg },
-            { { 17, 9, -3 }, 18, Pitch::down20deg },
-            { { 17, 10, -4 }, 18, Pitch::down20deg },
-            { { 17, 11, -4 }, 18, Pitch::down20deg },
-            { { 17, 12, -5 }, 18, Pitch::down20deg },
-            { { 18, 13, -5 }, 18, Pitch::down20deg },
-            { { 18, 14, -6 }, 20, Pitch::down20deg },
-            { { 18, 15, -6 }, 20, Pitch::down20deg },
-            { { 19, 16, -6 }, 20, Pitch::down20deg },
-            { { 19, 17, -7 }, 20, Pitch::down20deg },
-            { { 19, 18, -7 }, 20, Pitch::down20deg },
-            { { 20, 19, -8 }, 20, Pitch::down20deg },
-            { { 20, 20, -8 }, 20, Pitch::down20deg },
-            { { 21, 21, -9 }, 20, Pitch::down20deg },
-            { { 21, 22, -9 }, 20, Pitch::down20deg },
-            { { 22, 23, -10 }, 22, Pitch::down20deg },
-            { { 22, 24, -10 }, 22, Pitch::down20deg },
-            { { 23, 25, -11 }, 22, Pitch::down20deg },
-            { { 23, 26, -11 }, 22, Pitch::down20deg },
-            { { 24, 27, -12 }, 22, Pitch::down20deg },
-            { { 25, 28, -12 }, 22, Pitch::down20deg },
-            { { 25, 29, -13 }, 22, Pitch::down20deg },
-            { { 26, 30, -13 }, 22, Pitch::down20deg },
-            { { 27, 31, -14 }, 24, Pitch::down20deg },
-            { { 28, 32, -14 }, 24, Pitch::down20deg },
-            { { 29, 33, -15 }, 24, Pitch::down20deg },
-            { { 29, 35, -16 }, 24, Pitch::down20deg },
-            { { 30, 36, -16 }, 24, Pitch::down20deg },
-            { { 31, 37, -16 }, 24, Pitch::down20deg },
-            { { 32, 38, -17 }, 24, Pitch::down20deg },
-            { { 33, 39, -18 }, 26, Pitch::down20deg },
-            { { 34, 39, -18 }, 26, Pitch::down20deg },
-            { { 35, 40, -19 }, 26, Pitch::down20deg },
-            { { 36, 41, -19 }, 26, Pitch::down20deg },
-            { { 37, 41, -20 }, 26, Pitch::down20deg },
-            { { 38, 42, -20 }, 26, Pitch::down20deg },
-            { { 39, 42, -21 }, 26, Pitch::down20deg },
-            { { 40, 43, -21 }, 26, Pitch::down20deg },
-            { { 41, 43, -22 }, 28, Pitch::down20deg },
-            { { 42, 44, -22 }, 28, Pitch::down20deg },
-            { { 43, 44, -23 }, 28, Pitch::down20deg },
-            { { 44, 45, -23 }, 28, Pitch::down20deg },
-            { { 45, 45, -24 }, 28, Pitch::down20deg },
-            { { 46, 45, -24 }, 28, Pitch::down20deg },
-            { { 47, 46, -24 }, 28, Pitch::down20deg },
-            { { 48, 46, -25 }, 28, Pitch::down20deg },
-            { { 49, 46, -25 }, 28, Pitch::down20deg },
-            { { 50, 47, -26 }, 30, Pitch::down20deg },
-            { { 51, 47, -26 }, 30, Pitch::down20deg },
-            { { 52, 47, -27 }, 30, Pitch::down20deg },
-            { { 53, 47, -27 }, 30, Pitch::down20deg },
-            { { 54, 47, -28 }, 30, Pitch::down20deg },
-            { { 55, 47, -28 }, 30, Pitch::down20deg },
-            { { 56, 48, -28 }, 30, Pitch::down20deg },
-            { { 57, 48, -29 }, 30, Pitch::down20deg },
-            { { 58, 48, -29 }, 30, Pitch::down20deg },
-            { { 59, 48, -30 }, 32, Pitch::down20deg },
-            { { 60, 48, -30 }, 32, Pitch::down20deg },
-            { { 61, 48, -31 }, 32, Pitch::down20deg },
-            { { 62, 48, -31 }, 32, Pitch::down20deg },
-        });
-
-    // 0x4ea6b2
-    // Track 22. Reversed 1. Direction 1
-    static constexpr auto moveInfoT22R1D1 = std::to_array<MoveInfo>(
-        {
-            { { 0, 16, 0 }, 32, Pitch::down20deg },
-            { { 1, 16, 0 }, 32, Pitch::down20deg },
-            { { 2, 16, 0 }, 32, Pitch::down20deg },
-            { { 3, 16, -1 }, 32, Pitch::down20deg },
-            { { 4, 16, -1 }, 32, Pitch::down20deg },
-            { { 5, 16, -2 }, 34, Pitch::down20deg },
-            { { 6, 16, -2 }, 34, Pitch::down20deg },
-            { { 7, 15, -2 }, 34, Pitch::down20deg },
-            { { 8, 15, -3 }, 34, Pitch::down20deg },
-            { { 9, 15, -3 }, 34, Pitch::down20deg },
-            { { 10, 15, -4 }, 34, Pitch::down20deg },
-            { { 11, 15, -4 }, 34, Pitch::down20deg },
-            { { 12, 15, -4 }, 34, Pitch::down20deg },
-            { { 13, 14, -5 }, 34, Pitch::down20deg },
-            { { 14, 14, -5 }, 36, Pitch::down20deg },
-            { { 15, 14, -6 }, 36, Pitch::down20deg },
-            { { 16, 13, -6 }, 36, Pitch::down20deg },
-            { { 17, 13, -7 }, 36, Pitch::down20deg },
-            { { 18, 13, -7 }, 36, Pitch::down20deg },
-            { { 19, 12, -8 }, 36, Pitch::down20deg },
-            { { 20, 12, -8 }, 36, Pitch::down20deg },
-            { { 21, 11, -9 }, 36, Pitch::down20deg },
-            { { 22, 11, -9 }, 36, Pitch::down20deg },
-            { { 23, 10, -10 }, 38, Pitch::down20deg },
-            { { 24, 10, -10 }, 38, Pitch::down20deg },
-            { { 25, 9, -11 }, 38, Pitch::down20deg },
-            { { 26, 9, -11 }, 38, Pitch::down20deg },
-            { { 27, 8, -11 }, 38, Pitch::down20deg },
-            { { 28, 7, -12 }, 38, Pitch::down20deg },
-            { { 29, 7, -13 }, 38, Pitch::down20deg },
-            { { 30, 6, -13 }, 38, Pitch::down20deg },
-            { { 31, 5, -14 }, 40, Pitch::down20deg },
-            { { 32, 4, -14 }, 40, Pitch::down20deg },
-            { { 33, 3, -15 }, 40, Pitch::down20deg },
-            { { 35, 3, -15 }, 40, Pitch::down20deg },
-            { { 36, 2, -16 }, 40, Pitch::down20deg },
-            { { 37, 1, -16 }, 40, Pitch::down20deg },
-            { { 38, 0, -17 }, 40, Pitch::down20deg },
-            { { 39, -1, -17 }, 42, Pitch::down20deg },
-            { { 39, -2, -18 }, 42, Pitch::down20deg },
-            { { 40, -3, -18 }, 42, Pitch::down20deg },
-            { { 41, -4, -19 }, 42, Pitch::down20deg },
-            { { 41, -5, -19 }, 42, Pitch::down20deg },
-            { { 42, -6, -20 }, 42, Pitch::down20deg },
-            { { 42, -7, -20 }, 42, Pitch::down20deg },
-            { { 43, -8, -21 }, 42, Pitch::down20deg },
-            { { 43, -9, -21 }, 44, Pitch::down20deg },
-            { { 44, -10, -22 }, 44, Pitch::down20deg },
-            { { 44, -11, -22 }, 44, Pitch::down20deg },
-            { { 45, -12, -23 }, 44, Pitch::down20deg },
-            { { 45, -13, -23 }, 44, Pitch::down20deg },
-            { { 45, -14, -24 }, 44, Pitch::down20deg },
-            { { 46, -15, -24 }, 44, Pitch::down20deg },
-            { { 46, -16, -25 }, 44, Pitch::down20deg },
-            { { 46, -17, -25 }, 44, Pitch::down20deg },
-            { { 47, -18, -25 }, 46, Pitch::down20deg },
-            { { 47, -19, -26 }, 46, Pitch::down20deg },
-            { { 47, -20, -26 }, 46, Pitch::down20deg },
-            { { 47, -21, -27 }, 46, Pitch::down20deg },
-            { { 47, -22, -27 }, 46, Pitch::down20deg },
-            { { 47, -23, -28 }, 46, Pitch::down20deg },
-            { { 48, -24, -28 }, 46, Pitch::down20deg },
-            { { 48, -25, -29 }, 46, Pitch::down20deg },
-            { { 48, -26, -29 }, 46, Pitch::down20deg },
-            { { 48, -27, -29 }, 48, Pitch::down20deg },
-            { { 48, -28, -30 }, 48, Pitch::down20deg },
-            { { 48, -29, -30 }, 48, Pitch::down20deg },
-            { { 48, -30, -31 }, 48, Pitch::down20deg },
-            { { 48, -31, -31 }, 48, Pitch::down20deg },
-        });
-
-    // 0x4ea8dc
-    // Track 22. Reversed 1. Direction 2
-    static constexpr auto moveInfoT22R1D2 = std::to_array<MoveInfo>(
-        {
-            { { 16, 31, 0 }, 48, Pitch::down20deg },
-            { { 16, 30, 0 }, 48, Pitch::down20deg },
-            { { 16, 29, -1 }, 48, Pitch::down20deg },
-            { { 16, 28, -1 }, 48, Pitch::down20deg },
-            { { 16, 27, -2 }, 50, Pitch::down20deg },
-            { { 16, 26, -2 }, 50, Pitch::down20deg },
-            { { 15, 25, -2 }, 50, Pitch::down20deg },
-            { { 15, 24, -3 }, 50, Pitch::down20deg },
-            { { 15, 23, -3 }, 50, Pitch::down20deg },
-            { { 15, 22, -4 }, 50, Pitch::down20deg },
-            { { 15, 21, -4 }, 50, Pitch::down20deg },
-            { { 15, 20, -4 }, 50, Pitch::down20deg },
-            { { 14, 19, -5 }, 50, Pitch::down20deg },
-            { { 14, 18, -5 }, 52, Pitch::down20deg },
-            { { 14, 17, -6 }, 52, Pitch::down20deg },
-            { { 13, 16, -6 }, 52, Pitch::down20deg },
-            { { 13, 15, -7 }, 52, Pitch::down20deg },
-            { { 13, 14, -7 }, 52, Pitch::down20deg },
-            { { 12, 13, -8 }, 52, Pitch::down20deg },
-            { { 12, 12, -8 }, 52, Pitch::down20deg },
-            { { 11, 11, -9 }, 52, Pitch::down20deg },
-            { { 11, 10, -9 }, 52, Pitch::down20deg },
-            { { 10, 9, -10 }, 54, Pitch::down20deg },
-            { { 10, 8, -10 }, 54, Pitch::down20deg },
-            { { 9, 7, -11 }, 54, Pitch::down20deg },
-            { { 9, 6, -11 }, 54, Pitch::down20deg },
-            { { 8, 5, -11 }, 54, Pitch::down20deg },
-            { { 7, 4, -12 }, 54, Pitch::down20deg },
-            { { 7, 3, -13 }, 54, Pitch::down20deg },
-            { { 6, 2, -13 }, 54, Pitch::down20deg },
-            { { 5, 1, -14 }, 56, Pitch::down20deg },
-            { { 4, 0, -14 }, 56, Pitch::down20deg },
-            { { 3, -1, -15 }, 56, Pitch::down20deg },
-            { { 3, -3, -15 }, 56, Pitch::down20deg },
-            { { 2, -4, -16 }, 56, Pitch::down20deg },
-            { { 1, -5, -16 }, 56, Pitch::down20deg },
-            { { 0, -6, -17 }, 56, Pitch::down20deg },
-            { { -1, -7, -17 }, 58, Pitch::down20deg },
-            { { -2, -7, -18 }, 58, Pitch::down20deg },
-            { { -3, -8, -18 }, 58, Pitch::down20deg },
-            { { -4, -9, -19 }, 58, Pitch::down20deg },
-            { { -5, -9, -19 }, 58, Pitch::down20deg },
-            { { -6, -10, -20 }, 58, Pitch::down20deg },
-            { { -7, -10, -20 }, 58, Pitch::down20deg },
-            { { -8, -11, -21 }, 58, Pitch::down20deg },
-            { { -9, -11, -21 }, 60, Pitch::down20deg },
-            { { -10, -12, -22 }, 60, Pitch::down20deg },
-            { { -11, -12, -22 }, 60, Pitch::down20deg },
-            { { -12, -13, -23 }, 60, Pitch::down20deg },
-            { { -13, -13, -23 }, 60, Pitch::down20deg },
-            { { -14, -13, -24 }, 60, Pitch::down20deg },
-            { { -15, -14, -24 }, 60, Pitch::down20deg },
-            { { -16, -14, -25 }, 60, Pitch::down20deg },
-            { { -17, -14, -25 }, 60, Pitch::down20deg },
-            { { -18, -15, -25 }, 62, Pitch::down20deg },
-            { { -19, -15, -26 }, 62, Pitch::down20deg },
-            { { -20, -15, -26 }, 62, Pitch::down20deg },
-            { { -21, -15, -27 }, 62, Pitch::down20deg },
-            { { -22, -15, -27 }, 62, Pitch::down20deg },
-            { { -23, -15, -28 }, 62, Pitch::down20deg },
-            { { -24, -16, -28 }, 62, Pitch::down20deg },
-            { { -25, -16, -29 }, 62, Pitch::down20deg },
-            { { -26, -16, -29 }, 62, Pitch::down20deg },
-            { { -27, -16, -29 }, 0, Pitch::down20deg },
-            { { -28, -16, -30 }, 0, Pitch::down20deg },
-            { { -29, -16, -30 }, 0, Pitch::down20deg },
-            { { -30, -16, -31 }, 0, Pitch::down20deg },
-            { { -31, -16, -31 }, 0, Pitch::down20deg },
-        });
-
-    // 0x4ea276
-    // Track 22. Reversed 1. Direction 3
-    static constexpr auto moveInfoT22R1D3 = std::to_array<MoveInfo>(
-        {
-            { { 31, 16, 0 }, 0, Pitch::down20deg },
-            { { 30, 16, 0 }, 0, Pitch::down20deg },
-            { { 29, 16, -1 }, 0, Pitch::down20deg },
-            { { 28, 16, -1 }, 0, Pitch::down20deg },
-            { { 27, 16, -2 }, 2, Pitch::down20deg },
-            { { 26, 16, -2 }, 2, Pitch::down20deg },
-            { { 25, 17, -2 }, 2, Pitch::down20deg },
-            { { 24, 17, -3 }, 2, Pitch::down20deg },
-            { { 23, 17, -3 }, 2, Pitch::down20deg },
-            { { 22, 17, -4 }, 2, Pitch::down20deg },
-            { { 21, 17, -4 }, 2, Pitch::down20deg },
-            { { 20, 17, -5 }, 2, Pitch::down20deg },
-            { { 19, 18, -5 }, 2, Pitch::down20deg },
-            { { 18, 18, -6 }, 4, Pitch::down20deg },
-            { { 17, 18, -6 }, 4, Pitch::down20deg },
-            { { 16, 19, -6 }, 4, Pitch::down20deg },
-            { { 15, 19, -7 }, 4, Pitch::down20deg },
-            { { 14, 19, -7 }, 4, Pitch::down20deg },
-            { { 13, 20, -8 }, 4, Pitch::down20deg },
-            { { 12, 20, -8 }, 4, Pitch::down20deg },
-            { { 11, 21, -9 }, 4, Pitch::down20deg },
-            { { 10, 21, -9 }, 4, Pitch::down20deg },
-            { { 9, 22, -10 }, 6, Pitch::down20deg },
-            { { 8, 22, -10 }, 6, Pitch::down20deg },
-            { { 7, 23, -11 }, 6, Pitch::down20deg },
-            { { 6, 23, -11 }, 6, Pitch::down20deg },
-            { { 5, 24, -12 }, 6, Pitch::down20deg },
-            { { 4, 25, -12 }, 6, Pitch::down20deg },
-            { { 3, 25, -13 }, 6, Pitch::down20deg },
-            { { 2, 26, -13 }, 6, Pitch::down20deg },
-            { { 1, 27, -14 }, 8, Pitch::down20deg },
-            { { 0, 28, -14 }, 8, Pitch::down20deg },
-            { { -1, 29, -15 }, 8, Pitch::down20deg },
-            { { -3, 29, -16 }, 8, Pitch::down20deg },
-            { { -4, 30, -16 }, 8, Pitch::down20deg },
-            { { -5, 31, -16 }, 8, Pitch::down20deg },
-            { { -6, 32, -17 }, 8, Pitch::down20deg },
-            { { -7, 33, -18 }, 10, Pitch::down20deg },
-            { { -7, 34, -18 }, 10, Pitch::down20deg },
-            { { -8, 35, -19 }, 10, Pitch::down20deg },
-            { { -9, 36, -19 }, 10, Pitch::down20deg },
-            { { -9, 37, -20 }, 10, Pitch::down20deg },
-            { { -10, 38, -20 }, 10, Pitch::down20deg },
-            { { -10, 39, -21 }, 10, Pitch::down20deg },
-            { { -11, 40, -21 }, 10, Pitch::down20deg },
-            { { -11, 41, -22 }, 12, Pitch::down20deg },
-            { { -12, 42, -22 }, 12, Pitch::down20deg },
-            { { -12, 43, -23 }, 12, Pitch::down20deg },
-            { { -13, 44, -23 }, 12, Pitch::down20deg },
-            { { -13, 45, -24 }, 12, Pitch::down20deg },
-            { { -13, 46, -24 }, 12, Pitch::down20deg },
-            { { -14, 47, -24 }, 12, Pitch::down20deg },
-            { { -14, 48, -25 }, 12, Pitch::down20deg },
-            { { -14, 49, -25 }, 12, Pitch::down20deg },
-            { { -15, 50, -26 }, 14, Pitch::down20deg },
-            { { -15, 51, -26 }, 14, Pitch::down20deg },
-            { { -15, 52, -27 }, 14, Pitch::down20deg },
-            { { -15, 53, -27 }, 14, Pitch::down20deg },
-            { { -15, 54, -28 }, 14, Pitch::down20deg },
-            { { -15, 55, -28 }, 14, Pitch::down20deg },
-            { { -16, 56, -28 }, 14, Pitch::down20deg },
-            { { -16, 57, -29 }, 14, Pitch::down20deg },
-            { { -16, 58, -29 }, 14, Pitch::down20deg },
-            { { -16, 59, -30 }, 16, Pitch::down20deg },
-            { { -16, 60, -30 }, 16, Pitch::down20deg },
-            { { -16, 61, -31 }, 16, Pitch::down20deg },
-            { { -16, 62, -31 }, 16, Pitch::down20deg },
-        });
-
-    // 0x4e9166
-    // Track 23. Reversed 0. Direction 0
-    static constexpr auto moveInfoT23R0D0 = std::to_array<MoveInfo>(
-        {
-            { { 31, 16, 0 }, 0, Pitch::up20deg },
-            { { 30, 16, 0 }, 0, Pitch::up20deg },
-            { { 29, 16, 1 }, 0, Pitch::up20deg },
-            { { 28, 16, 1 }, 0, Pitch::up20deg },
-            { { 27, 16, 2 }, 2, Pitch::up20deg },
-            { { 26, 16, 2 }, 2, Pitch::up20deg },
-            { { 25, 17, 2 }, 2, Pitch::up20deg },
-            { { 24, 17, 3 }, 2, Pitch::up20deg },
-            { { 23, 17, 3 }, 2, Pitch::up20deg },
-            { { 22, 17, 4 }, 2, Pitch::up20deg },
-            { { 21, 17, 4 }, 2, Pitch::up20deg },
-            { { 20, 17, 5 }, 2, Pitch::up20deg },
-            { { 19, 18, 5 }, 2, Pitch::up20deg },
-            { { 18, 18, 6 }, 4, Pitch::up20deg },
-            { { 17, 18, 6 }, 4, Pitch::up20deg },
-            { { 16, 19, 6 }, 4, Pitch::up20deg },
-            { { 15, 19, 7 }, 4, Pitch::up20deg },
-            { { 14, 19, 7 }, 4, Pitch::up20deg },
-            { { 13, 20, 8 }, 4, Pitch::up20deg },
-            { { 12, 20, 8 }, 4, Pitch::up20deg },
-            { { 11, 21, 9 }, 4, Pitch::up20deg },
-            { { 10, 21, 9 }, 4, Pitch::up20deg },
-            { { 9, 22, 10 }, 6, Pitch::up20deg },
-            { { 8, 22, 10 }, 6, Pitch::up20deg },
-            { { 7, 23, 11 }, 6, Pitch::up20deg },
-            { { 6, 23, 11 }, 6, Pitch::up20deg },
-            { { 5, 24, 12 }, 6, Pitch::up20deg },
-            { { 4, 25, 12 }, 6, Pitch::up20deg },
-            { { 3, 25, 13 }, 6, Pitch::up20deg },
-            { { 2, 26, 13 }, 6, Pitch::up20deg },
-            { { 1, 27, 14 }, 8, Pitch::up20deg },
-            { { 0, 28, 14 }, 8, Pitch::up20deg },
-            { { -1, 29, 15 }, 8, Pitch::up20deg },
-            { { -3, 29, 15 }, 8, Pitch::up20deg },
-            { { -4, 30, 16 }, 8, Pitch::up20deg },
-            { { -5, 31, 16 }, 8, Pitch::up20deg },
-            { { -6, 32, 17 }, 8, Pitch::up20deg },
-            { { -7, 33, 18 }, 10, Pitch::up20deg },
-            { { -7, 34, 18 }, 10, Pitch::up20deg },
-            { { -8, 35, 19 }, 10, Pitch::up20deg },
-            { { -9, 36, 19 }, 10, Pitch::up20deg },
-            { { -9, 37, 20 }, 10, Pitch::up20deg },
-            { { -10, 38, 20 }, 10, Pitch::up20deg },
-            { { -10, 39, 21 }, 10, Pitch::up20deg },
-            { { -11, 40, 21 }, 10, Pitch::up20deg },
-            { { -11, 41, 22 }, 12, Pitch::up20deg },
-            { { -12, 42, 22 }, 12, Pitch::up20deg },
-            { { -12, 43, 23 }, 12, Pitch::up20deg },
-            { { -13, 44, 23 }, 12, Pitch::up20deg },
-            { { -13, 45, 24 }, 12, Pitch::up20deg },
-            { { -13, 46, 24 }, 12, Pitch::up20deg },
-            { { -14, 47, 24 }, 12, Pitch::up20deg },
-            { { -14, 48, 25 }, 12, Pitch::up20deg },
-            { { -14, 49, 25 }, 12, Pitch::up20deg },
-            { { -15, 50, 26 }, 14, Pitch::up20deg },
-            { { -15, 51, 26 }, 14, Pitch::up20deg },
-            { { -15, 52, 27 }, 14, Pitch::up20deg },
-            { { -15, 53, 27 }, 14, Pitch::up20deg },
-            { { -15, 54, 28 }, 14, Pitch::up20deg },
-            { { -15, 55, 28 }, 14, Pitch::up20deg },
-            { { -16, 56, 28 }, 14, Pitch::up20deg },
-            { { -16, 57, 29 }, 14, Pitch::up20deg },
-            { { -16, 58, 29 }, 14, Pitch::up20deg },
-            { { -16, 59, 30 }, 16, Pitch::up20deg },
-            { { -16, 60, 30 }, 16, Pitch::up20deg },
-            { { -16, 61, 31 }, 16, Pitch::up20deg },
-            { { -16, 62, 31 }, 16, Pitch::up20deg },
-        });
-
-    // 0x4e9380
-    // Track 23. Reversed 0. Direction 1
-    static constexpr auto moveInfoT23R0D1 = std::to_array<MoveInfo>(
-        {
-            { { 16, 0, 0 }, 16, Pitch::up20deg },
-            { { 16, 1, 0 }, 16, Pitch::up20deg },
-            { { 16, 2, 0 }, 16, Pitch::up20deg },
-            { { 16, 3, 1 }, 16, Pitch::up20deg },
-            { { 16, 4, 1 }, 16, Pitch::up20deg },
-            { { 16, 5, 2 }, 18, Pitch::up20deg },
-            { { 16, 6, 2 }, 18, Pitch::up20deg },
-            { { 17, 7, 2 }, 18, Pitch::up20deg },
-            { { 17, 8, 3 }, 18, Pitch::up20deg },
-            { { 17, 9, 3 }, 18, Pitch::up20deg },
-            { { 17, 10, 4 }, 18, Pitch::up20deg },
-            { { 17, 11, 4 }, 18, Pitch::up20deg },
-            { { 17, 12, 5 }, 18, Pitch::up20deg },
-            { { 18, 13, 5 }, 18, Pitch::up20deg },
-            { { 18, 14, 6 }, 20, Pitch::up20deg },
-            { { 18, 15, 6 }, 20, Pitch::up20deg },
-            { { 19, 16, 6 }, 20, Pitch::up20deg },
-            { { 19, 17, 7 }, 20, Pitch::up20deg },
-            { { 19, 18, 7 }, 20, Pitch::up20deg },
-            { { 20, 19, 8 }, 20, Pitch::up20deg },
-            { { 20, 20, 8 }, 20, Pitch::up20deg },
-            { { 21, 21, 9 }, 20, Pitch::up20deg },
-            { { 21, 22, 9 }, 20, Pitch::up20deg },
-            { { 22, 23, 10 }, 22, Pitch::up20deg },
-            { { 22, 24, 10 }, 22, Pitch::up20deg },
-            { { 23, 25, 11 }, 22, Pitch::up20deg },
-            { { 23, 26, 11 }, 22, Pitch::up20deg },
-            { { 24, 27, 12 }, 22, Pitch::up20deg },
-            { { 25, 28, 12 }, 22, Pitch::up20deg },
-            { { 25, 29, 13 }, 22, Pitch::up20deg },
-            { { 26, 30, 13 }, 22, Pitch::up20deg },
-            { { 27, 31, 14 }, 24, Pitch::up20deg },
-            { { 28, 32, 14 }, 24, Pitch::up20deg },
-            { { 29, 33, 15 }, 24, Pitch::up20deg },
-            { { 29, 35, 15 }, 24, Pitch::up20deg },
-            { { 30, 36, 16 }, 24, Pitch::up20deg },
-            { { 31, 37, 16 }, 24, Pitch::up20deg },
-            { { 32, 38, 17 }, 24, Pitch::up20deg },
-            { { 33, 39, 18 }, 26, Pitch::up20deg },
-            { { 34, 39, 18 }, 26, Pitch::up20deg },
-            { { 35, 40, 19 }, 26, Pitch::up20deg },
-            { { 36, 41, 19 }, 26, Pitch::up20deg },
-            { { 37, 41, 20 }, 26, Pitch::up20deg },
-            { { 38, 42, 20 }, 26, Pitch::up20deg },
-            { { 39, 42, 21 }, 26, Pitch::up20deg },
-            { { 40, 43, 21 }, 26, Pitch::up20deg },
-            { { 41, 43, 22 }, 28, Pitch::up20deg },
-            { { 42, 44, 22 }, 28, Pitch::up20deg },
-            { { 43, 44, 23 }, 28, Pitch::up20deg },
-            { { 44, 45, 23 }, 28, Pitch::up20deg },
-            { { 45, 45, 24 }, 28, Pitch::up20deg },
-            { { 46, 45, 24 }, 28, Pitch::up20deg },
-            { { 47, 46, 24 }, 28, Pitch::up20deg },
-            { { 48, 46, 25 }, 28, Pitch::up20deg },
-            { { 49, 46, 25 }, 28, Pitch::up20deg },
-            { { 50, 47, 26 }, 30, Pitch::up20deg },
-            { { 51, 47, 26 }, 30, Pitch::up20deg },
-            { { 52, 47, 27 }, 30, Pitch::up20deg },
-            { { 53, 47, 27 }, 30, Pitch::up20deg },
-            { { 54, 47, 28 }, 30, Pitch::up20deg },
-            { { 55, 47, 28 }, 30, Pitch::up20deg },
-            { { 56, 48, 28 }, 30, Pitch::up20deg },
-            { { 57, 48, 29 }, 30, Pitch::up20deg },
-            { { 58, 48, 29 }, 30, Pitch::up20deg },
-            { { 59, 48, 30 }, 32, Pitch::up20deg },
-            { { 60, 48, 30 }, 32, Pitch::up20deg },
-            { { 61, 48, 31 }, 32, Pitch::up20deg },
-            { { 62, 48, 31 }, 32, Pitch::up20deg },
-        });
-
-    // 0x4e95a2
-    // Track 23. Reversed 0. Direction 2
-    static constexpr auto moveInfoT23R0D2 = std::to_array<MoveInfo>(
-        {
-            { { 0, 16, 0 }, 32, Pitch::up20deg },
-            { { 1, 16, 0 }, 32, Pitch::up20deg },
-            { { 2, 16, 0 }, 32, Pitch::up20deg },
-            { { 3, 16, 1 }, 32, Pitch::up20deg },
-            { { 4, 16, 1 }, 32, Pitch::up20deg },
-            { { 5, 16, 2 }, 34, Pitch::up20deg },
-            { { 6, 16, 2 }, 34, Pitch::up20deg },
-            { { 7, 15, 2 }, 34, Pitch::up20deg },
-            { { 8, 15, 3 }, 34, Pitch::up20deg },
-            { { 9, 15, 3 }, 34, Pitch::up20deg },
-            { { 10, 15, 4 }, 34, Pitch::up20deg },
-            { { 11, 15, 4 }, 34, Pitch::up20deg },
-            { { 12, 15, 4 }, 34, Pitch::up20deg },
-            { { 13, 14, 5 }, 34, Pitch::up20deg },
-            { { 14, 14, 5 }, 36, Pitch::up20deg },
-            { { 15, 14, 6 }, 36, Pitch::up20deg },
-            { { 16, 13, 6 }, 36, Pitch::up20deg },
-            { { 17, 13, 7 }, 36, Pitch::up20deg },
-            { { 18, 13, 7 }, 36, Pitch::up20deg },
-            { { 19, 12, 8 }, 36, Pitch::up20deg },
-            { { 20, 12, 8 }, 36, Pitch::up20deg },
-            { { 21, 11, 9 }, 36, Pitch::up20deg },
-            { { 22, 11, 9 }, 36, Pitch::up20deg },
-            { { 23, 10, 10 }, 38, Pitch::up20deg },
-            { { 24, 10, 10 }, 38, Pitch::up20deg },
-            { { 25, 9, 11 }, 38, Pitch::up20deg },
-            { { 26, 9, 11 }, 38, Pitch::up20deg },
-            { { 27, 8, 11 }, 38, Pitch::up20deg },
-            { { 28, 7, 12 }, 38, Pitch::up20deg },
-            { { 29, 7, 13 }, 38, Pitch::up20deg },
-            { { 30, 6, 13 }, 38, Pitch::up20deg },
-            { { 31, 5, 14 }, 40, Pitch::up20deg },
-            { { 32, 4, 14 }, 40, Pitch::up20deg },
-            { { 33, 3, 15 }, 40, Pitch::up20deg },
-            { { 35, 3, 15 }, 40, Pitch::up20deg },
-            { { 36, 2, 16 }, 40, Pitch::up20deg },
-            { { 37, 1, 16 }, 40, Pitch::up20deg },
-            { { 38, 0, 17 }, 40, Pitch::up20deg },
-            { { 39, -1, 17 }, 42, Pitch::up20deg },
-            { { 39, -2, 18 }, 42, Pitch::up20deg },
-            { { 40, -3, 18 }, 42, Pitch::up20deg },
-            { { 41, -4, 19 }, 42, Pitch::up20deg },
-            { { 41, -5, 19 }, 42, Pitch::up20deg },
-            { { 42, -6, 20 }, 42, Pitch::up20deg },
-            { { 42, -7, 20 }, 42, Pitch::up20deg },
-            { { 43, -8, 21 }, 42, Pitch::up20deg },
-            { { 43, -9, 21 }, 44, Pitch::up20deg },
-            { { 44, -10, 22 }, 44, Pitch::up20deg },
-            { { 44, -11, 22 }, 44, Pitch::up20deg },
-            { { 45, -12, 23 }, 44, Pitch::up20deg },
-            { { 45, -13, 23 }, 44, Pitch::up20deg },
-            { { 45, -14, 24 }, 44, Pitch::up20deg },
-            { { 46, -15, 24 }, 44, Pitch::up20deg },
-            { { 46, -16, 25 }, 44, Pitch::up20deg },
-            { { 46, -17, 25 }, 44, Pitch::up20deg },
-            { { 47, -18, 25 }, 46, Pitch::up20deg },
-            { { 47, -19, 26 }, 46, Pitch::up20deg },
-            { { 47, -20, 26 }, 46, Pitch::up20deg },
-            { { 47, -21, 27 }, 46, Pitch::up20deg },
-            { { 47, -22, 27 }, 46, Pitch::up20deg },
-            { { 47, -23, 28 }, 46, Pitch::up20deg },
-            { { 48, -24, 28 }, 46, Pitch::up20deg },
-            { { 48, -25, 29 }, 46, Pitch::up20deg },
-            { { 48, -26, 29 }, 46, Pitch::up20deg },
-            { { 48, -27, 29 }, 48, Pitch::up20deg },
-            { { 48, -28, 30 }, 48, Pitch::up20deg },
-            { { 48, -29, 30 }, 48, Pitch::up20deg },
-            { { 48, -30, 31 }, 48, Pitch::up20deg },
-            { { 48, -31, 31 }, 48, Pitch::up20deg },
-        });
-
-    // 0x4e97cc
-    // Track 23. Reversed 0. Direction 3
-    static constexpr auto moveInfoT23R0D3 = std::to_array<MoveInfo>(
-        {
-            { { 16, 31, 0 }, 48, Pitch::up20deg },
-            { { 16, 30, 0 }, 48, Pitch::up20deg },
-            { { 16, 29, 1 }, 48, Pitch::up20deg },
-            { { 16, 28, 1 }, 48, Pitch::up20deg },
-            { { 16, 27, 2 }, 50, Pitch::up20deg },
-            { { 16, 26, 2 }, 50, Pitch::up20deg },
-            { { 15, 25, 2 }, 50, Pitch::up20deg },
-            { { 15, 24, 3 }, 50, Pitch::up20deg },
-            { { 15, 23, 3 }, 50, Pitch::up20deg },
-            { { 15, 22, 4 }, 50, Pitch::up20deg },
-            { { 15, 21, 4 }, 50, Pitch::up20deg },
-            { { 15, 20, 4 }, 50, Pitch::up20deg },
-            { { 14, 19, 5 }, 50, Pitch::up20deg },
-            { { 14, 18, 5 }, 52, Pitch::up20deg },
-            { { 14, 17, 6 }, 52, Pitch::up20deg },
-            { { 13, 16, 6 }, 52, Pitch::up20deg },
-            { { 13, 15, 7 }, 52, Pitch::up20deg },
-            { { 13, 14, 7 }, 52, Pitch::up20deg },
-            { { 12, 13, 8 }, 52, Pitch::up20deg },
-            { { 12, 12, 8 }, 52, Pitch::up20deg },
-            { { 11, 11, 9 }, 52, Pitch::up20deg },
-            { { 11, 10, 9 }, 52, Pitch::up20deg },
-            { { 10, 9, 10 }, 54, Pitch::up20deg },
-            { { 10, 8, 10 }, 54, Pitch::up20deg },
-            { { 9, 7, 11 }, 54, Pitch::up20deg },
-            { { 9, 6, 11 }, 54, Pitch::up20deg },
-            { { 8, 5, 11 }, 54, Pitch::up20deg },
-            { { 7, 4, 12 }, 54, Pitch::up20deg },
-            { { 7, 3, 13 }, 54, Pitch::up20deg },
-            { { 6, 2, 13 }, 54, Pitch::up20deg },
-            { { 5, 1, 14 }, 56, Pitch::up20deg },
-            { { 4, 0, 14 }, 56, Pitch::up20deg },
-            { { 3, -1, 15 }, 56, Pitch::up20deg },
-            { { 3, -3, 15 }, 56, Pitch::up20deg },
-            { { 2, -4, 16 }, 56, Pitch::up20deg },
-            { { 1, -5, 16 }, 56, Pitch::up20deg },
-            { { 0, -6, 17 }, 56, Pitch::up20deg },
-            { { -1, -7, 17 }, 58, Pitch::up20deg },
-            { { -2, -7, 18 }, 58, Pitch::up20deg },
-            { { -3, -8, 18 }, 58, Pitch::up20deg },
-            { { -4, -9, 19 }, 58, Pitch::up20deg },
-            { { -5, -9, 19 }, 58, Pitch::up20deg },
-            { { -6, -10, 20 }, 58, Pitch::up20deg },
-            { { -7, -10, 20 }, 58, Pitch::up20deg },
-            { { -8, -11, 21 }, 58, Pitch::up20deg },
-            { { -9, -11, 21 }, 60, Pitch::up20deg },
-            { { -10, -12, 22 }, 60, Pitch::up20deg },
-            { { -11, -12, 22 }, 60, Pitch::up20deg },
-            { { -12, -13, 23 }, 60, Pitch::up20deg },
-            { { -13, -13, 23 }, 60, Pitch::up20deg },
-            { { -14, -13, 24 }, 60, Pitch::up20deg },
-            { { -15, -14, 24 }, 60, Pitch::up20deg },
-            { { -16, -14, 25 }, 60, Pitch::up20deg },
-            { { -17, -14, 25 }, 60, Pitch::up20deg },
-            { { -18, -15, 25 }, 62, Pitch::up20deg },
-            { { -19, -15, 26 }, 62, Pitch::up20deg },
-            { { -20, -15, 26 }, 62, Pitch::up20deg },
-            { { -21, -15, 27 }, 62, Pitch::up20deg },
-            { { -22, -15, 27 }, 62, Pitch::up20deg },
-            { { -23, -15, 28 }, 62, Pitch::up20deg },
-            { { -24, -16, 28 }, 62, Pitch::up20deg },
-            { { -25, -16, 29 }, 62, Pitch::up20deg },
-            { { -26, -16, 29 }, 62, Pitch::up20deg },
-            { { -27, -16, 29 }, 0, Pitch::up20deg },
-            { { -28, -16, 30 }, 0, Pitch::up20deg },
-            { { -29, -16, 30 }, 0, Pitch::up20deg },
-            { { -30, -16, 31 }, 0, Pitch::up20deg },
-            { { -31, -16, 31 }, 0, Pitch::up20deg },
-        });
-
-    // 0x4ea05c
-    // Track 23. Reversed 1. Direction 0
-    static constexpr auto moveInfoT23R1D0 = std::to_array<MoveInfo>(
-        {
-            { { 16, 31, 0 }, 48, Pitch::down20deg },
-            { { 16, 30, 0 }, 48, Pitch::down20deg },
-            { { 16, 29, -1 }, 48, Pitch::down20deg },
-            { { 16, 28, -1 }, 48, Pitch::down20deg },
-            { { 16, 27, -2 }, 46, Pitch::down20deg },
-            { { 16, 26, -2 }, 46, Pitch::down20deg },
-            { { 17, 25, -2 }, 46, Pitch::down20deg },
-            { { 17, 24, -3 }, 46, Pitch::down20deg },
-            { { 17, 23, -3 }, 46, Pitch::down20deg },
-            { { 17, 22, -4 }, 46, Pitch::down20deg },
-            { { 17, 21, -4 }, 46, Pitch::down20deg },
-            { { 17, 20, -5 }, 46, Pitch::down20deg },
-            { { 18, 19, -5 }, 46, Pitch::down20deg },
-            { { 18, 18, -6 }, 44, Pitch::down20deg },
-            { { 18, 17, -6 }, 44, Pitch::down20deg },
-            { { 19, 16, -6 }, 44, Pitch::down20deg },
-            { { 19, 15, -7 }, 44, Pitch::down20deg },
-            { { 19, 14, -7 }, 44, Pitch::down20deg },
-            { { 20, 13, -8 }, 44, Pitch::down20deg },
-            { { 20, 12, -8 }, 44, Pitch::down20deg },
-            { { 21, 11, -9 }, 44, Pitch::down20deg },
-            { { 21, 10, -9 }, 44, Pitch::down20deg },
-            { { 22, 9, -10 }, 42, Pitch::down20deg },
-            { { 22, 8, -10 }, 42, Pitch::down20deg },
-            { { 23, 7, -11 }, 42, Pitch::down20deg },
-            { { 23, 6, -11 }, 42, Pitch::down20deg },
-            { { 24, 5, -12 }, 42, Pitch::down20deg },
-            { { 25, 4, -12 }, 42, Pitch::down20deg },
-            { { 25, 3, -13 }, 42, Pitch::down20deg },
-            { { 26, 2, -13 }, 42, Pitch::down20deg },
-            { { 27, 1, -14 }, 40, Pitch::down20deg },
-            { { 28, 0, -14 }, 40, Pitch::down20deg },
-            { { 29, -1, -15 }, 40, Pitch::down20deg },
-            { { 29, -3, -16 }, 40, Pitch::down20deg },
-            { { 30, -4, -16 }, 40, Pitch::down20deg },
-            { { 31, -5, -16 }, 40, Pitch::down20deg },
-            { { 32, -6, -17 }, 40, Pitch::down20deg },
-            { { 33, -7, -18 }, 38, Pitch::down20deg },
-            { { 34, -7, -18 }, 38, Pitch::down20deg },
-            { { 35, -8, -19 }, 38, Pitch::down20deg },
-            { { 36, -9, -19 }, 38, Pitch::down20deg },
-            { { 37, -9, -20 }, 38, Pitch::down20deg },
-            { { 38, -10, -20 }, 38, Pitch::down20deg },
-            { { 39, -10, -21 }, 38, Pitch::down20deg },
-            { { 40, -11, -21 }, 38, Pitch::down20deg },
-            { { 41, -11, -22 }, 36, Pitch::down20deg },
-            { { 42, -12, -22 }, 36, Pitch::down20deg },
-            { { 43, -12, -23 }, 36, Pitch::down20deg },
-            { { 44, -13, -23 }, 36, Pitch::down20deg },
-            { { 45, -13, -24 }, 36, Pitch::down20deg },
-            { { 46, -13, -24 }, 36, Pitch::down20deg },
-            { { 47, -14, -24 }, 36, Pitch::down20deg },
-            { { 48, -14, -25 }, 36, Pitch::down20deg },
-            { { 49, -14, -25 }, 36, Pitch::down20deg },
-            { { 50, -15, -26 }, 34, Pitch::down20deg },
-            { { 51, -15, -26 }, 34, Pitch::down20deg },
-            { { 52, -15, -27 }, 34, Pitch::down20deg },
-            { { 53, -15, -27 }, 34, Pitch::down20deg },
-            { { 54, -15, -28 }, 34, Pitch::down20deg },
-            { { 55, -15, -28 }, 34, Pitch::down20deg },
-            { { 56, -16, -28 }, 34, Pitch::down20deg },
-            { { 57, -16, -29 }, 34, Pitch::down20deg },
-            { { 58, -16, -29 }, 34, Pitch::down20deg },
-            { { 59, -16, -30 }, 32, Pitch::down20deg },
-            { { 60, -16, -30 }, 32, Pitch::down20deg },
-            { { 61, -16, -31 }, 32, Pitch::down20deg },
-            { { 62, -16, -31 }, 32, Pitch::down20deg },
-        });
-
-    // 0x4e99ee
-    // Track 23. Reversed 1. Direction 1
-    static constexpr auto moveInfoT23R1D1 = std::to_array<MoveInfo>(
-        {
-            { { 31, 16, 0 }, 0, Pitch::down20deg },
-            { { 30, 16, 0 }, 0, Pitch::down20deg },
-            { { 29, 16, -1 }, 0, Pitch::down20deg },
-            { { 28, 16, -1 }, 0, Pitch::down20deg },
-            { { 27, 16, -2 }, 62, Pitch::down20deg },
-            { { 26, 16, -2 }, 62, Pitch::down20deg },
-            { { 25, 15, -2 }, 62, Pitch::down20deg },
-            { { 24, 15, -3 }, 62, Pitch::down20deg },
-            { { 23, 15, -3 }, 62, Pitch::down20deg },
-            { { 22, 15, -4 }, 62, Pitch::down20deg },
-            { { 21, 15, -4 }, 62, Pitch::down20deg },
-            { { 20, 15, -4 }, 62, Pitch::down20deg },
-            { { 19, 14, -5 }, 62, Pitch::down20deg },
-            { { 18, 14, -5 }, 60, Pitch::down20deg },
-            { { 17, 14, -6 }, 60, Pitch::down20deg },
-            { { 16, 13, -6 }, 60, Pitch::down20deg },
-            { { 15, 13, -7 }, 60, Pitch::down20deg },
-            { { 14, 13, -7 }, 60, Pitch::down20deg },
-            { { 13, 12, -8 }, 60, Pitch::down20deg },
-            { { 12, 12, -8 }, 60, Pitch::down20deg },
-            { { 11, 11, -9 }, 60, Pitch::down20deg },
-            { { 10, 11, -9 }, 60, Pitch::down20deg },
-            { { 9, 10, -10 }, 58, Pitch::down20deg },
-            { { 8, 10, -10 }, 58, Pitch::down20deg },
-            { { 7, 9, -11 }, 58, Pitch::down20deg },
-            { { 6, 9, -11 }, 58, Pitch::down20deg },
-            { { 5, 8, -11 }, 58, Pitch::down20deg },
-            { { 4, 7, -12 }, 58, Pitch::down20deg },
-            { { 3, 7, -13 }, 58, Pitch::down20deg },
-            { { 2, 6, -13 }, 58, Pitch::down20deg },
-            { { 1, 5, -14 }, 56, Pitch::down20deg },
-            { { 0, 4, -14 }, 56, Pitch::down20deg },
-            { { -1, 3, -15 }, 56, Pitch::down20deg },
-            { { -3, 3, -15 }, 56, Pitch::down20deg },
-            { { -4, 2, -16 }, 56, Pitch::down20deg },
-            { { -5, 1, -16 }, 56, Pitch::down20deg },
-            { { -6, 0, -17 }, 56, Pitch::down20deg },
-            { { -7, -1, -17 }, 54, Pitch::down20deg },
-            { { -7, -2, -18 }, 54, Pitch::down20deg },
-            { { -8, -3, -18 }, 54, Pitch::down20deg },
-            { { -9, -4, -19 }, 54, Pitch::down20deg },
-            { { -9, -5, -20 }, 54, Pitch::down20deg },
-            { { -10, -6, -20 }, 54, Pitch::down20deg },
-            { { -10, -7, -20 }, 54, Pitch::down20deg },
-            { { -11, -8, -21 }, 54, Pitch::down20deg },
-            { { -11, -9, -21 }, 52, Pitch::down20deg },
-            { { -12, -10, -22 }, 52, Pitch::down20deg },
-            { { -12, -11, -22 }, 52, Pitch::down20deg },
-            { { -13, -12, -23 }, 52, Pitch::down20deg },
-            { { -13, -13, -23 }, 52, Pitch::down20deg },
-            { { -13, -14, -24 }, 52, Pitch::down20deg },
-            { { -14, -15, -24 }, 52, Pitch::down20deg },
-            { { -14, -16, -25 }, 52, Pitch::down20deg },
-            { { -14, -17, -25 }, 52, Pitch::down20deg },
-            { { -15, -18, -26 }, 50, Pitch::down20deg },
-            { { -15, -19, -26 }, 50, Pitch::down20deg },
-            { { -15, -20, -27 }, 50, Pitch::down20deg },
-            { { -15, -21, -27 }, 50, Pitch::down20deg },
-            { { -15, -22, -27 }, 50, Pitch::down20deg },
-            { { -15, -23, -28 }, 50, Pitch::down20deg },
-            { { -16, -24, -28 }, 50, Pitch::down20deg },
-            { { -16, -25, -29 }, 50, Pitch::down20deg },
-            { { -16, -26, -29 }, 50, Pitch::down20deg },
-            { { -16, -27, -29 }, 48, Pitch::down20deg },
-            { { -16, -28, -30 }, 48, Pitch::down20deg },
-            { { -16, -29, -30 }, 48, Pitch::down20deg },
-            { { -16, -30, -31 }, 48, Pitch::down20deg },
-            { { -16, -31, -32 }, 48, Pitch::down20deg },
-        });
-
-    // 0x4e9c10
-    // Track 23. Reversed 1. Direction 2
-    static constexpr auto moveInfoT23R1D2 = std::to_array<MoveInfo>(
-        {
-            { { 16, 0, 0 }, 16, Pitch::down20deg },
-            { { 16, 1, 0 }, 16, Pitch::down20deg },
-            { { 16, 2, 0 }, 16, Pitch::down20deg },
-            { { 16, 3, -1 }, 16, Pitch::down20deg },
-            { { 16, 4, -1 }, 16, Pitch::down20deg },
-            { { 16, 5, -2 }, 14, Pitch::down20deg },
-            { { 16, 6, -2 }, 14, Pitch::down20deg },
-            { { 15, 7, -2 }, 14, Pitch::down20deg },
-            { { 15, 8, -3 }, 14, Pitch::down20deg },
-            { { 15, 9, -3 }, 14, Pitch::down20deg },
-            { { 15, 10, -4 }, 14, Pitch::down20deg },
-            { { 15, 11, -4 }, 14, Pitch::down20deg },
-            { { 15, 12, -4 }, 14, Pitch::down20deg },
-            { { 14, 13, -5 }, 14, Pitch::down20deg },
-            { { 14, 14, -5 }, 12, Pitch::down20deg },
-            { { 14, 15, -6 }, 12, Pitch::down20deg },
-            { { 13, 16, -6 }, 12, Pitch::down20deg },
-            { { 13, 17, -7 }, 12, Pitch::down20deg },
-            { { 13, 18, -7 }, 12, Pitch::down20deg },
-            { { 12, 19, -8 }, 12, Pitch::down20deg },
-            { { 12, 20, -8 }, 12, Pitch::down20deg },
-            { { 11, 21, -9 }, 12, Pitch::down20deg },
-            { { 11, 22, -9 }, 12, Pitch::down20deg },
-            { { 10, 23, -10 }, 10, Pitch::down20deg },
-            { { 10, 24, -10 }, 10, Pitch::down20deg },
-            { { 9, 25, -11 }, 10, Pitch::down20deg },
-            { { 9, 26, -11 }, 10, Pitch::down20deg },
-            { { 8, 27, -11 }, 10, Pitch::down20deg },
-            { { 7, 28, -12 }, 10, Pitch::down20deg },
-            { { 7, 29, -13 }, 10, Pitch::down20deg },
-            { { 6, 30, -13 }, 10, Pitch::down20deg },
-            { { 5, 31, -14 }, 8, Pitch::down20deg },
-            { { 4, 32, -14 }, 8, Pitch::down20deg },
-            { { 3, 33, -15 }, 8, Pitch::down20deg },
-            { { 3, 35, -15 }, 8, Pitch::down20deg },
-            { { 2, 36, -16 }, 8, Pitch::down20deg },
-            { { 1, 37, -16 }, 8, Pitch::down20deg },
-            { { 0, 38, -17 }, 8, Pitch::down20deg },
-            { { -1, 39, -17 }, 6, Pitch::down20deg },
-            { { -2, 39, -18 }, 6, Pitch::down20deg },
-            { { -3, 40, -18 }, 6, Pitch::down20deg },
-            { { -4, 41, -19 }, 6, Pitch::down20deg },
-            { { -5, 41, -20 }, 6, Pitch::down20deg },
-            { { -6, 42, -20 }, 6, Pitch::down20deg },
-            { { -7, 42, -20 }, 6, Pitch::down20deg },
-            { { -8, 43, -21 }, 6, Pitch::down20deg },
-            { { -9, 43, -21 }, 4, Pitch::down20deg },
-            { { -10, 44, -22 }, 4, Pitch::down20deg },
-            { { -11, 44, -22 }, 4, Pitch::down20deg },
-            { { -12, 45, -23 }, 4, Pitch::down20deg },
-            { { -13, 45, -23 }, 4, Pitch::down20deg },
-            { { -14, 45, -24 }, 4, Pitch::down20deg },
-            { { -15, 46, -24 }, 4, Pitch::down20deg },
-            { { -16, 46, -25 }, 4, Pitch::down20deg },
-            { { -17, 46, -25 }, 4, Pitch::down20deg },
-            { { -18, 47, -26 }, 2, Pitch::down20deg },
-            { { -19, 47, -26 }, 2, Pitch::down20deg },
-            { { -20, 47, -27 }, 2, Pitch::down20deg },
-            { { -21, 47, -27 }, 2, Pitch::down20deg },
-            { { -22, 47, -27 }, 2, Pitch::down20deg },
-            { { -23, 47, -28 }, 2, Pitch::down20deg },
-            { { -24, 48, -28 }, 2, Pitch::down20deg },
-            { { -25, 48, -29 }, 2, Pitch::down20deg },
-            { { -26, 48, -29 }, 2, Pitch::down20deg },
-            { { -27, 48, -29 }, 0, Pitch::down20deg },
-            { { -28, 48, -30 }, 0, Pitch::down20deg },
-            { { -29, 48, -30 }, 0, Pitch::down20deg },
-            { { -30, 48, -31 }, 0, Pitch::down20deg },
-            { { -31, 48, -32 }, 0, Pitch::down20deg },
-        });
-
-    // 0x4e9e3a
-    // Track 23. Reversed 1. Direction 3
-    static constexpr auto moveInfoT23R1D3 = std::to_array<MoveInfo>(
-        {
-            { { 0, 16, 0 }, 32, Pitch::down20deg },
-            { { 1, 16, 0 }, 32, Pitch::down20deg },
-            { { 2, 16, 0 }, 32, Pitch::down20deg },
-            { { 3, 16, -1 }, 32, Pitch::down20deg },
-            { { 4, 16, -1 }, 32, Pitch::down20deg },
-            { { 5, 16, -2 }, 30, Pitch::down20deg },
-            { { 6, 16, -2 }, 30, Pitch::down20deg },
-            { { 7, 17, -2 }, 30, Pitch::down20deg },
-            { { 8, 17, -3 }, 30, Pitch::down20deg },
-            { { 9, 17, -3 }, 30, Pitch::down20deg },
-            { { 10, 17, -4 }, 30, Pitch::down20deg },
-            { { 11, 17, -4 }, 30, Pitch::down20deg },
-            { { 12, 17, -5 }, 30, Pitch::down20deg },
-            { { 13, 18, -5 }, 30, Pitch::down20deg },
-            { { 14, 18, -6 }, 28, Pitch::down20deg },
-            { { 15, 18, -6 }, 28, Pitch::down20deg },
-            { { 16, 19, -6 }, 28, Pitch::down20deg },
-            { { 17, 19, -7 }, 28, Pitch::down20deg },
-            { { 18, 19, -7 }, 28, Pitch::down20deg },
-            { { 19, 20, -8 }, 28, Pitch::down20deg },
-            { { 20, 20, -8 }, 28, Pitch::down20deg },
-            { { 21, 21, -9 }, 28, Pitch::down20deg },
-            { { 22, 21, -9 }, 28, Pitch::down20deg },
-            { { 23, 22, -10 }, 26, Pitch::down20deg },
-            { { 24, 22, -10 }, 26, Pitch::down20deg },
-            { { 25, 23, -11 }, 26, Pitch::down20deg },
-            { { 26, 23, -11 }, 26, Pitch::down20deg },
-            { { 27, 24, -12 }, 26, Pitch::down20deg },
-            { { 28, 25, -12 }, 26, Pitch::down20deg },
-            { { 29, 25, -13 }, 26, Pitch::down20deg },
-            { { 30, 26, -13 }, 26, Pitch::down20deg },
-            { { 31, 27, -14 }, 24, Pitch::down20deg },
-            { { 32, 28, -14 }, 24, Pitch::down20deg },
-            { { 33, 29, -15 }, 24, Pitch::down20deg },
-            { { 35, 29, -16 }, 24, Pitch::down20deg },
-            { { 36, 30, -16 }, 24, Pitch::down20deg },
-            { { 37, 31, -16 }, 24, Pitch::down20deg },
-            { { 38, 32, -17 }, 24, Pitch::down20deg },
-            { { 39, 33, -18 }, 22, Pitch::down20deg },
-            { { 39, 34, -18 }, 22, Pitch::down20deg },
-            { { 40, 35, -19 }, 22, Pitch::down20deg },
-            { { 41, 36, -19 }, 22, Pitch::down20deg },
-            { { 41, 37, -20 }, 22, Pitch::down20deg },
-            { { 42, 38, -20 }, 22, Pitch::down20deg },
-            { { 42, 39, -21 }, 22, Pitch::down20deg },
-            { { 43, 40, -21 }, 22, Pitch::down20deg },
-            { { 43, 41, -22 }, 20, Pitch::down20deg },
-            { { 44, 42, -22 }, 20, Pitch::down20deg },
-            { { 44, 43, -23 }, 20, Pitch::down20deg },
-            { { 45, 44, -23 }, 20, Pitch::down20deg },
-            { { 45, 45, -24 }, 20, Pitch::down20deg },
-            { { 45, 46, -24 }, 20, Pitch::down20deg },
-            { { 46, 47, -24 }, 20, Pitch::down20deg },
-            { { 46, 48, -25 }, 20, Pitch::down20deg },
-            { { 46, 49, -25 }, 20, Pitch::down20deg },
-            { { 47, 50, -26 }, 18, Pitch::down20deg },
-            { { 47, 51, -26 }, 18, Pitch::down20deg },
-            { { 47, 52, -27 }, 18, Pitch::down20deg },
-            { { 47, 53, -27 }, 18, Pitch::down20deg },
-            { { 47, 54, -28 }, 18, Pitch::down20deg },
-            { { 47, 55, -28 }, 18, Pitch::down20deg },
-            { { 48, 56, -28 }, 18, Pitch::down20deg },
-            { { 48, 57, -29 }, 18, Pitch::down20deg },
-            { { 48, 58, -29 }, 18, Pitch::down20deg },
-            { { 48, 59, -30 }, 16, Pitch::down20deg },
-            { { 48, 60, -30 }, 16, Pitch::down20deg },
-            { { 48, 61, -31 }, 16, Pitch::down20deg },
-            { { 48, 62, -31 }, 16, Pitch::down20deg },
-        });
-
-    // 0x4dc556
-    // Track 26. Reversed 0. Direction 0
-    static constexpr auto moveInfoT26R0D0 = std::to_array<MoveInfo>(
-        {
-            { { 31, 8, 0 }, 0, Pitch::flat },
-            { { 30, 8, 0 }, 0, Pitch::flat },
-            { { 29, 8, 0 }, 0, Pitch::flat },
-            { { 28, 8, 0 }, 0, Pitch::flat },
-            { { 27, 8, 0 }, 0, Pitch::flat },
-            { { 26, 8, 0 }, 0, Pitch::flat },
-            { { 25, 8, 0 }, 0, Pitch::flat },
-            { { 24, 8, 0 }, 0, Pitch::flat },
-            { { 23, 8, 0 }, 0, Pitch::flat },
-            { { 22, 8, 0 }, 0, Pitch::flat },
-            { { 21, 8, 0 }, 0, Pitch::flat },
-            { { 20, 8, 0 }, 0, Pitch::flat },
-            { { 19, 8, 0 }, 0, Pitch::flat },
-            { { 18, 8, 0 }, 0, Pitch::flat },
-            { { 17, 8, 0 }, 0, Pitch::flat },
-            { { 16, 8, 0 }, 0, Pitch::flat },
-            { { 15, 8, 0 }, 0, Pitch::flat },
-            { { 14, 8, 0 }, 0, Pitch::flat },
-            { { 13, 8, 0 }, 0, Pitch::flat },
-            { { 12, 8, 0 }, 0, Pitch::flat },
-            { { 11, 8, 0 }, 0, Pitch::flat },
-            { { 10, 8, 0 }, 0, Pitch::flat },
-            { { 9, 8, 0 }, 0, Pitch::flat },
-            { { 8, 8, 0 }, 0, Pitch::flat },
-            { { 7, 8, 0 }, 0, Pitch::flat },
-            { { 6, 8, 0 }, 0, Pitch::flat },
-            { { 5, 8, 0 }, 0, Pitch::flat },
-            { { 4, 8, 0 }, 0, Pitch::flat },
-            { { 3, 8, 0 }, 0, Pitch::flat },
-            { { 2, 8, 0 }, 0, Pitch::flat },
-            { { 1, 8, 0 }, 0, Pitch::flat },
-            { { 0, 8, 0 }, 0, Pitch::flat },
-        });
-
-    // 0x4dc658
-    // Track 26. Reversed 0. Direction 1
-    static constexpr auto moveInfoT26R0D1 = std::to_array<MoveInfo>(
-        {
-            { { 8, 0, 0 }, 16, Pitch::flat },
-            { { 8, 1, 0 }, 16, Pitch::flat },
-            { { 8, 2, 0 }, 16, Pitch::flat },
-            { { 8, 3, 0 }, 16, Pitch::flat },
-            { { 8, 4, 0 }, 16, Pitch::flat },
-            { { 8, 5, 0 }, 16, Pitch::flat },
-            { { 8, 6, 0 }, 16, Pitch::flat },
-            { { 8, 7, 0 }, 16, Pitch::flat },
-            { { 8, 8, 0 }, 16, Pitch::flat },
-            { { 8, 9, 0 }, 16, Pitch::flat },
-            { { 8, 10, 0 }, 16, Pitch::flat },
-            { { 8, 11, 0 }, 16, Pitch::flat },
-            { { 8, 12, 0 }, 16, Pitch::flat },
-            { { 8, 13, 0 }, 16, Pitch::flat },
-            { { 8, 14, 0 }, 16, Pitch::flat },
-            { { 8, 15, 0 }, 16, Pitch::flat },
-            { { 8, 16, 0 }, 16, Pitch::flat },
-            { { 8, 17, 0 }, 16, Pitch::flat },
-            { { 8, 18, 0 }, 16, Pitch::flat },
-            { { 8, 19, 0 }, 16, Pitch::flat },
-            { { 8, 20, 0 }, 16, Pitch::flat },
-            { { 8, 21, 0 }, 16, Pitch::flat },
-            { { 8, 22, 0 }, 16, Pitch::flat },
-            { { 8, 23, 0 }, 16, Pitch::flat },
-            { { 8, 24, 0 }, 16, Pitch::flat },
-            { { 8, 25, 0 }, 16, Pitch::flat },
-            { { 8, 26, 0 }, 16, Pitch::flat },
-            { { 8, 27, 0 }, 16, Pitch::flat },
-            { { 8, 28, 0 }, 16, Pitch::flat },
-            { { 8, 29, 0 }, 16, Pitch::flat },
-            { { 8, 30, 0 }, 16, Pitch::flat },
-            { { 8, 31, 0 }, 16, Pitch::flat },
-        });
-
-    // 0x4dc75a
-    // Track 26. Reversed 0. Direction 2
-    static constexpr auto moveInfoT26R0D2 = std::to_array<MoveInfo>(
-        {
-            { { 0, 24, 0 }, 32, Pitch::flat },
-            { { 1, 24, 0 }, 32, Pitch::flat },
-            { { 2, 24, 0 }, 32, Pitch::flat },
-            { { 3, 24, 0 }, 32, Pitch::flat },
-            { { 4, 24, 0 }, 32, Pitch::flat },
-            { { 5, 24, 0 }, 32, Pitch::flat },
-            { { 6, 24, 0 }, 32, Pitch::flat },
-            { { 7, 24, 0 }, 32, Pitch::flat },
-            { { 8, 24, 0 }, 32, Pitch::flat },
-            { { 9, 24, 0 }, 32, Pitch::flat },
-            { { 10, 24, 0 }, 32, Pitch::flat },
-            { { 11, 24, 0 }, 32, Pitch::flat },
-            { { 12, 24, 0 }, 32, Pitch::flat },
-            { { 13, 24, 0 }, 32, Pitch::flat },
-            { { 14, 24, 0 }, 32, Pitch::flat },
-            { { 15, 24, 0 }, 32, Pitch::flat },
-            { { 16, 24, 0 }, 32, Pitch::flat },
-            { { 17, 24, 0 }, 32, Pitch::flat },
-            { { 18, 24, 0 }, 32, Pitch::flat },
-            { { 19, 24, 0 }, 32, Pitch::flat },
-            { { 20, 24, 0 }, 32, Pitch::flat },
-            { { 21, 24, 0 }, 32, Pitch::flat },
-            { { 22, 24, 0 }, 32, Pitch::flat },
-            { { 23, 24, 0 }, 32, Pitch::flat },
-            { { 24, 24, 0 }, 32, Pitch::flat },
-            { { 25, 24, 0 }, 32, Pitch::flat },
-            { { 26, 24, 0 }, 32, Pitch::flat },
-            { { 27, 24, 0 }, 32, Pitch::flat },
-            { { 28, 24, 0 }, 32, Pitch::flat },
-            { { 29, 24, 0 }, 32, Pitch::flat },
-            { { 30, 24, 0 }, 32, Pitch::flat },
-            { { 31, 24, 0 }, 32, Pitch::flat },
-        });
-
-    // 0x4dc85c
-    // Track 26. Reversed 0. Direction 3
-    static constexpr auto moveInfoT26R0D3 = std::to_array<MoveInfo>(
-        {
-            { { 24, 31, 0 }, 48, Pitch::flat },
-            { { 24, 30, 0 }, 48, Pitch::flat },
-            { { 24, 29, 0 }, 48, Pitch::flat },
-            { { 24, 28, 0 }, 48, Pitch::flat },
-            { { 24, 27, 0 }, 48, Pitch::flat },
-            { { 24, 26, 0 }, 48, Pitch::flat },
-            { { 24, 25, 0 }, 48, Pitch::flat },
-            { { 24, 24, 0 }, 48, Pitch::flat },
-            { { 24, 23, 0 }, 48, Pitch::flat },
-            { { 24, 22, 0 }, 48, Pitch::flat },
-            { { 24, 21, 0 }, 48, Pitch::flat },
-            { { 24, 20, 0 }, 48, Pitch::flat },
-            { { 24, 19, 0 }, 48, Pitch::flat },
-            { { 24, 18, 0 }, 48, Pitch::flat },
-            { { 24, 17, 0 }, 48, Pitch::flat },
-            { { 24, 16, 0 }, 48, Pitch::flat },
-            { { 24, 15, 0 }, 48, Pitch::flat },
-            { { 24, 14, 0 }, 48, Pitch::flat },
-            { { 24, 13, 0 }, 48, Pitch::flat },
-            { { 24, 12, 0 }, 48, Pitch::flat },
-            { { 24, 11, 0 }, 48, Pitch::flat },
-            { { 24, 10, 0 }, 48, Pitch::flat },
-            { { 24, 9, 0 }, 48, Pitch::flat },
-            { { 24, 8, 0 }, 48, Pitch::flat },
-            { { 24, 7, 0 }, 48, Pitch::flat },
-            { { 24, 6, 0 }, 48, Pitch::flat },
-            { { 24, 5, 0 }, 48, Pitch::flat },
-            { { 24, 4, 0 }, 48, Pitch::flat },
-            { { 24, 3, 0 }, 48, Pitch::flat },
-            { { 24, 2, 0 }, 48, Pitch::flat },
-            { { 24, 1, 0 }, 48, Pitch::flat },
-            { { 24, 0, 0 }, 48, Pitch::flat },
-        });
-
-    // 0x4dcb62
-    // Track 26. Reversed 1. Direction 0
-    static constexpr auto moveInfoT26R1D0 = std::to_array<MoveInfo>(
-        {
-            { { 0, 8, 0 }, 32, Pitch::flat },
-            { { 1, 8, 0 }, 32, Pitch::flat },
-            { { 2, 8, 0 }, 32, Pitch::flat },
-            { { 3, 8, 0 }, 32, Pitch::flat },
-            { { 4, 8, 0 }, 32, Pitch::flat },
-            { { 5, 8, 0 }, 32, Pitch::flat },
-            { { 6, 8, 0 }, 32, Pitch::flat },
-            { { 7, 8, 0 }, 32, Pitch::flat },
-            { { 8, 8, 0 }, 32, Pitch::flat },
-            { { 9, 8, 0 }, 32, Pitch::flat },
-            { { 10, 8, 0 }, 32, Pitch::flat },
-            { { 11, 8, 0 }, 32, Pitch::flat },
-            { { 12, 8, 0 }, 32, Pitch::flat },
-            { { 13, 8, 0 }, 32, Pitch::flat },
-            { { 14, 8, 0 }, 32, Pitch::flat },
-            { { 15, 8, 0 }, 32, Pitch::flat },
-            { { 16, 8, 0 }, 32, Pitch::flat },
-            { { 17, 8, 0 }, 32, Pitch::flat },
-            { { 18, 8, 0 }, 32, Pitch::flat },
-            { { 19, 8, 0 }, 32, Pitch::flat },
-            { { 20, 8, 0 }, 32, Pitch::flat },
-            { { 21, 8, 0 }, 32, Pitch::flat },
-            { { 22, 8, 0 }, 32, Pitch::flat },
-            { { 23, 8, 0 }, 32, Pitch::flat },
-            { { 24, 8, 0 }, 32, Pitch::flat },
-            { { 25, 8, 0 }, 32, Pitch::flat },
-            { { 26, 8, 0 }, 32, Pitch::flat },
-            { { 27, 8, 0 }, 32, Pitch::flat },
-            { { 28, 8, 0 }, 32, Pitch::flat },
-            { { 29, 8, 0 }, 32, Pitch::flat },
-            { { 30, 8, 0 }, 32, Pitch::flat },
-            { { 31, 8, 0 }, 32, Pitch::flat },
-        });
-
-    // 0x4dcc64
-    // Track 26. Reversed 1. Direction 1
-    static constexpr auto moveInfoT26R1D1 = std::to_array<MoveInfo>(
-        {
-            { { 8, 31, 0 }, 48, Pitch::flat },
-            { { 8, 30, 0 }, 48, Pitch::flat },
-            { { 8, 29, 0 }, 48, Pitch::flat },
-            { { 8, 28, 0 }, 48, Pitch::flat },
-            { { 8, 27, 0 }, 48, Pitch::flat },
-            { { 8, 26, 0 }, 48, Pitch::flat },
-            { { 8, 25, 0 }, 48, Pitch::flat },
-            { { 8, 24, 0 }, 48, Pitch::flat },
-            { { 8, 23, 0 }, 48, Pitch::flat },
-            { { 8, 22, 0 }, 48, Pitch::flat },
-            { { 8, 21, 0 }, 48, Pitch::flat },
-            { { 8, 20, 0 }, 48, Pitch::flat },
-            { { 8, 19, 0 }, 48, Pitch::flat },
-            { { 8, 18, 0 }, 48, Pitch::flat },
-            { { 8, 17, 0 }, 48, Pitch::flat },
-            { { 8, 16, 0 }, 48, Pitch::flat },
-            { { 8, 15, 0 }, 48, Pitch::flat },
-            { { 8, 14, 0 }, 48, Pitch::flat },
-            { { 8, 13, 0 }, 48, Pitch::flat },
-            { { 8, 12, 0 }, 48, Pitch::flat },
-            { { 8, 11, 0 }, 48, Pitch::flat },
-            { { 8, 10, 0 }, 48, Pitch::flat },
-            { { 8, 9, 0 }, 48, Pitch::flat },
-            { { 8, 8, 0 }, 48, Pitch::flat },
-            { { 8, 7, 0 }, 48, Pitch::flat },
-            { { 8, 6, 0 }, 48, Pitch::flat },
-            { { 8, 5, 0 }, 48, Pitch::flat },
-            { { 8, 4, 0 }, 48, Pitch::flat },
-            { { 8, 3, 0 }, 48, Pitch::flat },
-            { { 8, 2, 0 }, 48, Pitch::flat },
-            { { 8, 1, 0 }, 48, Pitch::flat },
-            { { 8, 0, 0 }, 48, Pitch::flat },
-        });
-
-    // 0x4dc95e
-    // Track 26. Reversed 1. Direction 2
-    static constexpr auto moveInfoT26R1D2 = std::to_array<MoveInfo>(
-        {
-            { { 31, 24, 0 }, 0, Pitch::flat },
-            { { 30, 24, 0 }, 0, Pitch::flat },
-            { { 29, 24, 0 }, 0, Pitch::flat },
-            { { 28, 24, 0 }, 0, Pitch::flat },
-            { { 27, 24, 0 }, 0, Pitch::flat },
-            { { 26, 24, 0 }, 0, Pitch::flat },
-            { { 25, 24, 0 }, 0, Pitch::flat },
-            { { 24, 24, 0 }, 0, Pitch::flat },
-            { { 23, 24, 0 }, 0, Pitch::flat },
-            { { 22, 24, 0 }, 0, Pitch::flat },
-            { { 21, 24, 0 }, 0, Pitch::flat },
-            { { 20, 24, 0 }, 0, Pitch::flat },
-            { { 19, 24, 0 }, 0, Pitch::flat },
-            { { 18, 24, 0 }, 0, Pitch::flat },
-            { { 17, 24, 0 }, 0, Pitch::flat },
-            { { 16, 24, 0 }, 0, Pitch::flat },
-            { { 15, 24, 0 }, 0, Pitch::flat },
-            { { 14, 24, 0 }, 0, Pitch::flat },
-            { { 13, 24, 0 }, 0, Pitch::flat },
-            { { 12, 24, 0 }, 0, Pitch::flat },
-            { { 11, 24, 0 }, 0, Pitch::flat },
-            { { 10, 24, 0 }, 0, Pitch::flat },
-            { { 9, 24, 0 }, 0, Pitch::flat },
-            { { 8, 24, 0 }, 0, Pitch::flat },
-            { { 7, 24, 0 }, 0, Pitch::flat },
-            { { 6, 24, 0 }, 0, Pitch::flat },
-            { { 5, 24, 0 }, 0, Pitch::flat },
-            { { 4, 24, 0 }, 0, Pitch::flat },
-            { { 3, 24, 0 }, 0, Pitch::flat },
-            { { 2, 24, 0 }, 0, Pitch::flat },
-            { { 1, 24, 0 }, 0, Pitch::flat },
-            { { 0, 24, 0 }, 0, Pitch::flat },
-        });
-
-    // 0x4dca60
-    // Track 26. Reversed 1. Direction 3
-    static constexpr auto moveInfoT26R1D3 = std::to_array<MoveInfo>(
-        {
-            { { 24, 0, 0 }, 16, Pitch::flat },
-            { { 24, 1, 0 }, 16, Pitch::flat },
-            { { 24, 2, 0 }, 16, Pitch::flat },
-            { { 24, 3, 0 }, 16, Pitch::flat },
-            { { 24, 4, 0 }, 16, Pitch::flat },
-            { { 24, 5, 0 }, 16, Pitch::flat },
-            { { 24, 6, 0 }, 16, Pitch::flat },
-            { { 24, 7, 0 }, 16, Pitch::flat },
-            { { 24, 8, 0 }, 16, Pitch::flat },
-            { { 24, 9, 0 }, 16, Pitch::flat },
-            { { 24, 10, 0 }, 16, Pitch::flat },
-            { { 24, 11, 0 }, 16, Pitch::flat },
-            { { 24, 12, 0 }, 16, Pitch::flat },
-            { { 24, 13, 0 }, 16, Pitch::flat },
-            { { 24, 14, 0 }, 16, Pitch::flat },
-            { { 24, 15, 0 }, 16, Pitch::flat },
-            { { 24, 16, 0 }, 16, Pitch::flat },
-            { { 24, 17, 0 }, 16, Pitch::flat },
-            { { 24, 18, 0 }, 16, Pitch::flat },
-            { { 24, 19, 0 }, 16, Pitch::flat },
-            { { 24, 20, 0 }, 16, Pitch::flat },
-            { { 24, 21, 0 }, 16, Pitch::flat },
-            { { 24, 22, 0 }, 16, Pitch::flat },
-            { { 24, 23, 0 }, 16, Pitch::flat },
-            { { 24, 24, 0 }, 16, Pitch::flat },
-            { { 24, 25, 0 }, 16, Pitch::flat },
-            { { 24, 26, 0 }, 16, Pitch::flat },
-            { { 24, 27, 0 }, 16, Pitch::flat },
-            { { 24, 28, 0 }, 16, Pitch::flat },
-            { { 24, 29, 0 }, 16, Pitch::flat },
-            { { 24, 30, 0 }, 16, Pitch::flat },
-            { { 24, 31, 0 }, 16, Pitch::flat },
-        });
-
-    // 0x4eaafe
-    // Track 28. Reversed 0. Direction 0
-    static constexpr auto moveInfoT28R0D0 = std::to_array<MoveInfo>(
-        {
-            { { 31, 8, 0 }, 0, Pitch::flat },
-            { { 30, 8, 0 }, 0, Pitch::flat },
-            { { 29, 8, 0 }, 62, Pitch::flat },
-            { { 28, 7, 0 }, 60, Pitch::flat },
-            { { 27, 7, 0 }, 58, Pitch::flat },
-            { { 26, 6, 0 }, 56, Pitch::flat },
-            { { 25, 5, 0 }, 54, Pitch::flat },
-            { { 25, 4, 0 }, 52, Pitch::flat },
-            { { 24, 3, 0 }, 50, Pitch::flat },
-            { { 24, 2, 0 }, 48, Pitch::flat },
-            { { 24, 1, 0 }, 48, Pitch::flat },
-            { { 24, 0, 0 }, 48, Pitch::flat },
-        });
-
-    // 0x4eab60
-    // Track 28. Reversed 0. Direction 1
-    static constexpr auto moveInfoT28R0D1 = std::to_array<MoveInfo>(
-        {
-            { { 8, 0, 0 }, 16, Pitch::flat },
-            { { 8, 1, 0 }, 16, Pitch::flat },
-            { { 8, 2, 0 }, 14, Pitch::flat },
-            { { 7, 3, 0 }, 12, Pitch::flat },
-            { { 7, 4, 0 }, 10, Pitch::flat },
-            { { 6, 5, 0 }, 8, Pitch::flat },
-            { { 5, 6, 0 }, 8, Pitch::flat },
-            { { 4, 7, 0 }, 6, Pitch::flat },
-            { { 3, 7, 0 }, 4, Pitch::flat },
-            { { 2, 8, 0 }, 2, Pitch::flat },
-            { { 1, 8, 0 }, 0, Pitch::flat },
-            { { 0, 8, 0 }, 0, Pitch::flat },
-        });
-
-    // 0x4eabc2
-    // Track 28. Reversed 0. Direction 2
-    static constexpr auto moveInfoT28R0D2 = std::to_array<MoveInfo>(
-        {
-            { { 0, 24, 0 }, 32, Pitch::flat },
-            { { 1, 24, 0 }, 32, Pitch::flat },
-            { { 2, 24, 0 }, 32, Pitch::flat },
-            { { 3, 24, 0 }, 30, Pitch::flat },
-            { { 4, 25, 0 }, 28, Pitch::flat },
-            { { 5, 25, 0 }, 26, Pitch::flat },
-            { { 6, 26, 0 }, 24, Pitch::flat },
-            { { 7, 27, 0 }, 22, Pitch::flat },
-            { { 7, 28, 0 }, 20, Pitch::flat },
-            { { 8, 29, 0 }, 18, Pitch::flat },
-            { { 8, 30, 0 }, 16, Pitch::flat },
-            { { 8, 31, 0 }, 16, Pitch::flat },
-        });
-
-    // 0x4eac24
-    // Track 28. Reversed 0. Direction 3
-    static constexpr auto moveInfoT28R0D3 = std::to_array<MoveInfo>(
-        {
-            { { 24, 31, 0 }, 48, Pitch::flat },
-            { { 24, 30, 0 }, 48, Pitch::flat },
-            { { 24, 29, 0 }, 46, Pitch::flat },
-            { { 25, 28, 0 }, 44, Pitch::flat },
-            { { 25, 27, 0 }, 42, Pitch::flat },
-            { { 26, 26, 0 }, 40, Pitch::flat },
-            { { 27, 25, 0 }, 38, Pitch::flat },
-            { { 28, 25, 0 }, 36, Pitch::flat },
-            { { 29, 24, 0 }, 34, Pitch::flat },
-            { { 30, 24, 0 }, 32, Pitch::flat },
-            { { 31, 24, 0 }, 32, Pitch::flat },
-        });
-
-    // 0x4eb0c6
-    // Track 28. Reversed 1. Direction 0
-    static constexpr auto moveInfoT28R1D0 = std::to_array<MoveInfo>(
-        {
-            { { 24, 0, 0 }, 16, Pitch::flat },
-            { { 24, 1, 0 }, 16, Pitch::flat },
-            { { 24, 2, 0 }, 16, Pitch::flat },
-            { { 24, 3, 0 }, 18, Pitch::flat },
-            { { 25, 4, 0 }, 20, Pitch::flat },
-            { { 25, 5, 0 }, 22, Pitch::flat },
-            { { 26, 6, 0 }, 24, Pitch::flat },
-            { { 27, 7, 0 }, 26, Pitch::flat },
-            { { 28, 7, 0 }, 28, Pitch::flat },
-            { { 29, 8, 0 }, 30, Pitch::flat },
-            { { 30, 8, 0 }, 32, Pitch::flat },
-            { { 31, 8, 0 }, 32, Pitch::flat },
-        });
-
-    // 0x4eb128
-    // Track 28. Reversed 1. Direction 1
-    static constexpr auto moveInfoT28R1D1 = std::to_array<MoveInfo>(
-        {
-            { { 0, 8, 0 }, 32, Pitch::flat },
-            { { 1, 8, 0 }, 32, Pitch::flat },
-            { { 2, 8, 0 }, 34, Pitch::flat },
-            { { 3, 7, 0 }, 36, Pitch::flat },
-            { { 4, 7, 0 }, 38, Pitch::flat },
-            { { 5, 6, 0 }, 40, Pitch::flat },
-            { { 6, 5, 0 }, 40, Pitch::flat },
-            { { 7, 4, 0 }, 42, Pitch::flat },
-            { { 7, 3, 0 }, 44, Pitch::flat },
-            { { 8, 2, 0 }, 46, Pitch::flat },
-            { { 8, 1, 0 }, 48, Pitch::flat },
-            { { 8, 0, 0 }, 48, Pitch::flat },
-        });
-
-    // 0x4eb18a
-    // Track 28. Reversed 1. Direction 2
-    static constexpr auto moveInfoT28R1D2 = std::to_array<MoveInfo>(
-        {
-            { { 8, 31, 0 }, 48, Pitch::flat },
-            { { 8, 30, 0 }, 48, Pitch::flat },
-            { { 8, 29, 0 }, 50, Pitch::flat },
-            { { 7, 28, 0 }, 52, Pitch::flat },
-            { { 7, 27, 0 }, 54, Pitch::flat },
-            { { 6, 26, 0 }, 56, Pitch::flat },
-            { { 5, 25, 0 }, 58, Pitch::flat },
-            { { 4, 25, 0 }, 60, Pitch::flat },
-            { { 3, 24, 0 }, 62, Pitch::flat },
-            { { 2, 24, 0 }, 0, Pitch::flat },
-            { { 1, 24, 0 }, 0, Pitch::flat },
-            { { 0, 24, 0 }, 0, Pitch::flat },
-        });
-
-    // 0x4eb1ec
-    // Track 28. Reversed 1. Direction 3
-    static constexpr auto moveInfoT28R1D3 = std::to_array<MoveInfo>(
-        {
-            { { 31, 24, 0 }, 0, Pitch::flat },
-            { { 30, 24, 0 }, 0, Pitch::flat },
-            { { 29, 24, 0 }, 2, Pitch::flat },
-            { { 28, 25, 0 }, 4, Pitch::flat },
-            { { 27, 25, 0 }, 6, Pitch::flat },
-            { { 26, 26, 0 }, 8, Pitch::flat },
-            { { 25, 27, 0 }, 10, Pitch::flat },
-            { { 25, 28, 0 }, 12, Pitch::flat },
-            { { 24, 29, 0 }, 14, Pitch::flat },
-            { { 24, 30, 0 }, 16, Pitch::flat },
-            { { 24, 31, 0 }, 16, Pitch::flat },
-        });
-
-    // 0x4eb350
-    // Track 29. Reversed 0. Direction 0
-    static constexpr auto moveInfoT29R0D0 = std::to_array<MoveInfo>(
-        {
-            { { 31, 24, 0 }, 0, Pitch::flat },
-            { { 30, 24, 0 }, 0, Pitch::flat },
-            { { 29, 24, 0 }, 0, Pitch::flat },
-            { { 28, 24, 0 }, 0, Pitch::flat },
-            { { 27, 23, 0 }, 62, Pitch::flat },
-            { { 26, 23, 0 }, 62, Pitch::flat },
-            { { 25, 23, 0 }, 62, Pitch::flat },
-            { { 24, 23, 0 }, 60, Pitch::flat },
-            { { 23, 22, 0 }, 60, Pitch::flat },
-            { { 22, 22, 0 }, 60, Pitch::flat },
-            { { 21, 22, 0 }, 58, Pitch::flat },
-            { { 20, 21, 0 }, 58, Pitch::flat },
-            { { 19, 21, 0 }, 58, Pitch::flat },
-            { { 18, 20, 0 }, 58, Pitch::flat },
-            { { 17, 19, 0 }, 56, Pitch::flat },
-            { { 16, 18, 0 }, 56, Pitch::flat },
-            { { 15, 17, 0 }, 56, Pitch::flat },
-            { { 14, 16, 0 }, 56, Pitch::flat },
-            { { 13, 15, 0 }, 56, Pitch::flat },
-            { { 12, 14, 0 }, 54, Pitch::flat },
-            { { 11, 13, 0 }, 54, Pitch::flat },
-            { { 11, 12, 0 }, 54, Pitch::flat },
-            { { 10, 11, 0 }, 54, Pitch::flat },
-            { { 10, 10, 0 }, 52, Pitch::flat },
-            { { 10, 9, 0 }, 52, Pitch::flat },
-            { { 9, 8, 0 }, 52, Pitch::flat },
-            { { 9, 7, 0 }, 50, Pitch::flat },
-            { { 9, 6, 0 }, 50, Pitch::flat },
-            { { 9, 5, 0 }, 50, Pitch::flat },
-            { { 8, 4, 0 }, 48, Pitch::flat },
-            { { 8, 3, 0 }, 48, Pitch::flat },
-            { { 8, 2, 0 }, 48, Pitch::flat },
-            { { 8, 1, 0 }, 48, Pitch::flat },
-            { { 8, 0, 0 }, 48, Pitch::flat },
-        });
-
-    // 0x4eb462
-    // Track 29. Reversed 0. Direction 1
-    static constexpr auto moveInfoT29R0D1 = std::to_array<MoveInfo>(
-        {
-            { { 24, 0, 0 }, 16, Pitch::flat },
-            { { 24, 1, 0 }, 16, Pitch::flat },
-            { { 24, 2, 0 }, 16, Pitch::flat },
-            { { 24, 3, 0 }, 16, Pitch::flat },
-            { { 24, 4, 0 }, 16, Pitch::flat },
-            { { 23, 5, 0 }, 14, Pitch::flat },
-            { { 23, 6, 0 }, 14, Pitch::flat },
-            { { 23, 7, 0 }, 14, Pitch::flat },
-            { { 23, 8, 0 }, 12, Pitch::flat },
-            { { 22, 9, 0 }, 12, Pitch::flat },
-            { { 22, 10, 0 }, 12, Pitch::flat },
-            { { 22, 11, 0 }, 10, Pitch::flat },
-            { { 21, 12, 0 }, 10, Pitch::flat },
-            { { 21, 13, 0 }, 10, Pitch::flat },
-            { { 20, 14, 0 }, 10, Pitch::flat },
-            { { 19, 15, 0 }, 8, Pitch::flat },
-            { { 18, 16, 0 }, 8, Pitch::flat },
-            { { 17, 17, 0 }, 8, Pitch::flat },
-            { { 16, 18, 0 }, 8, Pitch::flat },
-            { { 15, 19, 0 }, 8, Pitch::flat },
-            { { 14, 20, 0 }, 6, Pitch::flat },
-            { { 13, 21, 0 }, 6, Pitch::flat },
-            { { 12, 21, 0 }, 6, Pitch::flat },
-            { { 11, 22, 0 }, 6, Pitch::flat },
-            { { 10, 22, 0 }, 4, Pitch::flat },
-            { { 9, 22, 0 }, 4, Pitch::flat },
-            { { 8, 23, 0 }, 4, Pitch::flat },
-            { { 7, 23, 0 }, 2, Pitch::flat },
-            { { 6, 23, 0 }, 2, Pitch::flat },
-            { { 5, 23, 0 }, 2, Pitch::flat },
-            { { 4, 24, 0 }, 0, Pitch::flat },
-            { { 3, 24, 0 }, 0, Pitch::flat },
-            { { 2, 24, 0 }, 0, Pitch::flat },
-            { { 1, 24, 0 }, 0, Pitch::flat },
-            { { 0, 24, 0 }, 0, Pitch::flat },
-        });
-
-    // 0x4eb57c
-    // Track 29. Reversed 0. Direction 2
-    static constexpr auto moveInfoT29R0D2 = std::to_array<MoveInfo>(
-        {
-            { { 0, 8, 0 }, 32, Pitch::flat },
-            { { 1, 8, 0 }, 32, Pitch::flat },
-            { { 2, 8, 0 }, 32, Pitch::flat },
-            { { 3, 8, 0 }, 32, Pitch::flat },
-            { { 4, 8, 0 }, 32, Pitch::flat },
-            { { 5, 9, 0 }, 30, Pitch::flat },
-            { { 6, 9, 0 }, 30, Pitch::flat },
-            { { 7, 9, 0 }, 30, Pitch::flat },
-            { { 8, 9, 0 }, 28, Pitch::flat },
-            { { 9, 10, 0 }, 28, Pitch::flat },
-            { { 10, 10, 0 }, 28, Pitch::flat },
-            { { 11, 10, 0 }, 26, Pitch::flat },
-            { { 12, 11, 0 }, 26, Pitch::flat },
-            { { 13, 11, 0 }, 26, Pitch::flat },
-            { { 14, 12, 0 }, 26, Pitch::flat },
-            { { 15, 13, 0 }, 24, Pitch::flat },
-            { { 16, 14, 0 }, 24, Pitch::flat },
-            { { 17, 15, 0 }, 24, Pitch::flat },
-            { { 18, 16, 0 }, 24, Pitch::flat },
-            { { 19, 17, 0 }, 24, Pitch::flat },
-            { { 20, 18, 0 }, 22, Pitch::flat },
-            { { 21, 19, 0 }, 22, Pitch::flat },
-            { { 21, 20, 0 }, 22, Pitch::flat },
-            { { 22, 21, 0 }, 22, Pitch::flat },
-            { { 22, 22, 0 }, 20, Pitch::flat },
-            { { 22, 23, 0 }, 20, Pitch::flat },
-            { { 23, 24, 0 }, 20, Pitch::flat },
-            { { 23, 25, 0 }, 18, Pitch::flat },
-            { { 23, 26, 0 }, 18, Pitch::flat },
-            { { 23, 27, 0 }, 18, Pitch::flat },
-            { { 24, 28, 0 }, 16, Pitch::flat },
-            { { 24, 29, 0 }, 16, Pitch::flat },
-            { { 24, 30, 0 }, 16, Pitch::flat },
-            { { 24, 31, 0 }, 16, Pitch::flat },
-        });
-
-    // 0x4eb246
-    // Track 29. Reversed 0. Direction 3
-    static constexpr auto moveInfoT29R0D3 = std::to_array<MoveInfo>(
-        {
-            { { 8, 31, 0 }, 48, Pitch::flat },
-            { { 8, 30, 0 }, 48, Pitch::flat },
-            { { 8, 29, 0 }, 48, Pitch::flat },
-            { { 8, 28, 0 }, 48, Pitch::flat },
-            { { 9, 27, 0 }, 46, Pitch::flat },
-            { { 9, 26, 0 }, 46, Pitch::flat },
-            { { 9, 25, 0 }, 46, Pitch::flat },
-            { { 9, 24, 0 }, 44, Pitch::flat },
-            { { 10, 23, 0 }, 44, Pitch::flat },
-            { { 10, 22, 0 }, 44, Pitch::flat },
-            { { 10, 21, 0 }, 42, Pitch::flat },
-            { { 11, 20, 0 }, 42, Pitch::flat },
-            { { 11, 19, 0 }, 42, Pitch::flat },
-            { { 12, 18, 0 }, 42, Pitch::flat },
-            { { 13, 17, 0 }, 40, Pitch::flat },
-            { { 14, 16, 0 }, 40, Pitch::flat },
-            { { 15, 15, 0 }, 40, Pitch::flat },
-            { { 16, 14, 0 }, 40, Pitch::flat },
-            { { 17, 13, 0 }, 40, Pitch::flat },
-            { { 18, 12, 0 }, 38, Pitch::flat },
-            { { 19, 11, 0 }, 38, Pitch::flat },
-            { { 20, 11, 0 }, 38, Pitch::flat },
-            { { 21, 10, 0 }, 38, Pitch::flat },
-            { { 22, 10, 0 }, 36, Pitch::flat },
-            { { 23, 10, 0 }, 36, Pitch::flat },
-            { { 24, 9, 0 }, 36, Pitch::flat },
-            { { 25, 9, 0 }, 34, Pitch::flat },
-            { { 26, 9, 0 }, 34, Pitch::flat },
-            { { 27, 9, 0 }, 34, Pitch::flat },
-            { { 28, 8, 0 }, 32, Pitch::flat },
-            { { 29, 8, 0 }, 32, Pitch::flat },
-            { { 30, 8, 0 }, 32, Pitch::flat },
-            { { 31, 8, 0 }, 32, Pitch::flat },
-        });
-
-    // 0x4ead88
-    // Track 29. Reversed 1. Direction 0
-    static constexpr auto moveInfoT29R1D0 = std::to_array<MoveInfo>(
-        {
-            { { 8, 0, 0 }, 16, Pitch::flat },
-            { { 8, 1, 0 }, 16, Pitch::flat },
-            { { 8, 2, 0 }, 16, Pitch::flat },
-            { { 8, 3, 0 }, 16, Pitch::flat },
-            { { 8, 4, 0 }, 16, Pitch::flat },
-            { { 9, 5, 0 }, 18, Pitch::flat },
-            { { 9, 6, 0 }, 18, Pitch::flat },
-            { { 9, 7, 0 }, 18, Pitch::flat },
-            { { 9, 8, 0 }, 20, Pitch::flat },
-            { { 10, 9, 0 }, 20, Pitch::flat },
-            { { 10, 10, 0 }, 20, Pitch::flat },
-            { { 10, 11, 0 }, 22, Pitch::flat },
-            { { 11, 12, 0 }, 22, Pitch::flat },
-            { { 11, 13, 0 }, 22, Pitch::flat },
-            { { 12, 14, 0 }, 22, Pitch::flat },
-            { { 13, 15, 0 }, 24, Pitch::flat },
-            { { 14, 16, 0 }, 24, Pitch::flat },
-            { { 15, 17, 0 }, 24, Pitch::flat },
-            { { 16, 18, 0 }, 24, Pitch::flat },
-            { { 17, 19, 0 }, 24, Pitch::flat },
-            { { 18, 20, 0 }, 26, Pitch::flat },
-            { { 19, 21, 0 }, 26, Pitch::flat },
-            { { 20, 21, 0 }, 26, Pitch::flat },
-            { { 21, 22, 0 }, 26, Pitch::flat },
-            { { 22, 22, 0 }, 28, Pitch::flat },
-            { { 23, 22, 0 }, 28, Pitch::flat },
-            { { 24, 23, 0 }, 28, Pitch::flat },
-            { { 25, 23, 0 }, 30, Pitch::flat },
-            { { 26, 23, 0 }, 30, Pitch::flat },
-            { { 27, 23, 0 }, 30, Pitch::flat },
-            { { 28, 24, 0 }, 32, Pitch::flat },
-            { { 29, 24, 0 }, 32, Pitch::flat },
-            { { 30, 24, 0 }, 32, Pitch::flat },
-            { { 31, 24, 0 }, 32, Pitch::flat },
-        });
-
-    // 0x4eae9a
-    // Track 29. Reversed 1. Direction 1
-    static constexpr auto moveInfoT29R1D1 = std::to_array<MoveInfo>(
-        {
-            { { 0, 24, 0 }, 32, Pitch::flat },
-            { { 1, 24, 0 }, 32, Pitch::flat },
-            { { 2, 24, 0 }, 32, Pitch::flat },
-            { { 3, 24, 0 }, 32, Pitch::flat },
-            { { 4, 24, 0 }, 32, Pitch::flat },
-            { { 5, 23, 0 }, 34, Pitch::flat },
-            { { 6, 23, 0 }, 34, Pitch::flat },
-            { { 7, 23, 0 }, 34, Pitch::flat },
-            { { 8, 23, 0 }, 36, Pitch::flat },
-            { { 9, 22, 0 }, 36, Pitch::flat },
-            { { 10, 22, 0 }, 36, Pitch::flat },
-            { { 11, 22, 0 }, 38, Pitch::flat },
-            { { 12, 21, 0 }, 38, Pitch::flat },
-            { { 13, 21, 0 }, 38, Pitch::flat },
-            { { 14, 20, 0 }, 38, Pitch::flat },
-            { { 15, 19, 0 }, 40, Pitch::flat },
-            { { 16, 18, 0 }, 40, Pitch::flat },
-            { { 17, 17, 0 }, 40, Pitch::flat },
-            { { 18, 16, 0 }, 40, Pitch::flat },
-            { { 19, 15, 0 }, 40, Pitch::flat },
-            { { 20, 14, 0 }, 42, Pitch::flat },
-            { { 21, 13, 0 }, 42, Pitch::flat },
-            { { 21, 12, 0 }, 42, Pitch::flat },
-            { { 22, 11, 0 }, 42, Pitch::flat },
-            { { 22, 10, 0 }, 44, Pitch::flat },
-            { { 22, 9, 0 }, 44, Pitch::flat },
-            { { 23, 8, 0 }, 44, Pitch::flat },
-            { { 23, 7, 0 }, 46, Pitch::flat },
-            { { 23, 6, 0 }, 46, Pitch::flat },
-            { { 23, 5, 0 }, 46, Pitch::flat },
-            { { 24, 4, 0 }, 48, Pitch::flat },
-            { { 24, 3, 0 }, 48, Pitch::flat },
-            { { 24, 2, 0 }, 48, Pitch::flat },
-            { { 24, 1, 0 }, 48, Pitch::flat },
-            { { 24, 0, 0 }, 48, Pitch::flat },
-        });
-
-    // 0x4eafb4
-    // Track 29. Reversed 1. Direction 2
-    static constexpr auto moveInfoT29R1D2 = std::to_array<MoveInfo>(
-        {
-            { { 24, 31, 0 }, 48, Pitch::flat },
-            { { 24, 30, 0 }, 48, Pitch::flat },
-            { { 24, 29, 0 }, 48, Pitch::flat },
-            { { 24, 28, 0 }, 48, Pitch::flat },
-            { { 23, 27, 0 }, 50, Pitch::flat },
-            { { 23, 26, 0 }, 50, Pitch::flat },
-            { { 23, 25, 0 }, 50, Pitch::flat },
-            { { 23, 24, 0 }, 52, Pitch::flat },
-            { { 22, 23, 0 }, 52, Pitch::flat },
-            { { 22, 22, 0 }, 52, Pitch::flat },
-            { { 22, 21, 0 }, 54, Pitch::flat },
-            { { 21, 20, 0 }, 54, Pitch::flat },
-            { { 21, 19, 0 }, 54, Pitch::flat },
-            { { 20, 18, 0 }, 54, Pitch::flat },
-            { { 19, 17, 0 }, 56, Pitch::flat },
-            { { 18, 16, 0 }, 56, Pitch::flat },
-            { { 17, 15, 0 }, 56, Pitch::flat },
-            { { 16, 14, 0 }, 56, Pitch::flat },
-            { { 15, 13, 0 }, 56, Pitch::flat },
-            { { 14, 12, 0 }, 58, Pitch::flat },
-            { { 13, 11, 0 }, 58, Pitch::flat },
-            { { 12, 11, 0 }, 58, Pitch::flat },
-            { { 11, 10, 0 }, 58, Pitch::flat },
-            { { 10, 10, 0 }, 60, Pitch::flat },
-            { { 9, 10, 0 }, 60, Pitch::flat },
-            { { 8, 9, 0 }, 60, Pitch::flat },
-            { { 7, 9, 0 }, 62, Pitch::flat },
-            { { 6, 9, 0 }, 62, Pitch::flat },
-            { { 5, 9, 0 }, 62, Pitch::flat },
-            { { 4, 8, 0 }, 0, Pitch::flat },
-            { { 3, 8, 0 }, 0, Pitch::flat },
-            { { 2, 8, 0 }, 0, Pitch::flat },
-            { { 1, 8, 0 }, 0, Pitch::flat },
-            { { 0, 8, 0 }, 0, Pitch::flat },
-        });
-
-    // 0x4eac7e
-    // Track 29. Reversed 1. Direction 3
-    static constexpr auto moveInfoT29R1D3 = std::to_array<MoveInfo>(
-        {
-            { { 31, 8, 0 }, 0, Pitch::flat },
-            { { 30, 8, 0 }, 0, Pitch::flat },
-            { { 29, 8, 0 }, 0, Pitch::flat },
-            { { 28, 8, 0 }, 0, Pitch::flat },
-            { { 27, 9, 0 }, 2, Pitch::flat },
-            { { 26, 9, 0 }, 2, Pitch::flat },
-            { { 25, 9, 0 }, 2, Pitch::flat },
-            { { 24, 9, 0 }, 4, Pitch::flat },
-            { { 23, 10, 0 }, 4, Pitch::flat },
-            { { 22, 10, 0 }, 4, Pitch::flat },
-            { { 21, 10, 0 }, 6, Pitch::flat },
-            { { 20, 11, 0 }, 6, Pitch::flat },
-            { { 19, 11, 0 }, 6, Pitch::flat },
-            { { 18, 12, 0 }, 6, Pitch::flat },
-            { { 17, 13, 0 }, 8, Pitch::flat },
-            { { 16, 14, 0 }, 8, Pitch::flat },
-            { { 15, 15, 0 }, 8, Pitch::flat },
-            { { 14, 16, 0 }, 8, Pitch::flat },
-            { { 13, 17, 0 }, 8, Pitch::flat },
-            { { 12, 18, 0 }, 10, Pitch::flat },
-            { { 11, 19, 0 }, 10, Pitch::flat },
-            { { 11, 20, 0 }, 10, Pitch::flat },
-            { { 10, 21, 0 }, 10, Pitch::flat },
-            { { 10, 22, 0 }, 12, Pitch::flat },
-            { { 10, 23, 0 }, 12, Pitch::flat },
-            { { 9, 24, 0 }, 12, Pitch::flat },
-            { { 9, 25, 0 }, 14, Pitch::flat },
-            { { 9, 26, 0 }, 14, Pitch::flat },
-            { { 9, 27, 0 }, 14, Pitch::flat },
-            { { 8, 28, 0 }, 16, Pitch::flat },
-            { { 8, 29, 0 }, 16, Pitch::flat },
-            { { 8, 30, 0 }, 16, Pitch::flat },
-            { { 8, 31, 0 }, 16, Pitch::flat },
-        });
-
-    // 0x4eb68e
-    // Track 32. Reversed 0. Direction 0
-    static constexpr auto moveInfoT32R0D0 = std::to_array<MoveInfo>(
-        {
-            { { 31, 8, 0 }, 0, Pitch::flat },
-            { { 30, 8, 0 }, 0, Pitch::flat },
-            { { 29, 8, 0 }, 0, Pitch::flat },
-            { { 28, 8, 0 }, 2, Pitch::flat },
-            { { 27, 9, 0 }, 2, Pitch::flat },
-            { { 26, 9, 0 }, 2, Pitch::flat },
-            { { 25, 9, 0 }, 2, Pitch::flat },
-            { { 24, 10, 0 }, 4, Pitch::flat },
-            { { 23, 10, 0 }, 4, Pitch::flat },
-            { { 22, 11, 0 }, 4, Pitch::flat },
-            { { 21, 11, 0 }, 4, Pitch::flat },
-            { { 20, 12, 0 }, 6, Pitch::flat },
-            { { 19, 13, 0 }, 6, Pitch::flat },
-            { { 18, 14, 0 }, 6, Pitch::flat },
-            { { 17, 15, 0 }, 8, Pitch::flat },
-            { { 16, 16, 0 }, 8, Pitch::flat },
-            { { 15, 17, 0 }, 8, Pitch::flat },
-            { { 14, 18, 0 }, 8, Pitch::flat },
-            { { 13, 19, 0 }, 6, Pitch::flat },
-            { { 12, 20, 0 }, 6, Pitch::flat },
-            { { 11, 20, 0 }, 6, Pitch::flat },
-            { { 10, 21, 0 }, 4, Pitch::flat },
-            { { 9, 21, 0 }, 4, Pitch::flat },
-            { { 8, 22, 0 }, 4, Pitch::flat },
-            { { 7, 22, 0 }, 4, Pitch::flat },
-            { { 6, 23, 0 }, 2, Pitch::flat },
-            { { 5, 23, 0 }, 2, Pitch::flat },
-            { { 4, 23, 0 }, 2, Pitch::flat },
-            { { 3, 24, 0 }, 2, Pitch::flat },
-            { { 2, 24, 0 }, 0, Pitch::flat },
-            { { 1, 24, 0 }, 0, Pitch::flat },
-            { { 0, 24, 0 }, 0, Pitch::flat },
-        });
-
-    // 0x4eb790
-    // Track 32. Reversed 0. Direction 1
-    static constexpr auto moveInfoT32R0D1 = std::to_array<MoveInfo>(
-        {
-            { { 8, 0, 0 }, 16, Pitch::flat },
-            { { 8, 1, 0 }, 16, Pitch::flat },
-            { { 8, 2, 0 }, 16, Pitch::flat },
-            { { 8, 3, 0 }, 18, Pitch::flat },
-            { { 9, 4, 0 }, 18, Pitch::flat },
-            { { 9, 5, 0 }, 18, Pitch::flat },
-            { { 9, 6, 0 }, 18, Pitch::flat },
-            { { 10, 7, 0 }, 20, Pitch::flat },
-            { { 10, 8, 0 }, 20, Pitch::flat },
-            { { 11, 9, 0 }, 20, Pitch::flat },
-            { { 11, 10, 0 }, 20, Pitch::flat },
-            { { 12, 11, 0 }, 22, Pitch::flat },
-            { { 13, 12, 0 }, 22, Pitch::flat },
-            { { 14, 13, 0 }, 22, Pitch::flat },
-            { { 15, 14, 0 }, 24, Pitch::flat },
-            { { 16, 15, 0 }, 24, Pitch::flat },
-            { { 17, 16, 0 }, 24, Pitch::flat },
-            { { 18, 17, 0 }, 24, Pitch::flat },
-            { { 19, 18, 0 }, 22, Pitch::flat },
-            { { 20, 19, 0 }, 22, Pitch::flat },
-            { { 20, 20, 0 }, 22, Pitch::flat },
-            { { 21, 21, 0 }, 20, Pitch::flat },
-            { { 21, 22, 0 }, 20, Pitch::flat },
-            { { 22, 23, 0 }, 20, Pitch::flat },
-            { { 22, 24, 0 }, 20, Pitch::flat },
-            { { 23, 25, 0 }, 18, Pitch::flat },
-            { { 23, 26, 0 }, 18, Pitch::flat },
-            { { 23, 27, 0 }, 18, Pitch::flat },
-            { { 24, 28, 0 }, 18, Pitch::flat },
-            { { 24, 29, 0 }, 16, Pitch::flat },
-            { { 24, 30, 0 }, 16, Pitch::flat },
-            { { 24, 31, 0 }, 16, Pitch::flat },
-        });
-
-    // 0x4eb892
-    // Track 32. Reversed 0. Direction 2
-    static constexpr auto moveInfoT32R0D2 = std::to_array<MoveInfo>(
-        {
-            { { 0, 24, 0 }, 32, Pitch::flat },
-            { { 1, 24, 0 }, 32, Pitch::flat },
-            { { 2, 24, 0 }, 32, Pitch::flat },
-            { { 3, 24, 0 }, 34, Pitch::flat },
-            { { 4, 23, 0 }, 34, Pitch::flat },
-            { { 5, 23, 0 }, 34, Pitch::flat },
-            { { 6, 23, 0 }, 34, Pitch::flat },
-            { { 7, 22, 0 }, 36, Pitch::flat },
-            { { 8, 22, 0 }, 36, Pitch::flat },
-            { { 9, 21, 0 }, 36, Pitch::flat },
-            { { 10, 21, 0 }, 36, Pitch::flat },
-            { { 11, 20, 0 }, 38, Pitch::flat },
-            { { 12, 20, 0 }, 38, Pitch::flat },
-            { { 13, 19, 0 }, 38, Pitch::flat },
-            { { 14, 18, 0 }, 40, Pitch::flat },
-            { { 15, 17, 0 }, 40, Pitch::flat },
-            { { 16, 16, 0 }, 40, Pitch::flat },
-            { { 17, 15, 0 }, 40, Pitch::flat },
-            { { 18, 14, 0 }, 38, Pitch::flat },
-            { { 19, 13, 0 }, 38, Pitch::flat },
-            { { 20, 12, 0 }, 38, Pitch::flat },
-            { { 21, 11, 0 }, 36, Pitch::flat },
-            { { 22, 11, 0 }, 36, Pitch::flat },
-            { { 23, 10, 0 }, 36, Pitch::flat },
-            { { 24, 10, 0 }, 36, Pitch::flat },
-            { { 25, 9, 0 }, 34, Pitch::flat },
-            { { 26, 9, 0 }, 34, Pitch::flat },
-            { { 27, 9, 0 }, 34, Pitch::flat },
-            { { 28, 8, 0 }, 34, Pitch::flat },
-            { { 29, 8, 0 }, 32, Pitch::flat },
-            { { 30, 8, 0 }, 32, Pitch::flat },
-            { { 31, 8, 0 }, 32, Pitch::flat },
-        });
-
-    // 0x4eb994
-    // Track 32. Reversed 0. Direction 3
-    static constexpr auto moveInfoT32R0D3 = std::to_array<MoveInfo>(
-        {
-            { { 24, 31, 0 }, 48, Pitch::flat },
-            { { 24, 30, 0 }, 48, Pitch::flat },
-            { { 24, 29, 0 }, 48, Pitch::flat },
-            { { 24, 28, 0 }, 50, Pitch::flat },
-            { { 23, 27, 0 }, 50, Pitch::flat },
-            { { 23, 26, 0 }, 50, Pitch::flat },
-            { { 23, 25, 0 }, 50, Pitch::flat },
-            { { 22, 24, 0 }, 52, Pitch::flat },
-            { { 22, 23, 0 }, 52, Pitch::flat },
-            { { 21, 22, 0 }, 52, Pitch::flat },
-            { { 21, 21, 0 }, 52, Pitch::flat },
-            { { 20, 20, 0 }, 54, Pitch::flat },
-            { { 20, 19, 0 }, 54, Pitch::flat },
-            { { 19, 18, 0 }, 54, Pitch::flat },
-            { { 18, 17, 0 }, 56, Pitch::flat },
-            { { 17, 16, 0 }, 56, Pitch::flat },
-            { { 16, 15, 0 }, 56, Pitch::flat },
-            { { 15, 14, 0 }, 56, Pitch::flat },
-            { { 14, 13, 0 }, 54, Pitch::flat },
-            { { 13, 12, 0 }, 54, Pitch::flat },
-            { { 12, 11, 0 }, 54, Pitch::flat },
-            { { 11, 10, 0 }, 52, Pitch::flat },
-            { { 11, 9, 0 }, 52, Pitch::flat },
-            { { 10, 8, 0 }, 52, Pitch::flat },
-            { { 10, 7, 0 }, 52, Pitch::flat },
-            { { 9, 6, 0 }, 50, Pitch::flat },
-            { { 9, 5, 0 }, 50, Pitch::flat },
-            { { 9, 4, 0 }, 50, Pitch::flat },
-            { { 8, 3, 0 }, 50, Pitch::flat },
-            { { 8, 2, 0 }, 48, Pitch::flat },
-            { { 8, 1, 0 }, 48, Pitch::flat },
-            { { 8, 0, 0 }, 48, Pitch::flat },
-        });
-
-    // 0x4eba96
-    // Track 33. Reversed 0. Direction 0
-    static constexpr auto moveInfoT33R0D0 = std::to_array<MoveInfo>(
-        {
-            { { 31, 24, 0 }, 0, Pitch::flat },
-            { { 30, 24, 0 }, 0, Pitch::flat },
-            { { 29, 24, 0 }, 0, Pitch::flat },
-            { { 28, 24, 0 }, 62, Pitch::flat },
-            { { 27, 23, 0 }, 62, Pitch::flat },
-            { { 26, 23, 0 }, 62, Pitch::flat },
-            { { 25, 23, 0 }, 62, Pitch::flat },
-            { { 24, 22, 0 }, 60, Pitch::flat },
-            { { 23, 22, 0 }, 60, Pitch::flat },
-            { { 22, 21, 0 }, 60, Pitch::flat },
-            { { 21, 21, 0 }, 60, Pitch::flat },
-            { { 20, 20, 0 }, 58, Pitch::flat },
-            { { 19, 20, 0 }, 58, Pitch::flat },
-            { { 18, 19, 0 }, 58, Pitch::flat },
-            { { 17, 18, 0 }, 56, Pitch::flat },
-            { { 16, 17, 0 }, 56, Pitch::flat },
-            { { 15, 16, 0 }, 56, Pitch::flat },
-            { { 14, 15, 0 }, 56, Pitch::flat },
-            { { 13, 14, 0 }, 58, Pitch::flat },
-            { { 12, 13, 0 }, 58, Pitch::flat },
-            { { 11, 12, 0 }, 58, Pitch::flat },
-            { { 10, 11, 0 }, 60, Pitch::flat },
-            { { 9, 11, 0 }, 60, Pitch::flat },
-            { { 8, 10, 0 }, 60, Pitch::flat },
-            { { 7, 10, 0 }, 60, Pitch::flat },
-            { { 6, 9, 0 }, 62, Pitch::flat },
-            { { 5, 9, 0 }, 62, Pitch::flat },
-            { { 4, 9, 0 }, 62, Pitch::flat },
-            { { 3, 8, 0 }, 62, Pitch::flat },
-            { { 2, 8, 0 }, 0, Pitch::flat },
-            { { 1, 8, 0 }, 0, Pitch::flat },
-            { { 0, 8, 0 }, 0, Pitch::flat },
-        });
-
-    // 0x4ebb98
-    // Track 33. Reversed 0. Direction 1
-    static constexpr auto moveInfoT33R0D1 = std::to_array<MoveInfo>(
-        {
-            { { 24, 0, 0 }, 16, Pitch::flat },
-            { { 24, 1, 0 }, 16, Pitch::flat },
-            { { 24, 2, 0 }, 16, Pitch::flat },
-            { { 24, 3, 0 }, 14, Pitch::flat },
-            { { 23, 4, 0 }, 14, Pitch::flat },
-            { { 23, 5, 0 }, 14, Pitch::flat },
-            { { 23, 6, 0 }, 14, Pitch::flat },
-            { { 22, 7, 0 }, 12, Pitch::flat },
-            { { 22, 8, 0 }, 12, Pitch::flat },
-            { { 21, 9, 0 }, 12, Pitch::flat },
-            { { 21, 10, 0 }, 12, Pitch::flat },
-            { { 20, 11, 0 }, 10, Pitch::flat },
-            { { 20, 12, 0 }, 10, Pitch::flat },
-            { { 19, 13, 0 }, 10, Pitch::flat },
-            { { 18, 14, 0 }, 8, Pitch::flat },
-            { { 17, 15, 0 }, 8, Pitch::flat },
-            { { 16, 16, 0 }, 8, Pitch::flat },
-            { { 15, 17, 0 }, 8, Pitch::flat },
-            { { 14, 18, 0 }, 10, Pitch::flat },
-            { { 13, 19, 0 }, 10, Pitch::flat },
-            { { 12, 20, 0 }, 10, Pitch::flat },
-            { { 11, 21, 0 }, 12, Pitch::flat },
-            { { 11, 22, 0 }, 12, Pitch::flat },
-            { { 10, 23, 0 }, 12, Pitch::flat },
-            { { 10, 24, 0 }, 12, Pitch::flat },
-            { { 9, 25, 0 }, 14, Pitch::flat },
-            { { 9, 26, 0 }, 14, Pitch::flat },
-            { { 9, 27, 0 }, 14, Pitch::flat },
-            { { 8, 28, 0 }, 14, Pitch::flat },
-            { { 8, 29, 0 }, 16, Pitch::flat },
-            { { 8, 30, 0 }, 16, Pitch::flat },
-            { { 8, 31, 0 }, 16, Pitch::flat },
-        });
-
-    // 0x4ebc9a
-    // Track 33. Reversed 0. Direction 2
-    static constexpr auto moveInfoT33R0D2 = std::to_array<MoveInfo>(
-        {
-            { { 0, 8, 0 }, 32, Pitch::flat },
-            { { 1, 8, 0 }, 32, Pitch::flat },
-            { { 2, 8, 0 }, 32, Pitch::flat },
-            { { 3, 8, 0 }, 30, Pitch::flat },
-            { { 4, 9, 0 }, 30, Pitch::flat },
-            { { 5, 9, 0 }, 30, Pitch::flat },
-            { { 6, 9, 0 }, 30, Pitch::flat },
-            { { 7, 10, 0 }, 28, Pitch::flat },
-            { { 8, 10, 0 }, 28, Pitch::flat },
-            { { 9, 11, 0 }, 28, Pitch::flat },
-            { { 10, 11, 0 }, 28, Pitch::flat },
-            { { 11, 12, 0 }, 26, Pitch::flat },
-            { { 12, 13, 0 }, 26, Pitch::flat },
-            { { 13, 14, 0 }, 26, Pitch::flat },
-            { { 14, 15, 0 }, 24, Pitch::flat },
-            { { 15, 16, 0 }, 24, Pitch::flat },
-            { { 16, 17, 0 }, 24, Pitch::flat },
-            { { 17, 18, 0 }, 24, Pitch::flat },
-            { { 18, 19, 0 }, 26, Pitch::flat },
-            { { 19, 20, 0 }, 26, Pitch::flat },
-            { { 20, 20, 0 }, 26, Pitch::flat },
-            { { 21, 21, 0 }, 28, Pitch::flat },
-            { { 22, 21, 0 }, 28, Pitch::flat },
-            { { 23, 22, 0 }, 28, Pitch::flat },
-            { { 24, 22, 0 }, 28, Pitch::flat },
-            { { 25, 23, 0 }, 30, Pitch::flat },
-            { { 26, 23, 0 }, 30, Pitch::flat },
-            { { 27, 23, 0 }, 30, Pitch::flat },
-            { { 28, 24, 0 }, 30, Pitch::flat },
-            { { 29, 24, 0 }, 32, Pitch::flat },
-            { { 30, 24, 0 }, 32, Pitch::flat },
-            { { 31, 24, 0 }, 32, Pitch::flat },
-        });
-
-    // 0x4ebd9c
-    // Track 33. Reversed 0. Direction 3
-    static constexpr auto moveInfoT33R0D3 = std::to_array<MoveInfo>(
-        {
-            { { 8, 31, 0 }, 48, Pitch::flat },
-            { { 8, 30, 0 }, 48, Pitch::flat },
-            { { 8, 29, 0 }, 48, Pitch::flat },
-            { { 8, 28, 0 }, 46, Pitch::flat },
-            { { 9, 27, 0 }, 46, Pitch::flat },
-            { { 9, 26, 0 }, 46, Pitch::flat },
-            { { 9, 25, 0 }, 46, Pitch::flat },
-            { { 10, 24, 0 }, 44, Pitch::flat },
-            { { 10, 23, 0 }, 44, Pitch::flat },
-            { { 11, 22, 0 }, 44, Pitch::flat },
-            { { 11, 21, 0 }, 44, Pitch::flat },
-            { { 12, 20, 0 }, 42, Pitch::flat },
-            { { 13, 19, 0 }, 42, Pitch::flat },
-            { { 14, 18, 0 }, 42, Pitch::flat },
-            { { 15, 17, 0 }, 40, Pitch::flat },
-            { { 16, 16, 0 }, 40, Pitch::flat },
-            { { 17, 15, 0 }, 40, Pitch::flat },
-            { { 18, 14, 0 }, 40, Pitch::flat },
-            { { 19, 13, 0 }, 42, Pitch::flat },
-            { { 20, 12, 0 }, 42, Pitch::flat },
-            { { 20, 11, 0 }, 42, Pitch::flat },
-            { { 21, 10, 0 }, 44, Pitch::flat },
-            { { 21, 9, 0 }, 44, Pitch::flat },
-            { { 22, 8, 0 }, 44, Pitch::flat },
-            { { 22, 7, 0 }, 44, Pitch::flat },
-            { { 23, 6, 0 }, 46, Pitch::flat },
-            { { 23, 5, 0 }, 46, Pitch::flat },
-            { { 23, 4, 0 }, 46, Pitch::flat },
-            { { 24, 3, 0 }, 46, Pitch::flat },
-            { { 24, 2, 0 }, 48, Pitch::flat },
-            { { 24, 1, 0 }, 48, Pitch::flat },
-            { { 24, 0, 0 }, 48, Pitch::flat },
-        });
-
-    // 0x4dcd66
-    // Track 34. Reversed 0. Direction 0
-    static constexpr auto moveInfoT34R0D0 = std::to_array<MoveInfo>(
-        {
-            { { 31, 8, 0 }, 0, Pitch::up25deg },
-            { { 30, 8, 0 }, 0, Pitch::up25deg },
-            { { 29, 8, 1 }, 0, Pitch::up25deg },
-            { { 28, 8, 1 }, 0, Pitch::up25deg },
-            { { 27, 8, 2 }, 0, Pitch::up25deg },
-            { { 26, 8, 2 }, 0, Pitch::up25deg },
-            { { 25, 8, 3 }, 0, Pitch::up25deg },
-            { { 24, 8, 3 }, 0, Pitch::up25deg },
-            { { 23, 8, 4 }, 0, Pitch::up25deg },
-            { { 22, 8, 4 }, 0, Pitch::up25deg },
-            { { 21, 8, 5 }, 0, Pitch::up25deg },
-            { { 20, 8, 5 }, 0, Pitch::up25deg },
-            { { 19, 8, 6 }, 0, Pitch::up25deg },
-            { { 18, 8, 6 }, 0, Pitch::up25deg },
-            { { 17, 8, 7 }, 0, Pitch::up25deg },
-            { { 16, 8, 7 }, 0, Pitch::up25deg },
-            { { 15, 8, 8 }, 0, Pitch::up25deg },
-            { { 14, 8, 8 }, 0, Pitch::up25deg },
-            { { 13, 8, 9 }, 0, Pitch::up25deg },
-            { { 12, 8, 9 }, 0, Pitch::up25deg },
-            { { 11, 8, 10 }, 0, Pitch::up25deg },
-            { { 10, 8, 10 }, 0, Pitch::up25deg },
-            { { 9, 8, 11 }, 0, Pitch::up25deg },
-            { { 8, 8, 11 }, 0, Pitch::up25deg },
-            { { 7, 8, 12 }, 0, Pitch::up25deg },
-            { { 6, 8, 12 }, 0, Pitch::up25deg },
-            { { 5, 8, 13 }, 0, Pitch::up25deg },
-            { { 4, 8, 13 }, 0, Pitch::up25deg },
-            { { 3, 8, 14 }, 0, Pitch::up25deg },
-            { { 2, 8, 14 }, 0, Pitch::up25deg },
-            { { 1, 8, 15 }, 0, Pitch::up25deg },
-            { { 0, 8, 15 }, 0, Pitch::up25deg },
-        });
-
-    // 0x4dce68
-    // Track 34. Reversed 0. Direction 1
-    static constexpr auto moveInfoT34R0D1 = std::to_array<MoveInfo>(
-        {
-            { { 8, 0, 0 }, 16, Pitch::up25deg },
-            { { 8, 1, 0 }, 16, Pitch::up25deg },
-            { { 8, 2, 1 }, 16, Pitch::up25deg },
-            { { 8, 3, 1 }, 16, Pitch::up25deg },
-            { { 8, 4, 2 }, 16, Pitch::up25deg },
-            { { 8, 5, 2 }, 16, Pitch::up25deg },
-            { { 8, 6, 3 }, 16, Pitch::up25deg },
-            { { 8, 7, 3 }, 16, Pitch::up25deg },
-            { { 8, 8, 4 }, 16, Pitch::up25deg },
-            { { 8, 9, 4 }, 16, Pitch::up25deg },
-            { { 8, 10, 5 }, 16, Pitch::up25deg },
-            { { 8, 11, 5 }, 16, Pitch::up25deg },
-            { { 8, 12, 6 }, 16, Pitch::up25deg },
-            { { 8, 13, 6 }, 16, Pitch::up25deg },
-            { { 8, 14, 7 }, 16, Pitch::up25deg },
-            { { 8, 15, 7 }, 16, Pitch::up25deg },
-            { { 8, 16, 8 }, 16, Pitch::up25deg },
-            { { 8, 17, 8 }, 16, Pitch::up25deg },
-            { { 8, 18, 9 }, 16, Pitch::up25deg },
-            { { 8, 19, 9 }, 16, Pitch::up25deg },
-            { { 8, 20, 10 }, 16, Pitch::up25deg },
-            { { 8, 21, 10 }, 16, Pitch::up25deg },
-            { { 8, 22, 11 }, 16, Pitch::up25deg },
-            { { 8, 23, 11 }, 16, Pitch::up25deg },
-            { { 8, 24, 12 }, 16, Pitch::up25deg },
-            { { 8, 25, 12 }, 16, Pitch::up25deg },
-            { { 8, 26, 13 }, 16, Pitch::up25deg },
-            { { 8, 27, 13 }, 16, Pitch::up25deg },
-            { { 8, 28, 14 }, 16, Pitch::up25deg },
-            { { 8, 29, 14 }, 16, Pitch::up25deg },
-            { { 8, 30, 15 }, 16, Pitch::up25deg },
-            { { 8, 31, 15 }, 16, Pitch::up25deg },
-        });
-
-    // 0x4dcf6a
-    // Track 34. Reversed 0. Direction 2
-    static constexpr auto moveInfoT34R0D2 = std::to_array<MoveInfo>(
-        {
-            { { 0, 24, 0 }, 32, Pitch::up25deg },
-            { { 1, 24, 0 }, 32, Pitch::up25deg },
-            { { 2, 24, 1 }, 32, Pitch::up25deg },
-            { { 3, 24, 1 }, 32, Pitch::up25deg },
-            { { 4, 24, 2 }, 32, Pitch::up25deg },
-            { { 5, 24, 2 }, 32, Pitch::up25deg },
-            { { 6, 24, 3 }, 32, Pitch::up25deg },
-            { { 7, 24, 3 }, 32, Pitch::up25deg },
-            { { 8, 24, 4 }, 32, Pitch::up25deg },
-            { { 9, 24, 4 }, 32, Pitch::up25deg },
-            { { 10, 24, 5 }, 32, Pitch::up25deg },
-            { { 11, 24, 5 }, 32, Pitch::up25deg },
-            { { 12, 24, 6 }, 32, Pitch::up25deg },
-            { { 13, 24, 6 }, 32, Pitch::up25deg },
-            { { 14, 24, 7 }, 32, Pitch::up25deg },
-            { { 15, 24, 7 }, 32, Pitch::up25deg },
-            { { 16, 24, 8 }, 32, Pitch::up25deg },
-            { { 17, 24, 8 }, 32, Pitch::up25deg },
-            { { 18, 24, 9 }, 32, Pitch::up25deg },
-            { { 19, 24, 9 }, 32, Pitch::up25deg },
-            { { 20, 24, 10 }, 32, Pitch::up25deg },
-            { { 21, 24, 10 }, 32, Pitch::up25deg },
-            { { 22, 24, 11 }, 32, Pitch::up25deg },
-            { { 23, 24, 11 }, 32, Pitch::up25deg },
-            { { 24, 24, 12 }, 32, Pitch::up25deg },
-            { { 25, 24, 12 }, 32, Pitch::up25deg },
-            { { 26, 24, 13 }, 32, Pitch::up25deg },
-            { { 27, 24, 13 }, 32, Pitch::up25deg },
-            { { 28, 24, 14 }, 32, Pitch::up25deg },
-            { { 29, 24, 14 }, 32, Pitch::up25deg },
-            { { 30, 24, 15 }, 32, Pitch::up25deg },
-            { { 31, 24, 15 }, 32, Pitch::up25deg },
-        });
-
-    // 0x4dd06c
-    // Track 34. Reversed 0. Direction 3
-    static constexpr auto moveInfoT34R0D3 = std::to_array<MoveInfo>(
-        {
-            { { 24, 31, 0 }, 48, Pitch::up25deg },
-            { { 24, 30, 0 }, 48, Pitch::up25deg },
-            { { 24, 29, 1 }, 48, Pitch::up25deg },
-            { { 24, 28, 1 }, 48, Pitch::up25deg },
-            { { 24, 27, 2 }, 48, Pitch::up25deg },
-            { { 24, 26, 2 }, 48, Pitch::up25deg },
-            { { 24, 25, 3 }, 48, Pitch::up25deg },
-            { { 24, 24, 3 }, 48, Pitch::up25deg },
-            { { 24, 23, 4 }, 48, Pitch::up25deg },
-            { { 24, 22, 4 }, 48, Pitch::up25deg },
-            { { 24, 21, 5 }, 48, Pitch::up25deg },
-            { { 24, 20, 5 }, 48, Pitch::up25deg },
-            { { 24, 19, 6 }, 48, Pitch::up25deg },
-            { { 24, 18, 6 }, 48, Pitch::up25deg },
-            { { 24, 17, 7 }, 48, Pitch::up25deg },
-            { { 24, 16, 7 }, 48, Pitch::up25deg },
-            { { 24, 15, 8 }, 48, Pitch::up25deg },
-            { { 24, 14, 8 }, 48, Pitch::up25deg },
-            { { 24, 13, 9 }, 48, Pitch::up25deg },
-            { { 24, 12, 9 }, 48, Pitch::up25deg },
-            { { 24, 11, 10 }, 48, Pitch::up25deg },
-            { { 24, 10, 10 }, 48, Pitch::up25deg },
-            { { 24, 9, 11 }, 48, Pitch::up25deg },
-            { { 24, 8, 11 }, 48, Pitch::up25deg },
-            { { 24, 7, 12 }, 48, Pitch::up25deg },
-            { { 24, 6, 12 }, 48, Pitch::up25deg },
-            { { 24, 5, 13 }, 48, Pitch::up25deg },
-            { { 24, 4, 13 }, 48, Pitch::up25deg },
-            { { 24, 3, 14 }, 48, Pitch::up25deg },
-            { { 24, 2, 14 }, 48, Pitch::up25deg },
-            { { 24, 1, 15 }, 48, Pitch::up25deg },
-            { { 24, 0, 15 }, 48, Pitch::up25deg },
-        });
-
-    // 0x4ddb82
-    // Track 34. Reversed 1. Direction 0
-    static constexpr auto moveInfoT34R1D0 = std::to_array<MoveInfo>(
-        {
-            { { 0, 8, 0 }, 32, Pitch::down25deg },
-            { { 1, 8, 0 }, 32, Pitch::down25deg },
-            { { 2, 8, -1 }, 32, Pitch::down25deg },
-            { { 3, 8, -1 }, 32, Pitch::down25deg },
-            { { 4, 8, -2 }, 32, Pitch::down25deg },
-            { { 5, 8, -2 }, 32, Pitch::down25deg },
-            { { 6, 8, -3 }, 32, Pitch::down25deg },
-            { { 7, 8, -3 }, 32, Pitch::down25deg },
-            { { 8, 8, -4 }, 32, Pitch::down25deg },
-            { { 9, 8, -4 }, 32, Pitch::down25deg },
-            { { 10, 8, -5 }, 32, Pitch::down25deg },
-            { { 11, 8, -5 }, 32, Pitch::down25deg },
-            { { 12, 8, -6 }, 32, Pitch::down25deg },
-            { { 13, 8, -6 }, 32, Pitch::down25deg },
-            { { 14, 8, -7 }, 32, Pitch::down25deg },
-            { { 15, 8, -7 }, 32, Pitch::down25deg },
-            { { 16, 8, -8 }, 32, Pitch::down25deg },
-            { { 17, 8, -8 }, 32, Pitch::down25deg },
-            { { 18, 8, -9 }, 32, Pitch::down25deg },
-            { { 19, 8, -9 }, 32, Pitch::down25deg },
-            { { 20, 8, -10 }, 32, Pitch::down25deg },
-            { { 21, 8, -10 }, 32, Pitch::down25deg },
-            { { 22, 8, -11 }, 32, Pitch::down25deg },
-            { { 23, 8, -11 }, 32, Pitch::down25deg },
-            { { 24, 8, -12 }, 32, Pitch::down25deg },
-            { { 25, 8, -12 }, 32, Pitch::down25deg },
-            { { 26, 8, -13 }, 32, Pitch::down25deg },
-            { { 27, 8, -13 }, 32, Pitch::down25deg },
-            { { 28, 8, -14 }, 32, Pitch::down25deg },
-            { { 29, 8, -14 }, 32, Pitch::down25deg },
-            { { 30, 8, -15 }, 32, Pitch::down25deg },
-            { { 31, 8, -15 }, 32, Pitch::down25deg },
-        });
-
-    // 0x4ddc84
-    // Track 34. Reversed 1. Direction 1
-    static constexpr auto moveInfoT34R1D1 = std::to_array<MoveInfo>(
-        {
-            { { 8, 31, 0 }, 48, Pitch::down25deg },
-            { { 8, 30, 0 }, 48, Pitch::down25deg },
-            { { 8, 29, -1 }, 48, Pitch::down25deg },
-            { { 8, 28, -1 }, 48, Pitch::down25deg },
-            { { 8, 27, -2 }, 48, Pitch::down25deg },
-            { { 8, 26, -2 }, 48, Pitch::down25deg },
-            { { 8, 25, -3 }, 48, Pitch::down25deg },
-            { { 8, 24, -3 }, 48, Pitch::down25deg },
-            { { 8, 23, -4 }, 48, Pitch::down25deg },
-            { { 8, 22, -4 }, 48, Pitch::down25deg },
-            { { 8, 21, -5 }, 48, Pitch::down25deg },
-            { { 8, 20, -5 }, 48, Pitch::down25deg },
-            { { 8, 19, -6 }, 48, Pitch::down25deg },
-            { { 8, 18, -6 }, 48, Pitch::down25deg },
-            { { 8, 17, -7 }, 48, Pitch::down25deg },
-            { { 8, 16, -7 }, 48, Pitch::down25deg },
-            { { 8, 15, -8 }, 48, Pitch::down25deg },
-            { { 8, 14, -8 }, 48, Pitch::down25deg },
-            { { 8, 13, -9 }, 48, Pitch::down25deg },
-            { { 8, 12, -9 }, 48, Pitch::down25deg },
-            { { 8, 11, -10 }, 48, Pitch::down25deg },
-            { { 8, 10, -10 }, 48, Pitch::down25deg },
-            { { 8, 9, -11 }, 48, Pitch::down25deg },
-            { { 8, 8, -11 }, 48, Pitch::down25deg },
-            { { 8, 7, -12 }, 48, Pitch::down25deg },
-            { { 8, 6, -12 }, 48, Pitch::down25deg },
-            { { 8, 5, -13 }, 48, Pitch::down25deg },
-            { { 8, 4, -13 }, 48, Pitch::down25deg },
-            { { 8, 3, -14 }, 48, Pitch::down25deg },
-            { { 8, 2, -14 }, 48, Pitch::down25deg },
-            { { 8, 1, -15 }, 48, Pitch::down25deg },
-            { { 8, 0, -15 }, 48, Pitch::down25deg },
-        });
-
-    // 0x4dd97e
-    // Track 34. Reversed 1. Direction 2
-    static constexpr auto moveInfoT34R1D2 = std::to_array<MoveInfo>(
-        {
-            { { 31, 24, 0 }, 0, Pitch::down25deg },
-            { { 30, 24, 0 }, 0, Pitch::down25deg },
-            { { 29, 24, -1 }, 0, Pitch::down25deg },
-            { { 28, 24, -1 }, 0, Pitch::down25deg },
-            { { 27, 24, -2 }, 0, Pitch::down25deg },
-            { { 26, 24, -2 }, 0, Pitch::down25deg },
-            { { 25, 24, -3 }, 0, Pitch::down25deg },
-            { { 24, 24, -3 }, 0, Pitch::down25deg },
-            { { 23, 24, -4 }, 0, Pitch::down25deg },
-            { { 22, 24, -4 }, 0, Pitch::down25deg },
-            { { 21, 24, -5 }, 0, Pitch::down25deg },
-            { { 20, 24, -5 }, 0, Pitch::down25deg },
-            { { 19, 24, -6 }, 0, Pitch::down25deg },
-            { { 18, 24, -6 }, 0, Pitch::down25deg },
-            { { 17, 24, -7 }, 0, Pitch::down25deg },
-            { { 16, 24, -7 }, 0, Pitch::down25deg },
-            { { 15, 24, -8 }, 0, Pitch::down25deg },
-            { { 14, 24, -8 }, 0, Pitch::down25deg },
-            { { 13, 24, -9 }, 0, Pitch::down25deg },
-            { { 12, 24, -9 }, 0, Pitch::down25deg },
-            { { 11, 24, -10 }, 0, Pitch::down25deg },
-            { { 10, 24, -10 }, 0, Pitch::down25deg },
-            { { 9, 24, -11 }, 0, Pitch::down25deg },
-            { { 8, 24, -11 }, 0, Pitch::down25deg },
-            { { 7, 24, -12 }, 0, Pitch::down25deg },
-            { { 6, 24, -12 }, 0, Pitch::down25deg },
-            { { 5, 24, -13 }, 0, Pitch::down25deg },
-            { { 4, 24, -13 }, 0, Pitch::down25deg },
-            { { 3, 24, -14 }, 0, Pitch::down25deg },
-            { { 2, 24, -14 }, 0, Pitch::down25deg },
-            { { 1, 24, -15 }, 0, Pitch::down25deg },
-            { { 0, 24, -15 }, 0, Pitch::down25deg },
-        });
-
-    // 0x4dda80
-    // Track 34. Reversed 1. Direction 3
-    static constexpr auto moveInfoT34R1D3 = std::to_array<MoveInfo>(
-        {
-            { { 24, 0, 0 }, 16, Pitch::down25deg },
-            { { 24, 1, 0 }, 16, Pitch::down25deg },
-            { { 24, 2, -1 }, 16, Pitch::down25deg },
-            { { 24, 3, -1 }, 16, Pitch::down25deg },
-            { { 24, 4, -2 }, 16, Pitch::down25deg },
-            { { 24, 5, -2 }, 16, Pitch::down25deg },
-            { { 24, 6, -3 }, 16, Pitch::down25deg },
-            { { 24, 7, -3 }, 16, Pitch::down25deg },
-            { { 24, 8, -4 }, 16, Pitch::down25deg },
-            { { 24, 9, -4 }, 16, Pitch::down25deg },
-            { { 24, 10, -5 }, 16, Pitch::down25deg },
-            { { 24, 11, -5 }, 16, Pitch::down25deg },
-            { { 24, 12, -6 }, 16, Pitch::down25deg },
-            { { 24, 13, -6 }, 16, Pitch::down25deg },
-            { { 24, 14, -7 }, 16, Pitch::down25deg },
-            { { 24, 15, -7 }, 16, Pitch::down25deg },
-            { { 24, 16, -8 }, 16, Pitch::down25deg },
-            { { 24, 17, -8 }, 16, Pitch::down25deg },
-            { { 24, 18, -9 }, 16, Pitch::down25deg },
-            { { 24, 19, -9 }, 16, Pitch::down25deg },
-            { { 24, 20, -10 }, 16, Pitch::down25deg },
-            { { 24, 21, -10 }, 16, Pitch::down25deg },
-            { { 24, 22, -11 }, 16, Pitch::down25deg },
-            { { 24, 23, -11 }, 16, Pitch::down25deg },
-            { { 24, 24, -12 }, 16, Pitch::down25deg },
-            { { 24, 25, -12 }, 16, Pitch::down25deg },
-            { { 24, 26, -13 }, 16, Pitch::down25deg },
-            { { 24, 27, -13 }, 16, Pitch::down25deg },
-            { { 24, 28, -14 }, 16, Pitch::down25deg },
-            { { 24, 29, -14 }, 16, Pitch::down25deg },
-            { { 24, 30, -15 }, 16, Pitch::down25deg },
-            { { 24, 31, -15 }, 16, Pitch::down25deg },
-        });
-
-    // 0x4dd576
-    // Track 35. Reversed 0. Direction 0
-    static constexpr auto moveInfoT35R0D0 = std::to_array<MoveInfo>(
-        {
-            { { 31, 24, 0 }, 0, Pitch::up25deg },
-            { { 30, 24, 0 }, 0, Pitch::up25deg },
-            { { 29, 24, 1 }, 0, Pitch::up25deg },
-            { { 28, 24, 1 }, 0, Pitch::up25deg },
-            { { 27, 24, 2 }, 0, Pitch::up25deg },
-            { { 26, 24, 2 }, 0, Pitch::up25deg },
-            { { 25, 24, 3 }, 0, Pitch::up25deg },
-            { { 24, 24, 3 }, 0, Pitch::up25deg },
-            { { 23, 24, 4 }, 0, Pitch::up25deg },
-            { { 22, 24, 4 }, 0, Pitch::up25deg },
-            { { 21, 24, 5 }, 0, Pitch::up25deg },
-            { { 20, 24, 5 }, 0, Pitch::up25deg },
-            { { 19, 24, 6 }, 0, Pitch::up25deg },
-            { { 18, 24, 6 }, 0, Pitch::up25deg },
-            { { 17, 24, 7 }, 0, Pitch::up25deg },
-            { { 16, 24, 7 }, 0, Pitch::up25deg },
-            { { 15, 24, 8 }, 0, Pitch::up25deg },
-            { { 14, 24, 8 }, 0, Pitch::up25deg },
-            { { 13, 24, 9 }, 0, Pitch::up25deg },
-            { { 12, 24, 9 }, 0, Pitch::up25deg },
-            { { 11, 24, 10 }, 0, Pitch::up25deg },
-            { { 10, 24, 10 }, 0, Pitch::up25deg },
-            { { 9, 24, 11 }, 0, Pitch::up25deg },
-            { { 8, 24, 11 }, 0, Pitch::up25deg },
-            { { 7, 24, 12 }, 0, Pitch::up25deg },
-            { { 6, 24, 12 }, 0, Pitch::up25deg },
-            { { 5, 24, 13 }, 0, Pitch::up25deg },
-            { { 4, 24, 13 }, 0, Pitch::up25deg },
-            { { 3, 24, 14 }, 0, Pitch::up25deg },
-            { { 2, 24, 14 }, 0, Pitch::up25deg },
-            { { 1, 24, 15 }, 0, Pitch::up25deg },
-            { { 0, 24, 15 }, 0, Pitch::up25deg },
-        });
-
-    // 0x4dd678
-    // Track 35. Reversed 0. Direction 1
-    static constexpr auto moveInfoT35R0D1 = std::to_array<MoveInfo>(
-        {
-            { { 24, 0, 0 }, 16, Pitch::up25deg },
-            { { 24, 1, 0 }, 16, Pitch::up25deg },
-            { { 24, 2, 1 }, 16, Pitch::up25deg },
-            { { 24, 3, 1 }, 16, Pitch::up25deg },
-            { { 24, 4, 2 }, 16, Pitch::up25deg },
-            { { 24, 5, 2 }, 16, Pitch::up25deg },
-            { { 24, 6, 3 }, 16, Pitch::up25deg },
-            { { 24, 7, 3 }, 16, Pitch::up25deg },
-            { { 24, 8, 4 }, 16, Pitch::up25deg },
-            { { 24, 9, 4 }, 16, Pitch::up25deg },
-            { { 24, 10, 5 }, 16, Pitch::up25deg },
-            { { 24, 11, 5 }, 16, Pitch::up25deg },
-            { { 24, 12, 6 }, 16, Pitch::up25deg },
-            { { 24, 13, 6 }, 16, Pitch::up25deg },
-            { { 24, 14, 7 }, 16, Pitch::up25deg },
-            { { 24, 15, 7 }, 16, Pitch::up25deg },
-            { { 24, 16, 8 }, 16, Pitch::up25deg },
-            { { 24, 17, 8 }, 16, Pitch::up25deg },
-            { { 24, 18, 9 }, 16, Pitch::up25deg },
-            { { 24, 19, 9 }, 16, Pitch::up25deg },
-            { { 24, 20, 10 }, 16, Pitch::up25deg },
-            { { 24, 21, 10 }, 16, Pitch::up25deg },
-            { { 24, 22, 11 }, 16, Pitch::up25deg },
-            { { 24, 23, 11 }, 16, Pitch::up25deg },
-            { { 24, 24, 12 }, 16, Pitch::up25deg },
-            { { 24, 25, 12 }, 16, Pitch::up25deg },
-            { { 24, 26, 13 }, 16, Pitch::up25deg },
-            { { 24, 27, 13 }, 16, Pitch::up25deg },
-            { { 24, 28, 14 }, 16, Pitch::up25deg },
-            { { 24, 29, 14 }, 16, Pitch::up25deg },
-            { { 24, 30, 15 }, 16, Pitch::up25deg },
-            { { 24, 31, 15 }, 16, Pitch::up25deg },
-        });
-
-    // 0x4dd77a
-    // Track 35. Reversed 0. Direction 2
-    static constexpr auto moveInfoT35R0D2 = std::to_array<MoveInfo>(
-        {
-            { { 0, 8, 0 }, 32, Pitch::up25deg },
-            { { 1, 8, 0 }, 32, Pitch::up25deg },
-            { { 2, 8, 1 }, 32, Pitch::up25deg },
-            { { 3, 8, 1 }, 32, Pitch::up25deg },
-            { { 4, 8, 2 }, 32, Pitch::up25deg },
-            { { 5, 8, 2 }, 32, Pitch::up25deg },
-            { { 6, 8, 3 }, 32, Pitch::up25deg },
-            { { 7, 8, 3 }, 32, Pitch::up25deg },
-            { { 8, 8, 4 }, 32, Pitch::up25deg },
-            { { 9, 8, 4 }, 32, Pitch::up25deg },
-            { { 10, 8, 5 }, 32, Pitch::up25deg },
-            { { 11, 8, 5 }, 32, Pitch::up25deg },
-            { { 12, 8, 6 }, 32, Pitch::up25deg },
-            { { 13, 8, 6 }, 32, Pitch::up25deg },
-            { { 14, 8, 7 }, 32, Pitch::up25deg },
-            { { 15, 8, 7 }, 32, Pitch::up25deg },
-            { { 16, 8, 8 }, 32, Pitch::up25deg },
-            { { 17, 8, 8 }, 32, Pitch::up25deg },
-            { { 18, 8, 9 }, 32, Pitch::up25deg },
-            { { 19, 8, 9 }, 32, Pitch::up25deg },
-            { { 20, 8, 10 }, 32, Pitch::up25deg },
-            { { 21, 8, 10 }, 32, Pitch::up25deg },
-            { { 22, 8, 11 }, 32, Pitch::up25deg },
-            { { 23, 8, 11 }, 32, Pitch::up25deg },
-            { { 24, 8, 12 }, 32, Pitch::up25deg },
-            { { 25, 8, 12 }, 32, Pitch::up25deg },
-            { { 26, 8, 13 }, 32, Pitch::up25deg },
-            { { 27, 8, 13 }, 32, Pitch::up25deg },
-            { { 28, 8, 14 }, 32, Pitch::up25deg },
-            { { 29, 8, 14 }, 32, Pitch::up25deg },
-            { { 30, 8, 15 }, 32, Pitch::up25deg },
-            { { 31, 8, 15 }, 32, Pitch::up25deg },
-        });
-
-    // 0x4dd87c
-    // Track 35. Reversed 0. Direction 3
-    static constexpr auto moveInfoT35R0D3 = std::to_array<MoveInfo>(
-        {
-            { { 8, 31, 0 }, 48, Pitch::up25deg },
-            { { 8, 30, 0 }, 48, Pitch::up25deg },
-            { { 8, 29, 1 }, 48, Pitch::up25deg },
-            { { 8, 28, 1 }, 48, Pitch::up25deg },
-            { { 8, 27, 2 }, 48, Pitch::up25deg },
-            { { 8, 26, 2 }, 48, Pitch::up25deg },
-            { { 8, 25, 3 }, 48, Pitch::up25deg },
-            { { 8, 24, 3 }, 48, Pitch::up25deg },
-            { { 8, 23, 4 }, 48, Pitch::up25deg },
-            { { 8, 22, 4 }, 48, Pitch::up25deg },
-            { { 8, 21, 5 }, 48, Pitch::up25deg },
-            { { 8, 20, 5 }, 48, Pitch::up25deg },
-            { { 8, 19, 6 }, 48, Pitch::up25deg },
-            { { 8, 18, 6 }, 48, Pitch::up25deg },
-            { { 8, 17, 7 }, 48, Pitch::up25deg },
-            { { 8, 16, 7 }, 48, Pitch::up25deg },
-            { { 8, 15, 8 }, 48, Pitch::up25deg },
-            { { 8, 14, 8 }, 48, Pitch::up25deg },
-            { { 8, 13, 9 }, 48, Pitch::up25deg },
-            { { 8, 12, 9 }, 48, Pitch::up25deg },
-            { { 8, 11, 10 }, 48, Pitch::up25deg },
-            { { 8, 10, 10 }, 48, Pitch::up25deg },
-            { { 8, 9, 11 }, 48, Pitch::up25deg },
-            { { 8, 8, 11 }, 48, Pitch::up25deg },
-            { { 8, 7, 12 }, 48, Pitch::up25deg },
-            { { 8, 6, 12 }, 48, Pitch::up25deg },
-            { { 8, 5, 13 }, 48, Pitch::up25deg },
-            { { 8, 4, 13 }, 48, Pitch::up25deg },
-            { { 8, 3, 14 }, 48, Pitch::up25deg },
-            { { 8, 2, 14 }, 48, Pitch::up25deg },
-            { { 8, 1, 15 }, 48, Pitch::up25deg },
-            { { 8, 0, 15 }, 48, Pitch::up25deg },
-        });
-
-    // 0x4dd372
-    // Track 35. Reversed 1. Direction 0
-    static constexpr auto moveInfoT35R1D0 = std::to_array<MoveInfo>(
-        {
-            { { 0, 24, 0 }, 32, Pitch::down25deg },
-            { { 1, 24, 0 }, 32, Pitch::down25deg },
-            { { 2, 24, -1 }, 32, Pitch::down25deg },
-            { { 3, 24, -1 }, 32, Pitch::down25deg },
-            { { 4, 24, -2 }, 32, Pitch::down25deg },
-            { { 5, 24, -2 }, 32, Pitch::down25deg },
-            { { 6, 24, -3 }, 32, Pitch::down25deg },
-            { { 7, 24, -3 }, 32, Pitch::down25deg },
-            { { 8, 24, -4 }, 32, Pitch::down25deg },
-            { { 9, 24, -4 }, 32, Pitch::down25deg },
-            { { 10, 24, -5 }, 32, Pitch::down25deg },
-            { { 11, 24, -5 }, 32, Pitch::down25deg },
-            { { 12, 24, -6 }, 32, Pitch::down25deg },
-            { { 13, 24, -6 }, 32, Pitch::down25deg },
-            { { 14, 24, -7 }, 32, Pitch::down25deg },
-            { { 15, 24, -7 }, 32, Pitch::down25deg },
-            { { 16, 24, -8 }, 32, Pitch::down25deg },
-            { { 17, 24, -8 }, 32, Pitch::down25deg },
-            { { 18, 24, -9 }, 32, Pitch::down25deg },
-            { { 19, 24, -9 }, 32, Pitch::down25deg },
-            { { 20, 24, -10 }, 32, Pitch::down25deg },
-            { { 21, 24, -10 }, 32, Pitch::down25deg },
-            { { 22, 24, -11 }, 32, Pitch::down25deg },
-            { { 23, 24, -11 }, 32, Pitch::down25deg },
-            { { 24, 24, -12 }, 32, Pitch::down25deg },
-            { { 25, 24, -12 }, 32, Pitch::down25deg },
-            { { 26, 24, -13 }, 32, Pitch::down25deg },
-            { { 27, 24, -13 }, 32, Pitch::down25deg },
-            { { 28, 24, -14 }, 32, Pitch::down25deg },
-            { { 29, 24, -14 }, 32, Pitch::down25deg },
-            { { 30, 24, -15 }, 32, Pitch::down25deg },
-            { { 31, 24, -15 }, 32, Pitch::down25deg },
-        });
-
-    // 0x4dd474
-    // Track 35. Reversed 1. Direction 1
-    static constexpr auto moveInfoT35R1D1 = std::to_array<MoveInfo>(
-        {
-            { { 24, 31, 0 }, 48, Pitch::down25deg },
-            { { 24, 30, 0 }, 48, Pitch::down25deg },
-            { { 24, 29, -1 }, 48, Pitch::down25deg },
-            { { 24, 28, -1 }, 48, Pitch::down25deg },
-            { { 24, 27, -2 }, 48, Pitch::down25deg },
-            { { 24, 26, -2 }, 48, Pitch::down25deg },
-            { { 24, 25, -3 }, 48, Pitch::down25deg },
-            { { 24, 24, -3 }, 48, Pitch::down25deg },
-            { { 24, 23, -4 }, 48, Pitch::down25deg },
-            { { 24, 22, -4 }, 48, Pitch::down25deg },
-            { { 24, 21, -5 }, 48, Pitch::down25deg },
-            { { 24, 20, -5 }, 48, Pitch::down25deg },
-            { { 24, 19, -6 }, 48, Pitch::down25deg },
-            { { 24, 18, -6 }, 48, Pitch::down25deg },
-            { { 24, 17, -7 }, 48, Pitch::down25deg },
-            { { 24, 16, -7 }, 48, Pitch::down25deg },
-            { { 24, 15, -8 }, 48, Pitch::down25deg },
-            { { 24, 14, -8 }, 48, Pitch::down25deg },
-            { { 24, 13, -9 }, 48, Pitch::down25deg },
-            { { 24, 12, -9 }, 48, Pitch::down25deg },
-            { { 24, 11, -10 }, 48, Pitch::down25deg },
-            { { 24, 10, -10 }, 48, Pitch::down25deg },
-            { { 24, 9, -11 }, 48, Pitch::down25deg },
-            { { 24, 8, -11 }, 48, Pitch::down25deg },
-            { { 24, 7, -12 }, 48, Pitch::down25deg },
-            { { 24, 6, -12 }, 48, Pitch::down25deg },
-            { { 24, 5, -13 }, 48, Pitch::down25deg },
-            { { 24, 4, -13 }, 48, Pitch::down25deg },
-            { { 24, 3, -14 }, 48, Pitch::down25deg },
-            { { 24, 2, -14 }, 48, Pitch::down25deg },
-            { { 24, 1, -15 }, 48, Pitch::down25deg },
-            { { 24, 0, -15 }, 48, Pitch::down25deg },
-        });
-
-    // 0x4dd16e
-    // Track 35. Reversed 1. Direction 2
-    static constexpr auto moveInfoT35R1D2 = std::to_array<MoveInfo>(
-        {
-            { { 31, 8, 0 }, 0, Pitch::down25deg },
-            { { 30, 8, 0 }, 0, Pitch::down25deg },
-            { { 29, 8, -1 }, 0, Pitch::down25deg },
-            { { 28, 8, -1 }, 0, Pitch::down25deg },
-            { { 27, 8, -2 }, 0, Pitch::down25deg },
-            { { 26, 8, -2 }, 0, Pitch::down25deg },
-            { { 25, 8, -3 }, 0, Pitch::down25deg },
-            { { 24, 8, -3 }, 0, Pitch::down25deg },
-            { { 23, 8, -4 }, 0, Pitch::down25deg },
-            { { 22, 8, -4 }, 0, Pitch::down25deg },
-            { { 21, 8, -5 }, 0, Pitch::down25deg },
-            { { 20, 8, -5 }, 0, Pitch::down25deg },
-            { { 19, 8, -6 }, 0, Pitch::down25deg },
-            { { 18, 8, -6 }, 0, Pitch::down25deg },
-            { { 17, 8, -7 }, 0, Pitch::down25deg },
-            { { 16, 8, -7 }, 0, Pitch::down25deg },
-            { { 15, 8, -8 }, 0, Pitch::down25deg },
-            { { 14, 8, -8 }, 0, Pitch::down25deg },
-            { { 13, 8, -9 }, 0, Pitch::down25deg },
-            { { 12, 8, -9 }, 0, Pitch::down25deg },
-            { { 11, 8, -10 }, 0, Pitch::down25deg },
-            { { 10, 8, -10 }, 0, Pitch::down25deg },
-            { { 9, 8, -11 }, 0, Pitch::down25deg },
-            { { 8, 8, -11 }, 0, Pitch::down25deg },
-            { { 7, 8, -12 }, 0, Pitch::down25deg },
-            { { 6, 8, -12 }, 0, Pitch::down25deg },
-            { { 5, 8, -13 }, 0, Pitch::down25deg },
-            { { 4, 8, -13 }, 0, Pitch::down25deg },
-            { { 3, 8, -14 }, 0, Pitch::down25deg },
-            { { 2, 8, -14 }, 0, Pitch::down25deg },
-            { { 1, 8, -15 }, 0, Pitch::down25deg },
-            { { 0, 8, -15 }, 0, Pitch::down25deg },
-        });
-
-    // 0x4dd270
-    // Track 35. Reversed 1. Direction 3
-    static constexpr auto moveInfoT35R1D3 = std::to_array<MoveInfo>(
-        {
-            { { 8, 0, 0 }, 16, Pitch::down25deg },
-            { { 8, 1, 0 }, 16, Pitch::down25deg },
-            { { 8, 2, -1 }, 16, Pitch::down25deg },
-            { { 8, 3, -1 }, 16, Pitch::down25deg },
-            { { 8, 4, -2 }, 16, Pitch::down25deg },
-            { { 8, 5, -2 }, 16, Pitch::down25deg },
-            { { 8, 6, -3 }, 16, Pitch::down25deg },
-            { { 8, 7, -3 }, 16, Pitch::down25deg },
-            { { 8, 8, -4 }, 16, Pitch::down25deg },
-            { { 8, 9, -4 }, 16, Pitch::down25deg },
-            { { 8, 10, -5 }, 16, Pitch::down25deg },
-            { { 8, 11, -5 }, 16, Pitch::down25deg },
-            { { 8, 12, -6 }, 16, Pitch::down25deg },
-            { { 8, 13, -6 }, 16, Pitch::down25deg },
-            { { 8, 14, -7 }, 16, Pitch::down25deg },
-            { { 8, 15, -7 }, 16, Pitch::down25deg },
-            { { 8, 16, -8 }, 16, Pitch::down25deg },
-            { { 8, 17, -8 }, 16, Pitch::down25deg },
-            { { 8, 18, -9 }, 16, Pitch::down25deg },
-            { { 8, 19, -9 }, 16, Pitch::down25deg },
-            { { 8, 20, -10 }, 16, Pitch::down25deg },
-            { { 8, 21, -10 }, 16, Pitch::down25deg },
-            { { 8, 22, -11 }, 16, Pitch::down25deg },
-            { { 8, 23, -11 }, 16, Pitch::down25deg },
-            { { 8, 24, -12 }, 16, Pitch::down25deg },
-            { { 8, 25, -12 }, 16, Pitch::down25deg },
-            { { 8, 26, -13 }, 16, Pitch::down25deg },
-            { { 8, 27, -13 }, 16, Pitch::down25deg },
-            { { 8, 28, -14 }, 16, Pitch::down25deg },
-            { { 8, 29, -14 }, 16, Pitch::down25deg },
-            { { 8, 30, -15 }, 16, Pitch::down25deg },
-            { { 8, 31, -15 }, 16, Pitch::down25deg },
-        });
-
-    // 0x4ddd86
-    // Track 38. Reversed 0. Direction 0
-    static constexpr auto moveInfoT38R0D0 = std::to_array<MoveInfo>(
-        {
-            { { 31, 16, 0 }, 0, Pitch::flat },
-            { { 30, 16, 0 }, 0, Pitch::flat },
-            { { 29, 16, 0 }, 0, Pitch::flat },
-            { { 28, 16, 0 }, 0, Pitch::flat },
-            { { 27, 16, 0 }, 62, Pitch::flat },
-            { { 26, 15, 0 }, 62, Pitch::flat },
-            { { 25, 15, 0 }, 62, Pitch::flat },
-            { { 24, 15, 0 }, 62, Pitch::flat },
-            { { 23, 15, 0 }, 60, Pitch::flat },
-            { { 22, 14, 0 }, 60, Pitch::flat },
-            { { 21, 14, 0 }, 60, Pitch::flat },
-            { { 20, 14, 0 }, 60, Pitch::flat },
-            { { 19, 13, 0 }, 60, Pitch::flat },
-            { { 18, 13, 0 }, 60, Pitch::flat },
-            { { 17, 13, 0 }, 60, Pitch::flat },
-            { { 16, 12, 0 }, 60, Pitch::flat },
-            { { 15, 12, 0 }, 60, Pitch::flat },
-            { { 14, 11, 0 }, 60, Pitch::flat },
-            { { 13, 11, 0 }, 60, Pitch::flat },
-            { { 12, 11, 0 }, 60, Pitch::flat },
-            { { 11, 10, 0 }, 60, Pitch::flat },
-            { { 10, 10, 0 }, 60, Pitch::flat },
-            { { 9, 10, 0 }, 60, Pitch::flat },
-            { { 8, 9, 0 }, 60, Pitch::flat },
-            { { 7, 9, 0 }, 62, Pitch::flat },
-            { { 6, 9, 0 }, 62, Pitch::flat },
-            { { 5, 9, 0 }, 62, Pitch::flat },
-            { { 4, 8, 0 }, 62, Pitch::flat },
-            { { 3, 8, 0 }, 0, Pitch::flat },
-            { { 2, 8, 0 }, 0, Pitch::flat },
-            { { 1, 8, 0 }, 0, Pitch::flat },
-            { { 0, 8, 0 }, 0, Pitch::flat },
-        });
-
-    // 0x4dde88
-    // Track 38. Reversed 0. Direction 1
-    static constexpr auto moveInfoT38R0D1 = std::to_array<MoveInfo>(
-        {
-            { { 16, 0, 0 }, 16, Pitch::flat },
-            { { 16, 1, 0 }, 16, Pitch::flat },
-            { { 16, 2, 0 }, 16, Pitch::flat },
-            { { 16, 3, 0 }, 16, Pitch::flat },
-            { { 16, 4, 0 }, 14, Pitch::flat },
-            { { 15, 5, 0 }, 14, Pitch::flat },
-            { { 15, 6, 0 }, 14, Pitch::flat },
-            { { 15, 7, 0 }, 14, Pitch::flat },
-            { { 15, 8, 0 }, 12, Pitch::flat },
-            { { 14, 9, 0 }, 12, Pitch::flat },
-            { { 14, 10, 0 }, 12, Pitch::flat },
-            { { 14, 11, 0 }, 12, Pitch::flat },
-            { { 13, 12, 0 }, 12, Pitch::flat },
-            { { 13, 13, 0 }, 12, Pitch::flat },
-            { { 13, 14, 0 }, 12, Pitch::flat },
-            { { 12, 15, 0 }, 12, Pitch::flat },
-            { { 12, 16, 0 }, 12, Pitch::flat },
-            { { 11, 17, 0 }, 12, Pitch::flat },
-            { { 11, 18, 0 }, 12, Pitch::flat },
-            { { 11, 19, 0 }, 12, Pitch::flat },
-            { { 10, 20, 0 }, 12, Pitch::flat },
-            { { 10, 21, 0 }, 12, Pitch::flat },
-            { { 10, 22, 0 }, 12, Pitch::flat },
-            { { 9, 23, 0 }, 12, Pitch::flat },
-            { { 9, 24, 0 }, 14, Pitch::flat },
-            { { 9, 25, 0 }, 14, Pitch::flat },
-            { { 9, 26, 0 }, 14, Pitch::flat },
-            { { 8, 27, 0 }, 14, Pitch::flat },
-            { { 8, 28, 0 }, 16, Pitch::flat },
-            { { 8, 29, 0 }, 16, Pitch::flat },
-            { { 8, 30, 0 }, 16, Pitch::flat },
-            { { 8, 31, 0 }, 16, Pitch::flat },
-        });
-
-    // 0x4ddf8a
-    // Track 38. Reversed 0. Direction 2
-    static constexpr auto moveInfoT38R0D2 = std::to_array<MoveInfo>(
-        {
-            { { 0, 16, 0 }, 32, Pitch::flat },
-            { { 1, 16, 0 }, 32, Pitch::flat },
-            { { 2, 16, 0 }, 32, Pitch::flat },
-            { { 3, 16, 0 }, 32, Pitch::flat },
-            { { 4, 16, 0 }, 30, Pitch::flat },
-            { { 5, 17, 0 }, 30, Pitch::flat },
-            { { 6, 17, 0 }, 30, Pitch::flat },
-            { { 7, 17, 0 }, 30, Pitch::flat },
-            { { 8, 17, 0 }, 28, Pitch::flat },
-            { { 9, 18, 0 }, 28, Pitch::flat },
-            { { 10, 18, 0 }, 28, Pitch::flat },
-            { { 11, 18, 0 }, 28, Pitch::flat },
-            { { 12, 19, 0 }, 28, Pitch::flat },
-            { { 13, 19, 0 }, 28, Pitch::flat },
-            { { 14, 19, 0 }, 28, Pitch::flat },
-            { { 15, 20, 0 }, 28, Pitch::flat },
-            { { 16, 20, 0 }, 28, Pitch::flat },
-            { { 17, 21, 0 }, 28, Pitch::flat },
-            { { 18, 21, 0 }, 28, Pitch::flat },
-            { { 19, 21, 0 }, 28, Pitch::flat },
-            { { 20, 22, 0 }, 28, Pitch::flat },
-            { { 21, 22, 0 }, 28, Pitch::flat },
-            { { 22, 22, 0 }, 28, Pitch::flat },
-            { { 23, 23, 0 }, 28, Pitch::flat },
-            { { 24, 23, 0 }, 30, Pitch::flat },
-            { { 25, 23, 0 }, 30, Pitch::flat },
-            { { 26, 23, 0 }, 30, Pitch::flat },
-            { { 27, 24, 0 }, 30, Pitch::flat },
-            { { 28, 24, 0 }, 32, Pitch::flat },
-            { { 29, 24, 0 }, 32, Pitch::flat },
-            { { 30, 24, 0 }, 32, Pitch::flat },
-            { { 31, 24, 0 }, 32, Pitch::flat },
-        });
-
-    // 0x4de08c
-    // Track 38. Reversed 0. Direction 3
-    static constexpr auto moveInfoT38R0D3 = std::to_array<MoveInfo>(
-        {
-            { { 16, 31, 0 }, 48, Pitch::flat },
-            { { 16, 30, 0 }, 48, Pitch::flat },
-            { { 16, 29, 0 }, 48, Pitch::flat },
-            { { 16, 28, 0 }, 48, Pitch::flat },
-            { { 16, 27, 0 }, 46, Pitch::flat },
-            { { 17, 26, 0 }, 46, Pitch::flat },
-            { { 17, 25, 0 }, 46, Pitch::flat },
-            { { 17, 24, 0 }, 46, Pitch::flat },
-            { { 17, 23, 0 }, 44, Pitch::flat },
-            { { 18, 22, 0 }, 44, Pitch::flat },
-            { { 18, 21, 0 }, 44, Pitch::flat },
-            { { 18, 20, 0 }, 44, Pitch::flat },
-            { { 19, 19, 0 }, 44, Pitch::flat },
-            { { 19, 18, 0 }, 44, Pitch::flat },
-            { { 19, 17, 0 }, 44, Pitch::flat },
-            { { 20, 16, 0 }, 44, Pitch::flat },
-            { { 20, 15, 0 }, 44, Pitch::flat },
-            { { 21, 14, 0 }, 44, Pitch::flat },
-            { { 21, 13, 0 }, 44, Pitch::flat },
-            { { 21, 12, 0 }, 44, Pitch::flat },
-            { { 22, 11, 0 }, 44, Pitch::flat },
-            { { 22, 10, 0 }, 44, Pitch::flat },
-            { { 22, 9, 0 }, 44, Pitch::flat },
-            { { 23, 8, 0 }, 44, Pitch::flat },
-            { { 23, 7, 0 }, 46, Pitch::flat },
-            { { 23, 6, 0 }, 46, Pitch::flat },
-            { { 23, 5, 0 }, 46, Pitch::flat },
-            { { 24, 4, 0 }, 46, Pitch::flat },
-            { { 24, 3, 0 }, 48, Pitch::flat },
-            { { 24, 2, 0 }, 48, Pitch::flat },
-            { { 24, 1, 0 }, 48, Pitch::flat },
-            { { 24, 0, 0 }, 48, Pitch::flat },
-        });
-
-    // 0x4deba2
-    // Track 38. Reversed 1. Direction 0
-    static constexpr auto moveInfoT38R1D0 = std::to_array<MoveInfo>(
-        {
-            { { 0, 8, 0 }, 32, Pitch::flat },
-            { { 1, 8, 0 }, 32, Pitch::flat },
-            { { 2, 8, 0 }, 32, Pitch::flat },
-            { { 3, 8, 0 }, 32, Pitch::flat },
-            { { 4, 8, 0 }, 30, Pitch::flat },
-            { { 5, 9, 0 }, 30, Pitch::flat },
-            { { 6, 9, 0 }, 30, Pitch::flat },
-            { { 7, 9, 0 }, 30, Pitch::flat },
-            { { 8, 9, 0 }, 28, Pitch::flat },
-            { { 9, 10, 0 }, 28, Pitch::flat },
-            { { 10, 10, 0 }, 28, Pitch::flat },
-            { { 11, 10, 0 }, 28, Pitch::flat },
-            { { 12, 11, 0 }, 28, Pitch::flat },
-            { { 13, 11, 0 }, 28, Pitch::flat },
-            { { 14, 11, 0 }, 28, Pitch::flat },
-            { { 15, 12, 0 }, 28, Pitch::flat },
-            { { 16, 12, 0 }, 28, Pitch::flat },
-            { { 17, 13, 0 }, 28, Pitch::flat },
-            { { 18, 13, 0 }, 28, Pitch::flat },
-            { { 19, 13, 0 }, 28, Pitch::flat },
-            { { 20, 14, 0 }, 28, Pitch::flat },
-            { { 21, 14, 0 }, 28, Pitch::flat },
-            { { 22, 14, 0 }, 28, Pitch::flat },
-            { { 23, 15, 0 }, 28, Pitch::flat },
-            { { 24, 15, 0 }, 30, Pitch::flat },
-            { { 25, 15, 0 }, 30, Pitch::flat },
-            { { 26, 15, 0 }, 30, Pitch::flat },
-            { { 27, 16, 0 }, 30, Pitch::flat },
-            { { 28, 16, 0 }, 32, Pitch::flat },
-            { { 29, 16, 0 }, 32, Pitch::flat },
-            { { 30, 16, 0 }, 32, Pitch::flat },
-            { { 31, 16, 0 }, 32, Pitch::flat },
-        });
-
-    // 0x4deca4
-    // Track 38. Reversed 1. Direction 1
-    static constexpr auto moveInfoT38R1D1 = std::to_array<MoveInfo>(
-        {
-            { { 8, 31, 0 }, 48, Pitch::flat },
-            { { 8, 30, 0 }, 48, Pitch::flat },
-            { { 8, 29, 0 }, 48, Pitch::flat },
-            { { 8, 28, 0 }, 48, Pitch::flat },
-            { { 8, 27, 0 }, 46, Pitch::flat },
-            { { 9, 26, 0 }, 46, Pitch::flat },
-            { { 9, 25, 0 }, 46, Pitch::flat },
-            { { 9, 24, 0 }, 46, Pitch::flat },
-            { { 9, 23, 0 }, 44, Pitch::flat },
-            { { 10, 22, 0 }, 44, Pitch::flat },
-            { { 10, 21, 0 }, 44, Pitch::flat },
-            { { 10, 20, 0 }, 44, Pitch::flat },
-            { { 11, 19, 0 }, 44, Pitch::flat },
-            { { 11, 18, 0 }, 44, Pitch::flat },
-            { { 11, 17, 0 }, 44, Pitch::flat },
-            { { 12, 16, 0 }, 44, Pitch::flat },
-            { { 12, 15, 0 }, 44, Pitch::flat },
-            { { 13, 14, 0 }, 44, Pitch::flat },
-            { { 13, 13, 0 }, 44, Pitch::flat },
-            { { 13, 12, 0 }, 44, Pitch::flat },
-            { { 14, 11, 0 }, 44, Pitch::flat },
-            { { 14, 10, 0 }, 44, Pitch::flat },
-            { { 14, 9, 0 }, 44, Pitch::flat },
-            { { 15, 8, 0 }, 44, Pitch::flat },
-            { { 15, 7, 0 }, 46, Pitch::flat },
-            { { 15, 6, 0 }, 46, Pitch::flat },
-            { { 15, 5, 0 }, 46, Pitch::flat },
-            { { 16, 4, 0 }, 46, Pitch::flat },
-            { { 16, 3, 0 }, 48, Pitch::flat },
-            { { 16, 2, 0 }, 48, Pitch::flat },
-            { { 16, 1, 0 }, 48, Pitch::flat },
-            { { 16, 0, 0 }, 48, Pitch::flat },
-        });
-
-    // 0x4de99e
-    // Track 38. Reversed 1. Direction 2
-    static constexpr auto moveInfoT38R1D2 = std::to_array<MoveInfo>(
-        {
-            { { 31, 24, 0 }, 0, Pitch::flat },
-            { { 30, 24, 0 }, 0, Pitch::flat },
-            { { 29, 24, 0 }, 0, Pitch::flat },
-            { { 28, 24, 0 }, 0, Pitch::flat },
-            { { 27, 24, 0 }, 62, Pitch::flat },
-            { { 26, 23, 0 }, 62, Pitch::flat },
-            { { 25, 23, 0 }, 62, Pitch::flat },
-            { { 24, 23, 0 }, 62, Pitch::flat },
-            { { 23, 23, 0 }, 60, Pitch::flat },
-            { { 22, 22, 0 }, 60, Pitch::flat },
-            { { 21, 22, 0 }, 60, Pitch::flat },
-            { { 20, 22, 0 }, 60, Pitch::flat },
-            { { 19, 21, 0 }, 60, Pitch::flat },
-            { { 18, 21, 0 }, 60, Pitch::flat },
-            { { 17, 21, 0 }, 60, Pitch::flat },
-            { { 16, 20, 0 }, 60, Pitch::flat },
-            { { 15, 20, 0 }, 60, Pitch::flat },
-            { { 14, 19, 0 }, 60, Pitch::flat },
-            { { 13, 19, 0 }, 60, Pitch::flat },
-            { { 12, 19, 0 }, 60, Pitch::flat },
-            { { 11, 18, 0 }, 60, Pitch::flat },
-            { { 10, 18, 0 }, 60, Pitch::flat },
-            { { 9, 18, 0 }, 60, Pitch::flat },
-            { { 8, 17, 0 }, 60, Pitch::flat },
-            { { 7, 17, 0 }, 62, Pitch::flat },
-            { { 6, 17, 0 }, 62, Pitch::flat },
-            { { 5, 17, 0 }, 62, Pitch::flat },
-            { { 4, 16, 0 }, 62, Pitch::flat },
-            { { 3, 16, 0 }, 0, Pitch::flat },
-            { { 2, 16, 0 }, 0, Pitch::flat },
-            { { 1, 16, 0 }, 0, Pitch::flat },
-            { { 0, 16, 0 }, 0, Pitch::flat },
-        });
-
-    // 0x4deaa0
-    // Track 38. Reversed 1. Direction 3
-    static constexpr auto moveInfoT38R1D3 = std::to_array<MoveInfo>(
-        {
-            { { 24, 0, 0 }, 16, Pitch::flat },
-            { { 24, 1, 0 }, 16, Pitch::flat },
-            { { 24, 2, 0 }, 16, Pitch::flat },
-            { { 24, 3, 0 }, 16, Pitch::flat },
-            { { 24, 4, 0 }, 14, Pitch::flat },
-            { { 23, 5, 0 }, 14, Pitch::flat },
-            { { 23, 6, 0 }, 14, Pitch::flat },
-            { { 23, 7, 0 }, 14, Pitch::flat },
-            { { 23, 8, 0 }, 12, Pitch::flat },
-            { { 22, 9, 0 }, 12, Pitch::flat },
-            { { 22, 10, 0 }, 12, Pitch::flat },
-            { { 22, 11, 0 }, 12, Pitch::flat },
-            { { 21, 12, 0 }, 12, Pitch::flat },
-            { { 21, 13, 0 }, 12, Pitch::flat },
-            { { 21, 14, 0 }, 12, Pitch::flat },
-            { { 20, 15, 0 }, 12, Pitch::flat },
-            { { 20, 16, 0 }, 12, Pitch::flat },
-            { { 19, 17, 0 }, 12, Pitch::flat },
-            { { 19, 18, 0 }, 12, Pitch::flat },
-            { { 19, 19, 0 }, 12, Pitch::flat },
-            { { 18, 20, 0 }, 12, Pitch::flat },
-            { { 18, 21, 0 }, 12, Pitch::flat },
-            { { 18, 22, 0 }, 12, Pitch::flat },
-            { { 17, 23, 0 }, 12, Pitch::flat },
-            { { 17, 24, 0 }, 14, Pitch::flat },
-            { { 17, 25, 0 }, 14, Pitch::flat },
-            { { 17, 26, 0 }, 14, Pitch::flat },
-            { { 16, 27, 0 }, 14, Pitch::flat },
-            { { 16, 28, 0 }, 16, Pitch::flat },
-            { { 16, 29, 0 }, 16, Pitch::flat },
-            { { 16, 30, 0 }, 16, Pitch::flat },
-            { { 16, 31, 0 }, 16, Pitch::flat },
-        });
-
-    // 0x4de18e
-    // Track 39. Reversed 0. Direction 0
-    static constexpr auto moveInfoT39R0D0 = std::to_array<MoveInfo>(
-        {
-            { { 31, 16, 0 }, 0, Pitch::flat },
-            { { 30, 16, 0 }, 0, Pitch::flat },
-            { { 29, 16, 0 }, 0, Pitch::flat },
-            { { 28, 16, 0 }, 0, Pitch::flat },
-            { { 27, 16, 0 }, 2, Pitch::flat },
-            { { 26, 17, 0 }, 2, Pitch::flat },
-            { { 25, 17, 0 }, 2, Pitch::flat },
-            { { 24, 17, 0 }, 2, Pitch::flat },
-            { { 23, 17, 0 }, 4, Pitch::flat },
-            { { 22, 18, 0 }, 4, Pitch::flat },
-            { { 21, 18, 0 }, 4, Pitch::flat },
-            { { 20, 18, 0 }, 4, Pitch::flat },
-            { { 19, 19, 0 }, 4, Pitch::flat },
-            { { 18, 19, 0 }, 4, Pitch::flat },
-            { { 17, 19, 0 }, 4, Pitch::flat },
-            { { 16, 20, 0 }, 4, Pitch::flat },
-            { { 15, 20, 0 }, 4, Pitch::flat },
-            { { 14, 21, 0 }, 4, Pitch::flat },
-            { { 13, 21, 0 }, 4, Pitch::flat },
-            { { 12, 21, 0 }, 4, Pitch::flat },
-            { { 11, 22, 0 }, 4, Pitch::flat },
-            { { 10, 22, 0 }, 4, Pitch::flat },
-            { { 9, 22, 0 }, 4, Pitch::flat },
-            { { 8, 23, 0 }, 4, Pitch::flat },
-            { { 7, 23, 0 }, 2, Pitch::flat },
-            { { 6, 23, 0 }, 2, Pitch::flat },
-            { { 5, 23, 0 }, 2, Pitch::flat },
-            { { 4, 24, 0 }, 2, Pitch::flat },
-            { { 3, 24, 0 }, 0, Pitch::flat },
-            { { 2, 24, 0 }, 0, Pitch::flat },
-            { { 1, 24, 0 }, 0, Pitch::flat },
-            { { 0, 24, 0 }, 0, Pitch::flat },
-        });
-
-    // 0x4de290
-    // Track 39. Reversed 0. Direction 1
-    static constexpr auto moveInfoT39R0D1 = std::to_array<MoveInfo>(
-        {
-            { { 16, 0, 0 }, 16, Pitch::flat },
-            { { 16, 1, 0 }, 16, Pitch::flat },
-            { { 16, 2, 0 }, 16, Pitch::flat },
-            { { 16, 3, 0 }, 16, Pitch::flat },
-            { { 16, 4, 0 }, 18, Pitch::flat },
-            { { 17, 5, 0 }, 18, Pitch::flat },
-            { { 17, 6, 0 }, 18, Pitch::flat },
-            { { 17, 7, 0 }, 18, Pitch::flat },
-            { { 17, 8, 0 }, 20, Pitch::flat },
-            { { 18, 9, 0 }, 20, Pitch::flat },
-            { { 18, 10, 0 }, 20, Pitch::flat },
-            { { 18, 11, 0 }, 20, Pitch::flat },
-            { { 19, 12, 0 }, 20, Pitch::flat },
-            { { 19, 13, 0 }, 20, Pitch::flat },
-            { { 19, 14, 0 }, 20, Pitch::flat },
-            { { 20, 15, 0 }, 20, Pitch::flat },
-            { { 20, 16, 0 }, 20, Pitch::flat },
-            { { 21, 17, 0 }, 20, Pitch::flat },
-            { { 21, 18, 0 }, 20, Pitch::flat },
-            { { 21, 19, 0 }, 20, Pitch::flat },
-            { { 22, 20, 0 }, 20, Pitch::flat },
-            { { 22, 21, 0 }, 20, Pitch::flat },
-            { { 22, 22, 0 }, 20, Pitch::flat },
-            { { 23, 23, 0 }, 20, Pitch::flat },
-            { { 23, 24, 0 }, 18, Pitch::flat },
-            { { 23, 25, 0 }, 18, Pitch::flat },
-            { { 23, 26, 0 }, 18, Pitch::flat },
-            { { 24, 27, 0 }, 18, Pitch::flat },
-            { { 24, 28, 0 }, 16, Pitch::flat },
-            { { 24, 29, 0 }, 16, Pitch::flat },
-            { { 24, 30, 0 }, 16, Pitch::flat },
-            { { 24, 31, 0 }, 16, Pitch::flat },
-        });
-
-    // 0x4de392
-    // Track 39. Reversed 0. Direction 2
-    static constexpr auto moveInfoT39R0D2 = std::to_array<MoveInfo>(
-        {
-            { { 0, 16, 0 }, 32, Pitch::flat },
-            { { 1, 16, 0 }, 32, Pitch::flat },
-            { { 2, 16, 0 }, 32, Pitch::flat },
-            { { 3, 16, 0 }, 32, Pitch::flat },
-            { { 4, 16, 0 }, 34, Pitch::flat },
-            { { 5, 15, 0 }, 34, Pitch::flat },
-            { { 6, 15, 0 }, 34, Pitch::flat },
-            { { 7, 15, 0 }, 34, Pitch::flat },
-            { { 8, 15, 0 }, 36, Pitch::flat },
-            { { 9, 14, 0 }, 36, Pitch::flat },
-            { { 10, 14, 0 }, 36, Pitch::flat },
-            { { 11, 14, 0 }, 36, Pitch::flat },
-            { { 12, 13, 0 }, 36, Pitch::flat },
-            { { 13, 13, 0 }, 36, Pitch::flat },
-            { { 14, 13, 0 }, 36, Pitch::flat },
-            { { 15, 12, 0 }, 36, Pitch::flat },
-            { { 16, 12, 0 }, 36, Pitch::flat },
-            { { 17, 11, 0 }, 36, Pitch::flat },
-            { { 18, 11, 0 }, 36, Pitch::flat },
-            { { 19, 11, 0 }, 36, Pitch::flat },
-            { { 20, 10, 0 }, 36, Pitch::flat },
-            { { 21, 10, 0 }, 36, Pitch::flat },
-            { { 22, 10, 0 }, 36, Pitch::flat },
-            { { 23, 9, 0 }, 36, Pitch::flat },
-            { { 24, 9, 0 }, 34, Pitch::flat },
-            { { 25, 9, 0 }, 34, Pitch::flat },
-            { { 26, 9, 0 }, 34, Pitch::flat },
-            { { 27, 8, 0 }, 34, Pitch::flat },
-            { { 28, 8, 0 }, 32, Pitch::flat },
-            { { 29, 8, 0 }, 32, Pitch::flat },
-            { { 30, 8, 0 }, 32, Pitch::flat },
-            { { 31, 8, 0 }, 32, Pitch::flat },
-        });
-
-    // 0x4de494
-    // Track 39. Reversed 0. Direction 3
-    static constexpr auto moveInfoT39R0D3 = std::to_array<MoveInfo>(
-        {
-            { { 16, 31, 0 }, 48, Pitch::flat },
-            { { 16, 30, 0 }, 48, Pitch::flat },
-            { { 16, 29, 0 }, 48, Pitch::flat },
-            { { 16, 28, 0 }, 48, Pitch::flat },
-            { { 16, 27, 0 }, 50, Pitch::flat },
-            { { 15, 26, 0 }, 50, Pitch::flat },
-            { { 15, 25, 0 }, 50, Pitch::flat },
-            { { 15, 24, 0 }, 50, Pitch::flat },
-            { { 15, 23, 0 }, 52, Pitch::flat },
-            { { 14, 22, 0 }, 52, Pitch::flat },
-            { { 14, 21, 0 }, 52, Pitch::flat },
-            { { 14, 20, 0 }, 52, Pitch::flat },
-            { { 13, 19, 0 }, 52, Pitch::flat },
-            { { 13, 18, 0 }, 52, Pitch::flat },
-            { { 13, 17, 0 }, 52, Pitch::flat },
-            { { 12, 16, 0 }, 52, Pitch::flat },
-            { { 12, 15, 0 }, 52, Pitch::flat },
-            { { 11, 14, 0 }, 52, Pitch::flat },
-            { { 11, 13, 0 }, 52, Pitch::flat },
-            { { 11, 12, 0 }, 52, Pitch::flat },
-            { { 10, 11, 0 }, 52, Pitch::flat },
-            { { 10, 10, 0 }, 52, Pitch::flat },
-            { { 10, 9, 0 }, 52, Pitch::flat },
-            { { 9, 8, 0 }, 52, Pitch::flat },
-            { { 9, 7, 0 }, 50, Pitch::flat },
-            { { 9, 6, 0 }, 50, Pitch::flat },
-            { { 9, 5, 0 }, 50, Pitch::flat },
-            { { 8, 4, 0 }, 50, Pitch::flat },
-            { { 8, 3, 0 }, 48, Pitch::flat },
-            { { 8, 2, 0 }, 48, Pitch::flat },
-            { { 8, 1, 0 }, 48, Pitch::flat },
-            { { 8, 0, 0 }, 48, Pitch::flat },
-        });
-
-    // 0x4de79a
-    // Track 39. Reversed 1. Direction 0
-    static constexpr auto moveInfoT39R1D0 = std::to_array<MoveInfo>(
-        {
-            { { 0, 24, 0 }, 32, Pitch::flat },
-            { { 1, 24, 0 }, 32, Pitch::flat },
-            { { 2, 24, 0 }, 32, Pitch::flat },
-            { { 3, 24, 0 }, 32, Pitch::flat },
-            { { 4, 24, 0 }, 34, Pitch::flat },
-            { { 5, 23, 0 }, 34, Pitch::flat },
-            { { 6, 23, 0 }, 34, Pitch::flat },
-            { { 7, 23, 0 }, 34, Pitch::flat },
-            { { 8, 23, 0 }, 36, Pitch::flat },
-            { { 9, 22, 0 }, 36, Pitch::flat },
-            { { 10, 22, 0 }, 36, Pitch::flat },
-            { { 11, 22, 0 }, 36, Pitch::flat },
-            { { 12, 21, 0 }, 36, Pitch::flat },
-            { { 13, 21, 0 }, 36, Pitch::flat },
-            { { 14, 21, 0 }, 36, Pitch::flat },
-            { { 15, 20, 0 }, 36, Pitch::flat },
-            { { 16, 20, 0 }, 36, Pitch::flat },
-            { { 17, 19, 0 }, 36, Pitch::flat },
-            { { 18, 19, 0 }, 36, Pitch::flat },
-            { { 19, 19, 0 }, 36, Pitch::flat },
-            { { 20, 18, 0 }, 36, Pitch::flat },
-            { { 21, 18, 0 }, 36, Pitch::flat },
-            { { 22, 18, 0 }, 36, Pitch::flat },
-            { { 23, 17, 0 }, 36, Pitch::flat },
-            { { 24, 17, 0 }, 34, Pitch::flat },
-            { { 25, 17, 0 }, 34, Pitch::flat },
-            { { 26, 17, 0 }, 34, Pitch::flat },
-            { { 27, 16, 0 }, 34, Pitch::flat },
-            { { 28, 16, 0 }, 32, Pitch::flat },
-            { { 29, 16, 0 }, 32, Pitch::flat },
-            { { 30, 16, 0 }, 32, Pitch::flat },
-            { { 31, 16, 0 }, 32, Pitch::flat },
-        });
-
-    // 0x4de89c
-    // Track 39. Reversed 1. Direction 1
-    static constexpr auto moveInfoT39R1D1 = std::to_array<MoveInfo>(
-        {
-            { { 24, 31, 0 }, 48, Pitch::flat },
-            { { 24, 30, 0 }, 48, Pitch::flat },
-            { { 24, 29, 0 }, 48, Pitch::flat },
-            { { 24, 28, 0 }, 48, Pitch::flat },
-            { { 24, 27, 0 }, 50, Pitch::flat },
-            { { 23, 26, 0 }, 50, Pitch::flat },
-            { { 23, 25, 0 }, 50, Pitch::flat },
-            { { 23, 24, 0 }, 50, Pitch::flat },
-            { { 23, 23, 0 }, 52, Pitch::flat },
-            { { 22, 22, 0 }, 52, Pitch::flat },
-            { { 22, 21, 0 }, 52, Pitch::flat },
-            { { 22, 20, 0 }, 52, Pitch::flat },
-            { { 21, 19, 0 }, 52, Pitch::flat },
-            { { 21, 18, 0 }, 52, Pitch::flat },
-            { { 21, 17, 0 }, 52, Pitch::flat },
-            { { 20, 16, 0 }, 52, Pitch::flat },
-            { { 20, 15, 0 }, 52, Pitch::flat },
-            { { 19, 14, 0 }, 52, Pitch::flat },
-            { { 19, 13, 0 }, 52, Pitch::flat },
-            { { 19, 12, 0 }, 52, Pitch::flat },
-            { { 18, 11, 0 }, 52, Pitch::flat },
-            { { 18, 10, 0 }, 52, Pitch::flat },
-            { { 18, 9, 0 }, 52, Pitch::flat },
-            { { 17, 8, 0 }, 52, Pitch::flat },
-            { { 17, 7, 0 }, 50, Pitch::flat },
-            { { 17, 6, 0 }, 50, Pitch::flat },
-            { { 17, 5, 0 }, 50, Pitch::flat },
-            { { 16, 4, 0 }, 50, Pitch::flat },
-            { { 16, 3, 0 }, 48, Pitch::flat },
-            { { 16, 2, 0 }, 48, Pitch::flat },
-            { { 16, 1, 0 }, 48, Pitch::flat },
-            { { 16, 0, 0 }, 48, Pitch::flat },
-        });
-
-    // 0x4de596
-    // Track 39. Reversed 1. Direction 2
-    static constexpr auto moveInfoT39R1D2 = std::to_array<MoveInfo>(
-        {
-            { { 31, 8, 0 }, 0, Pitch::flat },
-            { { 30, 8, 0 }, 0, Pitch::flat },
-            { { 29, 8, 0 }, 0, Pitch::flat },
-            { { 28, 8, 0 }, 0, Pitch::flat },
-            { { 27, 8, 0 }, 2, Pitch::flat },
-            { { 26, 9, 0 }, 2, Pitch::flat },
-            { { 25, 9, 0 }, 2, Pitch::flat },
-            { { 24, 9, 0 }, 2, Pitch::flat },
-            { { 23, 9, 0 }, 4, Pitch::flat },
-            { { 22, 10, 0 }, 4, Pitch::flat },
-            { { 21, 10, 0 }, 4, Pitch::flat },
-            { { 20, 10, 0 }, 4, Pitch::flat },
-            { { 19, 11, 0 }, 4, Pitch::flat },
-            { { 18, 11, 0 }, 4, Pitch::flat },
-            { { 17, 11, 0 }, 4, Pitch::flat },
-            { { 16, 12, 0 }, 4, Pitch::flat },
-            { { 15, 12, 0 }, 4, Pitch::flat },
-            { { 14, 13, 0 }, 4, Pitch::flat },
-            { { 13, 13, 0 }, 4, Pitch::flat },
-            { { 12, 13, 0 }, 4, Pitch::flat },
-            { { 11, 14, 0 }, 4, Pitch::flat },
-            { { 10, 14, 0 }, 4, Pitch::flat },
-            { { 9, 14, 0 }, 4, Pitch::flat },
-            { { 8, 15, 0 }, 4, Pitch::flat },
-            { { 7, 15, 0 }, 2, Pitch::flat },
-            { { 6, 15, 0 }, 2, Pitch::flat },
-            { { 5, 15, 0 }, 2, Pitch::flat },
-            { { 4, 16, 0 }, 2, Pitch::flat },
-            { { 3, 16, 0 }, 0, Pitch::flat },
-            { { 2, 16, 0 }, 0, Pitch::flat },
-            { { 1, 16, 0 }, 0, Pitch::flat },
-            { { 0, 16, 0 }, 0, Pitch::flat },
-        });
-
-    // 0x4de698
-    // Track 39. Reversed 1. Direction 3
-    static constexpr auto moveInfoT39R1D3 = std::to_array<MoveInfo>(
-        {
-            { { 8, 0, 0 }, 16, Pitch::flat },
-            { { 8, 1, 0 }, 16, Pitch::flat },
-            { { 8, 2, 0 }, 16, Pitch::flat },
-            { { 8, 3, 0 }, 16, Pitch::flat },
-            { { 8, 4, 0 }, 18, Pitch::flat },
-            { { 9, 5, 0 }, 18, Pitch::flat },
-            { { 9, 6, 0 }, 18, Pitch::flat },
-            { { 9, 7, 0 }, 18, Pitch::flat },
-            { { 9, 8, 0 }, 20, Pitch::flat },
-            { { 10, 9, 0 }, 20, Pitch::flat },
-            { { 10, 10, 0 }, 20, Pitch::flat },
-            { { 10, 11, 0 }, 20, Pitch::flat },
-            { { 11, 12, 0 }, 20, Pitch::flat },
-            { { 11, 13, 0 }, 20, Pitch::flat },
-            { { 11, 14, 0 }, 20, Pitch::flat },
-            { { 12, 15, 0 }, 20, Pitch::flat },
-            { { 12, 16, 0 }, 20, Pitch::flat },
-            { { 13, 17, 0 }, 20, Pitch::flat },
-            { { 13, 18, 0 }, 20, Pitch::flat },
-            { { 13, 19, 0 }, 20, Pitch::flat },
-            { { 14, 20, 0 }, 20, Pitch::flat },
-            { { 14, 21, 0 }, 20, Pitch::flat },
-            { { 14, 22, 0 }, 20, Pitch::flat },
-            { { 15, 23, 0 }, 20, Pitch::flat },
-            { { 15, 24, 0 }, 18, Pitch::flat },
-            { { 15, 25, 0 }, 18, Pitch::flat },
-            { { 15, 26, 0 }, 18, Pitch::flat },
-            { { 16, 27, 0 }, 18, Pitch::flat },
-            { { 16, 28, 0 }, 16, Pitch::flat },
-            { { 16, 29, 0 }, 16, Pitch::flat },
-            { { 16, 30, 0 }, 16, Pitch::flat },
-            { { 16, 31, 0 }, 16, Pitch::flat },
-        });
-
-    // 0x4deda6
-    // Track 42. Reversed 0. Direction 0
-    static constexpr auto moveInfoT42R0D0 = std::to_array<MoveInfo>(
-        {
-            { { 31, 8, 0 }, 0, Pitch::flat },
-            { { 30, 8, 0 }, 0, Pitch::flat },
-            { { 29, 8, 0 }, 2, Pitch::flat },
-            { { 28, 9, 0 }, 2, Pitch::flat },
-            { { 27, 9, 0 }, 2, Pitch::flat },
-            { { 26, 10, 0 }, 4, Pitch::flat },
-            { { 25, 11, 0 }, 4, Pitch::flat },
-            { { 25, 12, 0 }, 6, Pitch::flat },
-            { { 24, 13, 0 }, 6, Pitch::flat },
-            { { 24, 14, 0 }, 6, Pitch::flat },
-            { { 24, 15, 0 }, 16, Pitch::flat },
-            { { 24, 16, 0 }, 16, Pitch::flat },
-            { { 24, 17, 0 }, 16, Pitch::flat },
-            { { 24, 18, 0 }, 18, Pitch::flat },
-            { { 24, 19, 0 }, 18, Pitch::flat },
-            { { 25, 20, 0 }, 18, Pitch::flat },
-            { { 25, 21, 0 }, 20, Pitch::flat },
-            { { 26, 22, 0 }, 20, Pitch::flat },
-            { { 27, 23, 0 }, 22, Pitch::flat },
-            { { 28, 23, 0 }, 22, Pitch::flat },
-            { { 29, 24, 0 }, 22, Pitch::flat },
-            { { 30, 24, 0 }, 32, Pitch::flat },
-            { { 31, 24, 0 }, 32, Pitch::flat },
-        });
-
-    // 0x4dee60
-    // Track 42. Reversed 0. Direction 1
-    static constexpr auto moveInfoT42R0D1 = std::to_array<MoveInfo>(
-        {
-            { { 8, 0, 0 }, 16, Pitch::flat },
-            { { 8, 1, 0 }, 16, Pitch::flat },
-            { { 8, 2, 0 }, 18, Pitch::flat },
-            { { 9, 3, 0 }, 18, Pitch::flat },
-            { { 9, 4, 0 }, 18, Pitch::flat },
-            { { 10, 5, 0 }, 20, Pitch::flat },
-            { { 11, 6, 0 }, 20, Pitch::flat },
-            { { 12, 6, 0 }, 22, Pitch::flat },
-            { { 13, 7, 0 }, 22, Pitch::flat },
-            { { 14, 7, 0 }, 22, Pitch::flat },
-            { { 15, 7, 0 }, 32, Pitch::flat },
-            { { 16, 7, 0 }, 32, Pitch::flat },
-            { { 17, 7, 0 }, 32, Pitch::flat },
-            { { 18, 7, 0 }, 34, Pitch::flat },
-            { { 19, 7, 0 }, 34, Pitch::flat },
-            { { 20, 6, 0 }, 34, Pitch::flat },
-            { { 21, 6, 0 }, 36, Pitch::flat },
-            { { 22, 5, 0 }, 36, Pitch::flat },
-            { { 23, 4, 0 }, 38, Pitch::flat },
-            { { 23, 3, 0 }, 38, Pitch::flat },
-            { { 24, 2, 0 }, 38, Pitch::flat },
-            { { 24, 1, 0 }, 48, Pitch::flat },
-            { { 24, 0, 0 }, 48, Pitch::flat },
-        });
-
-    // 0x4def1a
-    // Track 42. Reversed 0. Direction 2
-    static constexpr auto moveInfoT42R0D2 = std::to_array<MoveInfo>(
-        {
-            { { 0, 24, 0 }, 32, Pitch::flat },
-            { { 1, 24, 0 }, 32, Pitch::flat },
-            { { 2, 24, 0 }, 34, Pitch::flat },
-            { { 3, 23, 0 }, 34, Pitch::flat },
-            { { 4, 23, 0 }, 34, Pitch::flat },
-            { { 5, 22, 0 }, 36, Pitch::flat },
-            { { 6, 21, 0 }, 36, Pitch::flat },
-            { { 6, 20, 0 }, 38, Pitch::flat },
-            { { 7, 19, 0 }, 38, Pitch::flat },
-            { { 7, 18, 0 }, 38, Pitch::flat },
-            { { 7, 17, 0 }, 48, Pitch::flat },
-            { { 7, 16, 0 }, 48, Pitch::flat },
-            { { 7, 15, 0 }, 48, Pitch::flat },
-            { { 7, 14, 0 }, 50, Pitch::flat },
-            { { 7, 13, 0 }, 50, Pitch::flat },
-            { { 6, 12, 0 }, 50, Pitch::flat },
-            { { 6, 11, 0 }, 52, Pitch::flat },
-            { { 5, 10, 0 }, 52, Pitch::flat },
-            { { 4, 9, 0 }, 54, Pitch::flat },
-            { { 3, 9, 0 }, 54, Pitch::flat },
-            { { 2, 8, 0 }, 54, Pitch::flat },
-            { { 1, 8, 0 }, 0, Pitch::flat },
-            { { 0, 8, 0 }, 0, Pitch::flat },
-        });
-
-    // 0x4defd4
-    // Track 42. Reversed 0. Direction 3
-    static constexpr auto moveInfoT42R0D3 = std::to_array<MoveInfo>(
-        {
-            { { 24, 31, 0 }, 48, Pitch::flat },
-            { { 24, 30, 0 }, 48, Pitch::flat },
-            { { 24, 29, 0 }, 50, Pitch::flat },
-            { { 23, 28, 0 }, 50, Pitch::flat },
-            { { 23, 27, 0 }, 50, Pitch::flat },
-            { { 22, 26, 0 }, 52, Pitch::flat },
-            { { 21, 25, 0 }, 52, Pitch::flat },
-            { { 20, 25, 0 }, 54, Pitch::flat },
-            { { 19, 24, 0 }, 54, Pitch::flat },
-            { { 18, 24, 0 }, 54, Pitch::flat },
-            { { 17, 24, 0 }, 0, Pitch::flat },
-            { { 16, 24, 0 }, 0, Pitch::flat },
-            { { 15, 24, 0 }, 0, Pitch::flat },
-            { { 14, 24, 0 }, 2, Pitch::flat },
-            { { 13, 24, 0 }, 2, Pitch::flat },
-            { { 12, 25, 0 }, 2, Pitch::flat },
-            { { 11, 25, 0 }, 4, Pitch::flat },
-            { { 10, 26, 0 }, 4, Pitch::flat },
-            { { 9, 27, 0 }, 6, Pitch::flat },
-            { { 9, 28, 0 }, 6, Pitch::flat },
-            { { 8, 29, 0 }, 6, Pitch::flat },
-            { { 8, 30, 0 }, 16, Pitch::flat },
-            { { 8, 31, 0 }, 16, Pitch::flat },
-        });
-
-    // 0x4df08e
-    // Track 42. Reversed 1. Direction 0
-    static constexpr auto moveInfoT42R1D0 = std::to_array<MoveInfo>(
-        {
-            { { 31, 24, 0 }, 0, Pitch::flat },
-            { { 30, 24, 0 }, 0, Pitch::flat },
-            { { 29, 24, 0 }, 54, Pitch::flat },
-            { { 28, 23, 0 }, 54, Pitch::flat },
-            { { 27, 23, 0 }, 54, Pitch::flat },
-            { { 26, 22, 0 }, 52, Pitch::flat },
-            { { 25, 21, 0 }, 52, Pitch::flat },
-            { { 25, 20, 0 }, 50, Pitch::flat },
-            { { 24, 19, 0 }, 50, Pitch::flat },
-            { { 24, 18, 0 }, 50, Pitch::flat },
-            { { 24, 17, 0 }, 48, Pitch::flat },
-            { { 24, 16, 0 }, 48, Pitch::flat },
-            { { 24, 15, 0 }, 48, Pitch::flat },
-            { { 24, 14, 0 }, 38, Pitch::flat },
-            { { 24, 13, 0 }, 38, Pitch::flat },
-            { { 25, 12, 0 }, 38, Pitch::flat },
-            { { 25, 11, 0 }, 36, Pitch::flat },
-            { { 26, 10, 0 }, 36, Pitch::flat },
-            { { 27, 9, 0 }, 34, Pitch::flat },
-            { { 28, 9, 0 }, 34, Pitch::flat },
-            { { 29, 8, 0 }, 34, Pitch::flat },
-            { { 30, 8, 0 }, 32, Pitch::flat },
-            { { 31, 8, 0 }, 32, Pitch::flat },
-        });
-
-    // 0x4df148
-    // Track 42. Reversed 1. Direction 1
-    static constexpr auto moveInfoT42R1D1 = std::to_array<MoveInfo>(
-        {
-            { { 24, 0, 0 }, 16, Pitch::flat },
-            { { 24, 1, 0 }, 16, Pitch::flat },
-            { { 24, 2, 0 }, 6, Pitch::flat },
-            { { 23, 3, 0 }, 6, Pitch::flat },
-            { { 23, 4, 0 }, 6, Pitch::flat },
-            { { 22, 5, 0 }, 4, Pitch::flat },
-            { { 21, 6, 0 }, 4, Pitch::flat },
-            { { 20, 6, 0 }, 2, Pitch::flat },
-            { { 19, 7, 0 }, 2, Pitch::flat },
-            { { 18, 7, 0 }, 2, Pitch::flat },
-            { { 17, 7, 0 }, 0, Pitch::flat },
-            { { 16, 7, 0 }, 0, Pitch::flat },
-            { { 15, 7, 0 }, 0, Pitch::flat },
-            { { 14, 7, 0 }, 54, Pitch::flat },
-            { { 13, 7, 0 }, 54, Pitch::flat },
-            { { 12, 6, 0 }, 54, Pitch::flat },
-            { { 11, 6, 0 }, 52, Pitch::flat },
-            { { 10, 5, 0 }, 52, Pitch::flat },
-            { { 9, 4, 0 }, 50, Pitch::flat },
-            { { 9, 3, 0 }, 50, Pitch::flat },
-            { { 8, 2, 0 }, 50, Pitch::flat },
-            { { 8, 1, 0 }, 48, Pitch::flat },
-            { { 8, 0, 0 }, 48, Pitch::flat },
-        });
-
-    // 0x4df202
-    // Track 42. Reversed 1. Direction 2
-    static constexpr auto moveInfoT42R1D2 = std::to_array<MoveInfo>(
-        {
-            { { 0, 8, 0 }, 32, Pitch::flat },
-            { { 1, 8, 0 }, 32, Pitch::flat },
-            { { 2, 8, 0 }, 22, Pitch::flat },
-            { { 3, 9, 0 }, 22, Pitch::flat },
-            { { 4, 9, 0 }, 22, Pitch::flat },
-            { { 5, 10, 0 }, 20, Pitch::flat },
-            { { 6, 11, 0 }, 20, Pitch::flat },
-            { { 6, 12, 0 }, 18, Pitch::flat },
-            { { 7, 13, 0 }, 18, Pitch::flat },
-            { { 7, 14, 0 }, 18, Pitch::flat },
-            { { 7, 15, 0 }, 16, Pitch::flat },
-            { { 7, 16, 0 }, 16, Pitch::flat },
-            { { 7, 17, 0 }, 16, Pitch::flat },
-            { { 7, 18, 0 }, 6, Pitch::flat },
-            { { 7, 19, 0 }, 6, Pitch::flat },
-            { { 6, 20, 0 }, 6, Pitch::flat },
-            { { 6, 21, 0 }, 4, Pitch::flat },
-            { { 5, 22, 0 }, 4, Pitch::flat },
-            { { 4, 23, 0 }, 2, Pitch::flat },
-            { { 3, 23, 0 }, 2, Pitch::flat },
-            { { 2, 24, 0 }, 2, Pitch::flat },
-            { { 1, 24, 0 }, 0, Pitch::flat },
-            { { 0, 24, 0 }, 0, Pitch::flat },
-        });
-
-    // 0x4df2bc
-    // Track 42. Reversed 1. Direction 3
-    static constexpr auto moveInfoT42R1D3 = std::to_array<MoveInfo>(
-        {
-            { { 8, 31, 0 }, 48, Pitch::flat },
-            { { 8, 30, 0 }, 48, Pitch::flat },
-            { { 8, 29, 0 }, 38, Pitch::flat },
-            { { 9, 28, 0 }, 38, Pitch::flat },
-            { { 9, 27, 0 }, 38, Pitch::flat },
-            { { 10, 26, 0 }, 36, Pitch::flat },
-            { { 11, 25, 0 }, 36, Pitch::flat },
-            { { 12, 25, 0 }, 34, Pitch::flat },
-            { { 13, 24, 0 }, 34, Pitch::flat },
-            { { 14, 24, 0 }, 34, Pitch::flat },
-            { { 15, 24, 0 }, 32, Pitch::flat },
-            { { 16, 24, 0 }, 32, Pitch::flat },
-            { { 17, 24, 0 }, 32, Pitch::flat },
-            { { 18, 24, 0 }, 22, Pitch::flat },
-            { { 19, 24, 0 }, 22, Pitch::flat },
-            { { 20, 25, 0 }, 22, Pitch::flat },
-            { { 21, 25, 0 }, 20, Pitch::flat },
-            { { 22, 26, 0 }, 20, Pitch::flat },
-            { { 23, 27, 0 }, 18, Pitch::flat },
-            { { 23, 28, 0 }, 18, Pitch::flat },
-            { { 24, 29, 0 }, 18, Pitch::flat },
-            { { 24, 30, 0 }, 16, Pitch::flat },
-            { { 24, 31, 0 }, 16, Pitch::flat },
-        });
-#pragma endregion
-
-#pragma region RoadData
-    // 0x4dc556
-    // Turnaround 0. Lane 0. Track 0. Reversed 0. Direction 0
-    static constexpr auto moveInfoTA0L0T0R0D0 = std::to_array<MoveInfo>(
-        {
-            { { 31, 8, 0 }, 0, Pitch::flat },
-            { { 30, 8, 0 }, 0, Pitch::flat },
-            { { 29, 8, 0 }, 0, Pitch::flat },
-            { { 28, 8, 0 }, 0, Pitch::flat },
-            { { 27, 8, 0 }, 0, Pitch::flat },
-            { { 26, 8, 0 }, 0, Pitch::flat },
-            { { 25, 8, 0 }, 0, Pitch::flat },
-            { { 24, 8, 0 }, 0, Pitch::flat },
-            { { 23, 8, 0 }, 0, Pitch::flat },
-            { { 22, 8, 0 }, 0, Pitch::flat },
-            { { 21, 8, 0 }, 0, Pitch::flat },
-            { { 20, 8, 0 }, 0, Pitch::flat },
-            { { 19, 8, 0 }, 0, Pitch::flat },
-            { { 18, 8, 0 }, 0, Pitch::flat },
-            { { 17, 8, 0 }, 0, Pitch::flat },
-            { { 16, 8, 0 }, 0, Pitch::flat },
-            { { 15, 8, 0 }, 0, Pitch::flat },
-            { { 14, 8, 0 }, 0, Pitch::flat },
-            { { 13, 8, 0 }, 0, Pitch::flat },
-            { { 12, 8, 0 }, 0, Pitch::flat },
-            { { 11, 8, 0 }, 0, Pitch::flat },
-            { { 10, 8, 0 }, 0, Pitch::flat },
-            { { 9, 8, 0 }, 0, Pitch::flat },
-            { { 8, 8, 0 }, 0, Pitch::flat },
-            { { 7, 8, 0 }, 0, Pitch::flat },
-            { { 6, 8, 0 }, 0, Pitch::flat },
-            { { 5, 8, 0 }, 0, Pitch::flat },
-            { { 4, 8, 0 }, 0, Pitch::flat },
-            { { 3, 8, 0 }, 0, Pitch::flat },
-            { { 2, 8, 0 }, 0, Pitch::flat },
-            { { 1, 8, 0 }, 0, Pitch::flat },
-            { { 0, 8, 0 }, 0, Pitch::flat },
-        });
-
-    // 0x4dc658
-    // Turnaround 0. Lane 0. Track 0. Reversed 0. Direction 1
-    static constexpr auto moveInfoTA0L0T0R0D1 = std::to_array<MoveInfo>(
-        {
-            { { 8, 0, 0 }, 16, Pitch::flat },
-            { { 8, 1, 0 }, 16, Pitch::flat },
-            { { 8, 2, 0 }, 16, Pitch::flat },
-            { { 8, 3, 0 }, 16, Pitch::flat },
-            { { 8, 4, 0 }, 16, Pitch::flat },
-            { { 8, 5, 0 }, 16, Pitch::flat },
-            { { 8, 6, 0 }, 16, Pitch::flat },
-            { { 8, 7, 0 }, 16, Pitch::flat },
-            { { 8, 8, 0 }, 16, Pitch::flat },
-            { { 8, 9, 0 }, 16, Pitch::flat },
-            { { 8, 10, 0 }, 16, Pitch::flat },
-            { { 8, 11, 0 }, 16, Pitch::flat },
-            { { 8, 12, 0 }, 16, Pitch::flat },
-            { { 8, 13, 0 }, 16, Pitch::flat },
-            { { 8, 14, 0 }, 16, Pitch::flat },
-            { { 8, 15, 0 }, 16, Pitch::flat },
-            { { 8, 16, 0 }, 16, Pitch::flat },
-            { { 8, 17, 0 }, 16, Pitch::flat },
-            { { 8, 18, 0 }, 16, Pitch::flat },
-            { { 8, 19, 0 }, 16, Pitch::flat },
-            { { 8, 20, 0 }, 16, Pitch::flat },
-            { { 8, 21, 0 }, 16, Pitch::flat },
-            { { 8, 22, 0 }, 16, Pitch::flat },
-            { { 8, 23, 0 }, 16, Pitch::flat },
-            { { 8, 24, 0 }, 16, Pitch::flat },
-            { { 8, 25, 0 }, 16, Pitch::flat },
-            { { 8, 26, 0 }, 16, Pitch::flat },
-            { { 8, 27, 0 }, 16, Pitch::flat },
-            { { 8, 28, 0 }, 16, Pitch::flat },
-            { { 8, 29, 0 }, 16, Pitch::flat },
-            { { 8, 30, 0 }, 16, Pitch::flat },
-            { { 8, 31, 0 }, 16, Pitch::flat },
-        });
-
-    // 0x4dc75a
-    // Turnaround 0. Lane 0. Track 0. Reversed 0. Direction 2
-    static constexpr auto moveInfoTA0L0T0R0D2 = std::to_array<MoveInfo>(
-        {
-            { { 0, 24, 0 }, 32, Pitch::flat },
-            { { 1, 24, 0 }, 32, Pitch::flat },
-            { { 2, 24, 0 }, 32, Pitch::flat },
-            { { 3, 24, 0 }, 32, Pitch::flat },
-            { { 4, 24, 0 }, 32, Pitch::flat },
-            { { 5, 24, 0 }, 32, Pitch::flat },
-            { { 6, 24, 0 }, 32, Pitch::flat },
-            { { 7, 24, 0 }, 32, Pitch::flat },
-            { { 8, 24, 0 }, 32, Pitch::flat },
-            { { 9, 24, 0 }, 32, Pitch::flat },
-            { { 10, 24, 0 }, 32, Pitch::flat },
-            { { 11, 24, 0 }, 32, Pitch::flat },
-            { { 12, 24, 0 }, 32, Pitch::flat },
-            { { 13, 24, 0 }, 32, Pitch::flat },
-            { { 14, 24, 0 }, 32, Pitch::flat },
-            { { 15, 24, 0 }, 32, Pitch::flat },
-            { { 16, 24, 0 }, 32, Pitch::flat },
-            { { 17, 24, 0 }, 32, Pitch::flat },
-            { { 18, 24, 0 }, 32, Pitch::flat },
-            { { 19, 24, 0 }, 32, Pitch::flat },
-            { { 20, 24, 0 }, 32, Pitch::flat },
-            { { 21, 24, 0 }, 32, Pitch::flat },
-            { { 22, 24, 0 }, 32, Pitch::flat },
-            { { 23, 24, 0 }, 32, Pitch::flat },
-            { { 24, 24, 0 }, 32, Pitch::flat },
-            { { 25, 24, 0 }, 32, Pitch::flat },
-            { { 26, 24, 0 }, 32, Pitch::flat },
-            { { 27, 24, 0 }, 32, Pitch::flat },
-            { { 28, 24, 0 }, 32, Pitch::flat },
-            { { 29, 24, 0 }, 32, Pitch::flat },
-            { { 30, 24, 0 }, 32, Pitch::flat },
-            { { 31, 24, 0 }, 32, Pitch::flat },
-        });
-
-    // 0x4dc85c
-    // Turnaround 0. Lane 0. Track 0. Reversed 0. Direction 3
-    static constexpr auto moveInfoTA0L0T0R0D3 = std::to_array<MoveInfo>(
-        {
-            { { 24, 31, 0 }, 48, Pitch::flat },
-            { { 24, 30, 0 }, 48, Pitch::flat },
-            { { 24, 29, 0 }, 48, Pitch::flat },
-            { { 24, 28, 0 }, 48, Pitch::flat },
-            { { 24, 27, 0 }, 48, Pitch::flat },
-            { { 24, 26, 0 }, 48, Pitch::flat },
-            { { 24, 25, 0 }, 48, Pitch::flat },
-            { { 24, 24, 0 }, 48, Pitch::flat },
-            { { 24, 23, 0 }, 48, Pitch::flat },
-            { { 24, 22, 0 }, 48, Pitch::flat },
-            { { 24, 21, 0 }, 48, Pitch::flat },
-            { { 24, 20, 0 }, 48, Pitch::flat },
-            { { 24, 19, 0 }, 48, Pitch::flat },
-            { { 24, 18, 0 }, 48, Pitch::flat },
-            { { 24, 17, 0 }, 48, Pitch::flat },
-            { { 24, 16, 0 }, 48, Pitch::flat },
-            { { 24, 15, 0 }, 48, Pitch::flat },
-            { { 24, 14, 0 }, 48, Pitch::flat },
-            { { 24, 13, 0 }, 48, Pitch::flat },
-            { { 24, 12, 0 }, 48, Pitch::flat },
-            { { 24, 11, 0 }, 48, Pitch::flat },
-            { { 24, 10, 0 }, 48, Pitch::flat },
-            { { 24, 9, 0 }, 48, Pitch::flat },
-            { { 24, 8, 0 }, 48, Pitch::flat },
-            { { 24, 7, 0 }, 48, Pitch::flat },
-            { { 24, 6, 0 }, 48, Pitch::flat },
-            { { 24, 5, 0 }, 48, Pitch::flat },
-            { { 24, 4, 0 }, 48, Pitch::flat },
-            { { 24, 3, 0 }, 48, Pitch::flat },
-            { { 24, 2, 0 }, 48, Pitch::flat },
-            { { 24, 1, 0 }, 48, Pitch::flat },
-            { { 24, 0, 0 }, 48, Pitch::flat },
-        });
-
-    // 0x4eaafe
-    // Turnaround 0. Lane 0. Track 1. Reversed 0. Direction 0
-    static constexpr auto moveInfoTA0L0T1R0D0 = std::to_array<MoveInfo>(
-        {
-            { { 31, 8, 0 }, 0, Pitch::flat },
-            { { 30, 8, 0 }, 0, Pitch::flat },
-            { { 29, 8, 0 }, 62, Pitch::flat },
-            { { 28, 7, 0 }, 60, Pitch::flat },
-            { { 27, 7, 0 }, 58, Pitch::flat },
-            { { 26, 6, 0 }, 56, Pitch::flat },
-            { { 25, 5, 0 }, 54, Pitch::flat },
-            { { 25, 4, 0 }, 52, Pitch::flat },
-            { { 24, 3, 0 }, 50, Pitch::flat },
-            { { 24, 2, 0 }, 48, Pitch::flat },
-            { { 24, 1, 0 }, 48, Pitch::flat },
-            { { 24, 0, 0 }, 48, Pitch::flat },
-        });
-
-    // 0x4eab60
-    // Turnaround 0. Lane 0. Track 1. Reversed 0. Direction 1
-    static constexpr auto moveInfoTA0L0T1R0D1 = std::to_array<MoveInfo>(
-        {
-            { { 8, 0, 0 }, 16, Pitch::flat },
-            { { 8, 1, 0 }, 16, Pitch::flat },
-            { { 8, 2, 0 }, 14, Pitch::flat },
-            { { 7, 3, 0 }, 12, Pitch::flat },
-            { { 7, 4, 0 }, 10, Pitch::flat },
-            { { 6, 5, 0 }, 8, Pitch::flat },
-            { { 5, 6, 0 }, 8, Pitch::flat },
-            { { 4, 7, 0 }, 6, Pitch::flat },
-            { { 3, 7, 0 }, 4, Pitch::flat },
-            { { 2, 8, 0 }, 2, Pitch::flat },
-            { { 1, 8, 0 }, 0, Pitch::flat },
-            { { 0, 8, 0 }, 0, Pitch::flat },
-        });
-
-    // 0x4eabc2
-    // Turnaround 0. Lane 0. Track 1. Reversed 0. Direction 2
-    static constexpr auto moveInfoTA0L0T1R0D2 = std::to_array<MoveInfo>(
-        {
-            { { 0, 24, 0 }, 32, Pitch::flat },
-            { { 1, 24, 0 }, 32, Pitch::flat },
-            { { 2, 24, 0 }, 32, Pitch::flat },
-            { { 3, 24, 0 }, 30, Pitch::flat },
-            { { 4, 25, 0 }, 28, Pitch::flat },
-            { { 5, 25, 0 }, 26, Pitch::flat },
-            { { 6, 26, 0 }, 24, Pitch::flat },
-            { { 7, 27, 0 }, 22, Pitch::flat },
-            { { 7, 28, 0 }, 20, Pitch::flat },
-            { { 8, 29, 0 }, 18, Pitch::flat },
-            { { 8, 30, 0 }, 16, Pitch::flat },
-            { { 8, 31, 0 }, 16, Pitch::flat },
-        });
-
-    // 0x4eac24
-    // Turnaround 0. Lane 0. Track 1. Reversed 0. Direction 3
-    static constexpr auto moveInfoTA0L0T1R0D3 = std::to_array<MoveInfo>(
-        {
-            { { 24, 31, 0 }, 48, Pitch::flat },
-            { { 24, 30, 0 }, 48, Pitch::flat },
-            { { 24, 29, 0 }, 46, Pitch::flat },
-            { { 25, 28, 0 }, 44, Pitch::flat },
-            { { 25, 27, 0 }, 42, Pitch::flat },
-            { { 26, 26, 0 }, 40, Pitch::flat },
-            { { 27, 25, 0 }, 38, Pitch::flat },
-            { { 28, 25, 0 }, 36, Pitch::flat },
-            { { 29, 24, 0 }, 34, Pitch::flat },
-            { { 30, 24, 0 }, 32, Pitch::flat },
-            { { 31, 24, 0 }, 32, Pitch::flat },
-        });
-
-    // 0x4ead88
-    // Turnaround 0. Lane 0. Track 1. Reversed 1. Direction 0
-    static constexpr auto moveInfoTA0L0T1R1D0 = std::to_array<MoveInfo>(
-        {
-            { { 8, 0, 0 }, 16, Pitch::flat },
-            { { 8, 1, 0 }, 16, Pitch::flat },
-            { { 8, 2, 0 }, 16, Pitch::flat },
-            { { 8, 3, 0 }, 16, Pitch::flat },
-            { { 8, 4, 0 }, 16, Pitch::flat },
-            { { 9, 5, 0 }, 18, Pitch::flat },
-            { { 9, 6, 0 }, 18, Pitch::flat },
-            { { 9, 7, 0 }, 18, Pitch::flat },
-            { { 9, 8, 0 }, 20, Pitch::flat },
-            { { 10, 9, 0 }, 20, Pitch::flat },
-            { { 10, 10, 0 }, 20, Pitch::flat },
-            { { 10, 11, 0 }, 22, Pitch::flat },
-            { { 11, 12, 0 }, 22, Pitch::flat },
-            { { 11, 13, 0 }, 22, Pitch::flat },
-            { { 12, 14, 0 }, 22, Pitch::flat },
-            { { 13, 15, 0 }, 24, Pitch::flat },
-            { { 14, 16, 0 }, 24, Pitch::flat },
-            { { 15, 17, 0 }, 24, Pitch::flat },
-            { { 16, 18, 0 }, 24, Pitch::flat },
-            { { 17, 19, 0 }, 24, Pitch::flat },
-            { { 18, 20, 0 }, 26, Pitch::flat },
-            { { 19, 21, 0 }, 26, Pitch::flat },
-            { { 20, 21, 0 }, 26, Pitch::flat },
-            { { 21, 22, 0 }, 26, Pitch::flat },
-            { { 22, 22, 0 }, 28, Pitch::flat },
-            { { 23, 22, 0 }, 28, Pitch::flat },
-            { { 24, 23, 0 }, 28, Pitch::flat },
-            { { 25, 23, 0 }, 30, Pitch::flat },
-            { { 26, 23, 0 }, 30, Pitch::flat },
-            { { 27, 23, 0 }, 30, Pitch::flat },
-            { { 28, 24, 0 }, 32, Pitch::flat },
-            { { 29, 24, 0 }, 32, Pitch::flat },
-            { { 30, 24, 0 }, 32, Pitch::flat },
-            { { 31, 24, 0 }, 32, Pitch::flat },
-        });
-
-    // 0x4eae9a
-    // Turnaround 0. Lane 0. Track 1. Reversed 1. Direction 1
-    static constexpr auto moveInfoTA0L0T1R1D1 = std::to_array<MoveInfo>(
-        {
-            { { 0, 24, 0 }, 32, Pitch::flat },
-            { { 1, 24, 0 }, 32, Pitch::flat },
-            { { 2, 24, 0 }, 32, Pitch::flat },
-            { { 3, 24, 0 }, 32, Pitch::flat },
-            { { 4, 24, 0 }, 32, Pitch::flat },
-            { { 5, 23, 0 }, 34, Pitch::flat },
-            { { 6, 23, 0 }, 34, Pitch::flat },
-            { { 7, 23, 0 }, 34, Pitch::flat },
-            { { 8, 23, 0 }, 36, Pitch::flat },
-            { { 9, 22, 0 }, 36, Pitch::flat },
-            { { 10, 22, 0 }, 36, Pitch::flat },
-            { { 11, 22, 0 }, 38, Pitch::flat },
-            { { 12, 21, 0 }, 38, Pitch::flat },
-            { { 13, 21, 0 }, 38, Pitch::flat },
-            { { 14, 20, 0 }, 38, Pitch::flat },
-            { { 15, 19, 0 }, 40, Pitch::flat },
-            { { 16, 18, 0 }, 40, Pitch::flat },
-            { { 17, 17, 0 }, 40, Pitch::flat },
-            { { 18, 16, 0 }, 40, Pitch::flat },
-            { { 19, 15, 0 }, 40, Pitch::flat },
-            { { 20, 14, 0 }, 42, Pitch::flat },
-            { { 21, 13, 0 }, 42, Pitch::flat },
-            { { 21, 12, 0 }, 42, Pitch::flat },
-            { { 22, 11, 0 }, 42, Pitch::flat },
-            { { 22, 10, 0 }, 44, Pitch::flat },
-            { { 22, 9, 0 }, 44, Pitch::flat },
-            { { 23, 8, 0 }, 44, Pitch::flat },
-            { { 23, 7, 0 }, 46, Pitch::flat },
-            { { 23, 6, 0 }, 46, Pitch::flat },
-            { { 23, 5, 0 }, 46, Pitch::flat },
-            { { 24, 4, 0 }, 48, Pitch::flat },
-            { { 24, 3, 0 }, 48, Pitch::flat },
-            { { 24, 2, 0 }, 48, Pitch::flat },
-            { { 24, 1, 0 }, 48, Pitch::flat },
-            { { 24, 0, 0 }, 48, Pitch::flat },
-        });
-
-    // 0x4eafb4
-    // Turnaround 0. Lane 0. Track 1. Reversed 1. Direction 2
-    static constexpr auto moveInfoTA0L0T1R1D2 = std::to_array<MoveInfo>(
-        {
-            { { 24, 31, 0 }, 48, Pitch::flat },
-            { { 24, 30, 0 }, 48, Pitch::flat },
-            { { 24, 29, 0 }, 48, Pitch::flat },
-            { { 24, 28, 0 }, 48, Pitch::flat },
-            { { 23, 27, 0 }, 50, Pitch::flat },
-            { { 23, 26, 0 }, 50, Pitch::flat },
-            { { 23, 25, 0 }, 50, Pitch::flat },
-            { { 23, 24, 0 }, 52, Pitch::flat },
-            { { 22, 23, 0 }, 52, Pitch::flat },
-            { { 22, 22, 0 }, 52, Pitch::flat },
-            { { 22, 21, 0 }, 54, Pitch::flat },
-            { { 21, 20, 0 }, 54, Pitch::flat },
-            { { 21, 19, 0 }, 54, Pitch::flat },
-            { { 20, 18, 0 }, 54, Pitch::flat },
-            { { 19, 17, 0 }, 56, Pitch::flat },
-            { { 18, 16, 0 }, 56, Pitch::flat },
-            { { 17, 15, 0 }, 56, Pitch::flat },
-            { { 16, 14, 0 }, 56, Pitch::flat },
-            { { 15, 13, 0 }, 56, Pitch::flat },
-            { { 14, 12, 0 }, 58, Pitch::flat },
-            { { 13, 11, 0 }, 58, Pitch::flat },
-            { { 12, 11, 0 }, 58, Pitch::flat },
-            { { 11, 10, 0 }, 58, Pitch::flat },
-            { { 10, 10, 0 }, 60, Pitch::flat },
-            { { 9, 10, 0 }, 60, Pitch::flat },
-            { { 8, 9, 0 }, 60, Pitch::flat },
-            { { 7, 9, 0 }, 62, Pitch::flat },
-            { { 6, 9, 0 }, 62, Pitch::flat },
-            { { 5, 9, 0 }, 62, Pitch::flat },
-            { { 4, 8, 0 }, 0, Pitch::flat },
-            { { 3, 8, 0 }, 0, Pitch::flat },
-            { { 2, 8, 0 }, 0, Pitch::flat },
-            { { 1, 8, 0 }, 0, Pitch::flat },
-            { { 0, 8, 0 }, 0, Pitch::flat },
-        });
-
-    // 0x4eac7e
-    // Turnaround 0. Lane 0. Track 1. Reversed 1. Direction 3
-    static constexpr auto moveInfoTA0L0T1R1D3 = std::to_array<MoveInfo>(
-        {
-            { { 31, 8, 0 }, 0, Pitch::flat },
-            { { 30, 8, 0 }, 0, Pitch::flat },
-            { { 29, 8, 0 }, 0, Pitch::flat },
-            { { 28, 8, 0 }, 0, Pitch::flat },
-            { { 27, 9, 0 }, 2, Pitch::flat },
-            { { 26, 9, 0 }, 2, Pitch::flat },
-            { { 25, 9, 0 }, 2, Pitch::flat },
-            { { 24, 9, 0 }, 4, Pitch::flat },
-            { { 23, 10, 0 }, 4, Pitch::flat },
-            { { 22, 10, 0 }, 4, Pitch::flat },
-            { { 21, 10, 0 }, 6, Pitch::flat },
-            { { 20, 11, 0 }, 6, Pitch::flat },
-            { { 19, 11, 0 }, 6, Pitch::flat },
-            { { 18, 12, 0 }, 6, Pitch::flat },
-            { { 17, 13, 0 }, 8, Pitch::flat },
-            { { 16, 14, 0 }, 8, Pitch::flat },
-            { { 15, 15, 0 }, 8, Pitch::flat },
-            { { 14, 16, 0 }, 8, Pitch::flat },
-            { { 13, 17, 0 }, 8, Pitch::flat },
-            { { 12, 18, 0 }, 10, Pitch::flat },
-            { { 11, 19, 0 }, 10, Pitch::flat },
-            { { 11, 20, 0 }, 10, Pitch::flat },
-            { { 10, 21, 0 }, 10, Pitch::flat },
-            { { 10, 22, 0 }, 12, Pitch::flat },
-            { { 10, 23, 0 }, 12, Pitch::flat },
-            { { 9, 24, 0 }, 12, Pitch::flat },
-            { { 9, 25, 0 }, 14, Pitch::flat },
-            { { 9, 26, 0 }, 14, Pitch::flat },
-            { { 9, 27, 0 }, 14, Pitch::flat },
-            { { 8, 28, 0 }, 16, Pitch::flat },
-            { { 8, 29, 0 }, 16, Pitch::flat },
-            { { 8, 30, 0 }, 16, Pitch::flat },
-            { { 8, 31, 0 }, 16, Pitch::flat },
-        });
-
-    // 0x4edebe
-    // Turnaround 0. Lane 0. Track 3. Reversed 0. Direction 0
-    static constexpr auto moveInfoTA0L0T3R0D0 = std::to_array<MoveInfo>(
-        {
-            { { 31, 8, 0 }, 0, Pitch::flat },
-            { { 30, 8, 0 }, 0, Pitch::flat },
-            { { 29, 8, 0 }, 0, Pitch::flat },
-            { { 28, 8, 0 }, 62, Pitch::flat },
-            { { 27, 8, 0 }, 62, Pitch::flat },
-            { { 26, 8, 0 }, 62, Pitch::flat },
-            { { 25, 7, 0 }, 62, Pitch::flat },
-            { { 24, 7, 0 }, 62, Pitch::flat },
-            { { 23, 7, 0 }, 62, Pitch::flat },
-            { { 22, 7, 0 }, 62, Pitch::flat },
-            { { 21, 6, 0 }, 62, Pitch::flat },
-            { { 20, 6, 0 }, 60, Pitch::flat },
-            { { 19, 6, 0 }, 60, Pitch::flat },
-            { { 18, 6, 0 }, 60, Pitch::flat },
-            { { 17, 5, 0 }, 60, Pitch::flat },
-            { { 16, 5, 0 }, 60, Pitch::flat },
-            { { 15, 5, 0 }, 60, Pitch::flat },
-            { { 14, 4, 0 }, 60, Pitch::flat },
-            { { 13, 4, 0 }, 58, Pitch::flat },
-            { { 12, 3, 0 }, 58, Pitch::flat },
-            { { 11, 2, 0 }, 58, Pitch::flat },
-            { { 10, 2, 0 }, 58, Pitch::flat },
-            { { 9, 1, 0 }, 58, Pitch::flat },
-            { { 8, 0, 0 }, 58, Pitch::flat },
-            { { 7, -1, 0 }, 56, Pitch::flat },
-            { { 6, -2, 0 }, 56, Pitch::flat },
-            { { 5, -2, 0 }, 56, Pitch::flat },
-            { { 4, -3, 0 }, 56, Pitch::flat },
-            { { 3, -3, 0 }, 56, Pitch::flat },
-            { { 2, -4, 0 }, 56, Pitch::flat },
-            { { 2, -5, 0 }, 56, Pitch::flat },
-            { { 1, -6, 0 }, 54, Pitch::flat },
-            { { 0, -7, 0 }, 54, Pitch::flat },
-            { { -1, -8, 0 }, 54, Pitch::flat },
-            { { -2, -9, 0 }, 54, Pitch::flat },
-            { { -2, -10, 0 }, 54, Pitch::flat },
-            { { -3, -11, 0 }, 54, Pitch::flat },
-            { { -4, -12, 0 }, 54, Pitch::flat },
-            { { -4, -13, 0 }, 52, Pitch::flat },
-            { { -5, -14, 0 }, 52, Pitch::flat },
-            { { -5, -15, 0 }, 52, Pitch::flat },
-            { { -5, -16, 0 }, 52, Pitch::flat },
-            { { -6, -17, 0 }, 52, Pitch::flat },
-            { { -6, -18, 0 }, 52, Pitch::flat },
-            { { -6, -19, 0 }, 52, Pitch::flat },
-            { { -6, -20, 0 }, 52, Pitch::flat },
-            { { -7, -21, 0 }, 50, Pitch::flat },
-            { { -7, -22, 0 }, 50, Pitch::flat },
-            { { -7, -23, 0 }, 50, Pitch::flat },
-            { { -7, -24, 0 }, 50, Pitch::flat },
-            { { -8, -25, 0 }, 50, Pitch::flat },
-            { { -8, -26, 0 }, 50, Pitch::flat },
-            { { -8, -27, 0 }, 50, Pitch::flat },
-            { { -8, -28, 0 }, 48, Pitch::flat },
-            { { -8, -29, 0 }, 48, Pitch::flat },
-            { { -8, -30, 0 }, 48, Pitch::flat },
-            { { -8, -31, 0 }, 48, Pitch::flat },
-            { { -8, -32, 0 }, 48, Pitch::flat },
-        });
-
-    // 0x4ee090
-    // Turnaround 0. Lane 0. Track 3. Reversed 0. Direction 1
-    static constexpr auto moveInfoTA0L0T3R0D1 = std::to_array<MoveInfo>(
-        {
-            { { 8, 0, 0 }, 16, Pitch::flat },
-            { { 8, 1, 0 }, 16, Pitch::flat },
-            { { 8, 2, 0 }, 16, Pitch::flat },
-            { { 8, 3, 0 }, 16, Pitch::flat },
-            { { 8, 4, 0 }, 14, Pitch::flat },
-            { { 8, 5, 0 }, 14, Pitch::flat },
-            { { 8, 6, 0 }, 14, Pitch::flat },
-            { { 7, 7, 0 }, 14, Pitch::flat },
-            { { 7, 8, 0 }, 14, Pitch::flat },
-            { { 7, 9, 0 }, 14, Pitch::flat },
-            { { 7, 10, 0 }, 14, Pitch::flat },
-            { { 6, 11, 0 }, 14, Pitch::flat },
-            { { 6, 12, 0 }, 12, Pitch::flat },
-            { { 6, 13, 0 }, 12, Pitch::flat },
-            { { 6, 14, 0 }, 12, Pitch::flat },
-            { { 5, 15, 0 }, 12, Pitch::flat },
-            { { 5, 16, 0 }, 12, Pitch::flat },
-            { { 5, 17, 0 }, 12, Pitch::flat },
-            { { 4, 18, 0 }, 12, Pitch::flat },
-            { { 4, 19, 0 }, 10, Pitch::flat },
-            { { 3, 20, 0 }, 10, Pitch::flat },
-            { { 2, 21, 0 }, 10, Pitch::flat },
-            { { 2, 22, 0 }, 10, Pitch::flat },
-            { { 1, 23, 0 }, 10, Pitch::flat },
-            { { 0, 24, 0 }, 10, Pitch::flat },
-            { { -1, 25, 0 }, 8, Pitch::flat },
-            { { -2, 26, 0 }, 8, Pitch::flat },
-            { { -2, 27, 0 }, 8, Pitch::flat },
-            { { -3, 28, 0 }, 8, Pitch::flat },
-            { { -3, 29, 0 }, 8, Pitch::flat },
-            { { -4, 30, 0 }, 8, Pitch::flat },
-            { { -5, 30, 0 }, 8, Pitch::flat },
-            { { -6, 31, 0 }, 6, Pitch::flat },
-            { { -7, 32, 0 }, 6, Pitch::flat },
-            { { -8, 33, 0 }, 6, Pitch::flat },
-            { { -9, 34, 0 }, 6, Pitch::flat },
-            { { -10, 34, 0 }, 6, Pitch::flat },
-            { { -11, 35, 0 }, 6, Pitch::flat },
-            { { -12, 36, 0 }, 6, Pitch::flat },
-            { { -13, 36, 0 }, 4, Pitch::flat },
-            { { -14, 37, 0 }, 4, Pitch::flat },
-            { { -15, 37, 0 }, 4, Pitch::flat },
-            { { -16, 37, 0 }, 4, Pitch::flat },
-            { { -17, 38, 0 }, 4, Pitch::flat },
-            { { -18, 38, 0 }, 4, Pitch::flat },
-            { { -19, 38, 0 }, 4, Pitch::flat },
-            { { -20, 38, 0 }, 4, Pitch::flat },
-            { { -21, 39, 0 }, 2, Pitch::flat },
-            { { -22, 39, 0 }, 2, Pitch::flat },
-            { { -23, 39, 0 }, 2, Pitch::flat },
-            { { -24, 39, 0 }, 2, Pitch::flat },
-            { { -25, 40, 0 }, 2, Pitch::flat },
-            { { -26, 40, 0 }, 2, Pitch::flat },
-            { { -27, 40, 0 }, 2, Pitch::flat },
-            { { -28, 40, 0 }, 0, Pitch::flat },
-            { { -29, 40, 0 }, 0, Pitch::flat },
-            { { -30, 40, 0 }, 0, Pitch::flat },
-            { { -31, 40, 0 }, 0, Pitch::flat },
-            { { -32, 40, 0 }, 0, Pitch::flat },
-        });
-
-    // 0x4ee26a
-    // Turnaround 0. Lane 0. Track 3. Reversed 0. Direction 2
-    static constexpr auto moveInfoTA0L0T3R0D2 = std::to_array<MoveInfo>(
-        {
-            { { 0, 24, 0 }, 32, Pitch::flat },
-            { { 1, 24, 0 }, 32, Pitch::flat },
-            { { 2, 24, 0 }, 32, Pitch::flat },
-            { { 3, 24, 0 }, 32, Pitch::flat },
-            { { 4, 24, 0 }, 30, Pitch::flat },
-            { { 5, 24, 0 }, 30, Pitch::flat },
-            { { 6, 24, 0 }, 30, Pitch::flat },
-            { { 7, 25, 0 }, 30, Pitch::flat },
-            { { 8, 25, 0 }, 30, Pitch::flat },
-            { { 9, 25, 0 }, 30, Pitch::flat },
-            { { 10, 25, 0 }, 30, Pitch::flat },
-            { { 11, 26, 0 }, 30, Pitch::flat },
-            { { 12, 26, 0 }, 28, Pitch::flat },
-            { { 13, 26, 0 }, 28, Pitch::flat },
-            { { 14, 26, 0 }, 28, Pitch::flat },
-            { { 15, 27, 0 }, 28, Pitch::flat },
-            { { 16, 27, 0 }, 28, Pitch::flat },
-            { { 17, 27, 0 }, 28, Pitch::flat },
-            { { 18, 28, 0 }, 28, Pitch::flat },
-            { { 19, 28, 0 }, 26, Pitch::flat },
-            { { 20, 29, 0 }, 26, Pitch::flat },
-            { { 21, 30, 0 }, 26, Pitch::flat },
-            { { 22, 30, 0 }, 26, Pitch::flat },
-            { { 23, 31, 0 }, 26, Pitch::flat },
-            { { 24, 32, 0 }, 26, Pitch::flat },
-            { { 25, 33, 0 }, 24, Pitch::flat },
-            { { 26, 34, 0 }, 24, Pitch::flat },
-            { { 27, 34, 0 }, 24, Pitch::flat },
-            { { 28, 35, 0 }, 24, Pitch::flat },
-            { { 29, 35, 0 }, 24, Pitch::flat },
-            { { 30, 36, 0 }, 24, Pitch::flat },
-            { { 30, 37, 0 }, 24, Pitch::flat },
-            { { 31, 38, 0 }, 22, Pitch::flat },
-            { { 32, 39, 0 }, 22, Pitch::flat },
-            { { 33, 40, 0 }, 22, Pitch::flat },
-            { { 34, 41, 0 }, 22, Pitch::flat },
-            { { 34, 42, 0 }, 22, Pitch::flat },
-            { { 35, 43, 0 }, 22, Pitch::flat },
-            { { 36, 44, 0 }, 22, Pitch::flat },
-            { { 36, 45, 0 }, 20, Pitch::flat },
-            { { 37, 46, 0 }, 20, Pitch::flat },
-            { { 37, 47, 0 }, 20, Pitch::flat },
-            { { 37, 48, 0 }, 20, Pitch::flat },
-            { { 38, 49, 0 }, 20, Pitch::flat },
-            { { 38, 50, 0 }, 20, Pitch::flat },
-            { { 38, 51, 0 }, 20, Pitch::flat },
-            { { 38, 52, 0 }, 20, Pitch::flat },
-            { { 39, 53, 0 }, 18, Pitch::flat },
-            { { 39, 54, 0 }, 18, Pitch::flat },
-            { { 39, 55, 0 }, 18, Pitch::flat },
-            { { 39, 56, 0 }, 18, Pitch::flat },
-            { { 40, 57, 0 }, 18, Pitch::flat },
-            { { 40, 58, 0 }, 18, Pitch::flat },
-            { { 40, 59, 0 }, 18, Pitch::flat },
-            { { 40, 60, 0 }, 16, Pitch::flat },
-            { { 40, 61, 0 }, 16, Pitch::flat },
-            { { 40, 62, 0 }, 16, Pitch::flat },
-            { { 40, 63, 0 }, 16, Pitch::flat },
-        });
-
-    // 0x4ee43c
-    // Turnaround 0. Lane 0. Track 3. Reversed 0. Direction 3
-    static constexpr auto moveInfoTA0L0T3R0D3 = std::to_array<MoveInfo>(
-        {
-            { { 24, 31, 0 }, 48, Pitch::flat },
-            { { 24, 30, 0 }, 48, Pitch::flat },
-            { { 24, 29, 0 }, 48, Pitch::flat },
-            { { 24, 28, 0 }, 46, Pitch::flat },
-            { { 24, 27, 0 }, 46, Pitch::flat },
-            { { 24, 26, 0 }, 46, Pitch::flat },
-            { { 25, 25, 0 }, 46, Pitch::flat },
-            { { 25, 24, 0 }, 46, Pitch::flat },
-            { { 25, 23, 0 }, 46, Pitch::flat },
-            { { 25, 22, 0 }, 46, Pitch::flat },
-            { { 26, 21, 0 }, 46, Pitch::flat },
-            { { 26, 20, 0 }, 44, Pitch::flat },
-            { { 26, 19, 0 }, 44, Pitch::flat },
-            { { 26, 18, 0 }, 44, Pitch::flat },
-            { { 27, 17, 0 }, 44, Pitch::flat },
-            { { 27, 16, 0 }, 44, Pitch::flat },
-            { { 27, 15, 0 }, 44, Pitch::flat },
-            { { 28, 14, 0 }, 44, Pitch::flat },
-            { { 28, 13, 0 }, 42, Pitch::flat },
-            { { 29, 12, 0 }, 42, Pitch::flat },
-            { { 30, 11, 0 }, 42, Pitch::flat },
-            { { 30, 10, 0 }, 42, Pitch::flat },
-            { { 31, 9, 0 }, 42, Pitch::flat },
-            { { 32, 8, 0 }, 42, Pitch::flat },
-            { { 33, 7, 0 }, 40, Pitch::flat },
-            { { 34, 6, 0 }, 40, Pitch::flat },
-            { { 34, 5, 0 }, 40, Pitch::flat },
-            { { 35, 4, 0 }, 40, Pitch::flat },
-            { { 35, 3, 0 }, 40, Pitch::flat },
-            { { 36, 2, 0 }, 40, Pitch::flat },
-            { { 37, 2, 0 }, 40, Pitch::flat },
-            { { 38, 1, 0 }, 38, Pitch::flat },
-            { { 39, 0, 0 }, 38, Pitch::flat },
-            { { 40, -1, 0 }, 38, Pitch::flat },
-            { { 41, -2, 0 }, 38, Pitch::flat },
-            { { 42, -2, 0 }, 38, Pitch::flat },
-            { { 43, -3, 0 }, 38, Pitch::flat },
-            { { 44, -4, 0 }, 38, Pitch::flat },
-            { { 45, -4, 0 }, 36, Pitch::flat },
-            { { 46, -5, 0 }, 36, Pitch::flat },
-            { { 47, -5, 0 }, 36, Pitch::flat },
-            { { 48, -5, 0 }, 36, Pitch::flat },
-            { { 49, -6, 0 }, 36, Pitch::flat },
-            { { 50, -6, 0 }, 36, Pitch::flat },
-            { { 51, -6, 0 }, 36, Pitch::flat },
-            { { 52, -6, 0 }, 36, Pitch::flat },
-            { { 53, -7, 0 }, 34, Pitch::flat },
-            { { 54, -7, 0 }, 34, Pitch::flat },
-            { { 55, -7, 0 }, 34, Pitch::flat },
-            { { 56, -7, 0 }, 34, Pitch::flat },
-            { { 57, -8, 0 }, 34, Pitch::flat },
-            { { 58, -8, 0 }, 34, Pitch::flat },
-            { { 59, -8, 0 }, 34, Pitch::flat },
-            { { 60, -8, 0 }, 32, Pitch::flat },
-            { { 61, -8, 0 }, 32, Pitch::flat },
-            { { 62, -8, 0 }, 32, Pitch::flat },
-            { { 63, -8, 0 }, 32, Pitch::flat },
-        });
-
-    // 0x4ee880
-    // Turnaround 0. Lane 0. Track 3. Reversed 1. Direction 0
-    static constexpr auto moveInfoTA0L0T3R1D0 = std::to_array<MoveInfo>(
-        {
-            { { 8, 0, 0 }, 16, Pitch::flat },
-            { { 8, 1, 0 }, 16, Pitch::flat },
-            { { 8, 2, 0 }, 16, Pitch::flat },
-            { { 8, 3, 0 }, 16, Pitch::flat },
-            { { 8, 4, 0 }, 16, Pitch::flat },
-            { { 8, 5, 0 }, 16, Pitch::flat },
-            { { 8, 6, 0 }, 18, Pitch::flat },
-            { { 8, 7, 0 }, 18, Pitch::flat },
-            { { 9, 8, 0 }, 18, Pitch::flat },
-            { { 9, 9, 0 }, 18, Pitch::flat },
-            { { 9, 10, 0 }, 18, Pitch::flat },
-            { { 9, 11, 0 }, 18, Pitch::flat },
-            { { 10, 12, 0 }, 18, Pitch::flat },
-            { { 10, 13, 0 }, 18, Pitch::flat },
-            { { 10, 14, 0 }, 18, Pitch::flat },
-            { { 10, 15, 0 }, 20, Pitch::flat },
-            { { 11, 16, 0 }, 20, Pitch::flat },
-            { { 11, 17, 0 }, 20, Pitch::flat },
-            { { 11, 18, 0 }, 20, Pitch::flat },
-            { { 12, 19, 0 }, 20, Pitch::flat },
-            { { 12, 20, 0 }, 20, Pitch::flat },
-            { { 12, 21, 0 }, 20, Pitch::flat },
-            { { 13, 22, 0 }, 20, Pitch::flat },
-            { { 13, 23, 0 }, 20, Pitch::flat },
-            { { 14, 24, 0 }, 20, Pitch::flat },
-            { { 14, 25, 0 }, 20, Pitch::flat },
-            { { 15, 26, 0 }, 22, Pitch::flat },
-            { { 15, 27, 0 }, 22, Pitch::flat },
-            { { 16, 28, 0 }, 22, Pitch::flat },
-            { { 17, 29, 0 }, 22, Pitch::flat },
-            { { 17, 30, 0 }, 22, Pitch::flat },
-            { { 18, 31, 0 }, 22, Pitch::flat },
-            { { 19, 32, 0 }, 22, Pitch::flat },
-            { { 19, 33, 0 }, 22, Pitch::flat },
-            { { 20, 34, 0 }, 22, Pitch::flat },
-            { { 21, 35, 0 }, 24, Pitch::flat },
-            { { 22, 36, 0 }, 24, Pitch::flat },
-            { { 22, 37, 0 }, 24, Pitch::flat },
-            { { 23, 38, 0 }, 24, Pitch::flat },
-            { { 24, 39, 0 }, 24, Pitch::flat },
-            { { 24, 40, 0 }, 24, Pitch::flat },
-            { { 25, 41, 0 }, 24, Pitch::flat },
-            { { 26, 42, 0 }, 24, Pitch::flat },
-            { { 27, 42, 0 }, 24, Pitch::flat },
-            { { 28, 43, 0 }, 26, Pitch::flat },
-            { { 29, 44, 0 }, 26, Pitch::flat },
-            { { 30, 45, 0 }, 26, Pitch::flat },
-            { { 31, 45, 0 }, 26, Pitch::flat },
-            { { 32, 46, 0 }, 26, Pitch::flat },
-            { { 33, 47, 0 }, 26, Pitch::flat },
-            { { 34, 47, 0 }, 26, Pitch::flat },
-            { { 35, 48, 0 }, 26, Pitch::flat },
-            { { 36, 49, 0 }, 26, Pitch::flat },
-            { { 37, 49, 0 }, 28, Pitch::flat },
-            { { 38, 50, 0 }, 28, Pitch::flat },
-            { { 39, 50, 0 }, 28, Pitch::flat },
-            { { 40, 51, 0 }, 28, Pitch::flat },
-            { { 41, 51, 0 }, 28, Pitch::flat },
-            { { 42, 52, 0 }, 28, Pitch::flat },
-            { { 43, 52, 0 }, 28, Pitch::flat },
-            { { 44, 52, 0 }, 28, Pitch::flat },
-            { { 45, 53, 0 }, 28, Pitch::flat },
-            { { 46, 53, 0 }, 28, Pitch::flat },
-            { { 47, 53, 0 }, 28, Pitch::flat },
-            { { 48, 54, 0 }, 30, Pitch::flat },
-            { { 49, 54, 0 }, 30, Pitch::flat },
-            { { 50, 54, 0 }, 30, Pitch::flat },
-            { { 51, 54, 0 }, 30, Pitch::flat },
-            { { 52, 55, 0 }, 30, Pitch::flat },
-            { { 53, 55, 0 }, 30, Pitch::flat },
-            { { 54, 55, 0 }, 30, Pitch::flat },
-            { { 55, 55, 0 }, 30, Pitch::flat },
-            { { 56, 56, 0 }, 30, Pitch::flat },
-            { { 57, 56, 0 }, 30, Pitch::flat },
-            { { 58, 56, 0 }, 32, Pitch::flat },
-            { { 59, 56, 0 }, 32, Pitch::flat },
-            { { 60, 56, 0 }, 32, Pitch::flat },
-            { { 61, 56, 0 }, 32, Pitch::flat },
-            { { 62, 56, 0 }, 32, Pitch::flat },
-            { { 63, 56, 0 }, 32, Pitch::flat },
-        });
-
-    // 0x4eeb02
-    // Turnaround 0. Lane 0. Track 3. Reversed 1. Direction 1
-    static constexpr auto moveInfoTA0L0T3R1D1 = std::to_array<MoveInfo>(
-        {
-            { { 0, 24, 0 }, 32, Pitch::flat },
-            { { 1, 24, 0 }, 32, Pitch::flat },
-            { { 2, 24, 0 }, 32, Pitch::flat },
-            { { 3, 24, 0 }, 32, Pitch::flat },
-            { { 4, 24, 0 }, 32, Pitch::flat },
-            { { 5, 24, 0 }, 32, Pitch::flat },
-            { { 6, 24, 0 }, 34, Pitch::flat },
-            { { 7, 24, 0 }, 34, Pitch::flat },
-            { { 8, 23, 0 }, 34, Pitch::flat },
-            { { 9, 23, 0 }, 34, Pitch::flat },
-            { { 10, 23, 0 }, 34, Pitch::flat },
-            { { 11, 23, 0 }, 34, Pitch::flat },
-            { { 12, 22, 0 }, 34, Pitch::flat },
-            { { 13, 22, 0 }, 34, Pitch::flat },
-            { { 14, 22, 0 }, 34, Pitch::flat },
-            { { 15, 22, 0 }, 36, Pitch::flat },
-            { { 16, 21, 0 }, 36, Pitch::flat },
-            { { 17, 21, 0 }, 36, Pitch::flat },
-            { { 18, 21, 0 }, 36, Pitch::flat },
-            { { 19, 20, 0 }, 36, Pitch::flat },
-            { { 20, 20, 0 }, 36, Pitch::flat },
-            { { 21, 20, 0 }, 36, Pitch::flat },
-            { { 22, 19, 0 }, 36, Pitch::flat },
-            { { 23, 19, 0 }, 36, Pitch::flat },
-            { { 24, 18, 0 }, 36, Pitch::flat },
-            { { 25, 18, 0 }, 36, Pitch::flat },
-            { { 26, 17, 0 }, 38, Pitch::flat },
-            { { 27, 17, 0 }, 38, Pitch::flat },
-            { { 28, 16, 0 }, 38, Pitch::flat },
-            { { 29, 15, 0 }, 38, Pitch::flat },
-            { { 30, 15, 0 }, 38, Pitch::flat },
-            { { 31, 14, 0 }, 38, Pitch::flat },
-            { { 32, 13, 0 }, 38, Pitch::flat },
-            { { 33, 13, 0 }, 38, Pitch::flat },
-            { { 34, 12, 0 }, 38, Pitch::flat },
-            { { 35, 11, 0 }, 40, Pitch::flat },
-            { { 36, 10, 0 }, 40, Pitch::flat },
-            { { 37, 10, 0 }, 40, Pitch::flat },
-            { { 38, 9, 0 }, 40, Pitch::flat },
-            { { 39, 8, 0 }, 40, Pitch::flat },
-            { { 40, 8, 0 }, 40, Pitch::flat },
-            { { 41, 7, 0 }, 40, Pitch::flat },
-            { { 42, 6, 0 }, 40, Pitch::flat },
-            { { 42, 5, 0 }, 40, Pitch::flat },
-            { { 43, 4, 0 }, 42, Pitch::flat },
-            { { 44, 3, 0 }, 42, Pitch::flat },
-            { { 45, 2, 0 }, 42, Pitch::flat },
-            { { 45, 1, 0 }, 42, Pitch::flat },
-            { { 46, 0, 0 }, 42, Pitch::flat },
-            { { 47, -1, 0 }, 42, Pitch::flat },
-            { { 47, -2, 0 }, 42, Pitch::flat },
-            { { 48, -3, 0 }, 42, Pitch::flat },
-            { { 49, -4, 0 }, 42, Pitch::flat },
-            { { 49, -5, 0 }, 44, Pitch::flat },
-            { { 50, -6, 0 }, 44, Pitch::flat },
-            { { 50, -7, 0 }, 44, Pitch::flat },
-            { { 51, -8, 0 }, 44, Pitch::flat },
-            { { 51, -9, 0 }, 44, Pitch::flat },
-            { { 52, -10, 0 }, 44, Pitch::flat },
-            { { 52, -11, 0 }, 44, Pitch::flat },
-            { { 52, -12, 0 }, 44, Pitch::flat },
-            { { 53, -13, 0 }, 44, Pitch::flat },
-            { { 53, -14, 0 }, 44, Pitch::flat },
-            { { 53, -15, 0 }, 44, Pitch::flat },
-            { { 54, -16, 0 }, 46, Pitch::flat },
-            { { 54, -17, 0 }, 46, Pitch::flat },
-            { { 54, -18, 0 }, 46, Pitch::flat },
-            { { 54, -19, 0 }, 46, Pitch::flat },
-            { { 55, -20, 0 }, 46, Pitch::flat },
-            { { 55, -21, 0 }, 46, Pitch::flat },
-            { { 55, -22, 0 }, 46, Pitch::flat },
-            { { 55, -23, 0 }, 46, Pitch::flat },
-            { { 56, -24, 0 }, 46, Pitch::flat },
-            { { 56, -25, 0 }, 46, Pitch::flat },
-            { { 56, -26, 0 }, 48, Pitch::flat },
-            { { 56, -27, 0 }, 48, Pitch::flat },
-            { { 56, -28, 0 }, 48, Pitch::flat },
-            { { 56, -29, 0 }, 48, Pitch::flat },
-            { { 56, -30, 0 }, 48, Pitch::flat },
-            { { 56, -31, 0 }, 48, Pitch::flat },
-            { { 56, -32, 0 }, 48, Pitch::flat },
-        });
-
-    // 0x4eed8c
-    // Turnaround 0. Lane 0. Track 3. Reversed 1. Direction 2
-    static constexpr auto moveInfoTA0L0T3R1D2 = std::to_array<MoveInfo>(
-        {
-            { { 24, 31, 0 }, 48, Pitch::flat },
-            { { 24, 30, 0 }, 48, Pitch::flat },
-            { { 24, 29, 0 }, 48, Pitch::flat },
-            { { 24, 28, 0 }, 48, Pitch::flat },
-            { { 24, 27, 0 }, 48, Pitch::flat },
-            { { 24, 26, 0 }, 50, Pitch::flat },
-            { { 24, 25, 0 }, 50, Pitch::flat },
-            { { 23, 24, 0 }, 50, Pitch::flat },
-            { { 23, 23, 0 }, 50, Pitch::flat },
-            { { 23, 22, 0 }, 50, Pitch::flat },
-            { { 23, 21, 0 }, 50, Pitch::flat },
-            { { 22, 20, 0 }, 50, Pitch::flat },
-            { { 22, 19, 0 }, 50, Pitch::flat },
-            { { 22, 18, 0 }, 50, Pitch::flat },
-            { { 22, 17, 0 }, 52, Pitch::flat },
-            { { 21, 16, 0 }, 52, Pitch::flat },
-            { { 21, 15, 0 }, 52, Pitch::flat },
-            { { 21, 14, 0 }, 52, Pitch::flat },
-            { { 20, 13, 0 }, 52, Pitch::flat },
-            { { 20, 12, 0 }, 52, Pitch::flat },
-            { { 20, 11, 0 }, 52, Pitch::flat },
-            { { 19, 10, 0 }, 52, Pitch::flat },
-            { { 19, 9, 0 }, 52, Pitch::flat },
-            { { 18, 8, 0 }, 52, Pitch::flat },
-            { { 18, 7, 0 }, 52, Pitch::flat },
-            { { 17, 6, 0 }, 54, Pitch::flat },
-            { { 17, 5, 0 }, 54, Pitch::flat },
-            { { 16, 4, 0 }, 54, Pitch::flat },
-            { { 15, 3, 0 }, 54, Pitch::flat },
-            { { 15, 2, 0 }, 54, Pitch::flat },
-            { { 14, 1, 0 }, 54, Pitch::flat },
-            { { 13, 0, 0 }, 54, Pitch::flat },
-            { { 13, -1, 0 }, 54, Pitch::flat },
-            { { 12, -2, 0 }, 54, Pitch::flat },
-            { { 11, -3, 0 }, 56, Pitch::flat },
-            { { 10, -4, 0 }, 56, Pitch::flat },
-            { { 10, -5, 0 }, 56, Pitch::flat },
-            { { 9, -6, 0 }, 56, Pitch::flat },
-            { { 8, -7, 0 }, 56, Pitch::flat },
-            { { 8, -8, 0 }, 56, Pitch::flat },
-            { { 7, -9, 0 }, 56, Pitch::flat },
-            { { 6, -10, 0 }, 56, Pitch::flat },
-            { { 5, -10, 0 }, 56, Pitch::flat },
-            { { 4, -11, 0 }, 58, Pitch::flat },
-            { { 3, -12, 0 }, 58, Pitch::flat },
-            { { 2, -13, 0 }, 58, Pitch::flat },
-            { { 1, -13, 0 }, 58, Pitch::flat },
-            { { 0, -14, 0 }, 58, Pitch::flat },
-            { { -1, -15, 0 }, 58, Pitch::flat },
-            { { -2, -15, 0 }, 58, Pitch::flat },
-            { { -3, -16, 0 }, 58, Pitch::flat },
-            { { -4, -17, 0 }, 58, Pitch::flat },
-            { { -5, -17, 0 }, 60, Pitch::flat },
-            { { -6, -18, 0 }, 60, Pitch::flat },
-            { { -7, -18, 0 }, 60, Pitch::flat },
-            { { -8, -19, 0 }, 60, Pitch::flat },
-            { { -9, -19, 0 }, 60, Pitch::flat },
-            { { -10, -20, 0 }, 60, Pitch::flat },
-            { { -11, -20, 0 }, 60, Pitch::flat },
-            { { -12, -20, 0 }, 60, Pitch::flat },
-            { { -13, -21, 0 }, 60, Pitch::flat },
-            { { -14, -21, 0 }, 60, Pitch::flat },
-            { { -15, -21, 0 }, 60, Pitch::flat },
-            { { -16, -22, 0 }, 62, Pitch::flat },
-            { { -17, -22, 0 }, 62, Pitch::flat },
-            { { -18, -22, 0 }, 62, Pitch::flat },
-            { { -19, -22, 0 }, 62, Pitch::flat },
-            { { -20, -23, 0 }, 62, Pitch::flat },
-            { { -21, -23, 0 }, 62, Pitch::flat },
-            { { -22, -23, 0 }, 62, Pitch::flat },
-            { { -23, -23, 0 }, 62, Pitch::flat },
-            { { -24, -24, 0 }, 62, Pitch::flat },
-            { { -25, -24, 0 }, 62, Pitch::flat },
-            { { -26, -24, 0 }, 0, Pitch::flat },
-            { { -27, -24, 0 }, 0, Pitch::flat },
-            { { -28, -24, 0 }, 0, Pitch::flat },
-            { { -29, -24, 0 }, 0, Pitch::flat },
-            { { -30, -24, 0 }, 0, Pitch::flat },
-            { { -31, -24, 0 }, 0, Pitch::flat },
-            { { -32, -24, 0 }, 0, Pitch::flat },
-        });
-
-    // 0x4ee606
-    // Turnaround 0. Lane 0. Track 3. Reversed 1. Direction 3
-    static constexpr auto moveInfoTA0L0T3R1D3 = std::to_array<MoveInfo>(
-        {
-            { { 31, 8, 0 }, 0, Pitch::flat },
-            { { 30, 8, 0 }, 0, Pitch::flat },
-            { { 29, 8, 0 }, 0, Pitch::flat },
-            { { 28, 8, 0 }, 0, Pitch::flat },
-            { { 27, 8, 0 }, 0, Pitch::flat },
-            { { 26, 8, 0 }, 2, Pitch::flat },
-            { { 25, 8, 0 }, 2, Pitch::flat },
-            { { 24, 9, 0 }, 2, Pitch::flat },
-            { { 23, 9, 0 }, 2, Pitch::flat },
-            { { 22, 9, 0 }, 2, Pitch::flat },
-            { { 21, 9, 0 }, 2, Pitch::flat },
-            { { 20, 10, 0 }, 2, Pitch::flat },
-            { { 19, 10, 0 }, 2, Pitch::flat },
-            { { 18, 10, 0 }, 2, Pitch::flat },
-            { { 17, 10, 0 }, 4, Pitch::flat },
-            { { 16, 11, 0 }, 4, Pitch::flat },
-            { { 15, 11, 0 }, 4, Pitch::flat },
-            { { 14, 11, 0 }, 4, Pitch::flat },
-            { { 13, 12, 0 }, 4, Pitch::flat },
-            { { 12, 12, 0 }, 4, Pitch::flat },
-            { { 11, 12, 0 }, 4, Pitch::flat },
-            { { 10, 13, 0 }, 4, Pitch::flat },
-            { { 9, 13, 0 }, 4, Pitch::flat },
-            { { 8, 14, 0 }, 4, Pitch::flat },
-            { { 7, 14, 0 }, 4, Pitch::flat },
-            { { 6, 15, 0 }, 6, Pitch::flat },
-            { { 5, 15, 0 }, 6, Pitch::flat },
-            { { 4, 16, 0 }, 6, Pitch::flat },
-            { { 3, 17, 0 }, 6, Pitch::flat },
-            { { 2, 17, 0 }, 6, Pitch::flat },
-            { { 1, 18, 0 }, 6, Pitch::flat },
-            { { 0, 19, 0 }, 6, Pitch::flat },
-            { { -1, 19, 0 }, 6, Pitch::flat },
-            { { -2, 20, 0 }, 6, Pitch::flat },
-            { { -3, 21, 0 }, 8, Pitch::flat },
-            { { -4, 22, 0 }, 8, Pitch::flat },
-            { { -5, 22, 0 }, 8, Pitch::flat },
-            { { -6, 23, 0 }, 8, Pitch::flat },
-            { { -7, 24, 0 }, 8, Pitch::flat },
-            { { -8, 24, 0 }, 8, Pitch::flat },
-            { { -9, 25, 0 }, 8, Pitch::flat },
-            { { -10, 26, 0 }, 8, Pitch::flat },
-            { { -10, 27, 0 }, 8, Pitch::flat },
-            { { -11, 28, 0 }, 10, Pitch::flat },
-            { { -12, 29, 0 }, 10, Pitch::flat },
-            { { -13, 30, 0 }, 10, Pitch::flat },
-            { { -13, 31, 0 }, 10, Pitch::flat },
-            { { -14, 32, 0 }, 10, Pitch::flat },
-            { { -15, 33, 0 }, 10, Pitch::flat },
-            { { -15, 34, 0 }, 10, Pitch::flat },
-            { { -16, 35, 0 }, 10, Pitch::flat },
-            { { -17, 36, 0 }, 10, Pitch::flat },
-            { { -17, 37, 0 }, 12, Pitch::flat },
-            { { -18, 38, 0 }, 12, Pitch::flat },
-            { { -18, 39, 0 }, 12, Pitch::flat },
-            { { -19, 40, 0 }, 12, Pitch::flat },
-            { { -19, 41, 0 }, 12, Pitch::flat },
-            { { -20, 42, 0 }, 12, Pitch::flat },
-            { { -20, 43, 0 }, 12, Pitch::flat },
-            { { -20, 44, 0 }, 12, Pitch::flat },
-            { { -21, 45, 0 }, 12, Pitch::flat },
-            { { -21, 46, 0 }, 12, Pitch::flat },
-            { { -21, 47, 0 }, 12, Pitch::flat },
-            { { -22, 48, 0 }, 14, Pitch::flat },
-            { { -22, 49, 0 }, 14, Pitch::flat },
-            { { -22, 50, 0 }, 14, Pitch::flat },
-            { { -22, 51, 0 }, 14, Pitch::flat },
-            { { -23, 52, 0 }, 14, Pitch::flat },
-            { { -23, 53, 0 }, 14, Pitch::flat },
-            { { -23, 54, 0 }, 14, Pitch::flat },
-            { { -23, 55, 0 }, 14, Pitch::flat },
-            { { -24, 56, 0 }, 14, Pitch::flat },
-            { { -24, 57, 0 }, 14, Pitch::flat },
-            { { -24, 58, 0 }, 16, Pitch::flat },
-            { { -24, 59, 0 }, 16, Pitch::flat },
-            { { -24, 60, 0 }, 16, Pitch::flat },
-            { { -24, 61, 0 }, 16, Pitch::flat },
-            { { -24, 62, 0 }, 16, Pitch::flat },
-            { { -24, 63, 0 }, 16, Pitch::flat },
-        });
-
-    // 0x4ebe9e
-    // Turnaround 0. Lane 0. Track 5. Reversed 0. Direction 0
-    static constexpr auto moveInfoTA0L0T5R0D0 = std::to_array<MoveInfo>(
-        {
-            { { 31, 8, 0 }, 0, Pitch::up12deg },
-            { { 30, 8, 0 }, 0, Pitch::up12deg },
-            { { 29, 8, 0 }, 0, Pitch::up12deg },
-            { { 28, 8, 0 }, 0, Pitch::up12deg },
-            { { 27, 8, 1 }, 0, Pitch::up12deg },
-            { { 26, 8, 1 }, 0, Pitch::up12deg },
-            { { 25, 8, 1 }, 0, Pitch::up12deg },
-            { { 24, 8, 1 }, 0, Pitch::up12deg },
-            { { 23, 8, 2 }, 0, Pitch::up12deg },
-            { { 22, 8, 2 }, 0, Pitch::up12deg },
-            { { 21, 8, 2 }, 0, Pitch::up12deg },
-            { { 20, 8, 2 }, 0, Pitch::up12deg },
-            { { 19, 8, 3 }, 0, Pitch::up12deg },
-            { { 18, 8, 3 }, 0, Pitch::up12deg },
-            { { 17, 8, 3 }, 0, Pitch::up12deg },
-            { { 16, 8, 3 }, 0, Pitch::up12deg },
-            { { 15, 8, 4 }, 0, Pitch::up12deg },
-            { { 14, 8, 4 }, 0, Pitch::up12deg },
-            { { 13, 8, 4 }, 0, Pitch::up12deg },
-            { { 12, 8, 4 }, 0, Pitch::up12deg },
-            { { 11, 8, 5 }, 0, Pitch::up12deg },
-            { { 10, 8, 5 }, 0, Pitch::up12deg },
-            { { 9, 8, 5 }, 0, Pitch::up12deg },
-            { { 8, 8, 5 }, 0, Pitch::up12deg },
-            { { 7, 8, 6 }, 0, Pitch::up12deg },
-            { { 6, 8, 6 }, 0, Pitch::up12deg },
-            { { 5, 8, 6 }, 0, Pitch::up12deg },
-            { { 4, 8, 6 }, 0, Pitch::up12deg },
-            { { 3, 8, 7 }, 0, Pitch::up12deg },
-            { { 2, 8, 7 }, 0, Pitch::up12deg },
-            { { 1, 8, 7 }, 0, Pitch::up12deg },
-            { { 0, 8, 7 }, 0, Pitch::up12deg },
-            { { -1, 8, 8 }, 0, Pitch::up12deg },
-            { { -2, 8, 8 }, 0, Pitch::up12deg },
-            { { -3, 8, 8 }, 0, Pitch::up12deg },
-            { { -4, 8, 8 }, 0, Pitch::up12deg },
-            { { -5, 8, 9 }, 0, Pitch::up12deg },
-            { { -6, 8, 9 }, 0, Pitch::up12deg },
-            { { -7, 8, 9 }, 0, Pitch::up12deg },
-            { { -8, 8, 9 }, 0, Pitch::up12deg },
-            { { -9, 8, 10 }, 0, Pitch::up12deg },
-            { { -10, 8, 10 }, 0, Pitch::up12deg },
-            { { -11, 8, 10 }, 0, Pitch::up12deg },
-            { { -12, 8, 10 }, 0, Pitch::up12deg },
-            { { -13, 8, 11 }, 0, Pitch::up12deg },
-            { { -14, 8, 11 }, 0, Pitch::up12deg },
-            { { -15, 8, 11 }, 0, Pitch::up12deg },
-            { { -16, 8, 11 }, 0, Pitch::up12deg },
-            { { -17, 8, 12 }, 0, Pitch::up12deg },
-            { { -18, 8, 12 }, 0, Pitch::up12deg },
-            { { -19, 8, 12 }, 0, Pitch::up12deg },
-            { { -20, 8, 12 }, 0, Pitch::up12deg },
-            { { -21, 8, 13 }, 0, Pitch::up12deg },
-            { { -22, 8, 13 }, 0, Pitch::up12deg },
-            { { -23, 8, 13 }, 0, Pitch::up12deg },
-            { { -24, 8, 13 }, 0, Pitch::up12deg },
-            { { -25, 8, 14 }, 0, Pitch::up12deg },
-            { { -26, 8, 14 }, 0, Pitch::up12deg },
-            { { -27, 8, 14 }, 0, Pitch::up12deg },
-            { { -28, 8, 14 }, 0, Pitch::up12deg },
-            { { -29, 8, 15 }, 0, Pitch::up12deg },
-            { { -30, 8, 15 }, 0, Pitch::up12deg },
-            { { -31, 8, 15 }, 0, Pitch::up12deg },
-            { { -32, 8, 15 }, 0, Pitch::up12deg },
-        });
-
-    // 0x4ec0a0
-    // Turnaround 0. Lane 0. Track 5. Reversed 0. Direction 1
-    static constexpr auto moveInfoTA0L0T5R0D1 = std::to_array<MoveInfo>(
-        {
-            { { 8, 0, 0 }, 16, Pitch::up12deg },
-            { { 8, 1, 0 }, 16, Pitch::up12deg },
-            { { 8, 2, 0 }, 16, Pitch::up12deg },
-            { { 8, 3, 0 }, 16, Pitch::up12deg },
-            { { 8, 4, 1 }, 16, Pitch::up12deg },
-            { { 8, 5, 1 }, 16, Pitch::up12deg },
-            { { 8, 6, 1 }, 16, Pitch::up12deg },
-            { { 8, 7, 1 }, 16, Pitch::up12deg },
-            { { 8, 8, 2 }, 16, Pitch::up12deg },
-            { { 8, 9, 2 }, 16, Pitch::up12deg },
-            { { 8, 10, 2 }, 16, Pitch::up12deg },
-            { { 8, 11, 2 }, 16, Pitch::up12deg },
-            { { 8, 12, 3 }, 16, Pitch::up12deg },
-            { { 8, 13, 3 }, 16, Pitch::up12deg },
-            { { 8, 14, 3 }, 16, Pitch::up12deg },
-            { { 8, 15, 3 }, 16, Pitch::up12deg },
-            { { 8, 16, 4 }, 16, Pitch::up12deg },
-            { { 8, 17, 4 }, 16, Pitch::up12deg },
-            { { 8, 18, 4 }, 16, Pitch::up12deg },
-            { { 8, 19, 4 }, 16, Pitch::up12deg },
-            { { 8, 20, 5 }, 16, Pitch::up12deg },
-            { { 8, 21, 5 }, 16, Pitch::up12deg },
-            { { 8, 22, 5 }, 16, Pitch::up12deg },
-            { { 8, 23, 5 }, 16, Pitch::up12deg },
-            { { 8, 24, 6 }, 16, Pitch::up12deg },
-            { { 8, 25, 6 }, 16, Pitch::up12deg },
-            { { 8, 26, 6 }, 16, Pitch::up12deg },
-            { { 8, 27, 6 }, 16, Pitch::up12deg },
-            { { 8, 28, 7 }, 16, Pitch::up12deg },
-            { { 8, 29, 7 }, 16, Pitch::up12deg },
-            { { 8, 30, 7 }, 16, Pitch::up12deg },
-            { { 8, 31, 7 }, 16, Pitch::up12deg },
-            { { 8, 32, 8 }, 16, Pitch::up12deg },
-            { { 8, 33, 8 }, 16, Pitch::up12deg },
-            { { 8, 34, 8 }, 16, Pitch::up12deg },
-            { { 8, 35, 8 }, 16, Pitch::up12deg },
-            { { 8, 36, 9 }, 16, Pitch::up12deg },
-            { { 8, 37, 9 }, 16, Pitch::up12deg },
-            { { 8, 38, 9 }, 16, Pitch::up12deg },
-            { { 8, 39, 9 }, 16, Pitch::up12deg },
-            { { 8, 40, 10 }, 16, Pitch::up12deg },
-            { { 8, 41, 10 }, 16, Pitch::up12deg },
-            { { 8, 42, 10 }, 16, Pitch::up12deg },
-            { { 8, 43, 10 }, 16, Pitch::up12deg },
-            { { 8, 44, 11 }, 16, Pitch::up12deg },
-            { { 8, 45, 11 }, 16, Pitch::up12deg },
-            { { 8, 46, 11 }, 16, Pitch::up12deg },
-            { { 8, 47, 11 }, 16, Pitch::up12deg },
-            { { 8, 48, 12 }, 16, Pitch::up12deg },
-            { { 8, 49, 12 }, 16, Pitch::up12deg },
-            { { 8, 50, 12 }, 16, Pitch::up12deg },
-            { { 8, 51, 12 }, 16, Pitch::up12deg },
-            { { 8, 52, 13 }, 16, Pitch::up12deg },
-            { { 8, 53, 13 }, 16, Pitch::up12deg },
-            { { 8, 54, 13 }, 16, Pitch::up12deg },
-            { { 8, 55, 13 }, 16, Pitch::up12deg },
-            { { 8, 56, 14 }, 16, Pitch::up12deg },
-            { { 8, 57, 14 }, 16, Pitch::up12deg },
-            { { 8, 58, 14 }, 16, Pitch::up12deg },
-            { { 8, 59, 14 }, 16, Pitch::up12deg },
-            { { 8, 60, 15 }, 16, Pitch::up12deg },
-            { { 8, 61, 15 }, 16, Pitch::up12deg },
-            { { 8, 62, 15 }, 16, Pitch::up12deg },
-            { { 8, 63, 15 }, 16, Pitch::up12deg },
-        });
-
-    // 0x4ec2a2
-    // Turnaround 0. Lane 0. Track 5. Reversed 0. Direction 2
-    static constexpr auto moveInfoTA0L0T5R0D2 = std::to_array<MoveInfo>(
-        {
-            { { 0, 24, 0 }, 32, Pitch::up12deg },
-            { { 1, 24, 0 }, 32, Pitch::up12deg },
-            { { 2, 24, 0 }, 32, Pitch::up12deg },
-            { { 3, 24, 0 }, 32, Pitch::up12deg },
-            { { 4, 24, 1 }, 32, Pitch::up12deg },
-            { { 5, 24, 1 }, 32, Pitch::up12deg },
-            { { 6, 24, 1 }, 32, Pitch::up12deg },
-            { { 7, 24, 1 }, 32, Pitch::up12deg },
-            { { 8, 24, 2 }, 32, Pitch::up12deg },
-            { { 9, 24, 2 }, 32, Pitch::up12deg },
-            { { 10, 24, 2 }, 32, Pitch::up12deg },
-            { { 11, 24, 2 }, 32, Pitch::up12deg },
-            { { 12, 24, 3 }, 32, Pitch::up12deg },
-            { { 13, 24, 3 }, 32, Pitch::up12deg },
-            { { 14, 24, 3 }, 32, Pitch::up12deg },
-            { { 15, 24, 3 }, 32, Pitch::up12deg },
-            { { 16, 24, 4 }, 32, Pitch::up12deg },
-            { { 17, 24, 4 }, 32, Pitch::up12deg },
-            { { 18, 24, 4 }, 32, Pitch::up12deg },
-            { { 19, 24, 4 }, 32, Pitch::up12deg },
-            { { 20, 24, 5 }, 32, Pitch::up12deg },
-            { { 21, 24, 5 }, 32, Pitch::up12deg },
-            { { 22, 24, 5 }, 32, Pitch::up12deg },
-            { { 23, 24, 5 }, 32, Pitch::up12deg },
-            { { 24, 24, 6 }, 32, Pitch::up12deg },
-            { { 25, 24, 6 }, 32, Pitch::up12deg },
-            { { 26, 24, 6 }, 32, Pitch::up12deg },
-            { { 27, 24, 6 }, 32, Pitch::up12deg },
-            { { 28, 24, 7 }, 32, Pitch::up12deg },
-            { { 29, 24, 7 }, 32, Pitch::up12deg },
-            { { 30, 24, 7 }, 32, Pitch::up12deg },
-            { { 31, 24, 7 }, 32, Pitch::up12deg },
-            { { 32, 24, 8 }, 32, Pitch::up12deg },
-            { { 33, 24, 8 }, 32, Pitch::up12deg },
-            { { 34, 24, 8 }, 32, Pitch::up12deg },
-            { { 35, 24, 8 }, 32, Pitch::up12deg },
-            { { 36, 24, 9 }, 32, Pitch::up12deg },
-            { { 37, 24, 9 }, 32, Pitch::up12deg },
-            { { 38, 24, 9 }, 32, Pitch::up12deg },
-            { { 39, 24, 9 }, 32, Pitch::up12deg },
-            { { 40, 24, 10 }, 32, Pitch::up12deg },
-            { { 41, 24, 10 }, 32, Pitch::up12deg },
-            { { 42, 24, 10 }, 32, Pitch::up12deg },
-            { { 43, 24, 10 }, 32, Pitch::up12deg },
-            { { 44, 24, 11 }, 32, Pitch::up12deg },
-            { { 45, 24, 11 }, 32, Pitch::up12deg },
-            { { 46, 24, 11 }, 32, Pitch::up12deg },
-            { { 47, 24, 11 }, 32, Pitch::up12deg },
-            { { 48, 24, 12 }, 32, Pitch::up12deg },
-            { { 49, 24, 12 }, 32, Pitch::up12deg },
-            { { 50, 24, 12 }, 32, Pitch::up12deg },
-            { { 51, 24, 12 }, 32, Pitch::up12deg },
-            { { 52, 24, 13 }, 32, Pitch::up12deg },
-            { { 53, 24, 13 }, 32, Pitch::up12deg },
-            { { 54, 24, 13 }, 32, Pitch::up12deg },
-            { { 55, 24, 13 }, 32, Pitch::up12deg },
-            { { 56, 24, 14 }, 32, Pitch::up12deg },
-            { { 57, 24, 14 }, 32, Pitch::up12deg },
-            { { 58, 24, 14 }, 32, Pitch::up12deg },
-            { { 59, 24, 14 }, 32, Pitch::up12deg },
-            { { 60, 24, 15 }, 32, Pitch::up12deg },
-            { { 61, 24, 15 }, 32, Pitch::up12deg },
-            { { 62, 24, 15 }, 32, Pitch::up12deg },
-            { { 63, 24, 15 }, 32, Pitch::up12deg },
-        });
-
-    // 0x4ec4a4
-    // Turnaround 0. Lane 0. Track 5. Reversed 0. Direction 3
-    static constexpr auto moveInfoTA0L0T5R0D3 = std::to_array<MoveInfo>(
-        {
-            { { 24, 31, 0 }, 48, Pitch::up12deg },
-            { { 24, 30, 0 }, 48, Pitch::up12deg },
-            { { 24, 29, 0 }, 48, Pitch::up12deg },
-            { { 24, 28, 0 }, 48, Pitch::up12deg },
-            { { 24, 27, 1 }, 48, Pitch::up12deg },
-            { { 24, 26, 1 }, 48, Pitch::up12deg },
-            { { 24, 25, 1 }, 48, Pitch::up12deg },
-            { { 24, 24, 1 }, 48, Pitch::up12deg },
-            { { 24, 23, 2 }, 48, Pitch::up12deg },
-            { { 24, 22, 2 }, 48, Pitch::up12deg },
-            { { 24, 21, 2 }, 48, Pitch::up12deg },
-            { { 24, 20, 2 }, 48, Pitch::up12deg },
-            { { 24, 19, 3 }, 48, Pitch::up12deg },
-            { { 24, 18, 3 }, 48, Pitch::up12deg },
-            { { 24, 17, 3 }, 48, Pitch::up12deg },
-            { { 24, 16, 3 }, 48, Pitch::up12deg },
-            { { 24, 15, 4 }, 48, Pitch::up12deg },
-            { { 24, 14, 4 }, 48, Pitch::up12deg },
-            { { 24, 13, 4 }, 48, Pitch::up12deg },
-            { { 24, 12, 4 }, 48, Pitch::up12deg },
-            { { 24, 11, 5 }, 48, Pitch::up12deg },
-            { { 24, 10, 5 }, 48, Pitch::up12deg },
-            { { 24, 9, 5 }, 48, Pitch::up12deg },
-            { { 24, 8, 5 }, 48, Pitch::up12deg },
-            { { 24, 7, 6 }, 48, Pitch::up12deg },
-            { { 24, 6, 6 }, 48, Pitch::up12deg },
-            { { 24, 5, 6 }, 48, Pitch::up12deg },
-            { { 24, 4, 6 }, 48, Pitch::up12deg },
-            { { 24, 3, 7 }, 48, Pitch::up12deg },
-            { { 24, 2, 7 }, 48, Pitch::up12deg },
-            { { 24, 1, 7 }, 48, Pitch::up12deg },
-            { { 24, 0, 7 }, 48, Pitch::up12deg },
-            { { 24, -1, 8 }, 48, Pitch::up12deg },
-            { { 24, -2, 8 }, 48, Pitch::up12deg },
-            { { 24, -3, 8 }, 48, Pitch::up12deg },
-            { { 24, -4, 8 }, 48, Pitch::up12deg },
-            { { 24, -5, 9 }, 48, Pitch::up12deg },
-            { { 24, -6, 9 }, 48, Pitch::up12deg },
-            { { 24, -7, 9 }, 48, Pitch::up12deg },
-            { { 24, -8, 9 }, 48, Pitch::up12deg },
-            { { 24, -9, 10 }, 48, Pitch::up12deg },
-            { { 24, -10, 10 }, 48, Pitch::up12deg },
-            { { 24, -11, 10 }, 48, Pitch::up12deg },
-            { { 24, -12, 10 }, 48, Pitch::up12deg },
-            { { 24, -13, 11 }, 48, Pitch::up12deg },
-            { { 24, -14, 11 }, 48, Pitch::up12deg },
-            { { 24, -15, 11 }, 48, Pitch::up12deg },
-            { { 24, -16, 11 }, 48, Pitch::up12deg },
-            { { 24, -17, 12 }, 48, Pitch::up12deg },
-            { { 24, -18, 12 }, 48, Pitch::up12deg },
-            { { 24, -19, 12 }, 48, Pitch::up12deg },
-            { { 24, -20, 12 }, 48, Pitch::up12deg },
-            { { 24, -21, 13 }, 48, Pitch::up12deg },
-            { { 24, -22, 13 }, 48, Pitch::up12deg },
-            { { 24, -23, 13 }, 48, Pitch::up12deg },
-            { { 24, -24, 13 }, 48, Pitch::up12deg },
-            { { 24, -25, 14 }, 48, Pitch::up12deg },
-            { { 24, -26, 14 }, 48, Pitch::up12deg },
-            { { 24, -27, 14 }, 48, Pitch::up12deg },
-            { { 24, -28, 14 }, 48, Pitch::up12deg },
-            { { 24, -29, 15 }, 48, Pitch::up12deg },
-            { { 24, -30, 15 }, 48, Pitch::up12deg },
-            { { 24, -31, 15 }, 48, Pitch::up12deg },
-            { { 24, -32, 15 }, 48, Pitch::up12deg },
-        });
-
-    // 0x4ecaaa
-    // Turnaround 0. Lane 0. Track 5. Reversed 1. Direction 0
-    static constexpr auto moveInfoTA0L0T5R1D0 = std::to_array<MoveInfo>(
-        {
-            { { 0, 24, 0 }, 32, Pitch::down12deg },
-            { { 1, 24, 0 }, 32, Pitch::down12deg },
-            { { 2, 24, 0 }, 32, Pitch::down12deg },
-            { { 3, 24, 0 }, 32, Pitch::down12deg },
-            { { 4, 24, -1 }, 32, Pitch::down12deg },
-            { { 5, 24, -1 }, 32, Pitch::down12deg },
-            { { 6, 24, -1 }, 32, Pitch::down12deg },
-            { { 7, 24, -1 }, 32, Pitch::down12deg },
-            { { 8, 24, -2 }, 32, Pitch::down12deg },
-            { { 9, 24, -2 }, 32, Pitch::down12deg },
-            { { 10, 24, -2 }, 32, Pitch::down12deg },
-            { { 11, 24, -2 }, 32, Pitch::down12deg },
-            { { 12, 24, -3 }, 32, Pitch::down12deg },
-            { { 13, 24, -3 }, 32, Pitch::down12deg },
-            { { 14, 24, -3 }, 32, Pitch::down12deg },
-            { { 15, 24, -3 }, 32, Pitch::down12deg },
-            { { 16, 24, -4 }, 32, Pitch::down12deg },
-            { { 17, 24, -4 }, 32, Pitch::down12deg },
-            { { 18, 24, -4 }, 32, Pitch::down12deg },
-            { { 19, 24, -4 }, 32, Pitch::down12deg },
-            { { 20, 24, -5 }, 32, Pitch::down12deg },
-            { { 21, 24, -5 }, 32, Pitch::down12deg },
-            { { 22, 24, -5 }, 32, Pitch::down12deg },
-            { { 23, 24, -5 }, 32, Pitch::down12deg },
-            { { 24, 24, -6 }, 32, Pitch::down12deg },
-            { { 25, 24, -6 }, 32, Pitch::down12deg },
-            { { 26, 24, -6 }, 32, Pitch::down12deg },
-            { { 27, 24, -6 }, 32, Pitch::down12deg },
-            { { 28, 24, -7 }, 32, Pitch::down12deg },
-            { { 29, 24, -7 }, 32, Pitch::down12deg },
-            { { 30, 24, -7 }, 32, Pitch::down12deg },
-            { { 31, 24, -7 }, 32, Pitch::down12deg },
-            { { 32, 24, -8 }, 32, Pitch::down12deg },
-            { { 33, 24, -8 }, 32, Pitch::down12deg },
-            { { 34, 24, -8 }, 32, Pitch::down12deg },
-            { { 35, 24, -8 }, 32, Pitch::down12deg },
-            { { 36, 24, -9 }, 32, Pitch::down12deg },
-            { { 37, 24, -9 }, 32, Pitch::down12deg },
-            { { 38, 24, -9 }, 32, Pitch::down12deg },
-            { { 39, 24, -9 }, 32, Pitch::down12deg },
-            { { 40, 24, -10 }, 32, Pitch::down12deg },
-            { { 41, 24, -10 }, 32, Pitch::down12deg },
-            { { 42, 24, -10 }, 32, Pitch::down12deg },
-            { { 43, 24, -10 }, 32, Pitch::down12deg },
-            { { 44, 24, -11 }, 32, Pitch::down12deg },
-            { { 45, 24, -11 }, 32, Pitch::down12deg },
-            { { 46, 24, -11 }, 32, Pitch::down12deg },
-            { { 47, 24, -11 }, 32, Pitch::down12deg },
-            { { 48, 24, -12 }, 32, Pitch::down12deg },
-            { { 49, 24, -12 }, 32, Pitch::down12deg },
-            { { 50, 24, -12 }, 32, Pitch::down12deg },
-            { { 51, 24, -12 }, 32, Pitch::down12deg },
-            { { 52, 24, -13 }, 32, Pitch::down12deg },
-            { { 53, 24, -13 }, 32, Pitch::down12deg },
-            { { 54, 24, -13 }, 32, Pitch::down12deg },
-            { { 55, 24, -13 }, 32, Pitch::down12deg },
-            { { 56, 24, -14 }, 32, Pitch::down12deg },
-            { { 57, 24, -14 }, 32, Pitch::down12deg },
-            { { 58, 24, -14 }, 32, Pitch::down12deg },
-            { { 59, 24, -14 }, 32, Pitch::down12deg },
-            { { 60, 24, -15 }, 32, Pitch::down12deg },
-            { { 61, 24, -15 }, 32, Pitch::down12deg },
-            { { 62, 24, -15 }, 32, Pitch::down12deg },
-            { { 63, 24, -15 }, 32, Pitch::down12deg },
-        });
-
-    // 0x4eccac
-    // Turnaround 0. Lane 0. Track 5. Reversed 1. Direction 1
-    static constexpr auto moveInfoTA0L0T5R1D1 = std::to_array<MoveInfo>(
-        {
-            { { 24, 31, 0 }, 48, Pitch::down12deg },
-            { { 24, 30, 0 }, 48, Pitch::down12deg },
-            { { 24, 29, 0 }, 48, Pitch::down12deg },
-            { { 24, 28, 0 }, 48, Pitch::down12deg },
-            { { 24, 27, -1 }, 48, Pitch::down12deg },
-            { { 24, 26, -1 }, 48, Pitch::down12deg },
-            { { 24, 25, -1 }, 48, Pitch::down12deg },
-            { { 24, 24, -1 }, 48, Pitch::down12deg },
-            { { 24, 23, -2 }, 48, Pitch::down12deg },
-            { { 24, 22, -2 }, 48, Pitch::down12deg },
-            { { 24, 21, -2 }, 48, Pitch::down12deg },
-            { { 24, 20, -2 }, 48, Pitch::down12deg },
-            { { 24, 19, -3 }, 48, Pitch::down12deg },
-            { { 24, 18, -3 }, 48, Pitch::down12deg },
-            { { 24, 17, -3 }, 48, Pitch::down12deg },
-            { { 24, 16, -3 }, 48, Pitch::down12deg },
-            { { 24, 15, -4 }, 48, Pitch::down12deg },
-            { { 24, 14, -4 }, 48, Pitch::down12deg },
-            { { 24, 13, -4 }, 48, Pitch::down12deg },
-            { { 24, 12, -4 }, 48, Pitch::down12deg },
-            { { 24, 11, -5 }, 48, Pitch::down12deg },
-            { { 24, 10, -5 }, 48, Pitch::down12deg },
-            { { 24, 9, -5 }, 48, Pitch::down12deg },
-            { { 24, 8, -5 }, 48, Pitch::down12deg },
-            { { 24, 7, -6 }, 48, Pitch::down12deg },
-            { { 24, 6, -6 }, 48, Pitch::down12deg },
-            { { 24, 5, -6 }, 48, Pitch::down12deg },
-            { { 24, 4, -6 }, 48, Pitch::down12deg },
-            { { 24, 3, -7 }, 48, Pitch::down12deg },
-            { { 24, 2, -7 }, 48, Pitch::down12deg },
-            { { 24, 1, -7 }, 48, Pitch::down12deg },
-            { { 24, 0, -7 }, 48, Pitch::down12deg },
-            { { 24, -1, -8 }, 48, Pitch::down12deg },
-            { { 24, -2, -8 }, 48, Pitch::down12deg },
-            { { 24, -3, -8 }, 48, Pitch::down12deg },
-            { { 24, -4, -8 }, 48, Pitch::down12deg },
-            { { 24, -5, -9 }, 48, Pitch::down12deg },
-            { { 24, -6, -9 }, 48, Pitch::down12deg },
-            { { 24, -7, -9 }, 48, Pitch::down12deg },
-            { { 24, -8, -9 }, 48, Pitch::down12deg },
-            { { 24, -9, -10 }, 48, Pitch::down12deg },
-            { { 24, -10, -10 }, 48, Pitch::down12deg },
-            { { 24, -11, -10 }, 48, Pitch::down12deg },
-            { { 24, -12, -10 }, 48, Pitch::down12deg },
-            { { 24, -13, -11 }, 48, Pitch::down12deg },
-            { { 24, -14, -11 }, 48, Pitch::down12deg },
-            { { 24, -15, -11 }, 48, Pitch::down12deg },
-            { { 24, -16, -11 }, 48, Pitch::down12deg },
-            { { 24, -17, -12 }, 48, Pitch::down12deg },
-            { { 24, -18, -12 }, 48, Pitch::down12deg },
-            { { 24, -19, -12 }, 48, Pitch::down12deg },
-            { { 24, -20, -12 }, 48, Pitch::down12deg },
-            { { 24, -21, -13 }, 48, Pitch::down12deg },
-            { { 24, -22, -13 }, 48, Pitch::down12deg },
-            { { 24, -23, -13 }, 48, Pitch::down12deg },
-            { { 24, -24, -13 }, 48, Pitch::down12deg },
-            { { 24, -25, -14 }, 48, Pitch::down12deg },
-            { { 24, -26, -14 }, 48, Pitch::down12deg },
-            { { 24, -27, -14 }, 48, Pitch::down12deg },
-            { { 24, -28, -14 }, 48, Pitch::down12deg },
-            { { 24, -29, -15 }, 48, Pitch::down12deg },
-            { { 24, -30, -15 }, 48, Pitch::down12deg },
-            { { 24, -31, -15 }, 48, Pitch::down12deg },
-            { { 24, -32, -15 }, 48, Pitch::down12deg },
-        });
-
-    // 0x4ec6a6
-    // Turnaround 0. Lane 0. Track 5. Reversed 1. Direction 2
-    static constexpr auto moveInfoTA0L0T5R1D2 = std::to_array<MoveInfo>(
-        {
-            { { 31, 8, 0 }, 0, Pitch::down12deg },
-            { { 30, 8, 0 }, 0, Pitch::down12deg },
-            { { 29, 8, 0 }, 0, Pitch::down12deg },
-            { { 28, 8, 0 }, 0, Pitch::down12deg },
-            { { 27, 8, -1 }, 0, Pitch::down12deg },
-            { { 26, 8, -1 }, 0, Pitch::down12deg },
-            { { 25, 8, -1 }, 0, Pitch::down12deg },
-            { { 24, 8, -1 }, 0, Pitch::down12deg },
-            { { 23, 8, -2 }, 0, Pitch::down12deg },
-            { { 22, 8, -2 }, 0, Pitch::down12deg },
-            { { 21, 8, -2 }, 0, Pitch::down12deg },
-            { { 20, 8, -2 }, 0, Pitch::down12deg },
-            { { 19, 8, -3 }, 0, Pitch::down12deg },
-            { { 18, 8, -3 }, 0, Pitch::down12deg },
-            { { 17, 8, -3 }, 0, Pitch::down12deg },
-            { { 16, 8, -3 }, 0, Pitch::down12deg },
-            { { 15, 8, -4 }, 0, Pitch::down12deg },
-            { { 14, 8, -4 }, 0, Pitch::down12deg },
-            { { 13, 8, -4 }, 0, Pitch::down12deg },
-            { { 12, 8, -4 }, 0, Pitch::down12deg },
-            { { 11, 8, -5 }, 0, Pitch::down12deg },
-            { { 10, 8, -5 }, 0, Pitch::down12deg },
-            { { 9, 8, -5 }, 0, Pitch::down12deg },
-            { { 8, 8, -5 }, 0, Pitch::down12deg },
-            { { 7, 8, -6 }, 0, Pitch::down12deg },
-            { { 6, 8, -6 }, 0, Pitch::down12deg },
-            { { 5, 8, -6 }, 0, Pitch::down12deg },
-            { { 4, 8, -6 }, 0, Pitch::down12deg },
-            { { 3, 8, -7 }, 0, Pitch::down12deg },
-            { { 2, 8, -7 }, 0, Pitch::down12deg },
-            { { 1, 8, -7 }, 0, Pitch::down12deg },
-            { { 0, 8, -7 }, 0, Pitch::down12deg },
-            { { -1, 8, -8 }, 0, Pitch::down12deg },
-            { { -2, 8, -8 }, 0, Pitch::down12deg },
-            { { -3, 8, -8 }, 0, Pitch::down12deg },
-            { { -4, 8, -8 }, 0, Pitch::down12deg },
-            { { -5, 8, -9 }, 0, Pitch::down12deg },
-            { { -6, 8, -9 }, 0, Pitch::down12deg },
-            { { -7, 8, -9 }, 0, Pitch::down12deg },
-            { { -8, 8, -9 }, 0, Pitch::down12deg },
-            { { -9, 8, -10 }, 0, Pitch::down12deg },
-            { { -10, 8, -10 }, 0, Pitch::down12deg },
-            { { -11, 8, -10 }, 0, Pitch::down12deg },
-            { { -12, 8, -10 }, 0, Pitch::down12deg },
-            { { -13, 8, -11 }, 0, Pitch::down12deg },
-            { { -14, 8, -11 }, 0, Pitch::down12deg },
-            { { -15, 8, -11 }, 0, Pitch::down12deg },
-            { { -16, 8, -11 }, 0, Pitch::down12deg },
-            { { -17, 8, -12 }, 0, Pitch::down12deg },
-            { { -18, 8, -12 }, 0, Pitch::down12deg },
-            { { -19, 8, -12 }, 0, Pitch::down12deg },
-            { { -20, 8, -12 }, 0, Pitch::down12deg },
-            { { -21, 8, -13 }, 0, Pitch::down12deg },
-            { { -22, 8, -13 }, 0, Pitch::down12deg },
-            { { -23, 8, -13 }, 0, Pitch::down12deg },
-            { { -24, 8, -13 }, 0, Pitch::down12deg },
-            { { -25, 8, -14 }, 0, Pitch::down12deg },
-            { { -26, 8, -14 }, 0, Pitch::down12deg },
-            { { -27, 8, -14 }, 0, Pitch::down12deg },
-            { { -28, 8, -14 }, 0, Pitch::down12deg },
-            { { -29, 8, -15 }, 0, Pitch::down12deg },
-            { { -30, 8, -15 }, 0, Pitch::down12deg },
-            { { -31, 8, -15 }, 0, Pitch::down12deg },
-            { { -32, 8, -15 }, 0, Pitch::down12deg },
-        });
-
-    // 0x4ec8a8
-    // Turnaround 0. Lane 0. Track 5. Reversed 1. Direction 3
-    static constexpr auto moveInfoTA0L0T5R1D3 = std::to_array<MoveInfo>(
-        {
-            { { 8, 0, 0 }, 16, Pitch::down12deg },
-            { { 8, 1, 0 }, 16, Pitch::down12deg },
-            { { 8, 2, 0 }, 16, Pitch::down12deg },
-            { { 8, 3, 0 }, 16, Pitch::down12deg },
-            { { 8, 4, -1 }, 16, Pitch::down12deg },
-            { { 8, 5, -1 }, 16, Pitch::down12deg },
-            { { 8, 6, -1 }, 16, Pitch::down12deg },
-            { { 8, 7, -1 }, 16, Pitch::down12deg },
-            { { 8, 8, -2 }, 16, Pitch::down12deg },
-            { { 8, 9, -2 }, 16, Pitch::down12deg },
-            { { 8, 10, -2 }, 16, Pitch::down12deg },
-            { { 8, 11, -2 }, 16, Pitch::down12deg },
-            { { 8, 12, -3 }, 16, Pitch::down12deg },
-            { { 8, 13, -3 }, 16, Pitch::down12deg },
-            { { 8, 14, -3 }, 16, Pitch::down12deg },
-            { { 8, 15, -3 }, 16, Pitch::down12deg },
-            { { 8, 16, -4 }, 16, Pitch::down12deg },
-            { { 8, 17, -4 }, 16, Pitch::down12deg },
-            { { 8, 18, -4 }, 16, Pitch::down12deg },
-            { { 8, 19, -4 }, 16, Pitch::down12deg },
-            { { 8, 20, -5 }, 16, Pitch::down12deg },
-            { { 8, 21, -5 }, 16, Pitch::down12deg },
-            { { 8, 22, -5 }, 16, Pitch::down12deg },
-            { { 8, 23, -5 }, 16, Pitch::down12deg },
-            { { 8, 24, -6 }, 16, Pitch::down12deg },
-            { { 8, 25, -6 }, 16, Pitch::down12deg },
-            { { 8, 26, -6 }, 16, Pitch::down12deg },
-            { { 8, 27, -6 }, 16, Pitch::down12deg },
-            { { 8, 28, -7 }, 16, Pitch::down12deg },
-            { { 8, 29, -7 }, 16, Pitch::down12deg },
-            { { 8, 30, -7 }, 16, Pitch::down12deg },
-            { { 8, 31, -7 }, 16, Pitch::down12deg },
-            { { 8, 32, -8 }, 16, Pitch::down12deg },
-            { { 8, 33, -8 }, 16, Pitch::down12deg },
-            { { 8, 34, -8 }, 16, Pitch::down12deg },
-            { { 8, 35, -8 }, 16, Pitch::down12deg },
-            { { 8, 36, -9 }, 16, Pitch::down12deg },
-            { { 8, 37, -9 }, 16, Pitch::down12deg },
-            { { 8, 38, -9 }, 16, Pitch::down12deg },
-            { { 8, 39, -9 }, 16, Pitch::down12deg },
-            { { 8, 40, -10 }, 16, Pitch::down12deg },
-            { { 8, 41, -10 }, 16, Pitch::down12deg },
-            { { 8, 42, -10 }, 16, Pitch::down12deg },
-            { { 8, 43, -10 }, 16, Pitch::down12deg },
-            { { 8, 44, -11 }, 16, Pitch::down12deg },
-            { { 8, 45, -11 }, 16, Pitch::down12deg },
-            { { 8, 46, -11 }, 16, Pitch::down12deg },
-            { { 8, 47, -11 }, 16, Pitch::down12deg },
-            { { 8, 48, -12 }, 16, Pitch::down12deg },
-            { { 8, 49, -12 }, 16, Pitch::down12deg },
-            { { 8, 50, -12 }, 16, Pitch::down12deg },
-            { { 8, 51, -12 }, 16, Pitch::down12deg },
-            { { 8, 52, -13 }, 16, Pitch::down12deg },
-            { { 8, 53, -13 }, 16, Pitch::down12deg },
-            { { 8, 54, -13 }, 16, Pitch::down12deg },
-            { { 8, 55, -13 }, 16, Pitch::down12deg },
-            { { 8, 56, -14 }, 16, Pitch::down12deg },
-            { { 8, 57, -14 }, 16, Pitch::down12deg },
-            { { 8, 58, -14 }, 16, Pitch::down12deg },
-            { { 8, 59, -14 }, 16, Pitch::down12deg },
-            { { 8, 60, -15 }, 16, Pitch::down12deg },
-            { { 8, 61, -15 }, 16, Pitch::down12deg },
-            { { 8, 62, -15 }, 16, Pitch::down12deg },
-            { { 8, 63, -15 }, 16, Pitch::down12deg },
-        });
-
-    // 0x4dcd66
-    // Turnaround 0. Lane 0. Track 7. Reversed 0. Direction 0
-    static constexpr auto moveInfoTA0L0T7R0D0 = std::to_array<MoveInfo>(
-        {
-            { { 31, 8, 0 }, 0, Pitch::up25deg },
-            { { 30, 8, 0 }, 0, Pitch::up25deg },
-            { { 29, 8, 1 }, 0, Pitch::up25deg },
-            { { 28, 8, 1 }, 0, Pitch::up25deg },
-            { { 27, 8, 2 }, 0, Pitch::up25deg },
-            { { 26, 8, 2 }, 0, Pitch::up25deg },
-            { { 25, 8, 3 }, 0, Pitch::up25deg },
-            { { 24, 8, 3 }, 0, Pitch::up25deg },
-            { { 23, 8, 4 }, 0, Pitch::up25deg },
-            { { 22, 8, 4 }, 0, Pitch::up25deg },
-            { { 21, 8, 5 }, 0, Pitch::up25deg },
-            { { 20, 8, 5 }, 0, Pitch::up25deg },
-            { { 19, 8, 6 }, 0, Pitch::up25deg },
-            { { 18, 8, 6 }, 0, Pitch::up25deg },
-            { { 17, 8, 7 }, 0, Pitch::up25deg },
-            { { 16, 8, 7 }, 0, Pitch::up25deg },
-            { { 15, 8, 8 }, 0, Pitch::up25deg },
-            { { 14, 8, 8 }, 0, Pitch::up25deg },
-            { { 13, 8, 9 }, 0, Pitch::up25deg },
-            { { 12, 8, 9 }, 0, Pitch::up25deg },
-            { { 11, 8, 10 }, 0, Pitch::up25deg },
-            { { 10, 8, 10 }, 0, Pitch::up25deg },
-            { { 9, 8, 11 }, 0, Pitch::up25deg },
-            { { 8, 8, 11 }, 0, Pitch::up25deg },
-            { { 7, 8, 12 }, 0, Pitch::up25deg },
-            { { 6, 8, 12 }, 0, Pitch::up25deg },
-            { { 5, 8, 13 }, 0, Pitch::up25deg },
-            { { 4, 8, 13 }, 0, Pitch::up25deg },
-            { { 3, 8, 14 }, 0, Pitch::up25deg },
-            { { 2, 8, 14 }, 0, Pitch::up25deg },
-            { { 1, 8, 15 }, 0, Pitch::up25deg },
-            { { 0, 8, 15 }, 0, Pitch::up25deg },
-        });
-
-    // 0x4dce68
-    // Turnaround 0. Lane 0. Track 7. Reversed 0. Direction 1
-    static constexpr auto moveInfoTA0L0T7R0D1 = std::to_array<MoveInfo>(
-        {
-            { { 8, 0, 0 }, 16, Pitch::up25deg },
-            { { 8, 1, 0 }, 16, Pitch::up25deg },
-            { { 8, 2, 1 }, 16, Pitch::up25deg },
-            { { 8, 3, 1 }, 16, Pitch::up25deg },
-            { { 8, 4, 2 }, 16, Pitch::up25deg },
-            { { 8, 5, 2 }, 16, Pitch::up25deg },
-            { { 8, 6, 3 }, 16, Pitch::up25deg },
-            { { 8, 7, 3 }, 16, Pitch::up25deg },
-            { { 8, 8, 4 }, 16, Pitch::up25deg },
-            { { 8, 9, 4 }, 16, Pitch::up25deg },
-            { { 8, 10, 5 }, 16, Pitch::up25deg },
-            { { 8, 11, 5 }, 16, Pitch::up25deg },
-            { { 8, 12, 6 }, 16, Pitch::up25deg },
-            { { 8, 13, 6 }, 16, Pitch::up25deg },
-            { { 8, 14, 7 }, 16, Pitch::up25deg },
-            { { 8, 15, 7 }, 16, Pitch::up25deg },
-            { { 8, 16, 8 }, 16, Pitch::up25deg },
-            { { 8, 17, 8 }, 16, Pitch::up25deg },
-            { { 8, 18, 9 }, 16, Pitch::up25deg },
-            { { 8, 19, 9 }, 16, Pitch::up25deg },
-            { { 8, 20, 10 }, 16, Pitch::up25deg },
-            { { 8, 21, 10 }, 16, Pitch::up25deg },
-            { { 8, 22, 11 }, 16, Pitch::up25deg },
-            { { 8, 23, 11 }, 16, Pitch::up25deg },
-            { { 8, 24, 12 }, 16, Pitch::up25deg },
-            { { 8, 25, 12 }, 16, Pitch::up25deg },
-            { { 8, 26, 13 }, 16, Pitch::up25deg },
-            { { 8, 27, 13 }, 16, Pitch::up25deg },
-            { { 8, 28, 14 }, 16, Pitch::up25deg },
-            { { 8, 29, 14 }, 16, Pitch::up25deg },
-            { { 8, 30, 15 }, 16, Pitch::up25deg },
-            { { 8, 31, 15 }, 16, Pitch::up25deg },
-        });
-
-    // 0x4dcf6a
-    // Turnaround 0. Lane 0. Track 7. Reversed 0. Direction 2
-    static constexpr auto moveInfoTA0L0T7R0D2 = std::to_array<MoveInfo>(
-        {
-            { { 0, 24, 0 }, 32, Pitch::up25deg },
-            { { 1, 24, 0 }, 32, Pitch::up25deg },
-            { { 2, 24, 1 }, 32, Pitch::up25deg },
-            { { 3, 24, 1 }, 32, Pitch::up25deg },
-            { { 4, 24, 2 }, 32, Pitch::up25deg },
-            { { 5, 24, 2 }, 32, Pitch::up25deg },
-            { { 6, 24, 3 }, 32, Pitch::up25deg },
-            { { 7, 24, 3 }, 32, Pitch::up25deg },
-            { { 8, 24, 4 }, 32, Pitch::up25deg },
-            { { 9, 24, 4 }, 32, Pitch::up25deg },
-            { { 10, 24, 5 }, 32, Pitch::up25deg },
-            { { 11, 24, 5 }, 32, Pitch::up25deg },
-            { { 12, 24, 6 }, 32, Pitch::up25deg },
-            { { 13, 24, 6 }, 32, Pitch::up25deg },
-            { { 14, 24, 7 }, 32, Pitch::up25deg },
-            { { 15, 24, 7 }, 32, Pitch::up25deg },
-            { { 16, 24, 8 }, 32, Pitch::up25deg },
-            { { 17, 24, 8 }, 32, Pitch::up25deg },
-            { { 18, 24, 9 }, 32, Pitch::up25deg },
-            { { 19, 24, 9 }, 32, Pitch::up25deg },
-            { { 20, 24, 10 }, 32, Pitch::up25deg },
-            { { 21, 24, 10 }, 32, Pitch::up25deg },
-            { { 22, 24, 11 }, 32, Pitch::up25deg },
-            { { 23, 24, 11 }, 32, Pitch::up25deg },
-            { { 24, 24, 12 }, 32, Pitch::up25deg },
-            { { 25, 24, 12 }, 32, Pitch::up25deg },
-            { { 26, 24, 13 }, 32, Pitch::up25deg },
-            { { 27, 24, 13 }, 32, Pitch::up25deg },
-            { { 28, 24, 14 }, 32, Pitch::up25deg },
-            { { 29, 24, 14 }, 32, Pitch::up25deg },
-            { { 30, 24, 15 }, 32, Pitch::up25deg },
-            { { 31, 24, 15 }, 32, Pitch::up25deg },
-        });
-
-    // 0x4dd06c
-    // Turnaround 0. Lane 0. Track 7. Reversed 0. Direction 3
-    static constexpr auto moveInfoTA0L0T7R0D3 = std::to_array<MoveInfo>(
-        {
-            { { 24, 31, 0 }, 48, Pitch::up25deg },
-            { { 24, 30, 0 }, 48, Pitch::up25deg },
-            { { 24, 29, 1 }, 48, Pitch::up25deg },
-            { { 24, 28, 1 }, 48, Pitch::up25deg },
-            { { 24, 27, 2 }, 48, Pitch::up25deg },
-            { { 24, 26, 2 }, 48, Pitch::up25deg },
-            { { 24, 25, 3 }, 48, Pitch::up25deg },
-            { { 24, 24, 3 }, 48, Pitch::up25deg },
-            { { 24, 23, 4 }, 48, Pitch::up25deg },
-            { { 24, 22, 4 }, 48, Pitch::up25deg },
-            { { 24, 21, 5 }, 48, Pitch::up25deg },
-            { { 24, 20, 5 }, 48, Pitch::up25deg },
-            { { 24, 19, 6 }, 48, Pitch::up25deg },
-            { { 24, 18, 6 }, 48, Pitch::up25deg },
-            { { 24, 17, 7 }, 48, Pitch::up25deg },
-            { { 24, 16, 7 }, 48, Pitch::up25deg },
-            { { 24, 15, 8 }, 48, Pitch::up25deg },
-            { { 24, 14, 8 }, 48, Pitch::up25deg },
-            { { 24, 13, 9 }, 48, Pitch::up25deg },
-            { { 24, 12, 9 }, 48, Pitch::up25deg },
-            { { 24, 11, 10 }, 48, Pitch::up25deg },
-            { { 24, 10, 10 }, 48, Pitch::up25deg },
-            { { 24, 9, 11 }, 48, Pitch::up25deg },
-            { { 24, 8, 11 }, 48, Pitch::up25deg },
-            { { 24, 7, 12 }, 48, Pitch::up25deg },
-            { { 24, 6, 12 }, 48, Pitch::up25deg },
-            { { 24, 5, 13 }, 48, Pitch::up25deg },
-            { { 24, 4, 13 }, 48, Pitch::up25deg },
-            { { 24, 3, 14 }, 48, Pitch::up25deg },
-            { { 24, 2, 14 }, 48, Pitch::up25deg },
-            { { 24, 1, 15 }, 48, Pitch::up25deg },
-            { { 24, 0, 15 }, 48, Pitch::up25deg },
-        });
-
-    // 0x4dd372
-    // Turnaround 0. Lane 0. Track 7. Reversed 1. Direction 0
-    static constexpr auto moveInfoTA0L0T7R1D0 = std::to_array<MoveInfo>(
-        {
-            { { 0, 24, 0 }, 32, Pitch::down25deg },
-            { { 1, 24, 0 }, 32, Pitch::down25deg },
-            { { 2, 24, -1 }, 32, Pitch::down25deg },
-            { { 3, 24, -1 }, 32, Pitch::down25deg },
-            { { 4, 24, -2 }, 32, Pitch::down25deg },
-            { { 5, 24, -2 }, 32, Pitch::down25deg },
-            { { 6, 24, -3 }, 32, Pitch::down25deg },
-            { { 7, 24, -3 }, 32, Pitch::down25deg },
-            { { 8, 24, -4 }, 32, Pitch::down25deg },
-            { { 9, 24, -4 }, 32, Pitch::down25deg },
-            { { 10, 24, -5 }, 32, Pitch::down25deg },
-            { { 11, 24, -5 }, 32, Pitch::down25deg },
-            { { 12, 24, -6 }, 32, Pitch::down25deg },
-            { { 13, 24, -6 }, 32, Pitch::down25deg },
-            { { 14, 24, -7 }, 32, Pitch::down25deg },
-            { { 15, 24, -7 }, 32, Pitch::down25deg },
-            { { 16, 24, -8 }, 32, Pitch::down25deg },
-            { { 17, 24, -8 }, 32, Pitch::down25deg },
-            { { 18, 24, -9 }, 32, Pitch::down25deg },
-            { { 19, 24, -9 }, 32, Pitch::down25deg },
-            { { 20, 24, -10 }, 32, Pitch::down25deg },
-            { { 21, 24, -10 }, 32, Pitch::down25deg },
-            { { 22, 24, -11 }, 32, Pitch::down25deg },
-            { { 23, 24, -11 }, 32, Pitch::down25deg },
-            { { 24, 24, -12 }, 32, Pitch::down25deg },
-            { { 25, 24, -12 }, 32, Pitch::down25deg },
-            { { 26, 24, -13 }, 32, Pitch::down25deg },
-            { { 27, 24, -13 }, 32, Pitch::down25deg },
-            { { 28, 24, -14 }, 32, Pitch::down25deg },
-            { { 29, 24, -14 }, 32, Pitch::down25deg },
-            { { 30, 24, -15 }, 32, Pitch::down25deg },
-            { { 31, 24, -15 }, 32, Pitch::down25deg },
-        });
-
-    // 0x4dd474
-    // Turnaround 0. Lane 0. Track 7. Reversed 1. Direction 1
-    static constexpr auto moveInfoTA0L0T7R1D1 = std::to_array<MoveInfo>(
-        {
-            { { 24, 31, 0 }, 48, Pitch::down25deg },
-            { { 24, 30, 0 }, 48, Pitch::down25deg },
-            { { 24, 29, -1 }, 48, Pitch::down25deg },
-            { { 24, 28, -1 }, 48, Pitch::down25deg },
-            { { 24, 27, -2 }, 48, Pitch::down25deg },
-            { { 24, 26, -2 }, 48, Pitch::down25deg },
-            { { 24, 25, -3 }, 48, Pitch::down25deg },
-            { { 24, 24, -3 }, 48, Pitch::down25deg },
-            { { 24, 23, -4 }, 48, Pitch::down25deg },
-            { { 24, 22, -4 }, 48, Pitch::down25deg },
-            { { 24, 21, -5 }, 48, Pitch::down25deg },
-            { { 24, 20, -5 }, 48, Pitch::down25deg },
-            { { 24, 19, -6 }, 48, Pitch::down25deg },
-            { { 24, 18, -6 }, 48, Pitch::down25deg },
-            { { 24, 17, -7 }, 48, Pitch::down25deg },
-            { { 24, 16, -7 }, 48, Pitch::down25deg },
-            { { 24, 15, -8 }, 48, Pitch::down25deg },
-            { { 24, 14, -8 }, 48, Pitch::down25deg },
-            { { 24, 13, -9 }, 48, Pitch::down25deg },
-            { { 24, 12, -9 }, 48, Pitch::down25deg },
-            { { 24, 11, -10 }, 48, Pitch::down25deg },
-            { { 24, 10, -10 }, 48, Pitch::down25deg },
-            { { 24, 9, -11 }, 48, Pitch::down25deg },
-            { { 24, 8, -11 }, 48, Pitch::down25deg },
-            { { 24, 7, -12 }, 48, Pitch::down25deg },
-            { { 24, 6, -12 }, 48, Pitch::down25deg },
-            { { 24, 5, -13 }, 48, Pitch::down25deg },
-            { { 24, 4, -13 }, 48, Pitch::down25deg },
-            { { 24, 3, -14 }, 48, Pitch::down25deg },
-            { { 24, 2, -14 }, 48, Pitch::down25deg },
-            { { 24, 1, -15 }, 48, Pitch::down25deg },
-            { { 24, 0, -15 }, 48, Pitch::down25deg },
-        });
-
-    // 0x4dd16e
-    // Turnaround 0. Lane 0. Track 7. Reversed 1. Direction 2
-    static constexpr auto moveInfoTA0L0T7R1D2 = std::to_array<MoveInfo>(
-        {
-            { { 31, 8, 0 }, 0, Pitch::down25deg },
-            { { 30, 8, 0 }, 0, Pitch::down25deg },
-            { { 29, 8, -1 }, 0, Pitch::down25deg },
-            { { 28, 8, -1 }, 0, Pitch::down25deg },
-            { { 27, 8, -2 }, 0, Pitch::down25deg },
-            { { 26, 8, -2 }, 0, Pitch::down25deg },
-            { { 25, 8, -3 }, 0, Pitch::down25deg },
-            { { 24, 8, -3 }, 0, Pitch::down25deg },
-            { { 23, 8, -4 }, 0, Pitch::down25deg },
-            { { 22, 8, -4 }, 0, Pitch::down25deg },
-            { { 21, 8, -5 }, 0, Pitch::down25deg },
-            { { 20, 8, -5 }, 0, Pitch::down25deg },
-            { { 19, 8, -6 }, 0, Pitch::down25deg },
-            { { 18, 8, -6 }, 0, Pitch::down25deg },
-            { { 17, 8, -7 }, 0, Pitch::down25deg },
-            { { 16, 8, -7 }, 0, Pitch::down25deg },
-            { { 15, 8, -8 }, 0, Pitch::down25deg },
-            { { 14, 8, -8 }, 0, Pitch::down25deg },
-            { { 13, 8, -9 }, 0, Pitch::down25deg },
-            { { 12, 8, -9 }, 0, Pitch::down25deg },
-            { { 11, 8, -10 }, 0, Pitch::down25deg },
-            { { 10, 8, -10 }, 0, Pitch::down25deg },
-            { { 9, 8, -11 }, 0, Pitch::down25deg },
-            { { 8, 8, -11 }, 0, Pitch::down25deg },
-            { { 7, 8, -12 }, 0, Pitch::down25deg },
-            { { 6, 8, -12 }, 0, Pitch::down25deg },
-            { { 5, 8, -13 }, 0, Pitch::down25deg },
-            { { 4, 8, -13 }, 0, Pitch::down25deg },
-            { { 3, 8, -14 }, 0, Pitch::down25deg },
-            { { 2, 8, -14 }, 0, Pitch::down25deg },
-            { { 1, 8, -15 }, 0, Pitch::down25deg },
-            { { 0, 8, -15 }, 0, Pitch::down25deg },
-        });
-
-    // 0x4dd270
-    // Turnaround 0. Lane 0. Track 7. Reversed 1. Direction 3
-    static constexpr auto moveInfoTA0L0T7R1D3 = std::to_array<MoveInfo>(
-        {
-            { { 8, 0, 0 }, 16, Pitch::down25deg },
-            { { 8, 1, 0 }, 16, Pitch::down25deg },
-            { { 8, 2, -1 }, 16, Pitch::down25deg },
-            { { 8, 3, -1 }, 16, Pitch::down25deg },
-            { { 8, 4, -2 }, 16, Pitch::down25deg },
-            { { 8, 5, -2 }, 16, Pitch::down25deg },
-            { { 8, 6, -3 }, 16, Pitch::down25deg },
-            { { 8, 7, -3 }, 16, Pitch::down25deg },
-            { { 8, 8, -4 }, 16, Pitch::down25deg },
-            { { 8, 9, -4 }, 16, Pitch::down25deg },
-            { { 8, 10, -5 }, 16, Pitch::down25deg },
-            { { 8, 11, -5 }, 16, Pitch::down25deg },
-            { { 8, 12, -6 }, 16, Pitch::down25deg },
-            { { 8, 13, -6 }, 16, Pitch::down25deg },
-            { { 8, 14, -7 }, 16, Pitch::down25deg },
-            { { 8, 15, -7 }, 16, Pitch::down25deg },
-            { { 8, 16, -8 }, 16, Pitch::down25deg },
-            { { 8, 17, -8 }, 16, Pitch::down25deg },
-            { { 8, 18, -9 }, 16, Pitch::down25deg },
-            { { 8, 19, -9 }, 16, Pitch::down25deg },
-            { { 8, 20, -10 }, 16, Pitch::down25deg },
-            { { 8, 21, -10 }, 16, Pitch::down25deg },
-            { { 8, 22, -11 }, 16, Pitch::down25deg },
-            { { 8, 23, -11 }, 16, Pitch::down25deg },
-            { { 8, 24, -12 }, 16, Pitch::down25deg },
-            { { 8, 25, -12 }, 16, Pitch::down25deg },
-            { { 8, 26, -13 }, 16, Pitch::down25deg },
-            { { 8, 27, -13 }, 16, Pitch::down25deg },
-            { { 8, 28, -14 }, 16, Pitch::down25deg },
-            { { 8, 29, -14 }, 16, Pitch::down25deg },
-            { { 8, 30, -15 }, 16, Pitch::down25deg },
-            { { 8, 31, -15 }, 16, Pitch::down25deg },
-        });
-
-    // 0x4deda6
-    // Turnaround 0. Lane 0. Track 9. Reversed 0. Direction 0
-    static constexpr auto moveInfoTA0L0T9R0D0 = std::to_array<MoveInfo>(
-        {
-            { { 31, 8, 0 }, 0, Pitch::flat },
-            { { 30, 8, 0 }, 0, Pitch::flat },
-            { { 29, 8, 0 }, 2, Pitch::flat },
-            { { 28, 9, 0 }, 2, Pitch::flat },
-            { { 27, 9, 0 }, 2, Pitch::flat },
-            { { 26, 10, 0 }, 4, Pitch::flat },
-            { { 25, 11, 0 }, 4, Pitch::flat },
-            { { 25, 12, 0 }, 6, Pitch::flat },
-            { { 24, 13, 0 }, 6, Pitch::flat },
-            { { 24, 14, 0 }, 6, Pitch::flat },
-            { { 24, 15, 0 }, 16, Pitch::flat },
-            { { 24, 16, 0 }, 16, Pitch::flat },
-            { { 24, 17, 0 }, 16, Pitch::flat },
-            { { 24, 18, 0 }, 18, Pitch::flat },
-            { { 24, 19, 0 }, 18, Pitch::flat },
-            { { 25, 20, 0 }, 18, Pitch::flat },
-            { { 25, 21, 0 }, 20, Pitch::flat },
-            { { 26, 22, 0 }, 20, Pitch::flat },
-            { { 27, 23, 0 }, 22, Pitch::flat },
-            { { 28, 23, 0 }, 22, Pitch::flat },
-            { { 29, 24, 0 }, 22, Pitch::flat },
-            { { 30, 24, 0 }, 32, Pitch::flat },
-            { { 31, 24, 0 }, 32, Pitch::flat },
-        });
-
-    // 0x4dee60
-    // Turnaround 0. Lane 0. Track 9. Reversed 0. Direction 1
-    static constexpr auto moveInfoTA0L0T9R0D1 = std::to_array<MoveInfo>(
-        {
-            { { 8, 0, 0 }, 16, Pitch::flat },
-            { { 8, 1, 0 }, 16, Pitch::flat },
-            { { 8, 2, 0 }, 18, Pitch::flat },
-            { { 9, 3, 0 }, 18, Pitch::flat },
-            { { 9, 4, 0 }, 18, Pitch::flat },
-            { { 10, 5, 0 }, 20, Pitch::flat },
-            { { 11, 6, 0 }, 20, Pitch::flat },
-            { { 12, 6, 0 }, 22, Pitch::flat },
-            { { 13, 7, 0 }, 22, Pitch::flat },
-            { { 14, 7, 0 }, 22, Pitch::flat },
-            { { 15, 7, 0 }, 32, Pitch::flat },
-            { { 16, 7, 0 }, 32, Pitch::flat },
-            { { 17, 7, 0 }, 32, Pitch::flat },
-            { { 18, 7, 0 }, 34, Pitch::flat },
-            { { 19, 7, 0 }, 34, Pitch::flat },
-            { { 20, 6, 0 }, 34, Pitch::flat },
-            { { 21, 6, 0 }, 36, Pitch::flat },
-            { { 22, 5, 0 }, 36, Pitch::flat },
-            { { 23, 4, 0 }, 38, Pitch::flat },
-            { { 23, 3, 0 }, 38, Pitch::flat },
-            { { 24, 2, 0 }, 38, Pitch::flat },
-            { { 24, 1, 0 }, 48, Pitch::flat },
-            { { 24, 0, 0 }, 48, Pitch::flat },
-        });
-
-    // 0x4def1a
-    // Turnaround 0. Lane 0. Track 9. Reversed 0. Direction 2
-    static constexpr auto moveInfoTA0L0T9R0D2 = std::to_array<MoveInfo>(
-        {
-            { { 0, 24, 0 }, 32, Pitch::flat },
-            { { 1, 24, 0 }, 32, Pitch::flat },
-            { { 2, 24, 0 }, 34, Pitch::flat },
-            { { 3, 23, 0 }, 34, Pitch::flat },
-            { { 4, 23, 0 }, 34, Pitch::flat },
-            { { 5, 22, 0 }, 36, Pitch::flat },
-            { { 6, 21, 0 }, 36, Pitch::flat },
-            { { 6, 20, 0 }, 38, Pitch::flat },
-            { { 7, 19, 0 }, 38, Pitch::flat },
-            { { 7, 18, 0 }, 38, Pitch::flat },
-            { { 7, 17, 0 }, 48, Pitch::flat },
-            { { 7, 16, 0 }, 48, Pitch::flat },
-            { { 7, 15, 0 }, 48, Pitch::flat },
-            { { 7, 14, 0 }, 50, Pitch::flat },
-            { { 7, 13, 0 }, 50, Pitch::flat },
-            { { 6, 12, 0 }, 50, Pitch::flat },
-            { { 6, 11, 0 }, 52, Pitch::flat },
-            { { 5, 10, 0 }, 52, Pitch::flat },
-            { { 4, 9, 0 }, 54, Pitch::flat },
-            { { 3, 9, 0 }, 54, Pitch::flat },
-            { { 2, 8, 0 }, 54, Pitch::flat },
-            { { 1, 8, 0 }, 0, Pitch::flat },
-            { { 0, 8, 0 }, 0, Pitch::flat },
-        });
-
-    // 0x4defd4
-    // Turnaround 0. Lane 0. Track 9. Reversed 0. Direction 3
-    static constexpr auto moveInfoTA0L0T9R0D3 = std::to_array<MoveInfo>(
-        {
-            { { 24, 31, 0 }, 48, Pitch::flat },
-            { { 24, 30, 0 }, 48, Pitch::flat },
-            { { 24, 29, 0 }, 50, Pitch::flat },
-            { { 23, 28, 0 }, 50, Pitch::flat },
-            { { 23, 27, 0 }, 50, Pitch::flat },
-            { { 22, 26, 0 }, 52, Pitch::flat },
-            { { 21, 25, 0 }, 52, Pitch::flat },
-            { { 20, 25, 0 }, 54, Pitch::flat },
-            { { 19, 24, 0 }, 54, Pitch::flat },
-            { { 18, 24, 0 }, 54, Pitch::flat },
-            { { 17, 24, 0 }, 0, Pitch::flat },
-            { { 16, 24, 0 }, 0, Pitch::flat },
-            { { 15, 24, 0 }, 0, Pitch::flat },
-            { { 14, 24, 0 }, 2, Pitch::flat },
-            { { 13, 24, 0 }, 2, Pitch::flat },
-            { { 12, 25, 0 }, 2, Pitch::flat },
-            { { 11, 25, 0 }, 4, Pitch::flat },
-            { { 10, 26, 0 }, 4, Pitch::flat },
-            { { 9, 27, 0 }, 6, Pitch::flat },
-            { { 9, 28, 0 }, 6, Pitch::flat },
-            { { 8, 29, 0 }, 6, Pitch::flat },
-            { { 8, 30, 0 }, 16, Pitch::flat },
-            { { 8, 31, 0 }, 16, Pitch::flat },
-        });
-
-    // 0x4dc95e
-    // Turnaround 0. Lane 1. Track 0. Reversed 0. Direction 0
-    static constexpr auto moveInfoTA0L1T0R0D0 = std::to_array<MoveInfo>(
-        {
-            { { 31, 24, 0 }, 0, Pitch::flat },
-            { { 30, 24, 0 }, 0, Pitch::flat },
-            { { 29, 24, 0 }, 0, Pitch::flat },
-            { { 28, 24, 0 }, 0, Pitch::flat },
-            { { 27, 24, 0 }, 0, Pitch::flat },
-            { { 26, 24, 0 }, 0, Pitch::flat },
-            { { 25, 24, 0 }, 0, Pitch::flat },
-            { { 24, 24, 0 }, 0, Pitch::flat },
-            { { 23, 24, 0 }, 0, Pitch::flat },
-            { { 22, 24, 0 }, 0, Pitch::flat },
-            { { 21, 24, 0 }, 0, Pitch::flat },
-            { { 20, 24, 0 }, 0, Pitch::flat },
-            { { 19, 24, 0 }, 0, Pitch::flat },
-            { { 18, 24, 0 }, 0, Pitch::flat },
-            { { 17, 24, 0 }, 0, Pitch::flat },
-            { { 16, 24, 0 }, 0, Pitch::flat },
-            { { 15, 24, 0 }, 0, Pitch::flat },
-            { { 14, 24, 0 }, 0, Pitch::flat },
-            { { 13, 24, 0 }, 0, Pitch::flat },
-            { { 12, 24, 0 }, 0, Pitch::flat },
-            { { 11, 24, 0 }, 0, Pitch::flat },
-            { { 10, 24, 0 }, 0, Pitch::flat },
-            { { 9, 24, 0 }, 0, Pitch::flat },
-            { { 8, 24, 0 }, 0, Pitch::flat },
-            { { 7, 24, 0 }, 0, Pitch::flat },
-            { { 6, 24, 0 }, 0, Pitch::flat },
-            { { 5, 24, 0 }, 0, Pitch::flat },
-            { { 4, 24, 0 }, 0, Pitch::flat },
-            { { 3, 24, 0 }, 0, Pitch::flat },
-            { { 2, 24, 0 }, 0, Pitch::flat },
-            { { 1, 24, 0 }, 0, Pitch::flat },
-            { { 0, 24, 0 }, 0, Pitch::flat },
-        });
-
-    // 0x4dca60
-    // Turnaround 0. Lane 1. Track 0. Reversed 0. Direction 1
-    static constexpr auto moveInfoTA0L1T0R0D1 = std::to_array<MoveInfo>(
-        {
-            { { 24, 0, 0 }, 16, Pitch::flat },
-            { { 24, 1, 0 }, 16, Pitch::flat },
-            { { 24, 2, 0 }, 16, Pitch::flat },
-            { { 24, 3, 0 }, 16, Pitch::flat },
-            { { 24, 4, 0 }, 16, Pitch::flat },
-            { { 24, 5, 0 }, 16, Pitch::flat },
-            { { 24, 6, 0 }, 16, Pitch::flat },
-            { { 24, 7, 0 }, 16, Pitch::flat },
-            { { 24, 8, 0 }, 16, Pitch::flat },
-            { { 24, 9, 0 }, 16, Pitch::flat },
-            { { 24, 10, 0 }, 16, Pitch::flat },
-            { { 24, 11, 0 }, 16, Pitch::flat },
-            { { 24, 12, 0 }, 16, Pitch::flat },
-            { { 24, 13, 0 }, 16, Pitch::flat },
-            { { 24, 14, 0 }, 16, Pitch::flat },
-            { { 24, 15, 0 }, 16, Pitch::flat },
-            { { 24, 16, 0 }, 16, Pitch::flat },
-            { { 24, 17, 0 }, 16, Pitch::flat },
-            { { 24, 18, 0 }, 16, Pitch::flat },
-            { { 24, 19, 0 }, 16, Pitch::flat },
-            { { 24, 20, 0 }, 16, Pitch::flat },
-            { { 24, 21, 0 }, 16, Pitch::flat },
-            { { 24, 22, 0 }, 16, Pitch::flat },
-            { { 24, 23, 0 }, 16, Pitch::flat },
-            { { 24, 24, 0 }, 16, Pitch::flat },
-            { { 24, 25, 0 }, 16, Pitch::flat },
-            { { 24, 26, 0 }, 16, Pitch::flat },
-            { { 24, 27, 0 }, 16, Pitch::flat },
-            { { 24, 28, 0 }, 16, Pitch::flat },
-            { { 24, 29, 0 }, 16, Pitch::flat },
-            { { 24, 30, 0 }, 16, Pitch::flat },
-            { { 24, 31, 0 }, 16, Pitch::flat },
-        });
-
-    // 0x4dcb62
-    // Turnaround 0. Lane 1. Track 0. Reversed 0. Direction 2
-    static constexpr auto moveInfoTA0L1T0R0D2 = std::to_array<MoveInfo>(
-        {
-            { { 0, 8, 0 }, 32, Pitch::flat },
-            { { 1, 8, 0 }, 32, Pitch::flat },
-            { { 2, 8, 0 }, 32, Pitch::flat },
-            { { 3, 8, 0 }, 32, Pitch::flat },
-            { { 4, 8, 0 }, 32, Pitch::flat },
-            { { 5, 8, 0 }, 32, Pitch::flat },
-            { { 6, 8, 0 }, 32, Pitch::flat },
-            { { 7, 8, 0 }, 32, Pitch::flat },
-            { { 8, 8, 0 }, 32, Pitch::flat },
-            { { 9, 8, 0 }, 32, Pitch::flat },
-            { { 10, 8, 0 }, 32, Pitch::flat },
-            { { 11, 8, 0 }, 32, Pitch::flat },
-            { { 12, 8, 0 }, 32, Pitch::flat },
-            { { 13, 8, 0 }, 32, Pitch::flat },
-            { { 14, 8, 0 }, 32, Pitch::flat },
-            { { 15, 8, 0 }, 32, Pitch::flat },
-            { { 16, 8, 0 }, 32, Pitch::flat },
-            { { 17, 8, 0 }, 32, Pitch::flat },
-            { { 18, 8, 0 }, 32, Pitch::flat },
-            { { 19, 8, 0 }, 32, Pitch::flat },
-            { { 20, 8, 0 }, 32, Pitch::flat },
-            { { 21, 8, 0 }, 32, Pitch::flat },
-            { { 22, 8, 0 }, 32, Pitch::flat },
-            { { 23, 8, 0 }, 32, Pitch::flat },
-            { { 24, 8, 0 }, 32, Pitch::flat },
-            { { 25, 8, 0 }, 32, Pitch::flat },
-            { { 26, 8, 0 }, 32, Pitch::flat },
-            { { 27, 8, 0 }, 32, Pitch::flat },
-            { { 28, 8, 0 }, 32, Pitch::flat },
-            { { 29, 8, 0 }, 32, Pitch::flat },
-            { { 30, 8, 0 }, 32, Pitch::flat },
-            { { 31, 8, 0 }, 32, Pitch::flat },
-        });
-
-    // 0x4dcc64
-    // Turnaround 0. Lane 1. Track 0. Reversed 0. Direction 3
-    static constexpr auto moveInfoTA0L1T0R0D3 = std::to_array<MoveInfo>(
-        {
-            { { 8, 31, 0 }, 48, Pitch::flat },
-            { { 8, 30, 0 }, 48, Pitch::flat },
-            { { 8, 29, 0 }, 48, Pitch::flat },
-            { { 8, 28, 0 }, 48, Pitch::flat },
-            { { 8, 27, 0 }, 48, Pitch::flat },
-            { { 8, 26, 0 }, 48, Pitch::flat },
-            { { 8, 25, 0 }, 48, Pitch::flat },
-            { { 8, 24, 0 }, 48, Pitch::flat },
-            { { 8, 23, 0 }, 48, Pitch::flat },
-            { { 8, 22, 0 }, 48, Pitch::flat },
-            { { 8, 21, 0 }, 48, Pitch::flat },
-            { { 8, 20, 0 }, 48, Pitch::flat },
-            { { 8, 19, 0 }, 48, Pitch::flat },
-            { { 8, 18, 0 }, 48, Pitch::flat },
-            { { 8, 17, 0 }, 48, Pitch::flat },
-            { { 8, 16, 0 }, 48, Pitch::flat },
-            { { 8, 15, 0 }, 48, Pitch::flat },
-            { { 8, 14, 0 }, 48, Pitch::flat },
-            { { 8, 13, 0 }, 48, Pitch::flat },
-            { { 8, 12, 0 }, 48, Pitch::flat },
-            { { 8, 11, 0 }, 48, Pitch::flat },
-            { { 8, 10, 0 }, 48, Pitch::flat },
-            { { 8, 9, 0 }, 48, Pitch::flat },
-            { { 8, 8, 0 }, 48, Pitch::flat },
-            { { 8, 7, 0 }, 48, Pitch::flat },
-            { { 8, 6, 0 }, 48, Pitch::flat },
-            { { 8, 5, 0 }, 48, Pitch::flat },
-            { { 8, 4, 0 }, 48, Pitch::flat },
-            { { 8, 3, 0 }, 48, Pitch::flat },
-            { { 8, 2, 0 }, 48, Pitch::flat },
-            { { 8, 1, 0 }, 48, Pitch::flat },
-            { { 8, 0, 0 }, 48, Pitch::flat },
-        });
-
-    // 0x4eb350
-    // Turnaround 0. Lane 1. Track 1. Reversed 0. Direction 0
-    static constexpr auto moveInfoTA0L1T1R0D0 = std::to_array<MoveInfo>(
-        {
-            { { 31, 24, 0 }, 0, Pitch::flat },
-            { { 30, 24, 0 }, 0, Pitch::flat },
-            { { 29, 24, 0 }, 0, Pitch::flat },
-            { { 28, 24, 0 }, 0, Pitch::flat },
-            { { 27, 23, 0 }, 62, Pitch::flat },
-            { { 26, 23, 0 }, 62, Pitch::flat },
-            { { 25, 23, 0 }, 62, Pitch::flat },
-            { { 24, 23, 0 }, 60, Pitch::flat },
-            { { 23, 22, 0 }, 60, Pitch::flat },
-            { { 22, 22, 0 }, 60, Pitch::flat },
-            { { 21, 22, 0 }, 58, Pitch::flat },
-            { { 20, 21, 0 }, 58, Pitch::flat },
-            { { 19, 21, 0 }, 58, Pitch::flat },
-            { { 18, 20, 0 }, 58, Pitch::flat },
-            { { 17, 19, 0 }, 56, Pitch::flat },
-            { { 16, 18, 0 }, 56, Pitch::flat },
-            { { 15, 17, 0 }, 56, Pitch::flat },
-            { { 14, 16, 0 }, 56, Pitch::flat },
-            { { 13, 15, 0 }, 56, Pitch::flat },
-            { { 12, 14, 0 }, 54, Pitch::flat },
-            { { 11, 13, 0 }, 54, Pitch::flat },
-            { { 11, 12, 0 }, 54, Pitch::flat },
-            { { 10, 11, 0 }, 54, Pitch::flat },
-            { { 10, 10, 0 }, 52, Pitch::flat },
-            { { 10, 9, 0 }, 52, Pitch::flat },
-            { { 9, 8, 0 }, 52, Pitch::flat },
-            { { 9, 7, 0 }, 50, Pitch::flat },
-            { { 9, 6, 0 }, 50, Pitch::flat },
-            { { 9, 5, 0 }, 50, Pitch::flat },
-            { { 8, 4, 0 }, 48, Pitch::flat },
-            { { 8, 3, 0 }, 48, Pitch::flat },
-            { { 8, 2, 0 }, 48, Pitch::flat },
-            { { 8, 1, 0 }, 48, Pitch::flat },
-            { { 8, 0, 0 }, 48, Pitch::flat },
-        });
-
-    // 0x4eb462
-    // Turnaround 0. Lane 1. Track 1. Reversed 0. Direction 1
-    static constexpr auto moveInfoTA0L1T1R0D1 = std::to_array<MoveInfo>(
-        {
-            { { 24, 0, 0 }, 16, Pitch::flat },
-            { { 24, 1, 0 }, 16, Pitch::flat },
-            { { 24, 2, 0 }, 16, Pitch::flat },
-            { { 24, 3, 0 }, 16, Pitch::flat },
-            { { 24, 4, 0 }, 16, Pitch::flat },
-            { { 23, 5, 0 }, 14, Pitch::flat },
-            { { 23, 6, 0 }, 14, Pitch::flat },
-            { { 23, 7, 0 }, 14, Pitch::flat },
-            { { 23, 8, 0 }, 12, Pitch::flat },
-            { { 22, 9, 0 }, 12, Pitch::flat },
-            { { 22, 10, 0 }, 12, Pitch::flat },
-            { { 22, 11, 0 }, 10, Pitch::flat },
-            { { 21, 12, 0 }, 10, Pitch::flat },
-            { { 21, 13, 0 }, 10, Pitch::flat },
-            { { 20, 14, 0 }, 10, Pitch::flat },
-            { { 19, 15, 0 }, 8, Pitch::flat },
-            { { 18, 16, 0 }, 8, Pitch::flat },
-            { { 17, 17, 0 }, 8, Pitch::flat },
-            { { 16, 18, 0 }, 8, Pitch::flat },
-            { { 15, 19, 0 }, 8, Pitch::flat },
-            { { 14, 20, 0 }, 6, Pitch::flat },
-            { { 13, 21, 0 }, 6, Pitch::flat },
-            { { 12, 21, 0 }, 6, Pitch::flat },
-            { { 11, 22, 0 }, 6, Pitch::flat },
-            { { 10, 22, 0 }, 4, Pitch::flat },
-            { { 9, 22, 0 }, 4, Pitch::flat },
-            { { 8, 23, 0 }, 4, Pitch::flat },
-            { { 7, 23, 0 }, 2, Pitch::flat },
-            { { 6, 23, 0 }, 2, Pitch::flat },
-            { { 5, 23, 0 }, 2, Pitch::flat },
-            { { 4, 24, 0 }, 0, Pitch::flat },
-            { { 3, 24, 0 }, 0, Pitch::flat },
-            { { 2, 24, 0 }, 0, Pitch::flat },
-            { { 1, 24, 0 }, 0, Pitch::flat },
-            { { 0, 24, 0 }, 0, Pitch::flat },
-        });
-
-    // 0x4eb57c
-    // Turnaround 0. Lane 1. Track 1. Reversed 0. Direction 2
-    static constexpr auto moveInfoTA0L1T1R0D2 = std::to_array<MoveInfo>(
-        {
-            { { 0, 8, 0 }, 32, Pitch::flat },
-            { { 1, 8, 0 }, 32, Pitch::flat },
-            { { 2, 8, 0 }, 32, Pitch::flat },
-            { { 3, 8, 0 }, 32, Pitch::flat },
-            { { 4, 8, 0 }, 32, Pitch::flat },
-            { { 5, 9, 0 }, 30, Pitch::flat },
-            { { 6, 9, 0 }, 30, Pitch::flat },
-            { { 7, 9, 0 }, 30, Pitch::flat },
-            { { 8, 9, 0 }, 28, Pitch::flat },
-            { { 9, 10, 0 }, 28, Pitch::flat },
-            { { 10, 10, 0 }, 28, Pitch::flat },
-            { { 11, 10, 0 }, 26, Pitch::flat },
-            { { 12, 11, 0 }, 26, Pitch::flat },
-            { { 13, 11, 0 }, 26, Pitch::flat },
-            { { 14, 12, 0 }, 26, Pitch::flat },
-            { { 15, 13, 0 }, 24, Pitch::flat },
-            { { 16, 14, 0 }, 24, Pitch::flat },
-            { { 17, 15, 0 }, 24, Pitch::flat },
-            { { 18, 16, 0 }, 24, Pitch::flat },
-            { { 19, 17, 0 }, 24, Pitch::flat },
-            { { 20, 18, 0 }, 22, Pitch::flat },
-            { { 21, 19, 0 }, 22, Pitch::flat },
-            { { 21, 20, 0 }, 22, Pitch::flat },
-            { { 22, 21, 0 }, 22, Pitch::flat },
-            { { 22, 22, 0 }, 20, Pitch::flat },
-            { { 22, 23, 0 }, 20, Pitch::flat },
-            { { 23, 24, 0 }, 20, Pitch::flat },
-            { { 23, 25, 0 }, 18, Pitch::flat },
-            { { 23, 26, 0 }, 18, Pitch::flat },
-            { { 23, 27, 0 }, 18, Pitch::flat },
-            { { 24, 28, 0 }, 16, Pitch::flat },
-            { { 24, 29, 0 }, 16, Pitch::flat },
-            { { 24, 30, 0 }, 16, Pitch::flat },
-            { { 24, 31, 0 }, 16, Pitch::flat },
-        });
-
-    // 0x4eb246
-    // Turnaround 0. Lane 1. Track 1. Reversed 0. Direction 3
-    static constexpr auto moveInfoTA0L1T1R0D3 = std::to_array<MoveInfo>(
-        {
-            { { 8, 31, 0 }, 48, Pitch::flat },
-            { { 8, 30, 0 }, 48, Pitch::flat },
-            { { 8, 29, 0 }, 48, Pitch::flat },
-            { { 8, 28, 0 }, 48, Pitch::flat },
-            { { 9, 27, 0 }, 46, Pitch::flat },
-            { { 9, 26, 0 }, 46, Pitch::flat },
-            { { 9, 25, 0 }, 46, Pitch::flat },
-            { { 9, 24, 0 }, 44, Pitch::flat },
-            { { 10, 23, 0 }, 44, Pitch::flat },
-            { { 10, 22, 0 }, 44, Pitch::flat },
-            { { 10, 21, 0 }, 42, Pitch::flat },
-            { { 11, 20, 0 }, 42, Pitch::flat },
-            { { 11, 19, 0 }, 42, Pitch::flat },
-            { { 12, 18, 0 }, 42, Pitch::flat },
-            { { 13, 17, 0 }, 40, Pitch::flat },
-            { { 14, 16, 0 }, 40, Pitch::flat },
-            { { 15, 15, 0 }, 40, Pitch::flat },
-            { { 16, 14, 0 }, 40, Pitch::flat },
-            { { 17, 13, 0 }, 40, Pitch::flat },
-            { { 18, 12, 0 }, 38, Pitch::flat },
-            { { 19, 11, 0 }, 38, Pitch::flat },
-            { { 20, 11, 0 }, 38, Pitch::flat },
-            { { 21, 10, 0 }, 38, Pitch::flat },
-            { { 22, 10, 0 }, 36, Pitch::flat },
-            { { 23, 10, 0 }, 36, Pitch::flat },
-            { { 24, 9, 0 }, 36, Pitch::flat },
-            { { 25, 9, 0 }, 34, Pitch::flat },
-            { { 26, 9, 0 }, 34, Pitch::flat },
-            { { 27, 9, 0 }, 34, Pitch::flat },
-            { { 28, 8, 0 }, 32, Pitch::flat },
-            { { 29, 8, 0 }, 32, Pitch::flat },
-            { { 30, 8, 0 }, 32, Pitch::flat },
-            { { 31, 8, 0 }, 32, Pitch::flat },
-        });
-
-    // 0x4eb0c6
-    // Turnaround 0. Lane 1. Track 1. Reversed 1. Direction 0
-    static constexpr auto moveInfoTA0L1T1R1D0 = std::to_array<MoveInfo>(
-        {
-            { { 24, 0, 0 }, 16, Pitch::flat },
-            { { 24, 1, 0 }, 16, Pitch::flat },
-            { { 24, 2, 0 }, 16, Pitch::flat },
-            { { 24, 3, 0 }, 18, Pitch::flat },
-            { { 25, 4, 0 }, 20, Pitch::flat },
-            { { 25, 5, 0 }, 22, Pitch::flat },
-            { { 26, 6, 0 }, 24, Pitch::flat },
-            { { 27, 7, 0 }, 26, Pitch::flat },
-            { { 28, 7, 0 }, 28, Pitch::flat },
-            { { 29, 8, 0 }, 30, Pitch::flat },
-            { { 30, 8, 0 }, 32, Pitch::flat },
-            { { 31, 8, 0 }, 32, Pitch::flat },
-        });
-
-    // 0x4eb128
-    // Turnaround 0. Lane 1. Track 1. Reversed 1. Direction 1
-    static constexpr auto moveInfoTA0L1T1R1D1 = std::to_array<MoveInfo>(
-        {
-            { { 0, 8, 0 }, 32, Pitch::flat },
-            { { 1, 8, 0 }, 32, Pitch::flat },
-            { { 2, 8, 0 }, 34, Pitch::flat },
-            { { 3, 7, 0 }, 36, Pitch::flat },
-            { { 4, 7, 0 }, 38, Pitch::flat },
-            { { 5, 6, 0 }, 40, Pitch::flat },
-            { { 6, 5, 0 }, 40, Pitch::flat },
-            { { 7, 4, 0 }, 42, Pitch::flat },
-            { { 7, 3, 0 }, 44, Pitch::flat },
-            { { 8, 2, 0 }, 46, Pitch::flat },
-            { { 8, 1, 0 }, 48, Pitch::flat },
-            { { 8, 0, 0 }, 48, Pitch::flat },
-        });
-
-    // 0x4eb18a
-    // Turnaround 0. Lane 1. Track 1. Reversed 1. Direction 2
-    static constexpr auto moveInfoTA0L1T1R1D2 = std::to_array<MoveInfo>(
-        {
-            { { 8, 31, 0 }, 48, Pitch::flat },
-            { { 8, 30, 0 }, 48, Pitch::flat },
-            { { 8, 29, 0 }, 50, Pitch::flat },
-            { { 7, 28, 0 }, 52, Pitch::flat },
-            { { 7, 27, 0 }, 54, Pitch::flat },
-            { { 6, 26, 0 }, 56, Pitch::flat },
-            { { 5, 25, 0 }, 58, Pitch::flat },
-            { { 4, 25, 0 }, 60, Pitch::flat },
-            { { 3, 24, 0 }, 62, Pitch::flat },
-            { { 2, 24, 0 }, 0, Pitch::flat },
-            { { 1, 24, 0 }, 0, Pitch::flat },
-            { { 0, 24, 0 }, 0, Pitch::flat },
-        });
-
-    // 0x4eb1ec
-    // Turnaround 0. Lane 1. Track 1. Reversed 1. Direction 3
-    static constexpr auto moveInfoTA0L1T1R1D3 = std::to_array<MoveInfo>(
-        {
-            { { 31, 24, 0 }, 0, Pitch::flat },
-            { { 30, 24, 0 }, 0, Pitch::flat },
-            { { 29, 24, 0 }, 2, Pitch::flat },
-            { { 28, 25, 0 }, 4, Pitch::flat },
-            { { 27, 25, 0 }, 6, Pitch::flat },
-            { { 26, 26, 0 }, 8, Pitch::flat },
-            { { 25, 27, 0 }, 10, Pitch::flat },
-            { { 25, 28, 0 }, 12, Pitch::flat },
-            { { 24, 29, 0 }, 14, Pitch::flat },
-            { { 24, 30, 0 }, 16, Pitch::flat },
-            { { 24, 31, 0 }, 16, Pitch::flat },
-        });
-
-    // 0x4ef756
-    // Turnaround 0. Lane 1. Track 3. Reversed 0. Direction 0
-    static constexpr auto moveInfoTA0L1T3R0D0 = std::to_array<MoveInfo>(
-        {
-            { { 31, 24, 0 }, 0, Pitch::flat },
-            { { 30, 24, 0 }, 0, Pitch::flat },
-            { { 29, 24, 0 }, 0, Pitch::flat },
-            { { 28, 24, 0 }, 0, Pitch::flat },
-            { { 27, 24, 0 }, 0, Pitch::flat },
-            { { 26, 24, 0 }, 62, Pitch::flat },
-            { { 25, 24, 0 }, 62, Pitch::flat },
-            { { 24, 23, 0 }, 62, Pitch::flat },
-            { { 23, 23, 0 }, 62, Pitch::flat },
-            { { 22, 23, 0 }, 62, Pitch::flat },
-            { { 21, 23, 0 }, 62, Pitch::flat },
-            { { 20, 22, 0 }, 62, Pitch::flat },
-            { { 19, 22, 0 }, 62, Pitch::flat },
-            { { 18, 22, 0 }, 62, Pitch::flat },
-            { { 17, 22, 0 }, 60, Pitch::flat },
-            { { 16, 21, 0 }, 60, Pitch::flat },
-            { { 15, 21, 0 }, 60, Pitch::flat },
-            { { 14, 21, 0 }, 60, Pitch::flat },
-            { { 13, 20, 0 }, 60, Pitch::flat },
-            { { 12, 20, 0 }, 60, Pitch::flat },
-            { { 11, 20, 0 }, 60, Pitch::flat },
-            { { 10, 19, 0 }, 60, Pitch::flat },
-            { { 9, 19, 0 }, 60, Pitch::flat },
-            { { 8, 18, 0 }, 60, Pitch::flat },
-            { { 7, 18, 0 }, 60, Pitch::flat },
-            { { 6, 17, 0 }, 58, Pitch::flat },
-            { { 5, 17, 0 }, 58, Pitch::flat },
-            { { 4, 16, 0 }, 58, Pitch::flat },
-            { { 3, 15, 0 }, 58, Pitch::flat },
-            { { 2, 15, 0 }, 58, Pitch::flat },
-            { { 1, 14, 0 }, 58, Pitch::flat },
-            { { 0, 13, 0 }, 58, Pitch::flat },
-            { { -1, 13, 0 }, 58, Pitch::flat },
-            { { -2, 12, 0 }, 58, Pitch::flat },
-            { { -3, 11, 0 }, 56, Pitch::flat },
-            { { -4, 10, 0 }, 56, Pitch::flat },
-            { { -5, 10, 0 }, 56, Pitch::flat },
-            { { -6, 9, 0 }, 56, Pitch::flat },
-            { { -7, 8, 0 }, 56, Pitch::flat },
-            { { -8, 8, 0 }, 56, Pitch::flat },
-            { { -9, 7, 0 }, 56, Pitch::flat },
-            { { -10, 6, 0 }, 56, Pitch::flat },
-            { { -10, 5, 0 }, 56, Pitch::flat },
-            { { -11, 4, 0 }, 54, Pitch::flat },
-            { { -12, 3, 0 }, 54, Pitch::flat },
-            { { -13, 2, 0 }, 54, Pitch::flat },
-            { { -13, 1, 0 }, 54, Pitch::flat },
-            { { -14, 0, 0 }, 54, Pitch::flat },
-            { { -15, -1, 0 }, 54, Pitch::flat },
-            { { -15, -2, 0 }, 54, Pitch::flat },
-            { { -16, -3, 0 }, 54, Pitch::flat },
-            { { -17, -4, 0 }, 54, Pitch::flat },
-            { { -17, -5, 0 }, 52, Pitch::flat },
-            { { -18, -6, 0 }, 52, Pitch::flat },
-            { { -18, -7, 0 }, 52, Pitch::flat },
-            { { -19, -8, 0 }, 52, Pitch::flat },
-            { { -19, -9, 0 }, 52, Pitch::flat },
-            { { -20, -10, 0 }, 52, Pitch::flat },
-            { { -20, -11, 0 }, 52, Pitch::flat },
-            { { -20, -12, 0 }, 52, Pitch::flat },
-            { { -21, -13, 0 }, 52, Pitch::flat },
-            { { -21, -14, 0 }, 52, Pitch::flat },
-            { { -21, -15, 0 }, 52, Pitch::flat },
-            { { -22, -16, 0 }, 50, Pitch::flat },
-            { { -22, -17, 0 }, 50, Pitch::flat },
-            { { -22, -18, 0 }, 50, Pitch::flat },
-            { { -22, -19, 0 }, 50, Pitch::flat },
-            { { -23, -20, 0 }, 50, Pitch::flat },
-            { { -23, -21, 0 }, 50, Pitch::flat },
-            { { -23, -22, 0 }, 50, Pitch::flat },
-            { { -23, -23, 0 }, 50, Pitch::flat },
-            { { -24, -24, 0 }, 50, Pitch::flat },
-            { { -24, -25, 0 }, 50, Pitch::flat },
-            { { -24, -26, 0 }, 48, Pitch::flat },
-            { { -24, -27, 0 }, 48, Pitch::flat },
-            { { -24, -28, 0 }, 48, Pitch::flat },
-            { { -24, -29, 0 }, 48, Pitch::flat },
-            { { -24, -30, 0 }, 48, Pitch::flat },
-            { { -24, -31, 0 }, 48, Pitch::flat },
-            { { -24, -32, 0 }, 48, Pitch::flat },
-        });
-
-    // 0x4ef9d8
-    // Turnaround 0. Lane 1. Track 3. Reversed 0. Direction 1
-    static constexpr auto moveInfoTA0L1T3R0D1 = std::to_array<MoveInfo>(
-        {
-            { { 24, 0, 0 }, 16, Pitch::flat },
-            { { 24, 1, 0 }, 16, Pitch::flat },
-            { { 24, 2, 0 }, 16, Pitch::flat },
-            { { 24, 3, 0 }, 16, Pitch::flat },
-            { { 24, 4, 0 }, 16, Pitch::flat },
-            { { 24, 5, 0 }, 16, Pitch::flat },
-            { { 24, 6, 0 }, 14, Pitch::flat },
-            { { 24, 7, 0 }, 14, Pitch::flat },
-            { { 23, 8, 0 }, 14, Pitch::flat },
-            { { 23, 9, 0 }, 14, Pitch::flat },
-            { { 23, 10, 0 }, 14, Pitch::flat },
-            { { 23, 11, 0 }, 14, Pitch::flat },
-            { { 22, 12, 0 }, 14, Pitch::flat },
-            { { 22, 13, 0 }, 14, Pitch::flat },
-            { { 22, 14, 0 }, 14, Pitch::flat },
-            { { 22, 15, 0 }, 12, Pitch::flat },
-            { { 21, 16, 0 }, 12, Pitch::flat },
-            { { 21, 17, 0 }, 12, Pitch::flat },
-            { { 21, 18, 0 }, 12, Pitch::flat },
-            { { 20, 19, 0 }, 12, Pitch::flat },
-            { { 20, 20, 0 }, 12, Pitch::flat },
-            { { 20, 21, 0 }, 12, Pitch::flat },
-            { { 19, 22, 0 }, 12, Pitch::flat },
-            { { 19, 23, 0 }, 12, Pitch::flat },
-            { { 18, 24, 0 }, 12, Pitch::flat },
-            { { 18, 25, 0 }, 12, Pitch::flat },
-            { { 17, 26, 0 }, 10, Pitch::flat },
-            { { 17, 27, 0 }, 10, Pitch::flat },
-            { { 16, 28, 0 }, 10, Pitch::flat },
-            { { 15, 29, 0 }, 10, Pitch::flat },
-            { { 15, 30, 0 }, 10, Pitch::flat },
-            { { 14, 31, 0 }, 10, Pitch::flat },
-            { { 13, 32, 0 }, 10, Pitch::flat },
-            { { 13, 33, 0 }, 10, Pitch::flat },
-            { { 12, 34, 0 }, 10, Pitch::flat },
-            { { 11, 35, 0 }, 8, Pitch::flat },
-            { { 10, 36, 0 }, 8, Pitch::flat },
-            { { 10, 37, 0 }, 8, Pitch::flat },
-            { { 9, 38, 0 }, 8, Pitch::flat },
-            { { 8, 39, 0 }, 8, Pitch::flat },
-            { { 8, 40, 0 }, 8, Pitch::flat },
-            { { 7, 41, 0 }, 8, Pitch::flat },
-            { { 6, 42, 0 }, 8, Pitch::flat },
-            { { 5, 42, 0 }, 8, Pitch::flat },
-            { { 4, 43, 0 }, 6, Pitch::flat },
-            { { 3, 44, 0 }, 6, Pitch::flat },
-            { { 2, 45, 0 }, 6, Pitch::flat },
-            { { 1, 45, 0 }, 6, Pitch::flat },
-            { { 0, 46, 0 }, 6, Pitch::flat },
-            { { -1, 47, 0 }, 6, Pitch::flat },
-            { { -2, 47, 0 }, 6, Pitch::flat },
-            { { -3, 48, 0 }, 6, Pitch::flat },
-            { { -4, 49, 0 }, 6, Pitch::flat },
-            { { -5, 49, 0 }, 4, Pitch::flat },
-            { { -6, 50, 0 }, 4, Pitch::flat },
-            { { -7, 50, 0 }, 4, Pitch::flat },
-            { { -8, 51, 0 }, 4, Pitch::flat },
-            { { -9, 51, 0 }, 4, Pitch::flat },
-            { { -10, 52, 0 }, 4, Pitch::flat },
-            { { -11, 52, 0 }, 4, Pitch::flat },
-            { { -12, 52, 0 }, 4, Pitch::flat },
-            { { -13, 53, 0 }, 4, Pitch::flat },
-            { { -14, 53, 0 }, 4, Pitch::flat },
-            { { -15, 53, 0 }, 4, Pitch::flat },
-            { { -16, 54, 0 }, 2, Pitch::flat },
-            { { -17, 54, 0 }, 2, Pitch::flat },
-            { { -18, 54, 0 }, 2, Pitch::flat },
-            { { -19, 54, 0 }, 2, Pitch::flat },
-            { { -20, 55, 0 }, 2, Pitch::flat },
-            { { -21, 55, 0 }, 2, Pitch::flat },
-            { { -22, 55, 0 }, 2, Pitch::flat },
-            { { -23, 55, 0 }, 2, Pitch::flat },
-            { { -24, 56, 0 }, 2, Pitch::flat },
-            { { -25, 56, 0 }, 2, Pitch::flat },
-            { { -26, 56, 0 }, 0, Pitch::flat },
-            { { -27, 56, 0 }, 0, Pitch::flat },
-            { { -28, 56, 0 }, 0, Pitch::flat },
-            { { -29, 56, 0 }, 0, Pitch::flat },
-            { { -30, 56, 0 }, 0, Pitch::flat },
-            { { -31, 56, 0 }, 0, Pitch::flat },
-            { { -32, 56, 0 }, 0, Pitch::flat },
-        });
-
-    // 0x4efc62
-    // Turnaround 0. Lane 1. Track 3. Reversed 0. Direction 2
-    static constexpr auto moveInfoTA0L1T3R0D2 = std::to_array<MoveInfo>(
-        {
-            { { 0, 8, 0 }, 32, Pitch::flat },
-            { { 1, 8, 0 }, 32, Pitch::flat },
-            { { 2, 8, 0 }, 32, Pitch::flat },
-            { { 3, 8, 0 }, 32, Pitch::flat },
-            { { 4, 8, 0 }, 32, Pitch::flat },
-            { { 5, 8, 0 }, 32, Pitch::flat },
-            { { 6, 8, 0 }, 30, Pitch::flat },
-            { { 7, 8, 0 }, 30, Pitch::flat },
-            { { 8, 9, 0 }, 30, Pitch::flat },
-            { { 9, 9, 0 }, 30, Pitch::flat },
-            { { 10, 9, 0 }, 30, Pitch::flat },
-            { { 11, 9, 0 }, 30, Pitch::flat },
-            { { 12, 10, 0 }, 30, Pitch::flat },
-            { { 13, 10, 0 }, 30, Pitch::flat },
-            { { 14, 10, 0 }, 30, Pitch::flat },
-            { { 15, 10, 0 }, 28, Pitch::flat },
-            { { 16, 11, 0 }, 28, Pitch::flat },
-            { { 17, 11, 0 }, 28, Pitch::flat },
-            { { 18, 11, 0 }, 28, Pitch::flat },
-            { { 19, 12, 0 }, 28, Pitch::flat },
-            { { 20, 12, 0 }, 28, Pitch::flat },
-            { { 21, 12, 0 }, 28, Pitch::flat },
-            { { 22, 13, 0 }, 28, Pitch::flat },
-            { { 23, 13, 0 }, 28, Pitch::flat },
-            { { 24, 14, 0 }, 28, Pitch::flat },
-            { { 25, 14, 0 }, 28, Pitch::flat },
-            { { 26, 15, 0 }, 26, Pitch::flat },
-            { { 27, 15, 0 }, 26, Pitch::flat },
-            { { 28, 16, 0 }, 26, Pitch::flat },
-            { { 29, 17, 0 }, 26, Pitch::flat },
-            { { 30, 17, 0 }, 26, Pitch::flat },
-            { { 31, 18, 0 }, 26, Pitch::flat },
-            { { 32, 19, 0 }, 26, Pitch::flat },
-            { { 33, 19, 0 }, 26, Pitch::flat },
-            { { 34, 20, 0 }, 26, Pitch::flat },
-            { { 35, 21, 0 }, 24, Pitch::flat },
-            { { 36, 22, 0 }, 24, Pitch::flat },
-            { { 37, 22, 0 }, 24, Pitch::flat },
-            { { 38, 23, 0 }, 24, Pitch::flat },
-            { { 39, 24, 0 }, 24, Pitch::flat },
-            { { 40, 24, 0 }, 24, Pitch::flat },
-            { { 41, 25, 0 }, 24, Pitch::flat },
-            { { 42, 26, 0 }, 24, Pitch::flat },
-            { { 42, 27, 0 }, 24, Pitch::flat },
-            { { 43, 28, 0 }, 22, Pitch::flat },
-            { { 44, 29, 0 }, 22, Pitch::flat },
-            { { 45, 30, 0 }, 22, Pitch::flat },
-            { { 45, 31, 0 }, 22, Pitch::flat },
-            { { 46, 32, 0 }, 22, Pitch::flat },
-            { { 47, 33, 0 }, 22, Pitch::flat },
-            { { 47, 34, 0 }, 22, Pitch::flat },
-            { { 48, 35, 0 }, 22, Pitch::flat },
-            { { 49, 36, 0 }, 22, Pitch::flat },
-            { { 49, 37, 0 }, 20, Pitch::flat },
-            { { 50, 38, 0 }, 20, Pitch::flat },
-            { { 50, 39, 0 }, 20, Pitch::flat },
-            { { 51, 40, 0 }, 20, Pitch::flat },
-            { { 51, 41, 0 }, 20, Pitch::flat },
-            { { 52, 42, 0 }, 20, Pitch::flat },
-            { { 52, 43, 0 }, 20, Pitch::flat },
-            { { 52, 44, 0 }, 20, Pitch::flat },
-            { { 53, 45, 0 }, 20, Pitch::flat },
-            { { 53, 46, 0 }, 20, Pitch::flat },
-            { { 53, 47, 0 }, 20, Pitch::flat },
-            { { 54, 48, 0 }, 18, Pitch::flat },
-            { { 54, 49, 0 }, 18, Pitch::flat },
-            { { 54, 50, 0 }, 18, Pitch::flat },
-            { { 54, 51, 0 }, 18, Pitch::flat },
-            { { 55, 52, 0 }, 18, Pitch::flat },
-            { { 55, 53, 0 }, 18, Pitch::flat },
-            { { 55, 54, 0 }, 18, Pitch::flat },
-            { { 55, 55, 0 }, 18, Pitch::flat },
-            { { 56, 56, 0 }, 18, Pitch::flat },
-            { { 56, 57, 0 }, 18, Pitch::flat },
-            { { 56, 58, 0 }, 16, Pitch::flat },
-            { { 56, 59, 0 }, 16, Pitch::flat },
-            { { 56, 60, 0 }, 16, Pitch::flat },
-            { { 56, 61, 0 }, 16, Pitch::flat },
-            { { 56, 62, 0 }, 16, Pitch::flat },
-            { { 56, 63, 0 }, 16, Pitch::flat },
-        });
-
-    // 0x4efee4
-    // Turnaround 0. Lane 1. Track 3. Reversed 0. Direction 3
-    static constexpr auto moveInfoTA0L1T3R0D3 = std::to_array<MoveInfo>(
-        {
-            { { 8, 31, 0 }, 48, Pitch::flat },
-            { { 8, 30, 0 }, 48, Pitch::flat },
-            { { 8, 29, 0 }, 48, Pitch::flat },
-            { { 8, 28, 0 }, 48, Pitch::flat },
-            { { 8, 27, 0 }, 48, Pitch::flat },
-            { { 8, 26, 0 }, 46, Pitch::flat },
-            { { 8, 25, 0 }, 46, Pitch::flat },
-            { { 9, 24, 0 }, 46, Pitch::flat },
-            { { 9, 23, 0 }, 46, Pitch::flat },
-            { { 9, 22, 0 }, 46, Pitch::flat },
-            { { 9, 21, 0 }, 46, Pitch::flat },
-            { { 10, 20, 0 }, 46, Pitch::flat },
-            { { 10, 19, 0 }, 46, Pitch::flat },
-            { { 10, 18, 0 }, 46, Pitch::flat },
-            { { 10, 17, 0 }, 44, Pitch::flat },
-            { { 11, 16, 0 }, 44, Pitch::flat },
-            { { 11, 15, 0 }, 44, Pitch::flat },
-            { { 11, 14, 0 }, 44, Pitch::flat },
-            { { 12, 13, 0 }, 44, Pitch::flat },
-            { { 12, 12, 0 }, 44, Pitch::flat },
-            { { 12, 11, 0 }, 44, Pitch::flat },
-            { { 13, 10, 0 }, 44, Pitch::flat },
-            { { 13, 9, 0 }, 44, Pitch::flat },
-            { { 14, 8, 0 }, 44, Pitch::flat },
-            { { 14, 7, 0 }, 44, Pitch::flat },
-            { { 15, 6, 0 }, 42, Pitch::flat },
-            { { 15, 5, 0 }, 42, Pitch::flat },
-            { { 16, 4, 0 }, 42, Pitch::flat },
-            { { 17, 3, 0 }, 42, Pitch::flat },
-            { { 17, 2, 0 }, 42, Pitch::flat },
-            { { 18, 1, 0 }, 42, Pitch::flat },
-            { { 19, 0, 0 }, 42, Pitch::flat },
-            { { 19, -1, 0 }, 42, Pitch::flat },
-            { { 20, -2, 0 }, 42, Pitch::flat },
-            { { 21, -3, 0 }, 40, Pitch::flat },
-            { { 22, -4, 0 }, 40, Pitch::flat },
-            { { 22, -5, 0 }, 40, Pitch::flat },
-            { { 23, -6, 0 }, 40, Pitch::flat },
-            { { 24, -7, 0 }, 40, Pitch::flat },
-            { { 24, -8, 0 }, 40, Pitch::flat },
-            { { 25, -9, 0 }, 40, Pitch::flat },
-            { { 26, -10, 0 }, 40, Pitch::flat },
-            { { 27, -10, 0 }, 40, Pitch::flat },
-            { { 28, -11, 0 }, 38, Pitch::flat },
-            { { 29, -12, 0 }, 38, Pitch::flat },
-            { { 30, -13, 0 }, 38, Pitch::flat },
-            { { 31, -13, 0 }, 38, Pitch::flat },
-            { { 32, -14, 0 }, 38, Pitch::flat },
-            { { 33, -15, 0 }, 38, Pitch::flat },
-            { { 34, -15, 0 }, 38, Pitch::flat },
-            { { 35, -16, 0 }, 38, Pitch::flat },
-            { { 36, -17, 0 }, 38, Pitch::flat },
-            { { 37, -17, 0 }, 36, Pitch::flat },
-            { { 38, -18, 0 }, 36, Pitch::flat },
-            { { 39, -18, 0 }, 36, Pitch::flat },
-            { { 40, -19, 0 }, 36, Pitch::flat },
-            { { 41, -19, 0 }, 36, Pitch::flat },
-            { { 42, -20, 0 }, 36, Pitch::flat },
-            { { 43, -20, 0 }, 36, Pitch::flat },
-            { { 44, -20, 0 }, 36, Pitch::flat },
-            { { 45, -21, 0 }, 36, Pitch::flat },
-            { { 46, -21, 0 }, 36, Pitch::flat },
-            { { 47, -21, 0 }, 36, Pitch::flat },
-            { { 48, -22, 0 }, 34, Pitch::flat },
-            { { 49, -22, 0 }, 34, Pitch::flat },
-            { { 50, -22, 0 }, 34, Pitch::flat },
-            { { 51, -22, 0 }, 34, Pitch::flat },
-            { { 52, -23, 0 }, 34, Pitch::flat },
-            { { 53, -23, 0 }, 34, Pitch::flat },
-            { { 54, -23, 0 }, 34, Pitch::flat },
-            { { 55, -23, 0 }, 34, Pitch::flat },
-            { { 56, -24, 0 }, 34, Pitch::flat },
-            { { 57, -24, 0 }, 34, Pitch::flat },
-            { { 58, -24, 0 }, 32, Pitch::flat },
-            { { 59, -24, 0 }, 32, Pitch::flat },
-            { { 60, -24, 0 }, 32, Pitch::flat },
-            { { 61, -24, 0 }, 32, Pitch::flat },
-            { { 62, -24, 0 }, 32, Pitch::flat },
-            { { 63, -24, 0 }, 32, Pitch::flat },
-        });
-
-    // 0x4ef1d8
-    // Turnaround 0. Lane 1. Track 3. Reversed 1. Direction 0
-    static constexpr auto moveInfoTA0L1T3R1D0 = std::to_array<MoveInfo>(
-        {
-            { { 24, 0, 0 }, 16, Pitch::flat },
-            { { 24, 1, 0 }, 16, Pitch::flat },
-            { { 24, 2, 0 }, 16, Pitch::flat },
-            { { 24, 3, 0 }, 16, Pitch::flat },
-            { { 24, 4, 0 }, 18, Pitch::flat },
-            { { 24, 5, 0 }, 18, Pitch::flat },
-            { { 24, 6, 0 }, 18, Pitch::flat },
-            { { 25, 7, 0 }, 18, Pitch::flat },
-            { { 25, 8, 0 }, 18, Pitch::flat },
-            { { 25, 9, 0 }, 18, Pitch::flat },
-            { { 25, 10, 0 }, 18, Pitch::flat },
-            { { 26, 11, 0 }, 18, Pitch::flat },
-            { { 26, 12, 0 }, 20, Pitch::flat },
-            { { 26, 13, 0 }, 20, Pitch::flat },
-            { { 26, 14, 0 }, 20, Pitch::flat },
-            { { 27, 15, 0 }, 20, Pitch::flat },
-            { { 27, 16, 0 }, 20, Pitch::flat },
-            { { 27, 17, 0 }, 20, Pitch::flat },
-            { { 28, 18, 0 }, 20, Pitch::flat },
-            { { 28, 19, 0 }, 22, Pitch::flat },
-            { { 29, 20, 0 }, 22, Pitch::flat },
-            { { 30, 21, 0 }, 22, Pitch::flat },
-            { { 30, 22, 0 }, 22, Pitch::flat },
-            { { 31, 23, 0 }, 22, Pitch::flat },
-            { { 32, 24, 0 }, 22, Pitch::flat },
-            { { 33, 25, 0 }, 24, Pitch::flat },
-            { { 34, 26, 0 }, 24, Pitch::flat },
-            { { 34, 27, 0 }, 24, Pitch::flat },
-            { { 35, 28, 0 }, 24, Pitch::flat },
-            { { 35, 29, 0 }, 24, Pitch::flat },
-            { { 36, 30, 0 }, 24, Pitch::flat },
-            { { 37, 30, 0 }, 24, Pitch::flat },
-            { { 38, 31, 0 }, 26, Pitch::flat },
-            { { 39, 32, 0 }, 26, Pitch::flat },
-            { { 40, 33, 0 }, 26, Pitch::flat },
-            { { 41, 34, 0 }, 26, Pitch::flat },
-            { { 42, 34, 0 }, 26, Pitch::flat },
-            { { 43, 35, 0 }, 26, Pitch::flat },
-            { { 44, 36, 0 }, 26, Pitch::flat },
-            { { 45, 36, 0 }, 28, Pitch::flat },
-            { { 46, 37, 0 }, 28, Pitch::flat },
-            { { 47, 37, 0 }, 28, Pitch::flat },
-            { { 48, 37, 0 }, 28, Pitch::flat },
-            { { 49, 38, 0 }, 28, Pitch::flat },
-            { { 50, 38, 0 }, 28, Pitch::flat },
-            { { 51, 38, 0 }, 28, Pitch::flat },
-            { { 52, 38, 0 }, 28, Pitch::flat },
-            { { 53, 39, 0 }, 30, Pitch::flat },
-            { { 54, 39, 0 }, 30, Pitch::flat },
-            { { 55, 39, 0 }, 30, Pitch::flat },
-            { { 56, 39, 0 }, 30, Pitch::flat },
-            { { 57, 40, 0 }, 30, Pitch::flat },
-            { { 58, 40, 0 }, 30, Pitch::flat },
-            { { 59, 40, 0 }, 30, Pitch::flat },
-            { { 60, 40, 0 }, 32, Pitch::flat },
-            { { 61, 40, 0 }, 32, Pitch::flat },
-            { { 62, 40, 0 }, 32, Pitch::flat },
-            { { 63, 40, 0 }, 32, Pitch::flat },
-        });
-
-    // 0x4ef3aa
-    // Turnaround 0. Lane 1. Track 3. Reversed 1. Direction 1
-    static constexpr auto moveInfoTA0L1T3R1D1 = std::to_array<MoveInfo>(
-        {
-            { { 0, 8, 0 }, 32, Pitch::flat },
-            { { 1, 8, 0 }, 32, Pitch::flat },
-            { { 2, 8, 0 }, 32, Pitch::flat },
-            { { 3, 8, 0 }, 32, Pitch::flat },
-            { { 4, 8, 0 }, 34, Pitch::flat },
-            { { 5, 8, 0 }, 34, Pitch::flat },
-            { { 6, 8, 0 }, 34, Pitch::flat },
-            { { 7, 7, 0 }, 34, Pitch::flat },
-            { { 8, 7, 0 }, 34, Pitch::flat },
-            { { 9, 7, 0 }, 34, Pitch::flat },
-            { { 10, 7, 0 }, 34, Pitch::flat },
-            { { 11, 6, 0 }, 34, Pitch::flat },
-            { { 12, 6, 0 }, 36, Pitch::flat },
-            { { 13, 6, 0 }, 36, Pitch::flat },
-            { { 14, 6, 0 }, 36, Pitch::flat },
-            { { 15, 5, 0 }, 36, Pitch::flat },
-            { { 16, 5, 0 }, 36, Pitch::flat },
-            { { 17, 5, 0 }, 36, Pitch::flat },
-            { { 18, 4, 0 }, 36, Pitch::flat },
-            { { 19, 4, 0 }, 38, Pitch::flat },
-            { { 20, 3, 0 }, 38, Pitch::flat },
-            { { 21, 2, 0 }, 38, Pitch::flat },
-            { { 22, 2, 0 }, 38, Pitch::flat },
-            { { 23, 1, 0 }, 38, Pitch::flat },
-            { { 24, 0, 0 }, 38, Pitch::flat },
-            { { 25, -1, 0 }, 40, Pitch::flat },
-            { { 26, -2, 0 }, 40, Pitch::flat },
-            { { 27, -2, 0 }, 40, Pitch::flat },
-            { { 28, -3, 0 }, 40, Pitch::flat },
-            { { 29, -3, 0 }, 40, Pitch::flat },
-            { { 30, -4, 0 }, 40, Pitch::flat },
-            { { 30, -5, 0 }, 40, Pitch::flat },
-            { { 31, -6, 0 }, 42, Pitch::flat },
-            { { 32, -7, 0 }, 42, Pitch::flat },
-            { { 33, -8, 0 }, 42, Pitch::flat },
-            { { 34, -9, 0 }, 42, Pitch::flat },
-            { { 34, -10, 0 }, 42, Pitch::flat },
-            { { 35, -11, 0 }, 42, Pitch::flat },
-            { { 36, -12, 0 }, 42, Pitch::flat },
-            { { 36, -13, 0 }, 44, Pitch::flat },
-            { { 37, -14, 0 }, 44, Pitch::flat },
-            { { 37, -15, 0 }, 44, Pitch::flat },
-            { { 37, -16, 0 }, 44, Pitch::flat },
-            { { 38, -17, 0 }, 44, Pitch::flat },
-            { { 38, -18, 0 }, 44, Pitch::flat },
-            { { 38, -19, 0 }, 44, Pitch::flat },
-            { { 38, -20, 0 }, 44, Pitch::flat },
-            { { 39, -21, 0 }, 46, Pitch::flat },
-            { { 39, -22, 0 }, 46, Pitch::flat },
-            { { 39, -23, 0 }, 46, Pitch::flat },
-            { { 39, -24, 0 }, 46, Pitch::flat },
-            { { 40, -25, 0 }, 46, Pitch::flat },
-            { { 40, -26, 0 }, 46, Pitch::flat },
-            { { 40, -27, 0 }, 46, Pitch::flat },
-            { { 40, -28, 0 }, 48, Pitch::flat },
-            { { 40, -29, 0 }, 48, Pitch::flat },
-            { { 40, -30, 0 }, 48, Pitch::flat },
-            { { 40, -31, 0 }, 48, Pitch::flat },
-            { { 40, -32, 0 }, 48, Pitch::flat },
-        });
-
-    // 0x4ef584
-    // Turnaround 0. Lane 1. Track 3. Reversed 1. Direction 2
-    static constexpr auto moveInfoTA0L1T3R1D2 = std::to_array<MoveInfo>(
-        {
-            { { 8, 31, 0 }, 48, Pitch::flat },
-            { { 8, 30, 0 }, 48, Pitch::flat },
-            { { 8, 29, 0 }, 48, Pitch::flat },
-            { { 8, 28, 0 }, 50, Pitch::flat },
-            { { 8, 27, 0 }, 50, Pitch::flat },
-            { { 8, 26, 0 }, 50, Pitch::flat },
-            { { 7, 25, 0 }, 50, Pitch::flat },
-            { { 7, 24, 0 }, 50, Pitch::flat },
-            { { 7, 23, 0 }, 50, Pitch::flat },
-            { { 7, 22, 0 }, 50, Pitch::flat },
-            { { 6, 21, 0 }, 50, Pitch::flat },
-            { { 6, 20, 0 }, 52, Pitch::flat },
-            { { 6, 19, 0 }, 52, Pitch::flat },
-            { { 6, 18, 0 }, 52, Pitch::flat },
-            { { 5, 17, 0 }, 52, Pitch::flat },
-            { { 5, 16, 0 }, 52, Pitch::flat },
-            { { 5, 15, 0 }, 52, Pitch::flat },
-            { { 4, 14, 0 }, 52, Pitch::flat },
-            { { 4, 13, 0 }, 54, Pitch::flat },
-            { { 3, 12, 0 }, 54, Pitch::flat },
-            { { 2, 11, 0 }, 54, Pitch::flat },
-            { { 2, 10, 0 }, 54, Pitch::flat },
-            { { 1, 9, 0 }, 54, Pitch::flat },
-            { { 0, 8, 0 }, 54, Pitch::flat },
-            { { -1, 7, 0 }, 56, Pitch::flat },
-            { { -2, 6, 0 }, 56, Pitch::flat },
-            { { -2, 5, 0 }, 56, Pitch::flat },
-            { { -3, 4, 0 }, 56, Pitch::flat },
-            { { -3, 3, 0 }, 56, Pitch::flat },
-            { { -4, 2, 0 }, 56, Pitch::flat },
-            { { -5, 2, 0 }, 56, Pitch::flat },
-            { { -6, 1, 0 }, 58, Pitch::flat },
-            { { -7, 0, 0 }, 58, Pitch::flat },
-            { { -8, -1, 0 }, 58, Pitch::flat },
-            { { -9, -2, 0 }, 58, Pitch::flat },
-            { { -10, -2, 0 }, 58, Pitch::flat },
-            { { -11, -3, 0 }, 58, Pitch::flat },
-            { { -12, -4, 0 }, 58, Pitch::flat },
-            { { -13, -4, 0 }, 60, Pitch::flat },
-            { { -14, -5, 0 }, 60, Pitch::flat },
-            { { -15, -5, 0 }, 60, Pitch::flat },
-            { { -16, -5, 0 }, 60, Pitch::flat },
-            { { -17, -6, 0 }, 60, Pitch::flat },
-            { { -18, -6, 0 }, 60, Pitch::flat },
-            { { -19, -6, 0 }, 60, Pitch::flat },
-            { { -20, -6, 0 }, 60, Pitch::flat },
-            { { -21, -7, 0 }, 62, Pitch::flat },
-            { { -22, -7, 0 }, 62, Pitch::flat },
-            { { -23, -7, 0 }, 62, Pitch::flat },
-            { { -24, -7, 0 }, 62, Pitch::flat },
-            { { -25, -8, 0 }, 62, Pitch::flat },
-            { { -26, -8, 0 }, 62, Pitch::flat },
-            { { -27, -8, 0 }, 62, Pitch::flat },
-            { { -28, -8, 0 }, 0, Pitch::flat },
-            { { -29, -8, 0 }, 0, Pitch::flat },
-            { { -30, -8, 0 }, 0, Pitch::flat },
-            { { -31, -8, 0 }, 0, Pitch::flat },
-            { { -32, -8, 0 }, 0, Pitch::flat },
-        });
-
-    // 0x4ef00e
-    // Turnaround 0. Lane 1. Track 3. Reversed 1. Direction 3
-    static constexpr auto moveInfoTA0L1T3R1D3 = std::to_array<MoveInfo>(
-        {
-            { { 31, 24, 0 }, 0, Pitch::flat },
-            { { 30, 24, 0 }, 0, Pitch::flat },
-            { { 29, 24, 0 }, 0, Pitch::flat },
-            { { 28, 24, 0 }, 2, Pitch::flat },
-            { { 27, 24, 0 }, 2, Pitch::flat },
-            { { 26, 24, 0 }, 2, Pitch::flat },
-            { { 25, 25, 0 }, 2, Pitch::flat },
-            { { 24, 25, 0 }, 2, Pitch::flat },
-            { { 23, 25, 0 }, 2, Pitch::flat },
-            { { 22, 25, 0 }, 2, Pitch::flat },
-            { { 21, 26, 0 }, 2, Pitch::flat },
-            { { 20, 26, 0 }, 4, Pitch::flat },
-            { { 19, 26, 0 }, 4, Pitch::flat },
-            { { 18, 26, 0 }, 4, Pitch::flat },
-            { { 17, 27, 0 }, 4, Pitch::flat },
-            { { 16, 27, 0 }, 4, Pitch::flat },
-            { { 15, 27, 0 }, 4, Pitch::flat },
-            { { 14, 28, 0 }, 4, Pitch::flat },
-            { { 13, 28, 0 }, 6, Pitch::flat },
-            { { 12, 29, 0 }, 6, Pitch::flat },
-            { { 11, 30, 0 }, 6, Pitch::flat },
-            { { 10, 30, 0 }, 6, Pitch::flat },
-            { { 9, 31, 0 }, 6, Pitch::flat },
-            { { 8, 32, 0 }, 6, Pitch::flat },
-            { { 7, 33, 0 }, 8, Pitch::flat },
-            { { 6, 34, 0 }, 8, Pitch::flat },
-            { { 5, 34, 0 }, 8, Pitch::flat },
-            { { 4, 35, 0 }, 8, Pitch::flat },
-            { { 3, 35, 0 }, 8, Pitch::flat },
-            { { 2, 36, 0 }, 8, Pitch::flat },
-            { { 2, 37, 0 }, 8, Pitch::flat },
-            { { 1, 38, 0 }, 10, Pitch::flat },
-            { { 0, 39, 0 }, 10, Pitch::flat },
-            { { -1, 40, 0 }, 10, Pitch::flat },
-            { { -2, 41, 0 }, 10, Pitch::flat },
-            { { -2, 42, 0 }, 10, Pitch::flat },
-            { { -3, 43, 0 }, 10, Pitch::flat },
-            { { -4, 44, 0 }, 10, Pitch::flat },
-            { { -4, 45, 0 }, 12, Pitch::flat },
-            { { -5, 46, 0 }, 12, Pitch::flat },
-            { { -5, 47, 0 }, 12, Pitch::flat },
-            { { -5, 48, 0 }, 12, Pitch::flat },
-            { { -6, 49, 0 }, 12, Pitch::flat },
-            { { -6, 50, 0 }, 12, Pitch::flat },
-            { { -6, 51, 0 }, 12, Pitch::flat },
-            { { -6, 52, 0 }, 12, Pitch::flat },
-            { { -7, 53, 0 }, 14, Pitch::flat },
-            { { -7, 54, 0 }, 14, Pitch::flat },
-            { { -7, 55, 0 }, 14, Pitch::flat },
-            { { -7, 56, 0 }, 14, Pitch::flat },
-            { { -8, 57, 0 }, 14, Pitch::flat },
-            { { -8, 58, 0 }, 14, Pitch::flat },
-            { { -8, 59, 0 }, 14, Pitch::flat },
-            { { -8, 60, 0 }, 16, Pitch::flat },
-            { { -8, 61, 0 }, 16, Pitch::flat },
-            { { -8, 62, 0 }, 16, Pitch::flat },
-            { { -8, 63, 0 }, 16, Pitch::flat },
-        });
-
-    // 0x4eceae
-    // Turnaround 0. Lane 1. Track 5. Reversed 0. Direction 0
-    static constexpr auto moveInfoTA0L1T5R0D0 = std::to_array<MoveInfo>(
-        {
-            { { 31, 24, 0 }, 0, Pitch::up12deg },
-            { { 30, 24, 0 }, 0, Pitch::up12deg },
-            { { 29, 24, 0 }, 0, Pitch::up12deg },
-            { { 28, 24, 0 }, 0, Pitch::up12deg },
-            { { 27, 24, 1 }, 0, Pitch::up12deg },
-            { { 26, 24, 1 }, 0, Pitch::up12deg },
-            { { 25, 24, 1 }, 0, Pitch::up12deg },
-            { { 24, 24, 1 }, 0, Pitch::up12deg },
-            { { 23, 24, 2 }, 0, Pitch::up12deg },
-            { { 22, 24, 2 }, 0, Pitch::up12deg },
-            { { 21, 24, 2 }, 0, Pitch::up12deg },
-            { { 20, 24, 2 }, 0, Pitch::up12deg },
-            { { 19, 24, 3 }, 0, Pitch::up12deg },
-            { { 18, 24, 3 }, 0, Pitch::up12deg },
-            { { 17, 24, 3 }, 0, Pitch::up12deg },
-            { { 16, 24, 3 }, 0, Pitch::up12deg },
-            { { 15, 24, 4 }, 0, Pitch::up12deg },
-            { { 14, 24, 4 }, 0, Pitch::up12deg },
-            { { 13, 24, 4 }, 0, Pitch::up12deg },
-            { { 12, 24, 4 }, 0, Pitch::up12deg },
-            { { 11, 24, 5 }, 0, Pitch::up12deg },
-            { { 10, 24, 5 }, 0, Pitch::up12deg },
-            { { 9, 24, 5 }, 0, Pitch::up12deg },
-            { { 8, 24, 5 }, 0, Pitch::up12deg },
-            { { 7, 24, 6 }, 0, Pitch::up12deg },
-            { { 6, 24, 6 }, 0, Pitch::up12deg },
-            { { 5, 24, 6 }, 0, Pitch::up12deg },
-            { { 4, 24, 6 }, 0, Pitch::up12deg },
-            { { 3, 24, 7 }, 0, Pitch::up12deg },
-            { { 2, 24, 7 }, 0, Pitch::up12deg },
-            { { 1, 24, 7 }, 0, Pitch::up12deg },
-            { { 0, 24, 7 }, 0, Pitch::up12deg },
-            { { -1, 24, 8 }, 0, Pitch::up12deg },
-            { { -2, 24, 8 }, 0, Pitch::up12deg },
-            { { -3, 24, 8 }, 0, Pitch::up12deg },
-            { { -4, 24, 8 }, 0, Pitch::up12deg },
-            { { -5, 24, 9 }, 0, Pitch::up12deg },
-            { { -6, 24, 9 }, 0, Pitch::up12deg },
-            { { -7, 24, 9 }, 0, Pitch::up12deg },
-            { { -8, 24, 9 }, 0, Pitch::up12deg },
-            { { -9, 24, 10 }, 0, Pitch::up12deg },
-            { { -10, 24, 10 }, 0, Pitch::up12deg },
-            { { -11, 24, 10 }, 0, Pitch::up12deg },
-            { { -12, 24, 10 }, 0, Pitch::up12deg },
-            { { -13, 24, 11 }, 0, Pitch::up12deg },
-            { { -14, 24, 11 }, 0, Pitch::up12deg },
-            { { -15, 24, 11 }, 0, Pitch::up12deg },
-            { { -16, 24, 11 }, 0, Pitch::up12deg },
-            { { -17, 24, 12 }, 0, Pitch::up12deg },
-            { { -18, 24, 12 }, 0, Pitch::up12deg },
-            { { -19, 24, 12 }, 0, Pitch::up12deg },
-            { { -20, 24, 12 }, 0, Pitch::up12deg },
-            { { -21, 24, 13 }, 0, Pitch::up12deg },
-            { { -22, 24, 13 }, 0, Pitch::up12deg },
-            { { -23, 24, 13 }, 0, Pitch::up12deg },
-            { { -24, 24, 13 }, 0, Pitch::up12deg },
-            { { -25, 24, 14 }, 0, Pitch::up12deg },
-            { { -26, 24, 14 }, 0, Pitch::up12deg },
-            { { -27, 24, 14 }, 0, Pitch::up12deg },
-            { { -28, 24, 14 }, 0, Pitch::up12deg },
-            { { -29, 24, 15 }, 0, Pitch::up12deg },
-            { { -30, 24, 15 }, 0, Pitch::up12deg },
-            { { -31, 24, 15 }, 0, Pitch::up12deg },
-            { { -32, 24, 15 }, 0, Pitch::up12deg },
-        });
-
-    // 0x4ed0b0
-    // Turnaround 0. Lane 1. Track 5. Reversed 0. Direction 1
-    static constexpr auto moveInfoTA0L1T5R0D1 = std::to_array<MoveInfo>(
-        {
-            { { 24, 0, 0 }, 16, Pitch::up12deg },
-            { { 24, 1, 0 }, 16, Pitch::up12deg },
-            { { 24, 2, 0 }, 16, Pitch::up12deg },
-            { { 24, 3, 0 }, 16, Pitch::up12deg },
-            { { 24, 4, 1 }, 16, Pitch::up12deg },
-            { { 24, 5, 1 }, 16, Pitch::up12deg },
-            { { 24, 6, 1 }, 16, Pitch::up12deg },
-            { { 24, 7, 1 }, 16, Pitch::up12deg },
-            { { 24, 8, 2 }, 16, Pitch::up12deg },
-            { { 24, 9, 2 }, 16, Pitch::up12deg },
-            { { 24, 10, 2 }, 16, Pitch::up12deg },
-            { { 24, 11, 2 }, 16, Pitch::up12deg },
-            { { 24, 12, 3 }, 16, Pitch::up12deg },
-            { { 24, 13, 3 }, 16, Pitch::up12deg },
-            { { 24, 14, 3 }, 16, Pitch::up12deg },
-            { { 24, 15, 3 }, 16, Pitch::up12deg },
-            { { 24, 16, 4 }, 16, Pitch::up12deg },
-            { { 24, 17, 4 }, 16, Pitch::up12deg },
-            { { 24, 18, 4 }, 16, Pitch::up12deg },
-            { { 24, 19, 4 }, 16, Pitch::up12deg },
-            { { 24, 20, 5 }, 16, Pitch::up12deg },
-            { { 24, 21, 5 }, 16, Pitch::up12deg },
-            { { 24, 22, 5 }, 16, Pitch::up12deg },
-            { { 24, 23, 5 }, 16, Pitch::up12deg },
-            { { 24, 24, 6 }, 16, Pitch::up12deg },
-            { { 24, 25, 6 }, 16, Pitch::up12deg },
-            { { 24, 26, 6 }, 16, Pitch::up12deg },
-            { { 24, 27, 6 }, 16, Pitch::up12deg },
-            { { 24, 28, 7 }, 16, Pitch::up12deg },
-            { { 24, 29, 7 }, 16, Pitch::up12deg },
-            { { 24, 30, 7 }, 16, Pitch::up12deg },
-            { { 24, 31, 7 }, 16, Pitch::up12deg },
-            { { 24, 32, 8 }, 16, Pitch::up12deg },
-            { { 24, 33, 8 }, 16, Pitch::up12deg },
-            { { 24, 34, 8 }, 16, Pitch::up12deg },
-            { { 24, 35, 8 }, 16, Pitch::up12deg },
-            { { 24, 36, 9 }, 16, Pitch::up12deg },
-            { { 24, 37, 9 }, 16, Pitch::up12deg },
-            { { 24, 38, 9 }, 16, Pitch::up12deg },
-            { { 24, 39, 9 }, 16, Pitch::up12deg },
-            { { 24, 40, 10 }, 16, Pitch::up12deg },
-            { { 24, 41, 10 }, 16, Pitch::up12deg },
-            { { 24, 42, 10 }, 16, Pitch::up12deg },
-            { { 24, 43, 10 }, 16, Pitch::up12deg },
-            { { 24, 44, 11 }, 16, Pitch::up12deg },
-            { { 24, 45, 11 }, 16, Pitch::up12deg },
-            { { 24, 46, 11 }, 16, Pitch::up12deg },
-            { { 24, 47, 11 }, 16, Pitch::up12deg },
-            { { 24, 48, 12 }, 16, Pitch::up12deg },
-            { { 24, 49, 12 }, 16, Pitch::up12deg },
-            { { 24, 50, 12 }, 16, Pitch::up12deg },
-            { { 24, 51, 12 }, 16, Pitch::up12deg },
-            { { 24, 52, 13 }, 16, Pitch::up12deg },
-            { { 24, 53, 13 }, 16, Pitch::up12deg },
-            { { 24, 54, 13 }, 16, Pitch::up12deg },
-            { { 24, 55, 13 }, 16, Pitch::up12deg },
-            { { 24, 56, 14 }, 16, Pitch::up12deg },
-            { { 24, 57, 14 }, 16, Pitch::up12deg },
-            { { 24, 58, 14 }, 16, Pitch::up12deg },
-            { { 24, 59, 14 }, 16, Pitch::up12deg },
-            { { 24, 60, 15 }, 16, Pitch::up12deg },
-            { { 24, 61, 15 }, 16, Pitch::up12deg },
-            { { 24, 62, 15 }, 16, Pitch::up12deg },
-            { { 24, 63, 15 }, 16, Pitch::up12deg },
-        });
-
-    // 0x4ed2b2
-    // Turnaround 0. Lane 1. Track 5. Reversed 0. Direction 2
-    static constexpr auto moveInfoTA0L1T5R0D2 = std::to_array<MoveInfo>(
-        {
-            { { 0, 8, 0 }, 32, Pitch::up12deg },
-            { { 1, 8, 0 }, 32, Pitch::up12deg },
-            { { 2, 8, 0 }, 32, Pitch::up12deg },
-            { { 3, 8, 0 }, 32, Pitch::up12deg },
-            { { 4, 8, 1 }, 32, Pitch::up12deg },
-            { { 5, 8, 1 }, 32, Pitch::up12deg },
-            { { 6, 8, 1 }, 32, Pitch::up12deg },
-            { { 7, 8, 1 }, 32, Pitch::up12deg },
-            { { 8, 8, 2 }, 32, Pitch::up12deg },
-            { { 9, 8, 2 }, 32, Pitch::up12deg },
-            { { 10, 8, 2 }, 32, Pitch::up12deg },
-            { { 11, 8, 2 }, 32, Pitch::up12deg },
-            { { 12, 8, 3 }, 32, Pitch::up12deg },
-            { { 13, 8, 3 }, 32, Pitch::up12deg },
-            { { 14, 8, 3 }, 32, Pitch::up12deg },
-            { { 15, 8, 3 }, 32, Pitch::up12deg },
-            { { 16, 8, 4 }, 32, Pitch::up12deg },
-            { { 17, 8, 4 }, 32, Pitch::up12deg },
-            { { 18, 8, 4 }, 32, Pitch::up12deg },
-            { { 19, 8, 4 }, 32, Pitch::up12deg },
-            { { 20, 8, 5 }, 32, Pitch::up12deg },
-            { { 21, 8, 5 }, 32, Pitch::up12deg },
-            { { 22, 8, 5 }, 32, Pitch::up12deg },
-            { { 23, 8, 5 }, 32, Pitch::up12deg },
-            { { 24, 8, 6 }, 32, Pitch::up12deg },
-            { { 25, 8, 6 }, 32, Pitch::up12deg },
-            { { 26, 8, 6 }, 32, Pitch::up12deg },
-            { { 27, 8, 6 }, 32, Pitch::up12deg },
-            { { 28, 8, 7 }, 32, Pitch::up12deg },
-            { { 29, 8, 7 }, 32, Pitch::up12deg },
-            { { 30, 8, 7 }, 32, Pitch::up12deg },
-            { { 31, 8, 7 }, 32, Pitch::up12deg },
-            { { 32, 8, 8 }, 32, Pitch::up12deg },
-            { { 33, 8, 8 }, 32, Pitch::up12deg },
-            { { 34, 8, 8 }, 32, Pitch::up12deg },
-            { { 35, 8, 8 }, 32, Pitch::up12deg },
-            { { 36, 8, 9 }, 32, Pitch::up12deg },
-            { { 37, 8, 9 }, 32, Pitch::up12deg },
-            { { 38, 8, 9 }, 32, Pitch::up12deg },
-            { { 39, 8, 9 }, 32, Pitch::up12deg },
-            { { 40, 8, 10 }, 32, Pitch::up12deg },
-            { { 41, 8, 10 }, 32, Pitch::up12deg },
-            { { 42, 8, 10 }, 32, Pitch::up12deg },
-            { { 43, 8, 10 }, 32, Pitch::up12deg },
-            { { 44, 8, 11 }, 32, Pitch::up12deg },
-            { { 45, 8, 11 }, 32, Pitch::up12deg },
-            { { 46, 8, 11 }, 32, Pitch::up12deg },
-            { { 47, 8, 11 }, 32, Pitch::up12deg },
-            { { 48, 8, 12 }, 32, Pitch::up12deg },
-            { { 49, 8, 12 }, 32, Pitch::up12deg },
-            { { 50, 8, 12 }, 32, Pitch::up12deg },
-            { { 51, 8, 12 }, 32, Pitch::up12deg },
-            { { 52, 8, 13 }, 32, Pitch::up12deg },
-            { { 53, 8, 13 }, 32, Pitch::up12deg },
-            { { 54, 8, 13 }, 32, Pitch::up12deg },
-            { { 55, 8, 13 }, 32, Pitch::up12deg },
-            { { 56, 8, 14 }, 32, Pitch::up12deg },
-            { { 57, 8, 14 }, 32, Pitch::up12deg },
-            { { 58, 8, 14 }, 32, Pitch::up12deg },
-            { { 59, 8, 14 }, 32, Pitch::up12deg },
-            { { 60, 8, 15 }, 32, Pitch::up12deg },
-            { { 61, 8, 15 }, 32, Pitch::up12deg },
-            { { 62, 8, 15 }, 32, Pitch::up12deg },
-            { { 63, 8, 15 }, 32, Pitch::up12deg },
-        });
-
-    // 0x4ed4b4
-    // Turnaround 0. Lane 1. Track 5. Reversed 0. Direction 3
-    static constexpr auto moveInfoTA0L1T5R0D3 = std::to_array<MoveInfo>(
-        {
-            { { 8, 31, 0 }, 48, Pitch::up12deg },
-            { { 8, 30, 0 }, 48, Pitch::up12deg },
-            { { 8, 29, 0 }, 48, Pitch::up12deg },
-            { { 8, 28, 0 }, 48, Pitch::up12deg },
-            { { 8, 27, 1 }, 48, Pitch::up12deg },
-            { { 8, 26, 1 }, 48, Pitch::up12deg },
-            { { 8, 25, 1 }, 48, Pitch::up12deg },
-            { { 8, 24, 1 }, 48, Pitch::up12deg },
-            { { 8, 23, 2 }, 48, Pitch::up12deg },
-            { { 8, 22, 2 }, 48, Pitch::up12deg },
-            { { 8, 21, 2 }, 48, Pitch::up12deg },
-            { { 8, 20, 2 }, 48, Pitch::up12deg },
-            { { 8, 19, 3 }, 48, Pitch::up12deg },
-            { { 8, 18, 3 }, 48, Pitch::up12deg },
-            { { 8, 17, 3 }, 48, Pitch::up12deg },
-            { { 8, 16, 3 }, 48, Pitch::up12deg },
-            { { 8, 15, 4 }, 48, Pitch::up12deg },
-            { { 8, 14, 4 }, 48, Pitch::up12deg },
-            { { 8, 13, 4 }, 48, Pitch::up12deg },
-            { { 8, 12, 4 }, 48, Pitch::up12deg },
-            { { 8, 11, 5 }, 48, Pitch::up12deg },
-            { { 8, 10, 5 }, 48, Pitch::up12deg },
-            { { 8, 9, 5 }, 48, Pitch::up12deg },
-            { { 8, 8, 5 }, 48, Pitch::up12deg },
-            { { 8, 7, 6 }, 48, Pitch::up12deg },
-            { { 8, 6, 6 }, 48, Pitch::up12deg },
-            { { 8, 5, 6 }, 48, Pitch::up12deg },
-            { { 8, 4, 6 }, 48, Pitch::up12deg },
-            { { 8, 3, 7 }, 48, Pitch::up12deg },
-            { { 8, 2, 7 }, 48, Pitch::up12deg },
-            { { 8, 1, 7 }, 48, Pitch::up12deg },
-            { { 8, 0, 7 }, 48, Pitch::up12deg },
-            { { 8, -1, 8 }, 48, Pitch::up12deg },
-            { { 8, -2, 8 }, 48, Pitch::up12deg },
-            { { 8, -3, 8 }, 48, Pitch::up12deg },
-            { { 8, -4, 8 }, 48, Pitch::up12deg },
-            { { 8, -5, 9 }, 48, Pitch::up12deg },
-            { { 8, -6, 9 }, 48, Pitch::up12deg },
-            { { 8, -7, 9 }, 48, Pitch::up12deg },
-            { { 8, -8, 9 }, 48, Pitch::up12deg },
-            { { 8, -9, 10 }, 48, Pitch::up12deg },
-            { { 8, -10, 10 }, 48, Pitch::up12deg },
-            { { 8, -11, 10 }, 48, Pitch::up12deg },
-            { { 8, -12, 10 }, 48, Pitch::up12deg },
-            { { 8, -13, 11 }, 48, Pitch::up12deg },
-            { { 8, -14, 11 }, 48, Pitch::up12deg },
-            { { 8, -15, 11 }, 48, Pitch::up12deg },
-            { { 8, -16, 11 }, 48, Pitch::up12deg },
-            { { 8, -17, 12 }, 48, Pitch::up12deg },
-            { { 8, -18, 12 }, 48, Pitch::up12deg },
-            { { 8, -19, 12 }, 48, Pitch::up12deg },
-            { { 8, -20, 12 }, 48, Pitch::up12deg },
-            { { 8, -21, 13 }, 48, Pitch::up12deg },
-            { { 8, -22, 13 }, 48, Pitch::up12deg },
-            { { 8, -23, 13 }, 48, Pitch::up12deg },
-            { { 8, -24, 13 }, 48, Pitch::up12deg },
-            { { 8, -25, 14 }, 48, Pitch::up12deg },
-            { { 8, -26, 14 }, 48, Pitch::up12deg },
-            { { 8, -27, 14 }, 48, Pitch::up12deg },
-            { { 8, -28, 14 }, 48, Pitch::up12deg },
-            { { 8, -29, 15 }, 48, Pitch::up12deg },
-            { { 8, -30, 15 }, 48, Pitch::up12deg },
-            { { 8, -31, 15 }, 48, Pitch::up12deg },
-            { { 8, -32, 15 }, 48, Pitch::up12deg },
-        });
-
-    // 0x4edaba
-    // Turnaround 0. Lane 1. Track 5. Reversed 1. Direction 0
-    static constexpr auto moveInfoTA0L1T5R1D0 = std::to_array<MoveInfo>(
-        {
-            { { 0, 8, 0 }, 32, Pitch::down12deg },
-            { { 1, 8, 0 }, 32, Pitch::down12deg },
-            { { 2, 8, 0 }, 32, Pitch::down12deg },
-            { { 3, 8, 0 }, 32, Pitch::down12deg },
-            { { 4, 8, -1 }, 32, Pitch::down12deg },
-            { { 5, 8, -1 }, 32, Pitch::down12deg },
-            { { 6, 8, -1 }, 32, Pitch::down12deg },
-            { { 7, 8, -1 }, 32, Pitch::down12deg },
-            { { 8, 8, -2 }, 32, Pitch::down12deg },
-            { { 9, 8, -2 }, 32, Pitch::down12deg },
-            { { 10, 8, -2 }, 32, Pitch::down12deg },
-            { { 11, 8, -2 }, 32, Pitch::down12deg },
-            { { 12, 8, -3 }, 32, Pitch::down12deg },
-            { { 13, 8, -3 }, 32, Pitch::down12deg },
-            { { 14, 8, -3 }, 32, Pitch::down12deg },
-            { { 15, 8, -3 }, 32, Pitch::down12deg },
-            { { 16, 8, -4 }, 32, Pitch::down12deg },
-            { { 17, 8, -4 }, 32, Pitch::down12deg },
-            { { 18, 8, -4 }, 32, Pitch::down12deg },
-            { { 19, 8, -4 }, 32, Pitch::down12deg },
-            { { 20, 8, -5 }, 32, Pitch::down12deg },
-            { { 21, 8, -5 }, 32, Pitch::down12deg },
-            { { 22, 8, -5 }, 32, Pitch::down12deg },
-            { { 23, 8, -5 }, 32, Pitch::down12deg },
-            { { 24, 8, -6 }, 32, Pitch::down12deg },
-            { { 25, 8, -6 }, 32, Pitch::down12deg },
-            { { 26, 8, -6 }, 32, Pitch::down12deg },
-            { { 27, 8, -6 }, 32, Pitch::down12deg },
-            { { 28, 8, -7 }, 32, Pitch::down12deg },
-            { { 29, 8, -7 }, 32, Pitch::down12deg },
-            { { 30, 8, -7 }, 32, Pitch::down12deg },
-            { { 31, 8, -7 }, 32, Pitch::down12deg },
-            { { 32, 8, -8 }, 32, Pitch::down12deg },
-            { { 33, 8, -8 }, 32, Pitch::down12deg },
-            { { 34, 8, -8 }, 32, Pitch::down12deg },
-            { { 35, 8, -8 }, 32, Pitch::down12deg },
-            { { 36, 8, -9 }, 32, Pitch::down12deg },
-            { { 37, 8, -9 }, 32, Pitch::down12deg },
-            { { 38, 8, -9 }, 32, Pitch::down12deg },
-            { { 39, 8, -9 }, 32, Pitch::down12deg },
-            { { 40, 8, -10 }, 32, Pitch::down12deg },
-            { { 41, 8, -10 }, 32, Pitch::down12deg },
-            { { 42, 8, -10 }, 32, Pitch::down12deg },
-            { { 43, 8, -10 }, 32, Pitch::down12deg },
-            { { 44, 8, -11 }, 32, Pitch::down12deg },
-            { { 45, 8, -11 }, 32, Pitch::down12deg },
-            { { 46, 8, -11 }, 32, Pitch::down12deg },
-            { { 47, 8, -11 }, 32, Pitch::down12deg },
-            { { 48, 8, -12 }, 32, Pitch::down12deg },
-            { { 49, 8, -12 }, 32, Pitch::down12deg },
-            { { 50, 8, -12 }, 32, Pitch::down12deg },
-            { { 51, 8, -12 }, 32, Pitch::down12deg },
-            { { 52, 8, -13 }, 32, Pitch::down12deg },
-            { { 53, 8, -13 }, 32, Pitch::down12deg },
-            { { 54, 8, -13 }, 32, Pitch::down12deg },
-            { { 55, 8, -13 }, 32, Pitch::down12deg },
-            { { 56, 8, -14 }, 32, Pitch::down12deg },
-            { { 57, 8, -14 }, 32, Pitch::down12deg },
-            { { 58, 8, -14 }, 32, Pitch::down12deg },
-            { { 59, 8, -14 }, 32, Pitch::down12deg },
-            { { 60, 8, -15 }, 32, Pitch::down12deg },
-            { { 61, 8, -15 }, 32, Pitch::down12deg },
-            { { 62, 8, -15 }, 32, Pitch::down12deg },
-            { { 63, 8, -15 }, 32, Pitch::down12deg },
-        });
-
-    // 0x4edcbc
-    // Turnaround 0. Lane 1. Track 5. Reversed 1. Direction 1
-    static constexpr auto moveInfoTA0L1T5R1D1 = std::to_array<MoveInfo>(
-        {
-            { { 8, 31, 0 }, 48, Pitch::down12deg },
-            { { 8, 30, 0 }, 48, Pitch::down12deg },
-            { { 8, 29, 0 }, 48, Pitch::down12deg },
-            { { 8, 28, 0 }, 48, Pitch::down12deg },
-            { { 8, 27, -1 }, 48, Pitch::down12deg },
-            { { 8, 26, -1 }, 48, Pitch::down12deg },
-            { { 8, 25, -1 }, 48, Pitch::down12deg },
-            { { 8, 24, -1 }, 48, Pitch::down12deg },
-            { { 8, 23, -2 }, 48, Pitch::down12deg },
-            { { 8, 22, -2 }, 48, Pitch::down12deg },
-            { { 8, 21, -2 }, 48, Pitch::down12deg },
-            { { 8, 20, -2 }, 48, Pitch::down12deg },
-            { { 8, 19, -3 }, 48, Pitch::down12deg },
-            { { 8, 18, -3 }, 48, Pitch::down12deg },
-            { { 8, 17, -3 }, 48, Pitch::down12deg },
-            { { 8, 16, -3 }, 48, Pitch::down12deg },
-            { { 8, 15, -4 }, 48, Pitch::down12deg },
-            { { 8, 14, -4 }, 48, Pitch::down12deg },
-            { { 8, 13, -4 }, 48, Pitch::down12deg },
-            { { 8, 12, -4 }, 48, Pitch::down12deg },
-            { { 8, 11, -5 }, 48, Pitch::down12deg },
-            { { 8, 10, -5 }, 48, Pitch::down12deg },
-            { { 8, 9, -5 }, 48, Pitch::down12deg },
-            { { 8, 8, -5 }, 48, Pitch::down12deg },
-            { { 8, 7, -6 }, 48, Pitch::down12deg },
-            { { 8, 6, -6 }, 48, Pitch::down12deg },
-            { { 8, 5, -6 }, 48, Pitch::down12deg },
-            { { 8, 4, -6 }, 48, Pitch::down12deg },
-            { { 8, 3, -7 }, 48, Pitch::down12deg },
-            { { 8, 2, -7 }, 48, Pitch::down12deg },
-            { { 8, 1, -7 }, 48, Pitch::down12deg },
-            { { 8, 0, -7 }, 48, Pitch::down12deg },
-            { { 8, -1, -8 }, 48, Pitch::down12deg },
-            { { 8, -2, -8 }, 48, Pitch::down12deg },
-            { { 8, -3, -8 }, 48, Pitch::down12deg },
-            { { 8, -4, -8 }, 48, Pitch::down12deg },
-            { { 8, -5, -9 }, 48, Pitch::down12deg },
-            { { 8, -6, -9 }, 48, Pitch::down12deg },
-            { { 8, -7, -9 }, 48, Pitch::down12deg },
-            { { 8, -8, -9 }, 48, Pitch::down12deg },
-            { { 8, -9, -10 }, 48, Pitch::down12deg },
-            { { 8, -10, -10 }, 48, Pitch::down12deg },
-            { { 8, -11, -10 }, 48, Pitch::down12deg },
-            { { 8, -12, -10 }, 48, Pitch::down12deg },
-            { { 8, -13, -11 }, 48, Pitch::down12deg },
-            { { 8, -14, -11 }, 48, Pitch::down12deg },
-            { { 8, -15, -11 }, 48, Pitch::down12deg },
-            { { 8, -16, -11 }, 48, Pitch::down12deg },
-            { { 8, -17, -12 }, 48, Pitch::down12deg },
-            { { 8, -18, -12 }, 48, Pitch::down12deg },
-            { { 8, -19, -12 }, 48, Pitch::down12deg },
-            { { 8, -20, -12 }, 48, Pitch::down12deg },
-            { { 8, -21, -13 }, 48, Pitch::down12deg },
-            { { 8, -22, -13 }, 48, Pitch::down12deg },
-            { { 8, -23, -13 }, 48, Pitch::down12deg },
-            { { 8, -24, -13 }, 48, Pitch::down12deg },
-            { { 8, -25, -14 }, 48, Pitch::down12deg },
-            { { 8, -26, -14 }, 48, Pitch::down12deg },
-            { { 8, -27, -14 }, 48, Pitch::down12deg },
-            { { 8, -28, -14 }, 48, Pitch::down12deg },
-            { { 8, -29, -15 }, 48, Pitch::down12deg },
-            { { 8, -30, -15 }, 48, Pitch::down12deg },
-            { { 8, -31, -15 }, 48, Pitch::down12deg },
-            { { 8, -32, -15 }, 48, Pitch::down12deg },
-        });
-
-    // 0x4ed6b6
-    // Turnaround 0. Lane 1. Track 5. Reversed 1. Direction 2
-    static constexpr auto moveInfoTA0L1T5R1D2 = std::to_array<MoveInfo>(
-        {
-            { { 31, 24, 0 }, 0, Pitch::down12deg },
-            { { 30, 24, 0 }, 0, Pitch::down12deg },
-            { { 29, 24, 0 }, 0, Pitch::down12deg },
-            { { 28, 24, 0 }, 0, Pitch::down12deg },
-            { { 27, 24, -1 }, 0, Pitch::down12deg },
-            { { 26, 24, -1 }, 0, Pitch::down12deg },
-            { { 25, 24, -1 }, 0, Pitch::down12deg },
-            { { 24, 24, -1 }, 0, Pitch::down12deg },
-            { { 23, 24, -2 }, 0, Pitch::down12deg },
-            { { 22, 24, -2 }, 0, Pitch::down12deg },
-            { { 21, 24, -2 }, 0, Pitch::down12deg },
-            { { 20, 24, -2 }, 0, Pitch::down12deg },
-            { { 19, 24, -3 }, 0, Pitch::down12deg },
-            { { 18, 24, -3 }, 0, Pitch::down12deg },
-            { { 17, 24, -3 }, 0, Pitch::down12deg },
-            { { 16, 24, -3 }, 0, Pitch::down12deg },
-            { { 15, 24, -4 }, 0, Pitch::down12deg },
-            { { 14, 24, -4 }, 0, Pitch::down12deg },
-            { { 13, 24, -4 }, 0, Pitch::down12deg },
-            { { 12, 24, -4 }, 0, Pitch::down12deg },
-            { { 11, 24, -5 }, 0, Pitch::down12deg },
-            { { 10, 24, -5 }, 0, Pitch::down12deg },
-            { { 9, 24, -5 }, 0, Pitch::down12deg },
-            { { 8, 24, -5 }, 0, Pitch::down12deg },
-            { { 7, 24, -6 }, 0, Pitch::down12deg },
-            { { 6, 24, -6 }, 0, Pitch::down12deg },
-            { { 5, 24, -6 }, 0, Pitch::down12deg },
-            { { 4, 24, -6 }, 0, Pitch::down12deg },
-            { { 3, 24, -7 }, 0, Pitch::down12deg },
-            { { 2, 24, -7 }, 0, Pitch::down12deg },
-            { { 1, 24, -7 }, 0, Pitch::down12deg },
-            { { 0, 24, -7 }, 0, Pitch::down12deg },
-            { { -1, 24, -8 }, 0, Pitch::down12deg },
-            { { -2, 24, -8 }, 0, Pitch::down12deg },
-            { { -3, 24, -8 }, 0, Pitch::down12deg },
-            { { -4, 24, -8 }, 0, Pitch::down12deg },
-            { { -5, 24, -9 }, 0, Pitch::down12deg },
-            { { -6, 24, -9 }, 0, Pitch::down12deg },
-            { { -7, 24, -9 }, 0, Pitch::down12deg },
-            { { -8, 24, -9 }, 0, Pitch::down12deg },
-            { { -9, 24, -10 }, 0, Pitch::down12deg },
-            { { -10, 24, -10 }, 0, Pitch::down12deg },
-            { { -11, 24, -10 }, 0, Pitch::down12deg },
-            { { -12, 24, -10 }, 0, Pitch::down12deg },
-            { { -13, 24, -11 }, 0, Pitch::down12deg },
-            { { -14, 24, -11 }, 0, Pitch::down12deg },
-            { { -15, 24, -11 }, 0, Pitch::down12deg },
-            { { -16, 24, -11 }, 0, Pitch::down12deg },
-            { { -17, 24, -12 }, 0, Pitch::down12deg },
-            { { -18, 24, -12 }, 0, Pitch::down12deg },
-            { { -19, 24, -12 }, 0, Pitch::down12deg },
-            { { -20, 24, -12 }, 0, Pitch::down12deg },
-            { { -21, 24, -13 }, 0, Pitch::down12deg },
-            { { -22, 24, -13 }, 0, Pitch::down12deg },
-            { { -23, 24, -13 }, 0, Pitch::down12deg },
-            { { -24, 24, -13 }, 0, Pitch::down12deg },
-            { { -25, 24, -14 }, 0, Pitch::down12deg },
-            { { -26, 24, -14 }, 0, Pitch::down12deg },
-            { { -27, 24, -14 }, 0, Pitch::down12deg },
-            { { -28, 24, -14 }, 0, Pitch::down12deg },
-            { { -29, 24, -15 }, 0, Pitch::down12deg },
-            { { -30, 24, -15 }, 0, Pitch::down12deg },
-            { { -31, 24, -15 }, 0, Pitch::down12deg },
-            { { -32, 24, -15 }, 0, Pitch::down12deg },
-        });
-
-    // 0x4ed8b8
-    // Turnaround 0. Lane 1. Track 5. Reversed 1. Direction 3
-    static constexpr auto moveInfoTA0L1T5R1D3 = std::to_array<MoveInfo>(
-        {
-            { { 24, 0, 0 }, 16, Pitch::down12deg },
-            { { 24, 1, 0 }, 16, Pitch::down12deg },
-            { { 24, 2, 0 }, 16, Pitch::down12deg },
-            { { 24, 3, 0 }, 16, Pitch::down12deg },
-            { { 24, 4, -1 }, 16, Pitch::down12deg },
-            { { 24, 5, -1 }, 16, Pitch::down12deg },
-            { { 24, 6, -1 }, 16, Pitch::down12deg },
-            { { 24, 7, -1 }, 16, Pitch::down12deg },
-            { { 24, 8, -2 }, 16, Pitch::down12deg },
-            { { 24, 9, -2 }, 16, Pitch::down12deg },
-            { { 24, 10, -2 }, 16, Pitch::down12deg },
-            { { 24, 11, -2 }, 16, Pitch::down12deg },
-            { { 24, 12, -3 }, 16, Pitch::down12deg },
-            { { 24, 13, -3 }, 16, Pitch::down12deg },
-            { { 24, 14, -3 }, 16, Pitch::down12deg },
-            { { 24, 15, -3 }, 16, Pitch::down12deg },
-            { { 24, 16, -4 }, 16, Pitch::down12deg },
-            { { 24, 17, -4 }, 16, Pitch::down12deg },
-            { { 24, 18, -4 }, 16, Pitch::down12deg },
-            { { 24, 19, -4 }, 16, Pitch::down12deg },
-            { { 24, 20, -5 }, 16, Pitch::down12deg },
-            { { 24, 21, -5 }, 16, Pitch::down12deg },
-            { { 24, 22, -5 }, 16, Pitch::down12deg },
-            { { 24, 23, -5 }, 16, Pitch::down12deg },
-            { { 24, 24, -6 }, 16, Pitch::down12deg },
-            { { 24, 25, -6 }, 16, Pitch::down12deg },
-            { { 24, 26, -6 }, 16, Pitch::down12deg },
-            { { 24, 27, -6 }, 16, Pitch::down12deg },
-            { { 24, 28, -7 }, 16, Pitch::down12deg },
-            { { 24, 29, -7 }, 16, Pitch::down12deg },
-            { { 24, 30, -7 }, 16, Pitch::down12deg },
-            { { 24, 31, -7 }, 16, Pitch::down12deg },
-            { { 24, 32, -8 }, 16, Pitch::down12deg },
-            { { 24, 33, -8 }, 16, Pitch::down12deg },
-            { { 24, 34, -8 }, 16, Pitch::down12deg },
-            { { 24, 35, -8 }, 16, Pitch::down12deg },
-            { { 24, 36, -9 }, 16, Pitch::down12deg },
-            { { 24, 37, -9 }, 16, Pitch::down12deg },
-            { { 24, 38, -9 }, 16, Pitch::down12deg },
-            { { 24, 39, -9 }, 16, Pitch::down12deg },
-            { { 24, 40, -10 }, 16, Pitch::down12deg },
-            { { 24, 41, -10 }, 16, Pitch::down12deg },
-            { { 24, 42, -10 }, 16, Pitch::down12deg },
-            { { 24, 43, -10 }, 16, Pitch::down12deg },
-            { { 24, 44, -11 }, 16, Pitch::down12deg },
-            { { 24, 45, -11 }, 16, Pitch::down12deg },
-            { { 24, 46, -11 }, 16, Pitch::down12deg },
-            { { 24, 47, -11 }, 16, Pitch::down12deg },
-            { { 24, 48, -12 }, 16, Pitch::down12deg },
-            { { 24, 49, -12 }, 16, Pitch::down12deg },
-            { { 24, 50, -12 }, 16, Pitch::down12deg },
-            { { 24, 51, -12 }, 16, Pitch::down12deg },
-            { { 24, 52, -13 }, 16, Pitch::down12deg },
-            { { 24, 53, -13 }, 16, Pitch::down12deg },
-            { { 24, 54, -13 }, 16, Pitch::down12deg },
-            { { 24, 55, -13 }, 16, Pitch::down12deg },
-            { { 24, 56, -14 }, 16, Pitch::down12deg },
-            { { 24, 57, -14 }, 16, Pitch::down12deg },
-            { { 24, 58, -14 }, 16, Pitch::down12deg },
-            { { 24, 59, -14 }, 16, Pitch::down12deg },
-            { { 24, 60, -15 }, 16, Pitch::down12deg },
-            { { 24, 61, -15 }, 16, Pitch::down12deg },
-            { { 24, 62, -15 }, 16, Pitch::down12deg },
-            { { 24, 63, -15 }, 16, Pitch::down12deg },
-        });
-
-    // 0x4dd576
-    // Turnaround 0. Lane 1. Track 7. Reversed 0. Direction 0
-    static constexpr auto moveInfoTA0L1T7R0D0 = std::to_array<MoveInfo>(
-        {
-            { { 31, 24, 0 }, 0, Pitch::up25deg },
-            { { 30, 24, 0 }, 0, Pitch::up25deg },
-            { { 29, 24, 1 }, 0, Pitch::up25deg },
-            { { 28, 24, 1 }, 0, Pitch::up25deg },
-            { { 27, 24, 2 }, 0, Pitch::up25deg },
-            { { 26, 24, 2 }, 0, Pitch::up25deg },
-            { { 25, 24, 3 }, 0, Pitch::up25deg },
-            { { 24, 24, 3 }, 0, Pitch::up25deg },
-            { { 23, 24, 4 }, 0, Pitch::up25deg },
-            { { 22, 24, 4 }, 0, Pitch::up25deg },
-            { { 21, 24, 5 }, 0, Pitch::up25deg },
-            { { 20, 24, 5 }, 0, Pitch::up25deg },
-            { { 19, 24, 6 }, 0, Pitch::up25deg },
-            { { 18, 24, 6 }, 0, Pitch::up25deg },
-            { { 17, 24, 7 }, 0, Pitch::up25deg },
-            { { 16, 24, 7 }, 0, Pitch::up25deg },
-            { { 15, 24, 8 }, 0, Pitch::up25deg },
-            { { 14, 24, 8 }, 0, Pitch::up25deg },
-            { { 13, 24, 9 }, 0, Pitch::up25deg },
-            { { 12, 24, 9 }, 0, Pitch::up25deg },
-            { { 11, 24, 10 }, 0, Pitch::up25deg },
-            { { 10, 24, 10 }, 0, Pitch::up25deg },
-            { { 9, 24, 11 }, 0, Pitch::up25deg },
-            { { 8, 24, 11 }, 0, Pitch::up25deg },
-            { { 7, 24, 12 }, 0, Pitch::up25deg },
-            { { 6, 24, 12 }, 0, Pitch::up25deg },
-            { { 5, 24, 13 }, 0, Pitch::up25deg },
-            { { 4, 24, 13 }, 0, Pitch::up25deg },
-            { { 3, 24, 14 }, 0, Pitch::up25deg },
-            { { 2, 24, 14 }, 0, Pitch::up25deg },
-            { { 1, 24, 15 }, 0, Pitch::up25deg },
-            { { 0, 24, 15 }, 0, Pitch::up25deg },
-        });
-
-    // 0x4dd678
-    // Turnaround 0. Lane 1. Track 7. Reversed 0. Direction 1
-    static constexpr auto moveInfoTA0L1T7R0D1 = std::to_array<MoveInfo>(
-        {
-            { { 24, 0, 0 }, 16, Pitch::up25deg },
-            { { 24, 1, 0 }, 16, Pitch::up25deg },
-            { { 24, 2, 1 }, 16, Pitch::up25deg },
-            { { 24, 3, 1 }, 16, Pitch::up25deg },
-            { { 24, 4, 2 }, 16, Pitch::up25deg },
-            { { 24, 5, 2 }, 16, Pitch::up25deg },
-            { { 24, 6, 3 }, 16, Pitch::up25deg },
-            { { 24, 7, 3 }, 16, Pitch::up25deg },
-            { { 24, 8, 4 }, 16, Pitch::up25deg },
-            { { 24, 9, 4 }, 16, Pitch::up25deg },
-            { { 24, 10, 5 }, 16, Pitch::up25deg },
-            { { 24, 11, 5 }, 16, Pitch::up25deg },
-            { { 24, 12, 6 }, 16, Pitch::up25deg },
-            { { 24, 13, 6 }, 16, Pitch::up25deg },
-            { { 24, 14, 7 }, 16, Pitch::up25deg },
-            { { 24, 15, 7 }, 16, Pitch::up25deg },
-            { { 24, 16, 8 }, 16, Pitch::up25deg },
-            { { 24, 17, 8 }, 16, Pitch::up25deg },
-            { { 24, 18, 9 }, 16, Pitch::up25deg },
-            { { 24, 19, 9 }, 16, Pitch::up25deg },
-            { { 24, 20, 10 }, 16, Pitch::up25deg },
-            { { 24, 21, 10 }, 16, Pitch::up25deg },
-            { { 24, 22, 11 }, 16, Pitch::up25deg },
-            { { 24, 23, 11 }, 16, Pitch::up25deg },
-            { { 24, 24, 12 }, 16, Pitch::up25deg },
-            { { 24, 25, 12 }, 16, Pitch::up25deg },
-            { { 24, 26, 13 }, 16, Pitch::up25deg },
-            { { 24, 27, 13 }, 16, Pitch::up25deg },
-            { { 24, 28, 14 }, 16, Pitch::up25deg },
-            { { 24, 29, 14 }, 16, Pitch::up25deg },
-            { { 24, 30, 15 }, 16, Pitch::up25deg },
-            { { 24, 31, 15 }, 16, Pitch::up25deg },
-        });
-
-    // 0x4dd77a
-    // Turnaround 0. Lane 1. Track 7. Reversed 0. Direction 2
-    static constexpr auto moveInfoTA0L1T7R0D2 = std::to_array<MoveInfo>(
-        {
-            { { 0, 8, 0 }, 32, Pitch::up25deg },
-            { { 1, 8, 0 }, 32, Pitch::up25deg },
-            { { 2, 8, 1 }, 32, Pitch::up25deg },
-            { { 3, 8, 1 }, 32, Pitch::up25deg },
-            { { 4, 8, 2 }, 32, Pitch::up25deg },
-            { { 5, 8, 2 }, 32, Pitch::up25deg },
-            { { 6, 8, 3 }, 32, Pitch::up25deg },
-            { { 7, 8, 3 }, 32, Pitch::up25deg },
-            { { 8, 8, 4 }, 32, Pitch::up25deg },
-            { { 9, 8, 4 }, 32, Pitch::up25deg },
-            { { 10, 8, 5 }, 32, Pitch::up25deg },
-            { { 11, 8, 5 }, 32, Pitch::up25deg },
-            { { 12, 8, 6 }, 32, Pitch::up25deg },
-            { { 13, 8, 6 }, 32, Pitch::up25deg },
-            { { 14, 8, 7 }, 32, Pitch::up25deg },
-            { { 15, 8, 7 }, 32, Pitch::up25deg },
-            { { 16, 8, 8 }, 32, Pitch::up25deg },
-            { { 17, 8, 8 }, 32, Pitch::up25deg },
-            { { 18, 8, 9 }, 32, Pitch::up25deg },
-            { { 19, 8, 9 }, 32, Pitch::up25deg },
-            { { 20, 8, 10 }, 32, Pitch::up25deg },
-            { { 21, 8, 10 }, 32, Pitch::up25deg },
-            { { 22, 8, 11 }, 32, Pitch::up25deg },
-            { { 23, 8, 11 }, 32, Pitch::up25deg },
-            { { 24, 8, 12 }, 32, Pitch::up25deg },
-            { { 25, 8, 12 }, 32, Pitch::up25deg },
-            { { 26, 8, 13 }, 32, Pitch::up25deg },
-            { { 27, 8, 13 }, 32, Pitch::up25deg },
-            { { 28, 8, 14 }, 32, Pitch::up25deg },
-            { { 29, 8, 14 }, 32, Pitch::up25deg },
-            { { 30, 8, 15 }, 32, Pitch::up25deg },
-            { { 31, 8, 15 }, 32, Pitch::up25deg },
-        });
-
-    // 0x4dd87c
-    // Turnaround 0. Lane 1. Track 7. Reversed 0. Direction 3
-    static constexpr auto moveInfoTA0L1T7R0D3 = std::to_array<MoveInfo>(
-        {
-            { { 8, 31, 0 }, 48, Pitch::up25deg },
-            { { 8, 30, 0 }, 48, Pitch::up25deg },
-            { { 8, 29, 1 }, 48, Pitch::up25deg },
-            { { 8, 28, 1 }, 48, Pitch::up25deg },
-            { { 8, 27, 2 }, 48, Pitch::up25deg },
-            { { 8, 26, 2 }, 48, Pitch::up25deg },
-            { { 8, 25, 3 }, 48, Pitch::up25deg },
-            { { 8, 24, 3 }, 48, Pitch::up25deg },
-            { { 8, 23, 4 }, 48, Pitch::up25deg },
-            { { 8, 22, 4 }, 48, Pitch::up25deg },
-            { { 8, 21, 5 }, 48, Pitch::up25deg },
-            { { 8, 20, 5 }, 48, Pitch::up25deg },
-            { { 8, 19, 6 }, 48, Pitch::up25deg },
-            { { 8, 18, 6 }, 48, Pitch::up25deg },
-            { { 8, 17, 7 }, 48, Pitch::up25deg },
-            { { 8, 16, 7 }, 48, Pitch::up25deg },
-            { { 8, 15, 8 }, 48, Pitch::up25deg },
-            { { 8, 14, 8 }, 48, Pitch::up25deg },
-            { { 8, 13, 9 }, 48, Pitch::up25deg },
-            { { 8, 12, 9 }, 48, Pitch::up25deg },
-            { { 8, 11, 10 }, 48, Pitch::up25deg },
-            { { 8, 10, 10 }, 48, Pitch::up25deg },
-            { { 8, 9, 11 }, 48, Pitch::up25deg },
-            { { 8, 8, 11 }, 48, Pitch::up25deg },
-            { { 8, 7, 12 }, 48, Pitch::up25deg },
-            { { 8, 6, 12 }, 48, Pitch::up25deg },
-            { { 8, 5, 13 }, 48, Pitch::up25deg },
-            { { 8, 4, 13 }, 48, Pitch::up25deg },
-            { { 8, 3, 14 }, 48, Pitch::up25deg },
-            { { 8, 2, 14 }, 48, Pitch::up25deg },
-            { { 8, 1, 15 }, 48, Pitch::up25deg },
-            { { 8, 0, 15 }, 48, Pitch::up25deg },
-        });
-
-    // 0x4ddb82
-    // Turnaround 0. Lane 1. Track 7. Reversed 1. Direction 0
-    static constexpr auto moveInfoTA0L1T7R1D0 = std::to_array<MoveInfo>(
-        {
-            { { 0, 8, 0 }, 32, Pitch::down25deg },
-            { { 1, 8, 0 }, 32, Pitch::down25deg },
-            { { 2, 8, -1 }, 32, Pitch::down25deg },
-            { { 3, 8, -1 }, 32, Pitch::down25deg },
-            { { 4, 8, -2 }, 32, Pitch::down25deg },
-            { { 5, 8, -2 }, 32, Pitch::down25deg },
-            { { 6, 8, -3 }, 32, Pitch::down25deg },
-            { { 7, 8, -3 }, 32, Pitch::down25deg },
-            { { 8, 8, -4 }, 32, Pitch::down25deg },
-            { { 9, 8, -4 }, 32, Pitch::down25deg },
-            { { 10, 8, -5 }, 32, Pitch::down25deg },
-            { { 11, 8, -5 }, 32, Pitch::down25deg },
-            { { 12, 8, -6 }, 32, Pitch::down25deg },
-            { { 13, 8, -6 }, 32, Pitch::down25deg },
-            { { 14, 8, -7 }, 32, Pitch::down25deg },
-            { { 15, 8, -7 }, 32, Pitch::down25deg },
-            { { 16, 8, -8 }, 32, Pitch::down25deg },
-            { { 17, 8, -8 }, 32, Pitch::down25deg },
-            { { 18, 8, -9 }, 32, Pitch::down25deg },
-            { { 19, 8, -9 }, 32, Pitch::down25deg },
-            { { 20, 8, -10 }, 32, Pitch::down25deg },
-            { { 21, 8, -10 }, 32, Pitch::down25deg },
-            { { 22, 8, -11 }, 32, Pitch::down25deg },
-            { { 23, 8, -11 }, 32, Pitch::down25deg },
-            { { 24, 8, -12 }, 32, Pitch::down25deg },
-            { { 25, 8, -12 }, 32, Pitch::down25deg },
-            { { 26, 8, -13 }, 32, Pitch::down25deg },
-            { { 27, 8, -13 }, 32, Pitch::down25deg },
-            { { 28, 8, -14 }, 32, Pitch::down25deg },
-            { { 29, 8, -14 }, 32, Pitch::down25deg },
-            { { 30, 8, -15 }, 32, Pitch::down25deg },
-            { { 31, 8, -15 }, 32, Pitch::down25deg },
-        });
-
-    // 0x4ddc84
-    // Turnaround 0. Lane 1. Track 7. Reversed 1. Direction 1
-    static constexpr auto moveInfoTA0L1T7R1D1 = std::to_array<MoveInfo>(
-        {
-            { { 8, 31, 0 }, 48, Pitch::down25deg },
-            { { 8, 30, 0 }, 48, Pitch::down25deg },
-            { { 8, 29, -1 }, 48, Pitch::down25deg },
-            { { 8, 28, -1 }, 48, Pitch::down25deg },
-            { { 8, 27, -2 }, 48, Pitch::down25deg },
-            { { 8, 26, -2 }, 48, Pitch::down25deg },
-            { { 8, 25, -3 }, 48, Pitch::down25deg },
-            { { 8, 24, -3 }, 48, Pitch::down25deg },
-            { { 8, 23, -4 }, 48, Pitch::down25deg },
-            { { 8, 22, -4 }, 48, Pitch::down25deg },
-            { { 8, 21, -5 }, 48, Pitch::down25deg },
-            { { 8, 20, -5 }, 48, Pitch::down25deg },
-            { { 8, 19, -6 }, 48, Pitch::down25deg },
-            { { 8, 18, -6 }, 48, Pitch::down25deg },
-            { { 8, 17, -7 }, 48, Pitch::down25deg },
-            { { 8, 16, -7 }, 48, Pitch::down25deg },
-            { { 8, 15, -8 }, 48, Pitch::down25deg },
-            { { 8, 14, -8 }, 48, Pitch::down25deg },
-            { { 8, 13, -9 }, 48, Pitch::down25deg },
-            { { 8, 12, -9 }, 48, Pitch::down25deg },
-            { { 8, 11, -10 }, 48, Pitch::down25deg },
-            { { 8, 10, -10 }, 48, Pitch::down25deg },
-            { { 8, 9, -11 }, 48, Pitch::down25deg },
-            { { 8, 8, -11 }, 48, Pitch::down25deg },
-            { { 8, 7, -12 }, 48, Pitch::down25deg },
-            { { 8, 6, -12 }, 48, Pitch::down25deg },
-            { { 8, 5, -13 }, 48, Pitch::down25deg },
-            { { 8, 4, -13 }, 48, Pitch::down25deg },
-            { { 8, 3, -14 }, 48, Pitch::down25deg },
-            { { 8, 2, -14 }, 48, Pitch::down25deg },
-            { { 8, 1, -15 }, 48, Pitch::down25deg },
-            { { 8, 0, -15 }, 48, Pitch::down25deg },
-        });
-
-    // 0x4dd97e
-    // Turnaround 0. Lane 1. Track 7. Reversed 1. Direction 2
-    static constexpr auto moveInfoTA0L1T7R1D2 = std::to_array<MoveInfo>(
-        {
-            { { 31, 24, 0 }, 0, Pitch::down25deg },
-            { { 30, 24, 0 }, 0, Pitch::down25deg },
-            { { 29, 24, -1 }, 0, Pitch::down25deg },
-            { { 28, 24, -1 }, 0, Pitch::down25deg },
-            { { 27, 24, -2 }, 0, Pitch::down25deg },
-            { { 26, 24, -2 }, 0, Pitch::down25deg },
-            { { 25, 24, -3 }, 0, Pitch::down25deg },
-            { { 24, 24, -3 }, 0, Pitch::down25deg },
-            { { 23, 24, -4 }, 0, Pitch::down25deg },
-            { { 22, 24, -4 }, 0, Pitch::down25deg },
-            { { 21, 24, -5 }, 0, Pitch::down25deg },
-            { { 20, 24, -5 }, 0, Pitch::down25deg },
-            { { 19, 24, -6 }, 0, Pitch::down25deg },
-            { { 18, 24, -6 }, 0, Pitch::down25deg },
-            { { 17, 24, -7 }, 0, Pitch::down25deg },
-            { { 16, 24, -7 }, 0, Pitch::down25deg },
-            { { 15, 24, -8 }, 0, Pitch::down25deg },
-            { { 14, 24, -8 }, 0, Pitch::down25deg },
-            { { 13, 24, -9 }, 0, Pitch::down25deg },
-            { { 12, 24, -9 }, 0, Pitch::down25deg },
-            { { 11, 24, -10 }, 0, Pitch::down25deg },
-            { { 10, 24, -10 }, 0, Pitch::down25deg },
-            { { 9, 24, -11 }, 0, Pitch::down25deg },
-            { { 8, 24, -11 }, 0, Pitch::down25deg },
-            { { 7, 24, -12 }, 0, Pitch::down25deg },
-            { { 6, 24, -12 }, 0, Pitch::down25deg },
-            { { 5, 24, -13 }, 0, Pitch::down25deg },
-            { { 4, 24, -13 }, 0, Pitch::down25deg },
-            { { 3, 24, -14 }, 0, Pitch::down25deg },
-            { { 2, 24, -14 }, 0, Pitch::down25deg },
-            { { 1, 24, -15 }, 0, Pitch::down25deg },
-            { { 0, 24, -15 }, 0, Pitch::down25deg },
-        });
-
-    // 0x4dda80
-    // Turnaround 0. Lane 1. Track 7. Reversed 1. Direction 3
-    static constexpr auto moveInfoTA0L1T7R1D3 = std::to_array<MoveInfo>(
-        {
-            { { 24, 0, 0 }, 16, Pitch::down25deg },
-            { { 24, 1, 0 }, 16, Pitch::down25deg },
-            { { 24, 2, -1 }, 16, Pitch::down25deg },
-            { { 24, 3, -1 }, 16, Pitch::down25deg },
-            { { 24, 4, -2 }, 16, Pitch::down25deg },
-            { { 24, 5, -2 }, 16, Pitch::down25deg },
-            { { 24, 6, -3 }, 16, Pitch::down25deg },
-            { { 24, 7, -3 }, 16, Pitch::down25deg },
-            { { 24, 8, -4 }, 16, Pitch::down25deg },
-            { { 24, 9, -4 }, 16, Pitch::down25deg },
-            { { 24, 10, -5 }, 16, Pitch::down25deg },
-            { { 24, 11, -5 }, 16, Pitch::down25deg },
-            { { 24, 12, -6 }, 16, Pitch::down25deg },
-            { { 24, 13, -6 }, 16, Pitch::down25deg },
-            { { 24, 14, -7 }, 16, Pitch::down25deg },
-            { { 24, 15, -7 }, 16, Pitch::down25deg },
-            { { 24, 16, -8 }, 16, Pitch::down25deg },
-            { { 24, 17, -8 }, 16, Pitch::down25deg },
-            { { 24, 18, -9 }, 16, Pitch::down25deg },
-            { { 24, 19, -9 }, 16, Pitch::down25deg },
-            { { 24, 20, -10 }, 16, Pitch::down25deg },
-            { { 24, 21, -10 }, 16, Pitch::down25deg },
-            { { 24, 22, -11 }, 16, Pitch::down25deg },
-            { { 24, 23, -11 }, 16, Pitch::down25deg },
-            { { 24, 24, -12 }, 16, Pitch::down25deg },
-            { { 24, 25, -12 }, 16, Pitch::down25deg },
-            { { 24, 26, -13 }, 16, Pitch::down25deg },
-            { { 24, 27, -13 }, 16, Pitch::down25deg },
-            { { 24, 28, -14 }, 16, Pitch::down25deg },
-            { { 24, 29, -14 }, 16, Pitch::down25deg },
-            { { 24, 30, -15 }, 16, Pitch::down25deg },
-            { { 24, 31, -15 }, 16, Pitch::down25deg },
-        });
-
-    // 0x4df08e
-    // Turnaround 0. Lane 1. Track 9. Reversed 0. Direction 0
-    static constexpr auto moveInfoTA0L1T9R0D0 = std::to_array<MoveInfo>(
-        {
-            { { 31, 24, 0 }, 0, Pitch::flat },
-            { { 30, 24, 0 }, 0, Pitch::flat },
-            { { 29, 24, 0 }, 54, Pitch::flat },
-            { { 28, 23, 0 }, 54, Pitch::flat },
-            { { 27, 23, 0 }, 54, Pitch::flat },
-            { { 26, 22, 0 }, 52, Pitch::flat },
-            { { 25, 21, 0 }, 52, Pitch::flat },
-            { { 25, 20, 0 }, 50, Pitch::flat },
-            { { 24, 19, 0 }, 50, Pitch::flat },
-            { { 24, 18, 0 }, 50, Pitch::flat },
-            { { 24, 17, 0 }, 48, Pitch::flat },
-            { { 24, 16, 0 }, 48, Pitch::flat },
-            { { 24, 15, 0 }, 48, Pitch::flat },
-            { { 24, 14, 0 }, 38, Pitch::flat },
-            { { 24, 13, 0 }, 38, Pitch::flat },
-            { { 25, 12, 0 }, 38, Pitch::flat },
-            { { 25, 11, 0 }, 36, Pitch::flat },
-            { { 26, 10, 0 }, 36, Pitch::flat },
-            { { 27, 9, 0 }, 34, Pitch::flat },
-            { { 28, 9, 0 }, 34, Pitch::flat },
-            { { 29, 8, 0 }, 34, Pitch::flat },
-            { { 30, 8, 0 }, 32, Pitch::flat },
-            { { 31, 8, 0 }, 32, Pitch::flat },
-        });
-
-    // 0x4df148
-    // Turnaround 0. Lane 1. Track 9. Reversed 0. Direction 1
-    static constexpr auto moveInfoTA0L1T9R0D1 = std::to_array<MoveInfo>(
-        {
-            { { 24, 0, 0 }, 16, Pitch::flat },
-            { { 24, 1, 0 }, 16, Pitch::flat },
-            { { 24, 2, 0 }, 6, Pitch::flat },
-            { { 23, 3, 0 }, 6, Pitch::flat },
-            { { 23, 4, 0 }, 6, Pitch::flat },
-            { { 22, 5, 0 }, 4, Pitch::flat },
-            { { 21, 6, 0 }, 4, Pitch::flat },
-            { { 20, 6, 0 }, 2, Pitch::flat },
-            { { 19, 7, 0 }, 2, Pitch::flat },
-            { { 18, 7, 0 }, 2, Pitch::flat },
-            { { 17, 7, 0 }, 0, Pitch::flat },
-            { { 16, 7, 0 }, 0, Pitch::flat },
-            { { 15, 7, 0 }, 0, Pitch::flat },
-            { { 14, 7, 0 }, 54, Pitch::flat },
-            { { 13, 7, 0 }, 54, Pitch::flat },
-            { { 12, 6, 0 }, 54, Pitch::flat },
-            { { 11, 6, 0 }, 52, Pitch::flat },
-            { { 10, 5, 0 }, 52, Pitch::flat },
-            { { 9, 4, 0 }, 50, Pitch::flat },
-            { { 9, 3, 0 }, 50, Pitch::flat },
-            { { 8, 2, 0 }, 50, Pitch::flat },
-            { { 8, 1, 0 }, 48, Pitch::flat },
-            { { 8, 0, 0 }, 48, Pitch::flat },
-        });
-
-    // 0x4df202
-    // Turnaround 0. Lane 1. Track 9. Reversed 0. Direction 2
-    static constexpr auto moveInfoTA0L1T9R0D2 = std::to_array<MoveInfo>(
-        {
-            { { 0, 8, 0 }, 32, Pitch::flat },
-            { { 1, 8, 0 }, 32, Pitch::flat },
-            { { 2, 8, 0 }, 22, Pitch::flat },
-            { { 3, 9, 0 }, 22, Pitch::flat },
-            { { 4, 9, 0 }, 22, Pitch::flat },
-            { { 5, 10, 0 }, 20, Pitch::flat },
-            { { 6, 11, 0 }, 20, Pitch::flat },
-            { { 6, 12, 0 }, 18, Pitch::flat },
-            { { 7, 13, 0 }, 18, Pitch::flat },
-            { { 7, 14, 0 }, 18, Pitch::flat },
-            { { 7, 15, 0 }, 16, Pitch::flat },
-            { { 7, 16, 0 }, 16, Pitch::flat },
-            { { 7, 17, 0 }, 16, Pitch::flat },
-            { { 7, 18, 0 }, 6, Pitch::flat },
-            { { 7, 19, 0 }, 6, Pitch::flat },
-            { { 6, 20, 0 }, 6, Pitch::flat },
-            { { 6, 21, 0 }, 4, Pitch::flat },
-            { { 5, 22, 0 }, 4, Pitch::flat },
-            { { 4, 23, 0 }, 2, Pitch::flat },
-            { { 3, 23, 0 }, 2, Pitch::flat },
-            { { 2, 24, 0 }, 2, Pitch::flat },
-            { { 1, 24, 0 }, 0, Pitch::flat },
-            { { 0, 24, 0 }, 0, Pitch::flat },
-        });
-
-    // 0x4df2bc
-    // Turnaround 0. Lane 1. Track 9. Reversed 0. Direction 3
-    static constexpr auto moveInfoTA0L1T9R0D3 = std::to_array<MoveInfo>(
-        {
-            { { 8, 31, 0 }, 48, Pitch::flat },
-            { { 8, 30, 0 }, 48, Pitch::flat },
-            { { 8, 29, 0 }, 38, Pitch::flat },
-            { { 9, 28, 0 }, 38, Pitch::flat },
-            { { 9, 27, 0 }, 38, Pitch::flat },
-            { { 10, 26, 0 }, 36, Pitch::flat },
-            { { 11, 25, 0 }, 36, Pitch::flat },
-            { { 12, 25, 0 }, 34, Pitch::flat },
-            { { 13, 24, 0 }, 34, Pitch::flat },
-            { { 14, 24, 0 }, 34, Pitch::flat },
-            { { 15, 24, 0 }, 32, Pitch::flat },
-            { { 16, 24, 0 }, 32, Pitch::flat },
-            { { 17, 24, 0 }, 32, Pitch::flat },
-            { { 18, 24, 0 }, 22, Pitch::flat },
-            { { 19, 24, 0 }, 22, Pitch::flat },
-            { { 20, 25, 0 }, 22, Pitch::flat },
-            { { 21, 25, 0 }, 20, Pitch::flat },
-            { { 22, 26, 0 }, 20, Pitch::flat },
-            { { 23, 27, 0 }, 18, Pitch::flat },
-            { { 23, 28, 0 }, 18, Pitch::flat },
-            { { 24, 29, 0 }, 18, Pitch::flat },
-            { { 24, 30, 0 }, 16, Pitch::flat },
-            { { 24, 31, 0 }, 16, Pitch::flat },
-        });
-
-    // 0x4f217e
-    // Turnaround 1. Lane 0. Track 0. Reversed 0. Direction 0
-    static constexpr auto moveInfoTA1L0T0R0D0 = std::to_array<MoveInfo>(
-        {
-            { { 31, 8, 0 }, 0, Pitch::flat },
-            { { 30, 8, 0 }, 0, Pitch::flat },
-            { { 29, 9, 0 }, 0, Pitch::flat },
-            { { 28, 9, 0 }, 0, Pitch::flat },
-            { { 27, 10, 0 }, 0, Pitch::flat },
-            { { 26, 10, 0 }, 0, Pitch::flat },
-            { { 25, 11, 0 }, 0, Pitch::flat },
-            { { 24, 11, 0 }, 0, Pitch::flat },
-            { { 23, 12, 0 }, 0, Pitch::flat },
-            { { 22, 12, 0 }, 0, Pitch::flat },
-            { { 21, 13, 0 }, 0, Pitch::flat },
-            { { 20, 13, 0 }, 0, Pitch::flat },
-            { { 19, 14, 0 }, 0, Pitch::flat },
-            { { 18, 14, 0 }, 0, Pitch::flat },
-            { { 17, 15, 0 }, 0, Pitch::flat },
-            { { 16, 15, 0 }, 0, Pitch::flat },
-            { { 15, 16, 0 }, 0, Pitch::flat },
-            { { 14, 16, 0 }, 0, Pitch::flat },
-            { { 13, 17, 0 }, 0, Pitch::flat },
-            { { 12, 17, 0 }, 0, Pitch::flat },
-            { { 11, 18, 0 }, 0, Pitch::flat },
-            { { 10, 18, 0 }, 0, Pitch::flat },
-            { { 9, 19, 0 }, 0, Pitch::flat },
-            { { 8, 19, 0 }, 0, Pitch::flat },
-            { { 7, 20, 0 }, 0, Pitch::flat },
-            { { 6, 20, 0 }, 0, Pitch::flat },
-            { { 5, 21, 0 }, 0, Pitch::flat },
-            { { 4, 21, 0 }, 0, Pitch::flat },
-            { { 3, 22, 0 }, 0, Pitch::flat },
-            { { 2, 22, 0 }, 0, Pitch::flat },
-            { { 1, 23, 0 }, 0, Pitch::flat },
-            { { 0, 23, 0 }, 0, Pitch::flat },
-        });
-
-    // 0x4f2280
-    // Turnaround 1. Lane 0. Track 0. Reversed 0. Direction 1
-    static constexpr auto moveInfoTA1L0T0R0D1 = std::to_array<MoveInfo>(
-        {
-            { { 8, 0, 0 }, 16, Pitch::flat },
-            { { 8, 1, 0 }, 16, Pitch::flat },
-            { { 9, 2, 0 }, 16, Pitch::flat },
-            { { 9, 3, 0 }, 16, Pitch::flat },
-            { { 10, 4, 0 }, 16, Pitch::flat },
-            { { 10, 5, 0 }, 16, Pitch::flat },
-            { { 11, 6, 0 }, 16, Pitch::flat },
-            { { 11, 7, 0 }, 16, Pitch::flat },
-            { { 12, 8, 0 }, 16, Pitch::flat },
-            { { 12, 9, 0 }, 16, Pitch::flat },
-            { { 13, 10, 0 }, 16, Pitch::flat },
-            { { 13, 11, 0 }, 16, Pitch::flat },
-            { { 14, 12, 0 }, 16, Pitch::flat },
-            { { 14, 13, 0 }, 16, Pitch::flat },
-            { { 15, 14, 0 }, 16, Pitch::flat },
-            { { 15, 15, 0 }, 16, Pitch::flat },
-            { { 16, 16, 0 }, 16, Pitch::flat },
-            { { 16, 17, 0 }, 16, Pitch::flat },
-            { { 17, 18, 0 }, 16, Pitch::flat },
-            { { 17, 19, 0 }, 16, Pitch::flat },
-            { { 18, 20, 0 }, 16, Pitch::flat },
-            { { 18, 21, 0 }, 16, Pitch::flat },
-            { { 19, 22, 0 }, 16, Pitch::flat },
-            { { 19, 23, 0 }, 16, Pitch::flat },
-            { { 20, 24, 0 }, 16, Pitch::flat },
-            { { 20, 25, 0 }, 16, Pitch::flat },
-            { { 21, 26, 0 }, 16, Pitch::flat },
-            { { 21, 27, 0 }, 16, Pitch::flat },
-            { { 22, 28, 0 }, 16, Pitch::flat },
-            { { 22, 29, 0 }, 16, Pitch::flat },
-            { { 23, 30, 0 }, 16, Pitch::flat },
-            { { 23, 31, 0 }, 16, Pitch::flat },
-        });
-
-    // 0x4f2382
-    // Turnaround 1. Lane 0. Track 0. Reversed 0. Direction 2
-    static constexpr auto moveInfoTA1L0T0R0D2 = std::to_array<MoveInfo>(
-        {
-            { { 0, 24, 0 }, 32, Pitch::flat },
-            { { 1, 24, 0 }, 32, Pitch::flat },
-            { { 2, 23, 0 }, 32, Pitch::flat },
-            { { 3, 23, 0 }, 32, Pitch::flat },
-            { { 4, 22, 0 }, 32, Pitch::flat },
-            { { 5, 22, 0 }, 32, Pitch::flat },
-            { { 6, 21, 0 }, 32, Pitch::flat },
-            { { 7, 21, 0 }, 32, Pitch::flat },
-            { { 8, 20, 0 }, 32, Pitch::flat },
-            { { 9, 20, 0 }, 32, Pitch::flat },
-            { { 10, 19, 0 }, 32, Pitch::flat },
-            { { 11, 19, 0 }, 32, Pitch::flat },
-            { { 12, 18, 0 }, 32, Pitch::flat },
-            { { 13, 18, 0 }, 32, Pitch::flat },
-            { { 14, 17, 0 }, 32, Pitch::flat },
-            { { 15, 17, 0 }, 32, Pitch::flat },
-            { { 16, 16, 0 }, 32, Pitch::flat },
-            { { 17, 16, 0 }, 32, Pitch::flat },
-            { { 18, 15, 0 }, 32, Pitch::flat },
-            { { 19, 15, 0 }, 32, Pitch::flat },
-            { { 20, 14, 0 }, 32, Pitch::flat },
-            { { 21, 14, 0 }, 32, Pitch::flat },
-            { { 22, 13, 0 }, 32, Pitch::flat },
-            { { 23, 13, 0 }, 32, Pitch::flat },
-            { { 24, 12, 0 }, 32, Pitch::flat },
-            { { 25, 12, 0 }, 32, Pitch::flat },
-            { { 26, 11, 0 }, 32, Pitch::flat },
-            { { 27, 11, 0 }, 32, Pitch::flat },
-            { { 28, 10, 0 }, 32, Pitch::flat },
-            { { 29, 10, 0 }, 32, Pitch::flat },
-            { { 30, 9, 0 }, 32, Pitch::flat },
-            { { 31, 9, 0 }, 32, Pitch::flat },
-        });
-
-    // 0x4f2484
-    // Turnaround 1. Lane 0. Track 0. Reversed 0. Direction 3
-    static constexpr auto moveInfoTA1L0T0R0D3 = std::to_array<MoveInfo>(
-        {
-            { { 24, 31, 0 }, 48, Pitch::flat },
-            { { 24, 30, 0 }, 48, Pitch::flat },
-            { { 23, 29, 0 }, 48, Pitch::flat },
-            { { 23, 28, 0 }, 48, Pitch::flat },
-            { { 22, 27, 0 }, 48, Pitch::flat },
-            { { 22, 26, 0 }, 48, Pitch::flat },
-            { { 21, 25, 0 }, 48, Pitch::flat },
-            { { 21, 24, 0 }, 48, Pitch::flat },
-            { { 20, 23, 0 }, 48, Pitch::flat },
-            { { 20, 22, 0 }, 48, Pitch::flat },
-            { { 19, 21, 0 }, 48, Pitch::flat },
-            { { 19, 20, 0 }, 48, Pitch::flat },
-            { { 18, 19, 0 }, 48, Pitch::flat },
-            { { 18, 18, 0 }, 48, Pitch::flat },
-            { { 17, 17, 0 }, 48, Pitch::flat },
-            { { 17, 16, 0 }, 48, Pitch::flat },
-            { { 16, 15, 0 }, 48, Pitch::flat },
-            { { 16, 14, 0 }, 48, Pitch::flat },
-            { { 15, 13, 0 }, 48, Pitch::flat },
-            { { 15, 12, 0 }, 48, Pitch::flat },
-            { { 14, 11, 0 }, 48, Pitch::flat },
-            { { 14, 10, 0 }, 48, Pitch::flat },
-            { { 13, 9, 0 }, 48, Pitch::flat },
-            { { 13, 8, 0 }, 48, Pitch::flat },
-            { { 12, 7, 0 }, 48, Pitch::flat },
-            { { 12, 6, 0 }, 48, Pitch::flat },
-            { { 11, 5, 0 }, 48, Pitch::flat },
-            { { 11, 4, 0 }, 48, Pitch::flat },
-            { { 10, 3, 0 }, 48, Pitch::flat },
-            { { 10, 2, 0 }, 48, Pitch::flat },
-            { { 9, 1, 0 }, 48, Pitch::flat },
-            { { 9, 0, 0 }, 48, Pitch::flat },
-        });
-
-    // 0x4f39ae
-    // Turnaround 1. Lane 0. Track 1. Reversed 0. Direction 0
-    static constexpr auto moveInfoTA1L0T1R0D0 = std::to_array<MoveInfo>(
-        {
-            { { 31, 8, 0 }, 0, Pitch::flat },
-            { { 30, 8, 0 }, 0, Pitch::flat },
-            { { 29, 8, 0 }, 0, Pitch::flat },
-            { { 28, 8, 0 }, 0, Pitch::flat },
-            { { 27, 8, 0 }, 0, Pitch::flat },
-            { { 26, 8, 0 }, 0, Pitch::flat },
-            { { 25, 8, 0 }, 0, Pitch::flat },
-            { { 24, 8, 0 }, 0, Pitch::flat },
-            { { 23, 8, 0 }, 0, Pitch::flat },
-            { { 22, 8, 0 }, 0, Pitch::flat },
-            { { 21, 8, 0 }, 0, Pitch::flat },
-            { { 20, 8, 0 }, 0, Pitch::flat },
-            { { 19, 8, 0 }, 0, Pitch::flat },
-            { { 18, 8, 0 }, 0, Pitch::flat },
-            { { 17, 8, 0 }, 0, Pitch::flat },
-            { { 16, 8, 0 }, 0, Pitch::flat },
-            { { 15, 8, 0 }, 0, Pitch::flat },
-            { { 14, 8, 0 }, 0, Pitch::flat },
-            { { 13, 8, 0 }, 62, Pitch::flat },
-            { { 12, 7, 0 }, 60, Pitch::flat },
-            { { 11, 7, 0 }, 58, Pitch::flat },
-            { { 10, 6, 0 }, 56, Pitch::flat },
-            { { 9, 5, 0 }, 54, Pitch::flat },
-            { { 9, 4, 0 }, 52, Pitch::flat },
-            { { 8, 3, 0 }, 50, Pitch::flat },
-            { { 8, 2, 0 }, 48, Pitch::flat },
-            { { 8, 1, 0 }, 48, Pitch::flat },
-            { { 8, 0, 0 }, 48, Pitch::flat },
-        });
-
-    // 0x4f3a90
-    // Turnaround 1. Lane 0. Track 1. Reversed 0. Direction 1
-    static constexpr auto moveInfoTA1L0T1R0D1 = std::to_array<MoveInfo>(
-        {
-            { { 8, 0, 0 }, 16, Pitch::flat },
-            { { 8, 1, 0 }, 16, Pitch::flat },
-            { { 8, 2, 0 }, 16, Pitch::flat },
-            { { 8, 3, 0 }, 16, Pitch::flat },
-            { { 8, 4, 0 }, 16, Pitch::flat },
-            { { 8, 5, 0 }, 16, Pitch::flat },
-            { { 8, 6, 0 }, 16, Pitch::flat },
-            { { 8, 7, 0 }, 16, Pitch::flat },
-            { { 8, 8, 0 }, 16, Pitch::flat },
-            { { 8, 9, 0 }, 16, Pitch::flat },
-            { { 8, 10, 0 }, 16, Pitch::flat },
-            { { 8, 11, 0 }, 16, Pitch::flat },
-            { { 8, 12, 0 }, 16, Pitch::flat },
-            { { 8, 13, 0 }, 16, Pitch::flat },
-            { { 8, 14, 0 }, 16, Pitch::flat },
-            { { 8, 15, 0 }, 16, Pitch::flat },
-            { { 8, 16, 0 }, 16, Pitch::flat },
-            { { 8, 17, 0 }, 16, Pitch::flat },
-            { { 8, 18, 0 }, 14, Pitch::flat },
-            { { 7, 19, 0 }, 12, Pitch::flat },
-            { { 7, 20, 0 }, 10, Pitch::flat },
-            { { 6, 21, 0 }, 8, Pitch::flat },
-            { { 5, 22, 0 }, 8, Pitch::flat },
-            { { 4, 23, 0 }, 6, Pitch::flat },
-            { { 3, 23, 0 }, 4, Pitch::flat },
-            { { 2, 24, 0 }, 2, Pitch::flat },
-            { { 1, 24, 0 }, 0, Pitch::flat },
-            { { 0, 24, 0 }, 0, Pitch::flat },
-        });
-
-    // 0x4f3b72
-    // Turnaround 1. Lane 0. Track 1. Reversed 0. Direction 2
-    static constexpr auto moveInfoTA1L0T1R0D2 = std::to_array<MoveInfo>(
-        {
-            { { 0, 24, 0 }, 32, Pitch::flat },
-            { { 1, 24, 0 }, 32, Pitch::flat },
-            { { 2, 24, 0 }, 32, Pitch::flat },
-            { { 3, 24, 0 }, 32, Pitch::flat },
-            { { 4, 24, 0 }, 32, Pitch::flat },
-            { { 5, 24, 0 }, 32, Pitch::flat },
-            { { 6, 24, 0 }, 32, Pitch::flat },
-            { { 7, 24, 0 }, 32, Pitch::flat },
-            { { 8, 24, 0 }, 32, Pitch::flat },
-            { { 9, 24, 0 }, 32, Pitch::flat },
-            { { 10, 24, 0 }, 32, Pitch::flat },
-            { { 11, 24, 0 }, 32, Pitch::flat },
-            { { 12, 24, 0 }, 32, Pitch::flat },
-            { { 13, 24, 0 }, 32, Pitch::flat },
-            { { 14, 24, 0 }, 32, Pitch::flat },
-            { { 15, 24, 0 }, 32, Pitch::flat },
-            { { 16, 24, 0 }, 32, Pitch::flat },
-            { { 17, 24, 0 }, 32, Pitch::flat },
-            { { 18, 24, 0 }, 32, Pitch::flat },
-            { { 19, 24, 0 }, 30, Pitch::flat },
-            { { 20, 25, 0 }, 28, Pitch::flat },
-            { { 21, 25, 0 }, 26, Pitch::flat },
-            { { 22, 26, 0 }, 24, Pitch::flat },
-            { { 23, 27, 0 }, 22, Pitch::flat },
-            { { 23, 28, 0 }, 20, Pitch::flat },
-            { { 24, 29, 0 }, 18, Pitch::flat },
-            { { 24, 30, 0 }, 16, Pitch::flat },
-            { { 24, 31, 0 }, 16, Pitch::flat },
-        });
-
-    // 0x4f3c54
-    // Turnaround 1. Lane 0. Track 1. Reversed 0. Direction 3
-    static constexpr auto moveInfoTA1L0T1R0D3 = std::to_array<MoveInfo>(
-        {
-            { { 24, 31, 0 }, 48, Pitch::flat },
-            { { 24, 30, 0 }, 48, Pitch::flat },
-            { { 24, 29, 0 }, 48, Pitch::flat },
-            { { 24, 28, 0 }, 48, Pitch::flat },
-            { { 24, 27, 0 }, 48, Pitch::flat },
-            { { 24, 26, 0 }, 48, Pitch::flat },
-            { { 24, 25, 0 }, 48, Pitch::flat },
-            { { 24, 24, 0 }, 48, Pitch::flat },
-            { { 24, 23, 0 }, 48, Pitch::flat },
-            { { 24, 22, 0 }, 48, Pitch::flat },
-            { { 24, 21, 0 }, 48, Pitch::flat },
-            { { 24, 20, 0 }, 48, Pitch::flat },
-            { { 24, 19, 0 }, 48, Pitch::flat },
-            { { 24, 18, 0 }, 48, Pitch::flat },
-            { { 24, 17, 0 }, 48, Pitch::flat },
-            { { 24, 16, 0 }, 48, Pitch::flat },
-            { { 24, 15, 0 }, 48, Pitch::flat },
-            { { 24, 14, 0 }, 48, Pitch::flat },
-            { { 24, 13, 0 }, 46, Pitch::flat },
-            { { 25, 12, 0 }, 44, Pitch::flat },
-            { { 25, 11, 0 }, 42, Pitch::flat },
-            { { 26, 10, 0 }, 40, Pitch::flat },
-            { { 27, 9, 0 }, 38, Pitch::flat },
-            { { 28, 9, 0 }, 36, Pitch::flat },
-            { { 29, 8, 0 }, 34, Pitch::flat },
-            { { 30, 8, 0 }, 32, Pitch::flat },
-            { { 31, 8, 0 }, 32, Pitch::flat },
-        });
-
-    // 0x4f3e08
-    // Turnaround 1. Lane 0. Track 1. Reversed 1. Direction 0
-    static constexpr auto moveInfoTA1L0T1R1D0 = std::to_array<MoveInfo>(
-        {
-            { { 8, 0, 0 }, 16, Pitch::flat },
-            { { 8, 1, 0 }, 16, Pitch::flat },
-            { { 8, 2, 0 }, 16, Pitch::flat },
-            { { 8, 3, 0 }, 18, Pitch::flat },
-            { { 9, 4, 0 }, 20, Pitch::flat },
-            { { 9, 5, 0 }, 22, Pitch::flat },
-            { { 10, 6, 0 }, 24, Pitch::flat },
-            { { 11, 7, 0 }, 26, Pitch::flat },
-            { { 12, 7, 0 }, 28, Pitch::flat },
-            { { 13, 8, 0 }, 30, Pitch::flat },
-            { { 14, 8, 0 }, 32, Pitch::flat },
-            { { 15, 8, 0 }, 32, Pitch::flat },
-            { { 16, 8, 0 }, 32, Pitch::flat },
-            { { 17, 8, 0 }, 32, Pitch::flat },
-            { { 18, 8, 0 }, 32, Pitch::flat },
-            { { 19, 8, 0 }, 32, Pitch::flat },
-            { { 20, 8, 0 }, 32, Pitch::flat },
-            { { 21, 8, 0 }, 32, Pitch::flat },
-            { { 22, 8, 0 }, 32, Pitch::flat },
-            { { 23, 8, 0 }, 32, Pitch::flat },
-            { { 24, 8, 0 }, 32, Pitch::flat },
-            { { 25, 8, 0 }, 32, Pitch::flat },
-            { { 26, 8, 0 }, 32, Pitch::flat },
-            { { 27, 8, 0 }, 32, Pitch::flat },
-            { { 28, 8, 0 }, 32, Pitch::flat },
-            { { 29, 8, 0 }, 32, Pitch::flat },
-            { { 30, 8, 0 }, 32, Pitch::flat },
-            { { 31, 8, 0 }, 32, Pitch::flat },
-        });
-
-    // 0x4f3eea
-    // Turnaround 1. Lane 0. Track 1. Reversed 1. Direction 1
-    static constexpr auto moveInfoTA1L0T1R1D1 = std::to_array<MoveInfo>(
-        {
-            { { 0, 24, 0 }, 32, Pitch::flat },
-            { { 1, 24, 0 }, 32, Pitch::flat },
-            { { 2, 24, 0 }, 34, Pitch::flat },
-            { { 3, 23, 0 }, 36, Pitch::flat },
-            { { 4, 23, 0 }, 38, Pitch::flat },
-            { { 5, 22, 0 }, 40, Pitch::flat },
-            { { 6, 21, 0 }, 40, Pitch::flat },
-            { { 7, 20, 0 }, 42, Pitch::flat },
-            { { 7, 19, 0 }, 44, Pitch::flat },
-            { { 8, 18, 0 }, 46, Pitch::flat },
-            { { 8, 17, 0 }, 48, Pitch::flat },
-            { { 8, 16, 0 }, 48, Pitch::flat },
-            { { 8, 15, 0 }, 48, Pitch::flat },
-            { { 8, 14, 0 }, 48, Pitch::flat },
-            { { 8, 13, 0 }, 48, Pitch::flat },
-            { { 8, 12, 0 }, 48, Pitch::flat },
-            { { 8, 11, 0 }, 48, Pitch::flat },
-            { { 8, 10, 0 }, 48, Pitch::flat },
-            { { 8, 9, 0 }, 48, Pitch::flat },
-            { { 8, 8, 0 }, 48, Pitch::flat },
-            { { 8, 7, 0 }, 48, Pitch::flat },
-            { { 8, 6, 0 }, 48, Pitch::flat },
-            { { 8, 5, 0 }, 48, Pitch::flat },
-            { { 8, 4, 0 }, 48, Pitch::flat },
-            { { 8, 3, 0 }, 48, Pitch::flat },
-            { { 8, 2, 0 }, 48, Pitch::flat },
-            { { 8, 1, 0 }, 48, Pitch::flat },
-            { { 8, 0, 0 }, 48, Pitch::flat },
-        });
-
-    // 0x4f3fcc
-    // Turnaround 1. Lane 0. Track 1. Reversed 1. Direction 2
-    static constexpr auto moveInfoTA1L0T1R1D2 = std::to_array<MoveInfo>(
-        {
-            { { 24, 31, 0 }, 48, Pitch::flat },
-            { { 24, 30, 0 }, 48, Pitch::flat },
-            { { 24, 29, 0 }, 50, Pitch::flat },
-            { { 23, 28, 0 }, 52, Pitch::flat },
-            { { 23, 27, 0 }, 54, Pitch::flat },
-            { { 22, 26, 0 }, 56, Pitch::flat },
-            { { 21, 25, 0 }, 58, Pitch::flat },
-            { { 20, 25, 0 }, 60, Pitch::flat },
-            { { 19, 24, 0 }, 62, Pitch::flat },
-            { { 18, 24, 0 }, 0, Pitch::flat },
-            { { 17, 24, 0 }, 0, Pitch::flat },
-            { { 16, 24, 0 }, 0, Pitch::flat },
-            { { 15, 24, 0 }, 0, Pitch::flat },
-            { { 14, 24, 0 }, 0, Pitch::flat },
-            { { 13, 24, 0 }, 0, Pitch::flat },
-            { { 12, 24, 0 }, 0, Pitch::flat },
-            { { 11, 24, 0 }, 0, Pitch::flat },
-            { { 10, 24, 0 }, 0, Pitch::flat },
-            { { 9, 24, 0 }, 0, Pitch::flat },
-            { { 8, 24, 0 }, 0, Pitch::flat },
-            { { 7, 24, 0 }, 0, Pitch::flat },
-            { { 6, 24, 0 }, 0, Pitch::flat },
-            { { 5, 24, 0 }, 0, Pitch::flat },
-            { { 4, 24, 0 }, 0, Pitch::flat },
-            { { 3, 24, 0 }, 0, Pitch::flat },
-            { { 2, 24, 0 }, 0, Pitch::flat },
-            { { 1, 24, 0 }, 0, Pitch::flat },
-            { { 0, 24, 0 }, 0, Pitch::flat },
-        });
-
-    // 0x4f3d2e
-    // Turnaround 1. Lane 0. Track 1. Reversed 1. Direction 3
-    static constexpr auto moveInfoTA1L0T1R1D3 = std::to_array<MoveInfo>(
-        {
-            { { 31, 8, 0 }, 0, Pitch::flat },
-            { { 30, 8, 0 }, 0, Pitch::flat },
-            { { 29, 8, 0 }, 2, Pitch::flat },
-            { { 28, 9, 0 }, 4, Pitch::flat },
-            { { 27, 9, 0 }, 6, Pitch::flat },
-            { { 26, 10, 0 }, 8, Pitch::flat },
-            { { 25, 11, 0 }, 10, Pitch::flat },
-            { { 25, 12, 0 }, 12, Pitch::flat },
-            { { 24, 13, 0 }, 14, Pitch::flat },
-            { { 24, 14, 0 }, 16, Pitch::flat },
-            { { 24, 15, 0 }, 16, Pitch::flat },
-            { { 24, 16, 0 }, 16, Pitch::flat },
-            { { 24, 17, 0 }, 16, Pitch::flat },
-            { { 24, 18, 0 }, 16, Pitch::flat },
-            { { 24, 19, 0 }, 16, Pitch::flat },
-            { { 24, 20, 0 }, 16, Pitch::flat },
-            { { 24, 21, 0 }, 16, Pitch::flat },
-            { { 24, 22, 0 }, 16, Pitch::flat },
-            { { 24, 23, 0 }, 16, Pitch::flat },
-            { { 24, 24, 0 }, 16, Pitch::flat },
-            { { 24, 25, 0 }, 16, Pitch::flat },
-            { { 24, 26, 0 }, 16, Pitch::flat },
-            { { 24, 27, 0 }, 16, Pitch::flat },
-            { { 24, 28, 0 }, 16, Pitch::flat },
-            { { 24, 29, 0 }, 16, Pitch::flat },
-            { { 24, 30, 0 }, 16, Pitch::flat },
-            { { 24, 31, 0 }, 16, Pitch::flat },
-        });
-
-    // 0x4f47ae
-    // Turnaround 1. Lane 0. Track 3. Reversed 0. Direction 0
-    static constexpr auto moveInfoTA1L0T3R0D0 = std::to_array<MoveInfo>(
-        {
-            { { 31, 8, 0 }, 0, Pitch::flat },
-            { { 30, 8, 0 }, 0, Pitch::flat },
-            { { 29, 8, 0 }, 0, Pitch::flat },
-            { { 28, 8, 0 }, 0, Pitch::flat },
-            { { 27, 8, 0 }, 0, Pitch::flat },
-            { { 26, 8, 0 }, 0, Pitch::flat },
-            { { 25, 8, 0 }, 0, Pitch::flat },
-            { { 24, 8, 0 }, 0, Pitch::flat },
-            { { 23, 8, 0 }, 0, Pitch::flat },
-            { { 22, 8, 0 }, 0, Pitch::flat },
-            { { 21, 8, 0 }, 0, Pitch::flat },
-            { { 20, 8, 0 }, 0, Pitch::flat },
-            { { 19, 8, 0 }, 0, Pitch::flat },
-            { { 18, 8, 0 }, 0, Pitch::flat },
-            { { 17, 8, 0 }, 0, Pitch::flat },
-            { { 16, 8, 0 }, 0, Pitch::flat },
-            { { 15, 8, 0 }, 0, Pitch::flat },
-            { { 14, 8, 0 }, 0, Pitch::flat },
-            { { 13, 8, 0 }, 0, Pitch::flat },
-            { { 12, 8, 0 }, 62, Pitch::flat },
-            { { 11, 8, 0 }, 62, Pitch::flat },
-            { { 10, 8, 0 }, 62, Pitch::flat },
-            { { 9, 7, 0 }, 62, Pitch::flat },
-            { { 8, 7, 0 }, 62, Pitch::flat },
-            { { 7, 7, 0 }, 62, Pitch::flat },
-            { { 6, 7, 0 }, 62, Pitch::flat },
-            { { 5, 6, 0 }, 62, Pitch::flat },
-            { { 4, 6, 0 }, 60, Pitch::flat },
-            { { 3, 6, 0 }, 60, Pitch::flat },
-            { { 2, 6, 0 }, 60, Pitch::flat },
-            { { 1, 5, 0 }, 60, Pitch::flat },
-            { { 0, 5, 0 }, 60, Pitch::flat },
-            { { -1, 5, 0 }, 60, Pitch::flat },
-            { { -2, 4, 0 }, 60, Pitch::flat },
-            { { -3, 4, 0 }, 58, Pitch::flat },
-            { { -4, 3, 0 }, 58, Pitch::flat },
-            { { -5, 2, 0 }, 58, Pitch::flat },
-            { { -6, 2, 0 }, 58, Pitch::flat },
-            { { -7, 1, 0 }, 58, Pitch::flat },
-            { { -8, 0, 0 }, 58, Pitch::flat },
-            { { -9, -1, 0 }, 56, Pitch::flat },
-            { { -10, -2, 0 }, 56, Pitch::flat },
-            { { -11, -2, 0 }, 56, Pitch::flat },
-            { { -12, -3, 0 }, 56, Pitch::flat },
-            { { -13, -3, 0 }, 56, Pitch::flat },
-            { { -14, -4, 0 }, 56, Pitch::flat },
-            { { -14, -5, 0 }, 56, Pitch::flat },
-            { { -15, -6, 0 }, 54, Pitch::flat },
-            { { -16, -7, 0 }, 54, Pitch::flat },
-            { { -17, -8, 0 }, 54, Pitch::flat },
-            { { -18, -9, 0 }, 54, Pitch::flat },
-            { { -18, -10, 0 }, 54, Pitch::flat },
-            { { -19, -11, 0 }, 54, Pitch::flat },
-            { { -20, -12, 0 }, 54, Pitch::flat },
-            { { -20, -13, 0 }, 52, Pitch::flat },
-            { { -21, -14, 0 }, 52, Pitch::flat },
-            { { -21, -15, 0 }, 52, Pitch::flat },
-            { { -21, -16, 0 }, 52, Pitch::flat },
-            { { -22, -17, 0 }, 52, Pitch::flat },
-            { { -22, -18, 0 }, 52, Pitch::flat },
-            { { -22, -19, 0 }, 52, Pitch::flat },
-            { { -22, -20, 0 }, 52, Pitch::flat },
-            { { -23, -21, 0 }, 50, Pitch::flat },
-            { { -23, -22, 0 }, 50, Pitch::flat },
-            { { -23, -23, 0 }, 50, Pitch::flat },
-            { { -23, -24, 0 }, 50, Pitch::flat },
-            { { -24, -25, 0 }, 50, Pitch::flat },
-            { { -24, -26, 0 }, 50, Pitch::flat },
-            { { -24, -27, 0 }, 50, Pitch::flat },
-            { { -24, -28, 0 }, 48, Pitch::flat },
-            { { -24, -29, 0 }, 48, Pitch::flat },
-            { { -24, -30, 0 }, 48, Pitch::flat },
-            { { -24, -31, 0 }, 48, Pitch::flat },
-            { { -24, -32, 0 }, 48, Pitch::flat },
-        });
-
-    // 0x4f4a00
-    // Turnaround 1. Lane 0. Track 3. Reversed 0. Direction 1
-    static constexpr auto moveInfoTA1L0T3R0D1 = std::to_array<MoveInfo>(
-        {
-            { { 8, 0, 0 }, 16, Pitch::flat },
-            { { 8, 1, 0 }, 16, Pitch::flat },
-            { { 8, 2, 0 }, 16, Pitch::flat },
-            { { 8, 3, 0 }, 16, Pitch::flat },
-            { { 8, 4, 0 }, 16, Pitch::flat },
-            { { 8, 5, 0 }, 16, Pitch::flat },
-            { { 8, 6, 0 }, 16, Pitch::flat },
-            { { 8, 7, 0 }, 16, Pitch::flat },
-            { { 8, 8, 0 }, 16, Pitch::flat },
-            { { 8, 9, 0 }, 16, Pitch::flat },
-            { { 8, 10, 0 }, 16, Pitch::flat },
-            { { 8, 11, 0 }, 16, Pitch::flat },
-            { { 8, 12, 0 }, 16, Pitch::flat },
-            { { 8, 13, 0 }, 16, Pitch::flat },
-            { { 8, 14, 0 }, 16, Pitch::flat },
-            { { 8, 15, 0 }, 16, Pitch::flat },
-            { { 8, 16, 0 }, 16, Pitch::flat },
-            { { 8, 17, 0 }, 16, Pitch::flat },
-            { { 8, 18, 0 }, 16, Pitch::flat },
-            { { 8, 19, 0 }, 16, Pitch::flat },
-            { { 8, 20, 0 }, 14, Pitch::flat },
-            { { 8, 21, 0 }, 14, Pitch::flat },
-            { { 8, 22, 0 }, 14, Pitch::flat },
-            { { 7, 23, 0 }, 14, Pitch::flat },
-            { { 7, 24, 0 }, 14, Pitch::flat },
-            { { 7, 25, 0 }, 14, Pitch::flat },
-            { { 7, 26, 0 }, 14, Pitch::flat },
-            { { 6, 27, 0 }, 14, Pitch::flat },
-            { { 6, 28, 0 }, 12, Pitch::flat },
-            { { 6, 29, 0 }, 12, Pitch::flat },
-            { { 6, 30, 0 }, 12, Pitch::flat },
-            { { 5, 31, 0 }, 12, Pitch::flat },
-            { { 5, 32, 0 }, 12, Pitch::flat },
-            { { 5, 33, 0 }, 12, Pitch::flat },
-            { { 4, 34, 0 }, 12, Pitch::flat },
-            { { 4, 35, 0 }, 10, Pitch::flat },
-            { { 3, 36, 0 }, 10, Pitch::flat },
-            { { 2, 37, 0 }, 10, Pitch::flat },
-            { { 2, 38, 0 }, 10, Pitch::flat },
-            { { 1, 39, 0 }, 10, Pitch::flat },
-            { { 0, 40, 0 }, 10, Pitch::flat },
-            { { -1, 41, 0 }, 8, Pitch::flat },
-            { { -2, 42, 0 }, 8, Pitch::flat },
-            { { -2, 43, 0 }, 8, Pitch::flat },
-            { { -3, 44, 0 }, 8, Pitch::flat },
-            { { -3, 45, 0 }, 8, Pitch::flat },
-            { { -4, 46, 0 }, 8, Pitch::flat },
-            { { -5, 46, 0 }, 8, Pitch::flat },
-            { { -6, 47, 0 }, 6, Pitch::flat },
-            { { -7, 48, 0 }, 6, Pitch::flat },
-            { { -8, 49, 0 }, 6, Pitch::flat },
-            { { -9, 50, 0 }, 6, Pitch::flat },
-            { { -10, 50, 0 }, 6, Pitch::flat },
-            { { -11, 51, 0 }, 6, Pitch::flat },
-            { { -12, 52, 0 }, 6, Pitch::flat },
-            { { -13, 52, 0 }, 4, Pitch::flat },
-            { { -14, 53, 0 }, 4, Pitch::flat },
-            { { -15, 53, 0 }, 4, Pitch::flat },
-            { { -16, 53, 0 }, 4, Pitch::flat },
-            { { -17, 54, 0 }, 4, Pitch::flat },
-            { { -18, 54, 0 }, 4, Pitch::flat },
-            { { -19, 54, 0 }, 4, Pitch::flat },
-            { { -20, 54, 0 }, 4, Pitch::flat },
-            { { -21, 55, 0 }, 2, Pitch::flat },
-            { { -22, 55, 0 }, 2, Pitch::flat },
-            { { -23, 55, 0 }, 2, Pitch::flat },
-            { { -24, 55, 0 }, 2, Pitch::flat },
-            { { -25, 56, 0 }, 2, Pitch::flat },
-            { { -26, 56, 0 }, 2, Pitch::flat },
-            { { -27, 56, 0 }, 2, Pitch::flat },
-            { { -28, 56, 0 }, 0, Pitch::flat },
-            { { -29, 56, 0 }, 0, Pitch::flat },
-            { { -30, 56, 0 }, 0, Pitch::flat },
-            { { -31, 56, 0 }, 0, Pitch::flat },
-            { { -32, 56, 0 }, 0, Pitch::flat },
-        });
-
-    // 0x4f4c5a
-    // Turnaround 1. Lane 0. Track 3. Reversed 0. Direction 2
-    static constexpr auto moveInfoTA1L0T3R0D2 = std::to_array<MoveInfo>(
-        {
-            { { 0, 24, 0 }, 32, Pitch::flat },
-            { { 1, 24, 0 }, 32, Pitch::flat },
-            { { 2, 24, 0 }, 32, Pitch::flat },
-            { { 3, 24, 0 }, 32, Pitch::flat },
-            { { 4, 24, 0 }, 32, Pitch::flat },
-            { { 5, 24, 0 }, 32, Pitch::flat },
-            { { 6, 24, 0 }, 32, Pitch::flat },
-            { { 7, 24, 0 }, 32, Pitch::flat },
-            { { 8, 24, 0 }, 32, Pitch::flat },
-            { { 9, 24, 0 }, 32, Pitch::flat },
-            { { 10, 24, 0 }, 32, Pitch::flat },
-            { { 11, 24, 0 }, 32, Pitch::flat },
-            { { 12, 24, 0 }, 32, Pitch::flat },
-            { { 13, 24, 0 }, 32, Pitch::flat },
-            { { 14, 24, 0 }, 32, Pitch::flat },
-            { { 15, 24, 0 }, 32, Pitch::flat },
-            { { 16, 24, 0 }, 32, Pitch::flat },
-            { { 17, 24, 0 }, 32, Pitch::flat },
-            { { 18, 24, 0 }, 32, Pitch::flat },
-            { { 19, 24, 0 }, 32, Pitch::flat },
-            { { 20, 24, 0 }, 30, Pitch::flat },
-            { { 21, 24, 0 }, 30, Pitch::flat },
-            { { 22, 24, 0 }, 30, Pitch::flat },
-            { { 23, 25, 0 }, 30, Pitch::flat },
-            { { 24, 25, 0 }, 30, Pitch::flat },
-            { { 25, 25, 0 }, 30, Pitch::flat },
-            { { 26, 25, 0 }, 30, Pitch::flat },
-            { { 27, 26, 0 }, 30, Pitch::flat },
-            { { 28, 26, 0 }, 28, Pitch::flat },
-            { { 29, 26, 0 }, 28, Pitch::flat },
-            { { 30, 26, 0 }, 28, Pitch::flat },
-            { { 31, 27, 0 }, 28, Pitch::flat },
-            { { 32, 27, 0 }, 28, Pitch::flat },
-            { { 33, 27, 0 }, 28, Pitch::flat },
-            { { 34, 28, 0 }, 28, Pitch::flat },
-            { { 35, 28, 0 }, 26, Pitch::flat },
-            { { 36, 29, 0 }, 26, Pitch::flat },
-            { { 37, 30, 0 }, 26, Pitch::flat },
-            { { 38, 30, 0 }, 26, Pitch::flat },
-            { { 39, 31, 0 }, 26, Pitch::flat },
-            { { 40, 32, 0 }, 26, Pitch::flat },
-            { { 41, 33, 0 }, 24, Pitch::flat },
-            { { 42, 34, 0 }, 24, Pitch::flat },
-            { { 43, 34, 0 }, 24, Pitch::flat },
-            { { 44, 35, 0 }, 24, Pitch::flat },
-            { { 45, 35, 0 }, 24, Pitch::flat },
-            { { 46, 36, 0 }, 24, Pitch::flat },
-            { { 46, 37, 0 }, 24, Pitch::flat },
-            { { 47, 38, 0 }, 22, Pitch::flat },
-            { { 48, 39, 0 }, 22, Pitch::flat },
-            { { 49, 40, 0 }, 22, Pitch::flat },
-            { { 50, 41, 0 }, 22, Pitch::flat },
-            { { 50, 42, 0 }, 22, Pitch::flat },
-            { { 51, 43, 0 }, 22, Pitch::flat },
-            { { 52, 44, 0 }, 22, Pitch::flat },
-            { { 52, 45, 0 }, 20, Pitch::flat },
-            { { 53, 46, 0 }, 20, Pitch::flat },
-            { { 53, 47, 0 }, 20, Pitch::flat },
-            { { 53, 48, 0 }, 20, Pitch::flat },
-            { { 54, 49, 0 }, 20, Pitch::flat },
-            { { 54, 50, 0 }, 20, Pitch::flat },
-            { { 54, 51, 0 }, 20, Pitch::flat },
-            { { 54, 52, 0 }, 20, Pitch::flat },
-            { { 55, 53, 0 }, 18, Pitch::flat },
-            { { 55, 54, 0 }, 18, Pitch::flat },
-            { { 55, 55, 0 }, 18, Pitch::flat },
-            { { 55, 56, 0 }, 18, Pitch::flat },
-            { { 56, 57, 0 }, 18, Pitch::flat },
-            { { 56, 58, 0 }, 18, Pitch::flat },
-            { { 56, 59, 0 }, 18, Pitch::flat },
-            { { 56, 60, 0 }, 16, Pitch::flat },
-            { { 56, 61, 0 }, 16, Pitch::flat },
-            { { 56, 62, 0 }, 16, Pitch::flat },
-            { { 56, 63, 0 }, 16, Pitch::flat },
-        });
-
-    // 0x4f4eac
-    // Turnaround 1. Lane 0. Track 3. Reversed 0. Direction 3
-    static constexpr auto moveInfoTA1L0T3R0D3 = std::to_array<MoveInfo>(
-        {
-            { { 24, 31, 0 }, 48, Pitch::flat },
-            { { 24, 30, 0 }, 48, Pitch::flat },
-            { { 24, 29, 0 }, 48, Pitch::flat },
-            { { 24, 28, 0 }, 48, Pitch::flat },
-            { { 24, 27, 0 }, 48, Pitch::flat },
-            { { 24, 26, 0 }, 48, Pitch::flat },
-            { { 24, 25, 0 }, 48, Pitch::flat },
-            { { 24, 24, 0 }, 48, Pitch::flat },
-            { { 24, 23, 0 }, 48, Pitch::flat },
-            { { 24, 22, 0 }, 48, Pitch::flat },
-            { { 24, 21, 0 }, 48, Pitch::flat },
-            { { 24, 20, 0 }, 48, Pitch::flat },
-            { { 24, 19, 0 }, 48, Pitch::flat },
-            { { 24, 18, 0 }, 48, Pitch::flat },
-            { { 24, 17, 0 }, 48, Pitch::flat },
-            { { 24, 16, 0 }, 48, Pitch::flat },
-            { { 24, 15, 0 }, 48, Pitch::flat },
-            { { 24, 14, 0 }, 48, Pitch::flat },
-            { { 24, 13, 0 }, 48, Pitch::flat },
-            { { 24, 12, 0 }, 46, Pitch::flat },
-            { { 24, 11, 0 }, 46, Pitch::flat },
-            { { 24, 10, 0 }, 46, Pitch::flat },
-            { { 25, 9, 0 }, 46, Pitch::flat },
-            { { 25, 8, 0 }, 46, Pitch::flat },
-            { { 25, 7, 0 }, 46, Pitch::flat },
-            { { 25, 6, 0 }, 46, Pitch::flat },
-            { { 26, 5, 0 }, 46, Pitch::flat },
-            { { 26, 4, 0 }, 44, Pitch::flat },
-            { { 26, 3, 0 }, 44, Pitch::flat },
-            { { 26, 2, 0 }, 44, Pitch::flat },
-            { { 27, 1, 0 }, 44, Pitch::flat },
-            { { 27, 0, 0 }, 44, Pitch::flat },
-            { { 27, -1, 0 }, 44, Pitch::flat },
-            { { 28, -2, 0 }, 44, Pitch::flat },
-            { { 28, -3, 0 }, 42, Pitch::flat },
-            { { 29, -4, 0 }, 42, Pitch::flat },
-            { { 30, -5, 0 }, 42, Pitch::flat },
-            { { 30, -6, 0 }, 42, Pitch::flat },
-            { { 31, -7, 0 }, 42, Pitch::flat },
-            { { 32, -8, 0 }, 42, Pitch::flat },
-            { { 33, -9, 0 }, 40, Pitch::flat },
-            { { 34, -10, 0 }, 40, Pitch::flat },
-            { { 34, -11, 0 }, 40, Pitch::flat },
-            { { 35, -12, 0 }, 40, Pitch::flat },
-            { { 35, -13, 0 }, 40, Pitch::flat },
-            { { 36, -14, 0 }, 40, Pitch::flat },
-            { { 37, -14, 0 }, 40, Pitch::flat },
-            { { 38, -15, 0 }, 38, Pitch::flat },
-            { { 39, -16, 0 }, 38, Pitch::flat },
-            { { 40, -17, 0 }, 38, Pitch::flat },
-            { { 41, -18, 0 }, 38, Pitch::flat },
-            { { 42, -18, 0 }, 38, Pitch::flat },
-            { { 43, -19, 0 }, 38, Pitch::flat },
-            { { 44, -20, 0 }, 38, Pitch::flat },
-            { { 45, -20, 0 }, 36, Pitch::flat },
-            { { 46, -21, 0 }, 36, Pitch::flat },
-            { { 47, -21, 0 }, 36, Pitch::flat },
-            { { 48, -21, 0 }, 36, Pitch::flat },
-            { { 49, -22, 0 }, 36, Pitch::flat },
-            { { 50, -22, 0 }, 36, Pitch::flat },
-            { { 51, -22, 0 }, 36, Pitch::flat },
-            { { 52, -22, 0 }, 36, Pitch::flat },
-            { { 53, -23, 0 }, 34, Pitch::flat },
-            { { 54, -23, 0 }, 34, Pitch::flat },
-            { { 55, -23, 0 }, 34, Pitch::flat },
-            { { 56, -23, 0 }, 34, Pitch::flat },
-            { { 57, -24, 0 }, 34, Pitch::flat },
-            { { 58, -24, 0 }, 34, Pitch::flat },
-            { { 59, -24, 0 }, 34, Pitch::flat },
-            { { 60, -24, 0 }, 32, Pitch::flat },
-            { { 61, -24, 0 }, 32, Pitch::flat },
-            { { 62, -24, 0 }, 32, Pitch::flat },
-            { { 63, -24, 0 }, 32, Pitch::flat },
-        });
-
-    // 0x4f5340
-    // Turnaround 1. Lane 0. Track 3. Reversed 1. Direction 0
-    static constexpr auto moveInfoTA1L0T3R1D0 = std::to_array<MoveInfo>(
-        {
-            { { 8, 0, 0 }, 16, Pitch::flat },
-            { { 8, 1, 0 }, 16, Pitch::flat },
-            { { 8, 2, 0 }, 16, Pitch::flat },
-            { { 8, 3, 0 }, 16, Pitch::flat },
-            { { 8, 4, 0 }, 18, Pitch::flat },
-            { { 8, 5, 0 }, 18, Pitch::flat },
-            { { 8, 6, 0 }, 18, Pitch::flat },
-            { { 9, 7, 0 }, 18, Pitch::flat },
-            { { 9, 8, 0 }, 18, Pitch::flat },
-            { { 9, 9, 0 }, 18, Pitch::flat },
-            { { 9, 10, 0 }, 18, Pitch::flat },
-            { { 10, 11, 0 }, 18, Pitch::flat },
-            { { 10, 12, 0 }, 20, Pitch::flat },
-            { { 10, 13, 0 }, 20, Pitch::flat },
-            { { 10, 14, 0 }, 20, Pitch::flat },
-            { { 11, 15, 0 }, 20, Pitch::flat },
-            { { 11, 16, 0 }, 20, Pitch::flat },
-            { { 11, 17, 0 }, 20, Pitch::flat },
-            { { 12, 18, 0 }, 20, Pitch::flat },
-            { { 12, 19, 0 }, 22, Pitch::flat },
-            { { 13, 20, 0 }, 22, Pitch::flat },
-            { { 14, 21, 0 }, 22, Pitch::flat },
-            { { 14, 22, 0 }, 22, Pitch::flat },
-            { { 15, 23, 0 }, 22, Pitch::flat },
-            { { 16, 24, 0 }, 22, Pitch::flat },
-            { { 17, 25, 0 }, 24, Pitch::flat },
-            { { 18, 26, 0 }, 24, Pitch::flat },
-            { { 18, 27, 0 }, 24, Pitch::flat },
-            { { 19, 28, 0 }, 24, Pitch::flat },
-            { { 19, 29, 0 }, 24, Pitch::flat },
-            { { 20, 30, 0 }, 24, Pitch::flat },
-            { { 21, 30, 0 }, 24, Pitch::flat },
-            { { 22, 31, 0 }, 26, Pitch::flat },
-            { { 23, 32, 0 }, 26, Pitch::flat },
-            { { 24, 33, 0 }, 26, Pitch::flat },
-            { { 25, 34, 0 }, 26, Pitch::flat },
-            { { 26, 34, 0 }, 26, Pitch::flat },
-            { { 27, 35, 0 }, 26, Pitch::flat },
-            { { 28, 36, 0 }, 26, Pitch::flat },
-            { { 29, 36, 0 }, 28, Pitch::flat },
-            { { 30, 37, 0 }, 28, Pitch::flat },
-            { { 31, 37, 0 }, 28, Pitch::flat },
-            { { 32, 37, 0 }, 28, Pitch::flat },
-            { { 33, 38, 0 }, 28, Pitch::flat },
-            { { 34, 38, 0 }, 28, Pitch::flat },
-            { { 35, 38, 0 }, 28, Pitch::flat },
-            { { 36, 38, 0 }, 28, Pitch::flat },
-            { { 37, 39, 0 }, 30, Pitch::flat },
-            { { 38, 39, 0 }, 30, Pitch::flat },
-            { { 39, 39, 0 }, 30, Pitch::flat },
-            { { 40, 39, 0 }, 30, Pitch::flat },
-            { { 41, 40, 0 }, 30, Pitch::flat },
-            { { 42, 40, 0 }, 30, Pitch::flat },
-            { { 43, 40, 0 }, 30, Pitch::flat },
-            { { 44, 40, 0 }, 32, Pitch::flat },
-            { { 45, 40, 0 }, 32, Pitch::flat },
-            { { 46, 40, 0 }, 32, Pitch::flat },
-            { { 47, 40, 0 }, 32, Pitch::flat },
-            { { 48, 40, 0 }, 32, Pitch::flat },
-            { { 49, 40, 0 }, 32, Pitch::flat },
-            { { 50, 40, 0 }, 32, Pitch::flat },
-            { { 51, 40, 0 }, 32, Pitch::flat },
-            { { 52, 40, 0 }, 32, Pitch::flat },
-            { { 53, 40, 0 }, 32, Pitch::flat },
-            { { 54, 40, 0 }, 32, Pitch::flat },
-            { { 55, 40, 0 }, 32, Pitch::flat },
-            { { 56, 40, 0 }, 32, Pitch::flat },
-            { { 57, 40, 0 }, 32, Pitch::flat },
-            { { 58, 40, 0 }, 32, Pitch::flat },
-            { { 59, 40, 0 }, 32, Pitch::flat },
-            { { 60, 40, 0 }, 32, Pitch::flat },
-            { { 61, 40, 0 }, 32, Pitch::flat },
-            { { 62, 40, 0 }, 32, Pitch::flat },
-            { { 63, 40, 0 }, 32, Pitch::flat },
-        });
-
-    // 0x4f5592
-    // Turnaround 1. Lane 0. Track 3. Reversed 1. Direction 1
-    static constexpr auto moveInfoTA1L0T3R1D1 = std::to_array<MoveInfo>(
-        {
-            { { 0, 24, 0 }, 32, Pitch::flat },
-            { { 1, 24, 0 }, 32, Pitch::flat },
-            { { 2, 24, 0 }, 32, Pitch::flat },
-            { { 3, 24, 0 }, 32, Pitch::flat },
-            { { 4, 24, 0 }, 34, Pitch::flat },
-            { { 5, 24, 0 }, 34, Pitch::flat },
-            { { 6, 24, 0 }, 34, Pitch::flat },
-            { { 7, 23, 0 }, 34, Pitch::flat },
-            { { 8, 23, 0 }, 34, Pitch::flat },
-            { { 9, 23, 0 }, 34, Pitch::flat },
-            { { 10, 23, 0 }, 34, Pitch::flat },
-            { { 11, 22, 0 }, 34, Pitch::flat },
-            { { 12, 22, 0 }, 36, Pitch::flat },
-            { { 13, 22, 0 }, 36, Pitch::flat },
-            { { 14, 22, 0 }, 36, Pitch::flat },
-            { { 15, 21, 0 }, 36, Pitch::flat },
-            { { 16, 21, 0 }, 36, Pitch::flat },
-            { { 17, 21, 0 }, 36, Pitch::flat },
-            { { 18, 20, 0 }, 36, Pitch::flat },
-            { { 19, 20, 0 }, 38, Pitch::flat },
-            { { 20, 19, 0 }, 38, Pitch::flat },
-            { { 21, 18, 0 }, 38, Pitch::flat },
-            { { 22, 18, 0 }, 38, Pitch::flat },
-            { { 23, 17, 0 }, 38, Pitch::flat },
-            { { 24, 16, 0 }, 38, Pitch::flat },
-            { { 25, 15, 0 }, 40, Pitch::flat },
-            { { 26, 14, 0 }, 40, Pitch::flat },
-            { { 27, 14, 0 }, 40, Pitch::flat },
-            { { 28, 13, 0 }, 40, Pitch::flat },
-            { { 29, 13, 0 }, 40, Pitch::flat },
-            { { 30, 12, 0 }, 40, Pitch::flat },
-            { { 30, 11, 0 }, 40, Pitch::flat },
-            { { 31, 10, 0 }, 42, Pitch::flat },
-            { { 32, 9, 0 }, 42, Pitch::flat },
-            { { 33, 8, 0 }, 42, Pitch::flat },
-            { { 34, 7, 0 }, 42, Pitch::flat },
-            { { 34, 6, 0 }, 42, Pitch::flat },
-            { { 35, 5, 0 }, 42, Pitch::flat },
-            { { 36, 4, 0 }, 42, Pitch::flat },
-            { { 36, 3, 0 }, 44, Pitch::flat },
-            { { 37, 2, 0 }, 44, Pitch::flat },
-            { { 37, 1, 0 }, 44, Pitch::flat },
-            { { 37, 0, 0 }, 44, Pitch::flat },
-            { { 38, -1, 0 }, 44, Pitch::flat },
-            { { 38, -2, 0 }, 44, Pitch::flat },
-            { { 38, -3, 0 }, 44, Pitch::flat },
-            { { 38, -4, 0 }, 44, Pitch::flat },
-            { { 39, -5, 0 }, 46, Pitch::flat },
-            { { 39, -6, 0 }, 46, Pitch::flat },
-            { { 39, -7, 0 }, 46, Pitch::flat },
-            { { 39, -8, 0 }, 46, Pitch::flat },
-            { { 40, -9, 0 }, 46, Pitch::flat },
-            { { 40, -10, 0 }, 46, Pitch::flat },
-            { { 40, -11, 0 }, 46, Pitch::flat },
-            { { 40, -12, 0 }, 48, Pitch::flat },
-            { { 40, -13, 0 }, 48, Pitch::flat },
-            { { 40, -14, 0 }, 48, Pitch::flat },
-            { { 40, -15, 0 }, 48, Pitch::flat },
-            { { 40, -16, 0 }, 48, Pitch::flat },
-            { { 40, -17, 0 }, 48, Pitch::flat },
-            { { 40, -18, 0 }, 48, Pitch::flat },
-            { { 40, -19, 0 }, 48, Pitch::flat },
-            { { 40, -20, 0 }, 48, Pitch::flat },
-            { { 40, -21, 0 }, 48, Pitch::flat },
-            { { 40, -22, 0 }, 48, Pitch::flat },
-            { { 40, -23, 0 }, 48, Pitch::flat },
-            { { 40, -24, 0 }, 48, Pitch::flat },
-            { { 40, -25, 0 }, 48, Pitch::flat },
-            { { 40, -26, 0 }, 48, Pitch::flat },
-            { { 40, -27, 0 }, 48, Pitch::flat },
-            { { 40, -28, 0 }, 48, Pitch::flat },
-            { { 40, -29, 0 }, 48, Pitch::flat },
-            { { 40, -30, 0 }, 48, Pitch::flat },
-            { { 40, -31, 0 }, 48, Pitch::flat },
-            { { 40, -32, 0 }, 48, Pitch::flat },
-        });
-
-    // 0x4f57ec
-    // Turnaround 1. Lane 0. Track 3. Reversed 1. Direction 2
-    static constexpr auto moveInfoTA1L0T3R1D2 = std::to_array<MoveInfo>(
-        {
-            { { 24, 31, 0 }, 48, Pitch::flat },
-            { { 24, 30, 0 }, 48, Pitch::flat },
-            { { 24, 29, 0 }, 48, Pitch::flat },
-            { { 24, 28, 0 }, 50, Pitch::flat },
-            { { 24, 27, 0 }, 50, Pitch::flat },
-            { { 24, 26, 0 }, 50, Pitch::flat },
-            { { 23, 25, 0 }, 50, Pitch::flat },
-            { { 23, 24, 0 }, 50, Pitch::flat },
-            { { 23, 23, 0 }, 50, Pitch::flat },
-            { { 23, 22, 0 }, 50, Pitch::flat },
-            { { 22, 21, 0 }, 50, Pitch::flat },
-            { { 22, 20, 0 }, 52, Pitch::flat },
-            { { 22, 19, 0 }, 52, Pitch::flat },
-            { { 22, 18, 0 }, 52, Pitch::flat },
-            { { 21, 17, 0 }, 52, Pitch::flat },
-            { { 21, 16, 0 }, 52, Pitch::flat },
-            { { 21, 15, 0 }, 52, Pitch::flat },
-            { { 20, 14, 0 }, 52, Pitch::flat },
-            { { 20, 13, 0 }, 54, Pitch::flat },
-            { { 19, 12, 0 }, 54, Pitch::flat },
-            { { 18, 11, 0 }, 54, Pitch::flat },
-            { { 18, 10, 0 }, 54, Pitch::flat },
-            { { 17, 9, 0 }, 54, Pitch::flat },
-            { { 16, 8, 0 }, 54, Pitch::flat },
-            { { 15, 7, 0 }, 56, Pitch::flat },
-            { { 14, 6, 0 }, 56, Pitch::flat },
-            { { 14, 5, 0 }, 56, Pitch::flat },
-            { { 13, 4, 0 }, 56, Pitch::flat },
-            { { 13, 3, 0 }, 56, Pitch::flat },
-            { { 12, 2, 0 }, 56, Pitch::flat },
-            { { 11, 2, 0 }, 56, Pitch::flat },
-            { { 10, 1, 0 }, 58, Pitch::flat },
-            { { 9, 0, 0 }, 58, Pitch::flat },
-            { { 8, -1, 0 }, 58, Pitch::flat },
-            { { 7, -2, 0 }, 58, Pitch::flat },
-            { { 6, -2, 0 }, 58, Pitch::flat },
-            { { 5, -3, 0 }, 58, Pitch::flat },
-            { { 4, -4, 0 }, 58, Pitch::flat },
-            { { 3, -4, 0 }, 60, Pitch::flat },
-            { { 2, -5, 0 }, 60, Pitch::flat },
-            { { 1, -5, 0 }, 60, Pitch::flat },
-            { { 0, -5, 0 }, 60, Pitch::flat },
-            { { -1, -6, 0 }, 60, Pitch::flat },
-            { { -2, -6, 0 }, 60, Pitch::flat },
-            { { -3, -6, 0 }, 60, Pitch::flat },
-            { { -4, -6, 0 }, 60, Pitch::flat },
-            { { -5, -7, 0 }, 62, Pitch::flat },
-            { { -6, -7, 0 }, 62, Pitch::flat },
-            { { -7, -7, 0 }, 62, Pitch::flat },
-            { { -8, -7, 0 }, 62, Pitch::flat },
-            { { -9, -8, 0 }, 62, Pitch::flat },
-            { { -10, -8, 0 }, 62, Pitch::flat },
-            { { -11, -8, 0 }, 62, Pitch::flat },
-            { { -12, -8, 0 }, 0, Pitch::flat },
-            { { -13, -8, 0 }, 0, Pitch::flat },
-            { { -14, -8, 0 }, 0, Pitch::flat },
-            { { -15, -8, 0 }, 0, Pitch::flat },
-            { { -16, -8, 0 }, 0, Pitch::flat },
-            { { -17, -8, 0 }, 0, Pitch::flat },
-            { { -18, -8, 0 }, 0, Pitch::flat },
-            { { -19, -8, 0 }, 0, Pitch::flat },
-            { { -20, -8, 0 }, 0, Pitch::flat },
-            { { -21, -8, 0 }, 0, Pitch::flat },
-            { { -22, -8, 0 }, 0, Pitch::flat },
-            { { -23, -8, 0 }, 0, Pitch::flat },
-            { { -24, -8, 0 }, 0, Pitch::flat },
-            { { -25, -8, 0 }, 0, Pitch::flat },
-            { { -26, -8, 0 }, 0, Pitch::flat },
-            { { -27, -8, 0 }, 0, Pitch::flat },
-            { { -28, -8, 0 }, 0, Pitch::flat },
-            { { -29, -8, 0 }, 0, Pitch::flat },
-            { { -30, -8, 0 }, 0, Pitch::flat },
-            { { -31, -8, 0 }, 0, Pitch::flat },
-            { { -32, -8, 0 }, 0, Pitch::flat },
-        });
-
-    // 0x4f50f6
-    // Turnaround 1. Lane 0. Track 3. Reversed 1. Direction 3
-    static constexpr auto moveInfoTA1L0T3R1D3 = std::to_array<MoveInfo>(
-        {
-            { { 31, 8, 0 }, 0, Pitch::flat },
-            { { 30, 8, 0 }, 0, Pitch::flat },
-            { { 29, 8, 0 }, 0, Pitch::flat },
-            { { 28, 8, 0 }, 2, Pitch::flat },
-            { { 27, 8, 0 }, 2, Pitch::flat },
-            { { 26, 8, 0 }, 2, Pitch::flat },
-            { { 25, 9, 0 }, 2, Pitch::flat },
-            { { 24, 9, 0 }, 2, Pitch::flat },
-            { { 23, 9, 0 }, 2, Pitch::flat },
-            { { 22, 9, 0 }, 2, Pitch::flat },
-            { { 21, 10, 0 }, 2, Pitch::flat },
-            { { 20, 10, 0 }, 4, Pitch::flat },
-            { { 19, 10, 0 }, 4, Pitch::flat },
-            { { 18, 10, 0 }, 4, Pitch::flat },
-            { { 17, 11, 0 }, 4, Pitch::flat },
-            { { 16, 11, 0 }, 4, Pitch::flat },
-            { { 15, 11, 0 }, 4, Pitch::flat },
-            { { 14, 12, 0 }, 4, Pitch::flat },
-            { { 13, 12, 0 }, 6, Pitch::flat },
-            { { 12, 13, 0 }, 6, Pitch::flat },
-            { { 11, 14, 0 }, 6, Pitch::flat },
-            { { 10, 14, 0 }, 6, Pitch::flat },
-            { { 9, 15, 0 }, 6, Pitch::flat },
-            { { 8, 16, 0 }, 6, Pitch::flat },
-            { { 7, 17, 0 }, 8, Pitch::flat },
-            { { 6, 18, 0 }, 8, Pitch::flat },
-            { { 5, 18, 0 }, 8, Pitch::flat },
-            { { 4, 19, 0 }, 8, Pitch::flat },
-            { { 3, 19, 0 }, 8, Pitch::flat },
-            { { 2, 20, 0 }, 8, Pitch::flat },
-            { { 2, 21, 0 }, 8, Pitch::flat },
-            { { 1, 22, 0 }, 10, Pitch::flat },
-            { { 0, 23, 0 }, 10, Pitch::flat },
-            { { -1, 24, 0 }, 10, Pitch::flat },
-            { { -2, 25, 0 }, 10, Pitch::flat },
-            { { -2, 26, 0 }, 10, Pitch::flat },
-            { { -3, 27, 0 }, 10, Pitch::flat },
-            { { -4, 28, 0 }, 10, Pitch::flat },
-            { { -4, 29, 0 }, 12, Pitch::flat },
-            { { -5, 30, 0 }, 12, Pitch::flat },
-            { { -5, 31, 0 }, 12, Pitch::flat },
-            { { -5, 32, 0 }, 12, Pitch::flat },
-            { { -6, 33, 0 }, 12, Pitch::flat },
-            { { -6, 34, 0 }, 12, Pitch::flat },
-            { { -6, 35, 0 }, 12, Pitch::flat },
-            { { -6, 36, 0 }, 12, Pitch::flat },
-            { { -7, 37, 0 }, 14, Pitch::flat },
-            { { -7, 38, 0 }, 14, Pitch::flat },
-            { { -7, 39, 0 }, 14, Pitch::flat },
-            { { -7, 40, 0 }, 14, Pitch::flat },
-            { { -8, 41, 0 }, 14, Pitch::flat },
-            { { -8, 42, 0 }, 14, Pitch::flat },
-            { { -8, 43, 0 }, 14, Pitch::flat },
-            { { -8, 44, 0 }, 16, Pitch::flat },
-            { { -8, 45, 0 }, 16, Pitch::flat },
-            { { -8, 46, 0 }, 16, Pitch::flat },
-            { { -8, 47, 0 }, 16, Pitch::flat },
-            { { -8, 48, 0 }, 16, Pitch::flat },
-            { { -8, 49, 0 }, 16, Pitch::flat },
-            { { -8, 50, 0 }, 16, Pitch::flat },
-            { { -8, 51, 0 }, 16, Pitch::flat },
-            { { -8, 52, 0 }, 16, Pitch::flat },
-            { { -8, 53, 0 }, 16, Pitch::flat },
-            { { -8, 54, 0 }, 16, Pitch::flat },
-            { { -8, 55, 0 }, 16, Pitch::flat },
-            { { -8, 56, 0 }, 16, Pitch::flat },
-            { { -8, 57, 0 }, 16, Pitch::flat },
-            { { -8, 58, 0 }, 16, Pitch::flat },
-            { { -8, 59, 0 }, 16, Pitch::flat },
-            { { -8, 60, 0 }, 16, Pitch::flat },
-            { { -8, 61, 0 }, 16, Pitch::flat },
-            { { -8, 62, 0 }, 16, Pitch::flat },
-            { { -8, 63, 0 }, 16, Pitch::flat },
-        });
-
-    // 0x4f015e
-    // Turnaround 1. Lane 0. Track 5. Reversed 0. Direction 0
-    static constexpr auto moveInfoTA1L0T5R0D0 = std::to_array<MoveInfo>(
-        {
-            { { 31, 8, 0 }, 0, Pitch::up12deg },
-            { { 30, 8, 0 }, 0, Pitch::up12deg },
-            { { 29, 8, 0 }, 0, Pitch::up12deg },
-            { { 28, 8, 0 }, 0, Pitch::up12deg },
-            { { 27, 9, 1 }, 0, Pitch::up12deg },
-            { { 26, 9, 1 }, 0, Pitch::up12deg },
-            { { 25, 9, 1 }, 0, Pitch::up12deg },
-            { { 24, 9, 1 }, 0, Pitch::up12deg },
-            { { 23, 10, 2 }, 0, Pitch::up12deg },
-            { { 22, 10, 2 }, 0, Pitch::up12deg },
-            { { 21, 10, 2 }, 0, Pitch::up12deg },
-            { { 20, 10, 2 }, 0, Pitch::up12deg },
-            { { 19, 11, 3 }, 0, Pitch::up12deg },
-            { { 18, 11, 3 }, 0, Pitch::up12deg },
-            { { 17, 11, 3 }, 0, Pitch::up12deg },
-            { { 16, 11, 3 }, 0, Pitch::up12deg },
-            { { 15, 12, 4 }, 0, Pitch::up12deg },
-            { { 14, 12, 4 }, 0, Pitch::up12deg },
-            { { 13, 12, 4 }, 0, Pitch::up12deg },
-            { { 12, 12, 4 }, 0, Pitch::up12deg },
-            { { 11, 13, 5 }, 0, Pitch::up12deg },
-            { { 10, 13, 5 }, 0, Pitch::up12deg },
-            { { 9, 13, 5 }, 0, Pitch::up12deg },
-            { { 8, 13, 5 }, 0, Pitch::up12deg },
-            { { 7, 14, 6 }, 0, Pitch::up12deg },
-            { { 6, 14, 6 }, 0, Pitch::up12deg },
-            { { 5, 14, 6 }, 0, Pitch::up12deg },
-            { { 4, 14, 6 }, 0, Pitch::up12deg },
-            { { 3, 15, 7 }, 0, Pitch::up12deg },
-            { { 2, 15, 7 }, 0, Pitch::up12deg },
-            { { 1, 15, 7 }, 0, Pitch::up12deg },
-            { { 0, 15, 7 }, 0, Pitch::up12deg },
-            { { -1, 16, 8 }, 0, Pitch::up12deg },
-            { { -2, 16, 8 }, 0, Pitch::up12deg },
-            { { -3, 16, 8 }, 0, Pitch::up12deg },
-            { { -4, 16, 8 }, 0, Pitch::up12deg },
-            { { -5, 17, 9 }, 0, Pitch::up12deg },
-            { { -6, 17, 9 }, 0, Pitch::up12deg },
-            { { -7, 17, 9 }, 0, Pitch::up12deg },
-            { { -8, 17, 9 }, 0, Pitch::up12deg },
-            { { -9, 18, 10 }, 0, Pitch::up12deg },
-            { { -10, 18, 10 }, 0, Pitch::up12deg },
-            { { -11, 18, 10 }, 0, Pitch::up12deg },
-            { { -12, 18, 10 }, 0, Pitch::up12deg },
-            { { -13, 19, 11 }, 0, Pitch::up12deg },
-            { { -14, 19, 11 }, 0, Pitch::up12deg },
-            { { -15, 19, 11 }, 0, Pitch::up12deg },
-            { { -16, 19, 11 }, 0, Pitch::up12deg },
-            { { -17, 20, 12 }, 0, Pitch::up12deg },
-            { { -18, 20, 12 }, 0, Pitch::up12deg },
-            { { -19, 20, 12 }, 0, Pitch::up12deg },
-            { { -20, 20, 12 }, 0, Pitch::up12deg },
-            { { -21, 21, 13 }, 0, Pitch::up12deg },
-            { { -22, 21, 13 }, 0, Pitch::up12deg },
-            { { -23, 21, 13 }, 0, Pitch::up12deg },
-            { { -24, 21, 13 }, 0, Pitch::up12deg },
-            { { -25, 22, 14 }, 0, Pitch::up12deg },
-            { { -26, 22, 14 }, 0, Pitch::up12deg },
-            { { -27, 22, 14 }, 0, Pitch::up12deg },
-            { { -28, 22, 14 }, 0, Pitch::up12deg },
-            { { -29, 23, 15 }, 0, Pitch::up12deg },
-            { { -30, 23, 15 }, 0, Pitch::up12deg },
-            { { -31, 23, 15 }, 0, Pitch::up12deg },
-            { { -32, 23, 15 }, 0, Pitch::up12deg },
-        });
-
-    // 0x4f0360
-    // Turnaround 1. Lane 0. Track 5. Reversed 0. Direction 1
-    static constexpr auto moveInfoTA1L0T5R0D1 = std::to_array<MoveInfo>(
-        {
-            { { 8, 0, 0 }, 16, Pitch::up12deg },
-            { { 8, 1, 0 }, 16, Pitch::up12deg },
-            { { 8, 2, 0 }, 16, Pitch::up12deg },
-            { { 8, 3, 0 }, 16, Pitch::up12deg },
-            { { 9, 4, 1 }, 16, Pitch::up12deg },
-            { { 9, 5, 1 }, 16, Pitch::up12deg },
-            { { 9, 6, 1 }, 16, Pitch::up12deg },
-            { { 9, 7, 1 }, 16, Pitch::up12deg },
-            { { 10, 8, 2 }, 16, Pitch::up12deg },
-            { { 10, 9, 2 }, 16, Pitch::up12deg },
-            { { 10, 10, 2 }, 16, Pitch::up12deg },
-            { { 10, 11, 2 }, 16, Pitch::up12deg },
-            { { 11, 12, 3 }, 16, Pitch::up12deg },
-            { { 11, 13, 3 }, 16, Pitch::up12deg },
-            { { 11, 14, 3 }, 16, Pitch::up12deg },
-            { { 11, 15, 3 }, 16, Pitch::up12deg },
-            { { 12, 16, 4 }, 16, Pitch::up12deg },
-            { { 12, 17, 4 }, 16, Pitch::up12deg },
-            { { 12, 18, 4 }, 16, Pitch::up12deg },
-            { { 12, 19, 4 }, 16, Pitch::up12deg },
-            { { 13, 20, 5 }, 16, Pitch::up12deg },
-            { { 13, 21, 5 }, 16, Pitch::up12deg },
-            { { 13, 22, 5 }, 16, Pitch::up12deg },
-            { { 13, 23, 5 }, 16, Pitch::up12deg },
-            { { 14, 24, 6 }, 16, Pitch::up12deg },
-            { { 14, 25, 6 }, 16, Pitch::up12deg },
-            { { 14, 26, 6 }, 16, Pitch::up12deg },
-            { { 14, 27, 6 }, 16, Pitch::up12deg },
-            { { 15, 28, 7 }, 16, Pitch::up12deg },
-            { { 15, 29, 7 }, 16, Pitch::up12deg },
-            { { 15, 30, 7 }, 16, Pitch::up12deg },
-            { { 15, 31, 7 }, 16, Pitch::up12deg },
-            { { 16, 32, 8 }, 16, Pitch::up12deg },
-            { { 16, 33, 8 }, 16, Pitch::up12deg },
-            { { 16, 34, 8 }, 16, Pitch::up12deg },
-            { { 16, 35, 8 }, 16, Pitch::up12deg },
-            { { 17, 36, 9 }, 16, Pitch::up12deg },
-            { { 17, 37, 9 }, 16, Pitch::up12deg },
-            { { 17, 38, 9 }, 16, Pitch::up12deg },
-            { { 17, 39, 9 }, 16, Pitch::up12deg },
-            { { 18, 40, 10 }, 16, Pitch::up12deg },
-            { { 18, 41, 10 }, 16, Pitch::up12deg },
-            { { 18, 42, 10 }, 16, Pitch::up12deg },
-            { { 18, 43, 10 }, 16, Pitch::up12deg },
-            { { 19, 44, 11 }, 16, Pitch::up12deg },
-            { { 19, 45, 11 }, 16, Pitch::up12deg },
-            { { 19, 46, 11 }, 16, Pitch::up12deg },
-            { { 19, 47, 11 }, 16, Pitch::up12deg },
-            { { 20, 48, 12 }, 16, Pitch::up12deg },
-            { { 20, 49, 12 }, 16, Pitch::up12deg },
-            { { 20, 50, 12 }, 16, Pitch::up12deg },
-            { { 20, 51, 12 }, 16, Pitch::up12deg },
-            { { 21, 52, 13 }, 16, Pitch::up12deg },
-            { { 21, 53, 13 }, 16, Pitch::up12deg },
-            { { 21, 54, 13 }, 16, Pitch::up12deg },
-            { { 21, 55, 13 }, 16, Pitch::up12deg },
-            { { 22, 56, 14 }, 16, Pitch::up12deg },
-            { { 22, 57, 14 }, 16, Pitch::up12deg },
-            { { 22, 58, 14 }, 16, Pitch::up12deg },
-            { { 22, 59, 14 }, 16, Pitch::up12deg },
-            { { 23, 60, 15 }, 16, Pitch::up12deg },
-            { { 23, 61, 15 }, 16, Pitch::up12deg },
-            { { 23, 62, 15 }, 16, Pitch::up12deg },
-            { { 23, 63, 15 }, 16, Pitch::up12deg },
-        });
-
-    // 0x4f0562
-    // Turnaround 1. Lane 0. Track 5. Reversed 0. Direction 2
-    static constexpr auto moveInfoTA1L0T5R0D2 = std::to_array<MoveInfo>(
-        {
-            { { 0, 24, 0 }, 32, Pitch::up12deg },
-            { { 1, 24, 0 }, 32, Pitch::up12deg },
-            { { 2, 24, 0 }, 32, Pitch::up12deg },
-            { { 3, 24, 0 }, 32, Pitch::up12deg },
-            { { 4, 23, 1 }, 32, Pitch::up12deg },
-            { { 5, 23, 1 }, 32, Pitch::up12deg },
-            { { 6, 23, 1 }, 32, Pitch::up12deg },
-            { { 7, 23, 1 }, 32, Pitch::up12deg },
-            { { 8, 22, 2 }, 32, Pitch::up12deg },
-            { { 9, 22, 2 }, 32, Pitch::up12deg },
-            { { 10, 22, 2 }, 32, Pitch::up12deg },
-            { { 11, 22, 2 }, 32, Pitch::up12deg },
-            { { 12, 21, 3 }, 32, Pitch::up12deg },
-            { { 13, 21, 3 }, 32, Pitch::up12deg },
-            { { 14, 21, 3 }, 32, Pitch::up12deg },
-            { { 15, 21, 3 }, 32, Pitch::up12deg },
-            { { 16, 20, 4 }, 32, Pitch::up12deg },
-            { { 17, 20, 4 }, 32, Pitch::up12deg },
-            { { 18, 20, 4 }, 32, Pitch::up12deg },
-            { { 19, 20, 4 }, 32, Pitch::up12deg },
-            { { 20, 19, 5 }, 32, Pitch::up12deg },
-            { { 21, 19, 5 }, 32, Pitch::up12deg },
-            { { 22, 19, 5 }, 32, Pitch::up12deg },
-            { { 23, 19, 5 }, 32, Pitch::up12deg },
-            { { 24, 18, 6 }, 32, Pitch::up12deg },
-            { { 25, 18, 6 }, 32, Pitch::up12deg },
-            { { 26, 18, 6 }, 32, Pitch::up12deg },
-            { { 27, 18, 6 }, 32, Pitch::up12deg },
-            { { 28, 17, 7 }, 32, Pitch::up12deg },
-            { { 29, 17, 7 }, 32, Pitch::up12deg },
-            { { 30, 17, 7 }, 32, Pitch::up12deg },
-            { { 31, 17, 7 }, 32, Pitch::up12deg },
-            { { 32, 16, 8 }, 32, Pitch::up12deg },
-            { { 33, 16, 8 }, 32, Pitch::up12deg },
-            { { 34, 16, 8 }, 32, Pitch::up12deg },
-            { { 35, 16, 8 }, 32, Pitch::up12deg },
-            { { 36, 15, 9 }, 32, Pitch::up12deg },
-            { { 37, 15, 9 }, 32, Pitch::up12deg },
-            { { 38, 15, 9 }, 32, Pitch::up12deg },
-            { { 39, 15, 9 }, 32, Pitch::up12deg },
-            { { 40, 14, 10 }, 32, Pitch::up12deg },
-            { { 41, 14, 10 }, 32, Pitch::up12deg },
-            { { 42, 14, 10 }, 32, Pitch::up12deg },
-            { { 43, 14, 10 }, 32, Pitch::up12deg },
-            { { 44, 13, 11 }, 32, Pitch::up12deg },
-            { { 45, 13, 11 }, 32, Pitch::up12deg },
-            { { 46, 13, 11 }, 32, Pitch::up12deg },
-            { { 47, 13, 11 }, 32, Pitch::up12deg },
-            { { 48, 12, 12 }, 32, Pitch::up12deg },
-            { { 49, 12, 12 }, 32, Pitch::up12deg },
-            { { 50, 12, 12 }, 32, Pitch::up12deg },
-            { { 51, 12, 12 }, 32, Pitch::up12deg },
-            { { 52, 11, 13 }, 32, Pitch::up12deg },
-            { { 53, 11, 13 }, 32, Pitch::up12deg },
-            { { 54, 11, 13 }, 32, Pitch::up12deg },
-            { { 55, 11, 13 }, 32, Pitch::up12deg },
-            { { 56, 10, 14 }, 32, Pitch::up12deg },
-            { { 57, 10, 14 }, 32, Pitch::up12deg },
-            { { 58, 10, 14 }, 32, Pitch::up12deg },
-            { { 59, 10, 14 }, 32, Pitch::up12deg },
-            { { 60, 9, 15 }, 32, Pitch::up12deg },
-            { { 61, 9, 15 }, 32, Pitch::up12deg },
-            { { 62, 9, 15 }, 32, Pitch::up12deg },
-            { { 63, 9, 15 }, 32, Pitch::up12deg },
-        });
-
-    // 0x4f0764
-    // Turnaround 1. Lane 0. Track 5. Reversed 0. Direction 3
-    static constexpr auto moveInfoTA1L0T5R0D3 = std::to_array<MoveInfo>(
-        {
-            { { 24, 31, 0 }, 48, Pitch::up12deg },
-            { { 24, 30, 0 }, 48, Pitch::up12deg },
-            { { 24, 29, 0 }, 48, Pitch::up12deg },
-            { { 24, 28, 0 }, 48, Pitch::up12deg },
-            { { 23, 27, 1 }, 48, Pitch::up12deg },
-            { { 23, 26, 1 }, 48, Pitch::up12deg },
-            { { 23, 25, 1 }, 48, Pitch::up12deg },
-            { { 23, 24, 1 }, 48, Pitch::up12deg },
-            { { 22, 23, 2 }, 48, Pitch::up12deg },
-            { { 22, 22, 2 }, 48, Pitch::up12deg },
-            { { 22, 21, 2 }, 48, Pitch::up12deg },
-            { { 22, 20, 2 }, 48, Pitch::up12deg },
-            { { 21, 19, 3 }, 48, Pitch::up12deg },
-            { { 21, 18, 3 }, 48, Pitch::up12deg },
-            { { 21, 17, 3 }, 48, Pitch::up12deg },
-            { { 21, 16, 3 }, 48, Pitch::up12deg },
-            { { 20, 15, 4 }, 48, Pitch::up12deg },
-            { { 20, 14, 4 }, 48, Pitch::up12deg },
-            { { 20, 13, 4 }, 48, Pitch::up12deg },
-            { { 20, 12, 4 }, 48, Pitch::up12deg },
-            { { 19, 11, 5 }, 48, Pitch::up12deg },
-            { { 19, 10, 5 }, 48, Pitch::up12deg },
-            { { 19, 9, 5 }, 48, Pitch::up12deg },
-            { { 19, 8, 5 }, 48, Pitch::up12deg },
-            { { 18, 7, 6 }, 48, Pitch::up12deg },
-            { { 18, 6, 6 }, 48, Pitch::up12deg },
-            { { 18, 5, 6 }, 48, Pitch::up12deg },
-            { { 18, 4, 6 }, 48, Pitch::up12deg },
-            { { 17, 3, 7 }, 48, Pitch::up12deg },
-            { { 17, 2, 7 }, 48, Pitch::up12deg },
-            { { 17, 1, 7 }, 48, Pitch::up12deg },
-            { { 17, 0, 7 }, 48, Pitch::up12deg },
-            { { 16, -1, 8 }, 48, Pitch::up12deg },
-            { { 16, -2, 8 }, 48, Pitch::up12deg },
-            { { 16, -3, 8 }, 48, Pitch::up12deg },
-            { { 16, -4, 8 }, 48, Pitch::up12deg },
-            { { 15, -5, 9 }, 48, Pitch::up12deg },
-            { { 15, -6, 9 }, 48, Pitch::up12deg },
-            { { 15, -7, 9 }, 48, Pitch::up12deg },
-            { { 15, -8, 9 }, 48, Pitch::up12deg },
-            { { 14, -9, 10 }, 48, Pitch::up12deg },
-            { { 14, -10, 10 }, 48, Pitch::up12deg },
-            { { 14, -11, 10 }, 48, Pitch::up12deg },
-            { { 14, -12, 10 }, 48, Pitch::up12deg },
-            { { 13, -13, 11 }, 48, Pitch::up12deg },
-            { { 13, -14, 11 }, 48, Pitch::up12deg },
-            { { 13, -15, 11 }, 48, Pitch::up12deg },
-            { { 13, -16, 11 }, 48, Pitch::up12deg },
-            { { 12, -17, 12 }, 48, Pitch::up12deg },
-            { { 12, -18, 12 }, 48, Pitch::up12deg },
-            { { 12, -19, 12 }, 48, Pitch::up12deg },
-            { { 12, -20, 12 }, 48, Pitch::up12deg },
-            { { 11, -21, 13 }, 48, Pitch::up12deg },
-            { { 11, -22, 13 }, 48, Pitch::up12deg },
-            { { 11, -23, 13 }, 48, Pitch::up12deg },
-            { { 11, -24, 13 }, 48, Pitch::up12deg },
-            { { 10, -25, 14 }, 48, Pitch::up12deg },
-            { { 10, -26, 14 }, 48, Pitch::up12deg },
-            { { 10, -27, 14 }, 48, Pitch::up12deg },
-            { { 10, -28, 14 }, 48, Pitch::up12deg },
-            { { 9, -29, 15 }, 48, Pitch::up12deg },
-            { { 9, -30, 15 }, 48, Pitch::up12deg },
-            { { 9, -31, 15 }, 48, Pitch::up12deg },
-            { { 9, -32, 15 }, 48, Pitch::up12deg },
-        });
-
-    // 0x4f0d6a
-    // Turnaround 1. Lane 0. Track 5. Reversed 1. Direction 0
-    static constexpr auto moveInfoTA1L0T5R1D0 = std::to_array<MoveInfo>(
-        {
-            { { 0, 24, 0 }, 32, Pitch::down12deg },
-            { { 1, 24, 0 }, 32, Pitch::down12deg },
-            { { 2, 24, 0 }, 32, Pitch::down12deg },
-            { { 3, 24, 0 }, 32, Pitch::down12deg },
-            { { 4, 23, -1 }, 32, Pitch::down12deg },
-            { { 5, 23, -1 }, 32, Pitch::down12deg },
-            { { 6, 23, -1 }, 32, Pitch::down12deg },
-            { { 7, 23, -1 }, 32, Pitch::down12deg },
-            { { 8, 22, -2 }, 32, Pitch::down12deg },
-            { { 9, 22, -2 }, 32, Pitch::down12deg },
-            { { 10, 22, -2 }, 32, Pitch::down12deg },
-            { { 11, 22, -2 }, 32, Pitch::down12deg },
-            { { 12, 21, -3 }, 32, Pitch::down12deg },
-            { { 13, 21, -3 }, 32, Pitch::down12deg },
-            { { 14, 21, -3 }, 32, Pitch::down12deg },
-            { { 15, 21, -3 }, 32, Pitch::down12deg },
-            { { 16, 20, -4 }, 32, Pitch::down12deg },
-            { { 17, 20, -4 }, 32, Pitch::down12deg },
-            { { 18, 20, -4 }, 32, Pitch::down12deg },
-            { { 19, 20, -4 }, 32, Pitch::down12deg },
-            { { 20, 19, -5 }, 32, Pitch::down12deg },
-            { { 21, 19, -5 }, 32, Pitch::down12deg },
-            { { 22, 19, -5 }, 32, Pitch::down12deg },
-            { { 23, 19, -5 }, 32, Pitch::down12deg },
-            { { 24, 18, -6 }, 32, Pitch::down12deg },
-            { { 25, 18, -6 }, 32, Pitch::down12deg },
-            { { 26, 18, -6 }, 32, Pitch::down12deg },
-            { { 27, 18, -6 }, 32, Pitch::down12deg },
-            { { 28, 17, -7 }, 32, Pitch::down12deg },
-            { { 29, 17, -7 }, 32, Pitch::down12deg },
-            { { 30, 17, -7 }, 32, Pitch::down12deg },
-            { { 31, 17, -7 }, 32, Pitch::down12deg },
-            { { 32, 16, -8 }, 32, Pitch::down12deg },
-            { { 33, 16, -8 }, 32, Pitch::down12deg },
-            { { 34, 16, -8 }, 32, Pitch::down12deg },
-            { { 35, 16, -8 }, 32, Pitch::down12deg },
-            { { 36, 15, -9 }, 32, Pitch::down12deg },
-            { { 37, 15, -9 }, 32, Pitch::down12deg },
-            { { 38, 15, -9 }, 32, Pitch::down12deg },
-            { { 39, 15, -9 }, 32, Pitch::down12deg },
-            { { 40, 14, -10 }, 32, Pitch::down12deg },
-            { { 41, 14, -10 }, 32, Pitch::down12deg },
-            { { 42, 14, -10 }, 32, Pitch::down12deg },
-            { { 43, 14, -10 }, 32, Pitch::down12deg },
-            { { 44, 13, -11 }, 32, Pitch::down12deg },
-            { { 45, 13, -11 }, 32, Pitch::down12deg },
-            { { 46, 13, -11 }, 32, Pitch::down12deg },
-            { { 47, 13, -11 }, 32, Pitch::down12deg },
-            { { 48, 12, -12 }, 32, Pitch::down12deg },
-            { { 49, 12, -12 }, 32, Pitch::down12deg },
-            { { 50, 12, -12 }, 32, Pitch::down12deg },
-            { { 51, 12, -12 }, 32, Pitch::down12deg },
-            { { 52, 11, -13 }, 32, Pitch::down12deg },
-            { { 53, 11, -13 }, 32, Pitch::down12deg },
-            { { 54, 11, -13 }, 32, Pitch::down12deg },
-            { { 55, 11, -13 }, 32, Pitch::down12deg },
-            { { 56, 10, -14 }, 32, Pitch::down12deg },
-            { { 57, 10, -14 }, 32, Pitch::down12deg },
-            { { 58, 10, -14 }, 32, Pitch::down12deg },
-            { { 59, 10, -14 }, 32, Pitch::down12deg },
-            { { 60, 9, -15 }, 32, Pitch::down12deg },
-            { { 61, 9, -15 }, 32, Pitch::down12deg },
-            { { 62, 9, -15 }, 32, Pitch::down12deg },
-            { { 63, 9, -15 }, 32, Pitch::down12deg },
-        });
-
-    // 0x4f0f6c
-    // Turnaround 1. Lane 0. Track 5. Reversed 1. Direction 1
-    static constexpr auto moveInfoTA1L0T5R1D1 = std::to_array<MoveInfo>(
-        {
-            { { 24, 31, 0 }, 48, Pitch::down12deg },
-            { { 24, 30, 0 }, 48, Pitch::down12deg },
-            { { 24, 29, 0 }, 48, Pitch::down12deg },
-            { { 24, 28, 0 }, 48, Pitch::down12deg },
-            { { 23, 27, -1 }, 48, Pitch::down12deg },
-            { { 23, 26, -1 }, 48, Pitch::down12deg },
-            { { 23, 25, -1 }, 48, Pitch::down12deg },
-            { { 23, 24, -1 }, 48, Pitch::down12deg },
-            { { 22, 23, -2 }, 48, Pitch::down12deg },
-            { { 22, 22, -2 }, 48, Pitch::down12deg },
-            { { 22, 21, -2 }, 48, Pitch::down12deg },
-            { { 22, 20, -2 }, 48, Pitch::down12deg },
-            { { 21, 19, -3 }, 48, Pitch::down12deg },
-            { { 21, 18, -3 }, 48, Pitch::down12deg },
-            { { 21, 17, -3 }, 48, Pitch::down12deg },
-            { { 21, 16, -3 }, 48, Pitch::down12deg },
-            { { 20, 15, -4 }, 48, Pitch::down12deg },
-            { { 20, 14, -4 }, 48, Pitch::down12deg },
-            { { 20, 13, -4 }, 48, Pitch::down12deg },
-            { { 20, 12, -4 }, 48, Pitch::down12deg },
-            { { 19, 11, -5 }, 48, Pitch::down12deg },
-            { { 19, 10, -5 }, 48, Pitch::down12deg },
-            { { 19, 9, -5 }, 48, Pitch::down12deg },
-            { { 19, 8, -5 }, 48, Pitch::down12deg },
-            { { 18, 7, -6 }, 48, Pitch::down12deg },
-            { { 18, 6, -6 }, 48, Pitch::down12deg },
-            { { 18, 5, -6 }, 48, Pitch::down12deg },
-            { { 18, 4, -6 }, 48, Pitch::down12deg },
-            { { 17, 3, -7 }, 48, Pitch::down12deg },
-            { { 17, 2, -7 }, 48, Pitch::down12deg },
-            { { 17, 1, -7 }, 48, Pitch::down12deg },
-            { { 17, 0, -7 }, 48, Pitch::down12deg },
-            { { 16, -1, -8 }, 48, Pitch::down12deg },
-            { { 16, -2, -8 }, 48, Pitch::down12deg },
-            { { 16, -3, -8 }, 48, Pitch::down12deg },
-            { { 16, -4, -8 }, 48, Pitch::down12deg },
-            { { 15, -5, -9 }, 48, Pitch::down12deg },
-            { { 15, -6, -9 }, 48, Pitch::down12deg },
-            { { 15, -7, -9 }, 48, Pitch::down12deg },
-            { { 15, -8, -9 }, 48, Pitch::down12deg },
-            { { 14, -9, -10 }, 48, Pitch::down12deg },
-            { { 14, -10, -10 }, 48, Pitch::down12deg },
-            { { 14, -11, -10 }, 48, Pitch::down12deg },
-            { { 14, -12, -10 }, 48, Pitch::down12deg },
-            { { 13, -13, -11 }, 48, Pitch::down12deg },
-            { { 13, -14, -11 }, 48, Pitch::down12deg },
-            { { 13, -15, -11 }, 48, Pitch::down12deg },
-            { { 13, -16, -11 }, 48, Pitch::down12deg },
-            { { 12, -17, -12 }, 48, Pitch::down12deg },
-            { { 12, -18, -12 }, 48, Pitch::down12deg },
-            { { 12, -19, -12 }, 48, Pitch::down12deg },
-            { { 12, -20, -12 }, 48, Pitch::down12deg },
-            { { 11, -21, -13 }, 48, Pitch::down12deg },
-            { { 11, -22, -13 }, 48, Pitch::down12deg },
-            { { 11, -23, -13 }, 48, Pitch::down12deg },
-            { { 11, -24, -13 }, 48, Pitch::down12deg },
-            { { 10, -25, -14 }, 48, Pitch::down12deg },
-            { { 10, -26, -14 }, 48, Pitch::down12deg },
-            { { 10, -27, -14 }, 48, Pitch::down12deg },
-            { { 10, -28, -14 }, 48, Pitch::down12deg },
-            { { 9, -29, -15 }, 48, Pitch::down12deg },
-            { { 9, -30, -15 }, 48, Pitch::down12deg },
-            { { 9, -31, -15 }, 48, Pitch::down12deg },
-            { { 9, -32, -15 }, 48, Pitch::down12deg },
-        });
-
-    // 0x4f0966
-    // Turnaround 1. Lane 0. Track 5. Reversed 1. Direction 2
-    static constexpr auto moveInfoTA1L0T5R1D2 = std::to_array<MoveInfo>(
-        {
-            { { 31, 8, 0 }, 0, Pitch::down12deg },
-            { { 30, 8, 0 }, 0, Pitch::down12deg },
-            { { 29, 8, 0 }, 0, Pitch::down12deg },
-            { { 28, 8, 0 }, 0, Pitch::down12deg },
-            { { 27, 9, -1 }, 0, Pitch::down12deg },
-            { { 26, 9, -1 }, 0, Pitch::down12deg },
-            { { 25, 9, -1 }, 0, Pitch::down12deg },
-            { { 24, 9, -1 }, 0, Pitch::down12deg },
-            { { 23, 10, -2 }, 0, Pitch::down12deg },
-            { { 22, 10, -2 }, 0, Pitch::down12deg },
-            { { 21, 10, -2 }, 0, Pitch::down12deg },
-            { { 20, 10, -2 }, 0, Pitch::down12deg },
-            { { 19, 11, -3 }, 0, Pitch::down12deg },
-            { { 18, 11, -3 }, 0, Pitch::down12deg },
-            { { 17, 11, -3 }, 0, Pitch::down12deg },
-            { { 16, 11, -3 }, 0, Pitch::down12deg },
-            { { 15, 12, -4 }, 0, Pitch::down12deg },
-            { { 14, 12, -4 }, 0, Pitch::down12deg },
-            { { 13, 12, -4 }, 0, Pitch::down12deg },
-            { { 12, 12, -4 }, 0, Pitch::down12deg },
-            { { 11, 13, -5 }, 0, Pitch::down12deg },
-            { { 10, 13, -5 }, 0, Pitch::down12deg },
-            { { 9, 13, -5 }, 0, Pitch::down12deg },
-            { { 8, 13, -5 }, 0, Pitch::down12deg },
-            { { 7, 14, -6 }, 0, Pitch::down12deg },
-            { { 6, 14, -6 }, 0, Pitch::down12deg },
-            { { 5, 14, -6 }, 0, Pitch::down12deg },
-            { { 4, 14, -6 }, 0, Pitch::down12deg },
-            { { 3, 15, -7 }, 0, Pitch::down12deg },
-            { { 2, 15, -7 }, 0, Pitch::down12deg },
-            { { 1, 15, -7 }, 0, Pitch::down12deg },
-            { { 0, 15, -7 }, 0, Pitch::down12deg },
-            { { -1, 16, -8 }, 0, Pitch::down12deg },
-            { { -2, 16, -8 }, 0, Pitch::down12deg },
-            { { -3, 16, -8 }, 0, Pitch::down12deg },
-            { { -4, 16, -8 }, 0, Pitch::down12deg },
-            { { -5, 17, -9 }, 0, Pitch::down12deg },
-            { { -6, 17, -9 }, 0, Pitch::down12deg },
-            { { -7, 17, -9 }, 0, Pitch::down12deg },
-            { { -8, 17, -9 }, 0, Pitch::down12deg },
-            { { -9, 18, -10 }, 0, Pitch::down12deg },
-            { { -10, 18, -10 }, 0, Pitch::down12deg },
-            { { -11, 18, -10 }, 0, Pitch::down12deg },
-            { { -12, 18, -10 }, 0, Pitch::down12deg },
-            { { -13, 19, -11 }, 0, Pitch::down12deg },
-            { { -14, 19, -11 }, 0, Pitch::down12deg },
-            { { -15, 19, -11 }, 0, Pitch::down12deg },
-            { { -16, 19, -11 }, 0, Pitch::down12deg },
-            { { -17, 20, -12 }, 0, Pitch::down12deg },
-            { { -18, 20, -12 }, 0, Pitch::down12deg },
-            { { -19, 20, -12 }, 0, Pitch::down12deg },
-            { { -20, 20, -12 }, 0, Pitch::down12deg },
-            { { -21, 21, -13 }, 0, Pitch::down12deg },
-            { { -22, 21, -13 }, 0, Pitch::down12deg },
-            { { -23, 21, -13 }, 0, Pitch::down12deg },
-            { { -24, 21, -13 }, 0, Pitch::down12deg },
-            { { -25, 22, -14 }, 0, Pitch::down12deg },
-            { { -26, 22, -14 }, 0, Pitch::down12deg },
-            { { -27, 22, -14 }, 0, Pitch::down12deg },
-            { { -28, 22, -14 }, 0, Pitch::down12deg },
-            { { -29, 23, -15 }, 0, Pitch::down12deg },
-            { { -30, 23, -15 }, 0, Pitch::down12deg },
-            { { -31, 23, -15 }, 0, Pitch::down12deg },
-            { { -32, 23, -15 }, 0, Pitch::down12deg },
-        });
-
-    // 0x4f0b68
-    // Turnaround 1. Lane 0. Track 5. Reversed 1. Direction 3
-    static constexpr auto moveInfoTA1L0T5R1D3 = std::to_array<MoveInfo>(
-        {
-            { { 8, 0, 0 }, 16, Pitch::down12deg },
-            { { 8, 1, 0 }, 16, Pitch::down12deg },
-            { { 8, 2, 0 }, 16, Pitch::down12deg },
-            { { 8, 3, 0 }, 16, Pitch::down12deg },
-            { { 9, 4, -1 }, 16, Pitch::down12deg },
-            { { 9, 5, -1 }, 16, Pitch::down12deg },
-            { { 9, 6, -1 }, 16, Pitch::down12deg },
-            { { 9, 7, -1 }, 16, Pitch::down12deg },
-            { { 10, 8, -2 }, 16, Pitch::down12deg },
-            { { 10, 9, -2 }, 16, Pitch::down12deg },
-            { { 10, 10, -2 }, 16, Pitch::down12deg },
-            { { 10, 11, -2 }, 16, Pitch::down12deg },
-            { { 11, 12, -3 }, 16, Pitch::down12deg },
-            { { 11, 13, -3 }, 16, Pitch::down12deg },
-            { { 11, 14, -3 }, 16, Pitch::down12deg },
-            { { 11, 15, -3 }, 16, Pitch::down12deg },
-            { { 12, 16, -4 }, 16, Pitch::down12deg },
-            { { 12, 17, -4 }, 16, Pitch::down12deg },
-            { { 12, 18, -4 }, 16, Pitch::down12deg },
-            { { 12, 19, -4 }, 16, Pitch::down12deg },
-            { { 13, 20, -5 }, 16, Pitch::down12deg },
-            { { 13, 21, -5 }, 16, Pitch::down12deg },
-            { { 13, 22, -5 }, 16, Pitch::down12deg },
-            { { 13, 23, -5 }, 16, Pitch::down12deg },
-            { { 14, 24, -6 }, 16, Pitch::down12deg },
-            { { 14, 25, -6 }, 16, Pitch::down12deg },
-            { { 14, 26, -6 }, 16, Pitch::down12deg },
-            { { 14, 27, -6 }, 16, Pitch::down12deg },
-            { { 15, 28, -7 }, 16, Pitch::down12deg },
-            { { 15, 29, -7 }, 16, Pitch::down12deg },
-            { { 15, 30, -7 }, 16, Pitch::down12deg },
-            { { 15, 31, -7 }, 16, Pitch::down12deg },
-            { { 16, 32, -8 }, 16, Pitch::down12deg },
-            { { 16, 33, -8 }, 16, Pitch::down12deg },
-            { { 16, 34, -8 }, 16, Pitch::down12deg },
-            { { 16, 35, -8 }, 16, Pitch::down12deg },
-            { { 17, 36, -9 }, 16, Pitch::down12deg },
-            { { 17, 37, -9 }, 16, Pitch::down12deg },
-            { { 17, 38, -9 }, 16, Pitch::down12deg },
-            { { 17, 39, -9 }, 16, Pitch::down12deg },
-            { { 18, 40, -10 }, 16, Pitch::down12deg },
-            { { 18, 41, -10 }, 16, Pitch::down12deg },
-            { { 18, 42, -10 }, 16, Pitch::down12deg },
-            { { 18, 43, -10 }, 16, Pitch::down12deg },
-            { { 19, 44, -11 }, 16, Pitch::down12deg },
-            { { 19, 45, -11 }, 16, Pitch::down12deg },
-            { { 19, 46, -11 }, 16, Pitch::down12deg },
-            { { 19, 47, -11 }, 16, Pitch::down12deg },
-            { { 20, 48, -12 }, 16, Pitch::down12deg },
-            { { 20, 49, -12 }, 16, Pitch::down12deg },
-            { { 20, 50, -12 }, 16, Pitch::down12deg },
-            { { 20, 51, -12 }, 16, Pitch::down12deg },
-            { { 21, 52, -13 }, 16, Pitch::down12deg },
-            { { 21, 53, -13 }, 16, Pitch::down12deg },
-            { { 21, 54, -13 }, 16, Pitch::down12deg },
-            { { 21, 55, -13 }, 16, Pitch::down12deg },
-            { { 22, 56, -14 }, 16, Pitch::down12deg },
-            { { 22, 57, -14 }, 16, Pitch::down12deg },
-            { { 22, 58, -14 }, 16, Pitch::down12deg },
-            { { 22, 59, -14 }, 16, Pitch::down12deg },
-            { { 23, 60, -15 }, 16, Pitch::down12deg },
-            { { 23, 61, -15 }, 16, Pitch::down12deg },
-            { { 23, 62, -15 }, 16, Pitch::down12deg },
-            { { 23, 63, -15 }, 16, Pitch::down12deg },
-        });
-
-    // 0x4f298e
-    // Turnaround 1. Lane 0. Track 7. Reversed 0. Direction 0
-    static constexpr auto moveInfoTA1L0T7R0D0 = std::to_array<MoveInfo>(
-        {
-            { { 31, 8, 0 }, 0, Pitch::up25deg },
-            { { 30, 8, 0 }, 0, Pitch::up25deg },
-            { { 29, 9, 1 }, 0, Pitch::up25deg },
-            { { 28, 9, 1 }, 0, Pitch::up25deg },
-            { { 27, 10, 2 }, 0, Pitch::up25deg },
-            { { 26, 10, 2 }, 0, Pitch::up25deg },
-            { { 25, 11, 3 }, 0, Pitch::up25deg },
-            { { 24, 11, 3 }, 0, Pitch::up25deg },
-            { { 23, 12, 4 }, 0, Pitch::up25deg },
-            { { 22, 12, 4 }, 0, Pitch::up25deg },
-            { { 21, 13, 5 }, 0, Pitch::up25deg },
-            { { 20, 13, 5 }, 0, Pitch::up25deg },
-            { { 19, 14, 6 }, 0, Pitch::up25deg },
-            { { 18, 14, 6 }, 0, Pitch::up25deg },
-            { { 17, 15, 7 }, 0, Pitch::up25deg },
-            { { 16, 15, 7 }, 0, Pitch::up25deg },
-            { { 15, 16, 8 }, 0, Pitch::up25deg },
-            { { 14, 16, 8 }, 0, Pitch::up25deg },
-            { { 13, 17, 9 }, 0, Pitch::up25deg },
-            { { 12, 17, 9 }, 0, Pitch::up25deg },
-            { { 11, 18, 10 }, 0, Pitch::up25deg },
-            { { 10, 18, 10 }, 0, Pitch::up25deg },
-            { { 9, 19, 11 }, 0, Pitch::up25deg },
-            { { 8, 19, 11 }, 0, Pitch::up25deg },
-            { { 7, 20, 12 }, 0, Pitch::up25deg },
-            { { 6, 20, 12 }, 0, Pitch::up25deg },
-            { { 5, 21, 13 }, 0, Pitch::up25deg },
-            { { 4, 21, 13 }, 0, Pitch::up25deg },
-            { { 3, 22, 14 }, 0, Pitch::up25deg },
-            { { 2, 22, 14 }, 0, Pitch::up25deg },
-            { { 1, 23, 15 }, 0, Pitch::up25deg },
-            { { 0, 23, 15 }, 0, Pitch::up25deg },
-        });
-
-    // 0x4f2a90
-    // Turnaround 1. Lane 0. Track 7. Reversed 0. Direction 1
-    static constexpr auto moveInfoTA1L0T7R0D1 = std::to_array<MoveInfo>(
-        {
-            { { 8, 0, 0 }, 16, Pitch::up25deg },
-            { { 8, 1, 0 }, 16, Pitch::up25deg },
-            { { 9, 2, 1 }, 16, Pitch::up25deg },
-            { { 9, 3, 1 }, 16, Pitch::up25deg },
-            { { 10, 4, 2 }, 16, Pitch::up25deg },
-            { { 10, 5, 2 }, 16, Pitch::up25deg },
-            { { 11, 6, 3 }, 16, Pitch::up25deg },
-            { { 11, 7, 3 }, 16, Pitch::up25deg },
-            { { 12, 8, 4 }, 16, Pitch::up25deg },
-            { { 12, 9, 4 }, 16, Pitch::up25deg },
-            { { 13, 10, 5 }, 16, Pitch::up25deg },
-            { { 13, 11, 5 }, 16, Pitch::up25deg },
-            { { 14, 12, 6 }, 16, Pitch::up25deg },
-            { { 14, 13, 6 }, 16, Pitch::up25deg },
-            { { 15, 14, 7 }, 16, Pitch::up25deg },
-            { { 15, 15, 7 }, 16, Pitch::up25deg },
-            { { 16, 16, 8 }, 16, Pitch::up25deg },
-            { { 16, 17, 8 }, 16, Pitch::up25deg },
-            { { 17, 18, 9 }, 16, Pitch::up25deg },
-            { { 17, 19, 9 }, 16, Pitch::up25deg },
-            { { 18, 20, 10 }, 16, Pitch::up25deg },
-            { { 18, 21, 10 }, 16, Pitch::up25deg },
-            { { 19, 22, 11 }, 16, Pitch::up25deg },
-            { { 19, 23, 11 }, 16, Pitch::up25deg },
-            { { 20, 24, 12 }, 16, Pitch::up25deg },
-            { { 20, 25, 12 }, 16, Pitch::up25deg },
-            { { 21, 26, 13 }, 16, Pitch::up25deg },
-            { { 21, 27, 13 }, 16, Pitch::up25deg },
-            { { 22, 28, 14 }, 16, Pitch::up25deg },
-            { { 22, 29, 14 }, 16, Pitch::up25deg },
-            { { 23, 30, 15 }, 16, Pitch::up25deg },
-            { { 23, 31, 15 }, 16, Pitch::up25deg },
-        });
-
-    // 0x4f2b92
-    // Turnaround 1. Lane 0. Track 7. Reversed 0. Direction 2
-    static constexpr auto moveInfoTA1L0T7R0D2 = std::to_array<MoveInfo>(
-        {
-            { { 0, 24, 0 }, 32, Pitch::up25deg },
-            { { 1, 24, 0 }, 32, Pitch::up25deg },
-            { { 2, 23, 1 }, 32, Pitch::up25deg },
-            { { 3, 23, 1 }, 32, Pitch::up25deg },
-            { { 4, 22, 2 }, 32, Pitch::up25deg },
-            { { 5, 22, 2 }, 32, Pitch::up25deg },
-            { { 6, 21, 3 }, 32, Pitch::up25deg },
-            { { 7, 21, 3 }, 32, Pitch::up25deg },
-            { { 8, 20, 4 }, 32, Pitch::up25deg },
-            { { 9, 20, 4 }, 32, Pitch::up25deg },
-            { { 10, 19, 5 }, 32, Pitch::up25deg },
-            { { 11, 19, 5 }, 32, Pitch::up25deg },
-            { { 12, 18, 6 }, 32, Pitch::up25deg },
-            { { 13, 18, 6 }, 32, Pitch::up25deg },
-            { { 14, 17, 7 }, 32, Pitch::up25deg },
-            { { 15, 17, 7 }, 32, Pitch::up25deg },
-            { { 16, 16, 8 }, 32, Pitch::up25deg },
-            { { 17, 16, 8 }, 32, Pitch::up25deg },
-            { { 18, 15, 9 }, 32, Pitch::up25deg },
-            { { 19, 15, 9 }, 32, Pitch::up25deg },
-            { { 20, 14, 10 }, 32, Pitch::up25deg },
-            { { 21, 14, 10 }, 32, Pitch::up25deg },
-            { { 22, 13, 11 }, 32, Pitch::up25deg },
-            { { 23, 13, 11 }, 32, Pitch::up25deg },
-            { { 24, 12, 12 }, 32, Pitch::up25deg },
-            { { 25, 12, 12 }, 32, Pitch::up25deg },
-            { { 26, 11, 13 }, 32, Pitch::up25deg },
-            { { 27, 11, 13 }, 32, Pitch::up25deg },
-            { { 28, 10, 14 }, 32, Pitch::up25deg },
-            { { 29, 10, 14 }, 32, Pitch::up25deg },
-            { { 30, 9, 15 }, 32, Pitch::up25deg },
-            { { 31, 9, 15 }, 32, Pitch::up25deg },
-        });
-
-    // 0x4f2c94
-    // Turnaround 1. Lane 0. Track 7. Reversed 0. Direction 3
-    static constexpr auto moveInfoTA1L0T7R0D3 = std::to_array<MoveInfo>(
-        {
-            { { 24, 31, 0 }, 48, Pitch::up25deg },
-            { { 24, 30, 0 }, 48, Pitch::up25deg },
-            { { 23, 29, 1 }, 48, Pitch::up25deg },
-            { { 23, 28, 1 }, 48, Pitch::up25deg },
-            { { 22, 27, 2 }, 48, Pitch::up25deg },
-            { { 22, 26, 2 }, 48, Pitch::up25deg },
-            { { 21, 25, 3 }, 48, Pitch::up25deg },
-            { { 21, 24, 3 }, 48, Pitch::up25deg },
-            { { 20, 23, 4 }, 48, Pitch::up25deg },
-            { { 20, 22, 4 }, 48, Pitch::up25deg },
-            { { 19, 21, 5 }, 48, Pitch::up25deg },
-            { { 19, 20, 5 }, 48, Pitch::up25deg },
-            { { 18, 19, 6 }, 48, Pitch::up25deg },
-            { { 18, 18, 6 }, 48, Pitch::up25deg },
-            { { 17, 17, 7 }, 48, Pitch::up25deg },
-            { { 17, 16, 7 }, 48, Pitch::up25deg },
-            { { 16, 15, 8 }, 48, Pitch::up25deg },
-            { { 16, 14, 8 }, 48, Pitch::up25deg },
-            { { 15, 13, 9 }, 48, Pitch::up25deg },
-            { { 15, 12, 9 }, 48, Pitch::up25deg },
-            { { 14, 11, 10 }, 48, Pitch::up25deg },
-            { { 14, 10, 10 }, 48, Pitch::up25deg },
-            { { 13, 9, 11 }, 48, Pitch::up25deg },
-            { { 13, 8, 11 }, 48, Pitch::up25deg },
-            { { 12, 7, 12 }, 48, Pitch::up25deg },
-            { { 12, 6, 12 }, 48, Pitch::up25deg },
-            { { 11, 5, 13 }, 48, Pitch::up25deg },
-            { { 11, 4, 13 }, 48, Pitch::up25deg },
-            { { 10, 3, 14 }, 48, Pitch::up25deg },
-            { { 10, 2, 14 }, 48, Pitch::up25deg },
-            { { 9, 1, 15 }, 48, Pitch::up25deg },
-            { { 9, 0, 15 }, 48, Pitch::up25deg },
-        });
-
-    // 0x4f2f9a
-    // Turnaround 1. Lane 0. Track 7. Reversed 1. Direction 0
-    static constexpr auto moveInfoTA1L0T7R1D0 = std::to_array<MoveInfo>(
-        {
-            { { 0, 24, 0 }, 32, Pitch::down25deg },
-            { { 1, 24, 0 }, 32, Pitch::down25deg },
-            { { 2, 23, -1 }, 32, Pitch::down25deg },
-            { { 3, 23, -1 }, 32, Pitch::down25deg },
-            { { 4, 22, -2 }, 32, Pitch::down25deg },
-            { { 5, 22, -2 }, 32, Pitch::down25deg },
-            { { 6, 21, -3 }, 32, Pitch::down25deg },
-            { { 7, 21, -3 }, 32, Pitch::down25deg },
-            { { 8, 20, -4 }, 32, Pitch::down25deg },
-            { { 9, 20, -4 }, 32, Pitch::down25deg },
-            { { 10, 19, -5 }, 32, Pitch::down25deg },
-            { { 11, 19, -5 }, 32, Pitch::down25deg },
-            { { 12, 18, -6 }, 32, Pitch::down25deg },
-            { { 13, 18, -6 }, 32, Pitch::down25deg },
-            { { 14, 17, -7 }, 32, Pitch::down25deg },
-            { { 15, 17, -7 }, 32, Pitch::down25deg },
-            { { 16, 16, -8 }, 32, Pitch::down25deg },
-            { { 17, 16, -8 }, 32, Pitch::down25deg },
-            { { 18, 15, -9 }, 32, Pitch::down25deg },
-            { { 19, 15, -9 }, 32, Pitch::down25deg },
-            { { 20, 14, -10 }, 32, Pitch::down25deg },
-            { { 21, 14, -10 }, 32, Pitch::down25deg },
-            { { 22, 13, -11 }, 32, Pitch::down25deg },
-            { { 23, 13, -11 }, 32, Pitch::down25deg },
-            { { 24, 12, -12 }, 32, Pitch::down25deg },
-            { { 25, 12, -12 }, 32, Pitch::down25deg },
-            { { 26, 11, -13 }, 32, Pitch::down25deg },
-            { { 27, 11, -13 }, 32, Pitch::down25deg },
-            { { 28, 10, -14 }, 32, Pitch::down25deg },
-            { { 29, 10, -14 }, 32, Pitch::down25deg },
-            { { 30, 9, -15 }, 32, Pitch::down25deg },
-            { { 31, 9, -15 }, 32, Pitch::down25deg },
-        });
-
-    // 0x4f309c
-    // Turnaround 1. Lane 0. Track 7. Reversed 1. Direction 1
-    static constexpr auto moveInfoTA1L0T7R1D1 = std::to_array<MoveInfo>(
-        {
-            { { 24, 31, 0 }, 48, Pitch::down25deg },
-            { { 24, 30, 0 }, 48, Pitch::down25deg },
-            { { 23, 29, -1 }, 48, Pitch::down25deg },
-            { { 23, 28, -1 }, 48, Pitch::down25deg },
-            { { 22, 27, -2 }, 48, Pitch::down25deg },
-            { { 22, 26, -2 }, 48, Pitch::down25deg },
-            { { 21, 25, -3 }, 48, Pitch::down25deg },
-            { { 21, 24, -3 }, 48, Pitch::down25deg },
-            { { 20, 23, -4 }, 48, Pitch::down25deg },
-            { { 20, 22, -4 }, 48, Pitch::down25deg },
-            { { 19, 21, -5 }, 48, Pitch::down25deg },
-            { { 19, 20, -5 }, 48, Pitch::down25deg },
-            { { 18, 19, -6 }, 48, Pitch::down25deg },
-            { { 18, 18, -6 }, 48, Pitch::down25deg },
-            { { 17, 17, -7 }, 48, Pitch::down25deg },
-            { { 17, 16, -7 }, 48, Pitch::down25deg },
-            { { 16, 15, -8 }, 48, Pitch::down25deg },
-            { { 16, 14, -8 }, 48, Pitch::down25deg },
-            { { 15, 13, -9 }, 48, Pitch::down25deg },
-            { { 15, 12, -9 }, 48, Pitch::down25deg },
-            { { 14, 11, -10 }, 48, Pitch::down25deg },
-            { { 14, 10, -10 }, 48, Pitch::down25deg },
-            { { 13, 9, -11 }, 48, Pitch::down25deg },
-            { { 13, 8, -11 }, 48, Pitch::down25deg },
-            { { 12, 7, -12 }, 48, Pitch::down25deg },
-            { { 12, 6, -12 }, 48, Pitch::down25deg },
-            { { 11, 5, -13 }, 48, Pitch::down25deg },
-            { { 11, 4, -13 }, 48, Pitch::down25deg },
-            { { 10, 3, -14 }, 48, Pitch::down25deg },
-            { { 10, 2, -14 }, 48, Pitch::down25deg },
-            { { 9, 1, -15 }, 48, Pitch::down25deg },
-            { { 9, 0, -15 }, 48, Pitch::down25deg },
-        });
-
-    // 0x4f2d96
-    // Turnaround 1. Lane 0. Track 7. Reversed 1. Direction 2
-    static constexpr auto moveInfoTA1L0T7R1D2 = std::to_array<MoveInfo>(
-        {
-            { { 31, 8, 0 }, 0, Pitch::down25deg },
-            { { 30, 8, 0 }, 0, Pitch::down25deg },
-            { { 29, 9, -1 }, 0, Pitch::down25deg },
-            { { 28, 9, -1 }, 0, Pitch::down25deg },
-            { { 27, 10, -2 }, 0, Pitch::down25deg },
-            { { 26, 10, -2 }, 0, Pitch::down25deg },
-            { { 25, 11, -3 }, 0, Pitch::down25deg },
-            { { 24, 11, -3 }, 0, Pitch::down25deg },
-            { { 23, 12, -4 }, 0, Pitch::down25deg },
-            { { 22, 12, -4 }, 0, Pitch::down25deg },
-            { { 21, 13, -5 }, 0, Pitch::down25deg },
-            { { 20, 13, -5 }, 0, Pitch::down25deg },
-            { { 19, 14, -6 }, 0, Pitch::down25deg },
-            { { 18, 14, -6 }, 0, Pitch::down25deg },
-            { { 17, 15, -7 }, 0, Pitch::down25deg },
-            { { 16, 15, -7 }, 0, Pitch::down25deg },
-            { { 15, 16, -8 }, 0, Pitch::down25deg },
-            { { 14, 16, -8 }, 0, Pitch::down25deg },
-            { { 13, 17, -9 }, 0, Pitch::down25deg },
-            { { 12, 17, -9 }, 0, Pitch::down25deg },
-            { { 11, 18, -10 }, 0, Pitch::down25deg },
-            { { 10, 18, -10 }, 0, Pitch::down25deg },
-            { { 9, 19, -11 }, 0, Pitch::down25deg },
-            { { 8, 19, -11 }, 0, Pitch::down25deg },
-            { { 7, 20, -12 }, 0, Pitch::down25deg },
-            { { 6, 20, -12 }, 0, Pitch::down25deg },
-            { { 5, 21, -13 }, 0, Pitch::down25deg },
-            { { 4, 21, -13 }, 0, Pitch::down25deg },
-            { { 3, 22, -14 }, 0, Pitch::down25deg },
-            { { 2, 22, -14 }, 0, Pitch::down25deg },
-            { { 1, 23, -15 }, 0, Pitch::down25deg },
-            { { 0, 23, -15 }, 0, Pitch::down25deg },
-        });
-
-    // 0x4f2e98
-    // Turnaround 1. Lane 0. Track 7. Reversed 1. Direction 3
-    static constexpr auto moveInfoTA1L0T7R1D3 = std::to_array<MoveInfo>(
-        {
-            { { 8, 0, 0 }, 16, Pitch::down25deg },
-            { { 8, 1, 0 }, 16, Pitch::down25deg },
-            { { 9, 2, -1 }, 16, Pitch::down25deg },
-            { { 9, 3, -1 }, 16, Pitch::down25deg },
-            { { 10, 4, -2 }, 16, Pitch::down25deg },
-            { { 10, 5, -2 }, 16, Pitch::down25deg },
-            { { 11, 6, -3 }, 16, Pitch::down25deg },
-            { { 11, 7, -3 }, 16, Pitch::down25deg },
-            { { 12, 8, -4 }, 16, Pitch::down25deg },
-            { { 12, 9, -4 }, 16, Pitch::down25deg },
-            { { 13, 10, -5 }, 16, Pitch::down25deg },
-            { { 13, 11, -5 }, 16, Pitch::down25deg },
-            { { 14, 12, -6 }, 16, Pitch::down25deg },
-            { { 14, 13, -6 }, 16, Pitch::down25deg },
-            { { 15, 14, -7 }, 16, Pitch::down25deg },
-            { { 15, 15, -7 }, 16, Pitch::down25deg },
-            { { 16, 16, -8 }, 16, Pitch::down25deg },
-            { { 16, 17, -8 }, 16, Pitch::down25deg },
-            { { 17, 18, -9 }, 16, Pitch::down25deg },
-            { { 17, 19, -9 }, 16, Pitch::down25deg },
-            { { 18, 20, -10 }, 16, Pitch::down25deg },
-            { { 18, 21, -10 }, 16, Pitch::down25deg },
-            { { 19, 22, -11 }, 16, Pitch::down25deg },
-            { { 19, 23, -11 }, 16, Pitch::down25deg },
-            { { 20, 24, -12 }, 16, Pitch::down25deg },
-            { { 20, 25, -12 }, 16, Pitch::down25deg },
-            { { 21, 26, -13 }, 16, Pitch::down25deg },
-            { { 21, 27, -13 }, 16, Pitch::down25deg },
-            { { 22, 28, -14 }, 16, Pitch::down25deg },
-            { { 22, 29, -14 }, 16, Pitch::down25deg },
-            { { 23, 30, -15 }, 16, Pitch::down25deg },
-            { { 23, 31, -15 }, 16, Pitch::down25deg },
-        });
-
-    // 0x4f2586
-    // Turnaround 1. Lane 1. Track 0. Reversed 0. Direction 0
-    static constexpr auto moveInfoTA1L1T0R0D0 = std::to_array<MoveInfo>(
-        {
-            { { 31, 24, 0 }, 0, Pitch::flat },
-            { { 30, 24, 0 }, 0, Pitch::flat },
-            { { 29, 23, 0 }, 0, Pitch::flat },
-            { { 28, 23, 0 }, 0, Pitch::flat },
-            { { 27, 22, 0 }, 0, Pitch::flat },
-            { { 26, 22, 0 }, 0, Pitch::flat },
-            { { 25, 21, 0 }, 0, Pitch::flat },
-            { { 24, 21, 0 }, 0, Pitch::flat },
-            { { 23, 20, 0 }, 0, Pitch::flat },
-            { { 22, 20, 0 }, 0, Pitch::flat },
-            { { 21, 19, 0 }, 0, Pitch::flat },
-            { { 20, 19, 0 }, 0, Pitch::flat },
-            { { 19, 18, 0 }, 0, Pitch::flat },
-            { { 18, 18, 0 }, 0, Pitch::flat },
-            { { 17, 17, 0 }, 0, Pitch::flat },
-            { { 16, 17, 0 }, 0, Pitch::flat },
-            { { 15, 16, 0 }, 0, Pitch::flat },
-            { { 14, 16, 0 }, 0, Pitch::flat },
-            { { 13, 15, 0 }, 0, Pitch::flat },
-            { { 12, 15, 0 }, 0, Pitch::flat },
-            { { 11, 14, 0 }, 0, Pitch::flat },
-            { { 10, 14, 0 }, 0, Pitch::flat },
-            { { 9, 13, 0 }, 0, Pitch::flat },
-            { { 8, 13, 0 }, 0, Pitch::flat },
-            { { 7, 12, 0 }, 0, Pitch::flat },
-            { { 6, 12, 0 }, 0, Pitch::flat },
-            { { 5, 11, 0 }, 0, Pitch::flat },
-            { { 4, 11, 0 }, 0, Pitch::flat },
-            { { 3, 10, 0 }, 0, Pitch::flat },
-            { { 2, 10, 0 }, 0, Pitch::flat },
-            { { 1, 9, 0 }, 0, Pitch::flat },
-            { { 0, 9, 0 }, 0, Pitch::flat },
-        });
-
-    // 0x4f2688
-    // Turnaround 1. Lane 1. Track 0. Reversed 0. Direction 1
-    static constexpr auto moveInfoTA1L1T0R0D1 = std::to_array<MoveInfo>(
-        {
-            { { 24, 0, 0 }, 16, Pitch::flat },
-            { { 24, 1, 0 }, 16, Pitch::flat },
-            { { 23, 2, 0 }, 16, Pitch::flat },
-            { { 23, 3, 0 }, 16, Pitch::flat },
-            { { 22, 4, 0 }, 16, Pitch::flat },
-            { { 22, 5, 0 }, 16, Pitch::flat },
-            { { 21, 6, 0 }, 16, Pitch::flat },
-            { { 21, 7, 0 }, 16, Pitch::flat },
-            { { 20, 8, 0 }, 16, Pitch::flat },
-            { { 20, 9, 0 }, 16, Pitch::flat },
-            { { 19, 10, 0 }, 16, Pitch::flat },
-            { { 19, 11, 0 }, 16, Pitch::flat },
-            { { 18, 12, 0 }, 16, Pitch::flat },
-            { { 18, 13, 0 }, 16, Pitch::flat },
-            { { 17, 14, 0 }, 16, Pitch::flat },
-            { { 17, 15, 0 }, 16, Pitch::flat },
-            { { 16, 16, 0 }, 16, Pitch::flat },
-            { { 16, 17, 0 }, 16, Pitch::flat },
-            { { 15, 18, 0 }, 16, Pitch::flat },
-            { { 15, 19, 0 }, 16, Pitch::flat },
-            { { 14, 20, 0 }, 16, Pitch::flat },
-            { { 14, 21, 0 }, 16, Pitch::flat },
-            { { 13, 22, 0 }, 16, Pitch::flat },
-            { { 13, 23, 0 }, 16, Pitch::flat },
-            { { 12, 24, 0 }, 16, Pitch::flat },
-            { { 12, 25, 0 }, 16, Pitch::flat },
-            { { 11, 26, 0 }, 16, Pitch::flat },
-            { { 11, 27, 0 }, 16, Pitch::flat },
-            { { 10, 28, 0 }, 16, Pitch::flat },
-            { { 10, 29, 0 }, 16, Pitch::flat },
-            { { 9, 30, 0 }, 16, Pitch::flat },
-            { { 9, 31, 0 }, 16, Pitch::flat },
-        });
-
-    // 0x4f278a
-    // Turnaround 1. Lane 1. Track 0. Reversed 0. Direction 2
-    static constexpr auto moveInfoTA1L1T0R0D2 = std::to_array<MoveInfo>(
-        {
-            { { 0, 8, 0 }, 32, Pitch::flat },
-            { { 1, 8, 0 }, 32, Pitch::flat },
-            { { 2, 9, 0 }, 32, Pitch::flat },
-            { { 3, 9, 0 }, 32, Pitch::flat },
-            { { 4, 10, 0 }, 32, Pitch::flat },
-            { { 5, 10, 0 }, 32, Pitch::flat },
-            { { 6, 11, 0 }, 32, Pitch::flat },
-            { { 7, 11, 0 }, 32, Pitch::flat },
-            { { 8, 12, 0 }, 32, Pitch::flat },
-            { { 9, 12, 0 }, 32, Pitch::flat },
-            { { 10, 13, 0 }, 32, Pitch::flat },
-            { { 11, 13, 0 }, 32, Pitch::flat },
-            { { 12, 14, 0 }, 32, Pitch::flat },
-            { { 13, 14, 0 }, 32, Pitch::flat },
-            { { 14, 15, 0 }, 32, Pitch::flat },
-            { { 15, 15, 0 }, 32, Pitch::flat },
-            { { 16, 16, 0 }, 32, Pitch::flat },
-            { { 17, 16, 0 }, 32, Pitch::flat },
-            { { 18, 17, 0 }, 32, Pitch::flat },
-            { { 19, 17, 0 }, 32, Pitch::flat },
-            { { 20, 18, 0 }, 32, Pitch::flat },
-            { { 21, 18, 0 }, 32, Pitch::flat },
-            { { 22, 19, 0 }, 32, Pitch::flat },
-            { { 23, 19, 0 }, 32, Pitch::flat },
-            { { 24, 20, 0 }, 32, Pitch::flat },
-            { { 25, 20, 0 }, 32, Pitch::flat },
-            { { 26, 21, 0 }, 32, Pitch::flat },
-            { { 27, 21, 0 }, 32, Pitch::flat },
-            { { 28, 22, 0 }, 32, Pitch::flat },
-            { { 29, 22, 0 }, 32, Pitch::flat },
-            { { 30, 23, 0 }, 32, Pitch::flat },
-            { { 31, 23, 0 }, 32, Pitch::flat },
-        });
-
-    // 0x4f288c
-    // Turnaround 1. Lane 1. Track 0. Reversed 0. Direction 3
-    static constexpr auto moveInfoTA1L1T0R0D3 = std::to_array<MoveInfo>(
-        {
-            { { 8, 31, 0 }, 48, Pitch::flat },
-            { { 8, 30, 0 }, 48, Pitch::flat },
-            { { 9, 29, 0 }, 48, Pitch::flat },
-            { { 9, 28, 0 }, 48, Pitch::flat },
-            { { 10, 27, 0 }, 48, Pitch::flat },
-            { { 10, 26, 0 }, 48, Pitch::flat },
-            { { 11, 25, 0 }, 48, Pitch::flat },
-            { { 11, 24, 0 }, 48, Pitch::flat },
-            { { 12, 23, 0 }, 48, Pitch::flat },
-            { { 12, 22, 0 }, 48, Pitch::flat },
-            { { 13, 21, 0 }, 48, Pitch::flat },
-            { { 13, 20, 0 }, 48, Pitch::flat },
-            { { 14, 19, 0 }, 48, Pitch::flat },
-            { { 14, 18, 0 }, 48, Pitch::flat },
-            { { 15, 17, 0 }, 48, Pitch::flat },
-            { { 15, 16, 0 }, 48, Pitch::flat },
-            { { 16, 15, 0 }, 48, Pitch::flat },
-            { { 16, 14, 0 }, 48, Pitch::flat },
-            { { 17, 13, 0 }, 48, Pitch::flat },
-            { { 17, 12, 0 }, 48, Pitch::flat },
-            { { 18, 11, 0 }, 48, Pitch::flat },
-            { { 18, 10, 0 }, 48, Pitch::flat },
-            { { 19, 9, 0 }, 48, Pitch::flat },
-            { { 19, 8, 0 }, 48, Pitch::flat },
-            { { 20, 7, 0 }, 48, Pitch::flat },
-            { { 20, 6, 0 }, 48, Pitch::flat },
-            { { 21, 5, 0 }, 48, Pitch::flat },
-            { { 21, 4, 0 }, 48, Pitch::flat },
-            { { 22, 3, 0 }, 48, Pitch::flat },
-            { { 22, 2, 0 }, 48, Pitch::flat },
-            { { 23, 1, 0 }, 48, Pitch::flat },
-            { { 23, 0, 0 }, 48, Pitch::flat },
-        });
-
-    // 0x4f4508
-    // Turnaround 1. Lane 1. Track 1. Reversed 0. Direction 0
-    static constexpr auto moveInfoTA1L1T1R0D0 = std::to_array<MoveInfo>(
-        {
-            { { 31, 24, 0 }, 0, Pitch::flat },
-            { { 30, 24, 0 }, 0, Pitch::flat },
-            { { 29, 24, 0 }, 62, Pitch::flat },
-            { { 28, 23, 0 }, 60, Pitch::flat },
-            { { 27, 23, 0 }, 58, Pitch::flat },
-            { { 26, 22, 0 }, 56, Pitch::flat },
-            { { 25, 21, 0 }, 54, Pitch::flat },
-            { { 25, 20, 0 }, 52, Pitch::flat },
-            { { 24, 19, 0 }, 50, Pitch::flat },
-            { { 24, 18, 0 }, 48, Pitch::flat },
-            { { 24, 17, 0 }, 48, Pitch::flat },
-            { { 24, 16, 0 }, 48, Pitch::flat },
-            { { 24, 15, 0 }, 48, Pitch::flat },
-            { { 24, 14, 0 }, 48, Pitch::flat },
-            { { 24, 13, 0 }, 48, Pitch::flat },
-            { { 24, 12, 0 }, 48, Pitch::flat },
-            { { 24, 11, 0 }, 48, Pitch::flat },
-            { { 24, 10, 0 }, 48, Pitch::flat },
-            { { 24, 9, 0 }, 48, Pitch::flat },
-            { { 24, 8, 0 }, 48, Pitch::flat },
-            { { 24, 7, 0 }, 48, Pitch::flat },
-            { { 24, 6, 0 }, 48, Pitch::flat },
-            { { 24, 5, 0 }, 48, Pitch::flat },
-            { { 24, 4, 0 }, 48, Pitch::flat },
-            { { 24, 3, 0 }, 48, Pitch::flat },
-            { { 24, 2, 0 }, 48, Pitch::flat },
-            { { 24, 1, 0 }, 48, Pitch::flat },
-            { { 24, 0, 0 }, 48, Pitch::flat },
-        });
-
-    // 0x4f45ea
-    // Turnaround 1. Lane 1. Track 1. Reversed 0. Direction 1
-    static constexpr auto moveInfoTA1L1T1R0D1 = std::to_array<MoveInfo>(
-        {
-            { { 24, 0, 0 }, 16, Pitch::flat },
-            { { 24, 1, 0 }, 16, Pitch::flat },
-            { { 24, 2, 0 }, 14, Pitch::flat },
-            { { 23, 3, 0 }, 12, Pitch::flat },
-            { { 23, 4, 0 }, 10, Pitch::flat },
-            { { 22, 5, 0 }, 8, Pitch::flat },
-            { { 21, 6, 0 }, 8, Pitch::flat },
-            { { 20, 7, 0 }, 6, Pitch::flat },
-            { { 19, 7, 0 }, 4, Pitch::flat },
-            { { 18, 8, 0 }, 2, Pitch::flat },
-            { { 17, 8, 0 }, 0, Pitch::flat },
-            { { 16, 8, 0 }, 0, Pitch::flat },
-            { { 15, 8, 0 }, 0, Pitch::flat },
-            { { 14, 8, 0 }, 0, Pitch::flat },
-            { { 13, 8, 0 }, 0, Pitch::flat },
-            { { 12, 8, 0 }, 0, Pitch::flat },
-            { { 11, 8, 0 }, 0, Pitch::flat },
-            { { 10, 8, 0 }, 0, Pitch::flat },
-            { { 9, 8, 0 }, 0, Pitch::flat },
-            { { 8, 8, 0 }, 0, Pitch::flat },
-            { { 7, 8, 0 }, 0, Pitch::flat },
-            { { 6, 8, 0 }, 0, Pitch::flat },
-            { { 5, 8, 0 }, 0, Pitch::flat },
-            { { 4, 8, 0 }, 0, Pitch::flat },
-            { { 3, 8, 0 }, 0, Pitch::flat },
-            { { 2, 8, 0 }, 0, Pitch::flat },
-            { { 1, 8, 0 }, 0, Pitch::flat },
-            { { 0, 8, 0 }, 0, Pitch::flat },
-        });
-
-    // 0x4f46cc
-    // Turnaround 1. Lane 1. Track 1. Reversed 0. Direction 2
-    static constexpr auto moveInfoTA1L1T1R0D2 = std::to_array<MoveInfo>(
-        {
-            { { 0, 8, 0 }, 32, Pitch::flat },
-            { { 1, 8, 0 }, 32, Pitch::flat },
-            { { 2, 8, 0 }, 32, Pitch::flat },
-            { { 3, 8, 0 }, 30, Pitch::flat },
-            { { 4, 9, 0 }, 28, Pitch::flat },
-            { { 5, 9, 0 }, 26, Pitch::flat },
-            { { 6, 10, 0 }, 24, Pitch::flat },
-            { { 7, 11, 0 }, 22, Pitch::flat },
-            { { 7, 12, 0 }, 20, Pitch::flat },
-            { { 8, 13, 0 }, 18, Pitch::flat },
-            { { 8, 14, 0 }, 16, Pitch::flat },
-            { { 8, 15, 0 }, 16, Pitch::flat },
-            { { 8, 16, 0 }, 16, Pitch::flat },
-            { { 8, 17, 0 }, 16, Pitch::flat },
-            { { 8, 18, 0 }, 16, Pitch::flat },
-            { { 8, 19, 0 }, 16, Pitch::flat },
-            { { 8, 20, 0 }, 16, Pitch::flat },
-            { { 8, 21, 0 }, 16, Pitch::flat },
-            { { 8, 22, 0 }, 16, Pitch::flat },
-            { { 8, 23, 0 }, 16, Pitch::flat },
-            { { 8, 24, 0 }, 16, Pitch::flat },
-            { { 8, 25, 0 }, 16, Pitch::flat },
-            { { 8, 26, 0 }, 16, Pitch::flat },
-            { { 8, 27, 0 }, 16, Pitch::flat },
-            { { 8, 28, 0 }, 16, Pitch::flat },
-            { { 8, 29, 0 }, 16, Pitch::flat },
-            { { 8, 30, 0 }, 16, Pitch::flat },
-            { { 8, 31, 0 }, 16, Pitch::flat },
-        });
-
-    // 0x4f442e
-    // Turnaround 1. Lane 1. Track 1. Reversed 0. Direction 3
-    static constexpr auto moveInfoTA1L1T1R0D3 = std::to_array<MoveInfo>(
-        {
-            { { 8, 31, 0 }, 48, Pitch::flat },
-            { { 8, 30, 0 }, 48, Pitch::flat },
-            { { 8, 29, 0 }, 46, Pitch::flat },
-            { { 9, 28, 0 }, 44, Pitch::flat },
-            { { 9, 27, 0 }, 42, Pitch::flat },
-            { { 10, 26, 0 }, 40, Pitch::flat },
-            { { 11, 25, 0 }, 38, Pitch::flat },
-            { { 12, 25, 0 }, 36, Pitch::flat },
-            { { 13, 24, 0 }, 34, Pitch::flat },
-            { { 14, 24, 0 }, 32, Pitch::flat },
-            { { 15, 24, 0 }, 32, Pitch::flat },
-            { { 16, 24, 0 }, 32, Pitch::flat },
-            { { 17, 24, 0 }, 32, Pitch::flat },
-            { { 18, 24, 0 }, 32, Pitch::flat },
-            { { 19, 24, 0 }, 32, Pitch::flat },
-            { { 20, 24, 0 }, 32, Pitch::flat },
-            { { 21, 24, 0 }, 32, Pitch::flat },
-            { { 22, 24, 0 }, 32, Pitch::flat },
-            { { 23, 24, 0 }, 32, Pitch::flat },
-            { { 24, 24, 0 }, 32, Pitch::flat },
-            { { 25, 24, 0 }, 32, Pitch::flat },
-            { { 26, 24, 0 }, 32, Pitch::flat },
-            { { 27, 24, 0 }, 32, Pitch::flat },
-            { { 28, 24, 0 }, 32, Pitch::flat },
-            { { 29, 24, 0 }, 32, Pitch::flat },
-            { { 30, 24, 0 }, 32, Pitch::flat },
-            { { 31, 24, 0 }, 32, Pitch::flat },
-        });
-
-    // 0x4f40ae
-    // Turnaround 1. Lane 1. Track 1. Reversed 1. Direction 0
-    static constexpr auto moveInfoTA1L1T1R1D0 = std::to_array<MoveInfo>(
-        {
-            { { 24, 0, 0 }, 16, Pitch::flat },
-            { { 24, 1, 0 }, 16, Pitch::flat },
-            { { 24, 2, 0 }, 16, Pitch::flat },
-            { { 24, 3, 0 }, 16, Pitch::flat },
-            { { 24, 4, 0 }, 16, Pitch::flat },
-            { { 24, 5, 0 }, 16, Pitch::flat },
-            { { 24, 6, 0 }, 16, Pitch::flat },
-            { { 24, 7, 0 }, 16, Pitch::flat },
-            { { 24, 8, 0 }, 16, Pitch::flat },
-            { { 24, 9, 0 }, 16, Pitch::flat },
-            { { 24, 10, 0 }, 16, Pitch::flat },
-            { { 24, 11, 0 }, 16, Pitch::flat },
-            { { 24, 12, 0 }, 16, Pitch::flat },
-            { { 24, 13, 0 }, 16, Pitch::flat },
-            { { 24, 14, 0 }, 16, Pitch::flat },
-            { { 24, 15, 0 }, 16, Pitch::flat },
-            { { 24, 16, 0 }, 16, Pitch::flat },
-            { { 24, 17, 0 }, 16, Pitch::flat },
-            { { 24, 18, 0 }, 16, Pitch::flat },
-            { { 24, 19, 0 }, 18, Pitch::flat },
-            { { 25, 20, 0 }, 20, Pitch::flat },
-            { { 25, 21, 0 }, 22, Pitch::flat },
-            { { 26, 22, 0 }, 24, Pitch::flat },
-            { { 27, 23, 0 }, 26, Pitch::flat },
-            { { 28, 23, 0 }, 28, Pitch::flat },
-            { { 29, 24, 0 }, 30, Pitch::flat },
-            { { 30, 24, 0 }, 32, Pitch::flat },
-            { { 31, 24, 0 }, 32, Pitch::flat },
-        });
-
-    // 0x4f4190
-    // Turnaround 1. Lane 1. Track 1. Reversed 1. Direction 1
-    static constexpr auto moveInfoTA1L1T1R1D1 = std::to_array<MoveInfo>(
-        {
-            { { 0, 8, 0 }, 32, Pitch::flat },
-            { { 1, 8, 0 }, 32, Pitch::flat },
-            { { 2, 8, 0 }, 32, Pitch::flat },
-            { { 3, 8, 0 }, 32, Pitch::flat },
-            { { 4, 8, 0 }, 32, Pitch::flat },
-            { { 5, 8, 0 }, 32, Pitch::flat },
-            { { 6, 8, 0 }, 32, Pitch::flat },
-            { { 7, 8, 0 }, 32, Pitch::flat },
-            { { 8, 8, 0 }, 32, Pitch::flat },
-            { { 9, 8, 0 }, 32, Pitch::flat },
-            { { 10, 8, 0 }, 32, Pitch::flat },
-            { { 11, 8, 0 }, 32, Pitch::flat },
-            { { 12, 8, 0 }, 32, Pitch::flat },
-            { { 13, 8, 0 }, 32, Pitch::flat },
-            { { 14, 8, 0 }, 32, Pitch::flat },
-            { { 15, 8, 0 }, 32, Pitch::flat },
-            { { 16, 8, 0 }, 32, Pitch::flat },
-            { { 17, 8, 0 }, 32, Pitch::flat },
-            { { 18, 8, 0 }, 34, Pitch::flat },
-            { { 19, 7, 0 }, 36, Pitch::flat },
-            { { 20, 7, 0 }, 38, Pitch::flat },
-            { { 21, 6, 0 }, 40, Pitch::flat },
-            { { 22, 5, 0 }, 40, Pitch::flat },
-            { { 23, 4, 0 }, 42, Pitch::flat },
-            { { 23, 3, 0 }, 44, Pitch::flat },
-            { { 24, 2, 0 }, 46, Pitch::flat },
-            { { 24, 1, 0 }, 48, Pitch::flat },
-            { { 24, 0, 0 }, 48, Pitch::flat },
-        });
-
-    // 0x4f4272
-    // Turnaround 1. Lane 1. Track 1. Reversed 1. Direction 2
-    static constexpr auto moveInfoTA1L1T1R1D2 = std::to_array<MoveInfo>(
-        {
-            { { 8, 31, 0 }, 48, Pitch::flat },
-            { { 8, 30, 0 }, 48, Pitch::flat },
-            { { 8, 29, 0 }, 48, Pitch::flat },
-            { { 8, 28, 0 }, 48, Pitch::flat },
-            { { 8, 27, 0 }, 48, Pitch::flat },
-            { { 8, 26, 0 }, 48, Pitch::flat },
-            { { 8, 25, 0 }, 48, Pitch::flat },
-            { { 8, 24, 0 }, 48, Pitch::flat },
-            { { 8, 23, 0 }, 48, Pitch::flat },
-            { { 8, 22, 0 }, 48, Pitch::flat },
-            { { 8, 21, 0 }, 48, Pitch::flat },
-            { { 8, 20, 0 }, 48, Pitch::flat },
-            { { 8, 19, 0 }, 48, Pitch::flat },
-            { { 8, 18, 0 }, 48, Pitch::flat },
-            { { 8, 17, 0 }, 48, Pitch::flat },
-            { { 8, 16, 0 }, 48, Pitch::flat },
-            { { 8, 15, 0 }, 48, Pitch::flat },
-            { { 8, 14, 0 }, 48, Pitch::flat },
-            { { 8, 13, 0 }, 50, Pitch::flat },
-            { { 7, 12, 0 }, 52, Pitch::flat },
-            { { 7, 11, 0 }, 54, Pitch::flat },
-            { { 6, 10, 0 }, 56, Pitch::flat },
-            { { 5, 9, 0 }, 58, Pitch::flat },
-            { { 4, 9, 0 }, 60, Pitch::flat },
-            { { 3, 8, 0 }, 62, Pitch::flat },
-            { { 2, 8, 0 }, 0, Pitch::flat },
-            { { 1, 8, 0 }, 0, Pitch::flat },
-            { { 0, 8, 0 }, 0, Pitch::flat },
-        });
-
-    // 0x4f4354
-    // Turnaround 1. Lane 1. Track 1. Reversed 1. Direction 3
-    static constexpr auto moveInfoTA1L1T1R1D3 = std::to_array<MoveInfo>(
-        {
-            { { 31, 24, 0 }, 0, Pitch::flat },
-            { { 30, 24, 0 }, 0, Pitch::flat },
-            { { 29, 24, 0 }, 0, Pitch::flat },
-            { { 28, 24, 0 }, 0, Pitch::flat },
-            { { 27, 24, 0 }, 0, Pitch::flat },
-            { { 26, 24, 0 }, 0, Pitch::flat },
-            { { 25, 24, 0 }, 0, Pitch::flat },
-            { { 24, 24, 0 }, 0, Pitch::flat },
-            { { 23, 24, 0 }, 0, Pitch::flat },
-            { { 22, 24, 0 }, 0, Pitch::flat },
-            { { 21, 24, 0 }, 0, Pitch::flat },
-            { { 20, 24, 0 }, 0, Pitch::flat },
-            { { 19, 24, 0 }, 0, Pitch::flat },
-            { { 18, 24, 0 }, 0, Pitch::flat },
-            { { 17, 24, 0 }, 0, Pitch::flat },
-            { { 16, 24, 0 }, 0, Pitch::flat },
-            { { 15, 24, 0 }, 0, Pitch::flat },
-            { { 14, 24, 0 }, 0, Pitch::flat },
-            { { 13, 24, 0 }, 2, Pitch::flat },
-            { { 12, 25, 0 }, 4, Pitch::flat },
-            { { 11, 25, 0 }, 6, Pitch::flat },
-            { { 10, 26, 0 }, 8, Pitch::flat },
-            { { 9, 27, 0 }, 10, Pitch::flat },
-            { { 9, 28, 0 }, 12, Pitch::flat },
-            { { 8, 29, 0 }, 14, Pitch::flat },
-            { { 8, 30, 0 }, 16, Pitch::flat },
-            { { 8, 31, 0 }, 16, Pitch::flat },
-        });
-
-    // 0x4f65d0
-    // Turnaround 1. Lane 1. Track 3. Reversed 0. Direction 0
-    static constexpr auto moveInfoTA1L1T3R0D0 = std::to_array<MoveInfo>(
-        {
-            { { 31, 24, 0 }, 0, Pitch::flat },
-            { { 30, 24, 0 }, 0, Pitch::flat },
-            { { 29, 24, 0 }, 0, Pitch::flat },
-            { { 28, 24, 0 }, 62, Pitch::flat },
-            { { 27, 24, 0 }, 62, Pitch::flat },
-            { { 26, 24, 0 }, 62, Pitch::flat },
-            { { 25, 23, 0 }, 62, Pitch::flat },
-            { { 24, 23, 0 }, 62, Pitch::flat },
-            { { 23, 23, 0 }, 62, Pitch::flat },
-            { { 22, 23, 0 }, 62, Pitch::flat },
-            { { 21, 22, 0 }, 62, Pitch::flat },
-            { { 20, 22, 0 }, 60, Pitch::flat },
-            { { 19, 22, 0 }, 60, Pitch::flat },
-            { { 18, 22, 0 }, 60, Pitch::flat },
-            { { 17, 21, 0 }, 60, Pitch::flat },
-            { { 16, 21, 0 }, 60, Pitch::flat },
-            { { 15, 21, 0 }, 60, Pitch::flat },
-            { { 14, 20, 0 }, 60, Pitch::flat },
-            { { 13, 20, 0 }, 58, Pitch::flat },
-            { { 12, 19, 0 }, 58, Pitch::flat },
-            { { 11, 18, 0 }, 58, Pitch::flat },
-            { { 10, 18, 0 }, 58, Pitch::flat },
-            { { 9, 17, 0 }, 58, Pitch::flat },
-            { { 8, 16, 0 }, 58, Pitch::flat },
-            { { 7, 15, 0 }, 56, Pitch::flat },
-            { { 6, 14, 0 }, 56, Pitch::flat },
-            { { 5, 14, 0 }, 56, Pitch::flat },
-            { { 4, 13, 0 }, 56, Pitch::flat },
-            { { 3, 13, 0 }, 56, Pitch::flat },
-            { { 2, 12, 0 }, 56, Pitch::flat },
-            { { 2, 11, 0 }, 56, Pitch::flat },
-            { { 1, 10, 0 }, 54, Pitch::flat },
-            { { 0, 9, 0 }, 54, Pitch::flat },
-            { { -1, 8, 0 }, 54, Pitch::flat },
-            { { -2, 7, 0 }, 54, Pitch::flat },
-            { { -2, 6, 0 }, 54, Pitch::flat },
-            { { -3, 5, 0 }, 54, Pitch::flat },
-            { { -4, 4, 0 }, 54, Pitch::flat },
-            { { -4, 3, 0 }, 52, Pitch::flat },
-            { { -5, 2, 0 }, 52, Pitch::flat },
-            { { -5, 1, 0 }, 52, Pitch::flat },
-            { { -5, 0, 0 }, 52, Pitch::flat },
-            { { -6, -1, 0 }, 52, Pitch::flat },
-            { { -6, -2, 0 }, 52, Pitch::flat },
-            { { -6, -3, 0 }, 52, Pitch::flat },
-            { { -6, -4, 0 }, 52, Pitch::flat },
-            { { -7, -5, 0 }, 50, Pitch::flat },
-            { { -7, -6, 0 }, 50, Pitch::flat },
-            { { -7, -7, 0 }, 50, Pitch::flat },
-            { { -7, -8, 0 }, 50, Pitch::flat },
-            { { -8, -9, 0 }, 50, Pitch::flat },
-            { { -8, -10, 0 }, 50, Pitch::flat },
-            { { -8, -11, 0 }, 50, Pitch::flat },
-            { { -8, -12, 0 }, 48, Pitch::flat },
-            { { -8, -13, 0 }, 48, Pitch::flat },
-            { { -8, -14, 0 }, 48, Pitch::flat },
-            { { -8, -15, 0 }, 48, Pitch::flat },
-            { { -8, -16, 0 }, 48, Pitch::flat },
-            { { -8, -17, 0 }, 48, Pitch::flat },
-            { { -8, -18, 0 }, 48, Pitch::flat },
-            { { -8, -19, 0 }, 48, Pitch::flat },
-            { { -8, -20, 0 }, 48, Pitch::flat },
-            { { -8, -21, 0 }, 48, Pitch::flat },
-            { { -8, -22, 0 }, 48, Pitch::flat },
-            { { -8, -23, 0 }, 48, Pitch::flat },
-            { { -8, -24, 0 }, 48, Pitch::flat },
-            { { -8, -25, 0 }, 48, Pitch::flat },
-            { { -8, -26, 0 }, 48, Pitch::flat },
-            { { -8, -27, 0 }, 48, Pitch::flat },
-            { { -8, -28, 0 }, 48, Pitch::flat },
-            { { -8, -29, 0 }, 48, Pitch::flat },
-            { { -8, -30, 0 }, 48, Pitch::flat },
-            { { -8, -31, 0 }, 48, Pitch::flat },
-            { { -8, -32, 0 }, 48, Pitch::flat },
-        });
-
-    // 0x4f6822
-    // Turnaround 1. Lane 1. Track 3. Reversed 0. Direction 1
-    static constexpr auto moveInfoTA1L1T3R0D1 = std::to_array<MoveInfo>(
-        {
-            { { 24, 0, 0 }, 16, Pitch::flat },
-            { { 24, 1, 0 }, 16, Pitch::flat },
-            { { 24, 2, 0 }, 16, Pitch::flat },
-            { { 24, 3, 0 }, 16, Pitch::flat },
-            { { 24, 4, 0 }, 14, Pitch::flat },
-            { { 24, 5, 0 }, 14, Pitch::flat },
-            { { 24, 6, 0 }, 14, Pitch::flat },
-            { { 23, 7, 0 }, 14, Pitch::flat },
-            { { 23, 8, 0 }, 14, Pitch::flat },
-            { { 23, 9, 0 }, 14, Pitch::flat },
-            { { 23, 10, 0 }, 14, Pitch::flat },
-            { { 22, 11, 0 }, 14, Pitch::flat },
-            { { 22, 12, 0 }, 12, Pitch::flat },
-            { { 22, 13, 0 }, 12, Pitch::flat },
-            { { 22, 14, 0 }, 12, Pitch::flat },
-            { { 21, 15, 0 }, 12, Pitch::flat },
-            { { 21, 16, 0 }, 12, Pitch::flat },
-            { { 21, 17, 0 }, 12, Pitch::flat },
-            { { 20, 18, 0 }, 12, Pitch::flat },
-            { { 20, 19, 0 }, 10, Pitch::flat },
-            { { 19, 20, 0 }, 10, Pitch::flat },
-            { { 18, 21, 0 }, 10, Pitch::flat },
-            { { 18, 22, 0 }, 10, Pitch::flat },
-            { { 17, 23, 0 }, 10, Pitch::flat },
-            { { 16, 24, 0 }, 10, Pitch::flat },
-            { { 15, 25, 0 }, 8, Pitch::flat },
-            { { 14, 26, 0 }, 8, Pitch::flat },
-            { { 14, 27, 0 }, 8, Pitch::flat },
-            { { 13, 28, 0 }, 8, Pitch::flat },
-            { { 13, 29, 0 }, 8, Pitch::flat },
-            { { 12, 30, 0 }, 8, Pitch::flat },
-            { { 11, 30, 0 }, 8, Pitch::flat },
-            { { 10, 31, 0 }, 6, Pitch::flat },
-            { { 9, 32, 0 }, 6, Pitch::flat },
-            { { 8, 33, 0 }, 6, Pitch::flat },
-            { { 7, 34, 0 }, 6, Pitch::flat },
-            { { 6, 34, 0 }, 6, Pitch::flat },
-            { { 5, 35, 0 }, 6, Pitch::flat },
-            { { 4, 36, 0 }, 6, Pitch::flat },
-            { { 3, 36, 0 }, 4, Pitch::flat },
-            { { 2, 37, 0 }, 4, Pitch::flat },
-            { { 1, 37, 0 }, 4, Pitch::flat },
-            { { 0, 37, 0 }, 4, Pitch::flat },
-            { { -1, 38, 0 }, 4, Pitch::flat },
-            { { -2, 38, 0 }, 4, Pitch::flat },
-            { { -3, 38, 0 }, 4, Pitch::flat },
-            { { -4, 38, 0 }, 4, Pitch::flat },
-            { { -5, 39, 0 }, 2, Pitch::flat },
-            { { -6, 39, 0 }, 2, Pitch::flat },
-            { { -7, 39, 0 }, 2, Pitch::flat },
-            { { -8, 39, 0 }, 2, Pitch::flat },
-            { { -9, 40, 0 }, 2, Pitch::flat },
-            { { -10, 40, 0 }, 2, Pitch::flat },
-            { { -11, 40, 0 }, 2, Pitch::flat },
-            { { -12, 40, 0 }, 0, Pitch::flat },
-            { { -13, 40, 0 }, 0, Pitch::flat },
-            { { -14, 40, 0 }, 0, Pitch::flat },
-            { { -15, 40, 0 }, 0, Pitch::flat },
-            { { -16, 40, 0 }, 0, Pitch::flat },
-            { { -17, 40, 0 }, 0, Pitch::flat },
-            { { -18, 40, 0 }, 0, Pitch::flat },
-            { { -19, 40, 0 }, 0, Pitch::flat },
-            { { -20, 40, 0 }, 0, Pitch::flat },
-            { { -21, 40, 0 }, 0, Pitch::flat },
-            { { -22, 40, 0 }, 0, Pitch::flat },
-            { { -23, 40, 0 }, 0, Pitch::flat },
-            { { -24, 40, 0 }, 0, Pitch::flat },
-            { { -25, 40, 0 }, 0, Pitch::flat },
-            { { -26, 40, 0 }, 0, Pitch::flat },
-            { { -27, 40, 0 }, 0, Pitch::flat },
-            { { -28, 40, 0 }, 0, Pitch::flat },
-            { { -29, 40, 0 }, 0, Pitch::flat },
-            { { -30, 40, 0 }, 0, Pitch::flat },
-            { { -31, 40, 0 }, 0, Pitch::flat },
-            { { -32, 40, 0 }, 0, Pitch::flat },
-        });
-
-    // 0x4f6a7c
-    // Turnaround 1. Lane 1. Track 3. Reversed 0. Direction 2
-    static constexpr auto moveInfoTA1L1T3R0D2 = std::to_array<MoveInfo>(
-        {
-            { { 0, 8, 0 }, 32, Pitch::flat },
-            { { 1, 8, 0 }, 32, Pitch::flat },
-            { { 2, 8, 0 }, 32, Pitch::flat },
-            { { 3, 8, 0 }, 32, Pitch::flat },
-            { { 4, 8, 0 }, 30, Pitch::flat },
-            { { 5, 8, 0 }, 30, Pitch::flat },
-            { { 6, 8, 0 }, 30, Pitch::flat },
-            { { 7, 9, 0 }, 30, Pitch::flat },
-            { { 8, 9, 0 }, 30, Pitch::flat },
-            { { 9, 9, 0 }, 30, Pitch::flat },
-            { { 10, 9, 0 }, 30, Pitch::flat },
-            { { 11, 10, 0 }, 30, Pitch::flat },
-            { { 12, 10, 0 }, 28, Pitch::flat },
-            { { 13, 10, 0 }, 28, Pitch::flat },
-            { { 14, 10, 0 }, 28, Pitch::flat },
-            { { 15, 11, 0 }, 28, Pitch::flat },
-            { { 16, 11, 0 }, 28, Pitch::flat },
-            { { 17, 11, 0 }, 28, Pitch::flat },
-            { { 18, 12, 0 }, 28, Pitch::flat },
-            { { 19, 12, 0 }, 26, Pitch::flat },
-            { { 20, 13, 0 }, 26, Pitch::flat },
-            { { 21, 14, 0 }, 26, Pitch::flat },
-            { { 22, 14, 0 }, 26, Pitch::flat },
-            { { 23, 15, 0 }, 26, Pitch::flat },
-            { { 24, 16, 0 }, 26, Pitch::flat },
-            { { 25, 17, 0 }, 24, Pitch::flat },
-            { { 26, 18, 0 }, 24, Pitch::flat },
-            { { 27, 18, 0 }, 24, Pitch::flat },
-            { { 28, 19, 0 }, 24, Pitch::flat },
-            { { 29, 19, 0 }, 24, Pitch::flat },
-            { { 30, 20, 0 }, 24, Pitch::flat },
-            { { 30, 21, 0 }, 24, Pitch::flat },
-            { { 31, 22, 0 }, 22, Pitch::flat },
-            { { 32, 23, 0 }, 22, Pitch::flat },
-            { { 33, 24, 0 }, 22, Pitch::flat },
-            { { 34, 25, 0 }, 22, Pitch::flat },
-            { { 34, 26, 0 }, 22, Pitch::flat },
-            { { 35, 27, 0 }, 22, Pitch::flat },
-            { { 36, 28, 0 }, 22, Pitch::flat },
-            { { 36, 29, 0 }, 20, Pitch::flat },
-            { { 37, 30, 0 }, 20, Pitch::flat },
-            { { 37, 31, 0 }, 20, Pitch::flat },
-            { { 37, 32, 0 }, 20, Pitch::flat },
-            { { 38, 33, 0 }, 20, Pitch::flat },
-            { { 38, 34, 0 }, 20, Pitch::flat },
-            { { 38, 35, 0 }, 20, Pitch::flat },
-            { { 38, 36, 0 }, 20, Pitch::flat },
-            { { 39, 37, 0 }, 18, Pitch::flat },
-            { { 39, 38, 0 }, 18, Pitch::flat },
-            { { 39, 39, 0 }, 18, Pitch::flat },
-            { { 39, 40, 0 }, 18, Pitch::flat },
-            { { 40, 41, 0 }, 18, Pitch::flat },
-            { { 40, 42, 0 }, 18, Pitch::flat },
-            { { 40, 43, 0 }, 18, Pitch::flat },
-            { { 40, 44, 0 }, 16, Pitch::flat },
-            { { 40, 45, 0 }, 16, Pitch::flat },
-            { { 40, 46, 0 }, 16, Pitch::flat },
-            { { 40, 47, 0 }, 16, Pitch::flat },
-            { { 40, 48, 0 }, 16, Pitch::flat },
-            { { 40, 49, 0 }, 16, Pitch::flat },
-            { { 40, 50, 0 }, 16, Pitch::flat },
-            { { 40, 51, 0 }, 16, Pitch::flat },
-            { { 40, 52, 0 }, 16, Pitch::flat },
-            { { 40, 53, 0 }, 16, Pitch::flat },
-            { { 40, 54, 0 }, 16, Pitch::flat },
-            { { 40, 55, 0 }, 16, Pitch::flat },
-            { { 40, 56, 0 }, 16, Pitch::flat },
-            { { 40, 57, 0 }, 16, Pitch::flat },
-            { { 40, 58, 0 }, 16, Pitch::flat },
-            { { 40, 59, 0 }, 16, Pitch::flat },
-            { { 40, 60, 0 }, 16, Pitch::flat },
-            { { 40, 61, 0 }, 16, Pitch::flat },
-            { { 40, 62, 0 }, 16, Pitch::flat },
-            { { 40, 63, 0 }, 16, Pitch::flat },
-        });
-
-    // 0x4f6386
-    // Turnaround 1. Lane 1. Track 3. Reversed 0. Direction 3
-    static constexpr auto moveInfoTA1L1T3R0D3 = std::to_array<MoveInfo>(
-        {
-            { { 8, 31, 0 }, 48, Pitch::flat },
-            { { 8, 30, 0 }, 48, Pitch::flat },
-            { { 8, 29, 0 }, 48, Pitch::flat },
-            { { 8, 28, 0 }, 46, Pitch::flat },
-            { { 8, 27, 0 }, 46, Pitch::flat },
-            { { 8, 26, 0 }, 46, Pitch::flat },
-            { { 9, 25, 0 }, 46, Pitch::flat },
-            { { 9, 24, 0 }, 46, Pitch::flat },
-            { { 9, 23, 0 }, 46, Pitch::flat },
-            { { 9, 22, 0 }, 46, Pitch::flat },
-            { { 10, 21, 0 }, 46, Pitch::flat },
-            { { 10, 20, 0 }, 44, Pitch::flat },
-            { { 10, 19, 0 }, 44, Pitch::flat },
-            { { 10, 18, 0 }, 44, Pitch::flat },
-            { { 11, 17, 0 }, 44, Pitch::flat },
-            { { 11, 16, 0 }, 44, Pitch::flat },
-            { { 11, 15, 0 }, 44, Pitch::flat },
-            { { 12, 14, 0 }, 44, Pitch::flat },
-            { { 12, 13, 0 }, 42, Pitch::flat },
-            { { 13, 12, 0 }, 42, Pitch::flat },
-            { { 14, 11, 0 }, 42, Pitch::flat },
-            { { 14, 10, 0 }, 42, Pitch::flat },
-            { { 15, 9, 0 }, 42, Pitch::flat },
-            { { 16, 8, 0 }, 42, Pitch::flat },
-            { { 17, 7, 0 }, 40, Pitch::flat },
-            { { 18, 6, 0 }, 40, Pitch::flat },
-            { { 18, 5, 0 }, 40, Pitch::flat },
-            { { 19, 4, 0 }, 40, Pitch::flat },
-            { { 19, 3, 0 }, 40, Pitch::flat },
-            { { 20, 2, 0 }, 40, Pitch::flat },
-            { { 21, 2, 0 }, 40, Pitch::flat },
-            { { 22, 1, 0 }, 38, Pitch::flat },
-            { { 23, 0, 0 }, 38, Pitch::flat },
-            { { 24, -1, 0 }, 38, Pitch::flat },
-            { { 25, -2, 0 }, 38, Pitch::flat },
-            { { 26, -2, 0 }, 38, Pitch::flat },
-            { { 27, -3, 0 }, 38, Pitch::flat },
-            { { 28, -4, 0 }, 38, Pitch::flat },
-            { { 29, -4, 0 }, 36, Pitch::flat },
-            { { 30, -5, 0 }, 36, Pitch::flat },
-            { { 31, -5, 0 }, 36, Pitch::flat },
-            { { 32, -5, 0 }, 36, Pitch::flat },
-            { { 33, -6, 0 }, 36, Pitch::flat },
-            { { 34, -6, 0 }, 36, Pitch::flat },
-            { { 35, -6, 0 }, 36, Pitch::flat },
-            { { 36, -6, 0 }, 36, Pitch::flat },
-            { { 37, -7, 0 }, 34, Pitch::flat },
-            { { 38, -7, 0 }, 34, Pitch::flat },
-            { { 39, -7, 0 }, 34, Pitch::flat },
-            { { 40, -7, 0 }, 34, Pitch::flat },
-            { { 41, -8, 0 }, 34, Pitch::flat },
-            { { 42, -8, 0 }, 34, Pitch::flat },
-            { { 43, -8, 0 }, 34, Pitch::flat },
-            { { 44, -8, 0 }, 32, Pitch::flat },
-            { { 45, -8, 0 }, 32, Pitch::flat },
-            { { 46, -8, 0 }, 32, Pitch::flat },
-            { { 47, -8, 0 }, 32, Pitch::flat },
-            { { 48, -8, 0 }, 32, Pitch::flat },
-            { { 49, -8, 0 }, 32, Pitch::flat },
-            { { 50, -8, 0 }, 32, Pitch::flat },
-            { { 51, -8, 0 }, 32, Pitch::flat },
-            { { 52, -8, 0 }, 32, Pitch::flat },
-            { { 53, -8, 0 }, 32, Pitch::flat },
-            { { 54, -8, 0 }, 32, Pitch::flat },
-            { { 55, -8, 0 }, 32, Pitch::flat },
-            { { 56, -8, 0 }, 32, Pitch::flat },
-            { { 57, -8, 0 }, 32, Pitch::flat },
-            { { 58, -8, 0 }, 32, Pitch::flat },
-            { { 59, -8, 0 }, 32, Pitch::flat },
-            { { 60, -8, 0 }, 32, Pitch::flat },
-            { { 61, -8, 0 }, 32, Pitch::flat },
-            { { 62, -8, 0 }, 32, Pitch::flat },
-            { { 63, -8, 0 }, 32, Pitch::flat },
-        });
-
-    // 0x4f5a3e
-    // Turnaround 1. Lane 1. Track 3. Reversed 1. Direction 0
-    static constexpr auto moveInfoTA1L1T3R1D0 = std::to_array<MoveInfo>(
-        {
-            { { 24, 0, 0 }, 16, Pitch::flat },
-            { { 24, 1, 0 }, 16, Pitch::flat },
-            { { 24, 2, 0 }, 16, Pitch::flat },
-            { { 24, 3, 0 }, 16, Pitch::flat },
-            { { 24, 4, 0 }, 16, Pitch::flat },
-            { { 24, 5, 0 }, 16, Pitch::flat },
-            { { 24, 6, 0 }, 16, Pitch::flat },
-            { { 24, 7, 0 }, 16, Pitch::flat },
-            { { 24, 8, 0 }, 16, Pitch::flat },
-            { { 24, 9, 0 }, 16, Pitch::flat },
-            { { 24, 10, 0 }, 16, Pitch::flat },
-            { { 24, 11, 0 }, 16, Pitch::flat },
-            { { 24, 12, 0 }, 16, Pitch::flat },
-            { { 24, 13, 0 }, 16, Pitch::flat },
-            { { 24, 14, 0 }, 16, Pitch::flat },
-            { { 24, 15, 0 }, 16, Pitch::flat },
-            { { 24, 16, 0 }, 16, Pitch::flat },
-            { { 24, 17, 0 }, 16, Pitch::flat },
-            { { 24, 18, 0 }, 16, Pitch::flat },
-            { { 24, 19, 0 }, 16, Pitch::flat },
-            { { 24, 20, 0 }, 18, Pitch::flat },
-            { { 24, 21, 0 }, 18, Pitch::flat },
-            { { 24, 22, 0 }, 18, Pitch::flat },
-            { { 25, 23, 0 }, 18, Pitch::flat },
-            { { 25, 24, 0 }, 18, Pitch::flat },
-            { { 25, 25, 0 }, 18, Pitch::flat },
-            { { 25, 26, 0 }, 18, Pitch::flat },
-            { { 26, 27, 0 }, 18, Pitch::flat },
-            { { 26, 28, 0 }, 20, Pitch::flat },
-            { { 26, 29, 0 }, 20, Pitch::flat },
-            { { 26, 30, 0 }, 20, Pitch::flat },
-            { { 27, 31, 0 }, 20, Pitch::flat },
-            { { 27, 32, 0 }, 20, Pitch::flat },
-            { { 27, 33, 0 }, 20, Pitch::flat },
-            { { 28, 34, 0 }, 20, Pitch::flat },
-            { { 28, 35, 0 }, 22, Pitch::flat },
-            { { 29, 36, 0 }, 22, Pitch::flat },
-            { { 30, 37, 0 }, 22, Pitch::flat },
-            { { 30, 38, 0 }, 22, Pitch::flat },
-            { { 31, 39, 0 }, 22, Pitch::flat },
-            { { 32, 40, 0 }, 22, Pitch::flat },
-            { { 33, 41, 0 }, 24, Pitch::flat },
-            { { 34, 42, 0 }, 24, Pitch::flat },
-            { { 34, 43, 0 }, 24, Pitch::flat },
-            { { 35, 44, 0 }, 24, Pitch::flat },
-            { { 35, 45, 0 }, 24, Pitch::flat },
-            { { 36, 46, 0 }, 24, Pitch::flat },
-            { { 37, 46, 0 }, 24, Pitch::flat },
-            { { 38, 47, 0 }, 26, Pitch::flat },
-            { { 39, 48, 0 }, 26, Pitch::flat },
-            { { 40, 49, 0 }, 26, Pitch::flat },
-            { { 41, 50, 0 }, 26, Pitch::flat },
-            { { 42, 50, 0 }, 26, Pitch::flat },
-            { { 43, 51, 0 }, 26, Pitch::flat },
-            { { 44, 52, 0 }, 26, Pitch::flat },
-            { { 45, 52, 0 }, 28, Pitch::flat },
-            { { 46, 53, 0 }, 28, Pitch::flat },
-            { { 47, 53, 0 }, 28, Pitch::flat },
-            { { 48, 53, 0 }, 28, Pitch::flat },
-            { { 49, 54, 0 }, 28, Pitch::flat },
-            { { 50, 54, 0 }, 28, Pitch::flat },
-            { { 51, 54, 0 }, 28, Pitch::flat },
-            { { 52, 54, 0 }, 28, Pitch::flat },
-            { { 53, 55, 0 }, 30, Pitch::flat },
-            { { 54, 55, 0 }, 30, Pitch::flat },
-            { { 55, 55, 0 }, 30, Pitch::flat },
-            { { 56, 55, 0 }, 30, Pitch::flat },
-            { { 57, 56, 0 }, 30, Pitch::flat },
-            { { 58, 56, 0 }, 30, Pitch::flat },
-            { { 59, 56, 0 }, 30, Pitch::flat },
-            { { 60, 56, 0 }, 32, Pitch::flat },
-            { { 61, 56, 0 }, 32, Pitch::flat },
-            { { 62, 56, 0 }, 32, Pitch::flat },
-            { { 63, 56, 0 }, 32, Pitch::flat },
-        });
-
-    // 0x4f5c90
-    // Turnaround 1. Lane 1. Track 3. Reversed 1. Direction 1
-    static constexpr auto moveInfoTA1L1T3R1D1 = std::to_array<MoveInfo>(
-        {
-            { { 0, 8, 0 }, 32, Pitch::flat },
-            { { 1, 8, 0 }, 32, Pitch::flat },
-            { { 2, 8, 0 }, 32, Pitch::flat },
-            { { 3, 8, 0 }, 32, Pitch::flat },
-            { { 4, 8, 0 }, 32, Pitch::flat },
-            { { 5, 8, 0 }, 32, Pitch::flat },
-            { { 6, 8, 0 }, 32, Pitch::flat },
-            { { 7, 8, 0 }, 32, Pitch::flat },
-            { { 8, 8, 0 }, 32, Pitch::flat },
-            { { 9, 8, 0 }, 32, Pitch::flat },
-            { { 10, 8, 0 }, 32, Pitch::flat },
-            { { 11, 8, 0 }, 32, Pitch::flat },
-            { { 12, 8, 0 }, 32, Pitch::flat },
-            { { 13, 8, 0 }, 32, Pitch::flat },
-            { { 14, 8, 0 }, 32, Pitch::flat },
-            { { 15, 8, 0 }, 32, Pitch::flat },
-            { { 16, 8, 0 }, 32, Pitch::flat },
-            { { 17, 8, 0 }, 32, Pitch::flat },
-            { { 18, 8, 0 }, 32, Pitch::flat },
-            { { 19, 8, 0 }, 32, Pitch::flat },
-            { { 20, 8, 0 }, 34, Pitch::flat },
-            { { 21, 8, 0 }, 34, Pitch::flat },
-            { { 22, 8, 0 }, 34, Pitch::flat },
-            { { 23, 7, 0 }, 34, Pitch::flat },
-            { { 24, 7, 0 }, 34, Pitch::flat },
-            { { 25, 7, 0 }, 34, Pitch::flat },
-            { { 26, 7, 0 }, 34, Pitch::flat },
-            { { 27, 6, 0 }, 34, Pitch::flat },
-            { { 28, 6, 0 }, 36, Pitch::flat },
-            { { 29, 6, 0 }, 36, Pitch::flat },
-            { { 30, 6, 0 }, 36, Pitch::flat },
-            { { 31, 5, 0 }, 36, Pitch::flat },
-            { { 32, 5, 0 }, 36, Pitch::flat },
-            { { 33, 5, 0 }, 36, Pitch::flat },
-            { { 34, 4, 0 }, 36, Pitch::flat },
-            { { 35, 4, 0 }, 38, Pitch::flat },
-            { { 36, 3, 0 }, 38, Pitch::flat },
-            { { 37, 2, 0 }, 38, Pitch::flat },
-            { { 38, 2, 0 }, 38, Pitch::flat },
-            { { 39, 1, 0 }, 38, Pitch::flat },
-            { { 40, 0, 0 }, 38, Pitch::flat },
-            { { 41, -1, 0 }, 40, Pitch::flat },
-            { { 42, -2, 0 }, 40, Pitch::flat },
-            { { 43, -2, 0 }, 40, Pitch::flat },
-            { { 44, -3, 0 }, 40, Pitch::flat },
-            { { 45, -3, 0 }, 40, Pitch::flat },
-            { { 46, -4, 0 }, 40, Pitch::flat },
-            { { 46, -5, 0 }, 40, Pitch::flat },
-            { { 47, -6, 0 }, 42, Pitch::flat },
-            { { 48, -7, 0 }, 42, Pitch::flat },
-            { { 49, -8, 0 }, 42, Pitch::flat },
-            { { 50, -9, 0 }, 42, Pitch::flat },
-            { { 50, -10, 0 }, 42, Pitch::flat },
-            { { 51, -11, 0 }, 42, Pitch::flat },
-            { { 52, -12, 0 }, 42, Pitch::flat },
-            { { 52, -13, 0 }, 44, Pitch::flat },
-            { { 53, -14, 0 }, 44, Pitch::flat },
-            { { 53, -15, 0 }, 44, Pitch::flat },
-            { { 53, -16, 0 }, 44, Pitch::flat },
-            { { 54, -17, 0 }, 44, Pitch::flat },
-            { { 54, -18, 0 }, 44, Pitch::flat },
-            { { 54, -19, 0 }, 44, Pitch::flat },
-            { { 54, -20, 0 }, 44, Pitch::flat },
-            { { 55, -21, 0 }, 46, Pitch::flat },
-            { { 55, -22, 0 }, 46, Pitch::flat },
-            { { 55, -23, 0 }, 46, Pitch::flat },
-            { { 55, -24, 0 }, 46, Pitch::flat },
-            { { 56, -25, 0 }, 46, Pitch::flat },
-            { { 56, -26, 0 }, 46, Pitch::flat },
-            { { 56, -27, 0 }, 46, Pitch::flat },
-            { { 56, -28, 0 }, 48, Pitch::flat },
-            { { 56, -29, 0 }, 48, Pitch::flat },
-            { { 56, -30, 0 }, 48, Pitch::flat },
-            { { 56, -31, 0 }, 48, Pitch::flat },
-            { { 56, -32, 0 }, 48, Pitch::flat },
-        });
-
-    // 0x4f5eea
-    // Turnaround 1. Lane 1. Track 3. Reversed 1. Direction 2
-    static constexpr auto moveInfoTA1L1T3R1D2 = std::to_array<MoveInfo>(
-        {
-            { { 8, 31, 0 }, 48, Pitch::flat },
-            { { 8, 30, 0 }, 48, Pitch::flat },
-            { { 8, 29, 0 }, 48, Pitch::flat },
-            { { 8, 28, 0 }, 48, Pitch::flat },
-            { { 8, 27, 0 }, 48, Pitch::flat },
-            { { 8, 26, 0 }, 48, Pitch::flat },
-            { { 8, 25, 0 }, 48, Pitch::flat },
-            { { 8, 24, 0 }, 48, Pitch::flat },
-            { { 8, 23, 0 }, 48, Pitch::flat },
-            { { 8, 22, 0 }, 48, Pitch::flat },
-            { { 8, 21, 0 }, 48, Pitch::flat },
-            { { 8, 20, 0 }, 48, Pitch::flat },
-            { { 8, 19, 0 }, 48, Pitch::flat },
-            { { 8, 18, 0 }, 48, Pitch::flat },
-            { { 8, 17, 0 }, 48, Pitch::flat },
-            { { 8, 16, 0 }, 48, Pitch::flat },
-            { { 8, 15, 0 }, 48, Pitch::flat },
-            { { 8, 14, 0 }, 48, Pitch::flat },
-            { { 8, 13, 0 }, 48, Pitch::flat },
-            { { 8, 12, 0 }, 50, Pitch::flat },
-            { { 8, 11, 0 }, 50, Pitch::flat },
-            { { 8, 10, 0 }, 50, Pitch::flat },
-            { { 7, 9, 0 }, 50, Pitch::flat },
-            { { 7, 8, 0 }, 50, Pitch::flat },
-            { { 7, 7, 0 }, 50, Pitch::flat },
-            { { 7, 6, 0 }, 50, Pitch::flat },
-            { { 6, 5, 0 }, 50, Pitch::flat },
-            { { 6, 4, 0 }, 52, Pitch::flat },
-            { { 6, 3, 0 }, 52, Pitch::flat },
-            { { 6, 2, 0 }, 52, Pitch::flat },
-            { { 5, 1, 0 }, 52, Pitch::flat },
-            { { 5, 0, 0 }, 52, Pitch::flat },
-            { { 5, -1, 0 }, 52, Pitch::flat },
-            { { 4, -2, 0 }, 52, Pitch::flat },
-            { { 4, -3, 0 }, 54, Pitch::flat },
-            { { 3, -4, 0 }, 54, Pitch::flat },
-            { { 2, -5, 0 }, 54, Pitch::flat },
-            { { 2, -6, 0 }, 54, Pitch::flat },
-            { { 1, -7, 0 }, 54, Pitch::flat },
-            { { 0, -8, 0 }, 54, Pitch::flat },
-            { { -1, -9, 0 }, 56, Pitch::flat },
-            { { -2, -10, 0 }, 56, Pitch::flat },
-            { { -2, -11, 0 }, 56, Pitch::flat },
-            { { -3, -12, 0 }, 56, Pitch::flat },
-            { { -3, -13, 0 }, 56, Pitch::flat },
-            { { -4, -14, 0 }, 56, Pitch::flat },
-            { { -5, -14, 0 }, 56, Pitch::flat },
-            { { -6, -15, 0 }, 58, Pitch::flat },
-            { { -7, -16, 0 }, 58, Pitch::flat },
-            { { -8, -17, 0 }, 58, Pitch::flat },
-            { { -9, -18, 0 }, 58, Pitch::flat },
-            { { -10, -18, 0 }, 58, Pitch::flat },
-            { { -11, -19, 0 }, 58, Pitch::flat },
-            { { -12, -20, 0 }, 58, Pitch::flat },
-            { { -13, -20, 0 }, 60, Pitch::flat },
-            { { -14, -21, 0 }, 60, Pitch::flat },
-            { { -15, -21, 0 }, 60, Pitch::flat },
-            { { -16, -21, 0 }, 60, Pitch::flat },
-            { { -17, -22, 0 }, 60, Pitch::flat },
-            { { -18, -22, 0 }, 60, Pitch::flat },
-            { { -19, -22, 0 }, 60, Pitch::flat },
-            { { -20, -22, 0 }, 60, Pitch::flat },
-            { { -21, -23, 0 }, 62, Pitch::flat },
-            { { -22, -23, 0 }, 62, Pitch::flat },
-            { { -23, -23, 0 }, 62, Pitch::flat },
-            { { -24, -23, 0 }, 62, Pitch::flat },
-            { { -25, -24, 0 }, 62, Pitch::flat },
-            { { -26, -24, 0 }, 62, Pitch::flat },
-            { { -27, -24, 0 }, 62, Pitch::flat },
-            { { -28, -24, 0 }, 0, Pitch::flat },
-            { { -29, -24, 0 }, 0, Pitch::flat },
-            { { -30, -24, 0 }, 0, Pitch::flat },
-            { { -31, -24, 0 }, 0, Pitch::flat },
-            { { -32, -24, 0 }, 0, Pitch::flat },
-        });
-
-    // 0x4f613c
-    // Turnaround 1. Lane 1. Track 3. Reversed 1. Direction 3
-    static constexpr auto moveInfoTA1L1T3R1D3 = std::to_array<MoveInfo>(
-        {
-            { { 31, 24, 0 }, 0, Pitch::flat },
-            { { 30, 24, 0 }, 0, Pitch::flat },
-            { { 29, 24, 0 }, 0, Pitch::flat },
-            { { 28, 24, 0 }, 0, Pitch::flat },
-            { { 27, 24, 0 }, 0, Pitch::flat },
-            { { 26, 24, 0 }, 0, Pitch::flat },
-            { { 25, 24, 0 }, 0, Pitch::flat },
-            { { 24, 24, 0 }, 0, Pitch::flat },
-            { { 23, 24, 0 }, 0, Pitch::flat },
-            { { 22, 24, 0 }, 0, Pitch::flat },
-            { { 21, 24, 0 }, 0, Pitch::flat },
-            { { 20, 24, 0 }, 0, Pitch::flat },
-            { { 19, 24, 0 }, 0, Pitch::flat },
-            { { 18, 24, 0 }, 0, Pitch::flat },
-            { { 17, 24, 0 }, 0, Pitch::flat },
-            { { 16, 24, 0 }, 0, Pitch::flat },
-            { { 15, 24, 0 }, 0, Pitch::flat },
-            { { 14, 24, 0 }, 0, Pitch::flat },
-            { { 13, 24, 0 }, 0, Pitch::flat },
-            { { 12, 24, 0 }, 2, Pitch::flat },
-            { { 11, 24, 0 }, 2, Pitch::flat },
-            { { 10, 24, 0 }, 2, Pitch::flat },
-            { { 9, 25, 0 }, 2, Pitch::flat },
-            { { 8, 25, 0 }, 2, Pitch::flat },
-            { { 7, 25, 0 }, 2, Pitch::flat },
-            { { 6, 25, 0 }, 2, Pitch::flat },
-            { { 5, 26, 0 }, 2, Pitch::flat },
-            { { 4, 26, 0 }, 4, Pitch::flat },
-            { { 3, 26, 0 }, 4, Pitch::flat },
-            { { 2, 26, 0 }, 4, Pitch::flat },
-            { { 1, 27, 0 }, 4, Pitch::flat },
-            { { 0, 27, 0 }, 4, Pitch::flat },
-            { { -1, 27, 0 }, 4, Pitch::flat },
-            { { -2, 28, 0 }, 4, Pitch::flat },
-            { { -3, 28, 0 }, 6, Pitch::flat },
-            { { -4, 29, 0 }, 6, Pitch::flat },
-            { { -5, 30, 0 }, 6, Pitch::flat },
-            { { -6, 30, 0 }, 6, Pitch::flat },
-            { { -7, 31, 0 }, 6, Pitch::flat },
-            { { -8, 32, 0 }, 6, Pitch::flat },
-            { { -9, 33, 0 }, 8, Pitch::flat },
-            { { -10, 34, 0 }, 8, Pitch::flat },
-            { { -11, 34, 0 }, 8, Pitch::flat },
-            { { -12, 35, 0 }, 8, Pitch::flat },
-            { { -13, 35, 0 }, 8, Pitch::flat },
-            { { -14, 36, 0 }, 8, Pitch::flat },
-            { { -14, 37, 0 }, 8, Pitch::flat },
-            { { -15, 38, 0 }, 10, Pitch::flat },
-            { { -16, 39, 0 }, 10, Pitch::flat },
-            { { -17, 40, 0 }, 10, Pitch::flat },
-            { { -18, 41, 0 }, 10, Pitch::flat },
-            { { -18, 42, 0 }, 10, Pitch::flat },
-            { { -19, 43, 0 }, 10, Pitch::flat },
-            { { -20, 44, 0 }, 10, Pitch::flat },
-            { { -20, 45, 0 }, 12, Pitch::flat },
-            { { -21, 46, 0 }, 12, Pitch::flat },
-            { { -21, 47, 0 }, 12, Pitch::flat },
-            { { -21, 48, 0 }, 12, Pitch::flat },
-            { { -22, 49, 0 }, 12, Pitch::flat },
-            { { -22, 50, 0 }, 12, Pitch::flat },
-            { { -22, 51, 0 }, 12, Pitch::flat },
-            { { -22, 52, 0 }, 12, Pitch::flat },
-            { { -23, 53, 0 }, 14, Pitch::flat },
-            { { -23, 54, 0 }, 14, Pitch::flat },
-            { { -23, 55, 0 }, 14, Pitch::flat },
-            { { -23, 56, 0 }, 14, Pitch::flat },
-            { { -24, 57, 0 }, 14, Pitch::flat },
-            { { -24, 58, 0 }, 14, Pitch::flat },
-            { { -24, 59, 0 }, 14, Pitch::flat },
-            { { -24, 60, 0 }, 16, Pitch::flat },
-            { { -24, 61, 0 }, 16, Pitch::flat },
-            { { -24, 62, 0 }, 16, Pitch::flat },
-            { { -24, 63, 0 }, 16, Pitch::flat },
-        });
-
-    // 0x4f116e
-    // Turnaround 1. Lane 1. Track 5. Reversed 0. Direction 0
-    static constexpr auto moveInfoTA1L1T5R0D0 = std::to_array<MoveInfo>(
-        {
-            { { 31, 24, 0 }, 0, Pitch::up12deg },
-            { { 30, 24, 0 }, 0, Pitch::up12deg },
-            { { 29, 24, 0 }, 0, Pitch::up12deg },
-            { { 28, 24, 0 }, 0, Pitch::up12deg },
-            { { 27, 23, 1 }, 0, Pitch::up12deg },
-            { { 26, 23, 1 }, 0, Pitch::up12deg },
-            { { 25, 23, 1 }, 0, Pitch::up12deg },
-            { { 24, 23, 1 }, 0, Pitch::up12deg },
-            { { 23, 22, 2 }, 0, Pitch::up12deg },
-            { { 22, 22, 2 }, 0, Pitch::up12deg },
-            { { 21, 22, 2 }, 0, Pitch::up12deg },
-            { { 20, 22, 2 }, 0, Pitch::up12deg },
-            { { 19, 21, 3 }, 0, Pitch::up12deg },
-            { { 18, 21, 3 }, 0, Pitch::up12deg },
-            { { 17, 21, 3 }, 0, Pitch::up12deg },
-            { { 16, 21, 3 }, 0, Pitch::up12deg },
-            { { 15, 20, 4 }, 0, Pitch::up12deg },
-            { { 14, 20, 4 }, 0, Pitch::up12deg },
-            { { 13, 20, 4 }, 0, Pitch::up12deg },
-            { { 12, 20, 4 }, 0, Pitch::up12deg },
-            { { 11, 19, 5 }, 0, Pitch::up12deg },
-            { { 10, 19, 5 }, 0, Pitch::up12deg },
-            { { 9, 19, 5 }, 0, Pitch::up12deg },
-            { { 8, 19, 5 }, 0, Pitch::up12deg },
-            { { 7, 18, 6 }, 0, Pitch::up12deg },
-            { { 6, 18, 6 }, 0, Pitch::up12deg },
-            { { 5, 18, 6 }, 0, Pitch::up12deg },
-            { { 4, 18, 6 }, 0, Pitch::up12deg },
-            { { 3, 17, 7 }, 0, Pitch::up12deg },
-            { { 2, 17, 7 }, 0, Pitch::up12deg },
-            { { 1, 17, 7 }, 0, Pitch::up12deg },
-            { { 0, 17, 7 }, 0, Pitch::up12deg },
-            { { -1, 16, 8 }, 0, Pitch::up12deg },
-            { { -2, 16, 8 }, 0, Pitch::up12deg },
-            { { -3, 16, 8 }, 0, Pitch::up12deg },
-            { { -4, 16, 8 }, 0, Pitch::up12deg },
-            { { -5, 15, 9 }, 0, Pitch::up12deg },
-            { { -6, 15, 9 }, 0, Pitch::up12deg },
-            { { -7, 15, 9 }, 0, Pitch::up12deg },
-            { { -8, 15, 9 }, 0, Pitch::up12deg },
-            { { -9, 14, 10 }, 0, Pitch::up12deg },
-            { { -10, 14, 10 }, 0, Pitch::up12deg },
-            { { -11, 14, 10 }, 0, Pitch::up12deg },
-            { { -12, 14, 10 }, 0, Pitch::up12deg },
-            { { -13, 13, 11 }, 0, Pitch::up12deg },
-            { { -14, 13, 11 }, 0, Pitch::up12deg },
-            { { -15, 13, 11 }, 0, Pitch::up12deg },
-            { { -16, 13, 11 }, 0, Pitch::up12deg },
-            { { -17, 12, 12 }, 0, Pitch::up12deg },
-            { { -18, 12, 12 }, 0, Pitch::up12deg },
-            { { -19, 12, 12 }, 0, Pitch::up12deg },
-            { { -20, 12, 12 }, 0, Pitch::up12deg },
-            { { -21, 11, 13 }, 0, Pitch::up12deg },
-            { { -22, 11, 13 }, 0, Pitch::up12deg },
-            { { -23, 11, 13 }, 0, Pitch::up12deg },
-            { { -24, 11, 13 }, 0, Pitch::up12deg },
-            { { -25, 10, 14 }, 0, Pitch::up12deg },
-            { { -26, 10, 14 }, 0, Pitch::up12deg },
-            { { -27, 10, 14 }, 0, Pitch::up12deg },
-            { { -28, 10, 14 }, 0, Pitch::up12deg },
-            { { -29, 9, 15 }, 0, Pitch::up12deg },
-            { { -30, 9, 15 }, 0, Pitch::up12deg },
-            { { -31, 9, 15 }, 0, Pitch::up12deg },
-            { { -32, 9, 15 }, 0, Pitch::up12deg },
-        });
-
-    // 0x4f1370
-    // Turnaround 1. Lane 1. Track 5. Reversed 0. Direction 1
-    static constexpr auto moveInfoTA1L1T5R0D1 = std::to_array<MoveInfo>(
-        {
-            { { 24, 0, 0 }, 16, Pitch::up12deg },
-            { { 24, 1, 0 }, 16, Pitch::up12deg },
-            { { 24, 2, 0 }, 16, Pitch::up12deg },
-            { { 24, 3, 0 }, 16, Pitch::up12deg },
-            { { 23, 4, 1 }, 16, Pitch::up12deg },
-            { { 23, 5, 1 }, 16, Pitch::up12deg },
-            { { 23, 6, 1 }, 16, Pitch::up12deg },
-            { { 23, 7, 1 }, 16, Pitch::up12deg },
-            { { 22, 8, 2 }, 16, Pitch::up12deg },
-            { { 22, 9, 2 }, 16, Pitch::up12deg },
-            { { 22, 10, 2 }, 16, Pitch::up12deg },
-            { { 22, 11, 2 }, 16, Pitch::up12deg },
-            { { 21, 12, 3 }, 16, Pitch::up12deg },
-            { { 21, 13, 3 }, 16, Pitch::up12deg },
-            { { 21, 14, 3 }, 16, Pitch::up12deg },
-            { { 21, 15, 3 }, 16, Pitch::up12deg },
-            { { 20, 16, 4 }, 16, Pitch::up12deg },
-            { { 20, 17, 4 }, 16, Pitch::up12deg },
-            { { 20, 18, 4 }, 16, Pitch::up12deg },
-            { { 20, 19, 4 }, 16, Pitch::up12deg },
-            { { 19, 20, 5 }, 16, Pitch::up12deg },
-            { { 19, 21, 5 }, 16, Pitch::up12deg },
-            { { 19, 22, 5 }, 16, Pitch::up12deg },
-            { { 19, 23, 5 }, 16, Pitch::up12deg },
-            { { 18, 24, 6 }, 16, Pitch::up12deg },
-            { { 18, 25, 6 }, 16, Pitch::up12deg },
-            { { 18, 26, 6 }, 16, Pitch::up12deg },
-            { { 18, 27, 6 }, 16, Pitch::up12deg },
-            { { 17, 28, 7 }, 16, Pitch::up12deg },
-            { { 17, 29, 7 }, 16, Pitch::up12deg },
-            { { 17, 30, 7 }, 16, Pitch::up12deg },
-            { { 17, 31, 7 }, 16, Pitch::up12deg },
-            { { 16, 32, 8 }, 16, Pitch::up12deg },
-            { { 16, 33, 8 }, 16, Pitch::up12deg },
-            { { 16, 34, 8 }, 16, Pitch::up12deg },
-            { { 16, 35, 8 }, 16, Pitch::up12deg },
-            { { 15, 36, 9 }, 16, Pitch::up12deg },
-            { { 15, 37, 9 }, 16, Pitch::up12deg },
-            { { 15, 38, 9 }, 16, Pitch::up12deg },
-            { { 15, 39, 9 }, 16, Pitch::up12deg },
-            { { 14, 40, 10 }, 16, Pitch::up12deg },
-            { { 14, 41, 10 }, 16, Pitch::up12deg },
-            { { 14, 42, 10 }, 16, Pitch::up12deg },
-            { { 14, 43, 10 }, 16, Pitch::up12deg },
-            { { 13, 44, 11 }, 16, Pitch::up12deg },
-            { { 13, 45, 11 }, 16, Pitch::up12deg },
-            { { 13, 46, 11 }, 16, Pitch::up12deg },
-            { { 13, 47, 11 }, 16, Pitch::up12deg },
-            { { 12, 48, 12 }, 16, Pitch::up12deg },
-            { { 12, 49, 12 }, 16, Pitch::up12deg },
-            { { 12, 50, 12 }, 16, Pitch::up12deg },
-            { { 12, 51, 12 }, 16, Pitch::up12deg },
-            { { 11, 52, 13 }, 16, Pitch::up12deg },
-            { { 11, 53, 13 }, 16, Pitch::up12deg },
-            { { 11, 54, 13 }, 16, Pitch::up12deg },
-            { { 11, 55, 13 }, 16, Pitch::up12deg },
-            { { 10, 56, 14 }, 16, Pitch::up12deg },
-            { { 10, 57, 14 }, 16, Pitch::up12deg },
-            { { 10, 58, 14 }, 16, Pitch::up12deg },
-            { { 10, 59, 14 }, 16, Pitch::up12deg },
-            { { 9, 60, 15 }, 16, Pitch::up12deg },
-            { { 9, 61, 15 }, 16, Pitch::up12deg },
-            { { 9, 62, 15 }, 16, Pitch::up12deg },
-            { { 9, 63, 15 }, 16, Pitch::up12deg },
-        });
-
-    // 0x4f1572
-    // Turnaround 1. Lane 1. Track 5. Reversed 0. Direction 2
-    static constexpr auto moveInfoTA1L1T5R0D2 = std::to_array<MoveInfo>(
-        {
-            { { 0, 8, 0 }, 32, Pitch::up12deg },
-            { { 1, 8, 0 }, 32, Pitch::up12deg },
-            { { 2, 8, 0 }, 32, Pitch::up12deg },
-            { { 3, 8, 0 }, 32, Pitch::up12deg },
-            { { 4, 9, 1 }, 32, Pitch::up12deg },
-            { { 5, 9, 1 }, 32, Pitch::up12deg },
-            { { 6, 9, 1 }, 32, Pitch::up12deg },
-            { { 7, 9, 1 }, 32, Pitch::up12deg },
-            { { 8, 10, 2 }, 32, Pitch::up12deg },
-            { { 9, 10, 2 }, 32, Pitch::up12deg },
-            { { 10, 10, 2 }, 32, Pitch::up12deg },
-            { { 11, 10, 2 }, 32, Pitch::up12deg },
-            { { 12, 11, 3 }, 32, Pitch::up12deg },
-            { { 13, 11, 3 }, 32, Pitch::up12deg },
-            { { 14, 11, 3 }, 32, Pitch::up12deg },
-            { { 15, 11, 3 }, 32, Pitch::up12deg },
-            { { 16, 12, 4 }, 32, Pitch::up12deg },
-            { { 17, 12, 4 }, 32, Pitch::up12deg },
-            { { 18, 12, 4 }, 32, Pitch::up12deg },
-            { { 19, 12, 4 }, 32, Pitch::up12deg },
-            { { 20, 13, 5 }, 32, Pitch::up12deg },
-            { { 21, 13, 5 }, 32, Pitch::up12deg },
-            { { 22, 13, 5 }, 32, Pitch::up12deg },
-            { { 23, 13, 5 }, 32, Pitch::up12deg },
-            { { 24, 14, 6 }, 32, Pitch::up12deg },
-            { { 25, 14, 6 }, 32, Pitch::up12deg },
-            { { 26, 14, 6 }, 32, Pitch::up12deg },
-            { { 27, 14, 6 }, 32, Pitch::up12deg },
-            { { 28, 15, 7 }, 32, Pitch::up12deg },
-            { { 29, 15, 7 }, 32, Pitch::up12deg },
-            { { 30, 15, 7 }, 32, Pitch::up12deg },
-            { { 31, 15, 7 }, 32, Pitch::up12deg },
-            { { 32, 16, 8 }, 32, Pitch::up12deg },
-            { { 33, 16, 8 }, 32, Pitch::up12deg },
-            { { 34, 16, 8 }, 32, Pitch::up12deg },
-            { { 35, 16, 8 }, 32, Pitch::up12deg },
-            { { 36, 17, 9 }, 32, Pitch::up12deg },
-            { { 37, 17, 9 }, 32, Pitch::up12deg },
-            { { 38, 17, 9 }, 32, Pitch::up12deg },
-            { { 39, 17, 9 }, 32, Pitch::up12deg },
-            { { 40, 18, 10 }, 32, Pitch::up12deg },
-            { { 41, 18, 10 }, 32, Pitch::up12deg },
-            { { 42, 18, 10 }, 32, Pitch::up12deg },
-            { { 43, 18, 10 }, 32, Pitch::up12deg },
-            { { 44, 19, 11 }, 32, Pitch::up12deg },
-            { { 45, 19, 11 }, 32, Pitch::up12deg },
-            { { 46, 19, 11 }, 32, Pitch::up12deg },
-            { { 47, 19, 11 }, 32, Pitch::up12deg },
-            { { 48, 20, 12 }, 32, Pitch::up12deg },
-            { { 49, 20, 12 }, 32, Pitch::up12deg },
-            { { 50, 20, 12 }, 32, Pitch::up12deg },
-            { { 51, 20, 12 }, 32, Pitch::up12deg },
-            { { 52, 21, 13 }, 32, Pitch::up12deg },
-            { { 53, 21, 13 }, 32, Pitch::up12deg },
-            { { 54, 21, 13 }, 32, Pitch::up12deg },
-            { { 55, 21, 13 }, 32, Pitch::up12deg },
-            { { 56, 22, 14 }, 32, Pitch::up12deg },
-            { { 57, 22, 14 }, 32, Pitch::up12deg },
-            { { 58, 22, 14 }, 32, Pitch::up12deg },
-            { { 59, 22, 14 }, 32, Pitch::up12deg },
-            { { 60, 23, 15 }, 32, Pitch::up12deg },
-            { { 61, 23, 15 }, 32, Pitch::up12deg },
-            { { 62, 23, 15 }, 32, Pitch::up12deg },
-            { { 63, 23, 15 }, 32, Pitch::up12deg },
-        });
-
-    // 0x4f1774
-    // Turnaround 1. Lane 1. Track 5. Reversed 0. Direction 3
-    static constexpr auto moveInfoTA1L1T5R0D3 = std::to_array<MoveInfo>(
-        {
-            { { 8, 31, 0 }, 48, Pitch::up12deg },
-            { { 8, 30, 0 }, 48, Pitch::up12deg },
-            { { 8, 29, 0 }, 48, Pitch::up12deg },
-            { { 8, 28, 0 }, 48, Pitch::up12deg },
-            { { 9, 27, 1 }, 48, Pitch::up12deg },
-            { { 9, 26, 1 }, 48, Pitch::up12deg },
-            { { 9, 25, 1 }, 48, Pitch::up12deg },
-            { { 9, 24, 1 }, 48, Pitch::up12deg },
-            { { 10, 23, 2 }, 48, Pitch::up12deg },
-            { { 10, 22, 2 }, 48, Pitch::up12deg },
-            { { 10, 21, 2 }, 48, Pitch::up12deg },
-            { { 10, 20, 2 }, 48, Pitch::up12deg },
-            { { 11, 19, 3 }, 48, Pitch::up12deg },
-            { { 11, 18, 3 }, 48, Pitch::up12deg },
-            { { 11, 17, 3 }, 48, Pitch::up12deg },
-            { { 11, 16, 3 }, 48, Pitch::up12deg },
-            { { 12, 15, 4 }, 48, Pitch::up12deg },
-            { { 12, 14, 4 }, 48, Pitch::up12deg },
-            { { 12, 13, 4 }, 48, Pitch::up12deg },
-            { { 12, 12, 4 }, 48, Pitch::up12deg },
-            { { 13, 11, 5 }, 48, Pitch::up12deg },
-            { { 13, 10, 5 }, 48, Pitch::up12deg },
-            { { 13, 9, 5 }, 48, Pitch::up12deg },
-            { { 13, 8, 5 }, 48, Pitch::up12deg },
-            { { 14, 7, 6 }, 48, Pitch::up12deg },
-            { { 14, 6, 6 }, 48, Pitch::up12deg },
-            { { 14, 5, 6 }, 48, Pitch::up12deg },
-            { { 14, 4, 6 }, 48, Pitch::up12deg },
-            { { 15, 3, 7 }, 48, Pitch::up12deg },
-            { { 15, 2, 7 }, 48, Pitch::up12deg },
-            { { 15, 1, 7 }, 48, Pitch::up12deg },
-            { { 15, 0, 7 }, 48, Pitch::up12deg },
-            { { 16, -1, 8 }, 48, Pitch::up12deg },
-            { { 16, -2, 8 }, 48, Pitch::up12deg },
-            { { 16, -3, 8 }, 48, Pitch::up12deg },
-            { { 16, -4, 8 }, 48, Pitch::up12deg },
-            { { 17, -5, 9 }, 48, Pitch::up12deg },
-            { { 17, -6, 9 }, 48, Pitch::up12deg },
-            { { 17, -7, 9 }, 48, Pitch::up12deg },
-            { { 17, -8, 9 }, 48, Pitch::up12deg },
-            { { 18, -9, 10 }, 48, Pitch::up12deg },
-            { { 18, -10, 10 }, 48, Pitch::up12deg },
-            { { 18, -11, 10 }, 48, Pitch::up12deg },
-            { { 18, -12, 10 }, 48, Pitch::up12deg },
-            { { 19, -13, 11 }, 48, Pitch::up12deg },
-            { { 19, -14, 11 }, 48, Pitch::up12deg },
-            { { 19, -15, 11 }, 48, Pitch::up12deg },
-            { { 19, -16, 11 }, 48, Pitch::up12deg },
-            { { 20, -17, 12 }, 48, Pitch::up12deg },
-            { { 20, -18, 12 }, 48, Pitch::up12deg },
-            { { 20, -19, 12 }, 48, Pitch::up12deg },
-            { { 20, -20, 12 }, 48, Pitch::up12deg },
-            { { 21, -21, 13 }, 48, Pitch::up12deg },
-            { { 21, -22, 13 }, 48, Pitch::up12deg },
-            { { 21, -23, 13 }, 48, Pitch::up12deg },
-            { { 21, -24, 13 }, 48, Pitch::up12deg },
-            { { 22, -25, 14 }, 48, Pitch::up12deg },
-            { { 22, -26, 14 }, 48, Pitch::up12deg },
-            { { 22, -27, 14 }, 48, Pitch::up12deg },
-            { { 22, -28, 14 }, 48, Pitch::up12deg },
-            { { 23, -29, 15 }, 48, Pitch::up12deg },
-            { { 23, -30, 15 }, 48, Pitch::up12deg },
-            { { 23, -31, 15 }, 48, Pitch::up12deg },
-            { { 23, -32, 15 }, 48, Pitch::up12deg },
-        });
-
-    // 0x4f1d7a
-    // Turnaround 1. Lane 1. Track 5. Reversed 1. Direction 0
-    static constexpr auto moveInfoTA1L1T5R1D0 = std::to_array<MoveInfo>(
-        {
-            { { 0, 8, 0 }, 32, Pitch::down12deg },
-            { { 1, 8, 0 }, 32, Pitch::down12deg },
-            { { 2, 8, 0 }, 32, Pitch::down12deg },
-            { { 3, 8, 0 }, 32, Pitch::down12deg },
-            { { 4, 9, -1 }, 32, Pitch::down12deg },
-            { { 5, 9, -1 }, 32, Pitch::down12deg },
-            { { 6, 9, -1 }, 32, Pitch::down12deg },
-            { { 7, 9, -1 }, 32, Pitch::down12deg },
-            { { 8, 10, -2 }, 32, Pitch::down12deg },
-            { { 9, 10, -2 }, 32, Pitch::down12deg },
-            { { 10, 10, -2 }, 32, Pitch::down12deg },
-            { { 11, 10, -2 }, 32, Pitch::down12deg },
-            { { 12, 11, -3 }, 32, Pitch::down12deg },
-            { { 13, 11, -3 }, 32, Pitch::down12deg },
-            { { 14, 11, -3 }, 32, Pitch::down12deg },
-            { { 15, 11, -3 }, 32, Pitch::down12deg },
-            { { 16, 12, -4 }, 32, Pitch::down12deg },
-            { { 17, 12, -4 }, 32, Pitch::down12deg },
-            { { 18, 12, -4 }, 32, Pitch::down12deg },
-            { { 19, 12, -4 }, 32, Pitch::down12deg },
-            { { 20, 13, -5 }, 32, Pitch::down12deg },
-            { { 21, 13, -5 }, 32, Pitch::down12deg },
-            { { 22, 13, -5 }, 32, Pitch::down12deg },
-            { { 23, 13, -5 }, 32, Pitch::down12deg },
-            { { 24, 14, -6 }, 32, Pitch::down12deg },
-            { { 25, 14, -6 }, 32, Pitch::down12deg },
-            { { 26, 14, -6 }, 32, Pitch::down12deg },
-            { { 27, 14, -6 }, 32, Pitch::down12deg },
-            { { 28, 15, -7 }, 32, Pitch::down12deg },
-            { { 29, 15, -7 }, 32, Pitch::down12deg },
-            { { 30, 15, -7 }, 32, Pitch::down12deg },
-            { { 31, 15, -7 }, 32, Pitch::down12deg },
-            { { 32, 16, -8 }, 32, Pitch::down12deg },
-            { { 33, 16, -8 }, 32, Pitch::down12deg },
-            { { 34, 16, -8 }, 32, Pitch::down12deg },
-            { { 35, 16, -8 }, 32, Pitch::down12deg },
-            { { 36, 17, -9 }, 32, Pitch::down12deg },
-            { { 37, 17, -9 }, 32, Pitch::down12deg },
-            { { 38, 17, -9 }, 32, Pitch::down12deg },
-            { { 39, 17, -9 }, 32, Pitch::down12deg },
-            { { 40, 18, -10 }, 32, Pitch::down12deg },
-            { { 41, 18, -10 }, 32, Pitch::down12deg },
-            { { 42, 18, -10 }, 32, Pitch::down12deg },
-            { { 43, 18, -10 }, 32, Pitch::down12deg },
-            { { 44, 19, -11 }, 32, Pitch::down12deg },
-            { { 45, 19, -11 }, 32, Pitch::down12deg },
-            { { 46, 19, -11 }, 32, Pitch::down12deg },
-            { { 47, 19, -11 }, 32, Pitch::down12deg },
-            { { 48, 20, -12 }, 32, Pitch::down12deg },
-            { { 49, 20, -12 }, 32, Pitch::down12deg },
-            { { 50, 20, -12 }, 32, Pitch::down12deg },
-            { { 51, 20, -12 }, 32, Pitch::down12deg },
-            { { 52, 21, -13 }, 32, Pitch::down12deg },
-            { { 53, 21, -13 }, 32, Pitch::down12deg },
-            { { 54, 21, -13 }, 32, Pitch::down12deg },
-            { { 55, 21, -13 }, 32, Pitch::down12deg },
-            { { 56, 22, -14 }, 32, Pitch::down12deg },
-            { { 57, 22, -14 }, 32, Pitch::down12deg },
-            { { 58, 22, -14 }, 32, Pitch::down12deg },
-            { { 59, 22, -14 }, 32, Pitch::down12deg },
-            { { 60, 23, -15 }, 32, Pitch::down12deg },
-            { { 61, 23, -15 }, 32, Pitch::down12deg },
-            { { 62, 23, -15 }, 32, Pitch::down12deg },
-            { { 63, 23, -15 }, 32, Pitch::down12deg },
-        });
-
-    // 0x4f1f7c
-    // Turnaround 1. Lane 1. Track 5. Reversed 1. Direction 1
-    static constexpr auto moveInfoTA1L1T5R1D1 = std::to_array<MoveInfo>(
-        {
-            { { 8, 31, 0 }, 48, Pitch::down12deg },
-            { { 8, 30, 0 }, 48, Pitch::down12deg },
-            { { 8, 29, 0 }, 48, Pitch::down12deg },
-            { { 8, 28, 0 }, 48, Pitch::down12deg },
-            { { 9, 27, -1 }, 48, Pitch::down12deg },
-            { { 9, 26, -1 }, 48, Pitch::down12deg },
-            { { 9, 25, -1 }, 48, Pitch::down12deg },
-            { { 9, 24, -1 }, 48, Pitch::down12deg },
-            { { 10, 23, -2 }, 48, Pitch::down12deg },
-            { { 10, 22, -2 }, 48, Pitch::down12deg },
-            { { 10, 21, -2 }, 48, Pitch::down12deg },
-            { { 10, 20, -2 }, 48, Pitch::down12deg },
-            { { 11, 19, -3 }, 48, Pitch::down12deg },
-            { { 11, 18, -3 }, 48, Pitch::down12deg },
-            { { 11, 17, -3 }, 48, Pitch::down12deg },
-            { { 11, 16, -3 }, 48, Pitch::down12deg },
-            { { 12, 15, -4 }, 48, Pitch::down12deg },
-            { { 12, 14, -4 }, 48, Pitch::down12deg },
-            { { 12, 13, -4 }, 48, Pitch::down12deg },
-            { { 12, 12, -4 }, 48, Pitch::down12deg },
-            { { 13, 11, -5 }, 48, Pitch::down12deg },
-            { { 13, 10, -5 }, 48, Pitch::down12deg },
-            { { 13, 9, -5 }, 48, Pitch::down12deg },
-            { { 13, 8, -5 }, 48, Pitch::down12deg },
-            { { 14, 7, -6 }, 48, Pitch::down12deg },
-            { { 14, 6, -6 }, 48, Pitch::down12deg },
-            { { 14, 5, -6 }, 48, Pitch::down12deg },
-            { { 14, 4, -6 }, 48, Pitch::down12deg },
-            { { 15, 3, -7 }, 48, Pitch::down12deg },
-            { { 15, 2, -7 }, 48, Pitch::down12deg },
-            { { 15, 1, -7 }, 48, Pitch::down12deg },
-            { { 15, 0, -7 }, 48, Pitch::down12deg },
-            { { 16, -1, -8 }, 48, Pitch::down12deg },
-            { { 16, -2, -8 }, 48, Pitch::down12deg },
-            { { 16, -3, -8 }, 48, Pitch::down12deg },
-            { { 16, -4, -8 }, 48, Pitch::down12deg },
-            { { 17, -5, -9 }, 48, Pitch::down12deg },
-            { { 17, -6, -9 }, 48, Pitch::down12deg },
-            { { 17, -7, -9 }, 48, Pitch::down12deg },
-            { { 17, -8, -9 }, 48, Pitch::down12deg },
-            { { 18, -9, -10 }, 48, Pitch::down12deg },
-            { { 18, -10, -10 }, 48, Pitch::down12deg },
-            { { 18, -11, -10 }, 48, Pitch::down12deg },
-            { { 18, -12, -10 }, 48, Pitch::down12deg },
-            { { 19, -13, -11 }, 48, Pitch::down12deg },
-            { { 19, -14, -11 }, 48, Pitch::down12deg },
-            { { 19, -15, -11 }, 48, Pitch::down12deg },
-            { { 19, -16, -11 }, 48, Pitch::down12deg },
-            { { 20, -17, -12 }, 48, Pitch::down12deg },
-            { { 20, -18, -12 }, 48, Pitch::down12deg },
-            { { 20, -19, -12 }, 48, Pitch::down12deg },
-            { { 20, -20, -12 }, 48, Pitch::down12deg },
-            { { 21, -21, -13 }, 48, Pitch::down12deg },
-            { { 21, -22, -13 }, 48, Pitch::down12deg },
-            { { 21, -23, -13 }, 48, Pitch::down12deg },
-            { { 21, -24, -13 }, 48, Pitch::down12deg },
-            { { 22, -25, -14 }, 48, Pitch::down12deg },
-            { { 22, -26, -14 }, 48, Pitch::down12deg },
-            { { 22, -27, -14 }, 48, Pitch::down12deg },
-            { { 22, -28, -14 }, 48, Pitch::down12deg },
-            { { 23, -29, -15 }, 48, Pitch::down12deg },
-            { { 23, -30, -15 }, 48, Pitch::down12deg },
-            { { 23, -31, -15 }, 48, Pitch::down12deg },
-            { { 23, -32, -15 }, 48, Pitch::down12deg },
-        });
-
-    // 0x4f1976
-    // Turnaround 1. Lane 1. Track 5. Reversed 1. Direction 2
-    static constexpr auto moveInfoTA1L1T5R1D2 = std::to_array<MoveInfo>(
-        {
-            { { 31, 24, 0 }, 0, Pitch::down12deg },
-            { { 30, 24, 0 }, 0, Pitch::down12deg },
-            { { 29, 24, 0 }, 0, Pitch::down12deg },
-            { { 28, 24, 0 }, 0, Pitch::down12deg },
-            { { 27, 23, -1 }, 0, Pitch::down12deg },
-            { { 26, 23, -1 }, 0, Pitch::down12deg },
-            { { 25, 23, -1 }, 0, Pitch::down12deg },
-            { { 24, 23, -1 }, 0, Pitch::down12deg },
-            { { 23, 22, -2 }, 0, Pitch::down12deg },
-            { { 22, 22, -2 }, 0, Pitch::down12deg },
-            { { 21, 22, -2 }, 0, Pitch::down12deg },
-            { { 20, 22, -2 }, 0, Pitch::down12deg },
-            { { 19, 21, -3 }, 0, Pitch::down12deg },
-            { { 18, 21, -3 }, 0, Pitch::down12deg },
-            { { 17, 21, -3 }, 0, Pitch::down12deg },
-            { { 16, 21, -3 }, 0, Pitch::down12deg },
-            { { 15, 20, -4 }, 0, Pitch::down12deg },
-            { { 14, 20, -4 }, 0, Pitch::down12deg },
-            { { 13, 20, -4 }, 0, Pitch::down12deg },
-            { { 12, 20, -4 }, 0, Pitch::down12deg },
-            { { 11, 19, -5 }, 0, Pitch::down12deg },
-            { { 10, 19, -5 }, 0, Pitch::down12deg },
-            { { 9, 19, -5 }, 0, Pitch::down12deg },
-            { { 8, 19, -5 }, 0, Pitch::down12deg },
-            { { 7, 18, -6 }, 0, Pitch::down12deg },
-            { { 6, 18, -6 }, 0, Pitch::down12deg },
-            { { 5, 18, -6 }, 0, Pitch::down12deg },
-            { { 4, 18, -6 }, 0, Pitch::down12deg },
-            { { 3, 17, -7 }, 0, Pitch::down12deg },
-            { { 2, 17, -7 }, 0, Pitch::down12deg },
-            { { 1, 17, -7 }, 0, Pitch::down12deg },
-            { { 0, 17, -7 }, 0, Pitch::down12deg },
-            { { -1, 16, -8 }, 0, Pitch::down12deg },
-            { { -2, 16, -8 }, 0, Pitch::down12deg },
-            { { -3, 16, -8 }, 0, Pitch::down12deg },
-            { { -4, 16, -8 }, 0, Pitch::down12deg },
-            { { -5, 15, -9 }, 0, Pitch::down12deg },
-            { { -6, 15, -9 }, 0, Pitch::down12deg },
-            { { -7, 15, -9 }, 0, Pitch::down12deg },
-            { { -8, 15, -9 }, 0, Pitch::down12deg },
-            { { -9, 14, -10 }, 0, Pitch::down12deg },
-            { { -10, 14, -10 }, 0, Pitch::down12deg },
-            { { -11, 14, -10 }, 0, Pitch::down12deg },
-            { { -12, 14, -10 }, 0, Pitch::down12deg },
-            { { -13, 13, -11 }, 0, Pitch::down12deg },
-            { { -14, 13, -11 }, 0, Pitch::down12deg },
-            { { -15, 13, -11 }, 0, Pitch::down12deg },
-            { { -16, 13, -11 }, 0, Pitch::down12deg },
-            { { -17, 12, -12 }, 0, Pitch::down12deg },
-            { { -18, 12, -12 }, 0, Pitch::down12deg },
-            { { -19, 12, -12 }, 0, Pitch::down12deg },
-            { { -20, 12, -12 }, 0, Pitch::down12deg },
-            { { -21, 11, -13 }, 0, Pitch::down12deg },
-            { { -22, 11, -13 }, 0, Pitch::down12deg },
-            { { -23, 11, -13 }, 0, Pitch::down12deg },
-            { { -24, 11, -13 }, 0, Pitch::down12deg },
-            { { -25, 10, -14 }, 0, Pitch::down12deg },
-            { { -26, 10, -14 }, 0, Pitch::down12deg },
-            { { -27, 10, -14 }, 0, Pitch::down12deg },
-            { { -28, 10, -14 }, 0, Pitch::down12deg },
-            { { -29, 9, -15 }, 0, Pitch::down12deg },
-            { { -30, 9, -15 }, 0, Pitch::down12deg },
-            { { -31, 9, -15 }, 0, Pitch::down12deg },
-            { { -32, 9, -15 }, 0, Pitch::down12deg },
-        });
-
-    // 0x4f1b78
-    // Turnaround 1. Lane 1. Track 5. Reversed 1. Direction 3
-    static constexpr auto moveInfoTA1L1T5R1D3 = std::to_array<MoveInfo>(
-        {
-            { { 24, 0, 0 }, 16, Pitch::down12deg },
-            { { 24, 1, 0 }, 16, Pitch::down12deg },
-            { { 24, 2, 0 }, 16, Pitch::down12deg },
-            { { 24, 3, 0 }, 16, Pitch::down12deg },
-            { { 23, 4, -1 }, 16, Pitch::down12deg },
-            { { 23, 5, -1 }, 16, Pitch::down12deg },
-            { { 23, 6, -1 }, 16, Pitch::down12deg },
-            { { 23, 7, -1 }, 16, Pitch::down12deg },
-            { { 22, 8, -2 }, 16, Pitch::down12deg },
-            { { 22, 9, -2 }, 16, Pitch::down12deg },
-            { { 22, 10, -2 }, 16, Pitch::down12deg },
-            { { 22, 11, -2 }, 16, Pitch::down12deg },
-            { { 21, 12, -3 }, 16, Pitch::down12deg },
-            { { 21, 13, -3 }, 16, Pitch::down12deg },
-            { { 21, 14, -3 }, 16, Pitch::down12deg },
-            { { 21, 15, -3 }, 16, Pitch::down12deg },
-            { { 20, 16, -4 }, 16, Pitch::down12deg },
-            { { 20, 17, -4 }, 16, Pitch::down12deg },
-            { { 20, 18, -4 }, 16, Pitch::down12deg },
-            { { 20, 19, -4 }, 16, Pitch::down12deg },
-            { { 19, 20, -5 }, 16, Pitch::down12deg },
-            { { 19, 21, -5 }, 16, Pitch::down12deg },
-            { { 19, 22, -5 }, 16, Pitch::down12deg },
-            { { 19, 23, -5 }, 16, Pitch::down12deg },
-            { { 18, 24, -6 }, 16, Pitch::down12deg },
-            { { 18, 25, -6 }, 16, Pitch::down12deg },
-            { { 18, 26, -6 }, 16, Pitch::down12deg },
-            { { 18, 27, -6 }, 16, Pitch::down12deg },
-            { { 17, 28, -7 }, 16, Pitch::down12deg },
-            { { 17, 29, -7 }, 16, Pitch::down12deg },
-            { { 17, 30, -7 }, 16, Pitch::down12deg },
-            { { 17, 31, -7 }, 16, Pitch::down12deg },
-            { { 16, 32, -8 }, 16, Pitch::down12deg },
-            { { 16, 33, -8 }, 16, Pitch::down12deg },
-            { { 16, 34, -8 }, 16, Pitch::down12deg },
-            { { 16, 35, -8 }, 16, Pitch::down12deg },
-            { { 15, 36, -9 }, 16, Pitch::down12deg },
-            { { 15, 37, -9 }, 16, Pitch::down12deg },
-            { { 15, 38, -9 }, 16, Pitch::down12deg },
-            { { 15, 39, -9 }, 16, Pitch::down12deg },
-            { { 14, 40, -10 }, 16, Pitch::down12deg },
-            { { 14, 41, -10 }, 16, Pitch::down12deg },
-            { { 14, 42, -10 }, 16, Pitch::down12deg },
-            { { 14, 43, -10 }, 16, Pitch::down12deg },
-            { { 13, 44, -11 }, 16, Pitch::down12deg },
-            { { 13, 45, -11 }, 16, Pitch::down12deg },
-            { { 13, 46, -11 }, 16, Pitch::down12deg },
-            { { 13, 47, -11 }, 16, Pitch::down12deg },
-            { { 12, 48, -12 }, 16, Pitch::down12deg },
-            { { 12, 49, -12 }, 16, Pitch::down12deg },
-            { { 12, 50, -12 }, 16, Pitch::down12deg },
-            { { 12, 51, -12 }, 16, Pitch::down12deg },
-            { { 11, 52, -13 }, 16, Pitch::down12deg },
-            { { 11, 53, -13 }, 16, Pitch::down12deg },
-            { { 11, 54, -13 }, 16, Pitch::down12deg },
-            { { 11, 55, -13 }, 16, Pitch::down12deg },
-            { { 10, 56, -14 }, 16, Pitch::down12deg },
-            { { 10, 57, -14 }, 16, Pitch::down12deg },
-            { { 10, 58, -14 }, 16, Pitch::down12deg },
-            { { 10, 59, -14 }, 16, Pitch::down12deg },
-            { { 9, 60, -15 }, 16, Pitch::down12deg },
-            { { 9, 61, -15 }, 16, Pitch::down12deg },
-            { { 9, 62, -15 }, 16, Pitch::down12deg },
-            { { 9, 63, -15 }, 16, Pitch::down12deg },
-        });
-
-    // 0x4f319e
-    // Turnaround 1. Lane 1. Track 7. Reversed 0. Direction 0
-    static constexpr auto moveInfoTA1L1T7R0D0 = std::to_array<MoveInfo>(
-        {
-            { { 31, 24, 0 }, 0, Pitch::up25deg },
-            { { 30, 24, 0 }, 0, Pitch::up25deg },
-            { { 29, 23, 1 }, 0, Pitch::up25deg },
-            { { 28, 23, 1 }, 0, Pitch::up25deg },
-            { { 27, 22, 2 }, 0, Pitch::up25deg },
-            { { 26, 22, 2 }, 0, Pitch::up25deg },
-            { { 25, 21, 3 }, 0, Pitch::up25deg },
-            { { 24, 21, 3 }, 0, Pitch::up25deg },
-            { { 23, 20, 4 }, 0, Pitch::up25deg },
-            { { 22, 20, 4 }, 0, Pitch::up25deg },
-            { { 21, 19, 5 }, 0, Pitch::up25deg },
-            { { 20, 19, 5 }, 0, Pitch::up25deg },
-            { { 19, 18, 6 }, 0, Pitch::up25deg },
-            { { 18, 18, 6 }, 0, Pitch::up25deg },
-            { { 17, 17, 7 }, 0, Pitch::up25deg },
-            { { 16, 17, 7 }, 0, Pitch::up25deg },
-            { { 15, 16, 8 }, 0, Pitch::up25deg },
-            { { 14, 16, 8 }, 0, Pitch::up25deg },
-            { { 13, 15, 9 }, 0, Pitch::up25deg },
-            { { 12, 15, 9 }, 0, Pitch::up25deg },
-            { { 11, 14, 10 }, 0, Pitch::up25deg },
-            { { 10, 14, 10 }, 0, Pitch::up25deg },
-            { { 9, 13, 11 }, 0, Pitch::up25deg },
-            { { 8, 13, 11 }, 0, Pitch::up25deg },
-            { { 7, 12, 12 }, 0, Pitch::up25deg },
-            { { 6, 12, 12 }, 0, Pitch::up25deg },
-            { { 5, 11, 13 }, 0, Pitch::up25deg },
-            { { 4, 11, 13 }, 0, Pitch::up25deg },
-            { { 3, 10, 14 }, 0, Pitch::up25deg },
-            { { 2, 10, 14 }, 0, Pitch::up25deg },
-            { { 1, 9, 15 }, 0, Pitch::up25deg },
-            { { 0, 9, 15 }, 0, Pitch::up25deg },
-        });
-
-    // 0x4f32a0
-    // Turnaround 1. Lane 1. Track 7. Reversed 0. Direction 1
-    static constexpr auto moveInfoTA1L1T7R0D1 = std::to_array<MoveInfo>(
-        {
-            { { 24, 0, 0 }, 16, Pitch::up25deg },
-            { { 24, 1, 0 }, 16, Pitch::up25deg },
-            { { 23, 2, 1 }, 16, Pitch::up25deg },
-            { { 23, 3, 1 }, 16, Pitch::up25deg },
-            { { 22, 4, 2 }, 16, Pitch::up25deg },
-            { { 22, 5, 2 }, 16, Pitch::up25deg },
-            { { 21, 6, 3 }, 16, Pitch::up25deg },
-            { { 21, 7, 3 }, 16, Pitch::up25deg },
-            { { 20, 8, 4 }, 16, Pitch::up25deg },
-            { { 20, 9, 4 }, 16, Pitch::up25deg },
-            { { 19, 10, 5 }, 16, Pitch::up25deg },
-            { { 19, 11, 5 }, 16, Pitch::up25deg },
-            { { 18, 12, 6 }, 16, Pitch::up25deg },
-            { { 18, 13, 6 }, 16, Pitch::up25deg },
-            { { 17, 14, 7 }, 16, Pitch::up25deg },
-            { { 17, 15, 7 }, 16, Pitch::up25deg },
-            { { 16, 16, 8 }, 16, Pitch::up25deg },
-            { { 16, 17, 8 }, 16, Pitch::up25deg },
-            { { 15, 18, 9 }, 16, Pitch::up25deg },
-            { { 15, 19, 9 }, 16, Pitch::up25deg },
-            { { 14, 20, 10 }, 16, Pitch::up25deg },
-            { { 14, 21, 10 }, 16, Pitch::up25deg },
-            { { 13, 22, 11 }, 16, Pitch::up25deg },
-            { { 13, 23, 11 }, 16, Pitch::up25deg },
-            { { 12, 24, 12 }, 16, Pitch::up25deg },
-            { { 12, 25, 12 }, 16, Pitch::up25deg },
-            { { 11, 26, 13 }, 16, Pitch::up25deg },
-            { { 11, 27, 13 }, 16, Pitch::up25deg },
-            { { 10, 28, 14 }, 16, Pitch::up25deg },
-            { { 10, 29, 14 }, 16, Pitch::up25deg },
-            { { 9, 30, 15 }, 16, Pitch::up25deg },
-            { { 9, 31, 15 }, 16, Pitch::up25deg },
-        });
-
-    // 0x4f33a2
-    // Turnaround 1. Lane 1. Track 7. Reversed 0. Direction 2
-    static constexpr auto moveInfoTA1L1T7R0D2 = std::to_array<MoveInfo>(
-        {
-            { { 0, 8, 0 }, 32, Pitch::up25deg },
-            { { 1, 8, 0 }, 32, Pitch::up25deg },
-            { { 2, 9, 1 }, 32, Pitch::up25deg },
-            { { 3, 9, 1 }, 32, Pitch::up25deg },
-            { { 4, 10, 2 }, 32, Pitch::up25deg },
-            { { 5, 10, 2 }, 32, Pitch::up25deg },
-            { { 6, 11, 3 }, 32, Pitch::up25deg },
-            { { 7, 11, 3 }, 32, Pitch::up25deg },
-            { { 8, 12, 4 }, 32, Pitch::up25deg },
-            { { 9, 12, 4 }, 32, Pitch::up25deg },
-            { { 10, 13, 5 }, 32, Pitch::up25deg },
-            { { 11, 13, 5 }, 32, Pitch::up25deg },
-            { { 12, 14, 6 }, 32, Pitch::up25deg },
-            { { 13, 14, 6 }, 32, Pitch::up25deg },
-            { { 14, 15, 7 }, 32, Pitch::up25deg },
-            { { 15, 15, 7 }, 32, Pitch::up25deg },
-            { { 16, 16, 8 }, 32, Pitch::up25deg },
-            { { 17, 16, 8 }, 32, Pitch::up25deg },
-            { { 18, 17, 9 }, 32, Pitch::up25deg },
-            { { 19, 17, 9 }, 32, Pitch::up25deg },
-            { { 20, 18, 10 }, 32, Pitch::up25deg },
-            { { 21, 18, 10 }, 32, Pitch::up25deg },
-            { { 22, 19, 11 }, 32, Pitch::up25deg },
-            { { 23, 19, 11 }, 32, Pitch::up25deg },
-            { { 24, 20, 12 }, 32, Pitch::up25deg },
-            { { 25, 20, 12 }, 32, Pitch::up25deg },
-            { { 26, 21, 13 }, 32, Pitch::up25deg },
-            { { 27, 21, 13 }, 32, Pitch::up25deg },
-            { { 28, 22, 14 }, 32, Pitch::up25deg },
-            { { 29, 22, 14 }, 32, Pitch::up25deg },
-            { { 30, 23, 15 }, 32, Pitch::up25deg },
-            { { 31, 23, 15 }, 32, Pitch::up25deg },
-        });
-
-    // 0x4f34a4
-    // Turnaround 1. Lane 1. Track 7. Reversed 0. Direction 3
-    static constexpr auto moveInfoTA1L1T7R0D3 = std::to_array<MoveInfo>(
-        {
-            { { 8, 31, 0 }, 48, Pitch::up25deg },
-            { { 8, 30, 0 }, 48, Pitch::up25deg },
-            { { 9, 29, 1 }, 48, Pitch::up25deg },
-            { { 9, 28, 1 }, 48, Pitch::up25deg },
-            { { 10, 27, 2 }, 48, Pitch::up25deg },
-            { { 10, 26, 2 }, 48, Pitch::up25deg },
-            { { 11, 25, 3 }, 48, Pitch::up25deg },
-            { { 11, 24, 3 }, 48, Pitch::up25deg },
-            { { 12, 23, 4 }, 48, Pitch::up25deg },
-            { { 12, 22, 4 }, 48, Pitch::up25deg },
-            { { 13, 21, 5 }, 48, Pitch::up25deg },
-            { { 13, 20, 5 }, 48, Pitch::up25deg },
-            { { 14, 19, 6 }, 48, Pitch::up25deg },
-            { { 14, 18, 6 }, 48, Pitch::up25deg },
-            { { 15, 17, 7 }, 48, Pitch::up25deg },
-            { { 15, 16, 7 }, 48, Pitch::up25deg },
-            { { 16, 15, 8 }, 48, Pitch::up25deg },
-            { { 16, 14, 8 }, 48, Pitch::up25deg },
-            { { 17, 13, 9 }, 48, Pitch::up25deg },
-            { { 17, 12, 9 }, 48, Pitch::up25deg },
-            { { 18, 11, 10 }, 48, Pitch::up25deg },
-            { { 18, 10, 10 }, 48, Pitch::up25deg },
-            { { 19, 9, 11 }, 48, Pitch::up25deg },
-            { { 19, 8, 11 }, 48, Pitch::up25deg },
-            { { 20, 7, 12 }, 48, Pitch::up25deg },
-            { { 20, 6, 12 }, 48, Pitch::up25deg },
-            { { 21, 5, 13 }, 48, Pitch::up25deg },
-            { { 21, 4, 13 }, 48, Pitch::up25deg },
-            { { 22, 3, 14 }, 48, Pitch::up25deg },
-            { { 22, 2, 14 }, 48, Pitch::up25deg },
-            { { 23, 1, 15 }, 48, Pitch::up25deg },
-            { { 23, 0, 15 }, 48, Pitch::up25deg },
-        });
-
-    // 0x4f37aa
-    // Turnaround 1. Lane 1. Track 7. Reversed 1. Direction 0
-    static constexpr auto moveInfoTA1L1T7R1D0 = std::to_array<MoveInfo>(
-        {
-            { { 0, 8, 0 }, 32, Pitch::down25deg },
-            { { 1, 8, 0 }, 32, Pitch::down25deg },
-            { { 2, 9, -1 }, 32, Pitch::down25deg },
-            { { 3, 9, -1 }, 32, Pitch::down25deg },
-            { { 4, 10, -2 }, 32, Pitch::down25deg },
-            { { 5, 10, -2 }, 32, Pitch::down25deg },
-            { { 6, 11, -3 }, 32, Pitch::down25deg },
-            { { 7, 11, -3 }, 32, Pitch::down25deg },
-            { { 8, 12, -4 }, 32, Pitch::down25deg },
-            { { 9, 12, -4 }, 32, Pitch::down25deg },
-            { { 10, 13, -5 }, 32, Pitch::down25deg },
-            { { 11, 13, -5 }, 32, Pitch::down25deg },
-            { { 12, 14, -6 }, 32, Pitch::down25deg },
-            { { 13, 14, -6 }, 32, Pitch::down25deg },
-            { { 14, 15, -7 }, 32, Pitch::down25deg },
-            { { 15, 15, -7 }, 32, Pitch::down25deg },
-            { { 16, 16, -8 }, 32, Pitch::down25deg },
-            { { 17, 16, -8 }, 32, Pitch::down25deg },
-            { { 18, 17, -9 }, 32, Pitch::down25deg },
-            { { 19, 17, -9 }, 32, Pitch::down25deg },
-            { { 20, 18, -10 }, 32, Pitch::down25deg },
-            { { 21, 18, -10 }, 32, Pitch::down25deg },
-            { { 22, 19, -11 }, 32, Pitch::down25deg },
-            { { 23, 19, -11 }, 32, Pitch::down25deg },
-            { { 24, 20, -12 }, 32, Pitch::down25deg },
-            { { 25, 20, -12 }, 32, Pitch::down25deg },
-            { { 26, 21, -13 }, 32, Pitch::down25deg },
-            { { 27, 21, -13 }, 32, Pitch::down25deg },
-            { { 28, 22, -14 }, 32, Pitch::down25deg },
-            { { 29, 22, -14 }, 32, Pitch::down25deg },
-            { { 30, 23, -15 }, 32, Pitch::down25deg },
-            { { 31, 23, -15 }, 32, Pitch::down25deg },
-        });
-
-    // 0x4f38ac
-    // Turnaround 1. Lane 1. Track 7. Reversed 1. Direction 1
-    static constexpr auto moveInfoTA1L1T7R1D1 = std::to_array<MoveInfo>(
-        {
-            { { 8, 31, 0 }, 48, Pitch::down25deg },
-            { { 8, 30, 0 }, 48, Pitch::down25deg },
-            { { 9, 29, -1 }, 48, Pitch::down25deg },
-            { { 9, 28, -1 }, 48, Pitch::down25deg },
-            { { 10, 27, -2 }, 48, Pitch::down25deg },
-            { { 10, 26, -2 }, 48, Pitch::down25deg },
-            { { 11, 25, -3 }, 48, Pitch::down25deg },
-            { { 11, 24, -3 }, 48, Pitch::down25deg },
-            { { 12, 23, -4 }, 48, Pitch::down25deg },
-            { { 12, 22, -4 }, 48, Pitch::down25deg },
-            { { 13, 21, -5 }, 48, Pitch::down25deg },
-            { { 13, 20, -5 }, 48, Pitch::down25deg },
-            { { 14, 19, -6 }, 48, Pitch::down25deg },
-            { { 14, 18, -6 }, 48, Pitch::down25deg },
-            { { 15, 17, -7 }, 48, Pitch::down25deg },
-            { { 15, 16, -7 }, 48, Pitch::down25deg },
-            { { 16, 15, -8 }, 48, Pitch::down25deg },
-            { { 16, 14, -8 }, 48, Pitch::down25deg },
-            { { 17, 13, -9 }, 48, Pitch::down25deg },
-            { { 17, 12, -9 }, 48, Pitch::down25deg },
-            { { 18, 11, -10 }, 48, Pitch::down25deg },
-            { { 18, 10, -10 }, 48, Pitch::down25deg },
-            { { 19, 9, -11 }, 48, Pitch::down25deg },
-            { { 19, 8, -11 }, 48, Pitch::down25deg },
-            { { 20, 7, -12 }, 48, Pitch::down25deg },
-            { { 20, 6, -12 }, 48, Pitch::down25deg },
-            { { 21, 5, -13 }, 48, Pitch::down25deg },
-            { { 21, 4, -13 }, 48, Pitch::down25deg },
-            { { 22, 3, -14 }, 48, Pitch::down25deg },
-            { { 22, 2, -14 }, 48, Pitch::down25deg },
-            { { 23, 1, -15 }, 48, Pitch::down25deg },
-            { { 23, 0, -15 }, 48, Pitch::down25deg },
-        });
-
-    // 0x4f35a6
-    // Turnaround 1. Lane 1. Track 7. Reversed 1. Direction 2
-    static constexpr auto moveInfoTA1L1T7R1D2 = std::to_array<MoveInfo>(
-        {
-            { { 31, 24, 0 }, 0, Pitch::down25deg },
-            { { 30, 24, 0 }, 0, Pitch::down25deg },
-            { { 29, 23, -1 }, 0, Pitch::down25deg },
-            { { 28, 23, -1 }, 0, Pitch::down25deg },
-            { { 27, 22, -2 }, 0, Pitch::down25deg },
-            { { 26, 22, -2 }, 0, Pitch::down25deg },
-            { { 25, 21, -3 }, 0, Pitch::down25deg },
-            { { 24, 21, -3 }, 0, Pitch::down25deg },
-            { { 23, 20, -4 }, 0, Pitch::down25deg },
-            { { 22, 20, -4 }, 0, Pitch::down25deg },
-            { { 21, 19, -5 }, 0, Pitch::down25deg },
-            { { 20, 19, -5 }, 0, Pitch::down25deg },
-            { { 19, 18, -6 }, 0, Pitch::down25deg },
-            { { 18, 18, -6 }, 0, Pitch::down25deg },
-            { { 17, 17, -7 }, 0, Pitch::down25deg },
-            { { 16, 17, -7 }, 0, Pitch::down25deg },
-            { { 15, 16, -8 }, 0, Pitch::down25deg },
-            { { 14, 16, -8 }, 0, Pitch::down25deg },
-            { { 13, 15, -9 }, 0, Pitch::down25deg },
-            { { 12, 15, -9 }, 0, Pitch::down25deg },
-            { { 11, 14, -10 }, 0, Pitch::down25deg },
-            { { 10, 14, -10 }, 0, Pitch::down25deg },
-            { { 9, 13, -11 }, 0, Pitch::down25deg },
-            { { 8, 13, -11 }, 0, Pitch::down25deg },
-            { { 7, 12, -12 }, 0, Pitch::down25deg },
-            { { 6, 12, -12 }, 0, Pitch::down25deg },
-            { { 5, 11, -13 }, 0, Pitch::down25deg },
-            { { 4, 11, -13 }, 0, Pitch::down25deg },
-            { { 3, 10, -14 }, 0, Pitch::down25deg },
-            { { 2, 10, -14 }, 0, Pitch::down25deg },
-            { { 1, 9, -15 }, 0, Pitch::down25deg },
-            { { 0, 9, -15 }, 0, Pitch::down25deg },
-        });
-
-    // 0x4f36a8
-    // Turnaround 1. Lane 1. Track 7. Reversed 1. Direction 3
-    static constexpr auto moveInfoTA1L1T7R1D3 = std::to_array<MoveInfo>(
-        {
-            { { 24, 0, 0 }, 16, Pitch::down25deg },
-            { { 24, 1, 0 }, 16, Pitch::down25deg },
-            { { 23, 2, -1 }, 16, Pitch::down25deg },
-            { { 23, 3, -1 }, 16, Pitch::down25deg },
-            { { 22, 4, -2 }, 16, Pitch::down25deg },
-            { { 22, 5, -2 }, 16, Pitch::down25deg },
-            { { 21, 6, -3 }, 16, Pitch::down25deg },
-            { { 21, 7, -3 }, 16, Pitch::down25deg },
-            { { 20, 8, -4 }, 16, Pitch::down25deg },
-            { { 20, 9, -4 }, 16, Pitch::down25deg },
-            { { 19, 10, -5 }, 16, Pitch::down25deg },
-            { { 19, 11, -5 }, 16, Pitch::down25deg },
-            { { 18, 12, -6 }, 16, Pitch::down25deg },
-            { { 18, 13, -6 }, 16, Pitch::down25deg },
-            { { 17, 14, -7 }, 16, Pitch::down25deg },
-            { { 17, 15, -7 }, 16, Pitch::down25deg },
-            { { 16, 16, -8 }, 16, Pitch::down25deg },
-            { { 16, 17, -8 }, 16, Pitch::down25deg },
-            { { 15, 18, -9 }, 16, Pitch::down25deg },
-            { { 15, 19, -9 }, 16, Pitch::down25deg },
-            { { 14, 20, -10 }, 16, Pitch::down25deg },
-            { { 14, 21, -10 }, 16, Pitch::down25deg },
-            { { 13, 22, -11 }, 16, Pitch::down25deg },
-            { { 13, 23, -11 }, 16, Pitch::down25deg },
-            { { 12, 24, -12 }, 16, Pitch::down25deg },
-            { { 12, 25, -12 }, 16, Pitch::down25deg },
-            { { 11, 26, -13 }, 16, Pitch::down25deg },
-            { { 11, 27, -13 }, 16, Pitch::down25deg },
-            { { 10, 28, -14 }, 16, Pitch::down25deg },
-            { { 10, 29, -14 }, 16, Pitch::down25deg },
-            { { 9, 30, -15 }, 16, Pitch::down25deg },
-            { { 9, 31, -15 }, 16, Pitch::down25deg },
-        });
-
-#pragma endregion
-
     // 0x004D9724 44 track ids * 8 directions
-    static constexpr auto _4D9724 = std::to_array<std::span<const MoveInfo>>({
+    static constexpr auto _4D9724 = std::to_array<std::span<const PackedMoveInfo>>({
         moveInfoT0R0D0,
         moveInfoT0R0D1,
         moveInfoT0R0D2,
@@ -18166,9 +364,9 @@ namespace OpenLoco::World::TrackData
     });
 
     // 0x004D9DE4
-    static constexpr std::array<std::array<std::array<std::span<const MoveInfo>, 10 * 8>, 2>, 2> _4D9DE4 = {
-        std::array<std::array<std::span<const MoveInfo>, 10 * 8>, 2>{
-            std::array<std::span<const MoveInfo>, 10 * 8>{
+    static constexpr std::array<std::array<std::array<std::span<const PackedMoveInfo>, 10 * 8>, 2>, 2> _4D9DE4 = {
+        std::array<std::array<std::span<const PackedMoveInfo>, 10 * 8>, 2>{
+            std::array<std::span<const PackedMoveInfo>, 10 * 8>{
                 moveInfoTA0L0T0R0D0,
                 moveInfoTA0L0T0R0D1,
                 moveInfoTA0L0T0R0D2,
@@ -18333,8 +531,8 @@ namespace OpenLoco::World::TrackData
                 moveInfoTA0L1T9R0D3,
             },
         },
-        std::array<std::array<std::span<const MoveInfo>, 10 * 8>, 2>{
-            std::array<std::span<const MoveInfo>, 10 * 8>{
+        std::array<std::array<std::span<const PackedMoveInfo>, 10 * 8>, 2>{
+            std::array<std::span<const PackedMoveInfo>, 10 * 8>{
                 moveInfoTA1L0T0R0D0,
                 moveInfoTA1L0T0R0D1,
                 moveInfoTA1L0T0R0D2,
@@ -18502,9 +700,9 @@ namespace OpenLoco::World::TrackData
     };
 
     // 0x004D9DE4
-    static constexpr std::array<std::array<std::array<std::span<const MoveInfo>, 10 * 8>, 2>, 2> _rightHand4D9DE4 = {
-        std::array<std::array<std::span<const MoveInfo>, 10 * 8>, 2>{
-            std::array<std::span<const MoveInfo>, 10 * 8>{
+    static constexpr std::array<std::array<std::array<std::span<const PackedMoveInfo>, 10 * 8>, 2>, 2> _rightHand4D9DE4 = {
+        std::array<std::array<std::span<const PackedMoveInfo>, 10 * 8>, 2>{
+            std::array<std::span<const PackedMoveInfo>, 10 * 8>{
                 moveInfoTA0L1T0R0D0,
                 moveInfoTA0L1T0R0D1,
                 moveInfoTA0L1T0R0D2,
@@ -18670,8 +868,8 @@ namespace OpenLoco::World::TrackData
             },
 
         },
-        std::array<std::array<std::span<const MoveInfo>, 10 * 8>, 2>{
-            std::array<std::span<const MoveInfo>, 10 * 8>{
+        std::array<std::array<std::span<const PackedMoveInfo>, 10 * 8>, 2>{
+            std::array<std::span<const PackedMoveInfo>, 10 * 8>{
                 moveInfoTA1L1T0R0D0,
                 moveInfoTA1L1T0R0D1,
                 moveInfoTA1L1T0R0D2,
@@ -18839,7 +1037,7 @@ namespace OpenLoco::World::TrackData
     };
 
     // 0x4D9CA4 - 10 roadId's * 8 directions
-    static constexpr auto kRoadPlacementSubPositions = std::to_array<std::span<const MoveInfo>>({
+    static constexpr auto kRoadPlacementSubPositions = std::to_array<std::span<const PackedMoveInfo>>({
         moveInfoT0R0D0,
         moveInfoT0R0D1,
         moveInfoT0R0D2,
@@ -18922,22 +1120,22 @@ namespace OpenLoco::World::TrackData
         moveInfoT42R1D3,
     });
 
-    std::span<const MoveInfo> getRoadSubPositon(const uint16_t trackAndDirection)
+    MoveInfoSpan getRoadSubPositon(const uint16_t trackAndDirection)
     {
         // TODO: rework after 0x0047D9F2 is implemented and hooked
         // 0x005253B0
         const auto& data = getGameState().trafficHandedness ? _rightHand4D9DE4 : _4D9DE4;
-        return data[trackAndDirection & (1 << 8) ? 1 : 0][trackAndDirection & (1 << 7) ? 1 : 0][trackAndDirection & 0x7F];
+        return MoveInfoSpan(data[trackAndDirection & (1 << 8) ? 1 : 0][trackAndDirection & (1 << 7) ? 1 : 0][trackAndDirection & 0x7F]);
     }
 
-    std::span<const MoveInfo> getTrackSubPositon(const uint16_t trackAndDirection)
+    MoveInfoSpan getTrackSubPositon(const uint16_t trackAndDirection)
     {
-        return _4D9724[trackAndDirection];
+        return MoveInfoSpan(_4D9724[trackAndDirection]);
     }
 
-    std::span<const MoveInfo> getRoadPlacementSubPositon(const uint16_t trackAndDirection)
+    MoveInfoSpan getRoadPlacementSubPositon(const uint16_t trackAndDirection)
     {
         // TODO: investigate if this mirrors one side of getRoadSubPositon
-        return kRoadPlacementSubPositions[trackAndDirection];
+        return MoveInfoSpan(kRoadPlacementSubPositions[trackAndDirection]);
     }
 }
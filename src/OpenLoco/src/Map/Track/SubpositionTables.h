@@ -0,0 +1,3533 @@
+#pragma once
+
+// Generated by scripts/subposition-data.py, do not edit. Unpack the tables to a readable listing with
+// the script, edit that and pack it again. Entries are PackedMoveInfo values, see SubpositionData.h.
+
+#include "Map/Track/SubpositionData.h"
+
+// clang-format off
+namespace OpenLoco::World::TrackData
+{
+    // 0x4da526
+    // Track 0. Reversed 0. Direction 0
+    static constexpr PackedMoveInfo moveInfoT0R0D0[] = {
+        0x0020505F, 0x0020505E, 0x0020505D, 0x0020505C, 0x0020505B, 0x0020505A, 0x00205059, 0x00205058,
+        0x00205057, 0x00205056, 0x00205055, 0x00205054, 0x00205053, 0x00205052, 0x00205051, 0x00205050,
+        0x0020504F, 0x0020504E, 0x0020504D, 0x0020504C, 0x0020504B, 0x0020504A, 0x00205049, 0x00205048,
+        0x00205047, 0x00205046, 0x00205045, 0x00205044, 0x00205043, 0x00205042, 0x00205041, 0x00205040,
+    };
+
+    // 0x4da628
+    // Track 0. Reversed 0. Direction 1
+    static constexpr PackedMoveInfo moveInfoT0R0D1[] = {
+        0x02204050, 0x02204150, 0x02204250, 0x02204350, 0x02204450, 0x02204550, 0x02204650, 0x02204750,
+        0x02204850, 0x02204950, 0x02204A50, 0x02204B50, 0x02204C50, 0x02204D50, 0x02204E50, 0x02204F50,
+        0x02205050, 0x02205150, 0x02205250, 0x02205350, 0x02205450, 0x02205550, 0x02205650, 0x02205750,
+        0x02205850, 0x02205950, 0x02205A50, 0x02205B50, 0x02205C50, 0x02205D50, 0x02205E50, 0x02205F50,
+    };
+
+    // 0x4da72a
+    // Track 0. Reversed 0. Direction 2
+    static constexpr PackedMoveInfo moveInfoT0R0D2[] = {
+        0x04205040, 0x04205041, 0x04205042, 0x04205043, 0x04205044, 0x04205045, 0x04205046, 0x04205047,
+        0x04205048, 0x04205049, 0x0420504A, 0x0420504B, 0x0420504C, 0x0420504D, 0x0420504E, 0x0420504F,
+        0x04205050, 0x04205051, 0x04205052, 0x04205053, 0x04205054, 0x04205055, 0x04205056, 0x04205057,
+        0x04205058, 0x04205059, 0x0420505A, 0x0420505B, 0x0420505C, 0x0420505D, 0x0420505E, 0x0420505F,
+    };
+
+    // 0x4da82c
+    // Track 0. Reversed 0. Direction 3
+    static constexpr PackedMoveInfo moveInfoT0R0D3[] = {
+        0x06205F50, 0x06205E50, 0x06205D50, 0x06205C50, 0x06205B50, 0x06205A50, 0x06205950, 0x06205850,
+        0x06205750, 0x06205650, 0x06205550, 0x06205450, 0x06205350, 0x06205250, 0x06205150, 0x06205050,
+        0x06204F50, 0x06204E50, 0x06204D50, 0x06204C50, 0x06204B50, 0x06204A50, 0x06204950, 0x06204850,
+        0x06204750, 0x06204650, 0x06204550, 0x06204450, 0x06204350, 0x06204250, 0x06204150, 0x06204050,
+    };
+
+    // 0x4dc14e
+    // Track 1. Reversed 0. Direction 0
+    static constexpr PackedMoveInfo moveInfoT1R0D0[] = {
+        0x0120504F, 0x0120514E, 0x0120524D, 0x0120534C, 0x0120544B, 0x0120554A, 0x01205649, 0x01205748,
+        0x01205847, 0x01205946, 0x01205A45, 0x01205B44, 0x01205C43, 0x01205D42, 0x01205E41, 0x01205F40,
+        0x0120603F, 0x0120613E, 0x0120623D, 0x0120633C, 0x0120643B, 0x0120653A, 0x01206639, 0x01206738,
+        0x01206837, 0x01206936, 0x01206A35, 0x01206B34, 0x01206C33, 0x01206D32, 0x01206E31, 0x01206F30,
+    };
+
+    // 0x4dc250
+    // Track 1. Reversed 0. Direction 1
+    static constexpr PackedMoveInfo moveInfoT1R0D1[] = {
+        0x03205050, 0x03205151, 0x03205252, 0x03205353, 0x03205454, 0x03205555, 0x03205656, 0x03205757,
+        0x03205858, 0x03205959, 0x03205A5A, 0x03205B5B, 0x03205C5C, 0x03205D5D, 0x03205E5E, 0x03205F5F,
+        0x03206060, 0x03206161, 0x03206262, 0x03206363, 0x03206464, 0x03206565, 0x03206666, 0x03206767,
+        0x03206868, 0x03206969, 0x03206A6A, 0x03206B6B, 0x03206C6C, 0x03206D6D, 0x03206E6E, 0x03206F6F,
+    };
+
+    // 0x4dc352
+    // Track 1. Reversed 0. Direction 2
+    static constexpr PackedMoveInfo moveInfoT1R0D2[] = {
+        0x05204F50, 0x05204E51, 0x05204D52, 0x05204C53, 0x05204B54, 0x05204A55, 0x05204956, 0x05204857,
+        0x05204758, 0x05204659, 0x0520455A, 0x0520445B, 0x0520435C, 0x0520425D, 0x0520415E, 0x0520405F,
+        0x05203F60, 0x05203E61, 0x05203D62, 0x05203C63, 0x05203B64, 0x05203A65, 0x05203966, 0x05203867,
+        0x05203768, 0x05203669, 0x0520356A, 0x0520346B, 0x0520336C, 0x0520326D, 0x0520316E, 0x0520306F,
+    };
+
+    // 0x4dc454
+    // Track 1. Reversed 0. Direction 3
+    static constexpr PackedMoveInfo moveInfoT1R0D3[] = {
+        0x07204F4F, 0x07204E4E, 0x07204D4D, 0x07204C4C, 0x07204B4B, 0x07204A4A, 0x07204949, 0x07204848,
+        0x07204747, 0x07204646, 0x07204545, 0x07204444, 0x07204343, 0x07204242, 0x07204141, 0x07204040,
+        0x07203F3F, 0x07203E3E, 0x07203D3D, 0x07203C3C, 0x07203B3B, 0x07203A3A, 0x07203939, 0x07203838,
+        0x07203737, 0x07203636, 0x07203535, 0x07203434, 0x07203333, 0x07203232, 0x07203131, 0x07203030,
+    };
+
+    // 0x4df376
+    // Track 2. Reversed 0. Direction 0
+    static constexpr PackedMoveInfo moveInfoT2R0D0[] = {
+        0x0020505F, 0x0020505E, 0x07E0505D, 0x07E04F5C, 0x07A04F5B, 0x07A04F5A, 0x07A04E59, 0x07604E58,
+        0x07604D57, 0x07204C56, 0x07204B55, 0x07204A54, 0x06E04953, 0x06E04852, 0x06A04752, 0x06A04651,
+        0x06A04551, 0x06604451, 0x06604350, 0x06204250, 0x06204150, 0x06204050,
+    };
+
+    // 0x4df428
+    // Track 2. Reversed 0. Direction 1
+    static constexpr PackedMoveInfo moveInfoT2R0D1[] = {
+        0x02204050, 0x02204150, 0x02204250, 0x01E04350, 0x01E0444F, 0x01A0454F, 0x01A0464F, 0x01A0474E,
+        0x0160484E, 0x0160494D, 0x01204A4C, 0x01204B4B, 0x01204C4A, 0x00E04D49, 0x00E04E48, 0x00A04E47,
+        0x00A04F46, 0x00A04F45, 0x00604F44, 0x00605043, 0x00205042, 0x00205041, 0x00205040,
+    };
+
+    // 0x4df4e2
+    // Track 2. Reversed 0. Direction 2
+    static constexpr PackedMoveInfo moveInfoT2R0D2[] = {
+        0x04205040, 0x04205041, 0x04205042, 0x03E05043, 0x03E05144, 0x03A05145, 0x03A05146, 0x03A05247,
+        0x03605248, 0x03605349, 0x0320544A, 0x0320554B, 0x0320564C, 0x02E0574D, 0x02E0584E, 0x02A0594E,
+        0x02A05A4F, 0x02A05B4F, 0x02605C4F, 0x02605D50, 0x02205E50, 0x02205F50,
+    };
+
+    // 0x4df594
+    // Track 2. Reversed 0. Direction 3
+    static constexpr PackedMoveInfo moveInfoT2R0D3[] = {
+        0x06205F50, 0x06205E50, 0x05E05D50, 0x05E05C51, 0x05A05B51, 0x05A05A51, 0x05A05952, 0x05605852,
+        0x05605753, 0x05205654, 0x05205555, 0x05205456, 0x04E05357, 0x04E05258, 0x04A05259, 0x04A0515A,
+        0x04A0515B, 0x0460515C, 0x0460505D, 0x0420505E, 0x0420505F,
+    };
+
+    // 0x4df6e8
+    // Track 2. Reversed 1. Direction 0
+    static constexpr PackedMoveInfo moveInfoT2R1D0[] = {
+        0x02204050, 0x02204150, 0x02204250, 0x02604350, 0x02604451, 0x02A04551, 0x02A04651, 0x02A04752,
+        0x02E04852, 0x02E04953, 0x03204A54, 0x03204B55, 0x03204C56, 0x03604D57, 0x03604E58, 0x03A04E59,
+        0x03A04F5A, 0x03A04F5B, 0x03E04F5C, 0x03E0505D, 0x0420505E, 0x0420505F,
+    };
+
+    // 0x4df79a
+    // Track 2. Reversed 1. Direction 1
+    static constexpr PackedMoveInfo moveInfoT2R1D1[] = {
+        0x04205040, 0x04205041, 0x04205042, 0x04605043, 0x04604F44, 0x04A04F45, 0x04A04F46, 0x04A04E47,
+        0x04E04E48, 0x04E04D49, 0x05204C4A, 0x05204B4B, 0x05204A4C, 0x0560494D, 0x0560484E, 0x05A0474E,
+        0x05A0464F, 0x05A0454F, 0x05E0444F, 0x05E04350, 0x06204250, 0x06204150, 0x06204050,
+    };
+
+    // 0x4df854
+    // Track 2. Reversed 1. Direction 2
+    static constexpr PackedMoveInfo moveInfoT2R1D2[] = {
+        0x06205F50, 0x06205E50, 0x06605D50, 0x06605C4F, 0x06A05B4F, 0x06A05A4F, 0x06A0594E, 0x06E0584E,
+        0x06E0574D, 0x0720564C, 0x0720554B, 0x0720544A, 0x07605349, 0x07605248, 0x07A05247, 0x07A05146,
+        0x07A05145, 0x07E05144, 0x07E05043, 0x00205042, 0x00205041, 0x00205040,
+    };
+
+    // 0x4df63e
+    // Track 2. Reversed 1. Direction 3
+    static constexpr PackedMoveInfo moveInfoT2R1D3[] = {
+        0x0020505F, 0x0020505E, 0x0060505D, 0x0060515C, 0x00A0515B, 0x00A0515A, 0x00A05259, 0x00E05258,
+        0x00E05357, 0x01205456, 0x01205555, 0x01205654, 0x01605753, 0x01605852, 0x01A05952, 0x01A05A51,
+        0x01A05B51, 0x01E05C51, 0x01E05D50, 0x02205E50, 0x02205F50,
+    };
+
+    // 0x4df906
+    // Track 4. Reversed 0. Direction 0
+    static constexpr PackedMoveInfo moveInfoT4R0D0[] = {
+        0x0020505F, 0x0020505E, 0x0020505D, 0x0020505C, 0x07E0505B, 0x07E0505A, 0x07E04F59, 0x07E04F58,
+        0x07E04F57, 0x07E04F56, 0x07E04F55, 0x07E04F54, 0x07E04E53, 0x07A04E52, 0x07A04E51, 0x07A04D50,
+        0x07A04D4F, 0x07A04D4E, 0x07A04C4D, 0x07A04C4C, 0x07A04B4B, 0x07A04B4A, 0x07604A49, 0x07604A48,
+        0x07604947, 0x07604946, 0x07604845, 0x07604744, 0x07604743, 0x07604642, 0x07204541, 0x07204440,
+        0x0720433F, 0x0720433D, 0x0720423C, 0x0720413B, 0x0720403A, 0x06E03F39, 0x06E03E39, 0x06E03D38,
+        0x06E03C37, 0x06E03B37, 0x06E03A36, 0x06E03936, 0x06E03835, 0x06A03735, 0x06A03634, 0x06A03534,
+        0x06A03433, 0x06A03333, 0x06A03233, 0x06A03132, 0x06A03032, 0x06A02F32, 0x06602E31, 0x06602D31,
+        0x06602C31, 0x06602B31, 0x06602A31, 0x06602931, 0x06602830, 0x06602730, 0x06602630, 0x06202530,
+        0x06202430, 0x06202330, 0x06202230, 0x06202130,
+    };
+
+    // 0x4dfb28
+    // Track 4. Reversed 0. Direction 1
+    static constexpr PackedMoveInfo moveInfoT4R0D1[] = {
+        0x02204050, 0x02204150, 0x02204250, 0x02204350, 0x02204450, 0x01E04550, 0x01E04650, 0x01E0474F,
+        0x01E0484F, 0x01E0494F, 0x01E04A4F, 0x01E04B4F, 0x01E04C4F, 0x01E04D4E, 0x01A04E4E, 0x01A04F4E,
+        0x01A0504D, 0x01A0514D, 0x01A0524D, 0x01A0534C, 0x01A0544C, 0x01A0554B, 0x01A0564B, 0x0160574A,
+        0x0160584A, 0x01605949, 0x01605A49, 0x01605B48, 0x01605C47, 0x01605D47, 0x01605E46, 0x01205F45,
+        0x01206044, 0x01206143, 0x01206343, 0x01206442, 0x01206541, 0x01206640, 0x00E0673F, 0x00E0673E,
+        0x00E0683D, 0x00E0693C, 0x00E0693B, 0x00E06A3A, 0x00E06A39, 0x00E06B38, 0x00A06B37, 0x00A06C36,
+        0x00A06C35, 0x00A06D34, 0x00A06D33, 0x00A06D32, 0x00A06E31, 0x00A06E30, 0x00A06E2F, 0x00606F2E,
+        0x00606F2D, 0x00606F2C, 0x00606F2B, 0x00606F2A, 0x00606F29, 0x00607028, 0x00607027, 0x00607026,
+        0x00207025, 0x00207024, 0x00207023, 0x00207022, 0x00207021,
+    };
+
+    // 0x4dfd52
+    // Track 4. Reversed 0. Direction 2
+    static constexpr PackedMoveInfo moveInfoT4R0D2[] = {
+        0x04205040, 0x04205041, 0x04205042, 0x04205043, 0x04205044, 0x03E05045, 0x03E05046, 0x03E05147,
+        0x03E05148, 0x03E05149, 0x03E0514A, 0x03E0514B, 0x03E0514C, 0x03E0524D, 0x03A0524E, 0x03A0524F,
+        0x03A05350, 0x03A05351, 0x03A05352, 0x03A05453, 0x03A05454, 0x03A05555, 0x03A05556, 0x03605657,
+        0x03605658, 0x03605759, 0x0360575A, 0x0360585B, 0x0360595C, 0x0360595D, 0x03605A5E, 0x03205B5F,
+        0x03205C60, 0x03205D61, 0x03205D63, 0x03205E64, 0x03205F65, 0x03206066, 0x02E06167, 0x02E06267,
+        0x02E06368, 0x02E06469, 0x02E06569, 0x02E0666A, 0x02E0676A, 0x02E0686B, 0x02A0696B, 0x02A06A6C,
+        0x02A06B6C, 0x02A06C6D, 0x02A06D6D, 0x02A06E6D, 0x02A06F6E, 0x02A0706E, 0x02A0716E, 0x0260726F,
+        0x0260736F, 0x0260746F, 0x0260756F, 0x0260766F, 0x0260776F, 0x02607870, 0x02607970, 0x02607A70,
+        0x02207B70, 0x02207C70, 0x02207D70, 0x02207E70,
+    };
+
+    // 0x4dff74
+    // Track 4. Reversed 0. Direction 3
+    static constexpr PackedMoveInfo moveInfoT4R0D3[] = {
+        0x06205F50, 0x06205E50, 0x06205D50, 0x06205C50, 0x05E05B50, 0x05E05A50, 0x05E05951, 0x05E05851,
+        0x05E05751, 0x05E05651, 0x05E05551, 0x05E05451, 0x05E05352, 0x05A05252, 0x05A05152, 0x05A05053,
+        0x05A04F53, 0x05A04E53, 0x05A04D54, 0x05A04C54, 0x05A04B55, 0x05A04A55, 0x05604956, 0x05604856,
+        0x05604757, 0x05604657, 0x05604558, 0x05604459, 0x05604359, 0x0560425A, 0x0520415B, 0x0520405C,
+        0x05203F5D, 0x05203D5D, 0x05203C5E, 0x05203B5F, 0x05203A60, 0x04E03961, 0x04E03962, 0x04E03863,
+        0x04E03764, 0x04E03765, 0x04E03666, 0x04E03667, 0x04E03568, 0x04A03569, 0x04A0346A, 0x04A0346B,
+        0x04A0336C, 0x04A0336D, 0x04A0336E, 0x04A0326F, 0x04A03270, 0x04A03271, 0x04603172, 0x04603173,
+        0x04603174, 0x04603175, 0x04603176, 0x04603177, 0x04603078, 0x04603079, 0x0460307A, 0x0420307B,
+        0x0420307C, 0x0420307D, 0x0420307E,
+    };
+
+    // 0x4e03a8
+    // Track 4. Reversed 1. Direction 0
+    static constexpr PackedMoveInfo moveInfoT4R1D0[] = {
+        0x02204050, 0x02204150, 0x02204250, 0x02204350, 0x02204450, 0x02604550, 0x02604650, 0x02604751,
+        0x02604851, 0x02604951, 0x02604A51, 0x02604B51, 0x02604C51, 0x02604D52, 0x02A04E52, 0x02A04F52,
+        0x02A05053, 0x02A05153, 0x02A05253, 0x02A05354, 0x02A05454, 0x02A05555, 0x02A05655, 0x02E05756,
+        0x02E05856, 0x02E05957, 0x02E05A57, 0x02E05B58, 0x02E05C59, 0x02E05D59, 0x02E05E5A, 0x03205F5B,
+        0x0320605C, 0x0320615D, 0x0320635D, 0x0320645E, 0x0320655F, 0x03206660, 0x03606761, 0x03606762,
+        0x03606863, 0x03606964, 0x03606965, 0x03606A66, 0x03606A67, 0x03606B68, 0x03A06B69, 0x03A06C6A,
+        0x03A06C6B, 0x03A06D6C, 0x03A06D6D, 0x03A06D6E, 0x03A06E6F, 0x03A06E70, 0x03A06E71, 0x03E06F72,
+        0x03E06F73, 0x03E06F74, 0x03E06F75, 0x03E06F76, 0x03E06F77, 0x03E07078, 0x03E07079, 0x03E0707A,
+        0x0420707B, 0x0420707C, 0x0420707D, 0x0420707E,
+    };
+
+    // 0x4e05ca
+    // Track 4. Reversed 1. Direction 1
+    static constexpr PackedMoveInfo moveInfoT4R1D1[] = {
+        0x04205040, 0x04205041, 0x04205042, 0x04205043, 0x04205044, 0x04605045, 0x04605046, 0x04604F47,
+        0x04604F48, 0x04604F49, 0x04604F4A, 0x04604F4B, 0x04604F4C, 0x04604E4D, 0x04A04E4E, 0x04A04E4F,
+        0x04A04D50, 0x04A04D51, 0x04A04D52, 0x04A04C53, 0x04A04C54, 0x04A04B55, 0x04A04B56, 0x04E04A57,
+        0x04E04A58, 0x04E04959, 0x04E0495A, 0x04E0485B, 0x04E0475C, 0x04E0475D, 0x04E0465E, 0x0520455F,
+        0x05204460, 0x05204361, 0x05204363, 0x05204264, 0x05204165, 0x05204066, 0x05603F67, 0x05603E67,
+        0x05603D68, 0x05603C69, 0x05603B69, 0x05603A6A, 0x0560396A, 0x0560386B, 0x05A0376B, 0x05A0366C,
+        0x05A0356C, 0x05A0346D, 0x05A0336D, 0x05A0326D, 0x05A0316E, 0x05A0306E, 0x05A02F6E, 0x05E02E6F,
+        0x05E02D6F, 0x05E02C6F, 0x05E02B6F, 0x05E02A6F, 0x05E0296F, 0x05E02870, 0x05E02770, 0x05E02670,
+        0x06202570, 0x06202470, 0x06202370, 0x06202270, 0x06202170,
+    };
+
+    // 0x4e07f4
+    // Track 4. Reversed 1. Direction 2
+    static constexpr PackedMoveInfo moveInfoT4R1D2[] = {
+        0x06205F50, 0x06205E50, 0x06205D50, 0x06205C50, 0x06605B50, 0x06605A50, 0x0660594F, 0x0660584F,
+        0x0660574F, 0x0660564F, 0x0660554F, 0x0660544F, 0x0660534E, 0x06A0524E, 0x06A0514E, 0x06A0504D,
+        0x06A04F4D, 0x06A04E4D, 0x06A04D4C, 0x06A04C4C, 0x06A04B4B, 0x06A04A4B, 0x06E0494A, 0x06E0484A,
+        0x06E04749, 0x06E04649, 0x06E04548, 0x06E04447, 0x06E04347, 0x06E04246, 0x07204145, 0x07204044,
+        0x07203F43, 0x07203D43, 0x07203C42, 0x07203B41, 0x07203A40, 0x0760393F, 0x0760393E, 0x0760383D,
+        0x0760373C, 0x0760373B, 0x0760363A, 0x07603639, 0x07603538, 0x07A03537, 0x07A03436, 0x07A03435,
+        0x07A03334, 0x07A03333, 0x07A03332, 0x07A03231, 0x07A03230, 0x07A0322F, 0x07E0312E, 0x07E0312D,
+        0x07E0312C, 0x07E0312B, 0x07E0312A, 0x07E03129, 0x07E03028, 0x07E03027, 0x07E03026, 0x00203025,
+        0x00203024, 0x00203023, 0x00203022, 0x00203021,
+    };
+
+    // 0x4e018e
+    // Track 4. Reversed 1. Direction 3
+    static constexpr PackedMoveInfo moveInfoT4R1D3[] = {
+        0x0020505F, 0x0020505E, 0x0020505D, 0x0020505C, 0x0060505B, 0x0060505A, 0x00605159, 0x00605158,
+        0x00605157, 0x00605156, 0x00605155, 0x00605154, 0x00605253, 0x00A05252, 0x00A05251, 0x00A05350,
+        0x00A0534F, 0x00A0534E, 0x00A0544D, 0x00A0544C, 0x00A0554B, 0x00A0554A, 0x00E05649, 0x00E05648,
+        0x00E05747, 0x00E05746, 0x00E05845, 0x00E05944, 0x00E05943, 0x00E05A42, 0x01205B41, 0x01205C40,
+        0x01205D3F, 0x01205D3D, 0x01205E3C, 0x01205F3B, 0x0120603A, 0x01606139, 0x01606239, 0x01606338,
+        0x01606437, 0x01606537, 0x01606636, 0x01606736, 0x01606835, 0x01A06935, 0x01A06A34, 0x01A06B34,
+        0x01A06C33, 0x01A06D33, 0x01A06E33, 0x01A06F32, 0x01A07032, 0x01A07132, 0x01E07231, 0x01E07331,
+        0x01E07431, 0x01E07531, 0x01E07631, 0x01E07731, 0x01E07830, 0x01E07930, 0x01E07A30, 0x02207B30,
+        0x02207C30, 0x02207D30, 0x02207E30,
+    };
+
+    // 0x4e0a16
+    // Track 6. Reversed 0. Direction 0
+    static constexpr PackedMoveInfo moveInfoT6R0D0[] = {
+        0x0020505F, 0x0020505E, 0x0020505D, 0x0020505C, 0x0020505B, 0x0020505A, 0x00205059, 0x07E05058,
+        0x07E04F57, 0x07E04F56, 0x07E04F55, 0x07E04F54, 0x07E04F53, 0x07E04F52, 0x07E04E51, 0x07E04E50,
+        0x07E04E4F, 0x07E04E4E, 0x07E04E4D, 0x07E04D4C, 0x07E04D4B, 0x07E04D4A, 0x07E04D49, 0x07A04C48,
+        0x07A04C47, 0x07A04C46, 0x07A04B45, 0x07A04B44, 0x07A04B43, 0x07A04A42, 0x07A04A41, 0x07A04940,
+        0x07A0493F, 0x07A0483E, 0x07A0483D, 0x07A0473C, 0x07A0473B, 0x07A0463A, 0x07604639, 0x07604538,
+        0x07604437, 0x07604436, 0x07604335, 0x07604234, 0x07604233, 0x07604132, 0x07604031, 0x07604030,
+        0x07603F2F, 0x07603E2E, 0x07203D2D, 0x07203D2C, 0x07203C2B, 0x07203B2A, 0x07203A29, 0x07203928,
+        0x07203927, 0x07203826, 0x07203725, 0x07203624, 0x07203523, 0x07203423, 0x06E03322, 0x06E03221,
+        0x06E03120, 0x06E03020, 0x06E02F1F, 0x06E02E1E, 0x06E02D1E, 0x06E02C1D, 0x06E02B1C, 0x06E02A1C,
+        0x06E0291B, 0x06E0281A, 0x06A0271A, 0x06A02619, 0x06A02519, 0x06A02418, 0x06A02318, 0x06A02217,
+        0x06A02117, 0x06A02016, 0x06A01F16, 0x06A01E15, 0x06A01D15, 0x06A01C15, 0x06A01B14, 0x06601A14,
+        0x06601914, 0x06601813, 0x06601713, 0x06601613, 0x06601513, 0x06601412, 0x06601312, 0x06601212,
+        0x06601112, 0x06601012, 0x06600F11, 0x06600E11, 0x06600D11, 0x06600C11, 0x06600B11, 0x06600A11,
+        0x06600910, 0x06200810, 0x06200710, 0x06200610, 0x06200510, 0x06200410, 0x06200310, 0x06200210,
+        0x06200110, 0x06200010,
+    };
+
+    // 0x4e0da8
+    // Track 6. Reversed 0. Direction 1
+    static constexpr PackedMoveInfo moveInfoT6R0D1[] = {
+        0x02204050, 0x02204150, 0x02204250, 0x02204350, 0x02204450, 0x02204550, 0x02204650, 0x02204750,
+        0x01E04850, 0x01E0494F, 0x01E04A4F, 0x01E04B4F, 0x01E04C4F, 0x01E04D4F, 0x01E04E4F, 0x01E04F4E,
+        0x01E0504E, 0x01E0514E, 0x01E0524E, 0x01E0534E, 0x01E0544D, 0x01E0554D, 0x01E0564D, 0x01E0574D,
+        0x01A0584C, 0x01A0594C, 0x01A05A4C, 0x01A05B4B, 0x01A05C4B, 0x01A05D4B, 0x01A05E4A, 0x01A05F4A,
+        0x01A06049, 0x01A06149, 0x01A06248, 0x01A06348, 0x01A06447, 0x01A06547, 0x01A06646, 0x01606746,
+        0x01606845, 0x01606944, 0x01606A44, 0x01606B43, 0x01606C42, 0x01606D42, 0x01606E41, 0x01606F40,
+        0x01607040, 0x0160713F, 0x0160723E, 0x0120733D, 0x0120743D, 0x0120753C, 0x0120763B, 0x0120773A,
+        0x01207839, 0x01207939, 0x01207A38, 0x01207B37, 0x01207C36, 0x01207D35, 0x01207D34, 0x00E07E33,
+        0x00E07F32, 0x00E08031, 0x00E08030, 0x00E0812F, 0x00E0822E, 0x00E0822D, 0x00E0832C, 0x00E0842B,
+        0x00E0842A, 0x00E08529, 0x00E08628, 0x00A08627, 0x00A08726, 0x00A08725, 0x00A08824, 0x00A08823,
+        0x00A08922, 0x00A08921, 0x00A08A20, 0x00A08A1F, 0x00A08B1E, 0x00A08B1D, 0x00A08B1C, 0x00A08C1B,
+        0x00608C1A, 0x00608C19, 0x00608D18, 0x00608D17, 0x00608D16, 0x00608D15, 0x00608E14, 0x00608E13,
+        0x00608E12, 0x00608E11, 0x00608E10, 0x00608F0F, 0x00608F0E, 0x00608F0D, 0x00608F0C, 0x00608F0B,
+        0x00608F0A, 0x00609009, 0x00209008, 0x00209007, 0x00209006, 0x00209005, 0x00209004, 0x00209003,
+        0x00209002, 0x00209001, 0x00209000,
+    };
+
+    // 0x4e1142
+    // Track 6. Reversed 0. Direction 2
+    static constexpr PackedMoveInfo moveInfoT6R0D2[] = {
+        0x04205040, 0x04205041, 0x04205042, 0x04205043, 0x04205044, 0x04205045, 0x04205046, 0x04205047,
+        0x03E05048, 0x03E05149, 0x03E0514A, 0x03E0514B, 0x03E0514C, 0x03E0514D, 0x03E0514E, 0x03E0524F,
+        0x03E05250, 0x03E05251, 0x03E05252, 0x03E05253, 0x03E05354, 0x03E05355, 0x03E05356, 0x03E05357,
+        0x03A05458, 0x03A05459, 0x03A0545A, 0x03A0555B, 0x03A0555C, 0x03A0555D, 0x03A0565E, 0x03A0565F,
+        0x03A05760, 0x03A05761, 0x03A05862, 0x03A05863, 0x03A05964, 0x03A05965, 0x03A05A66, 0x03605A67,
+        0x03605B68, 0x03605C69, 0x03605C6A, 0x03605D6B, 0x03605E6C, 0x03605E6D, 0x03605F6E, 0x0360606F,
+        0x03606070, 0x03606171, 0x03606272, 0x03206373, 0x03206374, 0x03206475, 0x03206576, 0x03206677,
+        0x03206778, 0x03206779, 0x0320687A, 0x0320697B, 0x03206A7C, 0x03206B7D, 0x03206C7D, 0x02E06D7E,
+        0x02E06E7F, 0x02E06F80, 0x02E07080, 0x02E07181, 0x02E07282, 0x02E07382, 0x02E07483, 0x02E07584,
+        0x02E07684, 0x02E07785, 0x02E07886, 0x02A07986, 0x02A07A87, 0x02A07B87, 0x02A07C88, 0x02A07D88,
+        0x02A07E89, 0x02A07F89, 0x02A0808A, 0x02A0818A, 0x02A0828B, 0x02A0838B, 0x02A0848B, 0x02A0858C,
+        0x0260868C, 0x0260878C, 0x0260888D, 0x0260898D, 0x02608A8D, 0x02608B8D, 0x02608C8E, 0x02608D8E,
+        0x02608E8E, 0x02608F8E, 0x0260908E, 0x0260918F, 0x0260928F, 0x0260938F, 0x0260948F, 0x0260958F,
+        0x0260968F, 0x02609790, 0x02209890, 0x02209990, 0x02209A90, 0x02209B90, 0x02209C90, 0x02209D90,
+        0x02209E90, 0x02209F90,
+    };
+
+    // 0x4e14d4
+    // Track 6. Reversed 0. Direction 3
+    static constexpr PackedMoveInfo moveInfoT6R0D3[] = {
+        0x06205F50, 0x06205E50, 0x06205D50, 0x06205C50, 0x06205B50, 0x06205A50, 0x06205950, 0x05E05850,
+        0x05E05751, 0x05E05651, 0x05E05551, 0x05E05451, 0x05E05351, 0x05E05251, 0x05E05152, 0x05E05052,
+        0x05E04F52, 0x05E04E52, 0x05E04D52, 0x05E04C53, 0x05E04B53, 0x05E04A53, 0x05E04953, 0x05A04854,
+        0x05A04754, 0x05A04654, 0x05A04555, 0x05A04455, 0x05A04355, 0x05A04256, 0x05A04156, 0x05A04057,
+        0x05A03F57, 0x05A03E58, 0x05A03D58, 0x05A03C59, 0x05A03B59, 0x05A03A5A, 0x0560395A, 0x0560385B,
+        0x0560375C, 0x0560365C, 0x0560355D, 0x0560345E, 0x0560335E, 0x0560325F, 0x05603160, 0x05603060,
+        0x05602F61, 0x05602E62, 0x05202D63, 0x05202C63, 0x05202B64, 0x05202A65, 0x05202966, 0x05202867,
+        0x05202767, 0x05202668, 0x05202569, 0x0520246A, 0x0520236B, 0x0520236C, 0x04E0226D, 0x04E0216E,
+        0x04E0206F, 0x04E02070, 0x04E01F71, 0x04E01E72, 0x04E01E73, 0x04E01D74, 0x04E01C75, 0x04E01C76,
+        0x04E01B77, 0x04E01A78, 0x04A01A79, 0x04A0197A, 0x04A0197B, 0x04A0187C, 0x04A0187D, 0x04A0177E,
+        0x04A0177F, 0x04A01680, 0x04A01681, 0x04A01582, 0x04A01583, 0x04A01584, 0x04A01485, 0x04601486,
+        0x04601487, 0x04601388, 0x04601389, 0x0460138A, 0x0460138B, 0x0460128C, 0x0460128D, 0x0460128E,
+        0x0460128F, 0x04601290, 0x04601191, 0x04601192, 0x04601193, 0x04601194, 0x04601195, 0x04601196,
+        0x04601097, 0x04201098, 0x04201099, 0x0420109A, 0x0420109B, 0x0420109C, 0x0420109D, 0x0420109E,
+        0x0420109F,
+    };
+
+    // 0x4e1be8
+    // Track 6. Reversed 1. Direction 0
+    static constexpr PackedMoveInfo moveInfoT6R1D0[] = {
+        0x02204050, 0x02204150, 0x02204250, 0x02204350, 0x02204450, 0x02204550, 0x02204650, 0x02204750,
+        0x02604850, 0x02604951, 0x02604A51, 0x02604B51, 0x02604C51, 0x02604D51, 0x02604E51, 0x02604F52,
+        0x02605052, 0x02605152, 0x02605252, 0x02605352, 0x02605453, 0x02605553, 0x02605653, 0x02605753,
+        0x02A05854, 0x02A05954, 0x02A05A54, 0x02A05B55, 0x02A05C55, 0x02A05D55, 0x02A05E56, 0x02A05F56,
+        0x02A06057, 0x02A06157, 0x02A06258, 0x02A06358, 0x02A06459, 0x02A06559, 0x02A0665A, 0x02E0675A,
+        0x02E0685B, 0x02E0695C, 0x02E06A5C, 0x02E06B5D, 0x02E06C5E, 0x02E06D5E, 0x02E06E5F, 0x02E06F60,
+        0x02E07060, 0x02E07161, 0x02E07262, 0x03207363, 0x03207463, 0x03207564, 0x03207665, 0x03207766,
+        0x03207867, 0x03207967, 0x03207A68, 0x03207B69, 0x03207C6A, 0x03207D6B, 0x03207D6C, 0x03607E6D,
+        0x03607F6E, 0x0360806F, 0x03608070, 0x03608171, 0x03608272, 0x03608273, 0x03608374, 0x03608475,
+        0x03608476, 0x03608577, 0x03608678, 0x03A08679, 0x03A0877A, 0x03A0877B, 0x03A0887C, 0x03A0887D,
+        0x03A0897E, 0x03A0897F, 0x03A08A80, 0x03A08A81, 0x03A08B82, 0x03A08B83, 0x03A08B84, 0x03A08C85,
+        0x03E08C86, 0x03E08C87, 0x03E08D88, 0x03E08D89, 0x03E08D8A, 0x03E08D8B, 0x03E08E8C, 0x03E08E8D,
+        0x03E08E8E, 0x03E08E8F, 0x03E08E90, 0x03E08F91, 0x03E08F92, 0x03E08F93, 0x03E08F94, 0x03E08F95,
+        0x03E08F96, 0x03E09097, 0x04209098, 0x04209099, 0x0420909A, 0x0420909B, 0x0420909C, 0x0420909D,
+        0x0420909E, 0x0420909F,
+    };
+
+    // 0x4e1f7a
+    // Track 6. Reversed 1. Direction 1
+    static constexpr PackedMoveInfo moveInfoT6R1D1[] = {
+        0x04205040, 0x04205041, 0x04205042, 0x04205043, 0x04205044, 0x04205045, 0x04205046, 0x04205047,
+        0x04605048, 0x04604F49, 0x04604F4A, 0x04604F4B, 0x04604F4C, 0x04604F4D, 0x04604F4E, 0x04604E4F,
+        0x04604E50, 0x04604E51, 0x04604E52, 0x04604E53, 0x04604D54, 0x04604D55, 0x04604D56, 0x04604D57,
+        0x04A04C58, 0x04A04C59, 0x04A04C5A, 0x04A04B5B, 0x04A04B5C, 0x04A04B5D, 0x04A04A5E, 0x04A04A5F,
+        0x04A04960, 0x04A04961, 0x04A04862, 0x04A04863, 0x04A04764, 0x04A04765, 0x04A04666, 0x04E04667,
+        0x04E04568, 0x04E04469, 0x04E0446A, 0x04E0436B, 0x04E0426C, 0x04E0426D, 0x04E0416E, 0x04E0406F,
+        0x04E04070, 0x04E03F71, 0x04E03E72, 0x05203D73, 0x05203D74, 0x05203C75, 0x05203B76, 0x05203A77,
+        0x05203978, 0x05203979, 0x0520387A, 0x0520377B, 0x0520367C, 0x0520357D, 0x0520347D, 0x0560337E,
+        0x0560327F, 0x05603180, 0x05603080, 0x05602F81, 0x05602E82, 0x05602D82, 0x05602C83, 0x05602B84,
+        0x05602A84, 0x05602985, 0x05602886, 0x05A02786, 0x05A02687, 0x05A02587, 0x05A02488, 0x05A02388,
+        0x05A02289, 0x05A02189, 0x05A0208A, 0x05A01F8A, 0x05A01E8B, 0x05A01D8B, 0x05A01C8B, 0x05A01B8C,
+        0x05E01A8C, 0x05E0198C, 0x05E0188D, 0x05E0178D, 0x05E0168D, 0x05E0158D, 0x05E0148E, 0x05E0138E,
+        0x05E0128E, 0x05E0118E, 0x05E0108E, 0x05E00F8F, 0x05E00E8F, 0x05E00D8F, 0x05E00C8F, 0x05E00B8F,
+        0x05E00A8F, 0x05E00990, 0x06200890, 0x06200790, 0x06200690, 0x06200590, 0x06200490, 0x06200390,
+        0x06200290, 0x06200190, 0x06200090,
+    };
+
+    // 0x4e2314
+    // Track 6. Reversed 1. Direction 2
+    static constexpr PackedMoveInfo moveInfoT6R1D2[] = {
+        0x06205F50, 0x06205E50, 0x06205D50, 0x06205C50, 0x06205B50, 0x06205A50, 0x06205950, 0x06605850,
+        0x0660574F, 0x0660564F, 0x0660554F, 0x0660544F, 0x0660534F, 0x0660524F, 0x0660514E, 0x0660504E,
+        0x06604F4E, 0x06604E4E, 0x06604D4E, 0x06604C4D, 0x06604B4D, 0x06604A4D, 0x0660494D, 0x06A0484C,
+        0x06A0474C, 0x06A0464C, 0x06A0454B, 0x06A0444B, 0x06A0434B, 0x06A0424A, 0x06A0414A, 0x06A04049,
+        0x06A03F49, 0x06A03E48, 0x06A03D48, 0x06A03C47, 0x06A03B47, 0x06A03A46, 0x06E03946, 0x06E03845,
+        0x06E03744, 0x06E03644, 0x06E03543, 0x06E03442, 0x06E03342, 0x06E03241, 0x06E03140, 0x06E03040,
+        0x06E02F3F, 0x06E02E3E, 0x07202D3D, 0x07202C3D, 0x07202B3C, 0x07202A3B, 0x0720293A, 0x07202839,
+        0x07202739, 0x07202638, 0x07202537, 0x07202436, 0x07202335, 0x07202334, 0x07602233, 0x07602132,
+        0x07602031, 0x07602030, 0x07601F2F, 0x07601E2E, 0x07601E2D, 0x07601D2C, 0x07601C2B, 0x07601C2A,
+        0x07601B29, 0x07601A28, 0x07A01A27, 0x07A01926, 0x07A01925, 0x07A01824, 0x07A01823, 0x07A01722,
+        0x07A01721, 0x07A01620, 0x07A0161F, 0x07A0151E, 0x07A0151D, 0x07A0151C, 0x07A0141B, 0x07E0141A,
+        0x07E01419, 0x07E01318, 0x07E01317, 0x07E01316, 0x07E01315, 0x07E01214, 0x07E01213, 0x07E01212,
+        0x07E01211, 0x07E01210, 0x07E0110F, 0x07E0110E, 0x07E0110D, 0x07E0110C, 0x07E0110B, 0x07E0110A,
+        0x07E01009, 0x00201008, 0x00201007, 0x00201006, 0x00201005, 0x00201004, 0x00201003, 0x00201002,
+        0x00201001, 0x00201000,
+    };
+
+    // 0x4e185e
+    // Track 6. Reversed 1. Direction 3
+    static constexpr PackedMoveInfo moveInfoT6R1D3[] = {
+        0x0020505F, 0x0020505E, 0x0020505D, 0x0020505C, 0x0020505B, 0x0020505A, 0x00205059, 0x00605058,
+        0x00605157, 0x00605156, 0x00605155, 0x00605154, 0x00605153, 0x00605152, 0x00605251, 0x00605250,
+        0x0060524F, 0x0060524E, 0x0060524D, 0x0060534C, 0x0060534B, 0x0060534A, 0x00605349, 0x00A05448,
+        0x00A05447, 0x00A05446, 0x00A05545, 0x00A05544, 0x00A05543, 0x00A05642, 0x00A05641, 0x00A05740,
+        0x00A0573F, 0x00A0583E, 0x00A0583D, 0x00A0593C, 0x00A0593B, 0x00A05A3A, 0x00E05A39, 0x00E05B38,
+        0x00E05C37, 0x00E05C36, 0x00E05D35, 0x00E05E34, 0x00E05E33, 0x00E05F32, 0x00E06031, 0x00E06030,
+        0x00E0612F, 0x00E0622E, 0x0120632D, 0x0120632C, 0x0120642B, 0x0120652A, 0x01206629, 0x01206728,
+        0x01206727, 0x01206826, 0x01206925, 0x01206A24, 0x01206B23, 0x01206C23, 0x01606D22, 0x01606E21,
+        0x01606F20, 0x01607020, 0x0160711F, 0x0160721E, 0x0160731E, 0x0160741D, 0x0160751C, 0x0160761C,
+        0x0160771B, 0x0160781A, 0x01A0791A, 0x01A07A19, 0x01A07B19, 0x01A07C18, 0x01A07D18, 0x01A07E17,
+        0x01A07F17, 0x01A08016, 0x01A08116, 0x01A08215, 0x01A08315, 0x01A08415, 0x01A08514, 0x01E08614,
+        0x01E08714, 0x01E08813, 0x01E08913, 0x01E08A13, 0x01E08B13, 0x01E08C12, 0x01E08D12, 0x01E08E12,
+        0x01E08F12, 0x01E09012, 0x01E09111, 0x01E09211, 0x01E09311, 0x01E09411, 0x01E09511, 0x01E09611,
+        0x01E09710, 0x02209810, 0x02209910, 0x02209A10, 0x02209B10, 0x02209C10, 0x02209D10, 0x02209E10,
+        0x02209F10,
+    };
+
+    // 0x4e26a6
+    // Track 8. Reversed 0. Direction 0
+    static constexpr PackedMoveInfo moveInfoT8R0D0[] = {
+        0x0020505F, 0x0020505E, 0x0020505D, 0x0020505C, 0x0020505B, 0x0020505A, 0x00205059, 0x00205058,
+        0x00205057, 0x00205056, 0x07E05055, 0x07E05054, 0x07E04F53, 0x07E04F52, 0x07E04F51, 0x07E04F50,
+        0x07E04F4F, 0x07E04E4E, 0x07E04E4D, 0x07E04E4C, 0x07E04E4B, 0x07E04E4A, 0x07E04D49, 0x07E04D48,
+        0x07E04D47, 0x07E04D46, 0x07E04D45, 0x07E04C44, 0x07E04C43, 0x07E04C42, 0x07E04C41, 0x07A04B40,
+        0x07A04B3F, 0x07A04B3E, 0x07A04B3D, 0x07A04A3C, 0x07A04A3B, 0x07A04A3A, 0x07A04939, 0x07A04938,
+        0x07A04937, 0x07A04836, 0x07A04835, 0x07A04834, 0x07A04733, 0x07A04732, 0x07A04631, 0x07A04630,
+        0x07A0452F, 0x07A0452E, 0x07A0442D, 0x07A0442C, 0x0760432B, 0x0760432A, 0x07604229, 0x07604228,
+        0x07604127, 0x07604026, 0x07604025, 0x07603F24, 0x07603E23, 0x07603E22, 0x07603D21, 0x07603C20,
+        0x07603C1F, 0x07603B1E, 0x07603A1D, 0x0760391C, 0x0760391B, 0x0760381A, 0x07203719, 0x07203618,
+        0x07203517, 0x07203416, 0x07203415, 0x07203314, 0x07203213, 0x07203112, 0x07203011,
+    };
+
+    // 0x4e2920
+    // Track 8. Reversed 0. Direction 1
+    static constexpr PackedMoveInfo moveInfoT8R0D1[] = {
+        0x02204050, 0x02204150, 0x02204250, 0x02204350, 0x02204450, 0x02204550, 0x02204650, 0x02204750,
+        0x02204850, 0x02204950, 0x02204A50, 0x01E04B50, 0x01E04C50, 0x01E04D4F, 0x01E04E4F, 0x01E04F4F,
+        0x01E0504F, 0x01E0514F, 0x01E0524E, 0x01E0534E, 0x01E0544E, 0x01E0554E, 0x01E0564E, 0x01E0574D,
+        0x01E0584D, 0x01E0594D, 0x01E05A4D, 0x01E05B4D, 0x01E05C4C, 0x01E05D4C, 0x01E05E4C, 0x01E05F4C,
+        0x01A0604B, 0x01A0614B, 0x01A0624B, 0x01A0634B, 0x01A0644A, 0x01A0654A, 0x01A0664A, 0x01A06749,
+        0x01A06849, 0x01A06949, 0x01A06A48, 0x01A06B48, 0x01A06C48, 0x01A06D47, 0x01A06E47, 0x01A06F46,
+        0x01A07046, 0x01A07145, 0x01A07245, 0x01A07344, 0x01A07444, 0x01607543, 0x01607643, 0x01607742,
+        0x01607842, 0x01607941, 0x01607A40, 0x01607B40, 0x01607C3F, 0x01607D3E, 0x01607E3E, 0x01607F3D,
+        0x0160803C, 0x0160813C, 0x0160823B, 0x0160833A, 0x01608439, 0x01608539, 0x01608638, 0x01208737,
+        0x01208836, 0x01208935, 0x01208A34, 0x01208B34, 0x01208C33, 0x01208D32, 0x01208E31, 0x01208F30,
+    };
+
+    // 0x4e2ba2
+    // Track 8. Reversed 0. Direction 2
+    static constexpr PackedMoveInfo moveInfoT8R0D2[] = {
+        0x04205040, 0x04205041, 0x04205042, 0x04205043, 0x04205044, 0x04205045, 0x04205046, 0x04205047,
+        0x04205048, 0x04205049, 0x0420504A, 0x03E0504B, 0x03E0504C, 0x03E0504D, 0x03E0514E, 0x03E0514F,
+        0x03E05150, 0x03E05151, 0x03E05152, 0x03E05253, 0x03E05254, 0x03E05255, 0x03E05256, 0x03E05257,
+        0x03E05358, 0x03E05359, 0x03E0535A, 0x03E0535B, 0x03E0535C, 0x03E0545D, 0x03E0545E, 0x03E0545F,
+        0x03A05460, 0x03A05561, 0x03A05562, 0x03A05563, 0x03A05564, 0x03A05665, 0x03A05666, 0x03A05667,
+        0x03A05768, 0x03A05769, 0x03A0576A, 0x03A0586B, 0x03A0586C, 0x03A0586D, 0x03A0596E, 0x03A0596F,
+        0x03A05A70, 0x03A05A71, 0x03A05B72, 0x03A05B73, 0x03A05C74, 0x03605C75, 0x03605D76, 0x03605D77,
+        0x03605E78, 0x03605E79, 0x03605F7A, 0x0360607B, 0x0360607C, 0x0360617D, 0x0360627E, 0x0360627F,
+        0x03606380, 0x03606481, 0x03606482, 0x03606583, 0x03606684, 0x03606785, 0x03606786, 0x03206887,
+        0x03206988, 0x03206A89, 0x03206B8A, 0x03206C8B, 0x03206C8C, 0x03206D8D, 0x03206E8E, 0x03206F8F,
+    };
+
+    // 0x4e2e24
+    // Track 8. Reversed 0. Direction 3
+    static constexpr PackedMoveInfo moveInfoT8R0D3[] = {
+        0x06205F50, 0x06205E50, 0x06205D50, 0x06205C50, 0x06205B50, 0x06205A50, 0x06205950, 0x06205850,
+        0x06205750, 0x06205650, 0x05E05550, 0x05E05450, 0x05E05350, 0x05E05250, 0x05E05151, 0x05E05051,
+        0x05E04F51, 0x05E04E51, 0x05E04D51, 0x05E04C52, 0x05E04B52, 0x05E04A52, 0x05E04952, 0x05E04852,
+        0x05E04753, 0x05E04653, 0x05E04553, 0x05E04453, 0x05E04353, 0x05E04254, 0x05E04154, 0x05A04054,
+        0x05A03F54, 0x05A03E55, 0x05A03D55, 0x05A03C55, 0x05A03B55, 0x05A03A56, 0x05A03956, 0x05A03856,
+        0x05A03757, 0x05A03657, 0x05A03557, 0x05A03458, 0x05A03358, 0x05A03258, 0x05A03159, 0x05A03059,
+        0x05A02F5A, 0x05A02E5A, 0x05A02D5B, 0x05A02C5B, 0x05602B5C, 0x05602A5C, 0x0560295D, 0x0560285D,
+        0x0560275E, 0x0560265E, 0x0560255F, 0x05602460, 0x05602360, 0x05602261, 0x05602162, 0x05602062,
+        0x05601F63, 0x05601E64, 0x05601D64, 0x05601C65, 0x05601B66, 0x05601A67, 0x05201967, 0x05201868,
+        0x05201769, 0x0520166A, 0x0520156B, 0x0520146C, 0x0520136C, 0x0520126D, 0x0520116E, 0x0520106F,
+    };
+
+    // 0x4e4728
+    // Track 8. Reversed 1. Direction 0
+    static constexpr PackedMoveInfo moveInfoT8R1D0[] = {
+        0x03205050, 0x03205151, 0x03205252, 0x03205353, 0x03205454, 0x03205455, 0x03205556, 0x03205657,
+        0x03605758, 0x03605859, 0x0360595A, 0x0360595B, 0x03605A5C, 0x03605B5D, 0x03605C5E, 0x03605C5F,
+        0x03605D60, 0x03605E61, 0x03605E62, 0x03605F63, 0x03606064, 0x03606065, 0x03606166, 0x03606267,
+        0x03606268, 0x03606369, 0x0360636A, 0x03A0646B, 0x03A0646C, 0x03A0656D, 0x03A0656E, 0x03A0666F,
+        0x03A06670, 0x03A06771, 0x03A06772, 0x03A06873, 0x03A06874, 0x03A06875, 0x03A06976, 0x03A06977,
+        0x03A06978, 0x03A06A79, 0x03A06A7A, 0x03A06A7B, 0x03A06B7C, 0x03A06B7D, 0x03A06B7E, 0x03E06B7F,
+        0x03E06C80, 0x03E06C81, 0x03E06C82, 0x03E06C83, 0x03E06D84, 0x03E06D85, 0x03E06D86, 0x03E06D87,
+        0x03E06D88, 0x03E06E89, 0x03E06E8A, 0x03E06E8B, 0x03E06E8C, 0x03E06E8D, 0x03E06F8E, 0x03E06F8F,
+        0x03E06F90, 0x03E06F91, 0x03E06F92, 0x04207093, 0x04207094, 0x04207095, 0x04207096, 0x04207097,
+        0x04207098, 0x04207099, 0x0420709A, 0x0420709B, 0x0420709C, 0x0420709D, 0x0420709E, 0x0420709F,
+    };
+
+    // 0x4e49aa
+    // Track 8. Reversed 1. Direction 1
+    static constexpr PackedMoveInfo moveInfoT8R1D1[] = {
+        0x05204F50, 0x05204E51, 0x05204D52, 0x05204C53, 0x05204B53, 0x05204A54, 0x05204955, 0x05604856,
+        0x05604757, 0x05604658, 0x05604558, 0x05604459, 0x0560435A, 0x0560425B, 0x0560415B, 0x0560405C,
+        0x05603F5D, 0x05603E5D, 0x05603D5E, 0x05603C5F, 0x05603B5F, 0x05603A60, 0x05603961, 0x05603861,
+        0x05603762, 0x05603662, 0x05A03563, 0x05A03463, 0x05A03364, 0x05A03264, 0x05A03165, 0x05A03065,
+        0x05A02F66, 0x05A02E66, 0x05A02D67, 0x05A02C67, 0x05A02B67, 0x05A02A68, 0x05A02968, 0x05A02868,
+        0x05A02769, 0x05A02669, 0x05A02569, 0x05A0246A, 0x05A0236A, 0x05A0226A, 0x05E0216A, 0x05E0206B,
+        0x05E01F6B, 0x05E01E6B, 0x05E01D6B, 0x05E01C6C, 0x05E01B6C, 0x05E01A6C, 0x05E0196C, 0x05E0186C,
+        0x05E0176D, 0x05E0166D, 0x05E0156D, 0x05E0146D, 0x05E0136D, 0x05E0126E, 0x05E0116E, 0x05E0106E,
+        0x05E00F6E, 0x05E00E6E, 0x06200D6F, 0x06200C6F, 0x06200B6F, 0x06200A6F, 0x0620096F, 0x0620086F,
+        0x0620076F, 0x0620066F, 0x0620056F, 0x0620046F, 0x0620036F, 0x0620026F, 0x0620016F, 0x0620006F,
+    };
+
+    // 0x4e4c2c
+    // Track 8. Reversed 1. Direction 2
+    static constexpr PackedMoveInfo moveInfoT8R1D2[] = {
+        0x07204F4F, 0x07204E4E, 0x07204D4D, 0x07204C4C, 0x07204C4B, 0x07204B4A, 0x07204A49, 0x07604948,
+        0x07604847, 0x07604746, 0x07604745, 0x07604644, 0x07604543, 0x07604442, 0x07604441, 0x07604340,
+        0x0760423F, 0x0760423E, 0x0760413D, 0x0760403C, 0x0760403B, 0x07603F3A, 0x07603E39, 0x07603E38,
+        0x07603D37, 0x07603D36, 0x07A03C35, 0x07A03C34, 0x07A03B33, 0x07A03B32, 0x07A03A31, 0x07A03A30,
+        0x07A0392F, 0x07A0392E, 0x07A0382D, 0x07A0382C, 0x07A0382B, 0x07A0372A, 0x07A03729, 0x07A03728,
+        0x07A03627, 0x07A03626, 0x07A03625, 0x07A03524, 0x07A03523, 0x07A03522, 0x07E03521, 0x07E03420,
+        0x07E0341F, 0x07E0341E, 0x07E0341D, 0x07E0331C, 0x07E0331B, 0x07E0331A, 0x07E03319, 0x07E03318,
+        0x07E03217, 0x07E03216, 0x07E03215, 0x07E03214, 0x07E03213, 0x07E03112, 0x07E03111, 0x07E03110,
+        0x07E0310F, 0x07E0310E, 0x0020300D, 0x0020300C, 0x0020300B, 0x0020300A, 0x00203009, 0x00203008,
+        0x00203007, 0x00203006, 0x00203005, 0x00203004, 0x00203003, 0x00203002, 0x00203001, 0x00203000,
+    };
+
+    // 0x4e44ae
+    // Track 8. Reversed 1. Direction 3
+    static constexpr PackedMoveInfo moveInfoT8R1D3[] = {
+        0x0120514F, 0x0120524E, 0x0120534D, 0x0120544C, 0x0120554C, 0x0120564B, 0x0120574A, 0x01605849,
+        0x01605948, 0x01605A47, 0x01605B47, 0x01605C46, 0x01605D45, 0x01605E44, 0x01605F44, 0x01606043,
+        0x01606142, 0x01606242, 0x01606341, 0x01606440, 0x01606540, 0x0160663F, 0x0160673E, 0x0160683E,
+        0x0160693D, 0x01606A3D, 0x01A06B3C, 0x01A06C3C, 0x01A06D3B, 0x01A06E3B, 0x01A06F3A, 0x01A0703A,
+        0x01A07139, 0x01A07239, 0x01A07338, 0x01A07438, 0x01A07538, 0x01A07637, 0x01A07737, 0x01A07837,
+        0x01A07936, 0x01A07A36, 0x01A07B36, 0x01A07C35, 0x01A07D35, 0x01A07E35, 0x01E07F35, 0x01E08034,
+        0x01E08134, 0x01E08234, 0x01E08334, 0x01E08433, 0x01E08533, 0x01E08633, 0x01E08733, 0x01E08833,
+        0x01E08932, 0x01E08A32, 0x01E08B32, 0x01E08C32, 0x01E08D32, 0x01E08E31, 0x01E08F31, 0x01E09031,
+        0x01E09131, 0x01E09231, 0x02209330, 0x02209430, 0x02209530, 0x02209630, 0x02209730, 0x02209830,
+        0x02209930, 0x02209A30, 0x02209B30, 0x02209C30, 0x02209D30, 0x02209E30, 0x02209F30,
+    };
+
+    // 0x4e3aa6
+    // Track 9. Reversed 0. Direction 0
+    static constexpr PackedMoveInfo moveInfoT9R0D0[] = {
+        0x0020505F, 0x0020505E, 0x0020505D, 0x0020505C, 0x0020505B, 0x0020505A, 0x00205059, 0x00205058,
+        0x00205057, 0x00205056, 0x00605055, 0x00605054, 0x00605053, 0x00605052, 0x00605151, 0x00605150,
+        0x0060514F, 0x0060514E, 0x0060514D, 0x0060524C, 0x0060524B, 0x0060524A, 0x00605249, 0x00605248,
+        0x00605347, 0x00605346, 0x00605345, 0x00605344, 0x00605343, 0x00605442, 0x00605441, 0x00A05440,
+        0x00A0543F, 0x00A0553E, 0x00A0553D, 0x00A0553C, 0x00A0553B, 0x00A0563A, 0x00A05639, 0x00A05638,
+        0x00A05737, 0x00A05736, 0x00A05735, 0x00A05834, 0x00A05833, 0x00A05832, 0x00A05931, 0x00A05930,
+        0x00A05A2F, 0x00A05A2E, 0x00A05B2D, 0x00A05B2C, 0x00E05C2B, 0x00E05C2A, 0x00E05D29, 0x00E05D28,
+        0x00E05E27, 0x00E05E26, 0x00E05F25, 0x00E06024, 0x00E06023, 0x00E06122, 0x00E06221, 0x00E06220,
+        0x00E0631F, 0x00E0641E, 0x00E0641D, 0x00E0651C, 0x00E0661B, 0x00E0671A, 0x01206719, 0x01206818,
+        0x01206917, 0x01206A16, 0x01206B15, 0x01206C14, 0x01206C13, 0x01206D12, 0x01206E11, 0x01206F10,
+    };
+
+    // 0x4e3d28
+    // Track 9. Reversed 0. Direction 1
+    static constexpr PackedMoveInfo moveInfoT9R0D1[] = {
+        0x02204050, 0x02204150, 0x02204250, 0x02204350, 0x02204450, 0x02204550, 0x02204650, 0x02204750,
+        0x02204850, 0x02204950, 0x02204A50, 0x02604B50, 0x02604C50, 0x02604D50, 0x02604E51, 0x02604F51,
+        0x02605051, 0x02605151, 0x02605251, 0x02605352, 0x02605452, 0x02605552, 0x02605652, 0x02605752,
+        0x02605853, 0x02605953, 0x02605A53, 0x02605B53, 0x02605C53, 0x02605D54, 0x02605E54, 0x02605F54,
+        0x02A06054, 0x02A06155, 0x02A06255, 0x02A06355, 0x02A06455, 0x02A06556, 0x02A06656, 0x02A06756,
+        0x02A06857, 0x02A06957, 0x02A06A57, 0x02A06B58, 0x02A06C58, 0x02A06D58, 0x02A06E59, 0x02A06F59,
+        0x02A0705A, 0x02A0715A, 0x02A0725B, 0x02A0735B, 0x02A0745C, 0x02E0755C, 0x02E0765D, 0x02E0775D,
+        0x02E0785E, 0x02E0795E, 0x02E07A5F, 0x02E07B60, 0x02E07C60, 0x02E07D61, 0x02E07E62, 0x02E07F62,
+        0x02E08063, 0x02E08164, 0x02E08264, 0x02E08365, 0x02E08466, 0x02E08567, 0x02E08667, 0x03208768,
+        0x03208869, 0x0320896A, 0x03208A6B, 0x03208B6C, 0x03208C6C, 0x03208D6D, 0x03208E6E, 0x03208F6F,
+    };
+
+    // 0x4e3faa
+    // Track 9. Reversed 0. Direction 2
+    static constexpr PackedMoveInfo moveInfoT9R0D2[] = {
+        0x04205040, 0x04205041, 0x04205042, 0x04205043, 0x04205044, 0x04205045, 0x04205046, 0x04205047,
+        0x04205048, 0x04205049, 0x0420504A, 0x0460504B, 0x0460504C, 0x04604F4D, 0x04604F4E, 0x04604F4F,
+        0x04604F50, 0x04604F51, 0x04604E52, 0x04604E53, 0x04604E54, 0x04604E55, 0x04604E56, 0x04604D57,
+        0x04604D58, 0x04604D59, 0x04604D5A, 0x04604D5B, 0x04604C5C, 0x04604C5D, 0x04604C5E, 0x04604C5F,
+        0x04A04B60, 0x04A04B61, 0x04A04B62, 0x04A04B63, 0x04A04A64, 0x04A04A65, 0x04A04A66, 0x04A04967,
+        0x04A04968, 0x04A04969, 0x04A0486A, 0x04A0486B, 0x04A0486C, 0x04A0476D, 0x04A0476E, 0x04A0466F,
+        0x04A04670, 0x04A04571, 0x04A04572, 0x04A04473, 0x04A04474, 0x04E04375, 0x04E04376, 0x04E04277,
+        0x04E04278, 0x04E04179, 0x04E0407A, 0x04E0407B, 0x04E03F7C, 0x04E03E7D, 0x04E03E7E, 0x04E03D7F,
+        0x04E03C80, 0x04E03C81, 0x04E03B82, 0x04E03A83, 0x04E03984, 0x04E03985, 0x04E03886, 0x05203787,
+        0x05203688, 0x05203589, 0x0520348A, 0x0520348B, 0x0520338C, 0x0520328D, 0x0520318E, 0x0520308F,
+    };
+
+    // 0x4e422c
+    // Track 9. Reversed 0. Direction 3
+    static constexpr PackedMoveInfo moveInfoT9R0D3[] = {
+        0x06205F50, 0x06205E50, 0x06205D50, 0x06205C50, 0x06205B50, 0x06205A50, 0x06205950, 0x06205850,
+        0x06205750, 0x06205650, 0x06605550, 0x06605450, 0x06605350, 0x0660524F, 0x0660514F, 0x0660504F,
+        0x06604F4F, 0x06604E4F, 0x06604D4E, 0x06604C4E, 0x06604B4E, 0x06604A4E, 0x0660494E, 0x0660484D,
+        0x0660474D, 0x0660464D, 0x0660454D, 0x0660444D, 0x0660434C, 0x0660424C, 0x0660414C, 0x06A0404C,
+        0x06A03F4B, 0x06A03E4B, 0x06A03D4B, 0x06A03C4B, 0x06A03B4A, 0x06A03A4A, 0x06A0394A, 0x06A03849,
+        0x06A03749, 0x06A03649, 0x06A03548, 0x06A03448, 0x06A03348, 0x06A03247, 0x06A03147, 0x06A03046,
+        0x06A02F46, 0x06A02E45, 0x06A02D45, 0x06A02C44, 0x06E02B44, 0x06E02A43, 0x06E02943, 0x06E02842,
+        0x06E02742, 0x06E02641, 0x06E02540, 0x06E02440, 0x06E0233F, 0x06E0223E, 0x06E0213E, 0x06E0203D,
+        0x06E01F3C, 0x06E01E3C, 0x06E01D3B, 0x06E01C3A, 0x06E01B39, 0x06E01A39, 0x07201938, 0x07201837,
+        0x07201736, 0x07201635, 0x07201534, 0x07201434, 0x07201333, 0x07201232, 0x07201131, 0x07201030,
+    };
+
+    // 0x4e35a2
+    // Track 9. Reversed 1. Direction 0
+    static constexpr PackedMoveInfo moveInfoT9R1D0[] = {
+        0x05204F50, 0x05204E51, 0x05204D52, 0x05204C53, 0x05204C54, 0x05204B55, 0x05204A56, 0x04E04957,
+        0x04E04858, 0x04E04759, 0x04E0475A, 0x04E0465B, 0x04E0455C, 0x04E0445D, 0x04E0445E, 0x04E0435F,
+        0x04E04260, 0x04E04261, 0x04E04162, 0x04E04063, 0x04E04064, 0x04E03F65, 0x04E03E66, 0x04E03E67,
+        0x04E03D68, 0x04E03D69, 0x04A03C6A, 0x04A03C6B, 0x04A03B6C, 0x04A03B6D, 0x04A03A6E, 0x04A03A6F,
+        0x04A03970, 0x04A03971, 0x04A03872, 0x04A03873, 0x04A03874, 0x04A03775, 0x04A03776, 0x04A03777,
+        0x04A03678, 0x04A03679, 0x04A0367A, 0x04A0357B, 0x04A0357C, 0x04A0357D, 0x0460357E, 0x0460347F,
+        0x04603480, 0x04603481, 0x04603482, 0x04603383, 0x04603384, 0x04603385, 0x04603386, 0x04603387,
+        0x04603288, 0x04603289, 0x0460328A, 0x0460328B, 0x0460328C, 0x0460318D, 0x0460318E, 0x0460318F,
+        0x04603190, 0x04603191, 0x04203092, 0x04203093, 0x04203094, 0x04203095, 0x04203096, 0x04203097,
+        0x04203098, 0x04203099, 0x0420309A, 0x0420309B, 0x0420309C, 0x0420309D, 0x0420309E, 0x0420309F,
+    };
+
+    // 0x4e3824
+    // Track 9. Reversed 1. Direction 1
+    static constexpr PackedMoveInfo moveInfoT9R1D1[] = {
+        0x07204F4F, 0x07204E4E, 0x07204D4D, 0x07204C4C, 0x07204B4C, 0x07204A4B, 0x0720494A, 0x06E04849,
+        0x06E04748, 0x06E04647, 0x06E04547, 0x06E04446, 0x06E04345, 0x06E04244, 0x06E04144, 0x06E04043,
+        0x06E03F42, 0x06E03E42, 0x06E03D41, 0x06E03C40, 0x06E03B40, 0x06E03A3F, 0x06E0393E, 0x06E0383E,
+        0x06E0373D, 0x06E0363D, 0x06A0353C, 0x06A0343C, 0x06A0333B, 0x06A0323B, 0x06A0313A, 0x06A0303A,
+        0x06A02F39, 0x06A02E39, 0x06A02D38, 0x06A02C38, 0x06A02B38, 0x06A02A37, 0x06A02937, 0x06A02837,
+        0x06A02736, 0x06A02636, 0x06A02536, 0x06A02435, 0x06A02335, 0x06A02235, 0x06602135, 0x06602034,
+        0x06601F34, 0x06601E34, 0x06601D34, 0x06601C33, 0x06601B33, 0x06601A33, 0x06601933, 0x06601833,
+        0x06601732, 0x06601632, 0x06601532, 0x06601432, 0x06601332, 0x06601231, 0x06601131, 0x06601031,
+        0x06600F31, 0x06600E31, 0x06200D30, 0x06200C30, 0x06200B30, 0x06200A30, 0x06200930, 0x06200830,
+        0x06200730, 0x06200630, 0x06200530, 0x06200430, 0x06200330, 0x06200230, 0x06200130, 0x06200030,
+    };
+
+    // 0x4e30a6
+    // Track 9. Reversed 1. Direction 2
+    static constexpr PackedMoveInfo moveInfoT9R1D2[] = {
+        0x0120514F, 0x0120524E, 0x0120534D, 0x0120544C, 0x0120544B, 0x0120554A, 0x01205649, 0x00E05748,
+        0x00E05847, 0x00E05946, 0x00E05945, 0x00E05A44, 0x00E05B43, 0x00E05C42, 0x00E05C41, 0x00E05D40,
+        0x00E05E3F, 0x00E05E3E, 0x00E05F3D, 0x00E0603C, 0x00E0603B, 0x00E0613A, 0x00E06239, 0x00E06238,
+        0x00E06337, 0x00E06336, 0x00A06435, 0x00A06434, 0x00A06533, 0x00A06532, 0x00A06631, 0x00A06630,
+        0x00A0672F, 0x00A0672E, 0x00A0682D, 0x00A0682C, 0x00A0682B, 0x00A0692A, 0x00A06929, 0x00A06928,
+        0x00A06A27, 0x00A06A26, 0x00A06A25, 0x00A06B24, 0x00A06B23, 0x00A06B22, 0x00606B21, 0x00606C20,
+        0x00606C1F, 0x00606C1E, 0x00606C1D, 0x00606D1C, 0x00606D1B, 0x00606D1A, 0x00606D19, 0x00606D18,
+        0x00606E17, 0x00606E16, 0x00606E15, 0x00606E14, 0x00606E13, 0x00606F12, 0x00606F11, 0x00606F10,
+        0x00606F0F, 0x00606F0E, 0x0020700D, 0x0020700C, 0x0020700B, 0x0020700A, 0x00207009, 0x00207008,
+        0x00207007, 0x00207006, 0x00207005, 0x00207004, 0x00207003, 0x00207002, 0x00207001,
+    };
+
+    // 0x4e3320
+    // Track 9. Reversed 1. Direction 3
+    static constexpr PackedMoveInfo moveInfoT9R1D3[] = {
+        0x03205050, 0x03205151, 0x03205252, 0x03205353, 0x03205454, 0x03205554, 0x03205655, 0x03205756,
+        0x02E05857, 0x02E05958, 0x02E05A59, 0x02E05B59, 0x02E05C5A, 0x02E05D5B, 0x02E05E5C, 0x02E05F5C,
+        0x02E0605D, 0x02E0615E, 0x02E0625E, 0x02E0635F, 0x02E06460, 0x02E06560, 0x02E06661, 0x02E06762,
+        0x02E06862, 0x02E06963, 0x02E06A63, 0x02A06B64, 0x02A06C64, 0x02A06D65, 0x02A06E65, 0x02A06F66,
+        0x02A07066, 0x02A07167, 0x02A07267, 0x02A07368, 0x02A07468, 0x02A07568, 0x02A07669, 0x02A07769,
+        0x02A07869, 0x02A0796A, 0x02A07A6A, 0x02A07B6A, 0x02A07C6B, 0x02A07D6B, 0x02A07E6B, 0x02607F6B,
+        0x0260806C, 0x0260816C, 0x0260826C, 0x0260836C, 0x0260846D, 0x0260856D, 0x0260866D, 0x0260876D,
+        0x0260886D, 0x0260896E, 0x02608A6E, 0x02608B6E, 0x02608C6E, 0x02608D6E, 0x02608E6F, 0x02608F6F,
+        0x0260906F, 0x0260916F, 0x0260926F, 0x02209370, 0x02209470, 0x02209570, 0x02209670, 0x02209770,
+        0x02209870, 0x02209970, 0x02209A70, 0x02209B70, 0x02209C70, 0x02209D70, 0x02209E70, 0x02209F70,
+    };
+
+    // 0x4e4eae
+    // Track 12. Reversed 0. Direction 0
+    static constexpr PackedMoveInfo moveInfoT12R0D0[] = {
+        0x00205060, 0x0020505F, 0x0020505E, 0x0020505D, 0x0020505C, 0x0020505B, 0x0020505A, 0x00205059,
+        0x07E05058, 0x07E04F57, 0x07E04F56, 0x07E04F55, 0x07E04F54, 0x07E04F53, 0x07E04F52, 0x07E04E51,
+        0x07E04E50, 0x07E04E4F, 0x07E04E4E, 0x07E04E4D, 0x07E04D4C, 0x07E04D4B, 0x07E04D4A, 0x07E04D49,
+        0x07A04C48, 0x07A04C47, 0x07A04C46, 0x07A04B45, 0x07A04B44, 0x07A04B43, 0x07A04A42, 0x07A04A41,
+        0x07A04940, 0x07A0493F, 0x07A0483E, 0x07A0483D, 0x07A0473C, 0x0760473B, 0x0760463A, 0x07604639,
+        0x07604538, 0x07604437, 0x07604436, 0x07604335, 0x07604234, 0x07204233, 0x07204132, 0x07204031,
+        0x07204030, 0x07203F2F, 0x07203E2E, 0x07603E2D, 0x07603D2C, 0x07603C2B, 0x07603C2A, 0x07603B29,
+        0x07603A28, 0x07603A27, 0x07603926, 0x07603925, 0x07A03824, 0x07A03823, 0x07A03722, 0x07A03721,
+        0x07A03620, 0x07A0361F, 0x07A0351E, 0x07A0351D, 0x07A0351C, 0x07A0341B, 0x07A0341A, 0x07A03419,
+        0x07E03318, 0x07E03317, 0x07E03316, 0x07E03315, 0x07E03214, 0x07E03213, 0x07E03212, 0x07E03211,
+        0x07E03210, 0x07E0310F, 0x07E0310E, 0x07E0310D, 0x07E0310C, 0x07E0310B, 0x07E0310A, 0x07E03009,
+        0x00203008, 0x00203007, 0x00203006, 0x00203005, 0x00203004, 0x00203003, 0x00203002, 0x00203001,
+    };
+
+    // 0x4e51b0
+    // Track 12. Reversed 0. Direction 1
+    static constexpr PackedMoveInfo moveInfoT12R0D1[] = {
+        0x02204050, 0x02204150, 0x02204250, 0x02204350, 0x02204450, 0x02204550, 0x02204650, 0x02204750,
+        0x01E04850, 0x01E0494F, 0x01E04A4F, 0x01E04B4F, 0x01E04C4F, 0x01E04D4F, 0x01E04E4F, 0x01E04F4E,
+        0x01E0504E, 0x01E0514E, 0x01E0524E, 0x01E0534E, 0x01E0544D, 0x01E0554D, 0x01E0564D, 0x01E0574D,
+        0x01A0584C, 0x01A0594C, 0x01A05A4C, 0x01A05B4B, 0x01A05C4B, 0x01A05D4B, 0x01A05E4A, 0x01A05F4A,
+        0x01A06049, 0x01A06149, 0x01A06248, 0x01A06348, 0x01A06447, 0x01606547, 0x01606646, 0x01606746,
+        0x01606845, 0x01606944, 0x01606A44, 0x01606B43, 0x01606C42, 0x01206D42, 0x01206E41, 0x01206F40,
+        0x01207040, 0x0120713F, 0x0120723E, 0x0160733E, 0x0160743D, 0x0160753C, 0x0160763C, 0x0160773B,
+        0x0160783A, 0x0160793A, 0x01607A39, 0x01607B39, 0x01A07C38, 0x01A07D38, 0x01A07E37, 0x01A07F37,
+        0x01A08036, 0x01A08136, 0x01A08235, 0x01A08335, 0x01A08435, 0x01A08534, 0x01A08634, 0x01A08734,
+        0x01E08833, 0x01E08933, 0x01E08A33, 0x01E08B33, 0x01E08C32, 0x01E08D32, 0x01E08E32, 0x01E08F32,
+        0x01E09032, 0x01E09131, 0x01E09231, 0x01E09331, 0x01E09431, 0x01E09531, 0x01E09631, 0x01E09730,
+        0x02209830, 0x02209930, 0x02209A30, 0x02209B30, 0x02209C30, 0x02209D30, 0x02209E30, 0x02209F30,
+    };
+
+    // 0x4e54b2
+    // Track 12. Reversed 0. Direction 2
+    static constexpr PackedMoveInfo moveInfoT12R0D2[] = {
+        0x04205040, 0x04205041, 0x04205042, 0x04205043, 0x04205044, 0x04205045, 0x04205046, 0x04205047,
+        0x03E05048, 0x03E05149, 0x03E0514A, 0x03E0514B, 0x03E0514C, 0x03E0514D, 0x03E0514E, 0x03E0524F,
+        0x03E05250, 0x03E05251, 0x03E05252, 0x03E05253, 0x03E05354, 0x03E05355, 0x03E05356, 0x03E05357,
+        0x03A05458, 0x03A05459, 0x03A0545A, 0x03A0555B, 0x03A0555C, 0x03A0555D, 0x03A0565E, 0x03A0565F,
+        0x03A05760, 0x03A05761, 0x03A05862, 0x03A05863, 0x03A05964, 0x03605965, 0x03605A66, 0x03605A67,
+        0x03605B68, 0x03605C69, 0x03605C6A, 0x03605D6B, 0x03605E6C, 0x03205E6D, 0x03205F6E, 0x0320606F,
+        0x03206070, 0x03206171, 0x03206272, 0x03606273, 0x03606374, 0x03606475, 0x03606476, 0x03606577,
+        0x03606678, 0x03606679, 0x0360677A, 0x0360677B, 0x03A0687C, 0x03A0687D, 0x03A0697E, 0x03A0697F,
+        0x03A06A80, 0x03A06A81, 0x03A06B82, 0x03A06B83, 0x03A06B84, 0x03A06C85, 0x03A06C86, 0x03A06C87,
+        0x03E06D88, 0x03E06D89, 0x03E06D8A, 0x03E06D8B, 0x03E06E8C, 0x03E06E8D, 0x03E06E8E, 0x03E06E8F,
+        0x03E06E90, 0x03E06F91, 0x03E06F92, 0x03E06F93, 0x03E06F94, 0x03E06F95, 0x03E06F96, 0x03E07097,
+        0x04207098, 0x04207099, 0x0420709A, 0x0420709B, 0x0420709C, 0x0420709D, 0x0420709E, 0x0420709F,
+    };
+
+    // 0x4e57b4
+    // Track 12. Reversed 0. Direction 3
+    static constexpr PackedMoveInfo moveInfoT12R0D3[] = {
+        0x06206050, 0x06205F50, 0x06205E50, 0x06205D50, 0x06205C50, 0x06205B50, 0x06205A50, 0x06205950,
+        0x05E05850, 0x05E05751, 0x05E05651, 0x05E05551, 0x05E05451, 0x05E05351, 0x05E05251, 0x05E05152,
+        0x05E05052, 0x05E04F52, 0x05E04E52, 0x05E04D52, 0x05E04C53, 0x05E04B53, 0x05E04A53, 0x05E04953,
+        0x05A04854, 0x05A04754, 0x05A04654, 0x05A04555, 0x05A04455, 0x05A04355, 0x05A04256, 0x05A04156,
+        0x05A04057, 0x05A03F57, 0x05A03E58, 0x05A03D58, 0x05A03C59, 0x05603B59, 0x05603A5A, 0x0560395A,
+        0x0560385B, 0x0560375C, 0x0560365C, 0x0560355D, 0x0560345E, 0x0520335E, 0x0520325F, 0x05203160,
+        0x05203060, 0x05202F61, 0x05202E62, 0x05602D62, 0x05602C63, 0x05602B64, 0x05602A64, 0x05602965,
+        0x05602866, 0x05602766, 0x05602667, 0x05602567, 0x05A02468, 0x05A02368, 0x05A02269, 0x05A02169,
+        0x05A0206A, 0x05A01F6A, 0x05A01E6B, 0x05A01D6B, 0x05A01C6B, 0x05A01B6C, 0x05A01A6C, 0x05A0196C,
+        0x05E0186D, 0x05E0176D, 0x05E0166D, 0x05E0156D, 0x05E0146E, 0x05E0136E, 0x05E0126E, 0x05E0116E,
+        0x05E0106E, 0x05E00F6F, 0x05E00E6F, 0x05E00D6F, 0x05E00C6F, 0x05E00B6F, 0x05E00A6F, 0x05E00970,
+        0x06200870, 0x06200770, 0x06200670, 0x06200570, 0x06200470, 0x06200370, 0x06200270, 0x06200170,
+    };
+
+    // 0x4e5ab6
+    // Track 13. Reversed 0. Direction 0
+    static constexpr PackedMoveInfo moveInfoT13R0D0[] = {
+        0x00205060, 0x0020505F, 0x0020505E, 0x0020505D, 0x0020505C, 0x0020505B, 0x0020505A, 0x00205059,
+        0x00605058, 0x00605157, 0x00605156, 0x00605155, 0x00605154, 0x00605153, 0x00605152, 0x00605251,
+        0x00605250, 0x0060524F, 0x0060524E, 0x0060524D, 0x0060534C, 0x0060534B, 0x0060534A, 0x00605349,
+        0x00A05448, 0x00A05447, 0x00A05446, 0x00A05545, 0x00A05544, 0x00A05543, 0x00A05642, 0x00A05641,
+        0x00A05740, 0x00A0573F, 0x00A0583E, 0x00A0583D, 0x00A0593C, 0x0160593B, 0x01605A3A, 0x01605A39,
+        0x01605B38, 0x01605C37, 0x01605C36, 0x01605D35, 0x01605E34, 0x01205E33, 0x01205F32, 0x01206031,
+        0x01206030, 0x0120612F, 0x0120622E, 0x00E0622D, 0x00E0632C, 0x00E0642B, 0x00E0642A, 0x00E06529,
+        0x00E06628, 0x00E06627, 0x00E06726, 0x00E06725, 0x00A06824, 0x00A06823, 0x00A06922, 0x00A06921,
+        0x00A06A20, 0x00A06A1F, 0x00A06B1E, 0x00A06B1D, 0x00A06B1C, 0x00A06C1B, 0x00A06C1A, 0x00A06C19,
+        0x00606D18, 0x00606D17, 0x00606D16, 0x00606D15, 0x00606E14, 0x00606E13, 0x00606E12, 0x00606E11,
+        0x00606E10, 0x00606F0F, 0x00606F0E, 0x00606F0D, 0x00606F0C, 0x00606F0B, 0x00606F0A, 0x00607009,
+        0x00207008, 0x00207007, 0x00207006, 0x00207005, 0x00207004, 0x00207003, 0x00207002, 0x00207001,
+    };
+
+    // 0x4e5db8
+    // Track 13. Reversed 0. Direction 1
+    static constexpr PackedMoveInfo moveInfoT13R0D1[] = {
+        0x02204050, 0x02204150, 0x02204250, 0x02204350, 0x02204450, 0x02204550, 0x02204650, 0x02204750,
+        0x02604850, 0x02604951, 0x02604A51, 0x02604B51, 0x02604C51, 0x02604D51, 0x02604E51, 0x02604F52,
+        0x02605052, 0x02605152, 0x02605252, 0x02605352, 0x02605453, 0x02605553, 0x02605653, 0x02605753,
+        0x02A05854, 0x02A05954, 0x02A05A54, 0x02A05B55, 0x02A05C55, 0x02A05D55, 0x02A05E56, 0x02A05F56,
+        0x02A06057, 0x02A06157, 0x02A06258, 0x02A06358, 0x02A06459, 0x03606559, 0x0360665A, 0x0360675A,
+        0x0360685B, 0x0360695C, 0x03606A5C, 0x03606B5D, 0x03606C5E, 0x03206D5E, 0x03206E5F, 0x03206F60,
+        0x03207060, 0x03207161, 0x03207262, 0x02E07362, 0x02E07463, 0x02E07564, 0x02E07664, 0x02E07765,
+        0x02E07866, 0x02E07966, 0x02E07A67, 0x02E07B67, 0x02A07C68, 0x02A07D68, 0x02A07E69, 0x02A07F69,
+        0x02A0806A, 0x02A0816A, 0x02A0826B, 0x02A0836B, 0x02A0846B, 0x02A0856C, 0x02A0866C, 0x02A0876C,
+        0x0260886D, 0x0260896D, 0x02608A6D, 0x02608B6D, 0x02608C6E, 0x02608D6E, 0x02608E6E, 0x02608F6E,
+        0x0260906E, 0x0260916F, 0x0260926F, 0x0260936F, 0x0260946F, 0x0260956F, 0x0260966F, 0x02609770,
+        0x02209870, 0x02209970, 0x02209A70, 0x02209B70, 0x02209C70, 0x02209D70, 0x02209E70, 0x02209F70,
+    };
+
+    // 0x4e60ba
+    // Track 13. Reversed 0. Direction 2
+    static constexpr PackedMoveInfo moveInfoT13R0D2[] = {
+        0x04205040, 0x04205041, 0x04205042, 0x04205043, 0x04205044, 0x04205045, 0x04205046, 0x04205047,
+        0x04605048, 0x04604F49, 0x04604F4A, 0x04604F4B, 0x04604F4C, 0x04604F4D, 0x04604F4E, 0x04604E4F,
+        0x04604E50, 0x04604E51, 0x04604E52, 0x04604E53, 0x04604D54, 0x04604D55, 0x04604D56, 0x04604D57,
+        0x04A04C58, 0x04A04C59, 0x04A04C5A, 0x04A04B5B, 0x04A04B5C, 0x04A04B5D, 0x04A04A5E, 0x04A04A5F,
+        0x04A04960, 0x04A04961, 0x04A04862, 0x04A04863, 0x04A04764, 0x05604765, 0x05604666, 0x05604667,
+        0x05604568, 0x05604469, 0x0560446A, 0x0560436B, 0x0560426C, 0x0520426D, 0x0520416E, 0x0520406F,
+        0x05204070, 0x05203F71, 0x05203E72, 0x04E03E73, 0x04E03D74, 0x04E03C75, 0x04E03C76, 0x04E03B77,
+        0x04E03A78, 0x04E03A79, 0x04E0397A, 0x04E0397B, 0x04A0387C, 0x04A0387D, 0x04A0377E, 0x04A0377F,
+        0x04A03680, 0x04A03681, 0x04A03582, 0x04A03583, 0x04A03584, 0x04A03485, 0x04A03486, 0x04A03487,
+        0x04603388, 0x04603389, 0x0460338A, 0x0460338B, 0x0460328C, 0x0460328D, 0x0460328E, 0x0460328F,
+        0x04603290, 0x04603191, 0x04603192, 0x04603193, 0x04603194, 0x04603195, 0x04603196, 0x04603097,
+        0x04203098, 0x04203099, 0x0420309A, 0x0420309B, 0x0420309C, 0x0420309D, 0x0420309E, 0x0420309F,
+    };
+
+    // 0x4e63bc
+    // Track 13. Reversed 0. Direction 3
+    static constexpr PackedMoveInfo moveInfoT13R0D3[] = {
+        0x06206050, 0x06205F50, 0x06205E50, 0x06205D50, 0x06205C50, 0x06205B50, 0x06205A50, 0x06205950,
+        0x06605850, 0x0660574F, 0x0660564F, 0x0660554F, 0x0660544F, 0x0660534F, 0x0660524F, 0x0660514E,
+        0x0660504E, 0x06604F4E, 0x06604E4E, 0x06604D4E, 0x06604C4D, 0x06604B4D, 0x06604A4D, 0x0660494D,
+        0x06A0484C, 0x06A0474C, 0x06A0464C, 0x06A0454B, 0x06A0444B, 0x06A0434B, 0x06A0424A, 0x06A0414A,
+        0x06A04049, 0x06A03F49, 0x06A03E48, 0x06A03D48, 0x06A03C47, 0x07603B47, 0x07603A46, 0x07603946,
+        0x07603845, 0x07603744, 0x07603644, 0x07603543, 0x07603442, 0x07203342, 0x07203241, 0x07203140,
+        0x07203040, 0x07202F3F, 0x07202E3E, 0x06E02D3E, 0x06E02C3D, 0x06E02B3C, 0x06E02A3C, 0x06E0293B,
+        0x06E0283A, 0x06E0273A, 0x06E02639, 0x06E02539, 0x06A02438, 0x06A02338, 0x06A02237, 0x06A02137,
+        0x06A02036, 0x06A01F36, 0x06A01E35, 0x06A01D35, 0x06A01C35, 0x06A01B34, 0x06A01A34, 0x06A01934,
+        0x06601833, 0x06601733, 0x06601633, 0x06601533, 0x06601432, 0x06601332, 0x06601232, 0x06601132,
+        0x06601032, 0x06600F31, 0x06600E31, 0x06600D31, 0x06600C31, 0x06600B31, 0x06600A31, 0x06600930,
+        0x06200830, 0x06200730, 0x06200630, 0x06200530, 0x06200430, 0x06200330, 0x06200230, 0x06200130,
+    };
+
+    // 0x4da92e
+    // Track 14. Reversed 0. Direction 0
+    static constexpr PackedMoveInfo moveInfoT14R0D0[] = {
+        0x1020505F, 0x1020505E, 0x1020505D, 0x1020505C, 0x1021505B, 0x1021505A, 0x10215059, 0x10215058,
+        0x10225057, 0x10225056, 0x10225055, 0x10225054, 0x10235053, 0x10235052, 0x10235051, 0x10235050,
+        0x1024504F, 0x1024504E, 0x1024504D, 0x1024504C, 0x1025504B, 0x1025504A, 0x10255049, 0x10255048,
+        0x10265047, 0x10265046, 0x10265045, 0x10265044, 0x10275043, 0x10275042, 0x10275041, 0x10275040,
+        0x1028503F, 0x1028503E, 0x1028503D, 0x1028503C, 0x1029503B, 0x1029503A, 0x10295039, 0x10295038,
+        0x102A5037, 0x102A5036, 0x102A5035, 0x102A5034, 0x102B5033, 0x102B5032, 0x102B5031, 0x102B5030,
+        0x102C502F, 0x102C502E, 0x102C502D, 0x102C502C, 0x102D502B, 0x102D502A, 0x102D5029, 0x102D5028,
+        0x102E5027, 0x102E5026, 0x102E5025, 0x102E5024, 0x102F5023, 0x102F5022, 0x102F5021, 0x102F5020,
+    };
+
+    // 0x4dab30
+    // Track 14. Reversed 0. Direction 1
+    static constexpr PackedMoveInfo moveInfoT14R0D1[] = {
+        0x12204050, 0x12204150, 0x12204250, 0x12204350, 0x12214450, 0x12214550, 0x12214650, 0x12214750,
+        0x12224850, 0x12224950, 0x12224A50, 0x12224B50, 0x12234C50, 0x12234D50, 0x12234E50, 0x12234F50,
+        0x12245050, 0x12245150, 0x12245250, 0x12245350, 0x12255450, 0x12255550, 0x12255650, 0x12255750,
+        0x12265850, 0x12265950, 0x12265A50, 0x12265B50, 0x12275C50, 0x12275D50, 0x12275E50, 0x12275F50,
+        0x12286050, 0x12286150, 0x12286250, 0x12286350, 0x12296450, 0x12296550, 0x12296650, 0x12296750,
+        0x122A6850, 0x122A6950, 0x122A6A50, 0x122A6B50, 0x122B6C50, 0x122B6D50, 0x122B6E50, 0x122B6F50,
+        0x122C7050, 0x122C7150, 0x122C7250, 0x122C7350, 0x122D7450, 0x122D7550, 0x122D7650, 0x122D7750,
+        0x122E7850, 0x122E7950, 0x122E7A50, 0x122E7B50, 0x122F7C50, 0x122F7D50, 0x122F7E50, 0x122F7F50,
+    };
+
+    // 0x4dad32
+    // Track 14. Reversed 0. Direction 2
+    static constexpr PackedMoveInfo moveInfoT14R0D2[] = {
+        0x14205040, 0x14205041, 0x14205042, 0x14205043, 0x14215044, 0x14215045, 0x14215046, 0x14215047,
+        0x14225048, 0x14225049, 0x1422504A, 0x1422504B, 0x1423504C, 0x1423504D, 0x1423504E, 0x1423504F,
+        0x14245050, 0x14245051, 0x14245052, 0x14245053, 0x14255054, 0x14255055, 0x14255056, 0x14255057,
+        0x14265058, 0x14265059, 0x1426505A, 0x1426505B, 0x1427505C, 0x1427505D, 0x1427505E, 0x1427505F,
+        0x14285060, 0x14285061, 0x14285062, 0x14285063, 0x14295064, 0x14295065, 0x14295066, 0x14295067,
+        0x142A5068, 0x142A5069, 0x142A506A, 0x142A506B, 0x142B506C, 0x142B506D, 0x142B506E, 0x142B506F,
+        0x142C5070, 0x142C5071, 0x142C5072, 0x142C5073, 0x142D5074, 0x142D5075, 0x142D5076, 0x142D5077,
+        0x142E5078, 0x142E5079, 0x142E507A, 0x142E507B, 0x142F507C, 0x142F507D, 0x142F507E, 0x142F507F,
+    };
+
+    // 0x4daf34
+    // Track 14. Reversed 0. Direction 3
+    static constexpr PackedMoveInfo moveInfoT14R0D3[] = {
+        0x16205F50, 0x16205E50, 0x16205D50, 0x16205C50, 0x16215B50, 0x16215A50, 0x16215950, 0x16215850,
+        0x16225750, 0x16225650, 0x16225550, 0x16225450, 0x16235350, 0x16235250, 0x16235150, 0x16235050,
+        0x16244F50, 0x16244E50, 0x16244D50, 0x16244C50, 0x16254B50, 0x16254A50, 0x16254950, 0x16254850,
+        0x16264750, 0x16264650, 0x16264550, 0x16264450, 0x16274350, 0x16274250, 0x16274150, 0x16274050,
+        0x16283F50, 0x16283E50, 0x16283D50, 0x16283C50, 0x16293B50, 0x16293A50, 0x16293950, 0x16293850,
+        0x162A3750, 0x162A3650, 0x162A3550, 0x162A3450, 0x162B3350, 0x162B3250, 0x162B3150, 0x162B3050,
+        0x162C2F50, 0x162C2E50, 0x162C2D50, 0x162C2C50, 0x162D2B50, 0x162D2A50, 0x162D2950, 0x162D2850,
+        0x162E2750, 0x162E2650, 0x162E2550, 0x162E2450, 0x162F2350, 0x162F2250, 0x162F2150, 0x162F2050,
+    };
+
+    // 0x4db53a
+    // Track 14. Reversed 1. Direction 0
+    static constexpr PackedMoveInfo moveInfoT14R1D0[] = {
+        0x34205040, 0x34205041, 0x34205042, 0x34205043, 0x341F5044, 0x341F5045, 0x341F5046, 0x341F5047,
+        0x341E5048, 0x341E5049, 0x341E504A, 0x341E504B, 0x341D504C, 0x341D504D, 0x341D504E, 0x341D504F,
+        0x341C5050, 0x341C5051, 0x341C5052, 0x341C5053, 0x341B5054, 0x341B5055, 0x341B5056, 0x341B5057,
+        0x341A5058, 0x341A5059, 0x341A505A, 0x341A505B, 0x3419505C, 0x3419505D, 0x3419505E, 0x3419505F,
+        0x34185060, 0x34185061, 0x34185062, 0x34185063, 0x34175064, 0x34175065, 0x34175066, 0x34175067,
+        0x34165068, 0x34165069, 0x3416506A, 0x3416506B, 0x3415506C, 0x3415506D, 0x3415506E, 0x3415506F,
+        0x34145070, 0x34145071, 0x34145072, 0x34145073, 0x34135074, 0x34135075, 0x34135076, 0x34135077,
+        0x34125078, 0x34125079, 0x3412507A, 0x3412507B, 0x3411507C, 0x3411507D, 0x3411507E, 0x3411507F,
+    };
+
+    // 0x4db73c
+    // Track 14. Reversed 1. Direction 1
+    static constexpr PackedMoveInfo moveInfoT14R1D1[] = {
+        0x36205F50, 0x36205E50, 0x36205D50, 0x36205C50, 0x361F5B50, 0x361F5A50, 0x361F5950, 0x361F5850,
+        0x361E5750, 0x361E5650, 0x361E5550, 0x361E5450, 0x361D5350, 0x361D5250, 0x361D5150, 0x361D5050,
+        0x361C4F50, 0x361C4E50, 0x361C4D50, 0x361C4C50, 0x361B4B50, 0x361B4A50, 0x361B4950, 0x361B4850,
+        0x361A4750, 0x361A4650, 0x361A4550, 0x361A4450, 0x36194350, 0x36194250, 0x36194150, 0x36194050,
+        0x36183F50, 0x36183E50, 0x36183D50, 0x36183C50, 0x36173B50, 0x36173A50, 0x36173950, 0x36173850,
+        0x36163750, 0x36163650, 0x36163550, 0x36163450, 0x36153350, 0x36153250, 0x36153150, 0x36153050,
+        0x36142F50, 0x36142E50, 0x36142D50, 0x36142C50, 0x36132B50, 0x36132A50, 0x36132950, 0x36132850,
+        0x36122750, 0x36122650, 0x36122550, 0x36122450, 0x36112350, 0x36112250, 0x36112150, 0x36112050,
+    };
+
+    // 0x4db136
+    // Track 14. Reversed 1. Direction 2
+    static constexpr PackedMoveInfo moveInfoT14R1D2[] = {
+        0x3020505F, 0x3020505E, 0x3020505D, 0x3020505C, 0x301F505B, 0x301F505A, 0x301F5059, 0x301F5058,
+        0x301E5057, 0x301E5056, 0x301E5055, 0x301E5054, 0x301D5053, 0x301D5052, 0x301D5051, 0x301D5050,
+        0x301C504F, 0x301C504E, 0x301C504D, 0x301C504C, 0x301B504B, 0x301B504A, 0x301B5049, 0x301B5048,
+        0x301A5047, 0x301A5046, 0x301A5045, 0x301A5044, 0x30195043, 0x30195042, 0x30195041, 0x30195040,
+        0x3018503F, 0x3018503E, 0x3018503D, 0x3018503C, 0x3017503B, 0x3017503A, 0x30175039, 0x30175038,
+        0x30165037, 0x30165036, 0x30165035, 0x30165034, 0x30155033, 0x30155032, 0x30155031, 0x30155030,
+        0x3014502F, 0x3014502E, 0x3014502D, 0x3014502C, 0x3013502B, 0x3013502A, 0x30135029, 0x30135028,
+        0x30125027, 0x30125026, 0x30125025, 0x30125024, 0x30115023, 0x30115022, 0x30115021, 0x30115020,
+    };
+
+    // 0x4db338
+    // Track 14. Reversed 1. Direction 3
+    static constexpr PackedMoveInfo moveInfoT14R1D3[] = {
+        0x32204050, 0x32204150, 0x32204250, 0x32204350, 0x321F4450, 0x321F4550, 0x321F4650, 0x321F4750,
+        0x321E4850, 0x321E4950, 0x321E4A50, 0x321E4B50, 0x321D4C50, 0x321D4D50, 0x321D4E50, 0x321D4F50,
+        0x321C5050, 0x321C5150, 0x321C5250, 0x321C5350, 0x321B5450, 0x321B5550, 0x321B5650, 0x321B5750,
+        0x321A5850, 0x321A5950, 0x321A5A50, 0x321A5B50, 0x32195C50, 0x32195D50, 0x32195E50, 0x32195F50,
+        0x32186050, 0x32186150, 0x32186250, 0x32186350, 0x32176450, 0x32176550, 0x32176650, 0x32176750,
+        0x32166850, 0x32166950, 0x32166A50, 0x32166B50, 0x32156C50, 0x32156D50, 0x32156E50, 0x32156F50,
+        0x32147050, 0x32147150, 0x32147250, 0x32147350, 0x32137450, 0x32137550, 0x32137650, 0x32137750,
+        0x32127850, 0x32127950, 0x32127A50, 0x32127B50, 0x32117C50, 0x32117D50, 0x32117E50, 0x32117F50,
+    };
+
+    // 0x4db93e
+    // Track 16. Reversed 0. Direction 0
+    static constexpr PackedMoveInfo moveInfoT16R0D0[] = {
+        0x2020505F, 0x2020505E, 0x2021505D, 0x2021505C, 0x2022505B, 0x2022505A, 0x20235059, 0x20235058,
+        0x20245057, 0x20245056, 0x20255055, 0x20255054, 0x20265053, 0x20265052, 0x20275051, 0x20275050,
+        0x2028504F, 0x2028504E, 0x2029504D, 0x2029504C, 0x202A504B, 0x202A504A, 0x202B5049, 0x202B5048,
+        0x202C5047, 0x202C5046, 0x202D5045, 0x202D5044, 0x202E5043, 0x202E5042, 0x202F5041, 0x202F5040,
+    };
+
+    // 0x4dba40
+    // Track 16. Reversed 0. Direction 1
+    static constexpr PackedMoveInfo moveInfoT16R0D1[] = {
+        0x22204050, 0x22204150, 0x22214250, 0x22214350, 0x22224450, 0x22224550, 0x22234650, 0x22234750,
+        0x22244850, 0x22244950, 0x22254A50, 0x22254B50, 0x22264C50, 0x22264D50, 0x22274E50, 0x22274F50,
+        0x22285050, 0x22285150, 0x22295250, 0x22295350, 0x222A5450, 0x222A5550, 0x222B5650, 0x222B5750,
+        0x222C5850, 0x222C5950, 0x222D5A50, 0x222D5B50, 0x222E5C50, 0x222E5D50, 0x222F5E50, 0x222F5F50,
+    };
+
+    // 0x4dbb42
+    // Track 16. Reversed 0. Direction 2
+    static constexpr PackedMoveInfo moveInfoT16R0D2[] = {
+        0x24205040, 0x24205041, 0x24215042, 0x24215043, 0x24225044, 0x24225045, 0x24235046, 0x24235047,
+        0x24245048, 0x24245049, 0x2425504A, 0x2425504B, 0x2426504C, 0x2426504D, 0x2427504E, 0x2427504F,
+        0x24285050, 0x24285051, 0x24295052, 0x24295053, 0x242A5054, 0x242A5055, 0x242B5056, 0x242B5057,
+        0x242C5058, 0x242C5059, 0x242D505A, 0x242D505B, 0x242E505C, 0x242E505D, 0x242F505E, 0x242F505F,
+    };
+
+    // 0x4dbc44
+    // Track 16. Reversed 0. Direction 3
+    static constexpr PackedMoveInfo moveInfoT16R0D3[] = {
+        0x26205F50, 0x26205E50, 0x26215D50, 0x26215C50, 0x26225B50, 0x26225A50, 0x26235950, 0x26235850,
+        0x26245750, 0x26245650, 0x26255550, 0x26255450, 0x26265350, 0x26265250, 0x26275150, 0x26275050,
+        0x26284F50, 0x26284E50, 0x26294D50, 0x26294C50, 0x262A4B50, 0x262A4A50, 0x262B4950, 0x262B4850,
+        0x262C4750, 0x262C4650, 0x262D4550, 0x262D4450, 0x262E4350, 0x262E4250, 0x262F4150, 0x262F4050,
+    };
+
+    // 0x4dbf4a
+    // Track 16. Reversed 1. Direction 0
+    static constexpr PackedMoveInfo moveInfoT16R1D0[] = {
+        0x44205040, 0x44205041, 0x441F5042, 0x441F5043, 0x441E5044, 0x441E5045, 0x441D5046, 0x441D5047,
+        0x441C5048, 0x441C5049, 0x441B504A, 0x441B504B, 0x441A504C, 0x441A504D, 0x4419504E, 0x4419504F,
+        0x44185050, 0x44185051, 0x44175052, 0x44175053, 0x44165054, 0x44165055, 0x44155056, 0x44155057,
+        0x44145058, 0x44145059, 0x4413505A, 0x4413505B, 0x4412505C, 0x4412505D, 0x4411505E, 0x4411505F,
+    };
+
+    // 0x4dc04c
+    // Track 16. Reversed 1. Direction 1
+    static constexpr PackedMoveInfo moveInfoT16R1D1[] = {
+        0x46205F50, 0x46205E50, 0x461F5D50, 0x461F5C50, 0x461E5B50, 0x461E5A50, 0x461D5950, 0x461D5850,
+        0x461C5750, 0x461C5650, 0x461B5550, 0x461B5450, 0x461A5350, 0x461A5250, 0x46195150, 0x46195050,
+        0x46184F50, 0x46184E50, 0x46174D50, 0x46174C50, 0x46164B50, 0x46164A50, 0x46154950, 0x46154850,
+        0x46144750, 0x46144650, 0x46134550, 0x46134450, 0x46124350, 0x46124250, 0x46114150, 0x46114050,
+    };
+
+    // 0x4dbd46
+    // Track 16. Reversed 1. Direction 2
+    static constexpr PackedMoveInfo moveInfoT16R1D2[] = {
+        0x4020505F, 0x4020505E, 0x401F505D, 0x401F505C, 0x401E505B, 0x401E505A, 0x401D5059, 0x401D5058,
+        0x401C5057, 0x401C5056, 0x401B5055, 0x401B5054, 0x401A5053, 0x401A5052, 0x40195051, 0x40195050,
+        0x4018504F, 0x4018504E, 0x4017504D, 0x4017504C, 0x4016504B, 0x4016504A, 0x40155049, 0x40155048,
+        0x40145047, 0x40145046, 0x40135045, 0x40135044, 0x40125043, 0x40125042, 0x40115041, 0x40115040,
+    };
+
+    // 0x4dbe48
+    // Track 16. Reversed 1. Direction 3
+    static constexpr PackedMoveInfo moveInfoT16R1D3[] = {
+        0x42204050, 0x42204150, 0x421F4250, 0x421F4350, 0x421E4450, 0x421E4550, 0x421D4650, 0x421D4750,
+        0x421C4850, 0x421C4950, 0x421B4A50, 0x421B4B50, 0x421A4C50, 0x421A4D50, 0x42194E50, 0x42194F50,
+        0x42185050, 0x42185150, 0x42175250, 0x42175350, 0x42165450, 0x42165550, 0x42155650, 0x42155750,
+        0x42145850, 0x42145950, 0x42135A50, 0x42135B50, 0x42125C50, 0x42125D50, 0x42115E50, 0x42115F50,
+    };
+
+    // 0x4e66be
+    // Track 18. Reversed 0. Direction 0
+    static constexpr PackedMoveInfo moveInfoT18R0D0[] = {
+        0x4820505F, 0x4820505E, 0x4820505D, 0x4820505C, 0x4FE1505B, 0x4FE1505A, 0x4FE14F59, 0x4FE14F58,
+        0x4FE14F57, 0x4FE24F56, 0x4FE24F55, 0x4FE24F54, 0x4FE24E53, 0x4FA24E52, 0x4FA34E51, 0x4FA34D50,
+        0x4FA34D4F, 0x4FA34D4E, 0x4FA44C4D, 0x4FA44C4C, 0x4FA44B4B, 0x4FA44B4A, 0x4F654A49, 0x4F654A48,
+        0x4F654947, 0x4F654946, 0x4F654845, 0x4F664744, 0x4F664743, 0x4F664642, 0x4F274541, 0x4F274440,
+        0x4F27433F, 0x4F27433D, 0x4F28423C, 0x4F28413B, 0x4F28403A, 0x4EE83F39, 0x4EE93E39, 0x4EE93D38,
+        0x4EE93C37, 0x4EE93B37, 0x4EEA3A36, 0x4EEA3936, 0x4EEA3835, 0x4EAA3735, 0x4EAB3634, 0x4EAB3534,
+        0x4EAB3433, 0x4EAB3333, 0x4EAC3233, 0x4EAC3132, 0x4EAC3032, 0x4EAC2F32, 0x4E6C2E31, 0x4E6D2D31,
+        0x4E6D2C31, 0x4E6D2B31, 0x4E6D2A31, 0x4E6E2931, 0x4E6E2830, 0x4E6E2730, 0x4E6E2630, 0x4E2E2530,
+        0x4E2F2430, 0x4E2F2330, 0x4E2F2230, 0x4E2F2130,
+    };
+
+    // 0x4e68e0
+    // Track 18. Reversed 0. Direction 1
+    static constexpr PackedMoveInfo moveInfoT18R0D1[] = {
+        0x4A204050, 0x4A204150, 0x4A204250, 0x4A204350, 0x4A204450, 0x49E14550, 0x49E14650, 0x49E1474F,
+        0x49E1484F, 0x49E1494F, 0x49E24A4F, 0x49E24B4F, 0x49E24C4F, 0x49E24D4E, 0x49A24E4E, 0x49A34F4E,
+        0x49A3504D, 0x49A3514D, 0x49A3524D, 0x49A4534C, 0x49A4544C, 0x49A4554B, 0x49A4564B, 0x4965574A,
+        0x4965584A, 0x49655949, 0x49655A49, 0x49655B48, 0x49665C47, 0x49665D47, 0x49665E46, 0x49275F45,
+        0x49276044, 0x49276143, 0x49276343, 0x49286442, 0x49286541, 0x49286640, 0x48E8673F, 0x48E9673E,
+        0x48E9683D, 0x48E9693C, 0x48E9693B, 0x48EA6A3A, 0x48EA6A39, 0x48EA6B38, 0x48AA6B37, 0x48AB6C36,
+        0x48AB6C35, 0x48AB6D34, 0x48AB6D33, 0x48AC6D32, 0x48AC6E31, 0x48AC6E30, 0x48AC6E2F, 0x486C6F2E,
+        0x486D6F2D, 0x486D6F2C, 0x486D6F2B, 0x486D6F2A, 0x486E6F29, 0x486E7028, 0x486E7027, 0x486E7026,
+        0x482E7025, 0x482F7024, 0x482F7023, 0x482F7022, 0x482F7021,
+    };
+
+    // 0x4e6b0a
+    // Track 18. Reversed 0. Direction 2
+    static constexpr PackedMoveInfo moveInfoT18R0D2[] = {
+        0x4C205040, 0x4C205041, 0x4C205042, 0x4C205043, 0x4C205044, 0x4BE15045, 0x4BE15046, 0x4BE15147,
+        0x4BE15148, 0x4BE15149, 0x4BE2514A, 0x4BE2514B, 0x4BE2514C, 0x4BE2524D, 0x4BA3524E, 0x4BA3524F,
+        0x4BA35350, 0x4BA35351, 0x4BA35352, 0x4BA45453, 0x4BA45454, 0x4BA45555, 0x4BA45556, 0x4B655657,
+        0x4B655658, 0x4B655759, 0x4B65575A, 0x4B66585B, 0x4B66595C, 0x4B66595D, 0x4B665A5E, 0x4B275B5F,
+        0x4B275C60, 0x4B275D61, 0x4B275D63, 0x4B285E64, 0x4B285F65, 0x4B286066, 0x4AE96167, 0x4AE96267,
+        0x4AE96368, 0x4AE96469, 0x4AEA6569, 0x4AEA666A, 0x4AEA676A, 0x4AEA686B, 0x4AAB696B, 0x4AAB6A6C,
+        0x4AAB6B6C, 0x4AAB6C6D, 0x4AAC6D6D, 0x4AAC6E6D, 0x4AAC6F6E, 0x4AAC706E, 0x4AAC716E, 0x4A6D726F,
+        0x4A6D736F, 0x4A6D746F, 0x4A6D756F, 0x4A6E766F, 0x4A6E776F, 0x4A6E7870, 0x4A6E7970, 0x4A6E7A70,
+        0x4A2F7B70, 0x4A2F7C70, 0x4A2F7D70, 0x4A2F7E70,
+    };
+
+    // 0x4e6d2c
+    // Track 18. Reversed 0. Direction 3
+    static constexpr PackedMoveInfo moveInfoT18R0D3[] = {
+        0x4E205F50, 0x4E205E50, 0x4E205D50, 0x4E205C50, 0x4DE15B50, 0x4DE15A50, 0x4DE15951, 0x4DE15851,
+        0x4DE15751, 0x4DE25651, 0x4DE25551, 0x4DE25451, 0x4DE25352, 0x4DA35252, 0x4DA35152, 0x4DA35053,
+        0x4DA34F53, 0x4DA34E53, 0x4DA44D54, 0x4DA44C54, 0x4DA44B55, 0x4DA44A55, 0x4D654956, 0x4D654856,
+        0x4D654757, 0x4D654657, 0x4D664558, 0x4D664459, 0x4D664359, 0x4D66425A, 0x4D27415B, 0x4D27405C,
+        0x4D273F5D, 0x4D273D5D, 0x4D283C5E, 0x4D283B5F, 0x4D283A60, 0x4CE93961, 0x4CE93962, 0x4CE93863,
+        0x4CE93764, 0x4CEA3765, 0x4CEA3666, 0x4CEA3667, 0x4CEA3568, 0x4CAB3569, 0x4CAB346A, 0x4CAB346B,
+        0x4CAB336C, 0x4CAC336D, 0x4CAC336E, 0x4CAC326F, 0x4CAC3270, 0x4CAC3271, 0x4C6D3172, 0x4C6D3173,
+        0x4C6D3174, 0x4C6D3175, 0x4C6E3176, 0x4C6E3177, 0x4C6E3078, 0x4C6E3079, 0x4C6E307A, 0x4C2F307B,
+        0x4C2F307C, 0x4C2F307D, 0x4C2F307E,
+    };
+
+    // 0x4e8270
+    // Track 18. Reversed 1. Direction 0
+    static constexpr PackedMoveInfo moveInfoT18R1D0[] = {
+        0x52204050, 0x52204150, 0x52204250, 0x52204350, 0x52204450, 0x525F4550, 0x525F4650, 0x525F4751,
+        0x525F4851, 0x525F4951, 0x525E4A51, 0x525E4B51, 0x525E4C51, 0x525E4D52, 0x529D4E52, 0x529D4F52,
+        0x529D5053, 0x529D5153, 0x529D5253, 0x529C5354, 0x529C5454, 0x529C5555, 0x529C5655, 0x52DB5756,
+        0x52DB5856, 0x52DB5957, 0x52DB5A57, 0x52DA5B58, 0x52DA5C59, 0x52DA5D59, 0x52DA5E5A, 0x53195F5B,
+        0x5319605C, 0x5319615D, 0x5318635D, 0x5318645E, 0x5318655F, 0x53186660, 0x53576761, 0x53576762,
+        0x53576863, 0x53576964, 0x53566965, 0x53566A66, 0x53566A67, 0x53566B68, 0x53956B69, 0x53956C6A,
+        0x53956C6B, 0x53956D6C, 0x53946D6D, 0x53946D6E, 0x53946E6F, 0x53946E70, 0x53946E71, 0x53D36F72,
+        0x53D36F73, 0x53D36F74, 0x53D36F75, 0x53D26F76, 0x53D26F77, 0x53D27078, 0x53D27079, 0x53D2707A,
+        0x5411707B, 0x5411707C, 0x5411707D, 0x5411707E,
+    };
+
+    // 0x4e8492
+    // Track 18. Reversed 1. Direction 1
+    static constexpr PackedMoveInfo moveInfoT18R1D1[] = {
+        0x54205040, 0x54205041, 0x54205042, 0x54205043, 0x54205044, 0x545F5045, 0x545F5046, 0x545F4F47,
+        0x545F4F48, 0x545F4F49, 0x545E4F4A, 0x545E4F4B, 0x545E4F4C, 0x545E4E4D, 0x549E4E4E, 0x549D4E4F,
+        0x549D4D50, 0x549D4D51, 0x549D4D52, 0x549C4C53, 0x549C4C54, 0x549C4B55, 0x549C4B56, 0x54DB4A57,
+        0x54DB4A58, 0x54DB4959, 0x54DB495A, 0x54DB485B, 0x54DA475C, 0x54DA475D, 0x54DA465E, 0x5519455F,
+        0x55194460, 0x55194361, 0x55194363, 0x55184264, 0x55184165, 0x55184066, 0x55583F67, 0x55573E67,
+        0x55573D68, 0x55573C69, 0x55573B69, 0x55563A6A, 0x5556396A, 0x5556386B, 0x5596376B, 0x5595366C,
+        0x5595356C, 0x5595346D, 0x5595336D, 0x5594326D, 0x5594316E, 0x5594306E, 0x55942F6E, 0x55D42E6F,
+        0x55D32D6F, 0x55D32C6F, 0x55D32B6F, 0x55D32A6F, 0x55D2296F, 0x55D22870, 0x55D22770, 0x55D22670,
+        0x56122570, 0x56112470, 0x56112370, 0x56112270, 0x56112170,
+    };
+
+    // 0x4e86bc
+    // Track 18. Reversed 1. Direction 2
+    static constexpr PackedMoveInfo moveInfoT18R1D2[] = {
+        0x56205F50, 0x56205E50, 0x56205D50, 0x56205C50, 0x565F5B50, 0x565F5A50, 0x565F594F, 0x565F584F,
+        0x565F574F, 0x565E564F, 0x565E554F, 0x565E544F, 0x565E534E, 0x569E524E, 0x569D514E, 0x569D504D,
+        0x569D4F4D, 0x569D4E4D, 0x569C4D4C, 0x569C4C4C, 0x569C4B4B, 0x569C4A4B, 0x56DB494A, 0x56DB484A,
+        0x56DB4749, 0x56DB4649, 0x56DB4548, 0x56DA4447, 0x56DA4347, 0x56DA4246, 0x57194145, 0x57194044,
+        0x57193F43, 0x57193D43, 0x57183C42, 0x57183B41, 0x57183A40, 0x5758393F, 0x5757393E, 0x5757383D,
+        0x5757373C, 0x5757373B, 0x5756363A, 0x57563639, 0x57563538, 0x57963537, 0x57953436, 0x57953435,
+        0x57953334, 0x57953333, 0x57943332, 0x57943231, 0x57943230, 0x5794322F, 0x57D4312E, 0x57D3312D,
+        0x57D3312C, 0x57D3312B, 0x57D3312A, 0x57D23129, 0x57D23028, 0x57D23027, 0x57D23026, 0x50123025,
+        0x50113024, 0x50113023, 0x50113022, 0x50113021,
+    };
+
+    // 0x4e8056
+    // Track 18. Reversed 1. Direction 3
+    static constexpr PackedMoveInfo moveInfoT18R1D3[] = {
+        0x5020505F, 0x5020505E, 0x5020505D, 0x5020505C, 0x505F505B, 0x505F505A, 0x505F5159, 0x505F5158,
+        0x505F5157, 0x505E5156, 0x505E5155, 0x505E5154, 0x505E5253, 0x509D5252, 0x509D5251, 0x509D5350,
+        0x509D534F, 0x509D534E, 0x509C544D, 0x509C544C, 0x509C554B, 0x509C554A, 0x50DB5649, 0x50DB5648,
+        0x50DB5747, 0x50DB5746, 0x50DA5845, 0x50DA5944, 0x50DA5943, 0x50DA5A42, 0x51195B41, 0x51195C40,
+        0x51195D3F, 0x51185D3D, 0x51185E3C, 0x51185F3B, 0x5118603A, 0x51576139, 0x51576239, 0x51576338,
+        0x51576437, 0x51566537, 0x51566636, 0x51566736, 0x51566835, 0x51956935, 0x51956A34, 0x51956B34,
+        0x51956C33, 0x51946D33, 0x51946E33, 0x51946F32, 0x51947032, 0x51947132, 0x51D37231, 0x51D37331,
+        0x51D37431, 0x51D37531, 0x51D27631, 0x51D27731, 0x51D27830, 0x51D27930, 0x51D27A30, 0x52117B30,
+        0x52117C30, 0x52117D30, 0x52117E30,
+    };
+
+    // 0x4e6f46
+    // Track 19. Reversed 0. Direction 0
+    static constexpr PackedMoveInfo moveInfoT19R0D0[] = {
+        0x4820505F, 0x4820505E, 0x4820505D, 0x4820505C, 0x4861505B, 0x4861505A, 0x48615159, 0x48615158,
+        0x48615157, 0x48625156, 0x48625155, 0x48625154, 0x48625253, 0x48A35252, 0x48A35251, 0x48A35350,
+        0x48A3534F, 0x48A3534E, 0x48A4544D, 0x48A4544C, 0x48A4554B, 0x48A4554A, 0x48E55649, 0x48E55648,
+        0x48E55747, 0x48E55746, 0x48E65845, 0x48E65944, 0x48E65943, 0x48E65A42, 0x49275B41, 0x49275C40,
+        0x49275D3F, 0x49275D3D, 0x49285E3C, 0x49285F3B, 0x4928603A, 0x49696139, 0x49696239, 0x49696338,
+        0x49696437, 0x496A6537, 0x496A6636, 0x496A6736, 0x496A6835, 0x49AB6935, 0x49AB6A34, 0x49AB6B34,
+        0x49AB6C33, 0x49AC6D33, 0x49AC6E33, 0x49AC6F32, 0x49AC7032, 0x49AC7132, 0x49ED7231, 0x49ED7331,
+        0x49ED7431, 0x49ED7531, 0x49EE7631, 0x49EE7731, 0x49EE7830, 0x49EE7930, 0x49EE7A30, 0x4A2F7B30,
+        0x4A2F7C30, 0x4A2F7D30, 0x4A2F7E30,
+    };
+
+    // 0x4e7160
+    // Track 19. Reversed 0. Direction 1
+    static constexpr PackedMoveInfo moveInfoT19R0D1[] = {
+        0x4A204050, 0x4A204150, 0x4A204250, 0x4A204350, 0x4A204450, 0x4A614550, 0x4A614650, 0x4A614751,
+        0x4A614851, 0x4A614951, 0x4A624A51, 0x4A624B51, 0x4A624C51, 0x4A624D52, 0x4AA34E52, 0x4AA34F52,
+        0x4AA35053, 0x4AA35153, 0x4AA35253, 0x4AA45354, 0x4AA45454, 0x4AA45555, 0x4AA45655, 0x4AE55756,
+        0x4AE55856, 0x4AE55957, 0x4AE55A57, 0x4AE65B58, 0x4AE65C59, 0x4AE65D59, 0x4AE65E5A, 0x4B275F5B,
+        0x4B27605C, 0x4B27615D, 0x4B27635D, 0x4B28645E, 0x4B28655F, 0x4B286660, 0x4B696761, 0x4B696762,
+        0x4B696863, 0x4B696964, 0x4B6A6965, 0x4B6A6A66, 0x4B6A6A67, 0x4B6A6B68, 0x4BAB6B69, 0x4BAB6C6A,
+        0x4BAB6C6B, 0x4BAB6D6C, 0x4BAC6D6D, 0x4BAC6D6E, 0x4BAC6E6F, 0x4BAC6E70, 0x4BAC6E71, 0x4BED6F72,
+        0x4BED6F73, 0x4BED6F74, 0x4BED6F75, 0x4BEE6F76, 0x4BEE6F77, 0x4BEE7078, 0x4BEE7079, 0x4BEE707A,
+        0x4C2F707B, 0x4C2F707C, 0x4C2F707D, 0x4C2F707E,
+    };
+
+    // 0x4e7382
+    // Track 19. Reversed 0. Direction 2
+    static constexpr PackedMoveInfo moveInfoT19R0D2[] = {
+        0x4C205040, 0x4C205041, 0x4C205042, 0x4C205043, 0x4C205044, 0x4C615045, 0x4C615046, 0x4C614F47,
+        0x4C614F48, 0x4C614F49, 0x4C624F4A, 0x4C624F4B, 0x4C624F4C, 0x4C624E4D, 0x4CA24E4E, 0x4CA34E4F,
+        0x4CA34D50, 0x4CA34D51, 0x4CA34D52, 0x4CA44C53, 0x4CA44C54, 0x4CA44B55, 0x4CA44B56, 0x4CE54A57,
+        0x4CE54A58, 0x4CE54959, 0x4CE5495A, 0x4CE5485B, 0x4CE6475C, 0x4CE6475D, 0x4CE6465E, 0x4D27455F,
+        0x4D274460, 0x4D274361, 0x4D274363, 0x4D284264, 0x4D284165, 0x4D284066, 0x4D683F67, 0x4D693E67,
+        0x4D693D68, 0x4D693C69, 0x4D693B69, 0x4D6A3A6A, 0x4D6A396A, 0x4D6A386B, 0x4DAA376B, 0x4DAB366C,
+        0x4DAB356C, 0x4DAB346D, 0x4DAB336D, 0x4DAC326D, 0x4DAC316E, 0x4DAC306E, 0x4DAC2F6E, 0x4DEC2E6F,
+        0x4DED2D6F, 0x4DED2C6F, 0x4DED2B6F, 0x4DED2A6F, 0x4DEE296F, 0x4DEE2870, 0x4DEE2770, 0x4DEE2670,
+        0x4E2E2570, 0x4E2F2470, 0x4E2F2370, 0x4E2F2270, 0x4E2F2170,
+    };
+
+    // 0x4e75ac
+    // Track 19. Reversed 0. Direction 3
+    static constexpr PackedMoveInfo moveInfoT19R0D3[] = {
+        0x4E205F50, 0x4E205E50, 0x4E205D50, 0x4E205C50, 0x4E615B50, 0x4E615A50, 0x4E61594F, 0x4E61584F,
+        0x4E61574F, 0x4E62564F, 0x4E62554F, 0x4E62544F, 0x4E62534E, 0x4EA2524E, 0x4EA3514E, 0x4EA3504D,
+        0x4EA34F4D, 0x4EA34E4D, 0x4EA44D4C, 0x4EA44C4C, 0x4EA44B4B, 0x4EA44A4B, 0x4EE5494A, 0x4EE5484A,
+        0x4EE54749, 0x4EE54649, 0x4EE54548, 0x4EE64447, 0x4EE64347, 0x4EE64246, 0x4F274145, 0x4F274044,
+        0x4F273F43, 0x4F273D43, 0x4F283C42, 0x4F283B41, 0x4F283A40, 0x4F68393F, 0x4F69393E, 0x4F69383D,
+        0x4F69373C, 0x4F69373B, 0x4F6A363A, 0x4F6A3639, 0x4F6A3538, 0x4FAA3537, 0x4FAB3436, 0x4FAB3435,
+        0x4FAB3334, 0x4FAB3333, 0x4FAC3332, 0x4FAC3231, 0x4FAC3230, 0x4FAC322F, 0x4FEC312E, 0x4FED312D,
+        0x4FED312C, 0x4FED312B, 0x4FED312A, 0x4FEE3129, 0x4FEE3028, 0x4FEE3027, 0x4FEE3026, 0x482E3025,
+        0x482F3024, 0x482F3023, 0x482F3022, 0x482F3021,
+    };
+
+    // 0x4e7e3c
+    // Track 19. Reversed 1. Direction 0
+    static constexpr PackedMoveInfo moveInfoT19R1D0[] = {
+        0x56205F50, 0x56205E50, 0x56205D50, 0x56205C50, 0x55DF5B50, 0x55DF5A50, 0x55DF5951, 0x55DF5851,
+        0x55DF5751, 0x55DE5651, 0x55DE5551, 0x55DE5451, 0x55DE5352, 0x559D5252, 0x559D5152, 0x559D5053,
+        0x559D4F53, 0x559D4E53, 0x559C4D54, 0x559C4C54, 0x559C4B55, 0x559C4A55, 0x555B4956, 0x555B4856,
+        0x555B4757, 0x555B4657, 0x555A4558, 0x555A4459, 0x555A4359, 0x555A425A, 0x5519415B, 0x5519405C,
+        0x55193F5D, 0x55183D5D, 0x55183C5E, 0x55183B5F, 0x55183A60, 0x54D73961, 0x54D73962, 0x54D73863,
+        0x54D73764, 0x54D63765, 0x54D63666, 0x54D63667, 0x54D63568, 0x54953569, 0x5495346A, 0x5495346B,
+        0x5495336C, 0x5494336D, 0x5494336E, 0x5494326F, 0x54943270, 0x54943271, 0x54533172, 0x54533173,
+        0x54533174, 0x54533175, 0x54523176, 0x54523177, 0x54523078, 0x54523079, 0x5452307A, 0x5411307B,
+        0x5411307C, 0x5411307D, 0x5411307E,
+    };
+
+    // 0x4e77ce
+    // Track 19. Reversed 1. Direction 1
+    static constexpr PackedMoveInfo moveInfoT19R1D1[] = {
+        0x5020505F, 0x5020505E, 0x5020505D, 0x5020505C, 0x57DF505B, 0x57DF505A, 0x57DF4F59, 0x57DF4F58,
+        0x57DF4F57, 0x57DE4F56, 0x57DE4F55, 0x57DE4F54, 0x57DE4E53, 0x579E4E52, 0x579D4E51, 0x579D4D50,
+        0x579D4D4F, 0x579D4D4E, 0x579C4C4D, 0x579C4C4C, 0x579C4B4B, 0x579C4B4A, 0x575B4A49, 0x575B4A48,
+        0x575B4947, 0x575B4946, 0x575B4845, 0x575A4744, 0x575A4743, 0x575A4642, 0x57194541, 0x57194440,
+        0x5719433F, 0x5719433D, 0x5718423C, 0x5718413B, 0x5718403A, 0x56D83F39, 0x56D73E39, 0x56D73D38,
+        0x56D73C37, 0x56D63B37, 0x56D63A36, 0x56D63936, 0x56D63835, 0x56963735, 0x56953634, 0x56953534,
+        0x56953433, 0x56953333, 0x56943233, 0x56943132, 0x56943032, 0x56942F32, 0x56532E31, 0x56532D31,
+        0x56532C31, 0x56532B31, 0x56532A31, 0x56522931, 0x56522830, 0x56522730, 0x56522630, 0x56122530,
+        0x56112430, 0x56112330, 0x56112230, 0x56102130,
+    };
+
+    // 0x4e79f0
+    // Track 19. Reversed 1. Direction 2
+    static constexpr PackedMoveInfo moveInfoT19R1D2[] = {
+        0x52204050, 0x52204150, 0x52204250, 0x52204350, 0x52204450, 0x51DF4550, 0x51DF4650, 0x51DF474F,
+        0x51DF484F, 0x51DF494F, 0x51DE4A4F, 0x51DE4B4F, 0x51DE4C4F, 0x51DE4D4E, 0x519E4E4E, 0x519D4F4E,
+        0x519D504D, 0x519D514D, 0x519D524D, 0x519C534C, 0x519C544C, 0x519C554B, 0x519C564B, 0x515B574A,
+        0x515B584A, 0x515B5949, 0x515B5A49, 0x515B5B48, 0x515A5C47, 0x515A5D47, 0x515A5E46, 0x51195F45,
+        0x51196044, 0x51196143, 0x51196343, 0x51186442, 0x51186541, 0x51186640, 0x50D8673F, 0x50D7673E,
+        0x50D7683D, 0x50D7693C, 0x50D6693B, 0x50D66A3A, 0x50D66A39, 0x50D66B38, 0x50966B37, 0x50956C36,
+        0x50956C35, 0x50956D34, 0x50956D33, 0x50946D32, 0x50946E31, 0x50946E30, 0x50946E2F, 0x50536F2E,
+        0x50536F2D, 0x50536F2C, 0x50536F2B, 0x50536F2A, 0x50526F29, 0x50527028, 0x50527027, 0x50527026,
+        0x50127025, 0x50117024, 0x50117023, 0x50117022, 0x50107021,
+    };
+
+    // 0x4e7c1a
+    // Track 19. Reversed 1. Direction 3
+    static constexpr PackedMoveInfo moveInfoT19R1D3[] = {
+        0x54205040, 0x54205041, 0x54205042, 0x54205043, 0x54205044, 0x53DF5045, 0x53DF5046, 0x53DF5147,
+        0x53DF5148, 0x53DF5149, 0x53DE514A, 0x53DE514B, 0x53DE514C, 0x53DE524D, 0x539D524E, 0x539D524F,
+        0x539D5350, 0x539D5351, 0x539D5352, 0x539C5453, 0x539C5454, 0x539C5555, 0x539C5556, 0x535B5657,
+        0x535B5658, 0x535B5759, 0x535B575A, 0x535A585B, 0x535A595C, 0x535A595D, 0x535A5A5E, 0x53195B5F,
+        0x53195C60, 0x53195D61, 0x53185D63, 0x53185E64, 0x53185F65, 0x53186066, 0x52D76167, 0x52D76267,
+        0x52D76368, 0x52D76469, 0x52D66569, 0x52D6666A, 0x52D6676A, 0x52D6686B, 0x5295696B, 0x52956A6C,
+        0x52956B6C, 0x52956C6D, 0x52946D6D, 0x52946E6D, 0x52946F6E, 0x5294706E, 0x5294716E, 0x5253726F,
+        0x5253736F, 0x5253746F, 0x5253756F, 0x5252766F, 0x5252776F, 0x52527870, 0x52527970, 0x52527A70,
+        0x52117B70, 0x52117C70, 0x52117D70, 0x52117E70,
+    };
+
+    // 0x4e88de
+    // Track 22. Reversed 0. Direction 0
+    static constexpr PackedMoveInfo moveInfoT22R0D0[] = {
+        0x5820505F, 0x5820505E, 0x5821505D, 0x5821505C, 0x5FE2505B, 0x5FE2505A, 0x5FE24F59, 0x5FE34F58,
+        0x5FE34F57, 0x5FE44F56, 0x5FE44F55, 0x5FE44F54, 0x5FE54E53, 0x5FA54E52, 0x5FA64E51, 0x5FA64D50,
+        0x5FA74D4F, 0x5FA74D4E, 0x5FA84C4D, 0x5FA84C4C, 0x5FA94B4B, 0x5FA94B4A, 0x5F6A4A49, 0x5F6A4A48,
+        0x5F6B4947, 0x5F6B4946, 0x5F6B4845, 0x5F6C4744, 0x5F6D4743, 0x5F6D4642, 0x5F2E4541, 0x5F2E4440,
+        0x5F2F433F, 0x5F2F433D, 0x5F30423C, 0x5F30413B, 0x5F31403A, 0x5EF13F39, 0x5EF23E39, 0x5EF23D38,
+        0x5EF33C37, 0x5EF33B37, 0x5EF43A36, 0x5EF43936, 0x5EF53835, 0x5EB53735, 0x5EB63634, 0x5EB63534,
+        0x5EB73433, 0x5EB73333, 0x5EB83233, 0x5EB83132, 0x5EB93032, 0x5EB92F32, 0x5E792E31, 0x5E7A2D31,
+        0x5E7A2C31, 0x5E7B2B31, 0x5E7B2A31, 0x5E7C2931, 0x5E7C2830, 0x5E7D2730, 0x5E7D2630, 0x5E3D2530,
+        0x5E3E2430, 0x5E3E2330, 0x5E3F2230, 0x5E3F2130,
+    };
+
+    // 0x4e8b00
+    // Track 22. Reversed 0. Direction 1
+    static constexpr PackedMoveInfo moveInfoT22R0D1[] = {
+        0x5A204050, 0x5A204150, 0x5A204250, 0x5A214350, 0x5A214450, 0x59E24550, 0x59E24650, 0x59E2474F,
+        0x59E3484F, 0x59E3494F, 0x59E44A4F, 0x59E44B4F, 0x59E44C4F, 0x59E54D4E, 0x59A54E4E, 0x59A64F4E,
+        0x59A6504D, 0x59A7514D, 0x59A7524D, 0x59A8534C, 0x59A8544C, 0x59A9554B, 0x59A9564B, 0x596A574A,
+        0x596A584A, 0x596B5949, 0x596B5A49, 0x596B5B48, 0x596C5C47, 0x596D5D47, 0x596D5E46, 0x592E5F45,
+        0x592E6044, 0x592F6143, 0x592F6343, 0x59306442, 0x59306541, 0x59316640, 0x58F1673F, 0x58F2673E,
+        0x58F2683D, 0x58F3693C, 0x58F3693B, 0x58F46A3A, 0x58F46A39, 0x58F56B38, 0x58B56B37, 0x58B66C36,
+        0x58B66C35, 0x58B76D34, 0x58B76D33, 0x58B86D32, 0x58B86E31, 0x58B96E30, 0x58B96E2F, 0x58796F2E,
+        0x587A6F2D, 0x587A6F2C, 0x587B6F2B, 0x587B6F2A, 0x587C6F29, 0x587C7028, 0x587D7027, 0x587D7026,
+        0x583D7025, 0x583E7024, 0x583E7023, 0x583F7022, 0x583F7021,
+    };
+
+    // 0x4e8d2a
+    // Track 22. Reversed 0. Direction 2
+    static constexpr PackedMoveInfo moveInfoT22R0D2[] = {
+        0x5C205040, 0x5C205041, 0x5C205042, 0x5C215043, 0x5C215044, 0x5BE25045, 0x5BE25046, 0x5BE25147,
+        0x5BE35148, 0x5BE35149, 0x5BE4514A, 0x5BE4514B, 0x5BE5514C, 0x5BE5524D, 0x5BA6524E, 0x5BA6524F,
+        0x5BA65350, 0x5BA75351, 0x5BA75352, 0x5BA85453, 0x5BA85454, 0x5BA95555, 0x5BA95556, 0x5B6A5657,
+        0x5B6A5658, 0x5B6B5759, 0x5B6B575A, 0x5B6C585B, 0x5B6C595C, 0x5B6D595D, 0x5B6D5A5E, 0x5B2E5B5F,
+        0x5B2E5C60, 0x5B2F5D61, 0x5B2F5D63, 0x5B305E64, 0x5B305F65, 0x5B316066, 0x5AF26167, 0x5AF26267,
+        0x5AF36368, 0x5AF36469, 0x5AF46569, 0x5AF4666A, 0x5AF5676A, 0x5AF5686B, 0x5AB6696B, 0x5AB66A6C,
+        0x5AB76B6C, 0x5AB76C6D, 0x5AB86D6D, 0x5AB86E6D, 0x5AB86F6E, 0x5AB9706E, 0x5AB9716E, 0x5A7A726F,
+        0x5A7A736F, 0x5A7B746F, 0x5A7B756F, 0x5A7C766F, 0x5A7C776F, 0x5A7C7870, 0x5A7D7970, 0x5A7D7A70,
+        0x5A3E7B70, 0x5A3E7C70, 0x5A3F7D70, 0x5A3F7E70,
+    };
+
+    // 0x4e8f4c
+    // Track 22. Reversed 0. Direction 3
+    static constexpr PackedMoveInfo moveInfoT22R0D3[] = {
+        0x5E205F50, 0x5E205E50, 0x5E215D50, 0x5E215C50, 0x5DE25B50, 0x5DE25A50, 0x5DE25951, 0x5DE35851,
+        0x5DE35751, 0x5DE45651, 0x5DE45551, 0x5DE55451, 0x5DE55352, 0x5DA65252, 0x5DA65152, 0x5DA65053,
+        0x5DA74F53, 0x5DA74E53, 0x5DA84D54, 0x5DA84C54, 0x5DA94B55, 0x5DA94A55, 0x5D6A4956, 0x5D6A4856,
+        0x5D6B4757, 0x5D6B4657, 0x5D6C4558, 0x5D6C4459, 0x5D6D4359, 0x5D6D425A, 0x5D2E415B, 0x5D2E405C,
+        0x5D2F3F5D, 0x5D2F3D5D, 0x5D303C5E, 0x5D303B5F, 0x5D313A60, 0x5CF23961, 0x5CF23962, 0x5CF33863,
+        0x5CF33764, 0x5CF43765, 0x5CF43666, 0x5CF53667, 0x5CF53568, 0x5CB63569, 0x5CB6346A, 0x5CB7346B,
+        0x5CB7336C, 0x5CB8336D, 0x5CB8336E, 0x5CB8326F, 0x5CB93270, 0x5CB93271, 0x5C7A3172, 0x5C7A3173,
+        0x5C7B3174, 0x5C7B3175, 0x5C7C3176, 0x5C7C3177, 0x5C7C3078, 0x5C7D3079, 0x5C7D307A, 0x5C3E307B,
+        0x5C3E307C, 0x5C3F307D, 0x5C3F307E,
+    };
+
+    // 0x4ea490
+    // Track 22. Reversed 1. Direction 0
+    static constexpr PackedMoveInfo moveInfoT22R1D0[] = {
+        0x62204050, 0x62204150, 0x62204250, 0x621F4350, 0x621F4450, 0x625E4550, 0x625E4650, 0x625E4751,
+        0x625D4851, 0x625D4951, 0x625C4A51, 0x625C4B51, 0x625B4C51, 0x625B4D52, 0x629A4E52, 0x629A4F52,
+        0x629A5053, 0x62995153, 0x62995253, 0x62985354, 0x62985454, 0x62975555, 0x62975655, 0x62D65756,
+        0x62D65856, 0x62D55957, 0x62D55A57, 0x62D45B58, 0x62D45C59, 0x62D35D59, 0x62D35E5A, 0x63125F5B,
+        0x6312605C, 0x6311615D, 0x6310635D, 0x6310645E, 0x6310655F, 0x630F6660, 0x634E6761, 0x634E6762,
+        0x634D6863, 0x634D6964, 0x634C6965, 0x634C6A66, 0x634B6A67, 0x634B6B68, 0x638A6B69, 0x638A6C6A,
+        0x63896C6B, 0x63896D6C, 0x63886D6D, 0x63886D6E, 0x63886E6F, 0x63876E70, 0x63876E71, 0x63C66F72,
+        0x63C66F73, 0x63C56F74, 0x63C56F75, 0x63C46F76, 0x63C46F77, 0x63C47078, 0x63C37079, 0x63C3707A,
+        0x6402707B, 0x6402707C, 0x6401707D, 0x6401707E,
+    };
+
+    // 0x4ea6b2
+    // Track 22. Reversed 1. Direction 1
+    static constexpr PackedMoveInfo moveInfoT22R1D1[] = {
+        0x64205040, 0x64205041, 0x64205042, 0x641F5043, 0x641F5044, 0x645E5045, 0x645E5046, 0x645E4F47,
+        0x645D4F48, 0x645D4F49, 0x645C4F4A, 0x645C4F4B, 0x645C4F4C, 0x645B4E4D, 0x649B4E4E, 0x649A4E4F,
+        0x649A4D50, 0x64994D51, 0x64994D52, 0x64984C53, 0x64984C54, 0x64974B55, 0x64974B56, 0x64D64A57,
+        0x64D64A58, 0x64D54959, 0x64D5495A, 0x64D5485B, 0x64D4475C, 0x64D3475D, 0x64D3465E, 0x6512455F,
+        0x65124460, 0x65114361, 0x65114363, 0x65104264, 0x65104165, 0x650F4066, 0x654F3F67, 0x654E3E67,
+        0x654E3D68, 0x654D3C69, 0x654D3B69, 0x654C3A6A, 0x654C396A, 0x654B386B, 0x658B376B, 0x658A366C,
+        0x658A356C, 0x6589346D, 0x6589336D, 0x6588326D, 0x6588316E, 0x6587306E, 0x65872F6E, 0x65C72E6F,
+        0x65C62D6F, 0x65C62C6F, 0x65C52B6F, 0x65C52A6F, 0x65C4296F, 0x65C42870, 0x65C32770, 0x65C32670,
+        0x66032570, 0x66022470, 0x66022370, 0x66012270, 0x66012170,
+    };
+
+    // 0x4ea8dc
+    // Track 22. Reversed 1. Direction 2
+    static constexpr PackedMoveInfo moveInfoT22R1D2[] = {
+        0x66205F50, 0x66205E50, 0x661F5D50, 0x661F5C50, 0x665E5B50, 0x665E5A50, 0x665E594F, 0x665D584F,
+        0x665D574F, 0x665C564F, 0x665C554F, 0x665C544F, 0x665B534E, 0x669B524E, 0x669A514E, 0x669A504D,
+        0x66994F4D, 0x66994E4D, 0x66984D4C, 0x66984C4C, 0x66974B4B, 0x66974A4B, 0x66D6494A, 0x66D6484A,
+        0x66D54749, 0x66D54649, 0x66D54548, 0x66D44447, 0x66D34347, 0x66D34246, 0x67124145, 0x67124044,
+        0x67113F43, 0x67113D43, 0x67103C42, 0x67103B41, 0x670F3A40, 0x674F393F, 0x674E393E, 0x674E383D,
+        0x674D373C, 0x674D373B, 0x674C363A, 0x674C3639, 0x674B3538, 0x678B3537, 0x678A3436, 0x678A3435,
+        0x67893334, 0x67893333, 0x67883332, 0x67883231, 0x67873230, 0x6787322F, 0x67C7312E, 0x67C6312D,
+        0x67C6312C, 0x67C5312B, 0x67C5312A, 0x67C43129, 0x67C43028, 0x67C33027, 0x67C33026, 0x60033025,
+        0x60023024, 0x60023023, 0x60013022, 0x60013021,
+    };
+
+    // 0x4ea276
+    // Track 22. Reversed 1. Direction 3
+    static constexpr PackedMoveInfo moveInfoT22R1D3[] = {
+        0x6020505F, 0x6020505E, 0x601F505D, 0x601F505C, 0x605E505B, 0x605E505A, 0x605E5159, 0x605D5158,
+        0x605D5157, 0x605C5156, 0x605C5155, 0x605B5154, 0x605B5253, 0x609A5252, 0x609A5251, 0x609A5350,
+        0x6099534F, 0x6099534E, 0x6098544D, 0x6098544C, 0x6097554B, 0x6097554A, 0x60D65649, 0x60D65648,
+        0x60D55747, 0x60D55746, 0x60D45845, 0x60D45944, 0x60D35943, 0x60D35A42, 0x61125B41, 0x61125C40,
+        0x61115D3F, 0x61105D3D, 0x61105E3C, 0x61105F3B, 0x610F603A, 0x614E6139, 0x614E6239, 0x614D6338,
+        0x614D6437, 0x614C6537, 0x614C6636, 0x614B6736, 0x614B6835, 0x618A6935, 0x618A6A34, 0x61896B34,
+        0x61896C33, 0x61886D33, 0x61886E33, 0x61886F32, 0x61877032, 0x61877132, 0x61C67231, 0x61C67331,
+        0x61C57431, 0x61C57531, 0x61C47631, 0x61C47731, 0x61C47830, 0x61C37930, 0x61C37A30, 0x62027B30,
+        0x62027C30, 0x62017D30, 0x62017E30,
+    };
+
+    // 0x4e9166
+    // Track 23. Reversed 0. Direction 0
+    static constexpr PackedMoveInfo moveInfoT23R0D0[] = {
+        0x5820505F, 0x5820505E, 0x5821505D, 0x5821505C, 0x5862505B, 0x5862505A, 0x58625159, 0x58635158,
+        0x58635157, 0x58645156, 0x58645155, 0x58655154, 0x58655253, 0x58A65252, 0x58A65251, 0x58A65350,
+        0x58A7534F, 0x58A7534E, 0x58A8544D, 0x58A8544C, 0x58A9554B, 0x58A9554A, 0x58EA5649, 0x58EA5648,
+        0x58EB5747, 0x58EB5746, 0x58EC5845, 0x58EC5944, 0x58ED5943, 0x58ED5A42, 0x592E5B41, 0x592E5C40,
+        0x592F5D3F, 0x592F5D3D, 0x59305E3C, 0x59305F3B, 0x5931603A, 0x59726139, 0x59726239, 0x59736338,
+        0x59736437, 0x59746537, 0x59746636, 0x59756736, 0x59756835, 0x59B66935, 0x59B66A34, 0x59B76B34,
+        0x59B76C33, 0x59B86D33, 0x59B86E33, 0x59B86F32, 0x59B97032, 0x59B97132, 0x59FA7231, 0x59FA7331,
+        0x59FB7431, 0x59FB7531, 0x59FC7631, 0x59FC7731, 0x59FC7830, 0x59FD7930, 0x59FD7A30, 0x5A3E7B30,
+        0x5A3E7C30, 0x5A3F7D30, 0x5A3F7E30,
+    };
+
+    // 0x4e9380
+    // Track 23. Reversed 0. Direction 1
+    static constexpr PackedMoveInfo moveInfoT23R0D1[] = {
+        0x5A204050, 0x5A204150, 0x5A204250, 0x5A214350, 0x5A214450, 0x5A624550, 0x5A624650, 0x5A624751,
+        0x5A634851, 0x5A634951, 0x5A644A51, 0x5A644B51, 0x5A654C51, 0x5A654D52, 0x5AA64E52, 0x5AA64F52,
+        0x5AA65053, 0x5AA75153, 0x5AA75253, 0x5AA85354, 0x5AA85454, 0x5AA95555, 0x5AA95655, 0x5AEA5756,
+        0x5AEA5856, 0x5AEB5957, 0x5AEB5A57, 0x5AEC5B58, 0x5AEC5C59, 0x5AED5D59, 0x5AED5E5A, 0x5B2E5F5B,
+        0x5B2E605C, 0x5B2F615D, 0x5B2F635D, 0x5B30645E, 0x5B30655F, 0x5B316660, 0x5B726761, 0x5B726762,
+        0x5B736863, 0x5B736964, 0x5B746965, 0x5B746A66, 0x5B756A67, 0x5B756B68, 0x5BB66B69, 0x5BB66C6A,
+        0x5BB76C6B, 0x5BB76D6C, 0x5BB86D6D, 0x5BB86D6E, 0x5BB86E6F, 0x5BB96E70, 0x5BB96E71, 0x5BFA6F72,
+        0x5BFA6F73, 0x5BFB6F74, 0x5BFB6F75, 0x5BFC6F76, 0x5BFC6F77, 0x5BFC7078, 0x5BFD7079, 0x5BFD707A,
+        0x5C3E707B, 0x5C3E707C, 0x5C3F707D, 0x5C3F707E,
+    };
+
+    // 0x4e95a2
+    // Track 23. Reversed 0. Direction 2
+    static constexpr PackedMoveInfo moveInfoT23R0D2[] = {
+        0x5C205040, 0x5C205041, 0x5C205042, 0x5C215043, 0x5C215044, 0x5C625045, 0x5C625046, 0x5C624F47,
+        0x5C634F48, 0x5C634F49, 0x5C644F4A, 0x5C644F4B, 0x5C644F4C, 0x5C654E4D, 0x5CA54E4E, 0x5CA64E4F,
+        0x5CA64D50, 0x5CA74D51, 0x5CA74D52, 0x5CA84C53, 0x5CA84C54, 0x5CA94B55, 0x5CA94B56, 0x5CEA4A57,
+        0x5CEA4A58, 0x5CEB4959, 0x5CEB495A, 0x5CEB485B, 0x5CEC475C, 0x5CED475D, 0x5CED465E, 0x5D2E455F,
+        0x5D2E4460, 0x5D2F4361, 0x5D2F4363, 0x5D304264, 0x5D304165, 0x5D314066, 0x5D713F67, 0x5D723E67,
+        0x5D723D68, 0x5D733C69, 0x5D733B69, 0x5D743A6A, 0x5D74396A, 0x5D75386B, 0x5DB5376B, 0x5DB6366C,
+        0x5DB6356C, 0x5DB7346D, 0x5DB7336D, 0x5DB8326D, 0x5DB8316E, 0x5DB9306E, 0x5DB92F6E, 0x5DF92E6F,
+        0x5DFA2D6F, 0x5DFA2C6F, 0x5DFB2B6F, 0x5DFB2A6F, 0x5DFC296F, 0x5DFC2870, 0x5DFD2770, 0x5DFD2670,
+        0x5E3D2570, 0x5E3E2470, 0x5E3E2370, 0x5E3F2270, 0x5E3F2170,
+    };
+
+    // 0x4e97cc
+    // Track 23. Reversed 0. Direction 3
+    static constexpr PackedMoveInfo moveInfoT23R0D3[] = {
+        0x5E205F50, 0x5E205E50, 0x5E215D50, 0x5E215C50, 0x5E625B50, 0x5E625A50, 0x5E62594F, 0x5E63584F,
+        0x5E63574F, 0x5E64564F, 0x5E64554F, 0x5E64544F, 0x5E65534E, 0x5EA5524E, 0x5EA6514E, 0x5EA6504D,
+        0x5EA74F4D, 0x5EA74E4D, 0x5EA84D4C, 0x5EA84C4C, 0x5EA94B4B, 0x5EA94A4B, 0x5EEA494A, 0x5EEA484A,
+        0x5EEB4749, 0x5EEB4649, 0x5EEB4548, 0x5EEC4447, 0x5EED4347, 0x5EED4246, 0x5F2E4145, 0x5F2E4044,
+        0x5F2F3F43, 0x5F2F3D43, 0x5F303C42, 0x5F303B41, 0x5F313A40, 0x5F71393F, 0x5F72393E, 0x5F72383D,
+        0x5F73373C, 0x5F73373B, 0x5F74363A, 0x5F743639, 0x5F753538, 0x5FB53537, 0x5FB63436, 0x5FB63435,
+        0x5FB73334, 0x5FB73333, 0x5FB83332, 0x5FB83231, 0x5FB93230, 0x5FB9322F, 0x5FF9312E, 0x5FFA312D,
+        0x5FFA312C, 0x5FFB312B, 0x5FFB312A, 0x5FFC3129, 0x5FFC3028, 0x5FFD3027, 0x5FFD3026, 0x583D3025,
+        0x583E3024, 0x583E3023, 0x583F3022, 0x583F3021,
+    };
+
+    // 0x4ea05c
+    // Track 23. Reversed 1. Direction 0
+    static constexpr PackedMoveInfo moveInfoT23R1D0[] = {
+        0x66205F50, 0x66205E50, 0x661F5D50, 0x661F5C50, 0x65DE5B50, 0x65DE5A50, 0x65DE5951, 0x65DD5851,
+        0x65DD5751, 0x65DC5651, 0x65DC5551, 0x65DB5451, 0x65DB5352, 0x659A5252, 0x659A5152, 0x659A5053,
+        0x65994F53, 0x65994E53, 0x65984D54, 0x65984C54, 0x65974B55, 0x65974A55, 0x65564956, 0x65564856,
+        0x65554757, 0x65554657, 0x65544558, 0x65544459, 0x65534359, 0x6553425A, 0x6512415B, 0x6512405C,
+        0x65113F5D, 0x65103D5D, 0x65103C5E, 0x65103B5F, 0x650F3A60, 0x64CE3961, 0x64CE3962, 0x64CD3863,
+        0x64CD3764, 0x64CC3765, 0x64CC3666, 0x64CB3667, 0x64CB3568, 0x648A3569, 0x648A346A, 0x6489346B,
+        0x6489336C, 0x6488336D, 0x6488336E, 0x6488326F, 0x64873270, 0x64873271, 0x64463172, 0x64463173,
+        0x64453174, 0x64453175, 0x64443176, 0x64443177, 0x64443078, 0x64433079, 0x6443307A, 0x6402307B,
+        0x6402307C, 0x6401307D, 0x6401307E,
+    };
+
+    // 0x4e99ee
+    // Track 23. Reversed 1. Direction 1
+    static constexpr PackedMoveInfo moveInfoT23R1D1[] = {
+        0x6020505F, 0x6020505E, 0x601F505D, 0x601F505C, 0x67DE505B, 0x67DE505A, 0x67DE4F59, 0x67DD4F58,
+        0x67DD4F57, 0x67DC4F56, 0x67DC4F55, 0x67DC4F54, 0x67DB4E53, 0x679B4E52, 0x679A4E51, 0x679A4D50,
+        0x67994D4F, 0x67994D4E, 0x67984C4D, 0x67984C4C, 0x67974B4B, 0x67974B4A, 0x67564A49, 0x67564A48,
+        0x67554947, 0x67554946, 0x67554845, 0x67544744, 0x67534743, 0x67534642, 0x67124541, 0x67124440,
+        0x6711433F, 0x6711433D, 0x6710423C, 0x6710413B, 0x670F403A, 0x66CF3F39, 0x66CE3E39, 0x66CE3D38,
+        0x66CD3C37, 0x66CC3B37, 0x66CC3A36, 0x66CC3936, 0x66CB3835, 0x668B3735, 0x668A3634, 0x668A3534,
+        0x66893433, 0x66893333, 0x66883233, 0x66883132, 0x66873032, 0x66872F32, 0x66462E31, 0x66462D31,
+        0x66452C31, 0x66452B31, 0x66452A31, 0x66442931, 0x66442830, 0x66432730, 0x66432630, 0x66032530,
+        0x66022430, 0x66022330, 0x66012230, 0x66002130,
+    };
+
+    // 0x4e9c10
+    // Track 23. Reversed 1. Direction 2
+    static constexpr PackedMoveInfo moveInfoT23R1D2[] = {
+        0x62204050, 0x62204150, 0x62204250, 0x621F4350, 0x621F4450, 0x61DE4550, 0x61DE4650, 0x61DE474F,
+        0x61DD484F, 0x61DD494F, 0x61DC4A4F, 0x61DC4B4F, 0x61DC4C4F, 0x61DB4D4E, 0x619B4E4E, 0x619A4F4E,
+        0x619A504D, 0x6199514D, 0x6199524D, 0x6198534C, 0x6198544C, 0x6197554B, 0x6197564B, 0x6156574A,
+        0x6156584A, 0x61555949, 0x61555A49, 0x61555B48, 0x61545C47, 0x61535D47, 0x61535E46, 0x61125F45,
+        0x61126044, 0x61116143, 0x61116343, 0x61106442, 0x61106541, 0x610F6640, 0x60CF673F, 0x60CE673E,
+        0x60CE683D, 0x60CD693C, 0x60CC693B, 0x60CC6A3A, 0x60CC6A39, 0x60CB6B38, 0x608B6B37, 0x608A6C36,
+        0x608A6C35, 0x60896D34, 0x60896D33, 0x60886D32, 0x60886E31, 0x60876E30, 0x60876E2F, 0x60466F2E,
+        0x60466F2D, 0x60456F2C, 0x60456F2B, 0x60456F2A, 0x60446F29, 0x60447028, 0x60437027, 0x60437026,
+        0x60037025, 0x60027024, 0x60027023, 0x60017022, 0x60007021,
+    };
+
+    // 0x4e9e3a
+    // Track 23. Reversed 1. Direction 3
+    static constexpr PackedMoveInfo moveInfoT23R1D3[] = {
+        0x64205040, 0x64205041, 0x64205042, 0x641F5043, 0x641F5044, 0x63DE5045, 0x63DE5046, 0x63DE5147,
+        0x63DD5148, 0x63DD5149, 0x63DC514A, 0x63DC514B, 0x63DB514C, 0x63DB524D, 0x639A524E, 0x639A524F,
+        0x639A5350, 0x63995351, 0x63995352, 0x63985453, 0x63985454, 0x63975555, 0x63975556, 0x63565657,
+        0x63565658, 0x63555759, 0x6355575A, 0x6354585B, 0x6354595C, 0x6353595D, 0x63535A5E, 0x63125B5F,
+        0x63125C60, 0x63115D61, 0x63105D63, 0x63105E64, 0x63105F65, 0x630F6066, 0x62CE6167, 0x62CE6267,
+        0x62CD6368, 0x62CD6469, 0x62CC6569, 0x62CC666A, 0x62CB676A, 0x62CB686B, 0x628A696B, 0x628A6A6C,
+        0x62896B6C, 0x62896C6D, 0x62886D6D, 0x62886E6D, 0x62886F6E, 0x6287706E, 0x6287716E, 0x6246726F,
+        0x6246736F, 0x6245746F, 0x6245756F, 0x6244766F, 0x6244776F, 0x62447870, 0x62437970, 0x62437A70,
+        0x62027B70, 0x62027C70, 0x62017D70, 0x62017E70,
+    };
+
+    // 0x4dc556
+    // Track 26. Reversed 0. Direction 0
+    static constexpr PackedMoveInfo moveInfoT26R0D0[] = {
+        0x0020485F, 0x0020485E, 0x0020485D, 0x0020485C, 0x0020485B, 0x0020485A, 0x00204859, 0x00204858,
+        0x00204857, 0x00204856, 0x00204855, 0x00204854, 0x00204853, 0x00204852, 0x00204851, 0x00204850,
+        0x0020484F, 0x0020484E, 0x0020484D, 0x0020484C, 0x0020484B, 0x0020484A, 0x00204849, 0x00204848,
+        0x00204847, 0x00204846, 0x00204845, 0x00204844, 0x00204843, 0x00204842, 0x00204841, 0x00204840,
+    };
+
+    // 0x4dc658
+    // Track 26. Reversed 0. Direction 1
+    static constexpr PackedMoveInfo moveInfoT26R0D1[] = {
+        0x02204048, 0x02204148, 0x02204248, 0x02204348, 0x02204448, 0x02204548, 0x02204648, 0x02204748,
+        0x02204848, 0x02204948, 0x02204A48, 0x02204B48, 0x02204C48, 0x02204D48, 0x02204E48, 0x02204F48,
+        0x02205048, 0x02205148, 0x02205248, 0x02205348, 0x02205448, 0x02205548, 0x02205648, 0x02205748,
+        0x02205848, 0x02205948, 0x02205A48, 0x02205B48, 0x02205C48, 0x02205D48, 0x02205E48, 0x02205F48,
+    };
+
+    // 0x4dc75a
+    // Track 26. Reversed 0. Direction 2
+    static constexpr PackedMoveInfo moveInfoT26R0D2[] = {
+        0x04205840, 0x04205841, 0x04205842, 0x04205843, 0x04205844, 0x04205845, 0x04205846, 0x04205847,
+        0x04205848, 0x04205849, 0x0420584A, 0x0420584B, 0x0420584C, 0x0420584D, 0x0420584E, 0x0420584F,
+        0x04205850, 0x04205851, 0x04205852, 0x04205853, 0x04205854, 0x04205855, 0x04205856, 0x04205857,
+        0x04205858, 0x04205859, 0x0420585A, 0x0420585B, 0x0420585C, 0x0420585D, 0x0420585E, 0x0420585F,
+    };
+
+    // 0x4dc85c
+    // Track 26. Reversed 0. Direction 3
+    static constexpr PackedMoveInfo moveInfoT26R0D3[] = {
+        0x06205F58, 0x06205E58, 0x06205D58, 0x06205C58, 0x06205B58, 0x06205A58, 0x06205958, 0x06205858,
+        0x06205758, 0x06205658, 0x06205558, 0x06205458, 0x06205358, 0x06205258, 0x06205158, 0x06205058,
+        0x06204F58, 0x06204E58, 0x06204D58, 0x06204C58, 0x06204B58, 0x06204A58, 0x06204958, 0x06204858,
+        0x06204758, 0x06204658, 0x06204558, 0x06204458, 0x06204358, 0x06204258, 0x06204158, 0x06204058,
+    };
+
+    // 0x4dcb62
+    // Track 26. Reversed 1. Direction 0
+    static constexpr PackedMoveInfo moveInfoT26R1D0[] = {
+        0x04204840, 0x04204841, 0x04204842, 0x04204843, 0x04204844, 0x04204845, 0x04204846, 0x04204847,
+        0x04204848, 0x04204849, 0x0420484A, 0x0420484B, 0x0420484C, 0x0420484D, 0x0420484E, 0x0420484F,
+        0x04204850, 0x04204851, 0x04204852, 0x04204853, 0x04204854, 0x04204855, 0x04204856, 0x04204857,
+        0x04204858, 0x04204859, 0x0420485A, 0x0420485B, 0x0420485C, 0x0420485D, 0x0420485E, 0x0420485F,
+    };
+
+    // 0x4dcc64
+    // Track 26. Reversed 1. Direction 1
+    static constexpr PackedMoveInfo moveInfoT26R1D1[] = {
+        0x06205F48, 0x06205E48, 0x06205D48, 0x06205C48, 0x06205B48, 0x06205A48, 0x06205948, 0x06205848,
+        0x06205748, 0x06205648, 0x06205548, 0x06205448, 0x06205348, 0x06205248, 0x06205148, 0x06205048,
+        0x06204F48, 0x06204E48, 0x06204D48, 0x06204C48, 0x06204B48, 0x06204A48, 0x06204948, 0x06204848,
+        0x06204748, 0x06204648, 0x06204548, 0x06204448, 0x06204348, 0x06204248, 0x06204148, 0x06204048,
+    };
+
+    // 0x4dc95e
+    // Track 26. Reversed 1. Direction 2
+    static constexpr PackedMoveInfo moveInfoT26R1D2[] = {
+        0x0020585F, 0x0020585E, 0x0020585D, 0x0020585C, 0x0020585B, 0x0020585A, 0x00205859, 0x00205858,
+        0x00205857, 0x00205856, 0x00205855, 0x00205854, 0x00205853, 0x00205852, 0x00205851, 0x00205850,
+        0x0020584F, 0x0020584E, 0x0020584D, 0x0020584C, 0x0020584B, 0x0020584A, 0x00205849, 0x00205848,
+        0x00205847, 0x00205846, 0x00205845, 0x00205844, 0x00205843, 0x00205842, 0x00205841, 0x00205840,
+    };
+
+    // 0x4dca60
+    // Track 26. Reversed 1. Direction 3
+    static constexpr PackedMoveInfo moveInfoT26R1D3[] = {
+        0x02204058, 0x02204158, 0x02204258, 0x02204358, 0x02204458, 0x02204558, 0x02204658, 0x02204758,
+        0x02204858, 0x02204958, 0x02204A58, 0x02204B58, 0x02204C58, 0x02204D58, 0x02204E58, 0x02204F58,
+        0x02205058, 0x02205158, 0x02205258, 0x02205358, 0x02205458, 0x02205558, 0x02205658, 0x02205758,
+        0x02205858, 0x02205958, 0x02205A58, 0x02205B58, 0x02205C58, 0x02205D58, 0x02205E58, 0x02205F58,
+    };
+
+    // 0x4eaafe
+    // Track 28. Reversed 0. Direction 0
+    static constexpr PackedMoveInfo moveInfoT28R0D0[] = {
+        0x0020485F, 0x0020485E, 0x07E0485D, 0x07A0475C, 0x0760475B, 0x0720465A, 0x06E04559, 0x06A04459,
+        0x06604358, 0x06204258, 0x06204158, 0x06204058,
+    };
+
+    // 0x4eab60
+    // Track 28. Reversed 0. Direction 1
+    static constexpr PackedMoveInfo moveInfoT28R0D1[] = {
+        0x02204048, 0x02204148, 0x01E04248, 0x01A04347, 0x01604447, 0x01204546, 0x01204645, 0x00E04744,
+        0x00A04743, 0x00604842, 0x00204841, 0x00204840,
+    };
+
+    // 0x4eabc2
+    // Track 28. Reversed 0. Direction 2
+    static constexpr PackedMoveInfo moveInfoT28R0D2[] = {
+        0x04205840, 0x04205841, 0x04205842, 0x03E05843, 0x03A05944, 0x03605945, 0x03205A46, 0x02E05B47,
+        0x02A05C47, 0x02605D48, 0x02205E48, 0x02205F48,
+    };
+
+    // 0x4eac24
+    // Track 28. Reversed 0. Direction 3
+    static constexpr PackedMoveInfo moveInfoT28R0D3[] = {
+        0x06205F58, 0x06205E58, 0x05E05D58, 0x05A05C59, 0x05605B59, 0x05205A5A, 0x04E0595B, 0x04A0595C,
+        0x0460585D, 0x0420585E, 0x0420585F,
+    };
+
+    // 0x4eb0c6
+    // Track 28. Reversed 1. Direction 0
+    static constexpr PackedMoveInfo moveInfoT28R1D0[] = {
+        0x02204058, 0x02204158, 0x02204258, 0x02604358, 0x02A04459, 0x02E04559, 0x0320465A, 0x0360475B,
+        0x03A0475C, 0x03E0485D, 0x0420485E, 0x0420485F,
+    };
+
+    // 0x4eb128
+    // Track 28. Reversed 1. Direction 1
+    static constexpr PackedMoveInfo moveInfoT28R1D1[] = {
+        0x04204840, 0x04204841, 0x04604842, 0x04A04743, 0x04E04744, 0x05204645, 0x05204546, 0x05604447,
+        0x05A04347, 0x05E04248, 0x06204148, 0x06204048,
+    };
+
+    // 0x4eb18a
+    // Track 28. Reversed 1. Direction 2
+    static constexpr PackedMoveInfo moveInfoT28R1D2[] = {
+        0x06205F48, 0x06205E48, 0x06605D48, 0x06A05C47, 0x06E05B47, 0x07205A46, 0x07605945, 0x07A05944,
+        0x07E05843, 0x00205842, 0x00205841, 0x00205840,
+    };
+
+    // 0x4eb1ec
+    // Track 28. Reversed 1. Direction 3
+    static constexpr PackedMoveInfo moveInfoT28R1D3[] = {
+        0x0020585F, 0x0020585E, 0x0060585D, 0x00A0595C, 0x00E0595B, 0x01205A5A, 0x01605B59, 0x01A05C59,
+        0x01E05D58, 0x02205E58, 0x02205F58,
+    };
+
+    // 0x4eb350
+    // Track 29. Reversed 0. Direction 0
+    static constexpr PackedMoveInfo moveInfoT29R0D0[] = {
+        0x0020585F, 0x0020585E, 0x0020585D, 0x0020585C, 0x07E0575B, 0x07E0575A, 0x07E05759, 0x07A05758,
+        0x07A05657, 0x07A05656, 0x07605655, 0x07605554, 0x07605553, 0x07605452, 0x07205351, 0x07205250,
+        0x0720514F, 0x0720504E, 0x07204F4D, 0x06E04E4C, 0x06E04D4B, 0x06E04C4B, 0x06E04B4A, 0x06A04A4A,
+        0x06A0494A, 0x06A04849, 0x06604749, 0x06604649, 0x06604549, 0x06204448, 0x06204348, 0x06204248,
+        0x06204148, 0x06204048,
+    };
+
+    // 0x4eb462
+    // Track 29. Reversed 0. Direction 1
+    static constexpr PackedMoveInfo moveInfoT29R0D1[] = {
+        0x02204058, 0x02204158, 0x02204258, 0x02204358, 0x02204458, 0x01E04557, 0x01E04657, 0x01E04757,
+        0x01A04857, 0x01A04956, 0x01A04A56, 0x01604B56, 0x01604C55, 0x01604D55, 0x01604E54, 0x01204F53,
+        0x01205052, 0x01205151, 0x01205250, 0x0120534F, 0x00E0544E, 0x00E0554D, 0x00E0554C, 0x00E0564B,
+        0x00A0564A, 0x00A05649, 0x00A05748, 0x00605747, 0x00605746, 0x00605745, 0x00205844, 0x00205843,
+        0x00205842, 0x00205841, 0x00205840,
+    };
+
+    // 0x4eb57c
+    // Track 29. Reversed 0. Direction 2
+    static constexpr PackedMoveInfo moveInfoT29R0D2[] = {
+        0x04204840, 0x04204841, 0x04204842, 0x04204843, 0x04204844, 0x03E04945, 0x03E04946, 0x03E04947,
+        0x03A04948, 0x03A04A49, 0x03A04A4A, 0x03604A4B, 0x03604B4C, 0x03604B4D, 0x03604C4E, 0x03204D4F,
+        0x03204E50, 0x03204F51, 0x03205052, 0x03205153, 0x02E05254, 0x02E05355, 0x02E05455, 0x02E05556,
+        0x02A05656, 0x02A05756, 0x02A05857, 0x02605957, 0x02605A57, 0x02605B57, 0x02205C58, 0x02205D58,
+        0x02205E58, 0x02205F58,
+    };
+
+    // 0x4eb246
+    // Track 29. Reversed 0. Direction 3
+    static constexpr PackedMoveInfo moveInfoT29R0D3[] = {
+        0x06205F48, 0x06205E48, 0x06205D48, 0x06205C48, 0x05E05B49, 0x05E05A49, 0x05E05949, 0x05A05849,
+        0x05A0574A, 0x05A0564A, 0x0560554A, 0x0560544B, 0x0560534B, 0x0560524C, 0x0520514D, 0x0520504E,
+        0x05204F4F, 0x05204E50, 0x05204D51, 0x04E04C52, 0x04E04B53, 0x04E04B54, 0x04E04A55, 0x04A04A56,
+        0x04A04A57, 0x04A04958, 0x04604959, 0x0460495A, 0x0460495B, 0x0420485C, 0x0420485D, 0x0420485E,
+        0x0420485F,
+    };
+
+    // 0x4ead88
+    // Track 29. Reversed 1. Direction 0
+    static constexpr PackedMoveInfo moveInfoT29R1D0[] = {
+        0x02204048, 0x02204148, 0x02204248, 0x02204348, 0x02204448, 0x02604549, 0x02604649, 0x02604749,
+        0x02A04849, 0x02A0494A, 0x02A04A4A, 0x02E04B4A, 0x02E04C4B, 0x02E04D4B, 0x02E04E4C, 0x03204F4D,
+        0x0320504E, 0x0320514F, 0x03205250, 0x03205351, 0x03605452, 0x03605553, 0x03605554, 0x03605655,
+        0x03A05656, 0x03A05657, 0x03A05758, 0x03E05759, 0x03E0575A, 0x03E0575B, 0x0420585C, 0x0420585D,
+        0x0420585E, 0x0420585F,
+    };
+
+    // 0x4eae9a
+    // Track 29. Reversed 1. Direction 1
+    static constexpr PackedMoveInfo moveInfoT29R1D1[] = {
+        0x04205840, 0x04205841, 0x04205842, 0x04205843, 0x04205844, 0x04605745, 0x04605746, 0x04605747,
+        0x04A05748, 0x04A05649, 0x04A0564A, 0x04E0564B, 0x04E0554C, 0x04E0554D, 0x04E0544E, 0x0520534F,
+        0x05205250, 0x05205151, 0x05205052, 0x05204F53, 0x05604E54, 0x05604D55, 0x05604C55, 0x05604B56,
+        0x05A04A56, 0x05A04956, 0x05A04857, 0x05E04757, 0x05E04657, 0x05E04557, 0x06204458, 0x06204358,
+        0x06204258, 0x06204158, 0x06204058,
+    };
+
+    // 0x4eafb4
+    // Track 29. Reversed 1. Direction 2
+    static constexpr PackedMoveInfo moveInfoT29R1D2[] = {
+        0x06205F58, 0x06205E58, 0x06205D58, 0x06205C58, 0x06605B57, 0x06605A57, 0x06605957, 0x06A05857,
+        0x06A05756, 0x06A05656, 0x06E05556, 0x06E05455, 0x06E05355, 0x06E05254, 0x07205153, 0x07205052,
+        0x07204F51, 0x07204E50, 0x07204D4F, 0x07604C4E, 0x07604B4D, 0x07604B4C, 0x07604A4B, 0x07A04A4A,
+        0x07A04A49, 0x07A04948, 0x07E04947, 0x07E04946, 0x07E04945, 0x00204844, 0x00204843, 0x00204842,
+        0x00204841, 0x00204840,
+    };
+
+    // 0x4eac7e
+    // Track 29. Reversed 1. Direction 3
+    static constexpr PackedMoveInfo moveInfoT29R1D3[] = {
+        0x0020485F, 0x0020485E, 0x0020485D, 0x0020485C, 0x0060495B, 0x0060495A, 0x00604959, 0x00A04958,
+        0x00A04A57, 0x00A04A56, 0x00E04A55, 0x00E04B54, 0x00E04B53, 0x00E04C52, 0x01204D51, 0x01204E50,
+        0x01204F4F, 0x0120504E, 0x0120514D, 0x0160524C, 0x0160534B, 0x0160544B, 0x0160554A, 0x01A0564A,
+        0x01A0574A, 0x01A05849, 0x01E05949, 0x01E05A49, 0x01E05B49, 0x02205C48, 0x02205D48, 0x02205E48,
+        0x02205F48,
+    };
+
+    // 0x4eb68e
+    // Track 32. Reversed 0. Direction 0
+    static constexpr PackedMoveInfo moveInfoT32R0D0[] = {
+        0x0020485F, 0x0020485E, 0x0020485D, 0x0060485C, 0x0060495B, 0x0060495A, 0x00604959, 0x00A04A58,
+        0x00A04A57, 0x00A04B56, 0x00A04B55, 0x00E04C54, 0x00E04D53, 0x00E04E52, 0x01204F51, 0x01205050,
+        0x0120514F, 0x0120524E, 0x00E0534D, 0x00E0544C, 0x00E0544B, 0x00A0554A, 0x00A05549, 0x00A05648,
+        0x00A05647, 0x00605746, 0x00605745, 0x00605744, 0x00605843, 0x00205842, 0x00205841, 0x00205840,
+    };
+
+    // 0x4eb790
+    // Track 32. Reversed 0. Direction 1
+    static constexpr PackedMoveInfo moveInfoT32R0D1[] = {
+        0x02204048, 0x02204148, 0x02204248, 0x02604348, 0x02604449, 0x02604549, 0x02604649, 0x02A0474A,
+        0x02A0484A, 0x02A0494B, 0x02A04A4B, 0x02E04B4C, 0x02E04C4D, 0x02E04D4E, 0x03204E4F, 0x03204F50,
+        0x03205051, 0x03205152, 0x02E05253, 0x02E05354, 0x02E05454, 0x02A05555, 0x02A05655, 0x02A05756,
+        0x02A05856, 0x02605957, 0x02605A57, 0x02605B57, 0x02605C58, 0x02205D58, 0x02205E58, 0x02205F58,
+    };
+
+    // 0x4eb892
+    // Track 32. Reversed 0. Direction 2
+    static constexpr PackedMoveInfo moveInfoT32R0D2[] = {
+        0x04205840, 0x04205841, 0x04205842, 0x04605843, 0x04605744, 0x04605745, 0x04605746, 0x04A05647,
+        0x04A05648, 0x04A05549, 0x04A0554A, 0x04E0544B, 0x04E0544C, 0x04E0534D, 0x0520524E, 0x0520514F,
+        0x05205050, 0x05204F51, 0x04E04E52, 0x04E04D53, 0x04E04C54, 0x04A04B55, 0x04A04B56, 0x04A04A57,
+        0x04A04A58, 0x04604959, 0x0460495A, 0x0460495B, 0x0460485C, 0x0420485D, 0x0420485E, 0x0420485F,
+    };
+
+    // 0x4eb994
+    // Track 32. Reversed 0. Direction 3
+    static constexpr PackedMoveInfo moveInfoT32R0D3[] = {
+        0x06205F58, 0x06205E58, 0x06205D58, 0x06605C58, 0x06605B57, 0x06605A57, 0x06605957, 0x06A05856,
+        0x06A05756, 0x06A05655, 0x06A05555, 0x06E05454, 0x06E05354, 0x06E05253, 0x07205152, 0x07205051,
+        0x07204F50, 0x07204E4F, 0x06E04D4E, 0x06E04C4D, 0x06E04B4C, 0x06A04A4B, 0x06A0494B, 0x06A0484A,
+        0x06A0474A, 0x06604649, 0x06604549, 0x06604449, 0x06604348, 0x06204248, 0x06204148, 0x06204048,
+    };
+
+    // 0x4eba96
+    // Track 33. Reversed 0. Direction 0
+    static constexpr PackedMoveInfo moveInfoT33R0D0[] = {
+        0x0020585F, 0x0020585E, 0x0020585D, 0x07E0585C, 0x07E0575B, 0x07E0575A, 0x07E05759, 0x07A05658,
+        0x07A05657, 0x07A05556, 0x07A05555, 0x07605454, 0x07605453, 0x07605352, 0x07205251, 0x07205150,
+        0x0720504F, 0x07204F4E, 0x07604E4D, 0x07604D4C, 0x07604C4B, 0x07A04B4A, 0x07A04B49, 0x07A04A48,
+        0x07A04A47, 0x07E04946, 0x07E04945, 0x07E04944, 0x07E04843, 0x00204842, 0x00204841, 0x00204840,
+    };
+
+    // 0x4ebb98
+    // Track 33. Reversed 0. Direction 1
+    static constexpr PackedMoveInfo moveInfoT33R0D1[] = {
+        0x02204058, 0x02204158, 0x02204258, 0x01E04358, 0x01E04457, 0x01E04557, 0x01E04657, 0x01A04756,
+        0x01A04856, 0x01A04955, 0x01A04A55, 0x01604B54, 0x01604C54, 0x01604D53, 0x01204E52, 0x01204F51,
+        0x01205050, 0x0120514F, 0x0160524E, 0x0160534D, 0x0160544C, 0x01A0554B, 0x01A0564B, 0x01A0574A,
+        0x01A0584A, 0x01E05949, 0x01E05A49, 0x01E05B49, 0x01E05C48, 0x02205D48, 0x02205E48, 0x02205F48,
+    };
+
+    // 0x4ebc9a
+    // Track 33. Reversed 0. Direction 2
+    static constexpr PackedMoveInfo moveInfoT33R0D2[] = {
+        0x04204840, 0x04204841, 0x04204842, 0x03E04843, 0x03E04944, 0x03E04945, 0x03E04946, 0x03A04A47,
+        0x03A04A48, 0x03A04B49, 0x03A04B4A, 0x03604C4B, 0x03604D4C, 0x03604E4D, 0x03204F4E, 0x0320504F,
+        0x03205150, 0x03205251, 0x03605352, 0x03605453, 0x03605454, 0x03A05555, 0x03A05556, 0x03A05657,
+        0x03A05658, 0x03E05759, 0x03E0575A, 0x03E0575B, 0x03E0585C, 0x0420585D, 0x0420585E, 0x0420585F,
+    };
+
+    // 0x4ebd9c
+    // Track 33. Reversed 0. Direction 3
+    static constexpr PackedMoveInfo moveInfoT33R0D3[] = {
+        0x06205F48, 0x06205E48, 0x06205D48, 0x05E05C48, 0x05E05B49, 0x05E05A49, 0x05E05949, 0x05A0584A,
+        0x05A0574A, 0x05A0564B, 0x05A0554B, 0x0560544C, 0x0560534D, 0x0560524E, 0x0520514F, 0x05205050,
+        0x05204F51, 0x05204E52, 0x05604D53, 0x05604C54, 0x05604B54, 0x05A04A55, 0x05A04955, 0x05A04856,
+        0x05A04756, 0x05E04657, 0x05E04557, 0x05E04457, 0x05E04358, 0x06204258, 0x06204158, 0x06204058,
+    };
+
+    // 0x4dcd66
+    // Track 34. Reversed 0. Direction 0
+    static constexpr PackedMoveInfo moveInfoT34R0D0[] = {
+        0x2020485F, 0x2020485E, 0x2021485D, 0x2021485C, 0x2022485B, 0x2022485A, 0x20234859, 0x20234858,
+        0x20244857, 0x20244856, 0x20254855, 0x20254854, 0x20264853, 0x20264852, 0x20274851, 0x20274850,
+        0x2028484F, 0x2028484E, 0x2029484D, 0x2029484C, 0x202A484B, 0x202A484A, 0x202B4849, 0x202B4848,
+        0x202C4847, 0x202C4846, 0x202D4845, 0x202D4844, 0x202E4843, 0x202E4842, 0x202F4841, 0x202F4840,
+    };
+
+    // 0x4dce68
+    // Track 34. Reversed 0. Direction 1
+    static constexpr PackedMoveInfo moveInfoT34R0D1[] = {
+        0x22204048, 0x22204148, 0x22214248, 0x22214348, 0x22224448, 0x22224548, 0x22234648, 0x22234748,
+        0x22244848, 0x22244948, 0x22254A48, 0x22254B48, 0x22264C48, 0x22264D48, 0x22274E48, 0x22274F48,
+        0x22285048, 0x22285148, 0x22295248, 0x22295348, 0x222A5448, 0x222A5548, 0x222B5648, 0x222B5748,
+        0x222C5848, 0x222C5948, 0x222D5A48, 0x222D5B48, 0x222E5C48, 0x222E5D48, 0x222F5E48, 0x222F5F48,
+    };
+
+    // 0x4dcf6a
+    // Track 34. Reversed 0. Direction 2
+    static constexpr PackedMoveInfo moveInfoT34R0D2[] = {
+        0x24205840, 0x24205841, 0x24215842, 0x24215843, 0x24225844, 0x24225845, 0x24235846, 0x24235847,
+        0x24245848, 0x24245849, 0x2425584A, 0x2425584B, 0x2426584C, 0x2426584D, 0x2427584E, 0x2427584F,
+        0x24285850, 0x24285851, 0x24295852, 0x24295853, 0x242A5854, 0x242A5855, 0x242B5856, 0x242B5857,
+        0x242C5858, 0x242C5859, 0x242D585A, 0x242D585B, 0x242E585C, 0x242E585D, 0x242F585E, 0x242F585F,
+    };
+
+    // 0x4dd06c
+    // Track 34. Reversed 0. Direction 3
+    static constexpr PackedMoveInfo moveInfoT34R0D3[] = {
+        0x26205F58, 0x26205E58, 0x26215D58, 0x26215C58, 0x26225B58, 0x26225A58, 0x26235958, 0x26235858,
+        0x26245758, 0x26245658, 0x26255558, 0x26255458, 0x26265358, 0x26265258, 0x26275158, 0x26275058,
+        0x26284F58, 0x26284E58, 0x26294D58, 0x26294C58, 0x262A4B58, 0x262A4A58, 0x262B4958, 0x262B4858,
+        0x262C4758, 0x262C4658, 0x262D4558, 0x262D4458, 0x262E4358, 0x262E4258, 0x262F4158, 0x262F4058,
+    };
+
+    // 0x4ddb82
+    // Track 34. Reversed 1. Direction 0
+    static constexpr PackedMoveInfo moveInfoT34R1D0[] = {
+        0x44204840, 0x44204841, 0x441F4842, 0x441F4843, 0x441E4844, 0x441E4845, 0x441D4846, 0x441D4847,
+        0x441C4848, 0x441C4849, 0x441B484A, 0x441B484B, 0x441A484C, 0x441A484D, 0x4419484E, 0x4419484F,
+        0x44184850, 0x44184851, 0x44174852, 0x44174853, 0x44164854, 0x44164855, 0x44154856, 0x44154857,
+        0x44144858, 0x44144859, 0x4413485A, 0x4413485B, 0x4412485C, 0x4412485D, 0x4411485E, 0x4411485F,
+    };
+
+    // 0x4ddc84
+    // Track 34. Reversed 1. Direction 1
+    static constexpr PackedMoveInfo moveInfoT34R1D1[] = {
+        0x46205F48, 0x46205E48, 0x461F5D48, 0x461F5C48, 0x461E5B48, 0x461E5A48, 0x461D5948, 0x461D5848,
+        0x461C5748, 0x461C5648, 0x461B5548, 0x461B5448, 0x461A5348, 0x461A5248, 0x46195148, 0x46195048,
+        0x46184F48, 0x46184E48, 0x46174D48, 0x46174C48, 0x46164B48, 0x46164A48, 0x46154948, 0x46154848,
+        0x46144748, 0x46144648, 0x46134548, 0x46134448, 0x46124348, 0x46124248, 0x46114148, 0x46114048,
+    };
+
+    // 0x4dd97e
+    // Track 34. Reversed 1. Direction 2
+    static constexpr PackedMoveInfo moveInfoT34R1D2[] = {
+        0x4020585F, 0x4020585E, 0x401F585D, 0x401F585C, 0x401E585B, 0x401E585A, 0x401D5859, 0x401D5858,
+        0x401C5857, 0x401C5856, 0x401B5855, 0x401B5854, 0x401A5853, 0x401A5852, 0x40195851, 0x40195850,
+        0x4018584F, 0x4018584E, 0x4017584D, 0x4017584C, 0x4016584B, 0x4016584A, 0x40155849, 0x40155848,
+        0x40145847, 0x40145846, 0x40135845, 0x40135844, 0x40125843, 0x40125842, 0x40115841, 0x40115840,
+    };
+
+    // 0x4dda80
+    // Track 34. Reversed 1. Direction 3
+    static constexpr PackedMoveInfo moveInfoT34R1D3[] = {
+        0x42204058, 0x42204158, 0x421F4258, 0x421F4358, 0x421E4458, 0x421E4558, 0x421D4658, 0x421D4758,
+        0x421C4858, 0x421C4958, 0x421B4A58, 0x421B4B58, 0x421A4C58, 0x421A4D58, 0x42194E58, 0x42194F58,
+        0x42185058, 0x42185158, 0x42175258, 0x42175358, 0x42165458, 0x42165558, 0x42155658, 0x42155758,
+        0x42145858, 0x42145958, 0x42135A58, 0x42135B58, 0x42125C58, 0x42125D58, 0x42115E58, 0x42115F58,
+    };
+
+    // 0x4dd576
+    // Track 35. Reversed 0. Direction 0
+    static constexpr PackedMoveInfo moveInfoT35R0D0[] = {
+        0x2020585F, 0x2020585E, 0x2021585D, 0x2021585C, 0x2022585B, 0x2022585A, 0x20235859, 0x20235858,
+        0x20245857, 0x20245856, 0x20255855, 0x20255854, 0x20265853, 0x20265852, 0x20275851, 0x20275850,
+        0x2028584F, 0x2028584E, 0x2029584D, 0x2029584C, 0x202A584B, 0x202A584A, 0x202B5849, 0x202B5848,
+        0x202C5847, 0x202C5846, 0x202D5845, 0x202D5844, 0x202E5843, 0x202E5842, 0x202F5841, 0x202F5840,
+    };
+
+    // 0x4dd678
+    // Track 35. Reversed 0. Direction 1
+    static constexpr PackedMoveInfo moveInfoT35R0D1[] = {
+        0x22204058, 0x22204158, 0x22214258, 0x22214358, 0x22224458, 0x22224558, 0x22234658, 0x22234758,
+        0x22244858, 0x22244958, 0x22254A58, 0x22254B58, 0x22264C58, 0x22264D58, 0x22274E58, 0x22274F58,
+        0x22285058, 0x22285158, 0x22295258, 0x22295358, 0x222A5458, 0x222A5558, 0x222B5658, 0x222B5758,
+        0x222C5858, 0x222C5958, 0x222D5A58, 0x222D5B58, 0x222E5C58, 0x222E5D58, 0x222F5E58, 0x222F5F58,
+    };
+
+    // 0x4dd77a
+    // Track 35. Reversed 0. Direction 2
+    static constexpr PackedMoveInfo moveInfoT35R0D2[] = {
+        0x24204840, 0x24204841, 0x24214842, 0x24214843, 0x24224844, 0x24224845, 0x24234846, 0x24234847,
+        0x24244848, 0x24244849, 0x2425484A, 0x2425484B, 0x2426484C, 0x2426484D, 0x2427484E, 0x2427484F,
+        0x24284850, 0x24284851, 0x24294852, 0x24294853, 0x242A4854, 0x242A4855, 0x242B4856, 0x242B4857,
+        0x242C4858, 0x242C4859, 0x242D485A, 0x242D485B, 0x242E485C, 0x242E485D, 0x242F485E, 0x242F485F,
+    };
+
+    // 0x4dd87c
+    // Track 35. Reversed 0. Direction 3
+    static constexpr PackedMoveInfo moveInfoT35R0D3[] = {
+        0x26205F48, 0x26205E48, 0x26215D48, 0x26215C48, 0x26225B48, 0x26225A48, 0x26235948, 0x26235848,
+        0x26245748, 0x26245648, 0x26255548, 0x26255448, 0x26265348, 0x26265248, 0x26275148, 0x26275048,
+        0x26284F48, 0x26284E48, 0x26294D48, 0x26294C48, 0x262A4B48, 0x262A4A48, 0x262B4948, 0x262B4848,
+        0x262C4748, 0x262C4648, 0x262D4548, 0x262D4448, 0x262E4348, 0x262E4248, 0x262F4148, 0x262F4048,
+    };
+
+    // 0x4dd372
+    // Track 35. Reversed 1. Direction 0
+    static constexpr PackedMoveInfo moveInfoT35R1D0[] = {
+        0x44205840, 0x44205841, 0x441F5842, 0x441F5843, 0x441E5844, 0x441E5845, 0x441D5846, 0x441D5847,
+        0x441C5848, 0x441C5849, 0x441B584A, 0x441B584B, 0x441A584C, 0x441A584D, 0x4419584E, 0x4419584F,
+        0x44185850, 0x44185851, 0x44175852, 0x44175853, 0x44165854, 0x44165855, 0x44155856, 0x44155857,
+        0x44145858, 0x44145859, 0x4413585A, 0x4413585B, 0x4412585C, 0x4412585D, 0x4411585E, 0x4411585F,
+    };
+
+    // 0x4dd474
+    // Track 35. Reversed 1. Direction 1
+    static constexpr PackedMoveInfo moveInfoT35R1D1[] = {
+        0x46205F58, 0x46205E58, 0x461F5D58, 0x461F5C58, 0x461E5B58, 0x461E5A58, 0x461D5958, 0x461D5858,
+        0x461C5758, 0x461C5658, 0x461B5558, 0x461B5458, 0x461A5358, 0x461A5258, 0x46195158, 0x46195058,
+        0x46184F58, 0x46184E58, 0x46174D58, 0x46174C58, 0x46164B58, 0x46164A58, 0x46154958, 0x46154858,
+        0x46144758, 0x46144658, 0x46134558, 0x46134458, 0x46124358, 0x46124258, 0x46114158, 0x46114058,
+    };
+
+    // 0x4dd16e
+    // Track 35. Reversed 1. Direction 2
+    static constexpr PackedMoveInfo moveInfoT35R1D2[] = {
+        0x4020485F, 0x4020485E, 0x401F485D, 0x401F485C, 0x401E485B, 0x401E485A, 0x401D4859, 0x401D4858,
+        0x401C4857, 0x401C4856, 0x401B4855, 0x401B4854, 0x401A4853, 0x401A4852, 0x40194851, 0x40194850,
+        0x4018484F, 0x4018484E, 0x4017484D, 0x4017484C, 0x4016484B, 0x4016484A, 0x40154849, 0x40154848,
+        0x40144847, 0x40144846, 0x40134845, 0x40134844, 0x40124843, 0x40124842, 0x40114841, 0x40114840,
+    };
+
+    // 0x4dd270
+    // Track 35. Reversed 1. Direction 3
+    static constexpr PackedMoveInfo moveInfoT35R1D3[] = {
+        0x42204048, 0x42204148, 0x421F4248, 0x421F4348, 0x421E4448, 0x421E4548, 0x421D4648, 0x421D4748,
+        0x421C4848, 0x421C4948, 0x421B4A48, 0x421B4B48, 0x421A4C48, 0x421A4D48, 0x42194E48, 0x42194F48,
+        0x42185048, 0x42185148, 0x42175248, 0x42175348, 0x42165448, 0x42165548, 0x42155648, 0x42155748,
+        0x42145848, 0x42145948, 0x42135A48, 0x42135B48, 0x42125C48, 0x42125D48, 0x42115E48, 0x42115F48,
+    };
+
+    // 0x4ddd86
+    // Track 38. Reversed 0. Direction 0
+    static constexpr PackedMoveInfo moveInfoT38R0D0[] = {
+        0x0020505F, 0x0020505E, 0x0020505D, 0x0020505C, 0x07E0505B, 0x07E04F5A, 0x07E04F59, 0x07E04F58,
+        0x07A04F57, 0x07A04E56, 0x07A04E55, 0x07A04E54, 0x07A04D53, 0x07A04D52, 0x07A04D51, 0x07A04C50,
+        0x07A04C4F, 0x07A04B4E, 0x07A04B4D, 0x07A04B4C, 0x07A04A4B, 0x07A04A4A, 0x07A04A49, 0x07A04948,
+        0x07E04947, 0x07E04946, 0x07E04945, 0x07E04844, 0x00204843, 0x00204842, 0x00204841, 0x00204840,
+    };
+
+    // 0x4dde88
+    // Track 38. Reversed 0. Direction 1
+    static constexpr PackedMoveInfo moveInfoT38R0D1[] = {
+        0x02204050, 0x02204150, 0x02204250, 0x02204350, 0x01E04450, 0x01E0454F, 0x01E0464F, 0x01E0474F,
+        0x01A0484F, 0x01A0494E, 0x01A04A4E, 0x01A04B4E, 0x01A04C4D, 0x01A04D4D, 0x01A04E4D, 0x01A04F4C,
+        0x01A0504C, 0x01A0514B, 0x01A0524B, 0x01A0534B, 0x01A0544A, 0x01A0554A, 0x01A0564A, 0x01A05749,
+        0x01E05849, 0x01E05949, 0x01E05A49, 0x01E05B48, 0x02205C48, 0x02205D48, 0x02205E48, 0x02205F48,
+    };
+
+    // 0x4ddf8a
+    // Track 38. Reversed 0. Direction 2
+    static constexpr PackedMoveInfo moveInfoT38R0D2[] = {
+        0x04205040, 0x04205041, 0x04205042, 0x04205043, 0x03E05044, 0x03E05145, 0x03E05146, 0x03E05147,
+        0x03A05148, 0x03A05249, 0x03A0524A, 0x03A0524B, 0x03A0534C, 0x03A0534D, 0x03A0534E, 0x03A0544F,
+        0x03A05450, 0x03A05551, 0x03A05552, 0x03A05553, 0x03A05654, 0x03A05655, 0x03A05656, 0x03A05757,
+        0x03E05758, 0x03E05759, 0x03E0575A, 0x03E0585B, 0x0420585C, 0x0420585D, 0x0420585E, 0x0420585F,
+    };
+
+    // 0x4de08c
+    // Track 38. Reversed 0. Direction 3
+    static constexpr PackedMoveInfo moveInfoT38R0D3[] = {
+        0x06205F50, 0x06205E50, 0x06205D50, 0x06205C50, 0x05E05B50, 0x05E05A51, 0x05E05951, 0x05E05851,
+        0x05A05751, 0x05A05652, 0x05A05552, 0x05A05452, 0x05A05353, 0x05A05253, 0x05A05153, 0x05A05054,
+        0x05A04F54, 0x05A04E55, 0x05A04D55, 0x05A04C55, 0x05A04B56, 0x05A04A56, 0x05A04956, 0x05A04857,
+        0x05E04757, 0x05E04657, 0x05E04557, 0x05E04458, 0x06204358, 0x06204258, 0x06204158, 0x06204058,
+    };
+
+    // 0x4deba2
+    // Track 38. Reversed 1. Direction 0
+    static constexpr PackedMoveInfo moveInfoT38R1D0[] = {
+        0x04204840, 0x04204841, 0x04204842, 0x04204843, 0x03E04844, 0x03E04945, 0x03E04946, 0x03E04947,
+        0x03A04948, 0x03A04A49, 0x03A04A4A, 0x03A04A4B, 0x03A04B4C, 0x03A04B4D, 0x03A04B4E, 0x03A04C4F,
+        0x03A04C50, 0x03A04D51, 0x03A04D52, 0x03A04D53, 0x03A04E54, 0x03A04E55, 0x03A04E56, 0x03A04F57,
+        0x03E04F58, 0x03E04F59, 0x03E04F5A, 0x03E0505B, 0x0420505C, 0x0420505D, 0x0420505E, 0x0420505F,
+    };
+
+    // 0x4deca4
+    // Track 38. Reversed 1. Direction 1
+    static constexpr PackedMoveInfo moveInfoT38R1D1[] = {
+        0x06205F48, 0x06205E48, 0x06205D48, 0x06205C48, 0x05E05B48, 0x05E05A49, 0x05E05949, 0x05E05849,
+        0x05A05749, 0x05A0564A, 0x05A0554A, 0x05A0544A, 0x05A0534B, 0x05A0524B, 0x05A0514B, 0x05A0504C,
+        0x05A04F4C, 0x05A04E4D, 0x05A04D4D, 0x05A04C4D, 0x05A04B4E, 0x05A04A4E, 0x05A0494E, 0x05A0484F,
+        0x05E0474F, 0x05E0464F, 0x05E0454F, 0x05E04450, 0x06204350, 0x06204250, 0x06204150, 0x06204050,
+    };
+
+    // 0x4de99e
+    // Track 38. Reversed 1. Direction 2
+    static constexpr PackedMoveInfo moveInfoT38R1D2[] = {
+        0x0020585F, 0x0020585E, 0x0020585D, 0x0020585C, 0x07E0585B, 0x07E0575A, 0x07E05759, 0x07E05758,
+        0x07A05757, 0x07A05656, 0x07A05655, 0x07A05654, 0x07A05553, 0x07A05552, 0x07A05551, 0x07A05450,
+        0x07A0544F, 0x07A0534E, 0x07A0534D, 0x07A0534C, 0x07A0524B, 0x07A0524A, 0x07A05249, 0x07A05148,
+        0x07E05147, 0x07E05146, 0x07E05145, 0x07E05044, 0x00205043, 0x00205042, 0x00205041, 0x00205040,
+    };
+
+    // 0x4deaa0
+    // Track 38. Reversed 1. Direction 3
+    static constexpr PackedMoveInfo moveInfoT38R1D3[] = {
+        0x02204058, 0x02204158, 0x02204258, 0x02204358, 0x01E04458, 0x01E04557, 0x01E04657, 0x01E04757,
+        0x01A04857, 0x01A04956, 0x01A04A56, 0x01A04B56, 0x01A04C55, 0x01A04D55, 0x01A04E55, 0x01A04F54,
+        0x01A05054, 0x01A05153, 0x01A05253, 0x01A05353, 0x01A05452, 0x01A05552, 0x01A05652, 0x01A05751,
+        0x01E05851, 0x01E05951, 0x01E05A51, 0x01E05B50, 0x02205C50, 0x02205D50, 0x02205E50, 0x02205F50,
+    };
+
+    // 0x4de18e
+    // Track 39. Reversed 0. Direction 0
+    static constexpr PackedMoveInfo moveInfoT39R0D0[] = {
+        0x0020505F, 0x0020505E, 0x0020505D, 0x0020505C, 0x0060505B, 0x0060515A, 0x00605159, 0x00605158,
+        0x00A05157, 0x00A05256, 0x00A05255, 0x00A05254, 0x00A05353, 0x00A05352, 0x00A05351, 0x00A05450,
+        0x00A0544F, 0x00A0554E, 0x00A0554D, 0x00A0554C, 0x00A0564B, 0x00A0564A, 0x00A05649, 0x00A05748,
+        0x00605747, 0x00605746, 0x00605745, 0x00605844, 0x00205843, 0x00205842, 0x00205841, 0x00205840,
+    };
+
+    // 0x4de290
+    // Track 39. Reversed 0. Direction 1
+    static constexpr PackedMoveInfo moveInfoT39R0D1[] = {
+        0x02204050, 0x02204150, 0x02204250, 0x02204350, 0x02604450, 0x02604551, 0x02604651, 0x02604751,
+        0x02A04851, 0x02A04952, 0x02A04A52, 0x02A04B52, 0x02A04C53, 0x02A04D53, 0x02A04E53, 0x02A04F54,
+        0x02A05054, 0x02A05155, 0x02A05255, 0x02A05355, 0x02A05456, 0x02A05556, 0x02A05656, 0x02A05757,
+        0x02605857, 0x02605957, 0x02605A57, 0x02605B58, 0x02205C58, 0x02205D58, 0x02205E58, 0x02205F58,
+    };
+
+    // 0x4de392
+    // Track 39. Reversed 0. Direction 2
+    static constexpr PackedMoveInfo moveInfoT39R0D2[] = {
+        0x04205040, 0x04205041, 0x04205042, 0x04205043, 0x04605044, 0x04604F45, 0x04604F46, 0x04604F47,
+        0x04A04F48, 0x04A04E49, 0x04A04E4A, 0x04A04E4B, 0x04A04D4C, 0x04A04D4D, 0x04A04D4E, 0x04A04C4F,
+        0x04A04C50, 0x04A04B51, 0x04A04B52, 0x04A04B53, 0x04A04A54, 0x04A04A55, 0x04A04A56, 0x04A04957,
+        0x04604958, 0x04604959, 0x0460495A, 0x0460485B, 0x0420485C, 0x0420485D, 0x0420485E, 0x0420485F,
+    };
+
+    // 0x4de494
+    // Track 39. Reversed 0. Direction 3
+    static constexpr PackedMoveInfo moveInfoT39R0D3[] = {
+        0x06205F50, 0x06205E50, 0x06205D50, 0x06205C50, 0x06605B50, 0x06605A4F, 0x0660594F, 0x0660584F,
+        0x06A0574F, 0x06A0564E, 0x06A0554E, 0x06A0544E, 0x06A0534D, 0x06A0524D, 0x06A0514D, 0x06A0504C,
+        0x06A04F4C, 0x06A04E4B, 0x06A04D4B, 0x06A04C4B, 0x06A04B4A, 0x06A04A4A, 0x06A0494A, 0x06A04849,
+        0x06604749, 0x06604649, 0x06604549, 0x06604448, 0x06204348, 0x06204248, 0x06204148, 0x06204048,
+    };
+
+    // 0x4de79a
+    // Track 39. Reversed 1. Direction 0
+    static constexpr PackedMoveInfo moveInfoT39R1D0[] = {
+        0x04205840, 0x04205841, 0x04205842, 0x04205843, 0x04605844, 0x04605745, 0x04605746, 0x04605747,
+        0x04A05748, 0x04A05649, 0x04A0564A, 0x04A0564B, 0x04A0554C, 0x04A0554D, 0x04A0554E, 0x04A0544F,
+        0x04A05450, 0x04A05351, 0x04A05352, 0x04A05353, 0x04A05254, 0x04A05255, 0x04A05256, 0x04A05157,
+        0x04605158, 0x04605159, 0x0460515A, 0x0460505B, 0x0420505C, 0x0420505D, 0x0420505E, 0x0420505F,
+    };
+
+    // 0x4de89c
+    // Track 39. Reversed 1. Direction 1
+    static constexpr PackedMoveInfo moveInfoT39R1D1[] = {
+        0x06205F58, 0x06205E58, 0x06205D58, 0x06205C58, 0x06605B58, 0x06605A57, 0x06605957, 0x06605857,
+        0x06A05757, 0x06A05656, 0x06A05556, 0x06A05456, 0x06A05355, 0x06A05255, 0x06A05155, 0x06A05054,
+        0x06A04F54, 0x06A04E53, 0x06A04D53, 0x06A04C53, 0x06A04B52, 0x06A04A52, 0x06A04952, 0x06A04851,
+        0x06604751, 0x06604651, 0x06604551, 0x06604450, 0x06204350, 0x06204250, 0x06204150, 0x06204050,
+    };
+
+    // 0x4de596
+    // Track 39. Reversed 1. Direction 2
+    static constexpr PackedMoveInfo moveInfoT39R1D2[] = {
+        0x0020485F, 0x0020485E, 0x0020485D, 0x0020485C, 0x0060485B, 0x0060495A, 0x00604959, 0x00604958,
+        0x00A04957, 0x00A04A56, 0x00A04A55, 0x00A04A54, 0x00A04B53, 0x00A04B52, 0x00A04B51, 0x00A04C50,
+        0x00A04C4F, 0x00A04D4E, 0x00A04D4D, 0x00A04D4C, 0x00A04E4B, 0x00A04E4A, 0x00A04E49, 0x00A04F48,
+        0x00604F47, 0x00604F46, 0x00604F45, 0x00605044, 0x00205043, 0x00205042, 0x00205041, 0x00205040,
+    };
+
+    // 0x4de698
+    // Track 39. Reversed 1. Direction 3
+    static constexpr PackedMoveInfo moveInfoT39R1D3[] = {
+        0x02204048, 0x02204148, 0x02204248, 0x02204348, 0x02604448, 0x02604549, 0x02604649, 0x02604749,
+        0x02A04849, 0x02A0494A, 0x02A04A4A, 0x02A04B4A, 0x02A04C4B, 0x02A04D4B, 0x02A04E4B, 0x02A04F4C,
+        0x02A0504C, 0x02A0514D, 0x02A0524D, 0x02A0534D, 0x02A0544E, 0x02A0554E, 0x02A0564E, 0x02A0574F,
+        0x0260584F, 0x0260594F, 0x02605A4F, 0x02605B50, 0x02205C50, 0x02205D50, 0x02205E50, 0x02205F50,
+    };
+
+    // 0x4deda6
+    // Track 42. Reversed 0. Direction 0
+    static constexpr PackedMoveInfo moveInfoT42R0D0[] = {
+        0x0020485F, 0x0020485E, 0x0060485D, 0x0060495C, 0x0060495B, 0x00A04A5A, 0x00A04B59, 0x00E04C59,
+        0x00E04D58, 0x00E04E58, 0x02204F58, 0x02205058, 0x02205158, 0x02605258, 0x02605358, 0x02605459,
+        0x02A05559, 0x02A0565A, 0x02E0575B, 0x02E0575C, 0x02E0585D, 0x0420585E, 0x0420585F,
+    };
+
+    // 0x4dee60
+    // Track 42. Reversed 0. Direction 1
+    static constexpr PackedMoveInfo moveInfoT42R0D1[] = {
+        0x02204048, 0x02204148, 0x02604248, 0x02604349, 0x02604449, 0x02A0454A, 0x02A0464B, 0x02E0464C,
+        0x02E0474D, 0x02E0474E, 0x0420474F, 0x04204750, 0x04204751, 0x04604752, 0x04604753, 0x04604654,
+        0x04A04655, 0x04A04556, 0x04E04457, 0x04E04357, 0x04E04258, 0x06204158, 0x06204058,
+    };
+
+    // 0x4def1a
+    // Track 42. Reversed 0. Direction 2
+    static constexpr PackedMoveInfo moveInfoT42R0D2[] = {
+        0x04205840, 0x04205841, 0x04605842, 0x04605743, 0x04605744, 0x04A05645, 0x04A05546, 0x04E05446,
+        0x04E05347, 0x04E05247, 0x06205147, 0x06205047, 0x06204F47, 0x06604E47, 0x06604D47, 0x06604C46,
+        0x06A04B46, 0x06A04A45, 0x06E04944, 0x06E04943, 0x06E04842, 0x00204841, 0x00204840,
+    };
+
+    // 0x4defd4
+    // Track 42. Reversed 0. Direction 3
+    static constexpr PackedMoveInfo moveInfoT42R0D3[] = {
+        0x06205F58, 0x06205E58, 0x06605D58, 0x06605C57, 0x06605B57, 0x06A05A56, 0x06A05955, 0x06E05954,
+        0x06E05853, 0x06E05852, 0x00205851, 0x00205850, 0x0020584F, 0x0060584E, 0x0060584D, 0x0060594C,
+        0x00A0594B, 0x00A05A4A, 0x00E05B49, 0x00E05C49, 0x00E05D48, 0x02205E48, 0x02205F48,
+    };
+
+    // 0x4df08e
+    // Track 42. Reversed 1. Direction 0
+    static constexpr PackedMoveInfo moveInfoT42R1D0[] = {
+        0x0020585F, 0x0020585E, 0x06E0585D, 0x06E0575C, 0x06E0575B, 0x06A0565A, 0x06A05559, 0x06605459,
+        0x06605358, 0x06605258, 0x06205158, 0x06205058, 0x06204F58, 0x04E04E58, 0x04E04D58, 0x04E04C59,
+        0x04A04B59, 0x04A04A5A, 0x0460495B, 0x0460495C, 0x0460485D, 0x0420485E, 0x0420485F,
+    };
+
+    // 0x4df148
+    // Track 42. Reversed 1. Direction 1
+    static constexpr PackedMoveInfo moveInfoT42R1D1[] = {
+        0x02204058, 0x02204158, 0x00E04258, 0x00E04357, 0x00E04457, 0x00A04556, 0x00A04655, 0x00604654,
+        0x00604753, 0x00604752, 0x00204751, 0x00204750, 0x0020474F, 0x06E0474E, 0x06E0474D, 0x06E0464C,
+        0x06A0464B, 0x06A0454A, 0x06604449, 0x06604349, 0x06604248, 0x06204148, 0x06204048,
+    };
+
+    // 0x4df202
+    // Track 42. Reversed 1. Direction 2
+    static constexpr PackedMoveInfo moveInfoT42R1D2[] = {
+        0x04204840, 0x04204841, 0x02E04842, 0x02E04943, 0x02E04944, 0x02A04A45, 0x02A04B46, 0x02604C46,
+        0x02604D47, 0x02604E47, 0x02204F47, 0x02205047, 0x02205147, 0x00E05247, 0x00E05347, 0x00E05446,
+        0x00A05546, 0x00A05645, 0x00605744, 0x00605743, 0x00605842, 0x00205841, 0x00205840,
+    };
+
+    // 0x4df2bc
+    // Track 42. Reversed 1. Direction 3
+    static constexpr PackedMoveInfo moveInfoT42R1D3[] = {
+        0x06205F48, 0x06205E48, 0x04E05D48, 0x04E05C49, 0x04E05B49, 0x04A05A4A, 0x04A0594B, 0x0460594C,
+        0x0460584D, 0x0460584E, 0x0420584F, 0x04205850, 0x04205851, 0x02E05852, 0x02E05853, 0x02E05954,
+        0x02A05955, 0x02A05A56, 0x02605B57, 0x02605C57, 0x02605D58, 0x02205E58, 0x02205F58,
+    };
+
+    // 0x4dc556
+    // Turnaround 0. Lane 0. Track 0. Reversed 0. Direction 0
+    // Same entries as moveInfoT26R0D0
+    static constexpr auto& moveInfoTA0L0T0R0D0 = moveInfoT26R0D0;
+
+    // 0x4dc658
+    // Turnaround 0. Lane 0. Track 0. Reversed 0. Direction 1
+    // Same entries as moveInfoT26R0D1
+    static constexpr auto& moveInfoTA0L0T0R0D1 = moveInfoT26R0D1;
+
+    // 0x4dc75a
+    // Turnaround 0. Lane 0. Track 0. Reversed 0. Direction 2
+    // Same entries as moveInfoT26R0D2
+    static constexpr auto& moveInfoTA0L0T0R0D2 = moveInfoT26R0D2;
+
+    // 0x4dc85c
+    // Turnaround 0. Lane 0. Track 0. Reversed 0. Direction 3
+    // Same entries as moveInfoT26R0D3
+    static constexpr auto& moveInfoTA0L0T0R0D3 = moveInfoT26R0D3;
+
+    // 0x4eaafe
+    // Turnaround 0. Lane 0. Track 1. Reversed 0. Direction 0
+    // Same entries as moveInfoT28R0D0
+    static constexpr auto& moveInfoTA0L0T1R0D0 = moveInfoT28R0D0;
+
+    // 0x4eab60
+    // Turnaround 0. Lane 0. Track 1. Reversed 0. Direction 1
+    // Same entries as moveInfoT28R0D1
+    static constexpr auto& moveInfoTA0L0T1R0D1 = moveInfoT28R0D1;
+
+    // 0x4eabc2
+    // Turnaround 0. Lane 0. Track 1. Reversed 0. Direction 2
+    // Same entries as moveInfoT28R0D2
+    static constexpr auto& moveInfoTA0L0T1R0D2 = moveInfoT28R0D2;
+
+    // 0x4eac24
+    // Turnaround 0. Lane 0. Track 1. Reversed 0. Direction 3
+    // Same entries as moveInfoT28R0D3
+    static constexpr auto& moveInfoTA0L0T1R0D3 = moveInfoT28R0D3;
+
+    // 0x4ead88
+    // Turnaround 0. Lane 0. Track 1. Reversed 1. Direction 0
+    // Same entries as moveInfoT29R1D0
+    static constexpr auto& moveInfoTA0L0T1R1D0 = moveInfoT29R1D0;
+
+    // 0x4eae9a
+    // Turnaround 0. Lane 0. Track 1. Reversed 1. Direction 1
+    // Same entries as moveInfoT29R1D1
+    static constexpr auto& moveInfoTA0L0T1R1D1 = moveInfoT29R1D1;
+
+    // 0x4eafb4
+    // Turnaround 0. Lane 0. Track 1. Reversed 1. Direction 2
+    // Same entries as moveInfoT29R1D2
+    static constexpr auto& moveInfoTA0L0T1R1D2 = moveInfoT29R1D2;
+
+    // 0x4eac7e
+    // Turnaround 0. Lane 0. Track 1. Reversed 1. Direction 3
+    // Same entries as moveInfoT29R1D3
+    static constexpr auto& moveInfoTA0L0T1R1D3 = moveInfoT29R1D3;
+
+    // 0x4edebe
+    // Turnaround 0. Lane 0. Track 3. Reversed 0. Direction 0
+    static constexpr PackedMoveInfo moveInfoTA0L0T3R0D0[] = {
+        0x0020485F, 0x0020485E, 0x0020485D, 0x07E0485C, 0x07E0485B, 0x07E0485A, 0x07E04759, 0x07E04758,
+        0x07E04757, 0x07E04756, 0x07E04655, 0x07A04654, 0x07A04653, 0x07A04652, 0x07A04551, 0x07A04550,
+        0x07A0454F, 0x07A0444E, 0x0760444D, 0x0760434C, 0x0760424B, 0x0760424A, 0x07604149, 0x07604048,
+        0x07203F47, 0x07203E46, 0x07203E45, 0x07203D44, 0x07203D43, 0x07203C42, 0x07203B42, 0x06E03A41,
+        0x06E03940, 0x06E0383F, 0x06E0373E, 0x06E0363E, 0x06E0353D, 0x06E0343C, 0x06A0333C, 0x06A0323B,
+        0x06A0313B, 0x06A0303B, 0x06A02F3A, 0x06A02E3A, 0x06A02D3A, 0x06A02C3A, 0x06602B39, 0x06602A39,
+        0x06602939, 0x06602839, 0x06602738, 0x06602638, 0x06602538, 0x06202438, 0x06202338, 0x06202238,
+        0x06202138, 0x06202038,
+    };
+
+    // 0x4ee090
+    // Turnaround 0. Lane 0. Track 3. Reversed 0. Direction 1
+    static constexpr PackedMoveInfo moveInfoTA0L0T3R0D1[] = {
+        0x02204048, 0x02204148, 0x02204248, 0x02204348, 0x01E04448, 0x01E04548, 0x01E04648, 0x01E04747,
+        0x01E04847, 0x01E04947, 0x01E04A47, 0x01E04B46, 0x01A04C46, 0x01A04D46, 0x01A04E46, 0x01A04F45,
+        0x01A05045, 0x01A05145, 0x01A05244, 0x01605344, 0x01605443, 0x01605542, 0x01605642, 0x01605741,
+        0x01605840, 0x0120593F, 0x01205A3E, 0x01205B3E, 0x01205C3D, 0x01205D3D, 0x01205E3C, 0x01205E3B,
+        0x00E05F3A, 0x00E06039, 0x00E06138, 0x00E06237, 0x00E06236, 0x00E06335, 0x00E06434, 0x00A06433,
+        0x00A06532, 0x00A06531, 0x00A06530, 0x00A0662F, 0x00A0662E, 0x00A0662D, 0x00A0662C, 0x0060672B,
+        0x0060672A, 0x00606729, 0x00606728, 0x00606827, 0x00606826, 0x00606825, 0x00206824, 0x00206823,
+        0x00206822, 0x00206821, 0x00206820,
+    };
+
+    // 0x4ee26a
+    // Turnaround 0. Lane 0. Track 3. Reversed 0. Direction 2
+    static constexpr PackedMoveInfo moveInfoTA0L0T3R0D2[] = {
+        0x04205840, 0x04205841, 0x04205842, 0x04205843, 0x03E05844, 0x03E05845, 0x03E05846, 0x03E05947,
+        0x03E05948, 0x03E05949, 0x03E0594A, 0x03E05A4B, 0x03A05A4C, 0x03A05A4D, 0x03A05A4E, 0x03A05B4F,
+        0x03A05B50, 0x03A05B51, 0x03A05C52, 0x03605C53, 0x03605D54, 0x03605E55, 0x03605E56, 0x03605F57,
+        0x03606058, 0x03206159, 0x0320625A, 0x0320625B, 0x0320635C, 0x0320635D, 0x0320645E, 0x0320655E,
+        0x02E0665F, 0x02E06760, 0x02E06861, 0x02E06962, 0x02E06A62, 0x02E06B63, 0x02E06C64, 0x02A06D64,
+        0x02A06E65, 0x02A06F65, 0x02A07065, 0x02A07166, 0x02A07266, 0x02A07366, 0x02A07466, 0x02607567,
+        0x02607667, 0x02607767, 0x02607867, 0x02607968, 0x02607A68, 0x02607B68, 0x02207C68, 0x02207D68,
+        0x02207E68, 0x02207F68,
+    };
+
+    // 0x4ee43c
+    // Turnaround 0. Lane 0. Track 3. Reversed 0. Direction 3
+    static constexpr PackedMoveInfo moveInfoTA0L0T3R0D3[] = {
+        0x06205F58, 0x06205E58, 0x06205D58, 0x05E05C58, 0x05E05B58, 0x05E05A58, 0x05E05959, 0x05E05859,
+        0x05E05759, 0x05E05659, 0x05E0555A, 0x05A0545A, 0x05A0535A, 0x05A0525A, 0x05A0515B, 0x05A0505B,
+        0x05A04F5B, 0x05A04E5C, 0x05604D5C, 0x05604C5D, 0x05604B5E, 0x05604A5E, 0x0560495F, 0x05604860,
+        0x05204761, 0x05204662, 0x05204562, 0x05204463, 0x05204363, 0x05204264, 0x05204265, 0x04E04166,
+        0x04E04067, 0x04E03F68, 0x04E03E69, 0x04E03E6A, 0x04E03D6B, 0x04E03C6C, 0x04A03C6D, 0x04A03B6E,
+        0x04A03B6F, 0x04A03B70, 0x04A03A71, 0x04A03A72, 0x04A03A73, 0x04A03A74, 0x04603975, 0x04603976,
+        0x04603977, 0x04603978, 0x04603879, 0x0460387A, 0x0460387B, 0x0420387C, 0x0420387D, 0x0420387E,
+        0x0420387F,
+    };
+
+    // 0x4ee880
+    // Turnaround 0. Lane 0. Track 3. Reversed 1. Direction 0
+    static constexpr PackedMoveInfo moveInfoTA0L0T3R1D0[] = {
+        0x02204048, 0x02204148, 0x02204248, 0x02204348, 0x02204448, 0x02204548, 0x02604648, 0x02604748,
+        0x02604849, 0x02604949, 0x02604A49, 0x02604B49, 0x02604C4A, 0x02604D4A, 0x02604E4A, 0x02A04F4A,
+        0x02A0504B, 0x02A0514B, 0x02A0524B, 0x02A0534C, 0x02A0544C, 0x02A0554C, 0x02A0564D, 0x02A0574D,
+        0x02A0584E, 0x02A0594E, 0x02E05A4F, 0x02E05B4F, 0x02E05C50, 0x02E05D51, 0x02E05E51, 0x02E05F52,
+        0x02E06053, 0x02E06153, 0x02E06254, 0x03206355, 0x03206456, 0x03206556, 0x03206657, 0x03206758,
+        0x03206858, 0x03206959, 0x03206A5A, 0x03206A5B, 0x03606B5C, 0x03606C5D, 0x03606D5E, 0x03606D5F,
+        0x03606E60, 0x03606F61, 0x03606F62, 0x03607063, 0x03607164, 0x03A07165, 0x03A07266, 0x03A07267,
+        0x03A07368, 0x03A07369, 0x03A0746A, 0x03A0746B, 0x03A0746C, 0x03A0756D, 0x03A0756E, 0x03A0756F,
+        0x03E07670, 0x03E07671, 0x03E07672, 0x03E07673, 0x03E07774, 0x03E07775, 0x03E07776, 0x03E07777,
+        0x03E07878, 0x03E07879, 0x0420787A, 0x0420787B, 0x0420787C, 0x0420787D, 0x0420787E, 0x0420787F,
+    };
+
+    // 0x4eeb02
+    // Turnaround 0. Lane 0. Track 3. Reversed 1. Direction 1
+    static constexpr PackedMoveInfo moveInfoTA0L0T3R1D1[] = {
+        0x04205840, 0x04205841, 0x04205842, 0x04205843, 0x04205844, 0x04205845, 0x04605846, 0x04605847,
+        0x04605748, 0x04605749, 0x0460574A, 0x0460574B, 0x0460564C, 0x0460564D, 0x0460564E, 0x04A0564F,
+        0x04A05550, 0x04A05551, 0x04A05552, 0x04A05453, 0x04A05454, 0x04A05455, 0x04A05356, 0x04A05357,
+        0x04A05258, 0x04A05259, 0x04E0515A, 0x04E0515B, 0x04E0505C, 0x04E04F5D, 0x04E04F5E, 0x04E04E5F,
+        0x04E04D60, 0x04E04D61, 0x04E04C62, 0x05204B63, 0x05204A64, 0x05204A65, 0x05204966, 0x05204867,
+        0x05204868, 0x05204769, 0x0520466A, 0x0520456A, 0x0560446B, 0x0560436C, 0x0560426D, 0x0560416D,
+        0x0560406E, 0x05603F6F, 0x05603E6F, 0x05603D70, 0x05603C71, 0x05A03B71, 0x05A03A72, 0x05A03972,
+        0x05A03873, 0x05A03773, 0x05A03674, 0x05A03574, 0x05A03474, 0x05A03375, 0x05A03275, 0x05A03175,
+        0x05E03076, 0x05E02F76, 0x05E02E76, 0x05E02D76, 0x05E02C77, 0x05E02B77, 0x05E02A77, 0x05E02977,
+        0x05E02878, 0x05E02778, 0x06202678, 0x06202578, 0x06202478, 0x06202378, 0x06202278, 0x06202178,
+        0x06202078,
+    };
+
+    // 0x4eed8c
+    // Turnaround 0. Lane 0. Track 3. Reversed 1. Direction 2
+    static constexpr PackedMoveInfo moveInfoTA0L0T3R1D2[] = {
+        0x06205F58, 0x06205E58, 0x06205D58, 0x06205C58, 0x06205B58, 0x06605A58, 0x06605958, 0x06605857,
+        0x06605757, 0x06605657, 0x06605557, 0x06605456, 0x06605356, 0x06605256, 0x06A05156, 0x06A05055,
+        0x06A04F55, 0x06A04E55, 0x06A04D54, 0x06A04C54, 0x06A04B54, 0x06A04A53, 0x06A04953, 0x06A04852,
+        0x06A04752, 0x06E04651, 0x06E04551, 0x06E04450, 0x06E0434F, 0x06E0424F, 0x06E0414E, 0x06E0404D,
+        0x06E03F4D, 0x06E03E4C, 0x07203D4B, 0x07203C4A, 0x07203B4A, 0x07203A49, 0x07203948, 0x07203848,
+        0x07203747, 0x07203646, 0x07203645, 0x07603544, 0x07603443, 0x07603342, 0x07603341, 0x07603240,
+        0x0760313F, 0x0760313E, 0x0760303D, 0x07602F3C, 0x07A02F3B, 0x07A02E3A, 0x07A02E39, 0x07A02D38,
+        0x07A02D37, 0x07A02C36, 0x07A02C35, 0x07A02C34, 0x07A02B33, 0x07A02B32, 0x07A02B31, 0x07E02A30,
+        0x07E02A2F, 0x07E02A2E, 0x07E02A2D, 0x07E0292C, 0x07E0292B, 0x07E0292A, 0x07E02929, 0x07E02828,
+        0x07E02827, 0x00202826, 0x00202825, 0x00202824, 0x00202823, 0x00202822, 0x00202821, 0x00202820,
+    };
+
+    // 0x4ee606
+    // Turnaround 0. Lane 0. Track 3. Reversed 1. Direction 3
+    static constexpr PackedMoveInfo moveInfoTA0L0T3R1D3[] = {
+        0x0020485F, 0x0020485E, 0x0020485D, 0x0020485C, 0x0020485B, 0x0060485A, 0x00604859, 0x00604958,
+        0x00604957, 0x00604956, 0x00604955, 0x00604A54, 0x00604A53, 0x00604A52, 0x00A04A51, 0x00A04B50,
+        0x00A04B4F, 0x00A04B4E, 0x00A04C4D, 0x00A04C4C, 0x00A04C4B, 0x00A04D4A, 0x00A04D49, 0x00A04E48,
+        0x00A04E47, 0x00E04F46, 0x00E04F45, 0x00E05044, 0x00E05143, 0x00E05142, 0x00E05241, 0x00E05340,
+        0x00E0533F, 0x00E0543E, 0x0120553D, 0x0120563C, 0x0120563B, 0x0120573A, 0x01205839, 0x01205838,
+        0x01205937, 0x01205A36, 0x01205B36, 0x01605C35, 0x01605D34, 0x01605E33, 0x01605F33, 0x01606032,
+        0x01606131, 0x01606231, 0x01606330, 0x0160642F, 0x01A0652F, 0x01A0662E, 0x01A0672E, 0x01A0682D,
+        0x01A0692D, 0x01A06A2C, 0x01A06B2C, 0x01A06C2C, 0x01A06D2B, 0x01A06E2B, 0x01A06F2B, 0x01E0702A,
+        0x01E0712A, 0x01E0722A, 0x01E0732A, 0x01E07429, 0x01E07529, 0x01E07629, 0x01E07729, 0x01E07828,
+        0x01E07928, 0x02207A28, 0x02207B28, 0x02207C28, 0x02207D28, 0x02207E28, 0x02207F28,
+    };
+
+    // 0x4ebe9e
+    // Turnaround 0. Lane 0. Track 5. Reversed 0. Direction 0
+    static constexpr PackedMoveInfo moveInfoTA0L0T5R0D0[] = {
+        0x1020485F, 0x1020485E, 0x1020485D, 0x1020485C, 0x1021485B, 0x1021485A, 0x10214859, 0x10214858,
+        0x10224857, 0x10224856, 0x10224855, 0x10224854, 0x10234853, 0x10234852, 0x10234851, 0x10234850,
+        0x1024484F, 0x1024484E, 0x1024484D, 0x1024484C, 0x1025484B, 0x1025484A, 0x10254849, 0x10254848,
+        0x10264847, 0x10264846, 0x10264845, 0x10264844, 0x10274843, 0x10274842, 0x10274841, 0x10274840,
+        0x1028483F, 0x1028483E, 0x1028483D, 0x1028483C, 0x1029483B, 0x1029483A, 0x10294839, 0x10294838,
+        0x102A4837, 0x102A4836, 0x102A4835, 0x102A4834, 0x102B4833, 0x102B4832, 0x102B4831, 0x102B4830,
+        0x102C482F, 0x102C482E, 0x102C482D, 0x102C482C, 0x102D482B, 0x102D482A, 0x102D4829, 0x102D4828,
+        0x102E4827, 0x102E4826, 0x102E4825, 0x102E4824, 0x102F4823, 0x102F4822, 0x102F4821, 0x102F4820,
+    };
+
+    // 0x4ec0a0
+    // Turnaround 0. Lane 0. Track 5. Reversed 0. Direction 1
+    static constexpr PackedMoveInfo moveInfoTA0L0T5R0D1[] = {
+        0x12204048, 0x12204148, 0x12204248, 0x12204348, 0x12214448, 0x12214548, 0x12214648, 0x12214748,
+        0x12224848, 0x12224948, 0x12224A48, 0x12224B48, 0x12234C48, 0x12234D48, 0x12234E48, 0x12234F48,
+        0x12245048, 0x12245148, 0x12245248, 0x12245348, 0x12255448, 0x12255548, 0x12255648, 0x12255748,
+        0x12265848, 0x12265948, 0x12265A48, 0x12265B48, 0x12275C48, 0x12275D48, 0x12275E48, 0x12275F48,
+        0x12286048, 0x12286148, 0x12286248, 0x12286348, 0x12296448, 0x12296548, 0x12296648, 0x12296748,
+        0x122A6848, 0x122A6948, 0x122A6A48, 0x122A6B48, 0x122B6C48, 0x122B6D48, 0x122B6E48, 0x122B6F48,
+        0x122C7048, 0x122C7148, 0x122C7248, 0x122C7348, 0x122D7448, 0x122D7548, 0x122D7648, 0x122D7748,
+        0x122E7848, 0x122E7948, 0x122E7A48, 0x122E7B48, 0x122F7C48, 0x122F7D48, 0x122F7E48, 0x122F7F48,
+    };
+
+    // 0x4ec2a2
+    // Turnaround 0. Lane 0. Track 5. Reversed 0. Direction 2
+    static constexpr PackedMoveInfo moveInfoTA0L0T5R0D2[] = {
+        0x14205840, 0x14205841, 0x14205842, 0x14205843, 0x14215844, 0x14215845, 0x14215846, 0x14215847,
+        0x14225848, 0x14225849, 0x1422584A, 0x1422584B, 0x1423584C, 0x1423584D, 0x1423584E, 0x1423584F,
+        0x14245850, 0x14245851, 0x14245852, 0x14245853, 0x14255854, 0x14255855, 0x14255856, 0x14255857,
+        0x14265858, 0x14265859, 0x1426585A, 0x1426585B, 0x1427585C, 0x1427585D, 0x1427585E, 0x1427585F,
+        0x14285860, 0x14285861, 0x14285862, 0x14285863, 0x14295864, 0x14295865, 0x14295866, 0x14295867,
+        0x142A5868, 0x142A5869, 0x142A586A, 0x142A586B, 0x142B586C, 0x142B586D, 0x142B586E, 0x142B586F,
+        0x142C5870, 0x142C5871, 0x142C5872, 0x142C5873, 0x142D5874, 0x142D5875, 0x142D5876, 0x142D5877,
+        0x142E5878, 0x142E5879, 0x142E587A, 0x142E587B, 0x142F587C, 0x142F587D, 0x142F587E, 0x142F587F,
+    };
+
+    // 0x4ec4a4
+    // Turnaround 0. Lane 0. Track 5. Reversed 0. Direction 3
+    static constexpr PackedMoveInfo moveInfoTA0L0T5R0D3[] = {
+        0x16205F58, 0x16205E58, 0x16205D58, 0x16205C58, 0x16215B58, 0x16215A58, 0x16215958, 0x16215858,
+        0x16225758, 0x16225658, 0x16225558, 0x16225458, 0x16235358, 0x16235258, 0x16235158, 0x16235058,
+        0x16244F58, 0x16244E58, 0x16244D58, 0x16244C58, 0x16254B58, 0x16254A58, 0x16254958, 0x16254858,
+        0x16264758, 0x16264658, 0x16264558, 0x16264458, 0x16274358, 0x16274258, 0x16274158, 0x16274058,
+        0x16283F58, 0x16283E58, 0x16283D58, 0x16283C58, 0x16293B58, 0x16293A58, 0x16293958, 0x16293858,
+        0x162A3758, 0x162A3658, 0x162A3558, 0x162A3458, 0x162B3358, 0x162B3258, 0x162B3158, 0x162B3058,
+        0x162C2F58, 0x162C2E58, 0x162C2D58, 0x162C2C58, 0x162D2B58, 0x162D2A58, 0x162D2958, 0x162D2858,
+        0x162E2758, 0x162E2658, 0x162E2558, 0x162E2458, 0x162F2358, 0x162F2258, 0x162F2158, 0x162F2058,
+    };
+
+    // 0x4ecaaa
+    // Turnaround 0. Lane 0. Track 5. Reversed 1. Direction 0
+    static constexpr PackedMoveInfo moveInfoTA0L0T5R1D0[] = {
+        0x34205840, 0x34205841, 0x34205842, 0x34205843, 0x341F5844, 0x341F5845, 0x341F5846, 0x341F5847,
+        0x341E5848, 0x341E5849, 0x341E584A, 0x341E584B, 0x341D584C, 0x341D584D, 0x341D584E, 0x341D584F,
+        0x341C5850, 0x341C5851, 0x341C5852, 0x341C5853, 0x341B5854, 0x341B5855, 0x341B5856, 0x341B5857,
+        0x341A5858, 0x341A5859, 0x341A585A, 0x341A585B, 0x3419585C, 0x3419585D, 0x3419585E, 0x3419585F,
+        0x34185860, 0x34185861, 0x34185862, 0x34185863, 0x34175864, 0x34175865, 0x34175866, 0x34175867,
+        0x34165868, 0x34165869, 0x3416586A, 0x3416586B, 0x3415586C, 0x3415586D, 0x3415586E, 0x3415586F,
+        0x34145870, 0x34145871, 0x34145872, 0x34145873, 0x34135874, 0x34135875, 0x34135876, 0x34135877,
+        0x34125878, 0x34125879, 0x3412587A, 0x3412587B, 0x3411587C, 0x3411587D, 0x3411587E, 0x3411587F,
+    };
+
+    // 0x4eccac
+    // Turnaround 0. Lane 0. Track 5. Reversed 1. Direction 1
+    static constexpr PackedMoveInfo moveInfoTA0L0T5R1D1[] = {
+        0x36205F58, 0x36205E58, 0x36205D58, 0x36205C58, 0x361F5B58, 0x361F5A58, 0x361F5958, 0x361F5858,
+        0x361E5758, 0x361E5658, 0x361E5558, 0x361E5458, 0x361D5358, 0x361D5258, 0x361D5158, 0x361D5058,
+        0x361C4F58, 0x361C4E58, 0x361C4D58, 0x361C4C58, 0x361B4B58, 0x361B4A58, 0x361B4958, 0x361B4858,
+        0x361A4758, 0x361A4658, 0x361A4558, 0x361A4458, 0x36194358, 0x36194258, 0x36194158, 0x36194058,
+        0x36183F58, 0x36183E58, 0x36183D58, 0x36183C58, 0x36173B58, 0x36173A58, 0x36173958, 0x36173858,
+        0x36163758, 0x36163658, 0x36163558, 0x36163458, 0x36153358, 0x36153258, 0x36153158, 0x36153058,
+        0x36142F58, 0x36142E58, 0x36142D58, 0x36142C58, 0x36132B58, 0x36132A58, 0x36132958, 0x36132858,
+        0x36122758, 0x36122658, 0x36122558, 0x36122458, 0x36112358, 0x36112258, 0x36112158, 0x36112058,
+    };
+
+    // 0x4ec6a6
+    // Turnaround 0. Lane 0. Track 5. Reversed 1. Direction 2
+    static constexpr PackedMoveInfo moveInfoTA0L0T5R1D2[] = {
+        0x3020485F, 0x3020485E, 0x3020485D, 0x3020485C, 0x301F485B, 0x301F485A, 0x301F4859, 0x301F4858,
+        0x301E4857, 0x301E4856, 0x301E4855, 0x301E4854, 0x301D4853, 0x301D4852, 0x301D4851, 0x301D4850,
+        0x301C484F, 0x301C484E, 0x301C484D, 0x301C484C, 0x301B484B, 0x301B484A, 0x301B4849, 0x301B4848,
+        0x301A4847, 0x301A4846, 0x301A4845, 0x301A4844, 0x30194843, 0x30194842, 0x30194841, 0x30194840,
+        0x3018483F, 0x3018483E, 0x3018483D, 0x3018483C, 0x3017483B, 0x3017483A, 0x30174839, 0x30174838,
+        0x30164837, 0x30164836, 0x30164835, 0x30164834, 0x30154833, 0x30154832, 0x30154831, 0x30154830,
+        0x3014482F, 0x3014482E, 0x3014482D, 0x3014482C, 0x3013482B, 0x3013482A, 0x30134829, 0x30134828,
+        0x30124827, 0x30124826, 0x30124825, 0x30124824, 0x30114823, 0x30114822, 0x30114821, 0x30114820,
+    };
+
+    // 0x4ec8a8
+    // Turnaround 0. Lane 0. Track 5. Reversed 1. Direction 3
+    static constexpr PackedMoveInfo moveInfoTA0L0T5R1D3[] = {
+        0x32204048, 0x32204148, 0x32204248, 0x32204348, 0x321F4448, 0x321F4548, 0x321F4648, 0x321F4748,
+        0x321E4848, 0x321E4948, 0x321E4A48, 0x321E4B48, 0x321D4C48, 0x321D4D48, 0x321D4E48, 0x321D4F48,
+        0x321C5048, 0x321C5148, 0x321C5248, 0x321C5348, 0x321B5448, 0x321B5548, 0x321B5648, 0x321B5748,
+        0x321A5848, 0x321A5948, 0x321A5A48, 0x321A5B48, 0x32195C48, 0x32195D48, 0x32195E48, 0x32195F48,
+        0x32186048, 0x32186148, 0x32186248, 0x32186348, 0x32176448, 0x32176548, 0x32176648, 0x32176748,
+        0x32166848, 0x32166948, 0x32166A48, 0x32166B48, 0x32156C48, 0x32156D48, 0x32156E48, 0x32156F48,
+        0x32147048, 0x32147148, 0x32147248, 0x32147348, 0x32137448, 0x32137548, 0x32137648, 0x32137748,
+        0x32127848, 0x32127948, 0x32127A48, 0x32127B48, 0x32117C48, 0x32117D48, 0x32117E48, 0x32117F48,
+    };
+
+    // 0x4dcd66
+    // Turnaround 0. Lane 0. Track 7. Reversed 0. Direction 0
+    // Same entries as moveInfoT34R0D0
+    static constexpr auto& moveInfoTA0L0T7R0D0 = moveInfoT34R0D0;
+
+    // 0x4dce68
+    // Turnaround 0. Lane 0. Track 7. Reversed 0. Direction 1
+    // Same entries as moveInfoT34R0D1
+    static constexpr auto& moveInfoTA0L0T7R0D1 = moveInfoT34R0D1;
+
+    // 0x4dcf6a
+    // Turnaround 0. Lane 0. Track 7. Reversed 0. Direction 2
+    // Same entries as moveInfoT34R0D2
+    static constexpr auto& moveInfoTA0L0T7R0D2 = moveInfoT34R0D2;
+
+    // 0x4dd06c
+    // Turnaround 0. Lane 0. Track 7. Reversed 0. Direction 3
+    // Same entries as moveInfoT34R0D3
+    static constexpr auto& moveInfoTA0L0T7R0D3 = moveInfoT34R0D3;
+
+    // 0x4dd372
+    // Turnaround 0. Lane 0. Track 7. Reversed 1. Direction 0
+    // Same entries as moveInfoT35R1D0
+    static constexpr auto& moveInfoTA0L0T7R1D0 = moveInfoT35R1D0;
+
+    // 0x4dd474
+    // Turnaround 0. Lane 0. Track 7. Reversed 1. Direction 1
+    // Same entries as moveInfoT35R1D1
+    static constexpr auto& moveInfoTA0L0T7R1D1 = moveInfoT35R1D1;
+
+    // 0x4dd16e
+    // Turnaround 0. Lane 0. Track 7. Reversed 1. Direction 2
+    // Same entries as moveInfoT35R1D2
+    static constexpr auto& moveInfoTA0L0T7R1D2 = moveInfoT35R1D2;
+
+    // 0x4dd270
+    // Turnaround 0. Lane 0. Track 7. Reversed 1. Direction 3
+    // Same entries as moveInfoT35R1D3
+    static constexpr auto& moveInfoTA0L0T7R1D3 = moveInfoT35R1D3;
+
+    // 0x4deda6
+    // Turnaround 0. Lane 0. Track 9. Reversed 0. Direction 0
+    // Same entries as moveInfoT42R0D0
+    static constexpr auto& moveInfoTA0L0T9R0D0 = moveInfoT42R0D0;
+
+    // 0x4dee60
+    // Turnaround 0. Lane 0. Track 9. Reversed 0. Direction 1
+    // Same entries as moveInfoT42R0D1
+    static constexpr auto& moveInfoTA0L0T9R0D1 = moveInfoT42R0D1;
+
+    // 0x4def1a
+    // Turnaround 0. Lane 0. Track 9. Reversed 0. Direction 2
+    // Same entries as moveInfoT42R0D2
+    static constexpr auto& moveInfoTA0L0T9R0D2 = moveInfoT42R0D2;
+
+    // 0x4defd4
+    // Turnaround 0. Lane 0. Track 9. Reversed 0. Direction 3
+    // Same entries as moveInfoT42R0D3
+    static constexpr auto& moveInfoTA0L0T9R0D3 = moveInfoT42R0D3;
+
+    // 0x4dc95e
+    // Turnaround 0. Lane 1. Track 0. Reversed 0. Direction 0
+    // Same entries as moveInfoT26R1D2
+    static constexpr auto& moveInfoTA0L1T0R0D0 = moveInfoT26R1D2;
+
+    // 0x4dca60
+    // Turnaround 0. Lane 1. Track 0. Reversed 0. Direction 1
+    // Same entries as moveInfoT26R1D3
+    static constexpr auto& moveInfoTA0L1T0R0D1 = moveInfoT26R1D3;
+
+    // 0x4dcb62
+    // Turnaround 0. Lane 1. Track 0. Reversed 0. Direction 2
+    // Same entries as moveInfoT26R1D0
+    static constexpr auto& moveInfoTA0L1T0R0D2 = moveInfoT26R1D0;
+
+    // 0x4dcc64
+    // Turnaround 0. Lane 1. Track 0. Reversed 0. Direction 3
+    // Same entries as moveInfoT26R1D1
+    static constexpr auto& moveInfoTA0L1T0R0D3 = moveInfoT26R1D1;
+
+    // 0x4eb350
+    // Turnaround 0. Lane 1. Track 1. Reversed 0. Direction 0
+    // Same entries as moveInfoT29R0D0
+    static constexpr auto& moveInfoTA0L1T1R0D0 = moveInfoT29R0D0;
+
+    // 0x4eb462
+    // Turnaround 0. Lane 1. Track 1. Reversed 0. Direction 1
+    // Same entries as moveInfoT29R0D1
+    static constexpr auto& moveInfoTA0L1T1R0D1 = moveInfoT29R0D1;
+
+    // 0x4eb57c
+    // Turnaround 0. Lane 1. Track 1. Reversed 0. Direction 2
+    // Same entries as moveInfoT29R0D2
+    static constexpr auto& moveInfoTA0L1T1R0D2 = moveInfoT29R0D2;
+
+    // 0x4eb246
+    // Turnaround 0. Lane 1. Track 1. Reversed 0. Direction 3
+    // Same entries as moveInfoT29R0D3
+    static constexpr auto& moveInfoTA0L1T1R0D3 = moveInfoT29R0D3;
+
+    // 0x4eb0c6
+    // Turnaround 0. Lane 1. Track 1. Reversed 1. Direction 0
+    // Same entries as moveInfoT28R1D0
+    static constexpr auto& moveInfoTA0L1T1R1D0 = moveInfoT28R1D0;
+
+    // 0x4eb128
+    // Turnaround 0. Lane 1. Track 1. Reversed 1. Direction 1
+    // Same entries as moveInfoT28R1D1
+    static constexpr auto& moveInfoTA0L1T1R1D1 = moveInfoT28R1D1;
+
+    // 0x4eb18a
+    // Turnaround 0. Lane 1. Track 1. Reversed 1. Direction 2
+    // Same entries as moveInfoT28R1D2
+    static constexpr auto& moveInfoTA0L1T1R1D2 = moveInfoT28R1D2;
+
+    // 0x4eb1ec
+    // Turnaround 0. Lane 1. Track 1. Reversed 1. Direction 3
+    // Same entries as moveInfoT28R1D3
+    static constexpr auto& moveInfoTA0L1T1R1D3 = moveInfoT28R1D3;
+
+    // 0x4ef756
+    // Turnaround 0. Lane 1. Track 3. Reversed 0. Direction 0
+    static constexpr PackedMoveInfo moveInfoTA0L1T3R0D0[] = {
+        0x0020585F, 0x0020585E, 0x0020585D, 0x0020585C, 0x0020585B, 0x07E0585A, 0x07E05859, 0x07E05758,
+        0x07E05757, 0x07E05756, 0x07E05755, 0x07E05654, 0x07E05653, 0x07E05652, 0x07A05651, 0x07A05550,
+        0x07A0554F, 0x07A0554E, 0x07A0544D, 0x07A0544C, 0x07A0544B, 0x07A0534A, 0x07A05349, 0x07A05248,
+        0x07A05247, 0x07605146, 0x07605145, 0x07605044, 0x07604F43, 0x07604F42, 0x07604E41, 0x07604D40,
+        0x07604D3F, 0x07604C3E, 0x07204B3D, 0x07204A3C, 0x07204A3B, 0x0720493A, 0x07204839, 0x07204838,
+        0x07204737, 0x07204636, 0x07204536, 0x06E04435, 0x06E04334, 0x06E04233, 0x06E04133, 0x06E04032,
+        0x06E03F31, 0x06E03E31, 0x06E03D30, 0x06E03C2F, 0x06A03B2F, 0x06A03A2E, 0x06A0392E, 0x06A0382D,
+        0x06A0372D, 0x06A0362C, 0x06A0352C, 0x06A0342C, 0x06A0332B, 0x06A0322B, 0x06A0312B, 0x0660302A,
+        0x06602F2A, 0x06602E2A, 0x06602D2A, 0x06602C29, 0x06602B29, 0x06602A29, 0x06602929, 0x06602828,
+        0x06602728, 0x06202628, 0x06202528, 0x06202428, 0x06202328, 0x06202228, 0x06202128, 0x06202028,
+    };
+
+    // 0x4ef9d8
+    // Turnaround 0. Lane 1. Track 3. Reversed 0. Direction 1
+    static constexpr PackedMoveInfo moveInfoTA0L1T3R0D1[] = {
+        0x02204058, 0x02204158, 0x02204258, 0x02204358, 0x02204458, 0x02204558, 0x01E04658, 0x01E04758,
+        0x01E04857, 0x01E04957, 0x01E04A57, 0x01E04B57, 0x01E04C56, 0x01E04D56, 0x01E04E56, 0x01A04F56,
+        0x01A05055, 0x01A05155, 0x01A05255, 0x01A05354, 0x01A05454, 0x01A05554, 0x01A05653, 0x01A05753,
+        0x01A05852, 0x01A05952, 0x01605A51, 0x01605B51, 0x01605C50, 0x01605D4F, 0x01605E4F, 0x01605F4E,
+        0x0160604D, 0x0160614D, 0x0160624C, 0x0120634B, 0x0120644A, 0x0120654A, 0x01206649, 0x01206748,
+        0x01206848, 0x01206947, 0x01206A46, 0x01206A45, 0x00E06B44, 0x00E06C43, 0x00E06D42, 0x00E06D41,
+        0x00E06E40, 0x00E06F3F, 0x00E06F3E, 0x00E0703D, 0x00E0713C, 0x00A0713B, 0x00A0723A, 0x00A07239,
+        0x00A07338, 0x00A07337, 0x00A07436, 0x00A07435, 0x00A07434, 0x00A07533, 0x00A07532, 0x00A07531,
+        0x00607630, 0x0060762F, 0x0060762E, 0x0060762D, 0x0060772C, 0x0060772B, 0x0060772A, 0x00607729,
+        0x00607828, 0x00607827, 0x00207826, 0x00207825, 0x00207824, 0x00207823, 0x00207822, 0x00207821,
+        0x00207820,
+    };
+
+    // 0x4efc62
+    // Turnaround 0. Lane 1. Track 3. Reversed 0. Direction 2
+    static constexpr PackedMoveInfo moveInfoTA0L1T3R0D2[] = {
+        0x04204840, 0x04204841, 0x04204842, 0x04204843, 0x04204844, 0x04204845, 0x03E04846, 0x03E04847,
+        0x03E04948, 0x03E04949, 0x03E0494A, 0x03E0494B, 0x03E04A4C, 0x03E04A4D, 0x03E04A4E, 0x03A04A4F,
+        0x03A04B50, 0x03A04B51, 0x03A04B52, 0x03A04C53, 0x03A04C54, 0x03A04C55, 0x03A04D56, 0x03A04D57,
+        0x03A04E58, 0x03A04E59, 0x03604F5A, 0x03604F5B, 0x0360505C, 0x0360515D, 0x0360515E, 0x0360525F,
+        0x03605360, 0x03605361, 0x03605462, 0x03205563, 0x03205664, 0x03205665, 0x03205766, 0x03205867,
+        0x03205868, 0x03205969, 0x03205A6A, 0x03205B6A, 0x02E05C6B, 0x02E05D6C, 0x02E05E6D, 0x02E05F6D,
+        0x02E0606E, 0x02E0616F, 0x02E0626F, 0x02E06370, 0x02E06471, 0x02A06571, 0x02A06672, 0x02A06772,
+        0x02A06873, 0x02A06973, 0x02A06A74, 0x02A06B74, 0x02A06C74, 0x02A06D75, 0x02A06E75, 0x02A06F75,
+        0x02607076, 0x02607176, 0x02607276, 0x02607376, 0x02607477, 0x02607577, 0x02607677, 0x02607777,
+        0x02607878, 0x02607978, 0x02207A78, 0x02207B78, 0x02207C78, 0x02207D78, 0x02207E78, 0x02207F78,
+    };
+
+    // 0x4efee4
+    // Turnaround 0. Lane 1. Track 3. Reversed 0. Direction 3
+    static constexpr PackedMoveInfo moveInfoTA0L1T3R0D3[] = {
+        0x06205F48, 0x06205E48, 0x06205D48, 0x06205C48, 0x06205B48, 0x05E05A48, 0x05E05948, 0x05E05849,
+        0x05E05749, 0x05E05649, 0x05E05549, 0x05E0544A, 0x05E0534A, 0x05E0524A, 0x05A0514A, 0x05A0504B,
+        0x05A04F4B, 0x05A04E4B, 0x05A04D4C, 0x05A04C4C, 0x05A04B4C, 0x05A04A4D, 0x05A0494D, 0x05A0484E,
+        0x05A0474E, 0x0560464F, 0x0560454F, 0x05604450, 0x05604351, 0x05604251, 0x05604152, 0x05604053,
+        0x05603F53, 0x05603E54, 0x05203D55, 0x05203C56, 0x05203B56, 0x05203A57, 0x05203958, 0x05203858,
+        0x05203759, 0x0520365A, 0x0520365B, 0x04E0355C, 0x04E0345D, 0x04E0335E, 0x04E0335F, 0x04E03260,
+        0x04E03161, 0x04E03162, 0x04E03063, 0x04E02F64, 0x04A02F65, 0x04A02E66, 0x04A02E67, 0x04A02D68,
+        0x04A02D69, 0x04A02C6A, 0x04A02C6B, 0x04A02C6C, 0x04A02B6D, 0x04A02B6E, 0x04A02B6F, 0x04602A70,
+        0x04602A71, 0x04602A72, 0x04602A73, 0x04602974, 0x04602975, 0x04602976, 0x04602977, 0x04602878,
+        0x04602879, 0x0420287A, 0x0420287B, 0x0420287C, 0x0420287D, 0x0420287E, 0x0420287F,
+    };
+
+    // 0x4ef1d8
+    // Turnaround 0. Lane 1. Track 3. Reversed 1. Direction 0
+    static constexpr PackedMoveInfo moveInfoTA0L1T3R1D0[] = {
+        0x02204058, 0x02204158, 0x02204258, 0x02204358, 0x02604458, 0x02604558, 0x02604658, 0x02604759,
+        0x02604859, 0x02604959, 0x02604A59, 0x02604B5A, 0x02A04C5A, 0x02A04D5A, 0x02A04E5A, 0x02A04F5B,
+        0x02A0505B, 0x02A0515B, 0x02A0525C, 0x02E0535C, 0x02E0545D, 0x02E0555E, 0x02E0565E, 0x02E0575F,
+        0x02E05860, 0x03205961, 0x03205A62, 0x03205B62, 0x03205C63, 0x03205D63, 0x03205E64, 0x03205E65,
+        0x03605F66, 0x03606067, 0x03606168, 0x03606269, 0x0360626A, 0x0360636B, 0x0360646C, 0x03A0646D,
+        0x03A0656E, 0x03A0656F, 0x03A06570, 0x03A06671, 0x03A06672, 0x03A06673, 0x03A06674, 0x03E06775,
+        0x03E06776, 0x03E06777, 0x03E06778, 0x03E06879, 0x03E0687A, 0x03E0687B, 0x0420687C, 0x0420687D,
+        0x0420687E, 0x0420687F,
+    };
+
+    // 0x4ef3aa
+    // Turnaround 0. Lane 1. Track 3. Reversed 1. Direction 1
+    static constexpr PackedMoveInfo moveInfoTA0L1T3R1D1[] = {
+        0x04204840, 0x04204841, 0x04204842, 0x04204843, 0x04604844, 0x04604845, 0x04604846, 0x04604747,
+        0x04604748, 0x04604749, 0x0460474A, 0x0460464B, 0x04A0464C, 0x04A0464D, 0x04A0464E, 0x04A0454F,
+        0x04A04550, 0x04A04551, 0x04A04452, 0x04E04453, 0x04E04354, 0x04E04255, 0x04E04256, 0x04E04157,
+        0x04E04058, 0x05203F59, 0x05203E5A, 0x05203E5B, 0x05203D5C, 0x05203D5D, 0x05203C5E, 0x05203B5E,
+        0x05603A5F, 0x05603960, 0x05603861, 0x05603762, 0x05603662, 0x05603563, 0x05603464, 0x05A03364,
+        0x05A03265, 0x05A03165, 0x05A03065, 0x05A02F66, 0x05A02E66, 0x05A02D66, 0x05A02C66, 0x05E02B67,
+        0x05E02A67, 0x05E02967, 0x05E02867, 0x05E02768, 0x05E02668, 0x05E02568, 0x06202468, 0x06202368,
+        0x06202268, 0x06202168, 0x06202068,
+    };
+
+    // 0x4ef584
+    // Turnaround 0. Lane 1. Track 3. Reversed 1. Direction 2
+    static constexpr PackedMoveInfo moveInfoTA0L1T3R1D2[] = {
+        0x06205F48, 0x06205E48, 0x06205D48, 0x06605C48, 0x06605B48, 0x06605A48, 0x06605947, 0x06605847,
+        0x06605747, 0x06605647, 0x06605546, 0x06A05446, 0x06A05346, 0x06A05246, 0x06A05145, 0x06A05045,
+        0x06A04F45, 0x06A04E44, 0x06E04D44, 0x06E04C43, 0x06E04B42, 0x06E04A42, 0x06E04941, 0x06E04840,
+        0x0720473F, 0x0720463E, 0x0720453E, 0x0720443D, 0x0720433D, 0x0720423C, 0x0720423B, 0x0760413A,
+        0x07604039, 0x07603F38, 0x07603E37, 0x07603E36, 0x07603D35, 0x07603C34, 0x07A03C33, 0x07A03B32,
+        0x07A03B31, 0x07A03B30, 0x07A03A2F, 0x07A03A2E, 0x07A03A2D, 0x07A03A2C, 0x07E0392B, 0x07E0392A,
+        0x07E03929, 0x07E03928, 0x07E03827, 0x07E03826, 0x07E03825, 0x00203824, 0x00203823, 0x00203822,
+        0x00203821, 0x00203820,
+    };
+
+    // 0x4ef00e
+    // Turnaround 0. Lane 1. Track 3. Reversed 1. Direction 3
+    static constexpr PackedMoveInfo moveInfoTA0L1T3R1D3[] = {
+        0x0020585F, 0x0020585E, 0x0020585D, 0x0060585C, 0x0060585B, 0x0060585A, 0x00605959, 0x00605958,
+        0x00605957, 0x00605956, 0x00605A55, 0x00A05A54, 0x00A05A53, 0x00A05A52, 0x00A05B51, 0x00A05B50,
+        0x00A05B4F, 0x00A05C4E, 0x00E05C4D, 0x00E05D4C, 0x00E05E4B, 0x00E05E4A, 0x00E05F49, 0x00E06048,
+        0x01206147, 0x01206246, 0x01206245, 0x01206344, 0x01206343, 0x01206442, 0x01206542, 0x01606641,
+        0x01606740, 0x0160683F, 0x0160693E, 0x01606A3E, 0x01606B3D, 0x01606C3C, 0x01A06D3C, 0x01A06E3B,
+        0x01A06F3B, 0x01A0703B, 0x01A0713A, 0x01A0723A, 0x01A0733A, 0x01A0743A, 0x01E07539, 0x01E07639,
+        0x01E07739, 0x01E07839, 0x01E07938, 0x01E07A38, 0x01E07B38, 0x02207C38, 0x02207D38, 0x02207E38,
+        0x02207F38,
+    };
+
+    // 0x4eceae
+    // Turnaround 0. Lane 1. Track 5. Reversed 0. Direction 0
+    static constexpr PackedMoveInfo moveInfoTA0L1T5R0D0[] = {
+        0x1020585F, 0x1020585E, 0x1020585D, 0x1020585C, 0x1021585B, 0x1021585A, 0x10215859, 0x10215858,
+        0x10225857, 0x10225856, 0x10225855, 0x10225854, 0x10235853, 0x10235852, 0x10235851, 0x10235850,
+        0x1024584F, 0x1024584E, 0x1024584D, 0x1024584C, 0x1025584B, 0x1025584A, 0x10255849, 0x10255848,
+        0x10265847, 0x10265846, 0x10265845, 0x10265844, 0x10275843, 0x10275842, 0x10275841, 0x10275840,
+        0x1028583F, 0x1028583E, 0x1028583D, 0x1028583C, 0x1029583B, 0x1029583A, 0x10295839, 0x10295838,
+        0x102A5837, 0x102A5836, 0x102A5835, 0x102A5834, 0x102B5833, 0x102B5832, 0x102B5831, 0x102B5830,
+        0x102C582F, 0x102C582E, 0x102C582D, 0x102C582C, 0x102D582B, 0x102D582A, 0x102D5829, 0x102D5828,
+        0x102E5827, 0x102E5826, 0x102E5825, 0x102E5824, 0x102F5823, 0x102F5822, 0x102F5821, 0x102F5820,
+    };
+
+    // 0x4ed0b0
+    // Turnaround 0. Lane 1. Track 5. Reversed 0. Direction 1
+    static constexpr PackedMoveInfo moveInfoTA0L1T5R0D1[] = {
+        0x12204058, 0x12204158, 0x12204258, 0x12204358, 0x12214458, 0x12214558, 0x12214658, 0x12214758,
+        0x12224858, 0x12224958, 0x12224A58, 0x12224B58, 0x12234C58, 0x12234D58, 0x12234E58, 0x12234F58,
+        0x12245058, 0x12245158, 0x12245258, 0x12245358, 0x12255458, 0x12255558, 0x12255658, 0x12255758,
+        0x12265858, 0x12265958, 0x12265A58, 0x12265B58, 0x12275C58, 0x12275D58, 0x12275E58, 0x12275F58,
+        0x12286058, 0x12286158, 0x12286258, 0x12286358, 0x12296458, 0x12296558, 0x12296658, 0x12296758,
+        0x122A6858, 0x122A6958, 0x122A6A58, 0x122A6B58, 0x122B6C58, 0x122B6D58, 0x122B6E58, 0x122B6F58,
+        0x122C7058, 0x122C7158, 0x122C7258, 0x122C7358, 0x122D7458, 0x122D7558, 0x122D7658, 0x122D7758,
+        0x122E7858, 0x122E7958, 0x122E7A58, 0x122E7B58, 0x122F7C58, 0x122F7D58, 0x122F7E58, 0x122F7F58,
+    };
+
+    // 0x4ed2b2
+    // Turnaround 0. Lane 1. Track 5. Reversed 0. Direction 2
+    static constexpr PackedMoveInfo moveInfoTA0L1T5R0D2[] = {
+        0x14204840, 0x14204841, 0x14204842, 0x14204843, 0x14214844, 0x14214845, 0x14214846, 0x14214847,
+        0x14224848, 0x14224849, 0x1422484A, 0x1422484B, 0x1423484C, 0x1423484D, 0x1423484E, 0x1423484F,
+        0x14244850, 0x14244851, 0x14244852, 0x14244853, 0x14254854, 0x14254855, 0x14254856, 0x14254857,
+        0x14264858, 0x14264859, 0x1426485A, 0x1426485B, 0x1427485C, 0x1427485D, 0x1427485E, 0x1427485F,
+        0x14284860, 0x14284861, 0x14284862, 0x14284863, 0x14294864, 0x14294865, 0x14294866, 0x14294867,
+        0x142A4868, 0x142A4869, 0x142A486A, 0x142A486B, 0x142B486C, 0x142B486D, 0x142B486E, 0x142B486F,
+        0x142C4870, 0x142C4871, 0x142C4872, 0x142C4873, 0x142D4874, 0x142D4875, 0x142D4876, 0x142D4877,
+        0x142E4878, 0x142E4879, 0x142E487A, 0x142E487B, 0x142F487C, 0x142F487D, 0x142F487E, 0x142F487F,
+    };
+
+    // 0x4ed4b4
+    // Turnaround 0. Lane 1. Track 5. Reversed 0. Direction 3
+    static constexpr PackedMoveInfo moveInfoTA0L1T5R0D3[] = {
+        0x16205F48, 0x16205E48, 0x16205D48, 0x16205C48, 0x16215B48, 0x16215A48, 0x16215948, 0x16215848,
+        0x16225748, 0x16225648, 0x16225548, 0x16225448, 0x16235348, 0x16235248, 0x16235148, 0x16235048,
+        0x16244F48, 0x16244E48, 0x16244D48, 0x16244C48, 0x16254B48, 0x16254A48, 0x16254948, 0x16254848,
+        0x16264748, 0x16264648, 0x16264548, 0x16264448, 0x16274348, 0x16274248, 0x16274148, 0x16274048,
+        0x16283F48, 0x16283E48, 0x16283D48, 0x16283C48, 0x16293B48, 0x16293A48, 0x16293948, 0x16293848,
+        0x162A3748, 0x162A3648, 0x162A3548, 0x162A3448, 0x162B3348, 0x162B3248, 0x162B3148, 0x162B3048,
+        0x162C2F48, 0x162C2E48, 0x162C2D48, 0x162C2C48, 0x162D2B48, 0x162D2A48, 0x162D2948, 0x162D2848,
+        0x162E2748, 0x162E2648, 0x162E2548, 0x162E2448, 0x162F2348, 0x162F2248, 0x162F2148, 0x162F2048,
+    };
+
+    // 0x4edaba
+    // Turnaround 0. Lane 1. Track 5. Reversed 1. Direction 0
+    static constexpr PackedMoveInfo moveInfoTA0L1T5R1D0[] = {
+        0x34204840, 0x34204841, 0x34204842, 0x34204843, 0x341F4844, 0x341F4845, 0x341F4846, 0x341F4847,
+        0x341E4848, 0x341E4849, 0x341E484A, 0x341E484B, 0x341D484C, 0x341D484D, 0x341D484E, 0x341D484F,
+        0x341C4850, 0x341C4851, 0x341C4852, 0x341C4853, 0x341B4854, 0x341B4855, 0x341B4856, 0x341B4857,
+        0x341A4858, 0x341A4859, 0x341A485A, 0x341A485B, 0x3419485C, 0x3419485D, 0x3419485E, 0x3419485F,
+        0x34184860, 0x34184861, 0x34184862, 0x34184863, 0x34174864, 0x34174865, 0x34174866, 0x34174867,
+        0x34164868, 0x34164869, 0x3416486A, 0x3416486B, 0x3415486C, 0x3415486D, 0x3415486E, 0x3415486F,
+        0x34144870, 0x34144871, 0x34144872, 0x34144873, 0x34134874, 0x34134875, 0x34134876, 0x34134877,
+        0x34124878, 0x34124879, 0x3412487A, 0x3412487B, 0x3411487C, 0x3411487D, 0x3411487E, 0x3411487F,
+    };
+
+    // 0x4edcbc
+    // Turnaround 0. Lane 1. Track 5. Reversed 1. Direction 1
+    static constexpr PackedMoveInfo moveInfoTA0L1T5R1D1[] = {
+        0x36205F48, 0x36205E48, 0x36205D48, 0x36205C48, 0x361F5B48, 0x361F5A48, 0x361F5948, 0x361F5848,
+        0x361E5748, 0x361E5648, 0x361E5548, 0x361E5448, 0x361D5348, 0x361D5248, 0x361D5148, 0x361D5048,
+        0x361C4F48, 0x361C4E48, 0x361C4D48, 0x361C4C48, 0x361B4B48, 0x361B4A48, 0x361B4948, 0x361B4848,
+        0x361A4748, 0x361A4648, 0x361A4548, 0x361A4448, 0x36194348, 0x36194248, 0x36194148, 0x36194048,
+        0x36183F48, 0x36183E48, 0x36183D48, 0x36183C48, 0x36173B48, 0x36173A48, 0x36173948, 0x36173848,
+        0x36163748, 0x36163648, 0x36163548, 0x36163448, 0x36153348, 0x36153248, 0x36153148, 0x36153048,
+        0x36142F48, 0x36142E48, 0x36142D48, 0x36142C48, 0x36132B48, 0x36132A48, 0x36132948, 0x36132848,
+        0x36122748, 0x36122648, 0x36122548, 0x36122448, 0x36112348, 0x36112248, 0x36112148, 0x36112048,
+    };
+
+    // 0x4ed6b6
+    // Turnaround 0. Lane 1. Track 5. Reversed 1. Direction 2
+    static constexpr PackedMoveInfo moveInfoTA0L1T5R1D2[] = {
+        0x3020585F, 0x3020585E, 0x3020585D, 0x3020585C, 0x301F585B, 0x301F585A, 0x301F5859, 0x301F5858,
+        0x301E5857, 0x301E5856, 0x301E5855, 0x301E5854, 0x301D5853, 0x301D5852, 0x301D5851, 0x301D5850,
+        0x301C584F, 0x301C584E, 0x301C584D, 0x301C584C, 0x301B584B, 0x301B584A, 0x301B5849, 0x301B5848,
+        0x301A5847, 0x301A5846, 0x301A5845, 0x301A5844, 0x30195843, 0x30195842, 0x30195841, 0x30195840,
+        0x3018583F, 0x3018583E, 0x3018583D, 0x3018583C, 0x3017583B, 0x3017583A, 0x30175839, 0x30175838,
+        0x30165837, 0x30165836, 0x30165835, 0x30165834, 0x30155833, 0x30155832, 0x30155831, 0x30155830,
+        0x3014582F, 0x3014582E, 0x3014582D, 0x3014582C, 0x3013582B, 0x3013582A, 0x30135829, 0x30135828,
+        0x30125827, 0x30125826, 0x30125825, 0x30125824, 0x30115823, 0x30115822, 0x30115821, 0x30115820,
+    };
+
+    // 0x4ed8b8
+    // Turnaround 0. Lane 1. Track 5. Reversed 1. Direction 3
+    static constexpr PackedMoveInfo moveInfoTA0L1T5R1D3[] = {
+        0x32204058, 0x32204158, 0x32204258, 0x32204358, 0x321F4458, 0x321F4558, 0x321F4658, 0x321F4758,
+        0x321E4858, 0x321E4958, 0x321E4A58, 0x321E4B58, 0x321D4C58, 0x321D4D58, 0x321D4E58, 0x321D4F58,
+        0x321C5058, 0x321C5158, 0x321C5258, 0x321C5358, 0x321B5458, 0x321B5558, 0x321B5658, 0x321B5758,
+        0x321A5858, 0x321A5958, 0x321A5A58, 0x321A5B58, 0x32195C58, 0x32195D58, 0x32195E58, 0x32195F58,
+        0x32186058, 0x32186158, 0x32186258, 0x32186358, 0x32176458, 0x32176558, 0x32176658, 0x32176758,
+        0x32166858, 0x32166958, 0x32166A58, 0x32166B58, 0x32156C58, 0x32156D58, 0x32156E58, 0x32156F58,
+        0x32147058, 0x32147158, 0x32147258, 0x32147358, 0x32137458, 0x32137558, 0x32137658, 0x32137758,
+        0x32127858, 0x32127958, 0x32127A58, 0x32127B58, 0x32117C58, 0x32117D58, 0x32117E58, 0x32117F58,
+    };
+
+    // 0x4dd576
+    // Turnaround 0. Lane 1. Track 7. Reversed 0. Direction 0
+    // Same entries as moveInfoT35R0D0
+    static constexpr auto& moveInfoTA0L1T7R0D0 = moveInfoT35R0D0;
+
+    // 0x4dd678
+    // Turnaround 0. Lane 1. Track 7. Reversed 0. Direction 1
+    // Same entries as moveInfoT35R0D1
+    static constexpr auto& moveInfoTA0L1T7R0D1 = moveInfoT35R0D1;
+
+    // 0x4dd77a
+    // Turnaround 0. Lane 1. Track 7. Reversed 0. Direction 2
+    // Same entries as moveInfoT35R0D2
+    static constexpr auto& moveInfoTA0L1T7R0D2 = moveInfoT35R0D2;
+
+    // 0x4dd87c
+    // Turnaround 0. Lane 1. Track 7. Reversed 0. Direction 3
+    // Same entries as moveInfoT35R0D3
+    static constexpr auto& moveInfoTA0L1T7R0D3 = moveInfoT35R0D3;
+
+    // 0x4ddb82
+    // Turnaround 0. Lane 1. Track 7. Reversed 1. Direction 0
+    // Same entries as moveInfoT34R1D0
+    static constexpr auto& moveInfoTA0L1T7R1D0 = moveInfoT34R1D0;
+
+    // 0x4ddc84
+    // Turnaround 0. Lane 1. Track 7. Reversed 1. Direction 1
+    // Same entries as moveInfoT34R1D1
+    static constexpr auto& moveInfoTA0L1T7R1D1 = moveInfoT34R1D1;
+
+    // 0x4dd97e
+    // Turnaround 0. Lane 1. Track 7. Reversed 1. Direction 2
+    // Same entries as moveInfoT34R1D2
+    static constexpr auto& moveInfoTA0L1T7R1D2 = moveInfoT34R1D2;
+
+    // 0x4dda80
+    // Turnaround 0. Lane 1. Track 7. Reversed 1. Direction 3
+    // Same entries as moveInfoT34R1D3
+    static constexpr auto& moveInfoTA0L1T7R1D3 = moveInfoT34R1D3;
+
+    // 0x4df08e
+    // Turnaround 0. Lane 1. Track 9. Reversed 0. Direction 0
+    // Same entries as moveInfoT42R1D0
+    static constexpr auto& moveInfoTA0L1T9R0D0 = moveInfoT42R1D0;
+
+    // 0x4df148
+    // Turnaround 0. Lane 1. Track 9. Reversed 0. Direction 1
+    // Same entries as moveInfoT42R1D1
+    static constexpr auto& moveInfoTA0L1T9R0D1 = moveInfoT42R1D1;
+
+    // 0x4df202
+    // Turnaround 0. Lane 1. Track 9. Reversed 0. Direction 2
+    // Same entries as moveInfoT42R1D2
+    static constexpr auto& moveInfoTA0L1T9R0D2 = moveInfoT42R1D2;
+
+    // 0x4df2bc
+    // Turnaround 0. Lane 1. Track 9. Reversed 0. Direction 3
+    // Same entries as moveInfoT42R1D3
+    static constexpr auto& moveInfoTA0L1T9R0D3 = moveInfoT42R1D3;
+
+    // 0x4f217e
+    // Turnaround 1. Lane 0. Track 0. Reversed 0. Direction 0
+    static constexpr PackedMoveInfo moveInfoTA1L0T0R0D0[] = {
+        0x0020485F, 0x0020485E, 0x0020495D, 0x0020495C, 0x00204A5B, 0x00204A5A, 0x00204B59, 0x00204B58,
+        0x00204C57, 0x00204C56, 0x00204D55, 0x00204D54, 0x00204E53, 0x00204E52, 0x00204F51, 0x00204F50,
+        0x0020504F, 0x0020504E, 0x0020514D, 0x0020514C, 0x0020524B, 0x0020524A, 0x00205349, 0x00205348,
+        0x00205447, 0x00205446, 0x00205545, 0x00205544, 0x00205643, 0x00205642, 0x00205741, 0x00205740,
+    };
+
+    // 0x4f2280
+    // Turnaround 1. Lane 0. Track 0. Reversed 0. Direction 1
+    static constexpr PackedMoveInfo moveInfoTA1L0T0R0D1[] = {
+        0x02204048, 0x02204148, 0x02204249, 0x02204349, 0x0220444A, 0x0220454A, 0x0220464B, 0x0220474B,
+        0x0220484C, 0x0220494C, 0x02204A4D, 0x02204B4D, 0x02204C4E, 0x02204D4E, 0x02204E4F, 0x02204F4F,
+        0x02205050, 0x02205150, 0x02205251, 0x02205351, 0x02205452, 0x02205552, 0x02205653, 0x02205753,
+        0x02205854, 0x02205954, 0x02205A55, 0x02205B55, 0x02205C56, 0x02205D56, 0x02205E57, 0x02205F57,
+    };
+
+    // 0x4f2382
+    // Turnaround 1. Lane 0. Track 0. Reversed 0. Direction 2
+    static constexpr PackedMoveInfo moveInfoTA1L0T0R0D2[] = {
+        0x04205840, 0x04205841, 0x04205742, 0x04205743, 0x04205644, 0x04205645, 0x04205546, 0x04205547,
+        0x04205448, 0x04205449, 0x0420534A, 0x0420534B, 0x0420524C, 0x0420524D, 0x0420514E, 0x0420514F,
+        0x04205050, 0x04205051, 0x04204F52, 0x04204F53, 0x04204E54, 0x04204E55, 0x04204D56, 0x04204D57,
+        0x04204C58, 0x04204C59, 0x04204B5A, 0x04204B5B, 0x04204A5C, 0x04204A5D, 0x0420495E, 0x0420495F,
+    };
+
+    // 0x4f2484
+    // Turnaround 1. Lane 0. Track 0. Reversed 0. Direction 3
+    static constexpr PackedMoveInfo moveInfoTA1L0T0R0D3[] = {
+        0x06205F58, 0x06205E58, 0x06205D57, 0x06205C57, 0x06205B56, 0x06205A56, 0x06205955, 0x06205855,
+        0x06205754, 0x06205654, 0x06205553, 0x06205453, 0x06205352, 0x06205252, 0x06205151, 0x06205051,
+        0x06204F50, 0x06204E50, 0x06204D4F, 0x06204C4F, 0x06204B4E, 0x06204A4E, 0x0620494D, 0x0620484D,
+        0x0620474C, 0x0620464C, 0x0620454B, 0x0620444B, 0x0620434A, 0x0620424A, 0x06204149, 0x06204049,
+    };
+
+    // 0x4f39ae
+    // Turnaround 1. Lane 0. Track 1. Reversed 0. Direction 0
+    static constexpr PackedMoveInfo moveInfoTA1L0T1R0D0[] = {
+        0x0020485F, 0x0020485E, 0x0020485D, 0x0020485C, 0x0020485B, 0x0020485A, 0x00204859, 0x00204858,
+        0x00204857, 0x00204856, 0x00204855, 0x00204854, 0x00204853, 0x00204852, 0x00204851, 0x00204850,
+        0x0020484F, 0x0020484E, 0x07E0484D, 0x07A0474C, 0x0760474B, 0x0720464A, 0x06E04549, 0x06A04449,
+        0x06604348, 0x06204248, 0x06204148, 0x06204048,
+    };
+
+    // 0x4f3a90
+    // Turnaround 1. Lane 0. Track 1. Reversed 0. Direction 1
+    static constexpr PackedMoveInfo moveInfoTA1L0T1R0D1[] = {
+        0x02204048, 0x02204148, 0x02204248, 0x02204348, 0x02204448, 0x02204548, 0x02204648, 0x02204748,
+        0x02204848, 0x02204948, 0x02204A48, 0x02204B48, 0x02204C48, 0x02204D48, 0x02204E48, 0x02204F48,
+        0x02205048, 0x02205148, 0x01E05248, 0x01A05347, 0x01605447, 0x01205546, 0x01205645, 0x00E05744,
+        0x00A05743, 0x00605842, 0x00205841, 0x00205840,
+    };
+
+    // 0x4f3b72
+    // Turnaround 1. Lane 0. Track 1. Reversed 0. Direction 2
+    static constexpr PackedMoveInfo moveInfoTA1L0T1R0D2[] = {
+        0x04205840, 0x04205841, 0x04205842, 0x04205843, 0x04205844, 0x04205845, 0x04205846, 0x04205847,
+        0x04205848, 0x04205849, 0x0420584A, 0x0420584B, 0x0420584C, 0x0420584D, 0x0420584E, 0x0420584F,
+        0x04205850, 0x04205851, 0x04205852, 0x03E05853, 0x03A05954, 0x03605955, 0x03205A56, 0x02E05B57,
+        0x02A05C57, 0x02605D58, 0x02205E58, 0x02205F58,
+    };
+
+    // 0x4f3c54
+    // Turnaround 1. Lane 0. Track 1. Reversed 0. Direction 3
+    static constexpr PackedMoveInfo moveInfoTA1L0T1R0D3[] = {
+        0x06205F58, 0x06205E58, 0x06205D58, 0x06205C58, 0x06205B58, 0x06205A58, 0x06205958, 0x06205858,
+        0x06205758, 0x06205658, 0x06205558, 0x06205458, 0x06205358, 0x06205258, 0x06205158, 0x06205058,
+        0x06204F58, 0x06204E58, 0x05E04D58, 0x05A04C59, 0x05604B59, 0x05204A5A, 0x04E0495B, 0x04A0495C,
+        0x0460485D, 0x0420485E, 0x0420485F,
+    };
+
+    // 0x4f3e08
+    // Turnaround 1. Lane 0. Track 1. Reversed 1. Direction 0
+    static constexpr PackedMoveInfo moveInfoTA1L0T1R1D0[] = {
+        0x02204048, 0x02204148, 0x02204248, 0x02604348, 0x02A04449, 0x02E04549, 0x0320464A, 0x0360474B,
+        0x03A0474C, 0x03E0484D, 0x0420484E, 0x0420484F, 0x04204850, 0x04204851, 0x04204852, 0x04204853,
+        0x04204854, 0x04204855, 0x04204856, 0x04204857, 0x04204858, 0x04204859, 0x0420485A, 0x0420485B,
+        0x0420485C, 0x0420485D, 0x0420485E, 0x0420485F,
+    };
+
+    // 0x4f3eea
+    // Turnaround 1. Lane 0. Track 1. Reversed 1. Direction 1
+    static constexpr PackedMoveInfo moveInfoTA1L0T1R1D1[] = {
+        0x04205840, 0x04205841, 0x04605842, 0x04A05743, 0x04E05744, 0x05205645, 0x05205546, 0x05605447,
+        0x05A05347, 0x05E05248, 0x06205148, 0x06205048, 0x06204F48, 0x06204E48, 0x06204D48, 0x06204C48,
+        0x06204B48, 0x06204A48, 0x06204948, 0x06204848, 0x06204748, 0x06204648, 0x06204548, 0x06204448,
+        0x06204348, 0x06204248, 0x06204148, 0x06204048,
+    };
+
+    // 0x4f3fcc
+    // Turnaround 1. Lane 0. Track 1. Reversed 1. Direction 2
+    static constexpr PackedMoveInfo moveInfoTA1L0T1R1D2[] = {
+        0x06205F58, 0x06205E58, 0x06605D58, 0x06A05C57, 0x06E05B57, 0x07205A56, 0x07605955, 0x07A05954,
+        0x07E05853, 0x00205852, 0x00205851, 0x00205850, 0x0020584F, 0x0020584E, 0x0020584D, 0x0020584C,
+        0x0020584B, 0x0020584A, 0x00205849, 0x00205848, 0x00205847, 0x00205846, 0x00205845, 0x00205844,
+        0x00205843, 0x00205842, 0x00205841, 0x00205840,
+    };
+
+    // 0x4f3d2e
+    // Turnaround 1. Lane 0. Track 1. Reversed 1. Direction 3
+    static constexpr PackedMoveInfo moveInfoTA1L0T1R1D3[] = {
+        0x0020485F, 0x0020485E, 0x0060485D, 0x00A0495C, 0x00E0495B, 0x01204A5A, 0x01604B59, 0x01A04C59,
+        0x01E04D58, 0x02204E58, 0x02204F58, 0x02205058, 0x02205158, 0x02205258, 0x02205358, 0x02205458,
+        0x02205558, 0x02205658, 0x02205758, 0x02205858, 0x02205958, 0x02205A58, 0x02205B58, 0x02205C58,
+        0x02205D58, 0x02205E58, 0x02205F58,
+    };
+
+    // 0x4f47ae
+    // Turnaround 1. Lane 0. Track 3. Reversed 0. Direction 0
+    static constexpr PackedMoveInfo moveInfoTA1L0T3R0D0[] = {
+        0x0020485F, 0x0020485E, 0x0020485D, 0x0020485C, 0x0020485B, 0x0020485A, 0x00204859, 0x00204858,
+        0x00204857, 0x00204856, 0x00204855, 0x00204854, 0x00204853, 0x00204852, 0x00204851, 0x00204850,
+        0x0020484F, 0x0020484E, 0x0020484D, 0x07E0484C, 0x07E0484B, 0x07E0484A, 0x07E04749, 0x07E04748,
+        0x07E04747, 0x07E04746, 0x07E04645, 0x07A04644, 0x07A04643, 0x07A04642, 0x07A04541, 0x07A04540,
+        0x07A0453F, 0x07A0443E, 0x0760443D, 0x0760433C, 0x0760423B, 0x0760423A, 0x07604139, 0x07604038,
+        0x07203F37, 0x07203E36, 0x07203E35, 0x07203D34, 0x07203D33, 0x07203C32, 0x07203B32, 0x06E03A31,
+        0x06E03930, 0x06E0382F, 0x06E0372E, 0x06E0362E, 0x06E0352D, 0x06E0342C, 0x06A0332C, 0x06A0322B,
+        0x06A0312B, 0x06A0302B, 0x06A02F2A, 0x06A02E2A, 0x06A02D2A, 0x06A02C2A, 0x06602B29, 0x06602A29,
+        0x06602929, 0x06602829, 0x06602728, 0x06602628, 0x06602528, 0x06202428, 0x06202328, 0x06202228,
+        0x06202128, 0x06202028,
+    };
+
+    // 0x4f4a00
+    // Turnaround 1. Lane 0. Track 3. Reversed 0. Direction 1
+    static constexpr PackedMoveInfo moveInfoTA1L0T3R0D1[] = {
+        0x02204048, 0x02204148, 0x02204248, 0x02204348, 0x02204448, 0x02204548, 0x02204648, 0x02204748,
+        0x02204848, 0x02204948, 0x02204A48, 0x02204B48, 0x02204C48, 0x02204D48, 0x02204E48, 0x02204F48,
+        0x02205048, 0x02205148, 0x02205248, 0x02205348, 0x01E05448, 0x01E05548, 0x01E05648, 0x01E05747,
+        0x01E05847, 0x01E05947, 0x01E05A47, 0x01E05B46, 0x01A05C46, 0x01A05D46, 0x01A05E46, 0x01A05F45,
+        0x01A06045, 0x01A06145, 0x01A06244, 0x01606344, 0x01606443, 0x01606542, 0x01606642, 0x01606741,
+        0x01606840, 0x0120693F, 0x01206A3E, 0x01206B3E, 0x01206C3D, 0x01206D3D, 0x01206E3C, 0x01206E3B,
+        0x00E06F3A, 0x00E07039, 0x00E07138, 0x00E07237, 0x00E07236, 0x00E07335, 0x00E07434, 0x00A07433,
+        0x00A07532, 0x00A07531, 0x00A07530, 0x00A0762F, 0x00A0762E, 0x00A0762D, 0x00A0762C, 0x0060772B,
+        0x0060772A, 0x00607729, 0x00607728, 0x00607827, 0x00607826, 0x00607825, 0x00207824, 0x00207823,
+        0x00207822, 0x00207821, 0x00207820,
+    };
+
+    // 0x4f4c5a
+    // Turnaround 1. Lane 0. Track 3. Reversed 0. Direction 2
+    static constexpr PackedMoveInfo moveInfoTA1L0T3R0D2[] = {
+        0x04205840, 0x04205841, 0x04205842, 0x04205843, 0x04205844, 0x04205845, 0x04205846, 0x04205847,
+        0x04205848, 0x04205849, 0x0420584A, 0x0420584B, 0x0420584C, 0x0420584D, 0x0420584E, 0x0420584F,
+        0x04205850, 0x04205851, 0x04205852, 0x04205853, 0x03E05854, 0x03E05855, 0x03E05856, 0x03E05957,
+        0x03E05958, 0x03E05959, 0x03E0595A, 0x03E05A5B, 0x03A05A5C, 0x03A05A5D, 0x03A05A5E, 0x03A05B5F,
+        0x03A05B60, 0x03A05B61, 0x03A05C62, 0x03605C63, 0x03605D64, 0x03605E65, 0x03605E66, 0x03605F67,
+        0x03606068, 0x03206169, 0x0320626A, 0x0320626B, 0x0320636C, 0x0320636D, 0x0320646E, 0x0320656E,
+        0x02E0666F, 0x02E06770, 0x02E06871, 0x02E06972, 0x02E06A72, 0x02E06B73, 0x02E06C74, 0x02A06D74,
+        0x02A06E75, 0x02A06F75, 0x02A07075, 0x02A07176, 0x02A07276, 0x02A07376, 0x02A07476, 0x02607577,
+        0x02607677, 0x02607777, 0x02607877, 0x02607978, 0x02607A78, 0x02607B78, 0x02207C78, 0x02207D78,
+        0x02207E78, 0x02207F78,
+    };
+
+    // 0x4f4eac
+    // Turnaround 1. Lane 0. Track 3. Reversed 0. Direction 3
+    static constexpr PackedMoveInfo moveInfoTA1L0T3R0D3[] = {
+        0x06205F58, 0x06205E58, 0x06205D58, 0x06205C58, 0x06205B58, 0x06205A58, 0x06205958, 0x06205858,
+        0x06205758, 0x06205658, 0x06205558, 0x06205458, 0x06205358, 0x06205258, 0x06205158, 0x06205058,
+        0x06204F58, 0x06204E58, 0x06204D58, 0x05E04C58, 0x05E04B58, 0x05E04A58, 0x05E04959, 0x05E04859,
+        0x05E04759, 0x05E04659, 0x05E0455A, 0x05A0445A, 0x05A0435A, 0x05A0425A, 0x05A0415B, 0x05A0405B,
+        0x05A03F5B, 0x05A03E5C, 0x05603D5C, 0x05603C5D, 0x05603B5E, 0x05603A5E, 0x0560395F, 0x05603860,
+        0x05203761, 0x05203662, 0x05203562, 0x05203463, 0x05203363, 0x05203264, 0x05203265, 0x04E03166,
+        0x04E03067, 0x04E02F68, 0x04E02E69, 0x04E02E6A, 0x04E02D6B, 0x04E02C6C, 0x04A02C6D, 0x04A02B6E,
+        0x04A02B6F, 0x04A02B70, 0x04A02A71, 0x04A02A72, 0x04A02A73, 0x04A02A74, 0x04602975, 0x04602976,
+        0x04602977, 0x04602978, 0x04602879, 0x0460287A, 0x0460287B, 0x0420287C, 0x0420287D, 0x0420287E,
+        0x0420287F,
+    };
+
+    // 0x4f5340
+    // Turnaround 1. Lane 0. Track 3. Reversed 1. Direction 0
+    static constexpr PackedMoveInfo moveInfoTA1L0T3R1D0[] = {
+        0x02204048, 0x02204148, 0x02204248, 0x02204348, 0x02604448, 0x02604548, 0x02604648, 0x02604749,
+        0x02604849, 0x02604949, 0x02604A49, 0x02604B4A, 0x02A04C4A, 0x02A04D4A, 0x02A04E4A, 0x02A04F4B,
+        0x02A0504B, 0x02A0514B, 0x02A0524C, 0x02E0534C, 0x02E0544D, 0x02E0554E, 0x02E0564E, 0x02E0574F,
+        0x02E05850, 0x03205951, 0x03205A52, 0x03205B52, 0x03205C53, 0x03205D53, 0x03205E54, 0x03205E55,
+        0x03605F56, 0x03606057, 0x03606158, 0x03606259, 0x0360625A, 0x0360635B, 0x0360645C, 0x03A0645D,
+        0x03A0655E, 0x03A0655F, 0x03A06560, 0x03A06661, 0x03A06662, 0x03A06663, 0x03A06664, 0x03E06765,
+        0x03E06766, 0x03E06767, 0x03E06768, 0x03E06869, 0x03E0686A, 0x03E0686B, 0x0420686C, 0x0420686D,
+        0x0420686E, 0x0420686F, 0x04206870, 0x04206871, 0x04206872, 0x04206873, 0x04206874, 0x04206875,
+        0x04206876, 0x04206877, 0x04206878, 0x04206879, 0x0420687A, 0x0420687B, 0x0420687C, 0x0420687D,
+        0x0420687E, 0x0420687F,
+    };
+
+    // 0x4f5592
+    // Turnaround 1. Lane 0. Track 3. Reversed 1. Direction 1
+    static constexpr PackedMoveInfo moveInfoTA1L0T3R1D1[] = {
+        0x04205840, 0x04205841, 0x04205842, 0x04205843, 0x04605844, 0x04605845, 0x04605846, 0x04605747,
+        0x04605748, 0x04605749, 0x0460574A, 0x0460564B, 0x04A0564C, 0x04A0564D, 0x04A0564E, 0x04A0554F,
+        0x04A05550, 0x04A05551, 0x04A05452, 0x04E05453, 0x04E05354, 0x04E05255, 0x04E05256, 0x04E05157,
+        0x04E05058, 0x05204F59, 0x05204E5A, 0x05204E5B, 0x05204D5C, 0x05204D5D, 0x05204C5E, 0x05204B5E,
+        0x05604A5F, 0x05604960, 0x05604861, 0x05604762, 0x05604662, 0x05604563, 0x05604464, 0x05A04364,
+        0x05A04265, 0x05A04165, 0x05A04065, 0x05A03F66, 0x05A03E66, 0x05A03D66, 0x05A03C66, 0x05E03B67,
+        0x05E03A67, 0x05E03967, 0x05E03867, 0x05E03768, 0x05E03668, 0x05E03568, 0x06203468, 0x06203368,
+        0x06203268, 0x06203168, 0x06203068, 0x06202F68, 0x06202E68, 0x06202D68, 0x06202C68, 0x06202B68,
+        0x06202A68, 0x06202968, 0x06202868, 0x06202768, 0x06202668, 0x06202568, 0x06202468, 0x06202368,
+        0x06202268, 0x06202168, 0x06202068,
+    };
+
+    // 0x4f57ec
+    // Turnaround 1. Lane 0. Track 3. Reversed 1. Direction 2
+    static constexpr PackedMoveInfo moveInfoTA1L0T3R1D2[] = {
+        0x06205F58, 0x06205E58, 0x06205D58, 0x06605C58, 0x06605B58, 0x06605A58, 0x06605957, 0x06605857,
+        0x06605757, 0x06605657, 0x06605556, 0x06A05456, 0x06A05356, 0x06A05256, 0x06A05155, 0x06A05055,
+        0x06A04F55, 0x06A04E54, 0x06E04D54, 0x06E04C53, 0x06E04B52, 0x06E04A52, 0x06E04951, 0x06E04850,
+        0x0720474F, 0x0720464E, 0x0720454E, 0x0720444D, 0x0720434D, 0x0720424C, 0x0720424B, 0x0760414A,
+        0x07604049, 0x07603F48, 0x07603E47, 0x07603E46, 0x07603D45, 0x07603C44, 0x07A03C43, 0x07A03B42,
+        0x07A03B41, 0x07A03B40, 0x07A03A3F, 0x07A03A3E, 0x07A03A3D, 0x07A03A3C, 0x07E0393B, 0x07E0393A,
+        0x07E03939, 0x07E03938, 0x07E03837, 0x07E03836, 0x07E03835, 0x00203834, 0x00203833, 0x00203832,
+        0x00203831, 0x00203830, 0x0020382F, 0x0020382E, 0x0020382D, 0x0020382C, 0x0020382B, 0x0020382A,
+        0x00203829, 0x00203828, 0x00203827, 0x00203826, 0x00203825, 0x00203824, 0x00203823, 0x00203822,
+        0x00203821, 0x00203820,
+    };
+
+    // 0x4f50f6
+    // Turnaround 1. Lane 0. Track 3. Reversed 1. Direction 3
+    static constexpr PackedMoveInfo moveInfoTA1L0T3R1D3[] = {
+        0x0020485F, 0x0020485E, 0x0020485D, 0x0060485C, 0x0060485B, 0x0060485A, 0x00604959, 0x00604958,
+        0x00604957, 0x00604956, 0x00604A55, 0x00A04A54, 0x00A04A53, 0x00A04A52, 0x00A04B51, 0x00A04B50,
+        0x00A04B4F, 0x00A04C4E, 0x00E04C4D, 0x00E04D4C, 0x00E04E4B, 0x00E04E4A, 0x00E04F49, 0x00E05048,
+        0x01205147, 0x01205246, 0x01205245, 0x01205344, 0x01205343, 0x01205442, 0x01205542, 0x01605641,
+        0x01605740, 0x0160583F, 0x0160593E, 0x01605A3E, 0x01605B3D, 0x01605C3C, 0x01A05D3C, 0x01A05E3B,
+        0x01A05F3B, 0x01A0603B, 0x01A0613A, 0x01A0623A, 0x01A0633A, 0x01A0643A, 0x01E06539, 0x01E06639,
+        0x01E06739, 0x01E06839, 0x01E06938, 0x01E06A38, 0x01E06B38, 0x02206C38, 0x02206D38, 0x02206E38,
+        0x02206F38, 0x02207038, 0x02207138, 0x02207238, 0x02207338, 0x02207438, 0x02207538, 0x02207638,
+        0x02207738, 0x02207838, 0x02207938, 0x02207A38, 0x02207B38, 0x02207C38, 0x02207D38, 0x02207E38,
+        0x02207F38,
+    };
+
+    // 0x4f015e
+    // Turnaround 1. Lane 0. Track 5. Reversed 0. Direction 0
+    static constexpr PackedMoveInfo moveInfoTA1L0T5R0D0[] = {
+        0x1020485F, 0x1020485E, 0x1020485D, 0x1020485C, 0x1021495B, 0x1021495A, 0x10214959, 0x10214958,
+        0x10224A57, 0x10224A56, 0x10224A55, 0x10224A54, 0x10234B53, 0x10234B52, 0x10234B51, 0x10234B50,
+        0x10244C4F, 0x10244C4E, 0x10244C4D, 0x10244C4C, 0x10254D4B, 0x10254D4A, 0x10254D49, 0x10254D48,
+        0x10264E47, 0x10264E46, 0x10264E45, 0x10264E44, 0x10274F43, 0x10274F42, 0x10274F41, 0x10274F40,
+        0x1028503F, 0x1028503E, 0x1028503D, 0x1028503C, 0x1029513B, 0x1029513A, 0x10295139, 0x10295138,
+        0x102A5237, 0x102A5236, 0x102A5235, 0x102A5234, 0x102B5333, 0x102B5332, 0x102B5331, 0x102B5330,
+        0x102C542F, 0x102C542E, 0x102C542D, 0x102C542C, 0x102D552B, 0x102D552A, 0x102D5529, 0x102D5528,
+        0x102E5627, 0x102E5626, 0x102E5625, 0x102E5624, 0x102F5723, 0x102F5722, 0x102F5721, 0x102F5720,
+    };
+
+    // 0x4f0360
+    // Turnaround 1. Lane 0. Track 5. Reversed 0. Direction 1
+    static constexpr PackedMoveInfo moveInfoTA1L0T5R0D1[] = {
+        0x12204048, 0x12204148, 0x12204248, 0x12204348, 0x12214449, 0x12214549, 0x12214649, 0x12214749,
+        0x1222484A, 0x1222494A, 0x12224A4A, 0x12224B4A, 0x12234C4B, 0x12234D4B, 0x12234E4B, 0x12234F4B,
+        0x1224504C, 0x1224514C, 0x1224524C, 0x1224534C, 0x1225544D, 0x1225554D, 0x1225564D, 0x1225574D,
+        0x1226584E, 0x1226594E, 0x12265A4E, 0x12265B4E, 0x12275C4F, 0x12275D4F, 0x12275E4F, 0x12275F4F,
+        0x12286050, 0x12286150, 0x12286250, 0x12286350, 0x12296451, 0x12296551, 0x12296651, 0x12296751,
+        0x122A6852, 0x122A6952, 0x122A6A52, 0x122A6B52, 0x122B6C53, 0x122B6D53, 0x122B6E53, 0x122B6F53,
+        0x122C7054, 0x122C7154, 0x122C7254, 0x122C7354, 0x122D7455, 0x122D7555, 0x122D7655, 0x122D7755,
+        0x122E7856, 0x122E7956, 0x122E7A56, 0x122E7B56, 0x122F7C57, 0x122F7D57, 0x122F7E57, 0x122F7F57,
+    };
+
+    // 0x4f0562
+    // Turnaround 1. Lane 0. Track 5. Reversed 0. Direction 2
+    static constexpr PackedMoveInfo moveInfoTA1L0T5R0D2[] = {
+        0x14205840, 0x14205841, 0x14205842, 0x14205843, 0x14215744, 0x14215745, 0x14215746, 0x14215747,
+        0x14225648, 0x14225649, 0x1422564A, 0x1422564B, 0x1423554C, 0x1423554D, 0x1423554E, 0x1423554F,
+        0x14245450, 0x14245451, 0x14245452, 0x14245453, 0x14255354, 0x14255355, 0x14255356, 0x14255357,
+        0x14265258, 0x14265259, 0x1426525A, 0x1426525B, 0x1427515C, 0x1427515D, 0x1427515E, 0x1427515F,
+        0x14285060, 0x14285061, 0x14285062, 0x14285063, 0x14294F64, 0x14294F65, 0x14294F66, 0x14294F67,
+        0x142A4E68, 0x142A4E69, 0x142A4E6A, 0x142A4E6B, 0x142B4D6C, 0x142B4D6D, 0x142B4D6E, 0x142B4D6F,
+        0x142C4C70, 0x142C4C71, 0x142C4C72, 0x142C4C73, 0x142D4B74, 0x142D4B75, 0x142D4B76, 0x142D4B77,
+        0x142E4A78, 0x142E4A79, 0x142E4A7A, 0x142E4A7B, 0x142F497C, 0x142F497D, 0x142F497E, 0x142F497F,
+    };
+
+    // 0x4f0764
+    // Turnaround 1. Lane 0. Track 5. Reversed 0. Direction 3
+    static constexpr PackedMoveInfo moveInfoTA1L0T5R0D3[] = {
+        0x16205F58, 0x16205E58, 0x16205D58, 0x16205C58, 0x16215B57, 0x16215A57, 0x16215957, 0x16215857,
+        0x16225756, 0x16225656, 0x16225556, 0x16225456, 0x16235355, 0x16235255, 0x16235155, 0x16235055,
+        0x16244F54, 0x16244E54, 0x16244D54, 0x16244C54, 0x16254B53, 0x16254A53, 0x16254953, 0x16254853,
+        0x16264752, 0x16264652, 0x16264552, 0x16264452, 0x16274351, 0x16274251, 0x16274151, 0x16274051,
+        0x16283F50, 0x16283E50, 0x16283D50, 0x16283C50, 0x16293B4F, 0x16293A4F, 0x1629394F, 0x1629384F,
+        0x162A374E, 0x162A364E, 0x162A354E, 0x162A344E, 0x162B334D, 0x162B324D, 0x162B314D, 0x162B304D,
+        0x162C2F4C, 0x162C2E4C, 0x162C2D4C, 0x162C2C4C, 0x162D2B4B, 0x162D2A4B, 0x162D294B, 0x162D284B,
+        0x162E274A, 0x162E264A, 0x162E254A, 0x162E244A, 0x162F2349, 0x162F2249, 0x162F2149, 0x162F2049,
+    };
+
+    // 0x4f0d6a
+    // Turnaround 1. Lane 0. Track 5. Reversed 1. Direction 0
+    static constexpr PackedMoveInfo moveInfoTA1L0T5R1D0[] = {
+        0x34205840, 0x34205841, 0x34205842, 0x34205843, 0x341F5744, 0x341F5745, 0x341F5746, 0x341F5747,
+        0x341E5648, 0x341E5649, 0x341E564A, 0x341E564B, 0x341D554C, 0x341D554D, 0x341D554E, 0x341D554F,
+        0x341C5450, 0x341C5451, 0x341C5452, 0x341C5453, 0x341B5354, 0x341B5355, 0x341B5356, 0x341B5357,
+        0x341A5258, 0x341A5259, 0x341A525A, 0x341A525B, 0x3419515C, 0x3419515D, 0x3419515E, 0x3419515F,
+        0x34185060, 0x34185061, 0x34185062, 0x34185063, 0x34174F64, 0x34174F65, 0x34174F66, 0x34174F67,
+        0x34164E68, 0x34164E69, 0x34164E6A, 0x34164E6B, 0x34154D6C, 0x34154D6D, 0x34154D6E, 0x34154D6F,
+        0x34144C70, 0x34144C71, 0x34144C72, 0x34144C73, 0x34134B74, 0x34134B75, 0x34134B76, 0x34134B77,
+        0x34124A78, 0x34124A79, 0x34124A7A, 0x34124A7B, 0x3411497C, 0x3411497D, 0x3411497E, 0x3411497F,
+    };
+
+    // 0x4f0f6c
+    // Turnaround 1. Lane 0. Track 5. Reversed 1. Direction 1
+    static constexpr PackedMoveInfo moveInfoTA1L0T5R1D1[] = {
+        0x36205F58, 0x36205E58, 0x36205D58, 0x36205C58, 0x361F5B57, 0x361F5A57, 0x361F5957, 0x361F5857,
+        0x361E5756, 0x361E5656, 0x361E5556, 0x361E5456, 0x361D5355, 0x361D5255, 0x361D5155, 0x361D5055,
+        0x361C4F54, 0x361C4E54, 0x361C4D54, 0x361C4C54, 0x361B4B53, 0x361B4A53, 0x361B4953, 0x361B4853,
+        0x361A4752, 0x361A4652, 0x361A4552, 0x361A4452, 0x36194351, 0x36194251, 0x36194151, 0x36194051,
+        0x36183F50, 0x36183E50, 0x36183D50, 0x36183C50, 0x36173B4F, 0x36173A4F, 0x3617394F, 0x3617384F,
+        0x3616374E, 0x3616364E, 0x3616354E, 0x3616344E, 0x3615334D, 0x3615324D, 0x3615314D, 0x3615304D,
+        0x36142F4C, 0x36142E4C, 0x36142D4C, 0x36142C4C, 0x36132B4B, 0x36132A4B, 0x3613294B, 0x3613284B,
+        0x3612274A, 0x3612264A, 0x3612254A, 0x3612244A, 0x36112349, 0x36112249, 0x36112149, 0x36112049,
+    };
+
+    // 0x4f0966
+    // Turnaround 1. Lane 0. Track 5. Reversed 1. Direction 2
+    static constexpr PackedMoveInfo moveInfoTA1L0T5R1D2[] = {
+        0x3020485F, 0x3020485E, 0x3020485D, 0x3020485C, 0x301F495B, 0x301F495A, 0x301F4959, 0x301F4958,
+        0x301E4A57, 0x301E4A56, 0x301E4A55, 0x301E4A54, 0x301D4B53, 0x301D4B52, 0x301D4B51, 0x301D4B50,
+        0x301C4C4F, 0x301C4C4E, 0x301C4C4D, 0x301C4C4C, 0x301B4D4B, 0x301B4D4A, 0x301B4D49, 0x301B4D48,
+        0x301A4E47, 0x301A4E46, 0x301A4E45, 0x301A4E44, 0x30194F43, 0x30194F42, 0x30194F41, 0x30194F40,
+        0x3018503F, 0x3018503E, 0x3018503D, 0x3018503C, 0x3017513B, 0x3017513A, 0x30175139, 0x30175138,
+        0x30165237, 0x30165236, 0x30165235, 0x30165234, 0x30155333, 0x30155332, 0x30155331, 0x30155330,
+        0x3014542F, 0x3014542E, 0x3014542D, 0x3014542C, 0x3013552B, 0x3013552A, 0x30135529, 0x30135528,
+        0x30125627, 0x30125626, 0x30125625, 0x30125624, 0x30115723, 0x30115722, 0x30115721, 0x30115720,
+    };
+
+    // 0x4f0b68
+    // Turnaround 1. Lane 0. Track 5. Reversed 1. Direction 3
+    static constexpr PackedMoveInfo moveInfoTA1L0T5R1D3[] = {
+        0x32204048, 0x32204148, 0x32204248, 0x32204348, 0x321F4449, 0x321F4549, 0x321F4649, 0x321F4749,
+        0x321E484A, 0x321E494A, 0x321E4A4A, 0x321E4B4A, 0x321D4C4B, 0x321D4D4B, 0x321D4E4B, 0x321D4F4B,
+        0x321C504C, 0x321C514C, 0x321C524C, 0x321C534C, 0x321B544D, 0x321B554D, 0x321B564D, 0x321B574D,
+        0x321A584E, 0x321A594E, 0x321A5A4E, 0x321A5B4E, 0x32195C4F, 0x32195D4F, 0x32195E4F, 0x32195F4F,
+        0x32186050, 0x32186150, 0x32186250, 0x32186350, 0x32176451, 0x32176551, 0x32176651, 0x32176751,
+        0x32166852, 0x32166952, 0x32166A52, 0x32166B52, 0x32156C53, 0x32156D53, 0x32156E53, 0x32156F53,
+        0x32147054, 0x32147154, 0x32147254, 0x32147354, 0x32137455, 0x32137555, 0x32137655, 0x32137755,
+        0x32127856, 0x32127956, 0x32127A56, 0x32127B56, 0x32117C57, 0x32117D57, 0x32117E57, 0x32117F57,
+    };
+
+    // 0x4f298e
+    // Turnaround 1. Lane 0. Track 7. Reversed 0. Direction 0
+    static constexpr PackedMoveInfo moveInfoTA1L0T7R0D0[] = {
+        0x2020485F, 0x2020485E, 0x2021495D, 0x2021495C, 0x20224A5B, 0x20224A5A, 0x20234B59, 0x20234B58,
+        0x20244C57, 0x20244C56, 0x20254D55, 0x20254D54, 0x20264E53, 0x20264E52, 0x20274F51, 0x20274F50,
+        0x2028504F, 0x2028504E, 0x2029514D, 0x2029514C, 0x202A524B, 0x202A524A, 0x202B5349, 0x202B5348,
+        0x202C5447, 0x202C5446, 0x202D5545, 0x202D5544, 0x202E5643, 0x202E5642, 0x202F5741, 0x202F5740,
+    };
+
+    // 0x4f2a90
+    // Turnaround 1. Lane 0. Track 7. Reversed 0. Direction 1
+    static constexpr PackedMoveInfo moveInfoTA1L0T7R0D1[] = {
+        0x22204048, 0x22204148, 0x22214249, 0x22214349, 0x2222444A, 0x2222454A, 0x2223464B, 0x2223474B,
+        0x2224484C, 0x2224494C, 0x22254A4D, 0x22254B4D, 0x22264C4E, 0x22264D4E, 0x22274E4F, 0x22274F4F,
+        0x22285050, 0x22285150, 0x22295251, 0x22295351, 0x222A5452, 0x222A5552, 0x222B5653, 0x222B5753,
+        0x222C5854, 0x222C5954, 0x222D5A55, 0x222D5B55, 0x222E5C56, 0x222E5D56, 0x222F5E57, 0x222F5F57,
+    };
+
+    // 0x4f2b92
+    // Turnaround 1. Lane 0. Track 7. Reversed 0. Direction 2
+    static constexpr PackedMoveInfo moveInfoTA1L0T7R0D2[] = {
+        0x24205840, 0x24205841, 0x24215742, 0x24215743, 0x24225644, 0x24225645, 0x24235546, 0x24235547,
+        0x24245448, 0x24245449, 0x2425534A, 0x2425534B, 0x2426524C, 0x2426524D, 0x2427514E, 0x2427514F,
+        0x24285050, 0x24285051, 0x24294F52, 0x24294F53, 0x242A4E54, 0x242A4E55, 0x242B4D56, 0x242B4D57,
+        0x242C4C58, 0x242C4C59, 0x242D4B5A, 0x242D4B5B, 0x242E4A5C, 0x242E4A5D, 0x242F495E, 0x242F495F,
+    };
+
+    // 0x4f2c94
+    // Turnaround 1. Lane 0. Track 7. Reversed 0. Direction 3
+    static constexpr PackedMoveInfo moveInfoTA1L0T7R0D3[] = {
+        0x26205F58, 0x26205E58, 0x26215D57, 0x26215C57, 0x26225B56, 0x26225A56, 0x26235955, 0x26235855,
+        0x26245754, 0x26245654, 0x26255553, 0x26255453, 0x26265352, 0x26265252, 0x26275151, 0x26275051,
+        0x26284F50, 0x26284E50, 0x26294D4F, 0x26294C4F, 0x262A4B4E, 0x262A4A4E, 0x262B494D, 0x262B484D,
+        0x262C474C, 0x262C464C, 0x262D454B, 0x262D444B, 0x262E434A, 0x262E424A, 0x262F4149, 0x262F4049,
+    };
+
+    // 0x4f2f9a
+    // Turnaround 1. Lane 0. Track 7. Reversed 1. Direction 0
+    static constexpr PackedMoveInfo moveInfoTA1L0T7R1D0[] = {
+        0x44205840, 0x44205841, 0x441F5742, 0x441F5743, 0x441E5644, 0x441E5645, 0x441D5546, 0x441D5547,
+        0x441C5448, 0x441C5449, 0x441B534A, 0x441B534B, 0x441A524C, 0x441A524D, 0x4419514E, 0x4419514F,
+        0x44185050, 0x44185051, 0x44174F52, 0x44174F53, 0x44164E54, 0x44164E55, 0x44154D56, 0x44154D57,
+        0x44144C58, 0x44144C59, 0x44134B5A, 0x44134B5B, 0x44124A5C, 0x44124A5D, 0x4411495E, 0x4411495F,
+    };
+
+    // 0x4f309c
+    // Turnaround 1. Lane 0. Track 7. Reversed 1. Direction 1
+    static constexpr PackedMoveInfo moveInfoTA1L0T7R1D1[] = {
+        0x46205F58, 0x46205E58, 0x461F5D57, 0x461F5C57, 0x461E5B56, 0x461E5A56, 0x461D5955, 0x461D5855,
+        0x461C5754, 0x461C5654, 0x461B5553, 0x461B5453, 0x461A5352, 0x461A5252, 0x46195151, 0x46195051,
+        0x46184F50, 0x46184E50, 0x46174D4F, 0x46174C4F, 0x46164B4E, 0x46164A4E, 0x4615494D, 0x4615484D,
+        0x4614474C, 0x4614464C, 0x4613454B, 0x4613444B, 0x4612434A, 0x4612424A, 0x46114149, 0x46114049,
+    };
+
+    // 0x4f2d96
+    // Turnaround 1. Lane 0. Track 7. Reversed 1. Direction 2
+    static constexpr PackedMoveInfo moveInfoTA1L0T7R1D2[] = {
+        0x4020485F, 0x4020485E, 0x401F495D, 0x401F495C, 0x401E4A5B, 0x401E4A5A, 0x401D4B59, 0x401D4B58,
+        0x401C4C57, 0x401C4C56, 0x401B4D55, 0x401B4D54, 0x401A4E53, 0x401A4E52, 0x40194F51, 0x40194F50,
+        0x4018504F, 0x4018504E, 0x4017514D, 0x4017514C, 0x4016524B, 0x4016524A, 0x40155349, 0x40155348,
+        0x40145447, 0x40145446, 0x40135545, 0x40135544, 0x40125643, 0x40125642, 0x40115741, 0x40115740,
+    };
+
+    // 0x4f2e98
+    // Turnaround 1. Lane 0. Track 7. Reversed 1. Direction 3
+    static constexpr PackedMoveInfo moveInfoTA1L0T7R1D3[] = {
+        0x42204048, 0x42204148, 0x421F4249, 0x421F4349, 0x421E444A, 0x421E454A, 0x421D464B, 0x421D474B,
+        0x421C484C, 0x421C494C, 0x421B4A4D, 0x421B4B4D, 0x421A4C4E, 0x421A4D4E, 0x42194E4F, 0x42194F4F,
+        0x42185050, 0x42185150, 0x42175251, 0x42175351, 0x42165452, 0x42165552, 0x42155653, 0x42155753,
+        0x42145854, 0x42145954, 0x42135A55, 0x42135B55, 0x42125C56, 0x42125D56, 0x42115E57, 0x42115F57,
+    };
+
+    // 0x4f2586
+    // Turnaround 1. Lane 1. Track 0. Reversed 0. Direction 0
+    static constexpr PackedMoveInfo moveInfoTA1L1T0R0D0[] = {
+        0x0020585F, 0x0020585E, 0x0020575D, 0x0020575C, 0x0020565B, 0x0020565A, 0x00205559, 0x00205558,
+        0x00205457, 0x00205456, 0x00205355, 0x00205354, 0x00205253, 0x00205252, 0x00205151, 0x00205150,
+        0x0020504F, 0x0020504E, 0x00204F4D, 0x00204F4C, 0x00204E4B, 0x00204E4A, 0x00204D49, 0x00204D48,
+        0x00204C47, 0x00204C46, 0x00204B45, 0x00204B44, 0x00204A43, 0x00204A42, 0x00204941, 0x00204940,
+    };
+
+    // 0x4f2688
+    // Turnaround 1. Lane 1. Track 0. Reversed 0. Direction 1
+    static constexpr PackedMoveInfo moveInfoTA1L1T0R0D1[] = {
+        0x02204058, 0x02204158, 0x02204257, 0x02204357, 0x02204456, 0x02204556, 0x02204655, 0x02204755,
+        0x02204854, 0x02204954, 0x02204A53, 0x02204B53, 0x02204C52, 0x02204D52, 0x02204E51, 0x02204F51,
+        0x02205050, 0x02205150, 0x0220524F, 0x0220534F, 0x0220544E, 0x0220554E, 0x0220564D, 0x0220574D,
+        0x0220584C, 0x0220594C, 0x02205A4B, 0x02205B4B, 0x02205C4A, 0x02205D4A, 0x02205E49, 0x02205F49,
+    };
+
+    // 0x4f278a
+    // Turnaround 1. Lane 1. Track 0. Reversed 0. Direction 2
+    static constexpr PackedMoveInfo moveInfoTA1L1T0R0D2[] = {
+        0x04204840, 0x04204841, 0x04204942, 0x04204943, 0x04204A44, 0x04204A45, 0x04204B46, 0x04204B47,
+        0x04204C48, 0x04204C49, 0x04204D4A, 0x04204D4B, 0x04204E4C, 0x04204E4D, 0x04204F4E, 0x04204F4F,
+        0x04205050, 0x04205051, 0x04205152, 0x04205153, 0x04205254, 0x04205255, 0x04205356, 0x04205357,
+        0x04205458, 0x04205459, 0x0420555A, 0x0420555B, 0x0420565C, 0x0420565D, 0x0420575E, 0x0420575F,
+    };
+
+    // 0x4f288c
+    // Turnaround 1. Lane 1. Track 0. Reversed 0. Direction 3
+    static constexpr PackedMoveInfo moveInfoTA1L1T0R0D3[] = {
+        0x06205F48, 0x06205E48, 0x06205D49, 0x06205C49, 0x06205B4A, 0x06205A4A, 0x0620594B, 0x0620584B,
+        0x0620574C, 0x0620564C, 0x0620554D, 0x0620544D, 0x0620534E, 0x0620524E, 0x0620514F, 0x0620504F,
+        0x06204F50, 0x06204E50, 0x06204D51, 0x06204C51, 0x06204B52, 0x06204A52, 0x06204953, 0x06204853,
+        0x06204754, 0x06204654, 0x06204555, 0x06204455, 0x06204356, 0x06204256, 0x06204157, 0x06204057,
+    };
+
+    // 0x4f4508
+    // Turnaround 1. Lane 1. Track 1. Reversed 0. Direction 0
+    static constexpr PackedMoveInfo moveInfoTA1L1T1R0D0[] = {
+        0x0020585F, 0x0020585E, 0x07E0585D, 0x07A0575C, 0x0760575B, 0x0720565A, 0x06E05559, 0x06A05459,
+        0x06605358, 0x06205258, 0x06205158, 0x06205058, 0x06204F58, 0x06204E58, 0x06204D58, 0x06204C58,
+        0x06204B58, 0x06204A58, 0x06204958, 0x06204858, 0x06204758, 0x06204658, 0x06204558, 0x06204458,
+        0x06204358, 0x06204258, 0x06204158, 0x06204058,
+    };
+
+    // 0x4f45ea
+    // Turnaround 1. Lane 1. Track 1. Reversed 0. Direction 1
+    static constexpr PackedMoveInfo moveInfoTA1L1T1R0D1[] = {
+        0x02204058, 0x02204158, 0x01E04258, 0x01A04357, 0x01604457, 0x01204556, 0x01204655, 0x00E04754,
+        0x00A04753, 0x00604852, 0x00204851, 0x00204850, 0x0020484F, 0x0020484E, 0x0020484D, 0x0020484C,
+        0x0020484B, 0x0020484A, 0x00204849, 0x00204848, 0x00204847, 0x00204846, 0x00204845, 0x00204844,
+        0x00204843, 0x00204842, 0x00204841, 0x00204840,
+    };
+
+    // 0x4f46cc
+    // Turnaround 1. Lane 1. Track 1. Reversed 0. Direction 2
+    static constexpr PackedMoveInfo moveInfoTA1L1T1R0D2[] = {
+        0x04204840, 0x04204841, 0x04204842, 0x03E04843, 0x03A04944, 0x03604945, 0x03204A46, 0x02E04B47,
+        0x02A04C47, 0x02604D48, 0x02204E48, 0x02204F48, 0x02205048, 0x02205148, 0x02205248, 0x02205348,
+        0x02205448, 0x02205548, 0x02205648, 0x02205748, 0x02205848, 0x02205948, 0x02205A48, 0x02205B48,
+        0x02205C48, 0x02205D48, 0x02205E48, 0x02205F48,
+    };
+
+    // 0x4f442e
+    // Turnaround 1. Lane 1. Track 1. Reversed 0. Direction 3
+    static constexpr PackedMoveInfo moveInfoTA1L1T1R0D3[] = {
+        0x06205F48, 0x06205E48, 0x05E05D48, 0x05A05C49, 0x05605B49, 0x05205A4A, 0x04E0594B, 0x04A0594C,
+        0x0460584D, 0x0420584E, 0x0420584F, 0x04205850, 0x04205851, 0x04205852, 0x04205853, 0x04205854,
+        0x04205855, 0x04205856, 0x04205857, 0x04205858, 0x04205859, 0x0420585A, 0x0420585B, 0x0420585C,
+        0x0420585D, 0x0420585E, 0x0420585F,
+    };
+
+    // 0x4f40ae
+    // Turnaround 1. Lane 1. Track 1. Reversed 1. Direction 0
+    static constexpr PackedMoveInfo moveInfoTA1L1T1R1D0[] = {
+        0x02204058, 0x02204158, 0x02204258, 0x02204358, 0x02204458, 0x02204558, 0x02204658, 0x02204758,
+        0x02204858, 0x02204958, 0x02204A58, 0x02204B58, 0x02204C58, 0x02204D58, 0x02204E58, 0x02204F58,
+        0x02205058, 0x02205158, 0x02205258, 0x02605358, 0x02A05459, 0x02E05559, 0x0320565A, 0x0360575B,
+        0x03A0575C, 0x03E0585D, 0x0420585E, 0x0420585F,
+    };
+
+    // 0x4f4190
+    // Turnaround 1. Lane 1. Track 1. Reversed 1. Direction 1
+    static constexpr PackedMoveInfo moveInfoTA1L1T1R1D1[] = {
+        0x04204840, 0x04204841, 0x04204842, 0x04204843, 0x04204844, 0x04204845, 0x04204846, 0x04204847,
+        0x04204848, 0x04204849, 0x0420484A, 0x0420484B, 0x0420484C, 0x0420484D, 0x0420484E, 0x0420484F,
+        0x04204850, 0x04204851, 0x04604852, 0x04A04753, 0x04E04754, 0x05204655, 0x05204556, 0x05604457,
+        0x05A04357, 0x05E04258, 0x06204158, 0x06204058,
+    };
+
+    // 0x4f4272
+    // Turnaround 1. Lane 1. Track 1. Reversed 1. Direction 2
+    static constexpr PackedMoveInfo moveInfoTA1L1T1R1D2[] = {
+        0x06205F48, 0x06205E48, 0x06205D48, 0x06205C48, 0x06205B48, 0x06205A48, 0x06205948, 0x06205848,
+        0x06205748, 0x06205648, 0x06205548, 0x06205448, 0x06205348, 0x06205248, 0x06205148, 0x06205048,
+        0x06204F48, 0x06204E48, 0x06604D48, 0x06A04C47, 0x06E04B47, 0x07204A46, 0x07604945, 0x07A04944,
+        0x07E04843, 0x00204842, 0x00204841, 0x00204840,
+    };
+
+    // 0x4f4354
+    // Turnaround 1. Lane 1. Track 1. Reversed 1. Direction 3
+    static constexpr PackedMoveInfo moveInfoTA1L1T1R1D3[] = {
+        0x0020585F, 0x0020585E, 0x0020585D, 0x0020585C, 0x0020585B, 0x0020585A, 0x00205859, 0x00205858,
+        0x00205857, 0x00205856, 0x00205855, 0x00205854, 0x00205853, 0x00205852, 0x00205851, 0x00205850,
+        0x0020584F, 0x0020584E, 0x0060584D, 0x00A0594C, 0x00E0594B, 0x01205A4A, 0x01605B49, 0x01A05C49,
+        0x01E05D48, 0x02205E48, 0x02205F48,
+    };
+
+    // 0x4f65d0
+    // Turnaround 1. Lane 1. Track 3. Reversed 0. Direction 0
+    static constexpr PackedMoveInfo moveInfoTA1L1T3R0D0[] = {
+        0x0020585F, 0x0020585E, 0x0020585D, 0x07E0585C, 0x07E0585B, 0x07E0585A, 0x07E05759, 0x07E05758,
+        0x07E05757, 0x07E05756, 0x07E05655, 0x07A05654, 0x07A05653, 0x07A05652, 0x07A05551, 0x07A05550,
+        0x07A0554F, 0x07A0544E, 0x0760544D, 0x0760534C, 0x0760524B, 0x0760524A, 0x07605149, 0x07605048,
+        0x07204F47, 0x07204E46, 0x07204E45, 0x07204D44, 0x07204D43, 0x07204C42, 0x07204B42, 0x06E04A41,
+        0x06E04940, 0x06E0483F, 0x06E0473E, 0x06E0463E, 0x06E0453D, 0x06E0443C, 0x06A0433C, 0x06A0423B,
+        0x06A0413B, 0x06A0403B, 0x06A03F3A, 0x06A03E3A, 0x06A03D3A, 0x06A03C3A, 0x06603B39, 0x06603A39,
+        0x06603939, 0x06603839, 0x06603738, 0x06603638, 0x06603538, 0x06203438, 0x06203338, 0x06203238,
+        0x06203138, 0x06203038, 0x06202F38, 0x06202E38, 0x06202D38, 0x06202C38, 0x06202B38, 0x06202A38,
+        0x06202938, 0x06202838, 0x06202738, 0x06202638, 0x06202538, 0x06202438, 0x06202338, 0x06202238,
+        0x06202138, 0x06202038,
+    };
+
+    // 0x4f6822
+    // Turnaround 1. Lane 1. Track 3. Reversed 0. Direction 1
+    static constexpr PackedMoveInfo moveInfoTA1L1T3R0D1[] = {
+        0x02204058, 0x02204158, 0x02204258, 0x02204358, 0x01E04458, 0x01E04558, 0x01E04658, 0x01E04757,
+        0x01E04857, 0x01E04957, 0x01E04A57, 0x01E04B56, 0x01A04C56, 0x01A04D56, 0x01A04E56, 0x01A04F55,
+        0x01A05055, 0x01A05155, 0x01A05254, 0x01605354, 0x01605453, 0x01605552, 0x01605652, 0x01605751,
+        0x01605850, 0x0120594F, 0x01205A4E, 0x01205B4E, 0x01205C4D, 0x01205D4D, 0x01205E4C, 0x01205E4B,
+        0x00E05F4A, 0x00E06049, 0x00E06148, 0x00E06247, 0x00E06246, 0x00E06345, 0x00E06444, 0x00A06443,
+        0x00A06542, 0x00A06541, 0x00A06540, 0x00A0663F, 0x00A0663E, 0x00A0663D, 0x00A0663C, 0x0060673B,
+        0x0060673A, 0x00606739, 0x00606738, 0x00606837, 0x00606836, 0x00606835, 0x00206834, 0x00206833,
+        0x00206832, 0x00206831, 0x00206830, 0x0020682F, 0x0020682E, 0x0020682D, 0x0020682C, 0x0020682B,
+        0x0020682A, 0x00206829, 0x00206828, 0x00206827, 0x00206826, 0x00206825, 0x00206824, 0x00206823,
+        0x00206822, 0x00206821, 0x00206820,
+    };
+
+    // 0x4f6a7c
+    // Turnaround 1. Lane 1. Track 3. Reversed 0. Direction 2
+    static constexpr PackedMoveInfo moveInfoTA1L1T3R0D2[] = {
+        0x04204840, 0x04204841, 0x04204842, 0x04204843, 0x03E04844, 0x03E04845, 0x03E04846, 0x03E04947,
+        0x03E04948, 0x03E04949, 0x03E0494A, 0x03E04A4B, 0x03A04A4C, 0x03A04A4D, 0x03A04A4E, 0x03A04B4F,
+        0x03A04B50, 0x03A04B51, 0x03A04C52, 0x03604C53, 0x03604D54, 0x03604E55, 0x03604E56, 0x03604F57,
+        0x03605058, 0x03205159, 0x0320525A, 0x0320525B, 0x0320535C, 0x0320535D, 0x0320545E, 0x0320555E,
+        0x02E0565F, 0x02E05760, 0x02E05861, 0x02E05962, 0x02E05A62, 0x02E05B63, 0x02E05C64, 0x02A05D64,
+        0x02A05E65, 0x02A05F65, 0x02A06065, 0x02A06166, 0x02A06266, 0x02A06366, 0x02A06466, 0x02606567,
+        0x02606667, 0x02606767, 0x02606867, 0x02606968, 0x02606A68, 0x02606B68, 0x02206C68, 0x02206D68,
+        0x02206E68, 0x02206F68, 0x02207068, 0x02207168, 0x02207268, 0x02207368, 0x02207468, 0x02207568,
+        0x02207668, 0x02207768, 0x02207868, 0x02207968, 0x02207A68, 0x02207B68, 0x02207C68, 0x02207D68,
+        0x02207E68, 0x02207F68,
+    };
+
+    // 0x4f6386
+    // Turnaround 1. Lane 1. Track 3. Reversed 0. Direction 3
+    static constexpr PackedMoveInfo moveInfoTA1L1T3R0D3[] = {
+        0x06205F48, 0x06205E48, 0x06205D48, 0x05E05C48, 0x05E05B48, 0x05E05A48, 0x05E05949, 0x05E05849,
+        0x05E05749, 0x05E05649, 0x05E0554A, 0x05A0544A, 0x05A0534A, 0x05A0524A, 0x05A0514B, 0x05A0504B,
+        0x05A04F4B, 0x05A04E4C, 0x05604D4C, 0x05604C4D, 0x05604B4E, 0x05604A4E, 0x0560494F, 0x05604850,
+        0x05204751, 0x05204652, 0x05204552, 0x05204453, 0x05204353, 0x05204254, 0x05204255, 0x04E04156,
+        0x04E04057, 0x04E03F58, 0x04E03E59, 0x04E03E5A, 0x04E03D5B, 0x04E03C5C, 0x04A03C5D, 0x04A03B5E,
+        0x04A03B5F, 0x04A03B60, 0x04A03A61, 0x04A03A62, 0x04A03A63, 0x04A03A64, 0x04603965, 0x04603966,
+        0x04603967, 0x04603968, 0x04603869, 0x0460386A, 0x0460386B, 0x0420386C, 0x0420386D, 0x0420386E,
+        0x0420386F, 0x04203870, 0x04203871, 0x04203872, 0x04203873, 0x04203874, 0x04203875, 0x04203876,
+        0x04203877, 0x04203878, 0x04203879, 0x0420387A, 0x0420387B, 0x0420387C, 0x0420387D, 0x0420387E,
+        0x0420387F,
+    };
+
+    // 0x4f5a3e
+    // Turnaround 1. Lane 1. Track 3. Reversed 1. Direction 0
+    static constexpr PackedMoveInfo moveInfoTA1L1T3R1D0[] = {
+        0x02204058, 0x02204158, 0x02204258, 0x02204358, 0x02204458, 0x02204558, 0x02204658, 0x02204758,
+        0x02204858, 0x02204958, 0x02204A58, 0x02204B58, 0x02204C58, 0x02204D58, 0x02204E58, 0x02204F58,
+        0x02205058, 0x02205158, 0x02205258, 0x02205358, 0x02605458, 0x02605558, 0x02605658, 0x02605759,
+        0x02605859, 0x02605959, 0x02605A59, 0x02605B5A, 0x02A05C5A, 0x02A05D5A, 0x02A05E5A, 0x02A05F5B,
+        0x02A0605B, 0x02A0615B, 0x02A0625C, 0x02E0635C, 0x02E0645D, 0x02E0655E, 0x02E0665E, 0x02E0675F,
+        0x02E06860, 0x03206961, 0x03206A62, 0x03206B62, 0x03206C63, 0x03206D63, 0x03206E64, 0x03206E65,
+        0x03606F66, 0x03607067, 0x03607168, 0x03607269, 0x0360726A, 0x0360736B, 0x0360746C, 0x03A0746D,
+        0x03A0756E, 0x03A0756F, 0x03A07570, 0x03A07671, 0x03A07672, 0x03A07673, 0x03A07674, 0x03E07775,
+        0x03E07776, 0x03E07777, 0x03E07778, 0x03E07879, 0x03E0787A, 0x03E0787B, 0x0420787C, 0x0420787D,
+        0x0420787E, 0x0420787F,
+    };
+
+    // 0x4f5c90
+    // Turnaround 1. Lane 1. Track 3. Reversed 1. Direction 1
+    static constexpr PackedMoveInfo moveInfoTA1L1T3R1D1[] = {
+        0x04204840, 0x04204841, 0x04204842, 0x04204843, 0x04204844, 0x04204845, 0x04204846, 0x04204847,
+        0x04204848, 0x04204849, 0x0420484A, 0x0420484B, 0x0420484C, 0x0420484D, 0x0420484E, 0x0420484F,
+        0x04204850, 0x04204851, 0x04204852, 0x04204853, 0x04604854, 0x04604855, 0x04604856, 0x04604757,
+        0x04604758, 0x04604759, 0x0460475A, 0x0460465B, 0x04A0465C, 0x04A0465D, 0x04A0465E, 0x04A0455F,
+        0x04A04560, 0x04A04561, 0x04A04462, 0x04E04463, 0x04E04364, 0x04E04265, 0x04E04266, 0x04E04167,
+        0x04E04068, 0x05203F69, 0x05203E6A, 0x05203E6B, 0x05203D6C, 0x05203D6D, 0x05203C6E, 0x05203B6E,
+        0x05603A6F, 0x05603970, 0x05603871, 0x05603772, 0x05603672, 0x05603573, 0x05603474, 0x05A03374,
+        0x05A03275, 0x05A03175, 0x05A03075, 0x05A02F76, 0x05A02E76, 0x05A02D76, 0x05A02C76, 0x05E02B77,
+        0x05E02A77, 0x05E02977, 0x05E02877, 0x05E02778, 0x05E02678, 0x05E02578, 0x06202478, 0x06202378,
+        0x06202278, 0x06202178, 0x06202078,
+    };
+
+    // 0x4f5eea
+    // Turnaround 1. Lane 1. Track 3. Reversed 1. Direction 2
+    static constexpr PackedMoveInfo moveInfoTA1L1T3R1D2[] = {
+        0x06205F48, 0x06205E48, 0x06205D48, 0x06205C48, 0x06205B48, 0x06205A48, 0x06205948, 0x06205848,
+        0x06205748, 0x06205648, 0x06205548, 0x06205448, 0x06205348, 0x06205248, 0x06205148, 0x06205048,
+        0x06204F48, 0x06204E48, 0x06204D48, 0x06604C48, 0x06604B48, 0x06604A48, 0x06604947, 0x06604847,
+        0x06604747, 0x06604647, 0x06604546, 0x06A04446, 0x06A04346, 0x06A04246, 0x06A04145, 0x06A04045,
+        0x06A03F45, 0x06A03E44, 0x06E03D44, 0x06E03C43, 0x06E03B42, 0x06E03A42, 0x06E03941, 0x06E03840,
+        0x0720373F, 0x0720363E, 0x0720353E, 0x0720343D, 0x0720333D, 0x0720323C, 0x0720323B, 0x0760313A,
+        0x07603039, 0x07602F38, 0x07602E37, 0x07602E36, 0x07602D35, 0x07602C34, 0x07A02C33, 0x07A02B32,
+        0x07A02B31, 0x07A02B30, 0x07A02A2F, 0x07A02A2E, 0x07A02A2D, 0x07A02A2C, 0x07E0292B, 0x07E0292A,
+        0x07E02929, 0x07E02928, 0x07E02827, 0x07E02826, 0x07E02825, 0x00202824, 0x00202823, 0x00202822,
+        0x00202821, 0x00202820,
+    };
+
+    // 0x4f613c
+    // Turnaround 1. Lane 1. Track 3. Reversed 1. Direction 3
+    static constexpr PackedMoveInfo moveInfoTA1L1T3R1D3[] = {
+        0x0020585F, 0x0020585E, 0x0020585D, 0x0020585C, 0x0020585B, 0x0020585A, 0x00205859, 0x00205858,
+        0x00205857, 0x00205856, 0x00205855, 0x00205854, 0x00205853, 0x00205852, 0x00205851, 0x00205850,
+        0x0020584F, 0x0020584E, 0x0020584D, 0x0060584C, 0x0060584B, 0x0060584A, 0x00605949, 0x00605948,
+        0x00605947, 0x00605946, 0x00605A45, 0x00A05A44, 0x00A05A43, 0x00A05A42, 0x00A05B41, 0x00A05B40,
+        0x00A05B3F, 0x00A05C3E, 0x00E05C3D, 0x00E05D3C, 0x00E05E3B, 0x00E05E3A, 0x00E05F39, 0x00E06038,
+        0x01206137, 0x01206236, 0x01206235, 0x01206334, 0x01206333, 0x01206432, 0x01206532, 0x01606631,
+        0x01606730, 0x0160682F, 0x0160692E, 0x01606A2E, 0x01606B2D, 0x01606C2C, 0x01A06D2C, 0x01A06E2B,
+        0x01A06F2B, 0x01A0702B, 0x01A0712A, 0x01A0722A, 0x01A0732A, 0x01A0742A, 0x01E07529, 0x01E07629,
+        0x01E07729, 0x01E07829, 0x01E07928, 0x01E07A28, 0x01E07B28, 0x02207C28, 0x02207D28, 0x02207E28,
+        0x02207F28,
+    };
+
+    // 0x4f116e
+    // Turnaround 1. Lane 1. Track 5. Reversed 0. Direction 0
+    static constexpr PackedMoveInfo moveInfoTA1L1T5R0D0[] = {
+        0x1020585F, 0x1020585E, 0x1020585D, 0x1020585C, 0x1021575B, 0x1021575A, 0x10215759, 0x10215758,
+        0x10225657, 0x10225656, 0x10225655, 0x10225654, 0x10235553, 0x10235552, 0x10235551, 0x10235550,
+        0x1024544F, 0x1024544E, 0x1024544D, 0x1024544C, 0x1025534B, 0x1025534A, 0x10255349, 0x10255348,
+        0x10265247, 0x10265246, 0x10265245, 0x10265244, 0x10275143, 0x10275142, 0x10275141, 0x10275140,
+        0x1028503F, 0x1028503E, 0x1028503D, 0x1028503C, 0x10294F3B, 0x10294F3A, 0x10294F39, 0x10294F38,
+        0x102A4E37, 0x102A4E36, 0x102A4E35, 0x102A4E34, 0x102B4D33, 0x102B4D32, 0x102B4D31, 0x102B4D30,
+        0x102C4C2F, 0x102C4C2E, 0x102C4C2D, 0x102C4C2C, 0x102D4B2B, 0x102D4B2A, 0x102D4B29, 0x102D4B28,
+        0x102E4A27, 0x102E4A26, 0x102E4A25, 0x102E4A24, 0x102F4923, 0x102F4922, 0x102F4921, 0x102F4920,
+    };
+
+    // 0x4f1370
+    // Turnaround 1. Lane 1. Track 5. Reversed 0. Direction 1
+    static constexpr PackedMoveInfo moveInfoTA1L1T5R0D1[] = {
+        0x12204058, 0x12204158, 0x12204258, 0x12204358, 0x12214457, 0x12214557, 0x12214657, 0x12214757,
+        0x12224856, 0x12224956, 0x12224A56, 0x12224B56, 0x12234C55, 0x12234D55, 0x12234E55, 0x12234F55,
+        0x12245054, 0x12245154, 0x12245254, 0x12245354, 0x12255453, 0x12255553, 0x12255653, 0x12255753,
+        0x12265852, 0x12265952, 0x12265A52, 0x12265B52, 0x12275C51, 0x12275D51, 0x12275E51, 0x12275F51,
+        0x12286050, 0x12286150, 0x12286250, 0x12286350, 0x1229644F, 0x1229654F, 0x1229664F, 0x1229674F,
+        0x122A684E, 0x122A694E, 0x122A6A4E, 0x122A6B4E, 0x122B6C4D, 0x122B6D4D, 0x122B6E4D, 0x122B6F4D,
+        0x122C704C, 0x122C714C, 0x122C724C, 0x122C734C, 0x122D744B, 0x122D754B, 0x122D764B, 0x122D774B,
+        0x122E784A, 0x122E794A, 0x122E7A4A, 0x122E7B4A, 0x122F7C49, 0x122F7D49, 0x122F7E49, 0x122F7F49,
+    };
+
+    // 0x4f1572
+    // Turnaround 1. Lane 1. Track 5. Reversed 0. Direction 2
+    static constexpr PackedMoveInfo moveInfoTA1L1T5R0D2[] = {
+        0x14204840, 0x14204841, 0x14204842, 0x14204843, 0x14214944, 0x14214945, 0x14214946, 0x14214947,
+        0x14224A48, 0x14224A49, 0x14224A4A, 0x14224A4B, 0x14234B4C, 0x14234B4D, 0x14234B4E, 0x14234B4F,
+        0x14244C50, 0x14244C51, 0x14244C52, 0x14244C53, 0x14254D54, 0x14254D55, 0x14254D56, 0x14254D57,
+        0x14264E58, 0x14264E59, 0x14264E5A, 0x14264E5B, 0x14274F5C, 0x14274F5D, 0x14274F5E, 0x14274F5F,
+        0x14285060, 0x14285061, 0x14285062, 0x14285063, 0x14295164, 0x14295165, 0x14295166, 0x14295167,
+        0x142A5268, 0x142A5269, 0x142A526A, 0x142A526B, 0x142B536C, 0x142B536D, 0x142B536E, 0x142B536F,
+        0x142C5470, 0x142C5471, 0x142C5472, 0x142C5473, 0x142D5574, 0x142D5575, 0x142D5576, 0x142D5577,
+        0x142E5678, 0x142E5679, 0x142E567A, 0x142E567B, 0x142F577C, 0x142F577D, 0x142F577E, 0x142F577F,
+    };
+
+    // 0x4f1774
+    // Turnaround 1. Lane 1. Track 5. Reversed 0. Direction 3
+    static constexpr PackedMoveInfo moveInfoTA1L1T5R0D3[] = {
+        0x16205F48, 0x16205E48, 0x16205D48, 0x16205C48, 0x16215B49, 0x16215A49, 0x16215949, 0x16215849,
+        0x1622574A, 0x1622564A, 0x1622554A, 0x1622544A, 0x1623534B, 0x1623524B, 0x1623514B, 0x1623504B,
+        0x16244F4C, 0x16244E4C, 0x16244D4C, 0x16244C4C, 0x16254B4D, 0x16254A4D, 0x1625494D, 0x1625484D,
+        0x1626474E, 0x1626464E, 0x1626454E, 0x1626444E, 0x1627434F, 0x1627424F, 0x1627414F, 0x1627404F,
+        0x16283F50, 0x16283E50, 0x16283D50, 0x16283C50, 0x16293B51, 0x16293A51, 0x16293951, 0x16293851,
+        0x162A3752, 0x162A3652, 0x162A3552, 0x162A3452, 0x162B3353, 0x162B3253, 0x162B3153, 0x162B3053,
+        0x162C2F54, 0x162C2E54, 0x162C2D54, 0x162C2C54, 0x162D2B55, 0x162D2A55, 0x162D2955, 0x162D2855,
+        0x162E2756, 0x162E2656, 0x162E2556, 0x162E2456, 0x162F2357, 0x162F2257, 0x162F2157, 0x162F2057,
+    };
+
+    // 0x4f1d7a
+    // Turnaround 1. Lane 1. Track 5. Reversed 1. Direction 0
+    static constexpr PackedMoveInfo moveInfoTA1L1T5R1D0[] = {
+        0x34204840, 0x34204841, 0x34204842, 0x34204843, 0x341F4944, 0x341F4945, 0x341F4946, 0x341F4947,
+        0x341E4A48, 0x341E4A49, 0x341E4A4A, 0x341E4A4B, 0x341D4B4C, 0x341D4B4D, 0x341D4B4E, 0x341D4B4F,
+        0x341C4C50, 0x341C4C51, 0x341C4C52, 0x341C4C53, 0x341B4D54, 0x341B4D55, 0x341B4D56, 0x341B4D57,
+        0x341A4E58, 0x341A4E59, 0x341A4E5A, 0x341A4E5B, 0x34194F5C, 0x34194F5D, 0x34194F5E, 0x34194F5F,
+        0x34185060, 0x34185061, 0x34185062, 0x34185063, 0x34175164, 0x34175165, 0x34175166, 0x34175167,
+        0x34165268, 0x34165269, 0x3416526A, 0x3416526B, 0x3415536C, 0x3415536D, 0x3415536E, 0x3415536F,
+        0x34145470, 0x34145471, 0x34145472, 0x34145473, 0x34135574, 0x34135575, 0x34135576, 0x34135577,
+        0x34125678, 0x34125679, 0x3412567A, 0x3412567B, 0x3411577C, 0x3411577D, 0x3411577E, 0x3411577F,
+    };
+
+    // 0x4f1f7c
+    // Turnaround 1. Lane 1. Track 5. Reversed 1. Direction 1
+    static constexpr PackedMoveInfo moveInfoTA1L1T5R1D1[] = {
+        0x36205F48, 0x36205E48, 0x36205D48, 0x36205C48, 0x361F5B49, 0x361F5A49, 0x361F5949, 0x361F5849,
+        0x361E574A, 0x361E564A, 0x361E554A, 0x361E544A, 0x361D534B, 0x361D524B, 0x361D514B, 0x361D504B,
+        0x361C4F4C, 0x361C4E4C, 0x361C4D4C, 0x361C4C4C, 0x361B4B4D, 0x361B4A4D, 0x361B494D, 0x361B484D,
+        0x361A474E, 0x361A464E, 0x361A454E, 0x361A444E, 0x3619434F, 0x3619424F, 0x3619414F, 0x3619404F,
+        0x36183F50, 0x36183E50, 0x36183D50, 0x36183C50, 0x36173B51, 0x36173A51, 0x36173951, 0x36173851,
+        0x36163752, 0x36163652, 0x36163552, 0x36163452, 0x36153353, 0x36153253, 0x36153153, 0x36153053,
+        0x36142F54, 0x36142E54, 0x36142D54, 0x36142C54, 0x36132B55, 0x36132A55, 0x36132955, 0x36132855,
+        0x36122756, 0x36122656, 0x36122556, 0x36122456, 0x36112357, 0x36112257, 0x36112157, 0x36112057,
+    };
+
+    // 0x4f1976
+    // Turnaround 1. Lane 1. Track 5. Reversed 1. Direction 2
+    static constexpr PackedMoveInfo moveInfoTA1L1T5R1D2[] = {
+        0x3020585F, 0x3020585E, 0x3020585D, 0x3020585C, 0x301F575B, 0x301F575A, 0x301F5759, 0x301F5758,
+        0x301E5657, 0x301E5656, 0x301E5655, 0x301E5654, 0x301D5553, 0x301D5552, 0x301D5551, 0x301D5550,
+        0x301C544F, 0x301C544E, 0x301C544D, 0x301C544C, 0x301B534B, 0x301B534A, 0x301B5349, 0x301B5348,
+        0x301A5247, 0x301A5246, 0x301A5245, 0x301A5244, 0x30195143, 0x30195142, 0x30195141, 0x30195140,
+        0x3018503F, 0x3018503E, 0x3018503D, 0x3018503C, 0x30174F3B, 0x30174F3A, 0x30174F39, 0x30174F38,
+        0x30164E37, 0x30164E36, 0x30164E35, 0x30164E34, 0x30154D33, 0x30154D32, 0x30154D31, 0x30154D30,
+        0x30144C2F, 0x30144C2E, 0x30144C2D, 0x30144C2C, 0x30134B2B, 0x30134B2A, 0x30134B29, 0x30134B28,
+        0x30124A27, 0x30124A26, 0x30124A25, 0x30124A24, 0x30114923, 0x30114922, 0x30114921, 0x30114920,
+    };
+
+    // 0x4f1b78
+    // Turnaround 1. Lane 1. Track 5. Reversed 1. Direction 3
+    static constexpr PackedMoveInfo moveInfoTA1L1T5R1D3[] = {
+        0x32204058, 0x32204158, 0x32204258, 0x32204358, 0x321F4457, 0x321F4557, 0x321F4657, 0x321F4757,
+        0x321E4856, 0x321E4956, 0x321E4A56, 0x321E4B56, 0x321D4C55, 0x321D4D55, 0x321D4E55, 0x321D4F55,
+        0x321C5054, 0x321C5154, 0x321C5254, 0x321C5354, 0x321B5453, 0x321B5553, 0x321B5653, 0x321B5753,
+        0x321A5852, 0x321A5952, 0x321A5A52, 0x321A5B52, 0x32195C51, 0x32195D51, 0x32195E51, 0x32195F51,
+        0x32186050, 0x32186150, 0x32186250, 0x32186350, 0x3217644F, 0x3217654F, 0x3217664F, 0x3217674F,
+        0x3216684E, 0x3216694E, 0x32166A4E, 0x32166B4E, 0x32156C4D, 0x32156D4D, 0x32156E4D, 0x32156F4D,
+        0x3214704C, 0x3214714C, 0x3214724C, 0x3214734C, 0x3213744B, 0x3213754B, 0x3213764B, 0x3213774B,
+        0x3212784A, 0x3212794A, 0x32127A4A, 0x32127B4A, 0x32117C49, 0x32117D49, 0x32117E49, 0x32117F49,
+    };
+
+    // 0x4f319e
+    // Turnaround 1. Lane 1. Track 7. Reversed 0. Direction 0
+    static constexpr PackedMoveInfo moveInfoTA1L1T7R0D0[] = {
+        0x2020585F, 0x2020585E, 0x2021575D, 0x2021575C, 0x2022565B, 0x2022565A, 0x20235559, 0x20235558,
+        0x20245457, 0x20245456, 0x20255355, 0x20255354, 0x20265253, 0x20265252, 0x20275151, 0x20275150,
+        0x2028504F, 0x2028504E, 0x20294F4D, 0x20294F4C, 0x202A4E4B, 0x202A4E4A, 0x202B4D49, 0x202B4D48,
+        0x202C4C47, 0x202C4C46, 0x202D4B45, 0x202D4B44, 0x202E4A43, 0x202E4A42, 0x202F4941, 0x202F4940,
+    };
+
+    // 0x4f32a0
+    // Turnaround 1. Lane 1. Track 7. Reversed 0. Direction 1
+    static constexpr PackedMoveInfo moveInfoTA1L1T7R0D1[] = {
+        0x22204058, 0x22204158, 0x22214257, 0x22214357, 0x22224456, 0x22224556, 0x22234655, 0x22234755,
+        0x22244854, 0x22244954, 0x22254A53, 0x22254B53, 0x22264C52, 0x22264D52, 0x22274E51, 0x22274F51,
+        0x22285050, 0x22285150, 0x2229524F, 0x2229534F, 0x222A544E, 0x222A554E, 0x222B564D, 0x222B574D,
+        0x222C584C, 0x222C594C, 0x222D5A4B, 0x222D5B4B, 0x222E5C4A, 0x222E5D4A, 0x222F5E49, 0x222F5F49,
+    };
+
+    // 0x4f33a2
+    // Turnaround 1. Lane 1. Track 7. Reversed 0. Direction 2
+    static constexpr PackedMoveInfo moveInfoTA1L1T7R0D2[] = {
+        0x24204840, 0x24204841, 0x24214942, 0x24214943, 0x24224A44, 0x24224A45, 0x24234B46, 0x24234B47,
+        0x24244C48, 0x24244C49, 0x24254D4A, 0x24254D4B, 0x24264E4C, 0x24264E4D, 0x24274F4E, 0x24274F4F,
+        0x24285050, 0x24285051, 0x24295152, 0x24295153, 0x242A5254, 0x242A5255, 0x242B5356, 0x242B5357,
+        0x242C5458, 0x242C5459, 0x242D555A, 0x242D555B, 0x242E565C, 0x242E565D, 0x242F575E, 0x242F575F,
+    };
+
+    // 0x4f34a4
+    // Turnaround 1. Lane 1. Track 7. Reversed 0. Direction 3
+    static constexpr PackedMoveInfo moveInfoTA1L1T7R0D3[] = {
+        0x26205F48, 0x26205E48, 0x26215D49, 0x26215C49, 0x26225B4A, 0x26225A4A, 0x2623594B, 0x2623584B,
+        0x2624574C, 0x2624564C, 0x2625554D, 0x2625544D, 0x2626534E, 0x2626524E, 0x2627514F, 0x2627504F,
+        0x26284F50, 0x26284E50, 0x26294D51, 0x26294C51, 0x262A4B52, 0x262A4A52, 0x262B4953, 0x262B4853,
+        0x262C4754, 0x262C4654, 0x262D4555, 0x262D4455, 0x262E4356, 0x262E4256, 0x262F4157, 0x262F4057,
+    };
+
+    // 0x4f37aa
+    // Turnaround 1. Lane 1. Track 7. Reversed 1. Direction 0
+    static constexpr PackedMoveInfo moveInfoTA1L1T7R1D0[] = {
+        0x44204840, 0x44204841, 0x441F4942, 0x441F4943, 0x441E4A44, 0x441E4A45, 0x441D4B46, 0x441D4B47,
+        0x441C4C48, 0x441C4C49, 0x441B4D4A, 0x441B4D4B, 0x441A4E4C, 0x441A4E4D, 0x44194F4E, 0x44194F4F,
+        0x44185050, 0x44185051, 0x44175152, 0x44175153, 0x44165254, 0x44165255, 0x44155356, 0x44155357,
+        0x44145458, 0x44145459, 0x4413555A, 0x4413555B, 0x4412565C, 0x4412565D, 0x4411575E, 0x4411575F,
+    };
+
+    // 0x4f38ac
+    // Turnaround 1. Lane 1. Track 7. Reversed 1. Direction 1
+    static constexpr PackedMoveInfo moveInfoTA1L1T7R1D1[] = {
+        0x46205F48, 0x46205E48, 0x461F5D49, 0x461F5C49, 0x461E5B4A, 0x461E5A4A, 0x461D594B, 0x461D584B,
+        0x461C574C, 0x461C564C, 0x461B554D, 0x461B544D, 0x461A534E, 0x461A524E, 0x4619514F, 0x4619504F,
+        0x46184F50, 0x46184E50, 0x46174D51, 0x46174C51, 0x46164B52, 0x46164A52, 0x46154953, 0x46154853,
+        0x46144754, 0x46144654, 0x46134555, 0x46134455, 0x46124356, 0x46124256, 0x46114157, 0x46114057,
+    };
+
+    // 0x4f35a6
+    // Turnaround 1. Lane 1. Track 7. Reversed 1. Direction 2
+    static constexpr PackedMoveInfo moveInfoTA1L1T7R1D2[] = {
+        0x4020585F, 0x4020585E, 0x401F575D, 0x401F575C, 0x401E565B, 0x401E565A, 0x401D5559, 0x401D5558,
+        0x401C5457, 0x401C5456, 0x401B5355, 0x401B5354, 0x401A5253, 0x401A5252, 0x40195151, 0x40195150,
+        0x4018504F, 0x4018504E, 0x40174F4D, 0x40174F4C, 0x40164E4B, 0x40164E4A, 0x40154D49, 0x40154D48,
+        0x40144C47, 0x40144C46, 0x40134B45, 0x40134B44, 0x40124A43, 0x40124A42, 0x40114941, 0x40114940,
+    };
+
+    // 0x4f36a8
+    // Turnaround 1. Lane 1. Track 7. Reversed 1. Direction 3
+    static constexpr PackedMoveInfo moveInfoTA1L1T7R1D3[] = {
+        0x42204058, 0x42204158, 0x421F4257, 0x421F4357, 0x421E4456, 0x421E4556, 0x421D4655, 0x421D4755,
+        0x421C4854, 0x421C4954, 0x421B4A53, 0x421B4B53, 0x421A4C52, 0x421A4D52, 0x42194E51, 0x42194F51,
+        0x42185050, 0x42185150, 0x4217524F, 0x4217534F, 0x4216544E, 0x4216554E, 0x4215564D, 0x4215574D,
+        0x4214584C, 0x4214594C, 0x42135A4B, 0x42135B4B, 0x42125C4A, 0x42125D4A, 0x42115E49, 0x42115F49,
+    };
+}
+// clang-format on
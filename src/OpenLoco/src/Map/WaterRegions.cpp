@@ -0,0 +1,154 @@
+#include "Map/WaterRegions.h"
+#include "Map/SurfaceElement.h"
+#include "Map/TileManager.h"
+#include <array>
+#include <limits>
+#include <vector>
+
+namespace OpenLoco::World::WaterRegions
+{
+    static constexpr std::array<TilePos2, 4> kNeighbourOffsets = {
+        TilePos2(1, 0),
+        TilePos2(-1, 0),
+        TilePos2(0, 1),
+        TilePos2(0, -1),
+    };
+
+    static std::vector<RegionId> _regions;
+    static std::vector<TilePos2> _dirtyTiles;
+    static std::vector<TilePos2> _floodStack;
+    static RegionId _nextRegion = kNullRegion + 1;
+    static bool _isValid = false;
+
+    void reset()
+    {
+        _isValid = false;
+        _dirtyTiles.clear();
+    }
+
+    void invalidateTile(const TilePos2& pos)
+    {
+        if (!_isValid)
+        {
+            return;
+        }
+
+        // Large edits are cheaper to handle with a full rebuild
+        if (_dirtyTiles.size() >= kMapSize / 16)
+        {
+            reset();
+            return;
+        }
+        _dirtyTiles.push_back(pos);
+    }
+
+    static size_t getIndex(const TilePos2& pos)
+    {
+        return (static_cast<size_t>(pos.y) * kMapColumns) + pos.x;
+    }
+
+    static MicroZ getWaterLevel(const TilePos2& pos)
+    {
+        auto* surface = TileManager::get(pos).surface();
+        return surface != nullptr ? surface->water() : 0;
+    }
+
+    // Labels every tile connected to start with a new region id
+    static void flood(const TilePos2& start)
+    {
+        const auto waterLevel = getWaterLevel(start);
+        if (waterLevel == 0)
+        {
+            _regions[getIndex(start)] = kNullRegion;
+            return;
+        }
+
+        const auto region = _nextRegion++;
+        _regions[getIndex(start)] = region;
+        _floodStack.clear();
+        _floodStack.push_back(start);
+        while (!_floodStack.empty())
+        {
+            const auto pos = _floodStack.back();
+            _floodStack.pop_back();
+            for (const auto& offset : kNeighbourOffsets)
+            {
+                const auto neighbour = pos + offset;
+                if (!validCoords(neighbour))
+                {
+                    continue;
+                }
+                auto& neighbourRegion = _regions[getIndex(neighbour)];
+                if (neighbourRegion == region || getWaterLevel(neighbour) != waterLevel)
+                {
+                    continue;
+                }
+                neighbourRegion = region;
+                _floodStack.push_back(neighbour);
+            }
+        }
+    }
+
+    static void rebuild()
+    {
+        _regions.assign(kMapSize, kNullRegion);
+        _nextRegion = kNullRegion + 1;
+        _dirtyTiles.clear();
+
+        for (tile_coord_t y = 0; y < kMapRows; ++y)
+        {
+            for (tile_coord_t x = 0; x < kMapColumns; ++x)
+            {
+                const auto pos = TilePos2(x, y);
+                if (_regions[getIndex(pos)] == kNullRegion && getWaterLevel(pos) != 0)
+                {
+                    flood(pos);
+                }
+            }
+        }
+        _isValid = true;
+    }
+
+    // A change to a tile can only join or split the regions of the tile and its neighbours, so
+    // those are flooded again with fresh ids. Anything relabelled during this pass has an id of
+    // at least firstRegion and is not flooded twice.
+    static void updateDirtyTiles()
+    {
+        if (_nextRegion > std::numeric_limits<RegionId>::max() - kMapSize)
+        {
+            rebuild();
+            return;
+        }
+
+        const auto firstRegion = _nextRegion;
+        for (const auto& dirtyPos : _dirtyTiles)
+        {
+            for (auto i = 0U; i <= kNeighbourOffsets.size(); ++i)
+            {
+                const auto pos = i == 0 ? dirtyPos : dirtyPos + kNeighbourOffsets[i - 1];
+                if (validCoords(pos) && _regions[getIndex(pos)] < firstRegion)
+                {
+                    flood(pos);
+                }
+            }
+        }
+        _dirtyTiles.clear();
+    }
+
+    RegionId getRegion(const TilePos2& pos)
+    {
+        if (!validCoords(pos))
+        {
+            return kNullRegion;
+        }
+        if (!_isValid)
+        {
+            rebuild();
+        }
+        else if (!_dirtyTiles.empty())
+        {
+            updateDirtyTiles();
+        }
+        return _regions[getIndex(pos)];
+    }
+}
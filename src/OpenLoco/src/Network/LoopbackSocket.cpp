@@ -0,0 +1,333 @@
+#include "Network/Socket.h"
+#include <OpenLoco/Core/Exception.hpp>
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <random>
+#include <unordered_map>
+
+namespace OpenLoco::Network
+{
+    class LoopbackSocket;
+
+    class LoopbackEndpoint final : public INetworkEndpoint
+    {
+    private:
+        uint16_t _port{};
+
+    public:
+        explicit LoopbackEndpoint(uint16_t port)
+            : _port(port)
+        {
+        }
+
+        uint16_t getPort() const
+        {
+            return _port;
+        }
+
+        Protocol getProtocol() const override
+        {
+            return Protocol::ipv4;
+        }
+
+        std::string getIpAddress() const override
+        {
+            return "127.0.0.1";
+        }
+
+        std::string getHostname() const override
+        {
+            return "localhost";
+        }
+
+        std::unique_ptr<INetworkEndpoint> clone() const override
+        {
+            return std::make_unique<LoopbackEndpoint>(*this);
+        }
+
+        bool equals(const INetworkEndpoint& other) const override
+        {
+            auto* other2 = dynamic_cast<const LoopbackEndpoint*>(&other);
+            return other2 != nullptr && other2->_port == _port;
+        }
+    };
+
+    /**
+     * Keeps track of which loopback socket is bound to which port so that datagrams can be routed
+     * directly into the receive queue of the destination socket.
+     */
+    class LoopbackRouter
+    {
+    private:
+        static constexpr uint16_t kFirstEphemeralPort = 49152;
+
+        std::mutex _sync;
+        std::condition_variable _dataAvailable;
+        std::unordered_map<uint16_t, LoopbackSocket*> _sockets;
+        uint16_t _nextEphemeralPort = kFirstEphemeralPort;
+        uint32_t _packetLoss{};
+        std::minstd_rand _packetLossRng;
+
+    public:
+        static LoopbackRouter& get()
+        {
+            static LoopbackRouter router;
+            return router;
+        }
+
+        uint16_t bind(LoopbackSocket& socket, uint16_t port)
+        {
+            std::unique_lock<std::mutex> lk(_sync);
+            if (port == 0)
+            {
+                do
+                {
+                    port = _nextEphemeralPort++;
+                    if (_nextEphemeralPort == 0)
+                    {
+                        _nextEphemeralPort = kFirstEphemeralPort;
+                    }
+                } while (_sockets.contains(port));
+            }
+            else if (_sockets.contains(port))
+            {
+                throw Exception::RuntimeError("Loopback port " + std::to_string(port) + " is already in use.");
+            }
+            _sockets[port] = &socket;
+            return port;
+        }
+
+        void setPacketLoss(uint32_t percent, uint32_t seed)
+        {
+            std::unique_lock<std::mutex> lk(_sync);
+            _packetLoss = percent;
+            _packetLossRng.seed(seed);
+        }
+
+        void unbind(uint16_t port)
+        {
+            std::unique_lock<std::mutex> lk(_sync);
+            _sockets.erase(port);
+        }
+
+        void send(uint16_t sourcePort, uint16_t destinationPort, const void* buffer, size_t size);
+        void wait(std::span<const std::unique_ptr<IUdpSocket>> sockets, uint32_t timeoutMs, bool& woken);
+        void wakeup(bool& woken);
+    };
+
+    class LoopbackSocketPoller final : public ISocketPoller
+    {
+    private:
+        // Guarded by the router's lock
+        bool _woken{};
+
+    public:
+        void wait(std::span<const std::unique_ptr<IUdpSocket>> sockets, uint32_t timeoutMs) override
+        {
+            LoopbackRouter::get().wait(sockets, timeoutMs, _woken);
+        }
+
+        void wakeup() override
+        {
+            LoopbackRouter::get().wakeup(_woken);
+        }
+    };
+
+    class LoopbackSocket final : public IUdpSocket
+    {
+    private:
+        struct Datagram
+        {
+            uint16_t sourcePort{};
+            std::vector<uint8_t> data;
+        };
+
+        SocketStatus _status = SocketStatus::closed;
+        uint16_t _port{};
+        std::mutex _receivedSync;
+        std::deque<Datagram> _received;
+
+        void ensureBound()
+        {
+            if (_port == 0)
+            {
+                _port = LoopbackRouter::get().bind(*this, 0);
+                _status = SocketStatus::connected;
+            }
+        }
+
+    public:
+        ~LoopbackSocket() override
+        {
+            close();
+        }
+
+        SocketStatus getStatus() const override
+        {
+            return _status;
+        }
+
+        const char* getError() const override
+        {
+            return nullptr;
+        }
+
+        const char* getHostName() const override
+        {
+            return nullptr;
+        }
+
+        Protocol getProtocol() const override
+        {
+            return Protocol::ipv4;
+        }
+
+        std::string getIpAddress() const override
+        {
+            return "127.0.0.1";
+        }
+
+        uint16_t getPort() const override
+        {
+            return _port;
+        }
+
+        void listen(Protocol protocol, uint16_t port) override
+        {
+            listen(protocol, "", port);
+        }
+
+        void listen(Protocol, const std::string&, uint16_t port) override
+        {
+            if (_status != SocketStatus::closed)
+            {
+                throw Exception::InvalidArgument("Socket not closed.");
+            }
+            _port = LoopbackRouter::get().bind(*this, port);
+            _status = SocketStatus::listening;
+        }
+
+        size_t sendData(Protocol, const std::string&, uint16_t port, const void* buffer, size_t size) override
+        {
+            return sendData(LoopbackEndpoint(port), buffer, size);
+        }
+
+        size_t sendData(const INetworkEndpoint& destination, const void* buffer, size_t size) override
+        {
+            const auto* dest = dynamic_cast<const LoopbackEndpoint*>(&destination);
+            if (dest == nullptr)
+            {
+                throw Exception::InvalidArgument("destination is not compatible.");
+            }
+
+            ensureBound();
+            LoopbackRouter::get().send(_port, dest->getPort(), buffer, size);
+            return size;
+        }
+
+        NetworkReadPacket receiveData(void* buffer, size_t size, size_t* sizeReceived, std::unique_ptr<INetworkEndpoint>* sender) override
+        {
+            std::unique_lock<std::mutex> lk(_receivedSync);
+            if (_received.empty())
+            {
+                *sizeReceived = 0;
+                return NetworkReadPacket::noData;
+            }
+
+            auto& datagram = _received.front();
+            *sizeReceived = std::min(size, datagram.data.size());
+            std::memcpy(buffer, datagram.data.data(), *sizeReceived);
+            if (sender != nullptr)
+            {
+                *sender = std::make_unique<LoopbackEndpoint>(datagram.sourcePort);
+            }
+            _received.pop_front();
+            return NetworkReadPacket::success;
+        }
+
+        std::unique_ptr<ISocketPoller> createPoller() const override
+        {
+            return std::make_unique<LoopbackSocketPoller>();
+        }
+
+        bool hasData()
+        {
+            std::unique_lock<std::mutex> lk(_receivedSync);
+            return !_received.empty();
+        }
+
+        void close() override
+        {
+            if (_port != 0)
+            {
+                LoopbackRouter::get().unbind(_port);
+                _port = 0;
+            }
+            _status = SocketStatus::closed;
+        }
+
+        void enqueue(uint16_t sourcePort, const void* buffer, size_t size)
+        {
+            const auto* bytes = static_cast<const uint8_t*>(buffer);
+            std::unique_lock<std::mutex> lk(_receivedSync);
+            _received.push_back({ sourcePort, std::vector<uint8_t>(bytes, bytes + size) });
+        }
+    };
+
+    void LoopbackRouter::send(uint16_t sourcePort, uint16_t destinationPort, const void* buffer, size_t size)
+    {
+        std::unique_lock<std::mutex> lk(_sync);
+        if (_packetLoss != 0 && _packetLossRng() % 100 < _packetLoss)
+        {
+            return;
+        }
+
+        auto it = _sockets.find(destinationPort);
+        if (it != _sockets.end())
+        {
+            it->second->enqueue(sourcePort, buffer, size);
+            _dataAvailable.notify_all();
+        }
+    }
+
+    void LoopbackRouter::wait(std::span<const std::unique_ptr<IUdpSocket>> sockets, uint32_t timeoutMs, bool& woken)
+    {
+        std::unique_lock<std::mutex> lk(_sync);
+        _dataAvailable.wait_for(lk, std::chrono::milliseconds(timeoutMs), [&] {
+            return woken || std::any_of(sockets.begin(), sockets.end(), [](const auto& socket) {
+                       auto* loopbackSocket = dynamic_cast<LoopbackSocket*>(socket.get());
+                       return loopbackSocket != nullptr && loopbackSocket->hasData();
+                   });
+        });
+        woken = false;
+    }
+
+    void LoopbackRouter::wakeup(bool& woken)
+    {
+        std::unique_lock<std::mutex> lk(_sync);
+        woken = true;
+        _dataAvailable.notify_all();
+    }
+
+    namespace Socket
+    {
+        std::unique_ptr<IUdpSocket> createLoopbackUdp()
+        {
+            return std::make_unique<LoopbackSocket>();
+        }
+
+        std::unique_ptr<INetworkEndpoint> resolveLoopback(uint16_t port)
+        {
+            return std::make_unique<LoopbackEndpoint>(port);
+        }
+
+        void setLoopbackPacketLoss(uint32_t percent, uint32_t seed)
+        {
+            LoopbackRouter::get().setPacketLoss(percent, seed);
+        }
+    }
+}
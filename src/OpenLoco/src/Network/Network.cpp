@@ -7,8 +7,10 @@
 #include "Network/NetworkClient.h"
 #include "Network/NetworkServer.h"
 #include "Network/Socket.h"
+#include "Network/StateChecksum.h"
 #include "Scenario/ScenarioManager.h"
 #include "SceneManager.h"
+#include <OpenLoco/Platform/Platform.h>
 #include <cassert>
 #include <stdexcept>
 
@@ -27,6 +29,11 @@ namespace OpenLoco::Network
     static std::unique_ptr<NetworkServer> _server;
     static std::unique_ptr<NetworkClient> _client;
 
+    // Kept between sessions so that rejoining a server only needs the state that changed
+    static std::unique_ptr<StateSnapshot> _lastReceivedState;
+
+    static std::function<uint32_t()> _timeSource;
+
     static NetworkBase* getServerOrClient()
     {
         switch (_mode)
@@ -52,6 +59,7 @@ namespace OpenLoco::Network
 
             _server = std::make_unique<NetworkServer>();
             _server->listen(bind, port);
+            StateChecksum::reset();
 
             _mode = NetworkMode::server;
             SceneManager::addSceneFlags(SceneManager::Flags::networked);
@@ -77,6 +85,7 @@ namespace OpenLoco::Network
         try
         {
             _client = std::make_unique<NetworkClient>();
+            _client->setReceivedState(std::move(_lastReceivedState));
             _client->connect(host, port);
             _mode = NetworkMode::client;
             return true;
@@ -90,6 +99,10 @@ namespace OpenLoco::Network
 
     void close()
     {
+        if (_client != nullptr)
+        {
+            _lastReceivedState = _client->takeReceivedState();
+        }
         _server = nullptr;
         _client = nullptr;
         _mode = NetworkMode::none;
@@ -167,6 +180,27 @@ namespace OpenLoco::Network
         }
     }
 
+    void updateChecksum(uint32_t tick)
+    {
+        switch (_mode)
+        {
+            case NetworkMode::none:
+                break;
+            case NetworkMode::server:
+                if (StateChecksum::update(tick))
+                {
+                    _server->sendChecksum(tick, StateChecksum::getLastChecksum());
+                }
+                break;
+            case NetworkMode::client:
+                if (_client->getStatus() == NetworkClientStatus::connected && StateChecksum::update(tick))
+                {
+                    _client->verifyChecksum(tick, StateChecksum::getLastChecksum());
+                }
+                break;
+        }
+    }
+
     bool isConnected()
     {
         switch (_mode)
@@ -189,4 +223,14 @@ namespace OpenLoco::Network
         }
         return ScenarioManager::getScenarioTicks();
     }
+
+    uint32_t getTime()
+    {
+        return _timeSource ? _timeSource() : Platform::getTime();
+    }
+
+    void setTimeSource(std::function<uint32_t()> timeSource)
+    {
+        _timeSource = std::move(timeSource);
+    }
 }
@@ -2,10 +2,14 @@
 #include "Logging.h"
 #include "Network/Packet.h"
 #include <OpenLoco/Platform/Platform.h>
+#include <cassert>
 
 using namespace OpenLoco;
 using namespace OpenLoco::Network;
 
+// Upper bound on how long the receive thread blocks, only matters for sockets created after the wait began
+constexpr uint32_t kMaxReceiveWaitTime = 100;
+
 NetworkBase::NetworkBase()
 {
 }
@@ -20,37 +24,55 @@ bool NetworkBase::isClosed() const
     return _isClosed;
 };
 
-void NetworkBase::receivePacketLoop()
+void NetworkBase::setReceiveOnUpdate(bool value)
 {
-    while (!_endReceivePacketLoop)
+    assert(_sockets.empty());
+    _receiveOnUpdate = value;
+}
+
+// Receives at most one packet from each socket, returns whether there were any
+bool NetworkBase::receivePackets()
+{
+    bool receivedPacket{};
+    for (auto& socket : _sockets)
     {
-        bool receivedPacket{};
-        for (auto& socket : _sockets)
-        {
-            Packet packet;
-            size_t packetSize{};
+        Packet packet;
+        size_t packetSize{};
 
-            std::unique_ptr<INetworkEndpoint> endpoint;
-            auto result = socket->receiveData(&packet, sizeof(Packet), &packetSize, &endpoint);
-            if (result == NetworkReadPacket::success)
+        std::unique_ptr<INetworkEndpoint> endpoint;
+        auto result = socket->receiveData(&packet, sizeof(Packet), &packetSize, &endpoint);
+        if (result == NetworkReadPacket::success)
+        {
+            // Validate packet
+            if (packet.header.dataSize <= packetSize - sizeof(PacketHeader))
             {
-                // Validate packet
-                if (packet.header.dataSize <= packetSize - sizeof(PacketHeader))
-                {
-                    onReceivePacket(*socket, std::move(endpoint), packet);
-                }
-                receivedPacket = true;
+                onReceivePacket(*socket, std::move(endpoint), packet);
             }
+            receivedPacket = true;
         }
-        if (!receivedPacket)
+    }
+    return receivedPacket;
+}
+
+void NetworkBase::receivePacketLoop()
+{
+    while (!_endReceivePacketLoop)
+    {
+        if (!receivePackets())
         {
-            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            _poller->wait(_sockets, kMaxReceiveWaitTime);
         }
     }
 }
 
 void NetworkBase::beginReceivePacketLoop()
 {
+    assert(!_sockets.empty());
+    if (_receiveOnUpdate)
+    {
+        return;
+    }
+    _poller = _sockets.front()->createPoller();
     _endReceivePacketLoop = false;
     _receivePacketThread = std::thread([this] { receivePacketLoop(); });
 }
@@ -58,18 +80,39 @@ void NetworkBase::beginReceivePacketLoop()
 void NetworkBase::endReceivePacketLoop()
 {
     _endReceivePacketLoop = true;
+    if (_poller != nullptr)
+    {
+        _poller->wakeup();
+    }
     if (_receivePacketThread.joinable())
     {
         _receivePacketThread.join();
     }
     _receivePacketThread = {};
+    _poller = nullptr;
 }
 
 void NetworkBase::update()
 {
+    if (_receiveOnUpdate)
+    {
+        while (receivePackets())
+        {
+        }
+    }
     onUpdate();
 }
 
+std::unique_ptr<IUdpSocket> NetworkBase::createSocket()
+{
+    return Socket::createUdp();
+}
+
+std::unique_ptr<INetworkEndpoint> NetworkBase::resolve(Protocol protocol, const std::string& address, port_t port)
+{
+    return Socket::resolve(protocol, address, port);
+}
+
 void NetworkBase::onClose()
 {
 }
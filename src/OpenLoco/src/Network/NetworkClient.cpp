@@ -1,13 +1,15 @@
 #include "Network/NetworkClient.h"
 #include "Config.h"
+#include "Environment.h"
 #include "GameCommands/GameCommands.h"
+#include "GameState.h"
 #include "Logging.h"
 #include "Network/NetworkConnection.h"
 #include "S5/S5.h"
 #include "SceneManager.h"
 #include "Ui/WindowManager.h"
 #include <OpenLoco/Core/BinaryStream.h>
-#include <OpenLoco/Platform/Platform.h>
+#include <OpenLoco/Core/FileStream.h>
 
 using namespace OpenLoco;
 using namespace OpenLoco::Network;
@@ -28,24 +30,40 @@ uint32_t NetworkClient::getLocalTick() const
     return _localTick;
 }
 
+NetworkConnectionStats NetworkClient::getStats() const
+{
+    return _serverConnection != nullptr ? _serverConnection->getStats() : NetworkConnectionStats{};
+}
+
+void NetworkClient::setReceivedState(std::unique_ptr<StateSnapshot> state)
+{
+    _receivedState = std::move(state);
+}
+
+std::unique_ptr<StateSnapshot> NetworkClient::takeReceivedState()
+{
+    return std::move(_receivedState);
+}
+
 void NetworkClient::connect(std::string_view host, port_t port)
 {
     auto szHost = std::string(host);
-    _serverEndpoint = Socket::resolve(Protocol::any, szHost, port);
+    _serverEndpoint = resolve(Protocol::any, szHost, port);
 
-    _sockets.push_back(Socket::createUdp());
+    _sockets.push_back(createSocket());
     auto& socket = _sockets.back();
     _serverConnection = std::make_unique<NetworkConnection>(socket.get(), _serverEndpoint->clone());
 
     auto szHostIpAddress = _serverEndpoint->getIpAddress();
     Logging::info("Resolved endpoint for {}:{}", szHostIpAddress, port);
 
-    beginReceivePacketLoop();
-
     _status = NetworkClientStatus::connecting;
-    _timeout = Platform::getTime() + 5000;
+    _timeout = Network::getTime() + 5000;
 
+    // The socket is only created when the first packet is sent, so send it before the receive
+    // loop starts waiting on the socket
     sendConnectPacket();
+    beginReceivePacketLoop();
 
     initStatus("Connecting to " + szHost + "...");
 }
@@ -71,7 +89,7 @@ void NetworkClient::onUpdate()
     processReceivedPackets();
     if (_status == NetworkClientStatus::connecting)
     {
-        if (Platform::getTime() >= _timeout)
+        if (Network::getTime() >= _timeout)
         {
             close();
             Logging::info("Failed to connect to server");
@@ -174,6 +192,9 @@ void NetworkClient::onReceivePacketFromServer(const Packet& packet)
         case PacketKind::gameCommand:
             receiveGameCommandPacket(*reinterpret_cast<const GameCommandPacket*>(packet.data));
             break;
+        case PacketKind::checksum:
+            receiveChecksumPacket(*reinterpret_cast<const ChecksumPacket*>(packet.data));
+            break;
         default:
             break;
     }
@@ -190,11 +211,11 @@ void NetworkClient::sendConnectPacket()
 
 void NetworkClient::sendRequestStatePacket()
 {
-    _requestStateCookie = (std::rand() << 16) | std::rand();
-    _requestStateChunksReceived.clear();
+    _stateReceiver.reset((std::rand() << 16) | std::rand());
 
     RequestStatePacket packet;
-    packet.cookie = _requestStateCookie;
+    packet.cookie = _stateReceiver.getCookie();
+    packet.baseHash = _receivedState != nullptr ? _receivedState->getHash() : 0;
     _serverConnection->sendPacket(packet);
 }
 
@@ -214,49 +235,66 @@ void NetworkClient::receiveConnectionResponsePacket(const ConnectResponsePacket&
 
 void NetworkClient::receiveRequestStateResponsePacket(const RequestStateResponse& response)
 {
-    if (response.cookie == _requestStateCookie)
+    _stateReceiver.receive(response);
+
+    // The response may have been resent and arrive after the last chunk
+    if (_stateReceiver.isComplete())
     {
-        _requestStateNumChunks = response.numChunks;
-        _requestStateTotalSize = response.totalSize;
-        _requestStateReceivedChunks = 0;
+        processReceivedState();
     }
 }
 
 void NetworkClient::receiveRequestStateResponseChunkPacket(const RequestStateResponseChunk& responseChunk)
 {
-    if (responseChunk.cookie == _requestStateCookie)
+    if (_stateReceiver.receive(responseChunk))
     {
-        if (_requestStateChunksReceived.size() <= responseChunk.index)
-        {
-            _requestStateChunksReceived.resize(responseChunk.index + 1);
-        }
+        setStatus("Receiving state: " + std::to_string(_stateReceiver.getReceivedBytes()) + " / " + std::to_string(_stateReceiver.getTotalSize()));
+    }
 
-        auto& rchunk = _requestStateChunksReceived[responseChunk.index];
-        if (rchunk.data.size() == 0)
-        {
-            rchunk.offset = responseChunk.offset;
-            rchunk.data.assign(responseChunk.data, responseChunk.data + responseChunk.dataSize);
-            _requestStateReceivedChunks++;
+    if (_stateReceiver.isComplete())
+    {
+        processReceivedState();
+    }
+}
 
-            _requestStateReceivedBytes += responseChunk.dataSize;
-            setStatus("Receiving state: " + std::to_string(_requestStateReceivedBytes) + " / " + std::to_string(_requestStateTotalSize));
+void NetworkClient::processReceivedState()
+{
+    auto data = StateSnapshot::decode(_stateReceiver.takePayload(), _receivedState.get());
+    if (!data)
+    {
+        if (_receivedState != nullptr)
+        {
+            // Our base state may not be what the server thinks it is, ask for the full state instead
+            Logging::warn("Unable to apply state delta, requesting full state");
+            _receivedState = nullptr;
+            sendRequestStatePacket();
         }
-
-        if (_requestStateReceivedChunks >= _requestStateNumChunks)
+        else
         {
-            // Construct full data
-            std::vector<uint8_t> fullData;
-            for (size_t i = 0; i < _requestStateChunksReceived.size(); i++)
-            {
-                fullData.insert(fullData.end(), _requestStateChunksReceived[i].data.begin(), _requestStateChunksReceived[i].data.end());
-            }
+            Logging::error("Received invalid state from server");
+            endStatus("Received invalid state from server");
+            close();
+        }
+        return;
+    }
 
-            clearStatus();
-            _status = NetworkClientStatus::connected;
+    clearStatus();
+    _status = NetworkClientStatus::connected;
 
-            processFullState(fullData);
-        }
+    _receivedState = std::make_unique<StateSnapshot>(std::move(*data));
+    if (_desyncTick)
+    {
+        // Keep the server's state next to our own so the two can be compared. The server sends its
+        // current state, which is from a later tick than the one that failed the checksum.
+        const auto fullData = _receivedState->getData();
+        const auto* extra = reinterpret_cast<const ExtraState*>(fullData.data() + fullData.size() - sizeof(ExtraState));
+        const auto path = getDesyncSavePath(*_desyncTick, extra->tick, "server");
+        FileStream fs(path, StreamMode::write);
+        fs.write(fullData.data(), fullData.size() - sizeof(ExtraState));
+        Logging::info("Saved server state to {}", path.u8string());
+        _desyncTick = std::nullopt;
     }
+    processFullState(_receivedState->getData());
 }
 
 void NetworkClient::processFullState(std::span<uint8_t const> fullData)
@@ -264,9 +302,19 @@ void NetworkClient::processFullState(std::span<uint8_t const> fullData)
     auto* extra = reinterpret_cast<const ExtraState*>(fullData.data() + fullData.size() - sizeof(ExtraState));
     _localGameCommandIndex = extra->gameCommandIndex;
     _localTick = extra->tick;
+
+    // Drop any game commands that are already part of the received state
+    _receivedGameCommands.remove_if([this](const GameCommandPacket& p) { return p.index <= _localGameCommandIndex; });
     updateLocalTick();
+    _localChecksums.clear();
+    _serverChecksums.clear();
+
+    loadState(fullData.first(fullData.size() - sizeof(ExtraState)));
+}
 
-    BinaryStream bs(fullData.data(), fullData.size() - sizeof(ExtraState));
+void NetworkClient::loadState(std::span<uint8_t const> data)
+{
+    BinaryStream bs(data.data(), data.size());
     if (S5::importSaveToGameState(bs, S5::LoadFlags::none))
     {
         SceneManager::requestScene(SceneManager::SceneId::gameplay);
@@ -289,11 +337,13 @@ void NetworkClient::receivePingPacket(const PingPacket& packet)
     _serverTick = std::max(_serverTick, packet.tick);
     _serverGameCommandIndex = std::max(_serverGameCommandIndex, packet.gameCommandIndex);
 
-    if (_localGameCommandIndex == _serverGameCommandIndex)
+    // Pings can arrive out of order when they had to be resent
+    if (packet.tick > _pingTick)
     {
-        // No pending game commands, we can update to this tick
-        _localTick = packet.tick;
+        _pingTick = packet.tick;
+        _pingGameCommandIndex = packet.gameCommandIndex;
     }
+    updateLocalTick();
 }
 
 void NetworkClient::receiveGameCommandPacket(const GameCommandPacket& packet)
@@ -302,6 +352,13 @@ void NetworkClient::receiveGameCommandPacket(const GameCommandPacket& packet)
     _serverTick = std::max(_serverTick, packet.tick);
     _serverGameCommandIndex = std::max(_serverGameCommandIndex, packet.index);
 
+    // A command sent before the state we received can still arrive after it if it had to be
+    // resent, it is already part of that state
+    if (_status == NetworkClientStatus::connected && packet.index <= _localGameCommandIndex)
+    {
+        return;
+    }
+
     // Catch old or repeated game command index
     assert(packet.index > _localGameCommandIndex);
 
@@ -324,6 +381,17 @@ void NetworkClient::receiveGameCommandPacket(const GameCommandPacket& packet)
     updateLocalTick();
 }
 
+void NetworkClient::receiveChecksumPacket(const ChecksumPacket& packet)
+{
+    if (_status != NetworkClientStatus::connected)
+    {
+        return;
+    }
+
+    _serverChecksums[packet.tick] = packet.checksum;
+    compareChecksums(packet.tick);
+}
+
 void NetworkClient::sendChatMessage(std::string_view message)
 {
     if (_serverConnection != nullptr)
@@ -349,23 +417,37 @@ void NetworkClient::sendGameCommand(CompanyId company, const OpenLoco::GameComma
 
 void NetworkClient::updateLocalTick()
 {
-    // If we have the next game command, we can set local tick to the tick for that command
-    if (!_receivedGameCommands.empty())
+    // Commands are sent in index order and their ticks never go down, so once we have every command
+    // up to one for a tick, all the ticks before it are complete. That tick itself is not, more
+    // commands for it may still be on their way.
+    auto index = _localGameCommandIndex;
+    for (const auto& p : _receivedGameCommands)
     {
-        auto& nextGameCommand = _receivedGameCommands.front();
-        if (nextGameCommand.index == _localGameCommandIndex + 1)
+        if (p.index != index + 1)
         {
-            // We already have the next game command, so we can update to the tick for that command
-            _localTick = nextGameCommand.tick;
+            break;
+        }
+        index = p.index;
+        if (p.tick > _localTick + 1)
+        {
+            _localTick = p.tick - 1;
         }
     }
+
+    // Every command for the tick of a ping was sent before it, so once we have all of the commands
+    // up to the index in the ping we can run up to its tick
+    if (index >= _pingGameCommandIndex)
+    {
+        _localTick = std::max(_localTick, _pingTick);
+    }
 }
 
 bool NetworkClient::shouldProcessTick(uint32_t tick) const
 {
     if (_status != NetworkClientStatus::connected)
     {
-        return true;
+        // Our state is known to be wrong, wait for the server's state rather than diverging further
+        return !_desyncTick.has_value();
     }
 
     return _localTick >= tick;
@@ -385,7 +467,7 @@ void NetworkClient::runGameCommandsForTick(uint32_t tick)
         if (nextPacket.index == _localGameCommandIndex + 1 && nextPacket.tick == tick)
         {
             _localGameCommandIndex++;
-            GameCommands::doCommandForReal(static_cast<GameCommands::GameCommand>(nextPacket.regs.esi), nextPacket.company, nextPacket.regs, static_cast<GameCommands::Flags>(nextPacket.flags));
+            runGameCommand(nextPacket);
             _receivedGameCommands.pop_front();
         }
         else
@@ -397,6 +479,63 @@ void NetworkClient::runGameCommandsForTick(uint32_t tick)
     updateLocalTick();
 }
 
+void NetworkClient::runGameCommand(const GameCommandPacket& packet)
+{
+    GameCommands::doCommandForReal(static_cast<GameCommands::GameCommand>(packet.regs.esi), packet.company, packet.regs, static_cast<GameCommands::Flags>(packet.flags));
+}
+
+void NetworkClient::verifyChecksum(uint32_t tick, uint32_t checksum)
+{
+    _localChecksums[tick] = checksum;
+    compareChecksums(tick);
+}
+
+void NetworkClient::compareChecksums(uint32_t tick)
+{
+    auto localIt = _localChecksums.find(tick);
+    auto serverIt = _serverChecksums.find(tick);
+    if (localIt == _localChecksums.end() || serverIt == _serverChecksums.end())
+    {
+        return;
+    }
+
+    const auto matches = localIt->second == serverIt->second;
+
+    // Both sides run the ticks in order, so anything older than this will never be matched
+    _localChecksums.erase(_localChecksums.begin(), std::next(localIt));
+    _serverChecksums.erase(_serverChecksums.begin(), std::next(serverIt));
+
+    if (!matches)
+    {
+        onDesync(tick);
+    }
+}
+
+void NetworkClient::onDesync(uint32_t tick)
+{
+    Logging::error("Desync detected at tick {}, requesting state from server", tick);
+
+    // The server's checksum can arrive after we have run further ticks
+    const auto path = getDesyncSavePath(tick, getGameState().scenarioTicks, "client");
+    if (S5::exportGameStateToFile(path, S5::SaveFlags::noWindowClose))
+    {
+        Logging::info("Saved client state to {}", path.u8string());
+    }
+
+    _desyncTick = tick;
+    _status = NetworkClientStatus::waitingForState;
+    _localChecksums.clear();
+    _serverChecksums.clear();
+    sendRequestStatePacket();
+}
+
+// Named after the tick that failed the checksum and the tick the saved state is from
+fs::path NetworkClient::getDesyncSavePath(uint32_t desyncTick, uint32_t stateTick, std::string_view side)
+{
+    auto filename = "desync_" + std::to_string(desyncTick) + "_" + std::string(side) + "_" + std::to_string(stateTick) + S5::extensionSV5;
+    return Environment::getPath(Environment::PathId::save) / filename;
+}
+
 void NetworkClient::initStatus(std::string_view text)
 {
     Ui::Windows::NetworkStatus::open(text, [this]() { onCancel(); });
@@ -1,6 +1,5 @@
 #include "Network/NetworkConnection.h"
 #include "Logging.h"
-#include <OpenLoco/Platform/Platform.h>
 #include <cstring>
 
 using namespace OpenLoco::Network;
@@ -21,7 +20,18 @@ const INetworkEndpoint& NetworkConnection::getEndpoint() const
 
 uint32_t NetworkConnection::getTime()
 {
-    return Platform::getTime();
+    return Network::getTime();
+}
+
+NetworkConnectionStats NetworkConnection::getStats() const
+{
+    NetworkConnectionStats stats;
+    stats.packetsSent = _packetsSent;
+    stats.packetsResent = _packetsResent;
+    stats.packetsReceived = _packetsReceived;
+    stats.bytesSent = _bytesSent;
+    stats.bytesReceived = _bytesReceived;
+    return stats;
 }
 
 bool NetworkConnection::hasTimedOut() const
@@ -41,26 +51,25 @@ void NetworkConnection::update()
 
 bool NetworkConnection::checkOrRecordReceivedSequence(sequence_t sequence)
 {
-    for (auto s : _receivedSequences)
+    if (sequence < _receivedSequenceFloor || !_receivedSequencesAboveFloor.insert(sequence).second)
     {
-        if (s == sequence)
-        {
-            return true;
-        }
+        return true;
     }
 
-    while (_receivedSequences.size() >= 1024)
+    // Only packets that are still being resent after a loss are kept in the set
+    while (!_receivedSequencesAboveFloor.empty() && *_receivedSequencesAboveFloor.begin() == _receivedSequenceFloor)
     {
-        _receivedSequences.pop_back();
+        _receivedSequencesAboveFloor.erase(_receivedSequencesAboveFloor.begin());
+        _receivedSequenceFloor++;
     }
-
-    _receivedSequences.push_back(sequence);
     return false;
 }
 
 void NetworkConnection::receivePacket(const Packet& packet)
 {
-    _timeOfLastReceivedPacket = Platform::getTime();
+    _timeOfLastReceivedPacket = getTime();
+    _packetsReceived++;
+    _bytesReceived += sizeof(PacketHeader) + packet.header.dataSize;
 
     logPacket(packet, false, false);
     if (packet.header.kind == PacketKind::ack)
@@ -100,26 +109,21 @@ void NetworkConnection::sendPacket(const Packet& packet)
     if (packet.header.kind != PacketKind::ack)
     {
         std::unique_lock<std::mutex> lk(_sentPacketsSync);
-        auto timestamp = getTime();
-        _sentPackets.push_back({ timestamp, packet });
+        _sentPackets[packet.header.sequence] = packet;
+        _resendTimers.push({ getTime() + kRedeliverTimeout, packet.header.sequence });
     }
 
     size_t packetSize = sizeof(PacketHeader) + packet.header.dataSize;
     _socket->sendData(*_endpoint, &packet, packetSize);
+    _packetsSent++;
+    _bytesSent += packetSize;
     logPacket(packet, true, false);
 }
 
 void NetworkConnection::receiveAcknowledgePacket(sequence_t sequence)
 {
     std::unique_lock<std::mutex> lk(_sentPacketsSync);
-    for (size_t i = 0; i < _sentPackets.size(); i++)
-    {
-        if (_sentPackets[i].packet.header.sequence == sequence)
-        {
-            _sentPackets.erase(_sentPackets.begin() + i);
-            break;
-        }
-    }
+    _sentPackets.erase(sequence);
 }
 
 void NetworkConnection::sendAcknowledgePacket(sequence_t sequence)
@@ -135,19 +139,28 @@ void NetworkConnection::resendUndeliveredPackets()
 {
     std::unique_lock<std::mutex> lk(_sentPacketsSync);
     auto now = getTime();
-    auto timestamp = now - kRedeliverTimeout;
 
-    for (size_t i = 0; i < _sentPackets.size(); i++)
+    // Only the timers that have expired are visited, the rest of the queue is untouched
+    while (!_resendTimers.empty() && static_cast<int32_t>(now - _resendTimers.top().time) >= 0)
     {
-        auto& sentPacket = _sentPackets[i];
-        if (sentPacket.timestamp < timestamp)
-        {
-            size_t packetSize = sizeof(PacketHeader) + sentPacket.packet.header.dataSize;
-            _socket->sendData(*_endpoint, &sentPacket.packet, packetSize);
-            logPacket(sentPacket.packet, true, true);
+        auto sequence = _resendTimers.top().sequence;
+        _resendTimers.pop();
 
-            sentPacket.timestamp = now;
+        auto it = _sentPackets.find(sequence);
+        if (it == _sentPackets.end())
+        {
+            // Already acknowledged
+            continue;
         }
+
+        const auto& packet = it->second;
+        size_t packetSize = sizeof(PacketHeader) + packet.header.dataSize;
+        _socket->sendData(*_endpoint, &packet, packetSize);
+        _packetsResent++;
+        _bytesSent += packetSize;
+        logPacket(packet, true, true);
+
+        _resendTimers.push({ now + kRedeliverTimeout, sequence });
     }
 }
 
@@ -177,6 +190,7 @@ std::optional<Packet> NetworkConnection::takeNextPacket()
         case PacketKind::sendChatMessage: return "SEND CHAT";
         case PacketKind::receiveChatMessage: return "RECEIVE CHAT";
         case PacketKind::gameCommand: return "GAME COMMAND";
+        case PacketKind::checksum: return "CHECKSUM";
         default: return "UNKNOWN";
     }
 }
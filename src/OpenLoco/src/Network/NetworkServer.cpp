@@ -8,7 +8,6 @@
 #include "SceneManager.h"
 #include <OpenLoco/Core/Exception.hpp>
 #include <OpenLoco/Core/MemoryStream.h>
-#include <OpenLoco/Platform/Platform.h>
 #include <OpenLoco/Utility/String.hpp>
 #include <span>
 
@@ -17,6 +16,7 @@ using namespace OpenLoco::Network;
 using namespace OpenLoco::Diagnostics;
 
 constexpr uint32_t kPingInterval = 30;
+constexpr size_t kMaxStateSnapshots = 4;
 
 NetworkServer::~NetworkServer()
 {
@@ -28,7 +28,7 @@ void NetworkServer::listen(const std::string& bind, port_t port)
     // IPv4
     try
     {
-        auto socket4 = Socket::createUdp();
+        auto socket4 = createSocket();
         socket4->listen(Protocol::ipv4, bind, port);
         _sockets.push_back(std::move(socket4));
     }
@@ -39,7 +39,7 @@ void NetworkServer::listen(const std::string& bind, port_t port)
     // IPv6
     try
     {
-        auto socket6 = Socket::createUdp();
+        auto socket6 = createSocket();
         socket6->listen(Protocol::ipv6, bind, port);
         _sockets.push_back(std::move(socket6));
     }
@@ -65,10 +65,30 @@ void NetworkServer::listen(const std::string& bind, port_t port)
         {
             ipAddress = '[' + ipAddress + ']';
         }
-        Logging::info("Listening for incoming connections on {}:{}...", ipAddress.c_str(), port);
+        Logging::info("Listening for incoming connections on {}:{}...", ipAddress.c_str(), socket->getPort());
     }
 }
 
+port_t NetworkServer::getPort() const
+{
+    return _sockets.empty() ? 0 : _sockets.front()->getPort();
+}
+
+NetworkConnectionStats NetworkServer::getStats() const
+{
+    NetworkConnectionStats total;
+    for (const auto& client : _clients)
+    {
+        const auto stats = client->connection->getStats();
+        total.packetsSent += stats.packetsSent;
+        total.packetsResent += stats.packetsResent;
+        total.packetsReceived += stats.packetsReceived;
+        total.bytesSent += stats.bytesSent;
+        total.bytesReceived += stats.bytesReceived;
+    }
+    return total;
+}
+
 void NetworkServer::onClose()
 {
     SceneManager::removeSceneFlags(SceneManager::Flags::networked);
@@ -144,43 +164,73 @@ void NetworkServer::onReceivePacketFromClient(Client& client, const Packet& pack
     }
 }
 
-void NetworkServer::onReceiveStateRequestPacket(Client& client, const RequestStatePacket& request)
+StateSnapshot& NetworkServer::getCurrentStateSnapshot()
 {
-    constexpr uint16_t kChunkSize = 4000;
+    const auto tick = ScenarioManager::getScenarioTicks();
+    if (!_stateSnapshots.empty() && _stateSnapshotTick == tick && _stateSnapshotGameCommandIndex == _lastRunGameCommandIndex)
+    {
+        // Nothing has changed since the last snapshot, share it between all the joining clients
+        return *_stateSnapshots.back();
+    }
 
-    // Dump S5 data to stream
     MemoryStream ms;
-    S5::exportGameStateToFile(ms, S5::SaveFlags::noWindowClose);
+    exportState(ms);
 
     // Append extra state
+    // Commands that are queued but have not run yet are not part of the state, they are sent as usual
     ExtraState extra;
-    extra.gameCommandIndex = _gameCommandIndex;
-    extra.tick = ScenarioManager::getScenarioTicks();
+    extra.gameCommandIndex = _lastRunGameCommandIndex;
+    extra.tick = tick;
     ms.write(&extra, sizeof(extra));
 
-    RequestStateResponse response;
-    response.cookie = request.cookie;
-    response.totalSize = static_cast<uint32_t>(ms.getLength());
-    response.numChunks = static_cast<uint16_t>((ms.getLength() + (kChunkSize - 1)) / kChunkSize);
-    client.connection->sendPacket(response);
+    const auto* data = reinterpret_cast<const uint8_t*>(ms.data());
+    _stateSnapshots.push_back(std::make_unique<StateSnapshot>(std::vector<uint8_t>(data, data + ms.getLength())));
+    while (_stateSnapshots.size() > kMaxStateSnapshots)
+    {
+        _stateSnapshots.pop_front();
+    }
+    _statePayloads.clear();
+    _stateSnapshotTick = tick;
+    _stateSnapshotGameCommandIndex = _lastRunGameCommandIndex;
+    return *_stateSnapshots.back();
+}
 
-    uint32_t offset = 0;
-    uint32_t remaining = response.totalSize;
-    uint16_t index = 0;
-    while (index < response.numChunks)
+void NetworkServer::exportState(MemoryStream& stream)
+{
+    // Dump S5 data to stream, without run length encoding so that unchanged regions
+    // of the game state stay at the same offset between snapshots
+    S5::exportGameStateToFile(stream, S5::SaveFlags::noWindowClose | S5::SaveFlags::uncompressed);
+}
+
+StateSnapshot* NetworkServer::findStateSnapshot(snapshot_hash_t hash)
+{
+    for (auto& snapshot : _stateSnapshots)
     {
-        RequestStateResponseChunk chunk;
-        chunk.cookie = request.cookie;
-        chunk.index = index;
-        chunk.offset = offset;
-        chunk.dataSize = std::min<uint32_t>(kChunkSize, remaining - offset);
-        std::memcpy(chunk.data, reinterpret_cast<const uint8_t*>(ms.data()) + offset, chunk.dataSize);
+        if (snapshot->getHash() == hash)
+        {
+            return snapshot.get();
+        }
+    }
+    return nullptr;
+}
 
-        client.connection->sendPacket(chunk);
+void NetworkServer::onReceiveStateRequestPacket(Client& client, const RequestStatePacket& request)
+{
+    auto& snapshot = getCurrentStateSnapshot();
 
-        offset += chunk.dataSize;
-        index++;
+    // Send a delta if the client still has a snapshot we know about, otherwise the full state
+    auto* base = request.baseHash != 0 ? findStateSnapshot(request.baseHash) : nullptr;
+    const auto baseHash = base != nullptr ? base->getHash() : 0;
+
+    auto it = _statePayloads.find(baseHash);
+    if (it == _statePayloads.end())
+    {
+        it = _statePayloads.emplace(baseHash, snapshot.encode(base)).first;
     }
+
+    const auto& payload = it->second;
+    Logging::info("Sending state to {}: {} bytes ({} uncompressed, {})", client.name, payload.size(), snapshot.getData().size(), base != nullptr ? "delta" : "full");
+    sendStatePayload(*client.connection, request.cookie, payload);
 }
 
 void NetworkServer::onReceiveSendChatMessagePacket(Client& client, const SendChatMessage& packet)
@@ -216,7 +266,7 @@ void NetworkServer::removedTimedOutClients()
 
 void NetworkServer::sendPings()
 {
-    auto now = Platform::getTime();
+    auto now = Network::getTime();
     if (now - _lastPing > kPingInterval)
     {
         _lastPing = now;
@@ -308,6 +358,14 @@ void NetworkServer::sendChatMessage(std::string_view message)
     _chatMessageQueue.push({ 0, std::string(message) });
 }
 
+void NetworkServer::sendChecksum(uint32_t tick, uint32_t checksum)
+{
+    ChecksumPacket packet;
+    packet.tick = tick;
+    packet.checksum = checksum;
+    sendPacketToAll(packet);
+}
+
 void NetworkServer::sendGameCommand(uint32_t index, uint32_t tick, CompanyId company, const OpenLoco::GameCommands::registers& regs, const uint8_t flags)
 {
     GameCommandPacket packet;
@@ -340,7 +398,8 @@ void NetworkServer::runGameCommands()
     {
         auto& gc = _gameCommands.front();
 
-        [[maybe_unused]] auto result = GameCommands::doCommandForReal(static_cast<GameCommands::GameCommand>(gc.regs.esi), gc.company, gc.regs, static_cast<GameCommands::Flags>(gc.flags));
+        runGameCommand(gc);
+        _lastRunGameCommandIndex = gc.index;
 
         // TODO We can't do this, we have to send a dummy command to the clients
         //      otherwise we skip a game command index
@@ -352,3 +411,8 @@ void NetworkServer::runGameCommands()
         _gameCommands.pop();
     }
 }
+
+void NetworkServer::runGameCommand(const GameCommandPacket& packet)
+{
+    GameCommands::doCommandForReal(static_cast<GameCommands::GameCommand>(packet.regs.esi), packet.company, packet.regs, static_cast<GameCommands::Flags>(packet.flags));
+}
@@ -32,6 +32,8 @@
         #define SHUT_RDWR SD_BOTH
     #endif
     #define FLAG_NO_PIPE 0
+    #define poll WSAPoll
+    using nfds_t = ULONG;
 #else
     #include <arpa/inet.h>
     #include <cerrno>
@@ -40,6 +42,7 @@
     #include <netdb.h>
     #include <netinet/in.h>
     #include <netinet/tcp.h>
+    #include <poll.h>
     #include <sys/ioctl.h>
     #include <sys/socket.h>
     #include <unistd.h>
@@ -379,6 +382,97 @@ namespace OpenLoco::Network
         }
     };
 
+    class UdpSocket;
+
+    /**
+     * Waits on the sockets with poll. A second descriptor is included in every poll so that another
+     * thread can interrupt the wait by writing to it.
+     */
+    class UdpSocketPoller final : public ISocketPoller, protected BaseSocket
+    {
+    private:
+        SOCKET _wakeupRead = INVALID_SOCKET;
+        SOCKET _wakeupWrite = INVALID_SOCKET;
+        std::vector<pollfd> _fds;
+
+    public:
+        UdpSocketPoller()
+        {
+#ifdef _WIN32
+            // There are no pipes that work with WSAPoll, use a UDP socket that sends to itself instead
+            _wakeupRead = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+            sockaddr_in address{};
+            address.sin_family = AF_INET;
+            address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+            socklen_t addressLen = sizeof(address);
+            if (_wakeupRead == INVALID_SOCKET
+                || bind(_wakeupRead, reinterpret_cast<sockaddr*>(&address), addressLen) != 0
+                || getsockname(_wakeupRead, reinterpret_cast<sockaddr*>(&address), &addressLen) != 0
+                || connect(_wakeupRead, reinterpret_cast<sockaddr*>(&address), addressLen) != 0)
+            {
+                closeWakeup();
+                throw SocketException("Unable to create wakeup socket.");
+            }
+            _wakeupWrite = _wakeupRead;
+#else
+            int fds[2];
+            if (pipe(fds) != 0)
+            {
+                throw SocketException("Unable to create wakeup pipe.");
+            }
+            _wakeupRead = fds[0];
+            _wakeupWrite = fds[1];
+#endif
+            setNonBlocking(_wakeupRead, true);
+            setNonBlocking(_wakeupWrite, true);
+        }
+
+        ~UdpSocketPoller() override
+        {
+            closeWakeup();
+        }
+
+        void wait(std::span<const std::unique_ptr<IUdpSocket>> sockets, uint32_t timeoutMs) override;
+
+        void wakeup() override
+        {
+            const char value = 0;
+#ifdef _WIN32
+            send(_wakeupWrite, &value, 1, 0);
+#else
+            // If the pipe is full a wakeup is already pending, so a failed write can be ignored
+            [[maybe_unused]] auto written = write(_wakeupWrite, &value, 1);
+#endif
+        }
+
+    private:
+        void drainWakeup()
+        {
+            char buffer[64];
+#ifdef _WIN32
+            while (recv(_wakeupRead, buffer, sizeof(buffer), 0) > 0)
+#else
+            while (read(_wakeupRead, buffer, sizeof(buffer)) > 0)
+#endif
+            {
+            }
+        }
+
+        void closeWakeup()
+        {
+            if (_wakeupRead != INVALID_SOCKET)
+            {
+                closesocket(_wakeupRead);
+            }
+            if (_wakeupWrite != INVALID_SOCKET && _wakeupWrite != _wakeupRead)
+            {
+                closesocket(_wakeupWrite);
+            }
+            _wakeupRead = INVALID_SOCKET;
+            _wakeupWrite = INVALID_SOCKET;
+        }
+    };
+
     class UdpSocket final : public IUdpSocket, protected BaseSocket
     {
     private:
@@ -410,6 +504,22 @@ namespace OpenLoco::Network
             return _error.empty() ? nullptr : _error.c_str();
         }
 
+        uint16_t getPort() const override
+        {
+            if (_listeningPort != 0 || _socket == INVALID_SOCKET)
+            {
+                return _listeningPort;
+            }
+
+            sockaddr_storage address{};
+            socklen_t addressLen = sizeof(address);
+            if (getsockname(_socket, reinterpret_cast<sockaddr*>(&address), &addressLen) != 0)
+            {
+                return 0;
+            }
+            return ntohs(static_cast<uint16_t>(NetworkEndpoint(&address, addressLen).getPort()));
+        }
+
         void listen(Protocol protocol, uint16_t port) override
         {
             listen(protocol, "", port);
@@ -524,6 +634,16 @@ namespace OpenLoco::Network
             closeSocket();
         }
 
+        std::unique_ptr<ISocketPoller> createPoller() const override
+        {
+            return std::make_unique<UdpSocketPoller>();
+        }
+
+        SOCKET getNativeSocket() const
+        {
+            return _socket;
+        }
+
         const char* getHostName() const override
         {
             return _hostName.empty() ? nullptr : _hostName.c_str();
@@ -611,6 +731,26 @@ namespace OpenLoco::Network
         }
     };
 
+    void UdpSocketPoller::wait(std::span<const std::unique_ptr<IUdpSocket>> sockets, uint32_t timeoutMs)
+    {
+        _fds.clear();
+        _fds.push_back({ _wakeupRead, POLLIN, 0 });
+        for (const auto& socket : sockets)
+        {
+            // Sockets that have not sent anything yet do not have a descriptor to wait on
+            const auto* udpSocket = dynamic_cast<const UdpSocket*>(socket.get());
+            if (udpSocket != nullptr && udpSocket->getNativeSocket() != INVALID_SOCKET)
+            {
+                _fds.push_back({ udpSocket->getNativeSocket(), POLLIN, 0 });
+            }
+        }
+
+        if (poll(_fds.data(), static_cast<nfds_t>(_fds.size()), static_cast<int>(timeoutMs)) > 0 && (_fds[0].revents & POLLIN))
+        {
+            drainWakeup();
+        }
+    }
+
     namespace Socket
     {
         std::unique_ptr<IUdpSocket> createUdp()
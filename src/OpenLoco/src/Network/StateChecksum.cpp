@@ -0,0 +1,154 @@
+#include "Network/StateChecksum.h"
+#include "GameState.h"
+#include "Map/TileManager.h"
+#include <OpenLoco/Engine/World.hpp>
+#include <cstring>
+
+namespace OpenLoco::Network::StateChecksum
+{
+    constexpr auto kRowsPerTick = (World::kMapRows + kInterval - 1) / kInterval;
+    constexpr auto kStationsPerTick = (Limits::kMaxStations + kInterval - 1) / kInterval;
+
+    static void combine(uint32_t& hash, uint32_t value)
+    {
+        hash ^= value + 0x9E3779B9U + (hash << 6) + (hash >> 2);
+    }
+
+    static void combine(uint32_t& hash, int64_t value)
+    {
+        combine(hash, static_cast<uint32_t>(value));
+        combine(hash, static_cast<uint32_t>(value >> 32));
+    }
+
+    static void combineBytes(uint32_t& hash, const void* data, size_t size)
+    {
+        const auto* bytes = static_cast<const uint8_t*>(data);
+        for (; size >= sizeof(uint32_t); size -= sizeof(uint32_t), bytes += sizeof(uint32_t))
+        {
+            uint32_t word;
+            std::memcpy(&word, bytes, sizeof(word));
+            combine(hash, word);
+        }
+        for (; size > 0; size--, bytes++)
+        {
+            combine(hash, static_cast<uint32_t>(*bytes));
+        }
+    }
+
+    // Only the simulated part of the entity, the sprite bounds and the spatial index are
+    // affected by interpolation and vehicle sounds depend on what the local player is looking at
+    static void combineEntities(uint32_t& hash, const GameState& gameState)
+    {
+        for (const auto& entity : gameState.entities)
+        {
+            if (entity.baseType == EntityBaseType::null)
+            {
+                continue;
+            }
+            combine(hash, static_cast<uint32_t>(entity.baseType) | (static_cast<uint32_t>(entity.linkedListOffset) << 8) | (enumValue(entity.id) << 16));
+            combine(hash, static_cast<uint32_t>(static_cast<uint16_t>(entity.position.x)) | (static_cast<uint32_t>(static_cast<uint16_t>(entity.position.y)) << 16));
+            combine(hash, static_cast<uint32_t>(static_cast<uint16_t>(entity.position.z)) | (static_cast<uint32_t>(enumValue(entity.owner)) << 16) | (static_cast<uint32_t>(entity.spriteYaw) << 24));
+            combine(hash, static_cast<uint32_t>(entity.spritePitch));
+        }
+    }
+
+    static void combineCompany(uint32_t& hash, const Company& company)
+    {
+        if (company.empty())
+        {
+            return;
+        }
+        combine(hash, company.cash.asInt64());
+        combine(hash, static_cast<uint32_t>(company.currentLoan));
+        combine(hash, company.updateCounter);
+        combine(hash, static_cast<uint32_t>(company.performanceIndex));
+        combine(hash, static_cast<uint32_t>(company.headquartersX) | (static_cast<uint32_t>(company.headquartersY) << 16));
+        combine(hash, static_cast<uint32_t>(company.activeThoughtId) | (static_cast<uint32_t>(company.var_4A4) << 8));
+        combine(hash, company.aiPlaceVehicleIndex);
+        combine(hash, company.cargoUnitsTotalDelivered);
+    }
+
+    static void combineStation(uint32_t& hash, const Station& station)
+    {
+        if (station.empty())
+        {
+            return;
+        }
+        combine(hash, static_cast<uint32_t>(station.x) | (static_cast<uint32_t>(station.y) << 16));
+        combine(hash, static_cast<uint32_t>(station.z) | (static_cast<uint32_t>(enumValue(station.owner)) << 16));
+        combine(hash, static_cast<uint32_t>(enumValue(station.flags)) | (static_cast<uint32_t>(enumValue(station.town)) << 16));
+        combine(hash, static_cast<uint32_t>(station.stationTileSize));
+        for (const auto& cargo : station.cargoStats)
+        {
+            combine(hash, static_cast<uint32_t>(cargo.quantity) | (static_cast<uint32_t>(enumValue(cargo.origin)) << 16));
+            combine(hash, static_cast<uint32_t>(cargo.rating) | (static_cast<uint32_t>(cargo.age) << 8) | (static_cast<uint32_t>(enumValue(cargo.industryId)) << 16));
+        }
+    }
+
+    // Ghost elements only exist on the client that is placing them
+    static void combineTileRow(uint32_t& hash, coord_t y)
+    {
+        for (coord_t x = 0; x < World::kMapColumns; x++)
+        {
+            for (const auto& el : World::TileManager::get(World::TilePos2(x, y)))
+            {
+                if (el.isGhost())
+                {
+                    continue;
+                }
+                combineBytes(hash, el.rawData().data(), World::kTileElementSize);
+            }
+        }
+    }
+
+    bool update(uint32_t tick)
+    {
+        auto& gameState = getGameState();
+        const auto slice = tick % kInterval;
+
+        auto hash = gameState.multiplayerChecksumA;
+        combine(hash, tick);
+        combine(hash, gameState.rng.srand_0());
+        combine(hash, gameState.rng.srand_1());
+        combineEntities(hash, gameState);
+
+        if (slice < Limits::kMaxCompanies)
+        {
+            combineCompany(hash, gameState.companies[slice]);
+        }
+
+        const auto firstStation = slice * kStationsPerTick;
+        for (auto i = firstStation; i < std::min<uint32_t>(firstStation + kStationsPerTick, Limits::kMaxStations); i++)
+        {
+            combineStation(hash, gameState.stations[i]);
+        }
+
+        const auto firstRow = static_cast<coord_t>(slice * kRowsPerTick);
+        for (auto y = firstRow; y < std::min<coord_t>(firstRow + kRowsPerTick, World::kMapRows); y++)
+        {
+            combineTileRow(hash, y);
+        }
+
+        if (slice == kInterval - 1)
+        {
+            gameState.multiplayerChecksumB = hash;
+            gameState.multiplayerChecksumA = 0;
+            return true;
+        }
+
+        gameState.multiplayerChecksumA = hash;
+        return false;
+    }
+
+    uint32_t getLastChecksum()
+    {
+        return getGameState().multiplayerChecksumB;
+    }
+
+    void reset()
+    {
+        auto& gameState = getGameState();
+        gameState.multiplayerChecksumA = 0;
+        gameState.multiplayerChecksumB = 0;
+    }
+}
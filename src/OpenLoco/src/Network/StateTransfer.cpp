@@ -0,0 +1,337 @@
+#include "Network/StateTransfer.h"
+#include "Map/TileManager.h"
+#include "Network/NetworkConnection.h"
+#include "Objects/ObjectManager.h"
+#include "S5/S5.h"
+#include "S5/S5GameState.h"
+#include "S5/S5Options.h"
+#include "S5/S5TileElement.h"
+#include "S5/SawyerStream.h"
+#include <algorithm>
+#include <cstring>
+#include <execution>
+#include <numeric>
+#include <zlib.h>
+
+namespace OpenLoco::Network
+{
+    constexpr uint16_t kChunkSize = 4000;
+
+    // The state is an uncompressed S5 without packed objects followed by the ExtraState, see NetworkServer::exportState.
+    // This counts every chunk the S5 can have at its largest and the tile elements of a full element array.
+    constexpr size_t kSawyerChunkHeaderSize = sizeof(SawyerEncoding) + sizeof(uint32_t);
+    constexpr size_t kMaxStateSize = kSawyerChunkHeaderSize * 8
+        + sizeof(S5::Header) + sizeof(S5::Options) + sizeof(S5::SaveDetails)
+        + sizeof(ObjectHeader) * ObjectManager::kMaxObjects
+        + sizeof(S5::GameState)
+        + sizeof(S5::TileElement) * World::TileManager::kMaxElements
+        + sizeof(uint32_t) // Checksum
+        + sizeof(ExtraState);
+
+#pragma pack(push, 1)
+    struct StatePayloadHeader
+    {
+        snapshot_hash_t hash{};
+        snapshot_hash_t baseHash{};
+        uint32_t dataSize{};
+        uint32_t blockSize{};
+        uint32_t numBlocks{};
+    };
+
+    struct StatePayloadBlock
+    {
+        uint32_t index{};
+        uint32_t size{};
+        uint8_t isCompressed{};
+    };
+#pragma pack(pop)
+
+    // FNV-1a, good enough to tell blocks apart and cheap to compute
+    static snapshot_hash_t hashBytes(std::span<const uint8_t> data, snapshot_hash_t hash = 0xCBF29CE484222325ULL)
+    {
+        for (auto b : data)
+        {
+            hash ^= b;
+            hash *= 0x100000001B3ULL;
+        }
+        return hash;
+    }
+
+    template<typename T>
+    static snapshot_hash_t hashValue(const T& value, snapshot_hash_t hash)
+    {
+        return hashBytes(std::span(reinterpret_cast<const uint8_t*>(&value), sizeof(T)), hash);
+    }
+
+    StateSnapshot::StateSnapshot(std::vector<uint8_t> data)
+        : _data(std::move(data))
+    {
+        _blocks.resize((_data.size() + kBlockSize - 1) / kBlockSize);
+
+        std::vector<uint32_t> indices(_blocks.size());
+        std::iota(indices.begin(), indices.end(), 0);
+        std::for_each(std::execution::par, indices.begin(), indices.end(), [this](uint32_t index) {
+            _blocks[index].hash = hashBytes(getBlockData(index));
+        });
+
+        _hash = hashValue(static_cast<uint32_t>(_data.size()), 0xCBF29CE484222325ULL);
+        for (const auto& block : _blocks)
+        {
+            _hash = hashValue(block.hash, _hash);
+        }
+    }
+
+    snapshot_hash_t StateSnapshot::getHash() const
+    {
+        return _hash;
+    }
+
+    std::span<const uint8_t> StateSnapshot::getData() const
+    {
+        return _data;
+    }
+
+    std::span<const uint8_t> StateSnapshot::getBlockData(size_t index) const
+    {
+        const auto offset = index * kBlockSize;
+        return std::span(_data).subspan(offset, std::min<size_t>(kBlockSize, _data.size() - offset));
+    }
+
+    void StateSnapshot::compressBlocks(std::span<const uint32_t> indices)
+    {
+        std::for_each(std::execution::par, indices.begin(), indices.end(), [this](uint32_t index) {
+            auto& block = _blocks[index];
+            if (!block.compressed.empty())
+            {
+                return;
+            }
+
+            const auto src = getBlockData(index);
+            auto dstLen = compressBound(static_cast<uLong>(src.size()));
+            block.compressed.resize(dstLen);
+            if (compress2(block.compressed.data(), &dstLen, src.data(), static_cast<uLong>(src.size()), Z_BEST_SPEED) == Z_OK)
+            {
+                block.compressed.resize(dstLen);
+                block.isCompressed = true;
+            }
+            else
+            {
+                // Sent as is rather than failing the whole transfer
+                block.compressed.assign(src.begin(), src.end());
+                block.isCompressed = false;
+            }
+        });
+    }
+
+    std::vector<uint8_t> StateSnapshot::encode(const StateSnapshot* base)
+    {
+        std::vector<uint32_t> indices;
+        for (uint32_t i = 0; i < _blocks.size(); i++)
+        {
+            if (base == nullptr || i >= base->_blocks.size() || base->_blocks[i].hash != _blocks[i].hash)
+            {
+                indices.push_back(i);
+            }
+        }
+        compressBlocks(indices);
+
+        StatePayloadHeader header;
+        header.hash = _hash;
+        header.baseHash = base != nullptr ? base->_hash : 0;
+        header.dataSize = static_cast<uint32_t>(_data.size());
+        header.blockSize = kBlockSize;
+        header.numBlocks = static_cast<uint32_t>(indices.size());
+
+        std::vector<uint8_t> payload;
+        auto append = [&payload](const void* src, size_t len) {
+            const auto* bytes = static_cast<const uint8_t*>(src);
+            payload.insert(payload.end(), bytes, bytes + len);
+        };
+
+        append(&header, sizeof(header));
+        for (auto index : indices)
+        {
+            const auto& block = _blocks[index];
+
+            StatePayloadBlock blockHeader;
+            blockHeader.index = index;
+            blockHeader.size = static_cast<uint32_t>(block.compressed.size());
+            blockHeader.isCompressed = block.isCompressed ? 1 : 0;
+            append(&blockHeader, sizeof(blockHeader));
+            append(block.compressed.data(), block.compressed.size());
+        }
+        return payload;
+    }
+
+    std::optional<std::vector<uint8_t>> StateSnapshot::decode(std::span<const uint8_t> payload, const StateSnapshot* base)
+    {
+        StatePayloadHeader header;
+        if (payload.size() < sizeof(header))
+        {
+            return std::nullopt;
+        }
+        std::memcpy(&header, payload.data(), sizeof(header));
+        payload = payload.subspan(sizeof(header));
+
+        if (header.blockSize != kBlockSize || header.dataSize > kMaxStateSize)
+        {
+            return std::nullopt;
+        }
+        if (header.baseHash != 0 && (base == nullptr || base->_hash != header.baseHash))
+        {
+            return std::nullopt;
+        }
+
+        std::vector<uint8_t> data(header.dataSize);
+        if (header.baseHash != 0)
+        {
+            std::copy_n(base->_data.begin(), std::min(base->_data.size(), data.size()), data.begin());
+        }
+
+        for (uint32_t i = 0; i < header.numBlocks; i++)
+        {
+            StatePayloadBlock blockHeader;
+            if (payload.size() < sizeof(blockHeader))
+            {
+                return std::nullopt;
+            }
+            std::memcpy(&blockHeader, payload.data(), sizeof(blockHeader));
+            payload = payload.subspan(sizeof(blockHeader));
+
+            const auto offset = static_cast<size_t>(blockHeader.index) * kBlockSize;
+            if (payload.size() < blockHeader.size || offset >= data.size())
+            {
+                return std::nullopt;
+            }
+
+            auto dstLen = static_cast<uLongf>(std::min<size_t>(kBlockSize, data.size() - offset));
+            const auto expectedLen = dstLen;
+            if (!blockHeader.isCompressed)
+            {
+                if (blockHeader.size != expectedLen)
+                {
+                    return std::nullopt;
+                }
+                std::copy_n(payload.begin(), expectedLen, data.begin() + offset);
+            }
+            else if (uncompress(data.data() + offset, &dstLen, payload.data(), blockHeader.size) != Z_OK || dstLen != expectedLen)
+            {
+                return std::nullopt;
+            }
+            payload = payload.subspan(blockHeader.size);
+        }
+
+        // Verify the result, this catches a stale base that happened to be the wrong size
+        StateSnapshot result(std::move(data));
+        if (result._hash != header.hash)
+        {
+            return std::nullopt;
+        }
+        return std::move(result._data);
+    }
+
+    void sendStatePayload(NetworkConnection& connection, uint32_t cookie, std::span<const uint8_t> payload)
+    {
+        RequestStateResponse response;
+        response.cookie = cookie;
+        response.totalSize = static_cast<uint32_t>(payload.size());
+        response.numChunks = static_cast<uint16_t>((payload.size() + (kChunkSize - 1)) / kChunkSize);
+        connection.sendPacket(response);
+
+        uint32_t offset = 0;
+        uint16_t index = 0;
+        while (index < response.numChunks)
+        {
+            RequestStateResponseChunk chunk;
+            chunk.cookie = cookie;
+            chunk.index = index;
+            chunk.offset = offset;
+            chunk.dataSize = std::min<uint32_t>(kChunkSize, response.totalSize - offset);
+            std::memcpy(chunk.data, payload.data() + offset, chunk.dataSize);
+
+            connection.sendPacket(chunk);
+
+            offset += chunk.dataSize;
+            index++;
+        }
+    }
+
+    void StatePayloadReceiver::reset(uint32_t cookie)
+    {
+        _cookie = cookie;
+        _totalSize = 0;
+        _numChunks = 0;
+        _chunks.clear();
+        _receivedBytes = 0;
+        _receivedChunks = 0;
+    }
+
+    uint32_t StatePayloadReceiver::getCookie() const
+    {
+        return _cookie;
+    }
+
+    uint32_t StatePayloadReceiver::getTotalSize() const
+    {
+        return _totalSize;
+    }
+
+    uint32_t StatePayloadReceiver::getReceivedBytes() const
+    {
+        return _receivedBytes;
+    }
+
+    bool StatePayloadReceiver::isComplete() const
+    {
+        // Chunks may arrive before the response, so wait until we know how many to expect
+        return _numChunks != 0 && _receivedChunks >= _numChunks;
+    }
+
+    void StatePayloadReceiver::receive(const RequestStateResponse& response)
+    {
+        if (response.cookie == _cookie)
+        {
+            _totalSize = response.totalSize;
+            _numChunks = response.numChunks;
+        }
+    }
+
+    bool StatePayloadReceiver::receive(const RequestStateResponseChunk& responseChunk)
+    {
+        if (responseChunk.cookie != _cookie)
+        {
+            return false;
+        }
+
+        if (_chunks.size() <= responseChunk.index)
+        {
+            _chunks.resize(responseChunk.index + 1);
+        }
+
+        auto& rchunk = _chunks[responseChunk.index];
+        if (!rchunk.data.empty())
+        {
+            return false;
+        }
+
+        rchunk.offset = responseChunk.offset;
+        rchunk.data.assign(responseChunk.data, responseChunk.data + responseChunk.dataSize);
+        _receivedChunks++;
+        _receivedBytes += responseChunk.dataSize;
+        return true;
+    }
+
+    std::vector<uint8_t> StatePayloadReceiver::takePayload()
+    {
+        std::vector<uint8_t> payload(_totalSize);
+        for (const auto& chunk : _chunks)
+        {
+            if (chunk.offset + chunk.data.size() <= payload.size())
+            {
+                std::copy(chunk.data.begin(), chunk.data.end(), payload.begin() + chunk.offset);
+            }
+        }
+        reset(0);
+        return payload;
+    }
+}
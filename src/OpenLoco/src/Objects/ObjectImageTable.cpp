@@ -1,11 +1,13 @@
 #include "Objects/ObjectImageTable.h"
 #include "Graphics/Gfx.h"
+#include "Objects/ObjectManager.h"
 #include <OpenLoco/Core/Exception.hpp>
 
 namespace OpenLoco::ObjectManager
 {
     // 0x0050D154
-    static uint32_t _totalNumImages = 0;
+    // Thread local so index loads can count images off the main thread
+    static thread_local uint32_t _totalNumImages = 0;
 
     // 0x0047221F
     ImageTableResult loadImageTable(std::span<const std::byte> data)
@@ -24,6 +26,14 @@ namespace OpenLoco::ObjectManager
         {
             throw Exception::OutOfRange();
         }
+
+        // The G1 is shared so index loads only need the image count
+        if (isIndexObjectLoad())
+        {
+            _totalNumImages += g1Header.numEntries;
+            return res;
+        }
+
         const auto* g32Ptr = reinterpret_cast<const Gfx::G1Element32*>(remainingData.data());
         remainingData = remainingData.subspan(sizeof(Gfx::G1Element32) * g1Header.numEntries);
         // Urgh messy...
@@ -38,8 +38,14 @@
 #include <OpenLoco/Core/Timer.hpp>
 #include <OpenLoco/Diagnostics/Logging.h>
 #include <OpenLoco/Utility/String.hpp>
+#include <algorithm>
 #include <cstdint>
+#include <execution>
 #include <fstream>
+#include <numeric>
+#include <span>
+#include <tuple>
+#include <unordered_map>
 
 using namespace OpenLoco::Diagnostics;
 
@@ -51,45 +57,31 @@ namespace OpenLoco::ObjectManager
     static bool _isFirstTime = false;                                  // 0x0050AEAD
     static std::array<uint16_t, kMaxObjectTypes> _numObjectsPerType{}; // 0x0112C181
 
+    // Installed objects bucketed by a hash of their type and name, see getObjectIndexLookupKey
+    using ObjectIndexLookup = std::unordered_map<size_t, std::vector<ObjectIndexId>>;
+    static ObjectIndexLookup _installedObjectLookup;
+
     static int32_t _objectIndexSelectionRefCount = 0;    // 0x0050D148
     static ObjectIndexSelection _objectIndexSelection{}; // 0x0050D144 & 0x0112C1C5
 
-    static constexpr uint8_t kCurrentIndexVersion = 5;
+    static constexpr uint8_t kCurrentIndexVersion = 6;
     static constexpr uint32_t kMaxStringLength = 1024;
 
-    struct ObjectFolderState
+    // An object file found while scanning the object folders and the index entry loaded from it.
+    // Files are only loaded again when their size or last write time changes.
+    struct ObjectIndexFile
     {
-        uint32_t numObjects = 0;
-        uint32_t totalFileSize = 0;
-        uint32_t dateHash = 0;
-        std::string basePath = "";
+        std::string path; // u8string
+        uint64_t fileSize = 0;
+        int64_t lastWriteTime = 0;
+        std::optional<ObjectIndexEntry> entry; // Empty if the file failed to load
 
-        constexpr bool operator==(const ObjectFolderState& rhs) const
+        bool isSameFile(const ObjectIndexFile& rhs) const
         {
-            return (numObjects == rhs.numObjects) && (totalFileSize == rhs.totalFileSize) && (dateHash == rhs.dateHash) && (basePath == rhs.basePath);
+            return path == rhs.path && fileSize == rhs.fileSize && lastWriteTime == rhs.lastWriteTime;
         }
     };
 
-    struct ObjectFoldersState
-    {
-        ObjectFolderState vanillaInstall;
-        ObjectFolderState install;
-        ObjectFolderState customObjects;
-
-        constexpr bool operator==(const ObjectFoldersState& rhs) const
-        {
-            return (vanillaInstall == rhs.vanillaInstall) && (install == rhs.install) && (customObjects == rhs.customObjects);
-        }
-    };
-
-    struct IndexHeader
-    {
-        uint32_t version;
-        ObjectFoldersState state;
-        uint32_t fileSize;
-        uint32_t numObjects; // duplicates ObjectFolderState.numObjects but without high 1 and includes corrupted .dat's
-    };
-
     // Iterates an objects folder
     // optionally recurses
     // func takes a const fs::directory_entry parameter and returns false to stop iteration
@@ -136,22 +128,26 @@ namespace OpenLoco::ObjectManager
     }
 
     // 0x00470F3C
-    static ObjectFolderState getCurrentObjectFolderState(fs::path path, bool shouldRecurse)
+    static void scanObjectFolder(fs::path path, bool shouldRecurse, std::vector<ObjectIndexFile>& files)
     {
-        ObjectFolderState currentState{};
-
-        currentState.basePath = path.u8string();
-
-        iterateObjectFolder(path, shouldRecurse, [&currentState](const fs::directory_entry& file) {
-            currentState.numObjects++;
-            const auto lastWrite = file.last_write_time().time_since_epoch().count();
-            currentState.dateHash ^= ((lastWrite >> 32) ^ (lastWrite & 0xFFFFFFFF));
-            currentState.dateHash = std::rotr(currentState.dateHash, 5);
-            currentState.totalFileSize += file.file_size();
+        iterateObjectFolder(path, shouldRecurse, [&files](const fs::directory_entry& file) {
+            ObjectIndexFile indexFile{};
+            indexFile.path = file.path().u8string();
+            indexFile.fileSize = file.file_size();
+            indexFile.lastWriteTime = static_cast<int64_t>(file.last_write_time().time_since_epoch().count());
+            files.push_back(std::move(indexFile));
             return true;
         });
+    }
 
-        return currentState;
+    // Files in the order a full build visits them, this order decides which of two duplicates is kept
+    static std::vector<ObjectIndexFile> scanObjectFolders()
+    {
+        std::vector<ObjectIndexFile> files;
+        scanObjectFolder(Environment::getPathNoWarning(Environment::PathId::vanillaObjects), false, files);
+        scanObjectFolder(Environment::getPathNoWarning(Environment::PathId::objects), true, files);
+        scanObjectFolder(Environment::getPathNoWarning(Environment::PathId::customObjects), true, files);
+        return files;
     }
 
     // 0x00471712
@@ -201,35 +197,27 @@ namespace OpenLoco::ObjectManager
         }
     }
 
-    static void serialiseFolderState(Stream& stream, const ObjectFolderState& ofs)
+    static void serialiseFile(Stream& stream, const ObjectIndexFile& file)
     {
-        stream.writeValue(ofs.numObjects);
-        stream.writeValue(ofs.totalFileSize);
-        stream.writeValue(ofs.dateHash);
-
-        stream.writeValue<uint32_t>(static_cast<uint32_t>(ofs.basePath.size()));
-        stream.write(ofs.basePath.data(), ofs.basePath.size());
-    }
+        stream.writeValue<uint32_t>(static_cast<uint32_t>(file.path.size()));
+        stream.write(file.path.data(), file.path.size());
+        stream.writeValue(file.fileSize);
+        stream.writeValue(file.lastWriteTime);
 
-    static void serialiseHeader(Stream& stream, const IndexHeader& header)
-    {
-        stream.writeValue(header.version);
-
-        serialiseFolderState(stream, header.state.vanillaInstall);
-        serialiseFolderState(stream, header.state.install);
-        serialiseFolderState(stream, header.state.customObjects);
-
-        stream.writeValue(header.fileSize);
-        stream.writeValue(header.numObjects);
+        stream.writeValue<uint8_t>(file.entry.has_value() ? 1 : 0);
+        if (file.entry.has_value())
+        {
+            serialiseEntry(stream, *file.entry);
+        }
     }
 
-    static void serialiseIndex(Stream& stream, const IndexHeader& header, const std::vector<ObjectIndexEntry>& entries)
+    static void serialiseIndex(Stream& stream, const std::vector<ObjectIndexFile>& files)
     {
-        serialiseHeader(stream, header);
-        stream.writeValue<uint32_t>(static_cast<uint32_t>(entries.size()));
-        for (auto& entry : entries)
+        stream.writeValue<uint32_t>(kCurrentIndexVersion);
+        stream.writeValue<uint32_t>(static_cast<uint32_t>(files.size()));
+        for (auto& file : files)
         {
-            serialiseEntry(stream, entry);
+            serialiseFile(stream, file);
         }
     }
 
@@ -280,43 +268,32 @@ namespace OpenLoco::ObjectManager
         return entry;
     }
 
-    static ObjectFolderState deserialiseFolderState(Stream& stream)
-    {
-        ObjectFolderState ofs{};
-        ofs.numObjects = stream.readValue<uint32_t>();
-        ofs.totalFileSize = stream.readValue<uint32_t>();
-        ofs.dateHash = stream.readValue<uint32_t>();
-
-        ofs.basePath = deserialiseString(stream);
-        return ofs;
-    }
-
-    static IndexHeader deserialiseHeader(Stream& stream)
+    static ObjectIndexFile deserialiseFile(Stream& stream)
     {
-        IndexHeader header{};
-        header.version = stream.readValue<uint32_t>();
+        ObjectIndexFile file{};
+        file.path = deserialiseString(stream);
+        file.fileSize = stream.readValue<uint64_t>();
+        file.lastWriteTime = stream.readValue<int64_t>();
 
-        header.state.vanillaInstall = deserialiseFolderState(stream);
-        header.state.install = deserialiseFolderState(stream);
-        header.state.customObjects = deserialiseFolderState(stream);
-
-        header.fileSize = stream.readValue<uint32_t>();
-        header.numObjects = stream.readValue<uint32_t>();
-        return header;
+        if (stream.readValue<uint8_t>() != 0)
+        {
+            file.entry = deserialiseEntry(stream);
+        }
+        return file;
     }
 
-    static std::vector<ObjectIndexEntry> deserialiseIndex(Stream& stream)
+    static std::vector<ObjectIndexFile> deserialiseIndex(Stream& stream)
     {
-        std::vector<ObjectIndexEntry> entries;
-        entries.resize(stream.readValue<uint32_t>());
-        for (auto& entry : entries)
+        std::vector<ObjectIndexFile> files;
+        files.resize(stream.readValue<uint32_t>());
+        for (auto& file : files)
         {
-            entry = deserialiseEntry(stream);
+            file = deserialiseFile(stream);
         }
-        return entries;
+        return files;
     }
 
-    static void saveIndex(const IndexHeader& header)
+    static void saveIndex(const std::vector<ObjectIndexFile>& files)
     {
         Core::Timer saveTimer;
 
@@ -328,40 +305,12 @@ namespace OpenLoco::ObjectManager
             Logging::error("Unable to save object index.");
             return;
         }
-        serialiseIndex(stream, header, _installedObjectList);
+        serialiseIndex(stream, files);
 
         Logging::verbose("Saved object index in {} milliseconds.", saveTimer.elapsed());
     }
 
-    static ObjectIndexEntry createPartialNewEntry(const ObjectHeader& objHeader, const fs::path filepath)
-    {
-        ObjectIndexEntry entry{};
-
-        // Header
-        entry._header = objHeader;
-
-        // Filepath
-        entry._filepath = filepath.u8string();
-
-        // Header2 NULL
-        entry._header2.decodedFileSize = std::numeric_limits<uint32_t>::max();
-
-        // Name NULL
-        entry._name = "";
-
-        // Header3 NULL
-        entry._displayData = ObjectHeader3{};
-
-        // ObjectList1
-        entry._alsoLoadObjects.clear();
-
-        // ObjectList2
-        entry._requiredObjects.clear();
-
-        return entry;
-    }
-
-    static ObjectIndexEntry createNewEntry(const ObjectHeader& objHeader, const fs::path filepath, const TempLoadMetaData& metaData)
+    static ObjectIndexEntry createNewEntry(const ObjectHeader& objHeader, const fs::path filepath, const IndexLoadResult& loadResult)
     {
         ObjectIndexEntry entry{};
 
@@ -372,130 +321,160 @@ namespace OpenLoco::ObjectManager
         entry._filepath = filepath.u8string();
 
         // Header2
-        entry._header2 = metaData.fileSizeHeader;
+        entry._header2 = loadResult.metaData.fileSizeHeader;
 
         // Name
-        entry._name = StringManager::getString(0x2000);
+        entry._name = loadResult.name;
 
         // Header3
-        entry._displayData = metaData.displayData;
+        entry._displayData = loadResult.metaData.displayData;
 
         // ObjectList1
-        entry._alsoLoadObjects = metaData.dependentObjects.willLoad;
+        entry._alsoLoadObjects = loadResult.metaData.dependentObjects.willLoad;
 
         // ObjectList2
-        entry._requiredObjects = metaData.dependentObjects.required;
+        entry._requiredObjects = loadResult.metaData.dependentObjects.required;
 
         return entry;
     }
 
-    // Adds a new object to the index by: 1. creating a partial index, 2. validating, 3. creating a full index entry
-    static void addObjectToIndex(const fs::path filepath)
+    // Creates the index entry for an object file by reading the header and then validating and loading the object.
+    // Runs on the index worker threads so must not touch _installedObjectList or anything else shared.
+    static std::optional<ObjectIndexEntry> createEntryForFile(const fs::path& filepath)
     {
-        ObjectHeader objHeader{};
         try
         {
-            FileStream stream;
-            stream.open(filepath, StreamMode::read);
-            if (!stream.isOpen())
+            ObjectHeader objHeader{};
             {
-                Logging::error("Unable to open object index file.");
-                return;
+                FileStream stream;
+                stream.open(filepath, StreamMode::read);
+                if (!stream.isOpen())
+                {
+                    Logging::error("Unable to open object index file.");
+                    return std::nullopt;
+                }
+                objHeader = stream.readValue<ObjectHeader>();
             }
-            objHeader = stream.readValue<ObjectHeader>();
+
+            const auto loadResult = loadObjectForIndex(objHeader, filepath);
+            if (!loadResult.has_value())
+            {
+                Logging::error("Unable to load the object '{}', can't add to index", objHeader.getName());
+                return std::nullopt;
+            }
+
+            // 0x009D1CC8
+            return createNewEntry(objHeader, filepath, loadResult.value());
         }
         catch (const std::runtime_error& ex)
         {
-            Logging::error("Unable to read object index header: {}", ex.what());
-            return;
+            Logging::error("Unable to read object index file: {}", ex.what());
+            return std::nullopt;
         }
+    }
 
-        const auto partialNewEntry = createPartialNewEntry(objHeader, filepath);
-        _installedObjectList.push_back(partialNewEntry);
-
-        const auto loadResult = loadTemporaryObject(objHeader);
-        _installedObjectList.pop_back();
+    // Entries are bucketed by type and name as that is all ObjectHeader::operator== compares for
+    // non custom headers. Each bucket is in index order so the first match is the one a linear search finds.
+    static size_t getObjectIndexLookupKey(const ObjectHeader& objHeader)
+    {
+        return std::hash<std::string_view>{}(objHeader.getName()) ^ enumValue(objHeader.getType());
+    }
 
-        if (!loadResult.has_value())
+    static std::optional<ObjectIndexId> findInObjectIndexLookup(const ObjectIndexLookup& lookup, const ObjectHeader& objHeader)
+    {
+        auto bucket = lookup.find(getObjectIndexLookupKey(objHeader));
+        if (bucket == lookup.end())
         {
-            Logging::error("Unable to load the object '{}', can't add to index", objHeader.getName());
-            return;
+            return std::nullopt;
         }
+        for (const auto index : bucket->second)
+        {
+            if (_installedObjectList[index]._header == objHeader)
+            {
+                return index;
+            }
+        }
+        return std::nullopt;
+    }
 
-        // Load full entry into temp buffer.
-        // 0x009D1CC8
-        const auto newEntry = createNewEntry(objHeader, filepath, loadResult.value());
-
-        freeTemporaryObject();
+    static void rebuildObjectIndexLookup()
+    {
+        _installedObjectLookup.clear();
+        for (ObjectIndexId i = 0; i < static_cast<int16_t>(_installedObjectList.size()); i++)
+        {
+            _installedObjectLookup[getObjectIndexLookupKey(_installedObjectList[i]._header)].push_back(i);
+        }
+    }
 
-        auto duplicate = std::ranges::find(_installedObjectList, objHeader, &ObjectIndexEntry::_header);
-        if (duplicate != _installedObjectList.end())
+    static void addEntryToIndex(const ObjectIndexEntry& entry, ObjectIndexLookup& lookup, bool logDuplicates)
+    {
+        const auto duplicate = findInObjectIndexLookup(lookup, entry._header);
+        if (duplicate.has_value())
         {
-            Logging::error("Duplicate object found {}, {} won't be added to index", duplicate->_filepath, newEntry._filepath);
+            if (logDuplicates)
+            {
+                Logging::error("Duplicate object found {}, {} won't be added to index", _installedObjectList[*duplicate]._filepath, entry._filepath);
+            }
             return;
         }
-        _installedObjectList.push_back(newEntry); // Previously ordered by name...
+        lookup[getObjectIndexLookupKey(entry._header)].push_back(static_cast<ObjectIndexId>(_installedObjectList.size()));
+        _installedObjectList.push_back(entry); // Previously ordered by name...
     }
 
-    static void addObjectsInFolder(fs::path path, bool shouldRecurse, uint32_t numObjects)
+    // Number of files loaded in parallel between progress updates
+    static constexpr size_t kIndexBatchSize = 256;
+
+    static void loadObjectFiles(std::span<ObjectIndexFile* const> files)
     {
         uint8_t progress = 0; // Progress is used for the ProgressBar Ui element
-        uint32_t i = 0;
-        iterateObjectFolder(path, shouldRecurse, [&i, &numObjects, &progress](const fs::directory_entry& file) {
+        for (size_t batchStart = 0; batchStart < files.size(); batchStart += kIndexBatchSize)
+        {
             Input::processMessagesMini();
-            i++;
+
+            const auto batch = files.subspan(batchStart, std::min(kIndexBatchSize, files.size() - batchStart));
+            std::for_each(std::execution::par, batch.begin(), batch.end(), [](ObjectIndexFile* file) {
+                file->entry = createEntryForFile(fs::u8path(file->path));
+            });
 
             // Cheap calculation of (curObjectCount / totalObjectCount) * 256
-            const auto newProgress = (i << 8) / ((numObjects & 0xFFFFFF) + 1);
+            const auto i = static_cast<uint32_t>(batchStart + batch.size());
+            const auto newProgress = (i << 8) / ((files.size() & 0xFFFFFF) + 1);
             if (progress != newProgress)
             {
                 progress = newProgress;
                 Ui::ProgressBar::setProgress(newProgress);
             }
-
-            // For now there are a few places that assume there are int16_t max items
-            if (_installedObjectList.size() >= static_cast<size_t>(std::numeric_limits<ObjectIndexId>::max()))
-            {
-                return false;
-            }
-            addObjectToIndex(file.path());
-            return true;
-        });
+        }
     }
 
-    // 0x0047118B
-    static void createIndex(const ObjectFoldersState& currentState)
+    // Rebuilds the installed object list from the indexed files. Entries are added in file
+    // order so duplicates resolve the same way regardless of which files were loaded again.
+    static void buildInstalledObjectList(const std::vector<ObjectIndexFile>& files, bool logDuplicates)
     {
-        Input::processMessagesMini();
-        const auto progressString = _isFirstTime ? StringIds::starting_for_the_first_time : StringIds::checking_object_files;
-        Ui::ProgressBar::begin(progressString);
-
-        // Reset
-        reloadAll();
         _installedObjectList.clear();
 
-        // Create new index by iterating all DAT files and processing
-        IndexHeader header{};
-        header.version = kCurrentIndexVersion;
-        const auto vanillaObjectPath = Environment::getPathNoWarning(Environment::PathId::vanillaObjects);
-        addObjectsInFolder(vanillaObjectPath, false, currentState.vanillaInstall.numObjects);
-        const auto objectPath = Environment::getPathNoWarning(Environment::PathId::objects);
-        addObjectsInFolder(objectPath, true, currentState.install.numObjects);
-        const auto customObjectPath = Environment::getPathNoWarning(Environment::PathId::customObjects);
-        addObjectsInFolder(customObjectPath, true, currentState.customObjects.numObjects);
-        std::ranges::sort(_installedObjectList, {}, [](const auto& entry) { return entry._name; });
-
-        // New index creation completed. Reset and save result.
-        reloadAll();
-        header.fileSize = 0;
-        header.numObjects = static_cast<uint32_t>(_installedObjectList.size());
-        header.state = currentState;
-        saveIndex(header);
+        ObjectIndexLookup lookup;
+        for (const auto& file : files)
+        {
+            // For now there are a few places that assume there are int16_t max items
+            if (_installedObjectList.size() >= static_cast<size_t>(std::numeric_limits<ObjectIndexId>::max()))
+            {
+                break;
+            }
+            if (file.entry.has_value())
+            {
+                addEntryToIndex(*file.entry, lookup, logDuplicates);
+            }
+        }
 
-        Ui::ProgressBar::end();
+        // Objects can share a name, so fall back to the (unique) path to make the order independent of load order
+        std::ranges::sort(_installedObjectList, [](const auto& lhs, const auto& rhs) {
+            return std::tie(lhs._name, lhs._filepath) < std::tie(rhs._name, rhs._filepath);
+        });
+        rebuildObjectIndexLookup();
     }
 
-    static bool tryLoadIndex(const ObjectFoldersState& currentState)
+    static std::vector<ObjectIndexFile> tryLoadIndex()
     {
         Core::Timer loadTimer;
 
@@ -503,62 +482,83 @@ namespace OpenLoco::ObjectManager
         if (!fs::exists(indexPath))
         {
             Logging::verbose("Object index does not exist.");
-            return false;
+            return {};
         }
         FileStream stream;
         stream.open(indexPath, StreamMode::read);
         if (!stream.isOpen())
         {
             Logging::error("Unable to load the object index.");
-            return false;
+            return {};
         }
 
         try
         {
-            auto header = deserialiseHeader(stream);
-            if (header.version != kCurrentIndexVersion || header.state != currentState)
+            if (stream.readValue<uint32_t>() != kCurrentIndexVersion)
             {
-                return false;
-            }
-            else
-            {
-                _installedObjectList = deserialiseIndex(stream);
-                if (_installedObjectList.empty())
-                {
-                    return false;
-                }
-                Logging::verbose("Loaded object index in {} milliseconds.", loadTimer.elapsed());
+                return {};
             }
+            auto files = deserialiseIndex(stream);
+            Logging::verbose("Loaded object index in {} milliseconds.", loadTimer.elapsed());
+            return files;
         }
         catch (const std::runtime_error& ex)
         {
             Logging::error("Unable to load the object index: {}", ex.what());
-            return false;
+            return {};
         }
-
-        reloadAll();
-
-        return true;
     }
 
     // 0x00470F3C
     void loadIndex()
     {
-        // 0x00112A138 -> 144
-        const auto vanillaObjectPath = Environment::getPathNoWarning(Environment::PathId::vanillaObjects);
-        const auto vanillaState = getCurrentObjectFolderState(vanillaObjectPath, false);
-        const auto objectPath = Environment::getPathNoWarning(Environment::PathId::objects);
-        const auto objectState = getCurrentObjectFolderState(objectPath, true);
-        const auto customObjectPath = Environment::getPathNoWarning(Environment::PathId::customObjects);
-        const auto customState = getCurrentObjectFolderState(customObjectPath, true);
+        auto files = scanObjectFolders();
 
-        const auto currentState = ObjectFoldersState{ vanillaState, objectState, customState };
+        // Carry over the entries of files that haven't changed since the index was saved
+        const auto indexedFiles = tryLoadIndex();
+        std::unordered_map<std::string_view, const ObjectIndexFile*> indexedFilesByPath;
+        for (const auto& indexedFile : indexedFiles)
+        {
+            indexedFilesByPath.emplace(indexedFile.path, &indexedFile);
+        }
 
-        if (!tryLoadIndex(currentState))
+        std::vector<ObjectIndexFile*> changedFiles;
+        for (auto& file : files)
         {
-            createIndex(currentState);
+            auto indexedFile = indexedFilesByPath.find(file.path);
+            if (indexedFile != indexedFilesByPath.end() && indexedFile->second->isSameFile(file))
+            {
+                file.entry = indexedFile->second->entry;
+            }
+            else
+            {
+                changedFiles.push_back(&file);
+            }
+        }
+
+        const auto hasChanged = !changedFiles.empty() || files.size() != indexedFiles.size();
+        if (!changedFiles.empty())
+        {
+            // 0x0047118B
+            _isFirstTime = indexedFiles.empty();
+            Input::processMessagesMini();
+            const auto progressString = _isFirstTime ? StringIds::starting_for_the_first_time : StringIds::checking_object_files;
+            Ui::ProgressBar::begin(progressString);
+
+            Logging::verbose("Indexing {} new or changed object files.", changedFiles.size());
+            loadObjectFiles(changedFiles);
+
+            Ui::ProgressBar::end();
+        }
+
+        buildInstalledObjectList(files, hasChanged);
+        if (hasChanged)
+        {
+            saveIndex(files);
         }
 
+        reloadAll();
+
         _customObjectsInIndex = hasCustomObjectsInIndex();
     }
 
@@ -594,12 +594,12 @@ namespace OpenLoco::ObjectManager
 
     static std::optional<ObjIndexPair> internalFindObjectInIndex(const ObjectHeader& objectHeader)
     {
-        auto res = std::ranges::find(_installedObjectList, objectHeader, &ObjectIndexEntry::_header);
-        if (res == std::end(_installedObjectList))
+        const auto index = findInObjectIndexLookup(_installedObjectLookup, objectHeader);
+        if (!index.has_value())
         {
             return std::nullopt;
         }
-        return ObjIndexPair{ static_cast<ObjectIndexId>(std::distance(std::begin(_installedObjectList), res)), *res };
+        return ObjIndexPair{ *index, _installedObjectList[*index] };
     }
 
     std::optional<ObjectIndexEntry> findObjectInIndex(const ObjectHeader& objectHeader)
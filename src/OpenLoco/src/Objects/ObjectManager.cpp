@@ -1,5 +1,6 @@
 #include "Objects/ObjectManager.h"
 #include "Date.h"
+#include "Effects/ParticleManager.h"
 #include "Environment.h"
 #include "GameState.h"
 #include "Graphics/Colour.h"
@@ -61,6 +62,7 @@
 #include <OpenLoco/Core/Timer.hpp>
 #include <OpenLoco/Core/Traits.hpp>
 #include <bit>
+#include <memory>
 #include <vector>
 
 using namespace OpenLoco::Diagnostics;
@@ -125,7 +127,9 @@ namespace OpenLoco::ObjectManager
     static std::array<LandObjectFlags, getMaxObjects(ObjectType::land)> _landObjectFlags; // 0x00F003D3
 
     // 0x0050D160
-    static bool _isTemporaryObject = false;
+    // Thread local as the object index is built on several threads, see loadObjectForIndex
+    static thread_local bool _isTemporaryObject = false;
+    static thread_local bool _isIndexObjectLoad = false;
     // 0x0050D15C
     static Object* _temporaryObject = nullptr;
 
@@ -420,16 +424,9 @@ namespace OpenLoco::ObjectManager
         ObjectHeader header;
     };
 
-    static std::optional<PreLoadedObject> findAndPreLoadObject(const ObjectHeader& header)
+    // Reads, checksums and validates the object file into Loco freeable memory
+    static std::optional<PreLoadedObject> preLoadObjectFile(const fs::path& filePath, const ObjectHeader& header)
     {
-        auto installedObject = findObjectInIndex(header);
-        if (!installedObject.has_value())
-        {
-            return std::nullopt;
-        }
-
-        const auto filePath = fs::u8path(installedObject->_filepath);
-
         FileStream fs(filePath, StreamMode::read);
         SawyerStreamReader stream(fs);
         PreLoadedObject preLoadObj{};
@@ -482,6 +479,72 @@ namespace OpenLoco::ObjectManager
         return preLoadObj;
     }
 
+    static std::optional<PreLoadedObject> findAndPreLoadObject(const ObjectHeader& header)
+    {
+        auto installedObject = findObjectInIndex(header);
+        if (!installedObject.has_value())
+        {
+            return std::nullopt;
+        }
+
+        return preLoadObjectFile(fs::u8path(installedObject->_filepath), header);
+    }
+
+    // Marks this thread as loading a temporary object and gives it a fresh image count. Both are restored
+    // however the load ends, a pool thread left marked would treat every later load on it as temporary.
+    class TemporaryLoadScope
+    {
+    private:
+        uint32_t _oldNumImages;
+
+    public:
+        explicit TemporaryLoadScope(bool isIndexLoad)
+            : _oldNumImages(getTotalNumImages())
+        {
+            setTotalNumImages(Gfx::G1ExpectedCount::kDisc);
+            _isTemporaryObject = true;
+            _isIndexObjectLoad = isIndexLoad;
+        }
+
+        TemporaryLoadScope(const TemporaryLoadScope&) = delete;
+        TemporaryLoadScope& operator=(const TemporaryLoadScope&) = delete;
+
+        ~TemporaryLoadScope()
+        {
+            if (_isIndexObjectLoad)
+            {
+                // Drop the name of a load that did not finish so it can't be taken by the next one
+                takeIndexObjectName();
+            }
+            _isTemporaryObject = false;
+            _isIndexObjectLoad = false;
+            setTotalNumImages(_oldNumImages);
+        }
+    };
+
+    static TempLoadMetaData getTemporaryLoadMetaData(const PreLoadedObject& preLoadObj, uint32_t numImages, DependentObjects&& dependencies)
+    {
+        TempLoadMetaData result{};
+        result.fileSizeHeader.decodedFileSize = static_cast<uint32_t>(preLoadObj.objectData.size());
+        result.displayData.numImages = numImages;
+        result.dependentObjects = std::move(dependencies);
+
+        if (preLoadObj.header.getType() == ObjectType::competitor)
+        {
+            auto* competitor = reinterpret_cast<CompetitorObject*>(preLoadObj.object);
+            result.displayData.aggressiveness = competitor->aggressiveness;
+            result.displayData.competitiveness = competitor->competitiveness;
+            result.displayData.intelligence = competitor->intelligence;
+        }
+        else if (preLoadObj.header.getType() == ObjectType::vehicle)
+        {
+            auto* vehicle = reinterpret_cast<VehicleObject*>(preLoadObj.object);
+            result.displayData.vehicleSubType = enumValue(vehicle->type);
+        }
+
+        return result;
+    }
+
     // 0x0047176D
     // TODO: Return a std::unique_ptr and a ObjectHeader3 & ObjectHeader2 for the metadata
     std::optional<TempLoadMetaData> loadTemporaryObject(const ObjectHeader& header)
@@ -492,11 +555,8 @@ namespace OpenLoco::ObjectManager
             return std::nullopt;
         }
 
-        const uint32_t oldNumImages = getTotalNumImages();
-        setTotalNumImages(Gfx::G1ExpectedCount::kDisc);
-
         _temporaryObject = preLoadObj->object;
-        _isTemporaryObject = true;
+        TemporaryLoadScope loadScope(false);
 
         DependentObjects dependencies;
         try
@@ -506,33 +566,38 @@ namespace OpenLoco::ObjectManager
         catch (Exception::OutOfRange&) // catches the ImageTable incorrectly sized which can cause bad crashes
         {
             freeTemporaryObject();
-            _isTemporaryObject = false;
             return std::nullopt;
         }
-        _isTemporaryObject = false;
 
         const auto numImages = getTotalNumImages() - Gfx::G1ExpectedCount::kDisc;
-        setTotalNumImages(oldNumImages);
+        return getTemporaryLoadMetaData(*preLoadObj, numImages, std::move(dependencies));
+    }
 
-        TempLoadMetaData result{};
-        result.fileSizeHeader.decodedFileSize = static_cast<uint32_t>(preLoadObj->objectData.size());
-        result.displayData.numImages = numImages;
-        result.dependentObjects = dependencies;
+    std::optional<IndexLoadResult> loadObjectForIndex(const ObjectHeader& header, const fs::path& filePath)
+    {
+        auto preLoadObj = preLoadObjectFile(filePath, header);
+        if (!preLoadObj.has_value())
+        {
+            return std::nullopt;
+        }
+        const std::unique_ptr<Object, decltype(&free)> object(preLoadObj->object, &free);
 
-        if (header.getType() == ObjectType::competitor)
+        // Image tables are only counted and the name is copied out rather than swapped
+        // into the string table, this leaves nothing shared between threads.
+        TemporaryLoadScope loadScope(true);
+
+        DependentObjects dependencies;
+        try
         {
-            auto* competitor = reinterpret_cast<CompetitorObject*>(preLoadObj->object);
-            result.displayData.aggressiveness = competitor->aggressiveness;
-            result.displayData.competitiveness = competitor->competitiveness;
-            result.displayData.intelligence = competitor->intelligence;
+            callObjectLoad({ preLoadObj->header.getType(), 0 }, *preLoadObj->object, preLoadObj->objectData, &dependencies);
         }
-        else if (header.getType() == ObjectType::vehicle)
+        catch (Exception::OutOfRange&) // catches the ImageTable incorrectly sized which can cause bad crashes
         {
-            auto* vehicle = reinterpret_cast<VehicleObject*>(preLoadObj->object);
-            result.displayData.vehicleSubType = enumValue(vehicle->type);
+            return std::nullopt;
         }
 
-        return result;
+        const auto numImages = getTotalNumImages() - Gfx::G1ExpectedCount::kDisc;
+        return IndexLoadResult{ takeIndexObjectName(), getTemporaryLoadMetaData(*preLoadObj, numImages, std::move(dependencies)) };
     }
 
     Object* getTemporaryObject()
@@ -546,6 +611,11 @@ namespace OpenLoco::ObjectManager
         return _isTemporaryObject;
     }
 
+    bool isIndexObjectLoad()
+    {
+        return _isIndexObjectLoad;
+    }
+
     // 0x00471BC5
     static bool load(const ObjectHeader& header, LoadedObjectId id)
     {
@@ -596,6 +666,12 @@ namespace OpenLoco::ObjectManager
         unload(*handle);
         free(_objectRepository[enumValue(handle->type)].objects[handle->id]);
         _objectRepository[enumValue(handle->type)].objects[handle->id] = nullptr;
+
+        // Exhaust particles refer to their steam object by id
+        if (handle->type == ObjectType::steam)
+        {
+            ParticleManager::reset();
+        }
     }
 
     // 0x00471BCE
@@ -4,6 +4,7 @@
 #include "Localisation/StringIds.h"
 #include "Localisation/StringManager.h"
 #include "Objects/ObjectManager.h"
+#include <utility>
 
 namespace OpenLoco::ObjectManager
 {
@@ -26,6 +27,9 @@ namespace OpenLoco::ObjectManager
         StringIds::temporary_object_load_str_15,
     };
 
+    // Index loads run on several threads so the name is kept here rather than in the string table
+    static thread_local std::string _indexObjectName;
+
     constexpr std::array<uint8_t, 34> kNumStringsPerObjectType = {
         1, // interface,
         1, // sound,
@@ -108,6 +112,16 @@ namespace OpenLoco::ObjectManager
             return anyStr;
         }();
 
+        if (isIndexObjectLoad())
+        {
+            res.str = kTemporaryObjectStringIds[index];
+            if (index == 0 && chosenStr != nullptr)
+            {
+                _indexObjectName = chosenStr;
+            }
+            return res;
+        }
+
         if (isTemporaryObjectLoad())
         {
             res.str = kTemporaryObjectStringIds[index];
@@ -125,4 +139,9 @@ namespace OpenLoco::ObjectManager
         StringManager::swapString(res.str, chosenStr);
         return res;
     }
+
+    std::string takeIndexObjectName()
+    {
+        return std::exchange(_indexObjectName, {});
+    }
 }
@@ -56,10 +56,14 @@ namespace OpenLoco
         auto imgRes = ObjectManager::loadImageTable(remainingData);
         baseImageId = imgRes.imageOffset;
 
-        auto imageExtents = Gfx::getImagesMaxExtent(ImageId(baseImageId), numImages);
-        spriteWidth = imageExtents.width;
-        spriteHeightNegative = imageExtents.heightNegative;
-        spriteHeightPositive = imageExtents.heightPositive;
+        // Index loads don't populate the G1 and can't use the drawing context off the main thread
+        if (!ObjectManager::isIndexObjectLoad())
+        {
+            auto imageExtents = Gfx::getImagesMaxExtent(ImageId(baseImageId), numImages);
+            spriteWidth = imageExtents.width;
+            spriteHeightNegative = imageExtents.heightNegative;
+            spriteHeightPositive = imageExtents.heightPositive;
+        }
 
         assert(remainingData.size() == imgRes.tableLength);
     }
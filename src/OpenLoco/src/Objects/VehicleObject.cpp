@@ -543,10 +543,14 @@ namespace OpenLoco
             const auto numImages = imgRes.imageOffset + offset - bodySprite.flatImageId;
             if (bodySprite.flatImageId + numImages <= ObjectManager::getTotalNumImages())
             {
-                const auto extents = Gfx::getImagesMaxExtent(ImageId(bodySprite.flatImageId), numImages);
-                bodySprite.width = extents.width;
-                bodySprite.heightNegative = extents.heightNegative;
-                bodySprite.heightPositive = extents.heightPositive;
+                // Index loads don't populate the G1 and can't use the drawing context off the main thread
+                if (!ObjectManager::isIndexObjectLoad())
+                {
+                    const auto extents = Gfx::getImagesMaxExtent(ImageId(bodySprite.flatImageId), numImages);
+                    bodySprite.width = extents.width;
+                    bodySprite.heightNegative = extents.heightNegative;
+                    bodySprite.heightPositive = extents.heightPositive;
+                }
             }
             else
             {
@@ -588,10 +592,13 @@ namespace OpenLoco
             const auto numImages = imgRes.imageOffset + offset - bogieSprite.flatImageIds;
             if (bogieSprite.flatImageIds + numImages <= ObjectManager::getTotalNumImages())
             {
-                const auto extents = Gfx::getImagesMaxExtent(ImageId(bogieSprite.flatImageIds), numImages);
-                bogieSprite.width = extents.width;
-                bogieSprite.heightNegative = extents.heightNegative;
-                bogieSprite.heightPositive = extents.heightPositive;
+                if (!ObjectManager::isIndexObjectLoad())
+                {
+                    const auto extents = Gfx::getImagesMaxExtent(ImageId(bogieSprite.flatImageIds), numImages);
+                    bogieSprite.width = extents.width;
+                    bogieSprite.heightNegative = extents.heightNegative;
+                    bogieSprite.heightPositive = extents.heightPositive;
+                }
             }
             else
             {
@@ -50,6 +50,7 @@
 #include "Tutorial.h"
 #include "Ui.h"
 #include "Ui/ProgressBar.h"
+#include "Ui/Screenshot.h"
 #include "Ui/ToolTip.h"
 #include "Ui/WindowManager.h"
 #include "Vehicles/Vehicle.h"
@@ -380,7 +381,9 @@ namespace OpenLoco
 
     static void fixedUpdate()
     {
+        // Switching over from variable updates, put everything back where the last tick left it
         auto& tweener = EntityTweener::get();
+        tweener.restore();
         tweener.reset();
 
         if (_accumulator < UpdateTime)
@@ -428,7 +431,8 @@ namespace OpenLoco
         return _numFrameUpdates;
     }
 
-    void simulateGame(const fs::path& savePath, int32_t ticks)
+    // Loads a save without creating a window, used by the command line actions
+    static bool loadGameHeadless(const fs::path& savePath)
     {
         try
         {
@@ -440,10 +444,15 @@ namespace OpenLoco
         }
         catch (const std::exception& e)
         {
-            Logging::error("Unable to simulate park: {}", e.what());
+            Logging::error("Unable to load park: {}", e.what());
         }
 
-        if (SceneManager::getCurrentScene() != SceneManager::SceneId::gameplay)
+        return SceneManager::getCurrentScene() == SceneManager::SceneId::gameplay;
+    }
+
+    void simulateGame(const fs::path& savePath, int32_t ticks)
+    {
+        if (!loadGameHeadless(savePath))
         {
             Logging::error("Unable to simulate park!");
             return;
@@ -462,4 +471,24 @@ namespace OpenLoco
         }
     }
 
+    bool screenshotGame(const fs::path& savePath, const fs::path& outputPath, int8_t zoomLevel)
+    {
+        if (!loadGameHeadless(savePath))
+        {
+            Logging::error("Unable to screenshot park!");
+            return false;
+        }
+
+        try
+        {
+            Ui::saveGiantScreenshot(outputPath, ZoomLevel{ zoomLevel });
+        }
+        catch (const std::exception& e)
+        {
+            Logging::error("Unable to save screenshot: {}", e.what());
+            return false;
+        }
+        return true;
+    }
+
 }
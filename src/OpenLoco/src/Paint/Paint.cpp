@@ -78,10 +78,11 @@ namespace OpenLoco::Paint
         return screenToWorldCeil(_zoom, _renderTarget->y + _renderTarget->height) - getWorldY();
     }
 
-    void PaintSession::setEntityPosition(const World::Pos2& pos)
+    void PaintSession::setEntityPosition(const World::Pos2& pos, coord_t heightOffset)
     {
         _spritePositionX = pos.x;
         _spritePositionY = pos.y;
+        _spriteHeightOffset = heightOffset;
     }
     void PaintSession::setMapPosition(const World::Pos2& pos)
     {
@@ -202,7 +203,7 @@ namespace OpenLoco::Paint
         FormatArguments fmtArgs{ psString->argsBuf };
         fmtArgs.push(amount);
 
-        const auto& vpPos = World::gameToScreen(World::Pos3(getSpritePosition(), z), currentRotation);
+        const auto& vpPos = World::gameToScreen(World::Pos3(getSpritePosition(), z + _spriteHeightOffset), currentRotation);
         psString->vpPos.x = vpPos.x + xOffset;
         psString->vpPos.y = vpPos.y;
 
@@ -604,7 +605,7 @@ namespace OpenLoco::Paint
 
         const auto swappedRotation = directionFlipXAxis(currentRotation);
         auto swappedRotCoord = World::Pos3{ Math::Vector::rotate(offset, swappedRotation), offset.z };
-        swappedRotCoord += World::Pos3{ getSpritePosition(), 0 };
+        swappedRotCoord += World::Pos3{ getSpritePosition(), _spriteHeightOffset };
 
         const auto vpPos = World::gameToScreen(swappedRotCoord, currentRotation);
 
@@ -625,8 +626,8 @@ namespace OpenLoco::Paint
         const auto spritePos = getSpritePosition();
         ps->imageId = imageId;
         ps->vpPos = { vpPos.x, vpPos.y };
-        ps->bounds.mins = rotBoundBoxOffset + World::Pos3{ spritePos.x, spritePos.y, 0 };
-        ps->bounds.maxs = rotBoundBoxOffset + rotBoundBoxSize + World::Pos3{ spritePos.x, spritePos.y, 0 };
+        ps->bounds.mins = rotBoundBoxOffset + World::Pos3{ spritePos.x, spritePos.y, _spriteHeightOffset };
+        ps->bounds.maxs = rotBoundBoxOffset + rotBoundBoxSize + World::Pos3{ spritePos.x, spritePos.y, _spriteHeightOffset };
         ps->flags = PaintStructFlags::none;
         ps->attachedPS = nullptr;
         ps->children = nullptr;
@@ -13,6 +13,7 @@
 #include "Graphics/RenderTarget.h"
 #include "Localisation/StringIds.h"
 #include "Map/Tile.h"
+#include "Objects/ObjectManager.h"
 #include "Objects/SteamObject.h"
 #include "Paint/Paint.h"
 #include "World/CompanyManager.h"
@@ -50,24 +51,28 @@ namespace OpenLoco::Paint
     // clang-format on
 
     // 0x00440331
-    static void paintExhaustEntity(PaintSession& session, Exhaust* exhaustEntity)
+    static void paintExhaust(PaintSession& session, uint8_t objectId, uint16_t frameNum, coord_t z)
     {
         if (session.getZoom() > 1)
         {
             return;
         }
-        const auto* steamObject = exhaustEntity->getObject();
+        const auto* steamObject = ObjectManager::get<SteamObject>(objectId & 0x7F);
+        if (steamObject == nullptr)
+        {
+            return;
+        }
 
-        const auto& frameInfo = steamObject->getFramesInfo(exhaustEntity->isSubObjType1());
-        const auto imageId = ImageId{ frameInfo.second[exhaustEntity->frameNum].imageOffset + steamObject->baseImageId + steamObject->var_0A };
+        const auto& frameInfo = steamObject->getFramesInfo(objectId & (1 << 7));
+        const auto imageId = ImageId{ frameInfo.second[frameNum].imageOffset + steamObject->baseImageId + steamObject->var_0A };
 
         if (!steamObject->hasFlags(SteamObjectFlags::unk3))
         {
-            session.addToPlotListAsParent(imageId, { 0, 0, exhaustEntity->position.z }, { 1, 1, 0 });
+            session.addToPlotListAsParent(imageId, { 0, 0, z }, { 1, 1, 0 });
         }
         else
         {
-            session.addToPlotListAsParent(imageId, { 0, 0, exhaustEntity->position.z }, { -12, -12, exhaustEntity->position.z }, { 24, 24, 0 });
+            session.addToPlotListAsParent(imageId, { 0, 0, z }, { -12, -12, z }, { 24, 24, 0 });
         }
     }
 
@@ -164,7 +169,7 @@ namespace OpenLoco::Paint
     }
 
     // 0x00440557
-    static void paintSplashEntity(PaintSession& session, Splash* particle)
+    static void paintSplash(PaintSession& session, uint16_t frame, coord_t z)
     {
         if (session.getZoom() > 2)
         {
@@ -202,9 +207,9 @@ namespace OpenLoco::Paint
             ImageIds::splash_27
         };
 
-        assert(static_cast<size_t>(particle->frame / 256) < kSplashImageIds.size());
-        const auto imageId = ImageId{ kSplashImageIds.at(particle->frame / 256) };
-        session.addToPlotListAsParent(imageId, { 0, 0, particle->position.z }, { 1, 1, 0 });
+        assert(static_cast<size_t>(frame / 256) < kSplashImageIds.size());
+        const auto imageId = ImageId{ kSplashImageIds.at(frame / 256) };
+        session.addToPlotListAsParent(imageId, { 0, 0, z }, { 1, 1, 0 });
     }
 
     // 0x00440592
@@ -255,7 +260,7 @@ namespace OpenLoco::Paint
     }
 
     // 0x004404A6
-    static void paintExplosionSmokeEntity(PaintSession& session, ExplosionSmoke* particle)
+    static void paintExplosionSmoke(PaintSession& session, uint16_t frame, coord_t z)
     {
         if (session.getZoom() > 1)
         {
@@ -275,13 +280,13 @@ namespace OpenLoco::Paint
             ImageIds::explosion_smoke_09
         };
 
-        assert(static_cast<size_t>(particle->frame / 256) < kExplosionSmokeImageIds.size());
-        const auto imageId = ImageId{ kExplosionSmokeImageIds.at(particle->frame / 256) };
-        session.addToPlotListAsParent(imageId, { 0, 0, particle->position.z }, { 1, 1, 0 });
+        assert(static_cast<size_t>(frame / 256) < kExplosionSmokeImageIds.size());
+        const auto imageId = ImageId{ kExplosionSmokeImageIds.at(frame / 256) };
+        session.addToPlotListAsParent(imageId, { 0, 0, z }, { 1, 1, 0 });
     }
 
     // 0x004404E1
-    static void paintSmokeEntity(PaintSession& session, Smoke* particle)
+    static void paintSmoke(PaintSession& session, uint16_t frame, coord_t z)
     {
         if (session.getZoom() > 1)
         {
@@ -303,9 +308,9 @@ namespace OpenLoco::Paint
             ImageIds::smoke_11
         };
 
-        assert(static_cast<size_t>(particle->frame / 256) < kSmokeImageIds.size());
-        const auto imageId = ImageId{ kSmokeImageIds.at(particle->frame / 256) };
-        session.addToPlotListAsParent(imageId, { 0, 0, particle->position.z }, { 1, 1, 0 });
+        assert(static_cast<size_t>(frame / 256) < kSmokeImageIds.size());
+        const auto imageId = ImageId{ kSmokeImageIds.at(frame / 256) };
+        session.addToPlotListAsParent(imageId, { 0, 0, z }, { 1, 1, 0 });
     }
 
     // 0x00440325
@@ -315,7 +320,8 @@ namespace OpenLoco::Paint
         {
             case EffectType::exhaust: // 0
             {
-                paintExhaustEntity(session, base->asExhaust());
+                auto* exhaust = base->asExhaust();
+                paintExhaust(session, exhaust->objectId, exhaust->frameNum, exhaust->position.z);
                 break;
             }
 
@@ -345,7 +351,7 @@ namespace OpenLoco::Paint
 
             case EffectType::splash: // 5
             {
-                paintSplashEntity(session, base->asSplash());
+                paintSplash(session, base->asSplash()->frame, base->position.z);
                 break;
             }
 
@@ -357,13 +363,43 @@ namespace OpenLoco::Paint
 
             case EffectType::explosionSmoke: // 7
             {
-                paintExplosionSmokeEntity(session, base->asExplosionSmoke());
+                paintExplosionSmoke(session, base->asExplosionSmoke()->frame, base->position.z);
                 break;
             }
 
             case EffectType::smoke: // 8
             {
-                paintSmokeEntity(session, base->asSmoke());
+                paintSmoke(session, base->asSmoke()->frame, base->position.z);
+                break;
+            }
+        }
+    }
+
+    void paintParticle(PaintSession& session, const ParticleManager::Particle& particle)
+    {
+        switch (particle.type)
+        {
+            case ParticleManager::ParticleType::exhaust:
+            {
+                paintExhaust(session, particle.objectId, particle.frame, particle.position.z);
+                break;
+            }
+
+            case ParticleManager::ParticleType::splash:
+            {
+                paintSplash(session, particle.frame, particle.position.z);
+                break;
+            }
+
+            case ParticleManager::ParticleType::explosionSmoke:
+            {
+                paintExplosionSmoke(session, particle.frame, particle.position.z);
+                break;
+            }
+
+            case ParticleManager::ParticleType::smoke:
+            {
+                paintSmoke(session, particle.frame, particle.position.z);
                 break;
             }
         }
@@ -1,13 +1,16 @@
 #include "Paint/PaintEntity.h"
 #include "Config.h"
 #include "Effects/Effect.h"
+#include "Effects/ParticleManager.h"
 #include "Entities/EntityManager.h"
+#include "Entities/EntityTweener.h"
 #include "Graphics/RenderTarget.h"
 #include "Map/Tile.h"
 #include "Paint/Paint.h"
 #include "Paint/PaintEffectEntity.h"
 #include "Paint/PaintVehicle.h"
 #include "Ui/ViewportInteraction.h"
+#include "Ui/WindowManager.h"
 #include "Vehicles/Vehicle.h"
 
 using namespace OpenLoco::Ui::ViewportInteraction;
@@ -27,6 +30,13 @@ namespace OpenLoco::Paint
             return;
         }
 
+        // Most of the map is empty countryside, the occupancy bitmap is far denser than the list heads
+        if (!EntityManager::isQuadrantOccupied(loc))
+        {
+            return;
+        }
+
+        const auto& tweener = EntityTweener::get();
         EntityManager::EntityTileList entities(loc);
         for (auto* entity : entities)
         {
@@ -36,20 +46,32 @@ namespace OpenLoco::Paint
             auto right = left + session.getWorldWidth();
             auto bottom = top + session.getWorldHeight();
 
+            // Entities are found on the tile of their simulated position but drawn where the tweener puts them
+            const auto renderPos = tweener.getRenderPosition(*entity);
+            Ui::Point spriteOffset{};
+            if (renderPos != entity->position)
+            {
+                // The sprite bounds are kept for the current rotation
+                const auto rotation = Ui::WindowManager::getCurrentRotation();
+                const auto vpPos = World::gameToScreen(entity->position, rotation);
+                const auto vpRenderPos = World::gameToScreen(renderPos, rotation);
+                spriteOffset = Ui::Point(vpRenderPos.x - vpPos.x, vpRenderPos.y - vpPos.y);
+            }
+
             // TODO: Create a rect from sprite dims and use a contains function
-            if (entity->spriteTop > bottom)
+            if (entity->spriteTop + spriteOffset.y > bottom)
             {
                 continue;
             }
-            if (entity->spriteBottom <= top)
+            if (entity->spriteBottom + spriteOffset.y <= top)
             {
                 continue;
             }
-            if (entity->spriteLeft > right)
+            if (entity->spriteLeft + spriteOffset.x > right)
             {
                 continue;
             }
-            if (entity->spriteRight <= left)
+            if (entity->spriteRight + spriteOffset.x <= left)
             {
                 continue;
             }
@@ -58,7 +80,7 @@ namespace OpenLoco::Paint
                 continue;
             }
             session.setCurrentItem(entity);
-            session.setEntityPosition(entity->position);
+            session.setEntityPosition(renderPos, renderPos.z - entity->position.z);
             session.setItemType(InteractionItem::entity);
             switch (entity->baseType)
             {
@@ -75,10 +97,57 @@ namespace OpenLoco::Paint
         }
     }
 
+    // Cosmetic particles live outside the entity pool but are drawn as if they were effect entities
+    static void paintParticles(PaintSession& session, const World::Pos2& loc)
+    {
+        if (Config::get().vehiclesMinScale < session.getZoom())
+        {
+            return;
+        }
+
+        if (loc.x >= 0x4000 || loc.y >= 0x4000)
+        {
+            return;
+        }
+
+        auto left = session.getWorldX();
+        auto top = session.getWorldY();
+        auto right = left + session.getWorldWidth();
+        auto bottom = top + session.getWorldHeight();
+
+        for (auto id = ParticleManager::firstOnTile(loc); id != ParticleManager::kNullParticle; id = ParticleManager::nextOnTile(id))
+        {
+            const auto particle = ParticleManager::get(id);
+
+            const auto vpPos = World::gameToScreen(particle.position, session.getRotation());
+            if (vpPos.y - particle.spriteHeightNegative > bottom)
+            {
+                continue;
+            }
+            if (vpPos.y + particle.spriteHeightPositive <= top)
+            {
+                continue;
+            }
+            if (vpPos.x - particle.spriteWidth > right)
+            {
+                continue;
+            }
+            if (vpPos.x + particle.spriteWidth <= left)
+            {
+                continue;
+            }
+            session.setCurrentItem(nullptr);
+            session.setEntityPosition(particle.position);
+            session.setItemType(InteractionItem::noInteraction);
+            paintParticle(session, particle);
+        }
+    }
+
     // 0x0046FA88
     void paintEntities(PaintSession& session, const World::Pos2& loc)
     {
         paintEntitiesWithFilter(session, loc, [](const EntityBase*) { return true; });
+        paintParticles(session, loc);
     }
 
     static bool isEntityFlyingOrFloating(const EntityBase* entity)
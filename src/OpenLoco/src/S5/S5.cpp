@@ -4,6 +4,7 @@
 
 #include "Audio/Audio.h"
 #include "EditorController.h"
+#include "Effects/ParticleManager.h"
 #include "Entities/EntityManager.h"
 #include "Game.h"
 #include "GameState.h"
@@ -22,6 +23,7 @@
 #include "Map/TrackElement.h"
 #include "Map/TreeElement.h"
 #include "Map/WallElement.h"
+#include "Map/WaterRegions.h"
 #include "Objects/ObjectIndex.h"
 #include "Objects/ObjectManager.h"
 #include "Objects/ScenarioTextObject.h"
@@ -38,6 +40,8 @@
 #include "Ui/ProgressBar.h"
 #include "Ui/WindowManager.h"
 #include "Vehicles/OrderManager.h"
+#include "Vehicles/RoutingManager.h"
+#include "World/AirportMovementGraph.h"
 #include "World/CompanyManager.h"
 #include "World/IndustryManager.h"
 #include "World/StationManager.h"
@@ -58,7 +62,7 @@ namespace OpenLoco::S5
 
     static LoadError _lastLoadError;
 
-    static bool exportGameState(Stream& stream, const S5File& file, const std::vector<ObjectHeader>& packedObjects);
+    static bool exportGameState(Stream& stream, const S5File& file, const std::vector<ObjectHeader>& packedObjects, SaveFlags flags);
 
     constexpr bool hasSaveFlags(SaveFlags flags, SaveFlags flagsToTest)
     {
@@ -467,6 +471,7 @@ namespace OpenLoco::S5
         if ((flags & SaveFlags::raw) == SaveFlags::none)
         {
             TileManager::reorganise();
+            TileManager::compactElementStores();
             EntityManager::resetSpatialIndex();
             EntityManager::zeroUnused();
             StationManager::zeroUnused();
@@ -490,7 +495,7 @@ namespace OpenLoco::S5
             }
 
             auto file = prepareGameState(flags, requiredObjects, packedObjects);
-            saveResult = exportGameState(stream, *file, packedObjects);
+            saveResult = exportGameState(stream, *file, packedObjects, flags);
         }
 
         if ((flags & SaveFlags::isAutosave) == SaveFlags::none)
@@ -523,8 +528,12 @@ namespace OpenLoco::S5
         return false;
     }
 
-    static bool exportGameState(Stream& stream, const S5File& file, const std::vector<ObjectHeader>& packedObjects)
+    static bool exportGameState(Stream& stream, const S5File& file, const std::vector<ObjectHeader>& packedObjects, SaveFlags flags)
     {
+        const auto uncompressed = hasSaveFlags(flags, SaveFlags::uncompressed);
+        const auto runLengthSingle = uncompressed ? SawyerEncoding::uncompressed : SawyerEncoding::runLengthSingle;
+        const auto runLengthMulti = uncompressed ? SawyerEncoding::uncompressed : SawyerEncoding::runLengthMulti;
+
         try
         {
             SawyerStreamWriter fs(stream);
@@ -545,13 +554,13 @@ namespace OpenLoco::S5
 
             if (file.header.type == S5Type::scenario)
             {
-                fs.writeChunk(SawyerEncoding::runLengthSingle, &file.gameState.general, sizeof(S5::GeneralState));
-                fs.writeChunk(SawyerEncoding::runLengthSingle, file.gameState.towns, 0x123480);
-                fs.writeChunk(SawyerEncoding::runLengthSingle, file.gameState.animations, 0x79D80);
+                fs.writeChunk(runLengthSingle, &file.gameState.general, sizeof(S5::GeneralState));
+                fs.writeChunk(runLengthSingle, file.gameState.towns, 0x123480);
+                fs.writeChunk(runLengthSingle, file.gameState.animations, 0x79D80);
             }
             else
             {
-                fs.writeChunk(SawyerEncoding::runLengthSingle, file.gameState);
+                fs.writeChunk(runLengthSingle, file.gameState);
             }
 
             if (file.header.hasFlags(HeaderFlags::isRaw))
@@ -560,7 +569,7 @@ namespace OpenLoco::S5
             }
             else
             {
-                fs.writeChunk(SawyerEncoding::runLengthMulti, file.tileElements.data(), file.tileElements.size() * sizeof(TileElement));
+                fs.writeChunk(runLengthMulti, file.tileElements.data(), file.tileElements.size() * sizeof(TileElement));
             }
 
             fs.writeChecksum();
@@ -905,7 +914,13 @@ namespace OpenLoco::S5
                 EntityManager::reset();
             }
 
+            EntityManager::resetListIds();
             EntityManager::resetSpatialIndex();
+            ParticleManager::reset();
+            Vehicles::RoutingManager::rebuildFreeSlots();
+            TownManager::resetRoadIndex();
+            World::WaterRegions::reset();
+            resetAirportMovementGraphs();
             CompanyManager::updateColours();
             ObjectManager::updateTerraformObjects();
             TileManager::resetSurfaceClearance();
@@ -3,6 +3,7 @@
 #include "Config.h"
 #include "Date.h"
 #include "Economy/Economy.h"
+#include "Effects/ParticleManager.h"
 #include "Entities/EntityManager.h"
 #include "Environment.h"
 #include "Game.h"
@@ -206,6 +207,7 @@ namespace OpenLoco::Scenario
         Ui::Windows::Construction::Construction::reset();
         sub_46115C();
         WaveManager::reset();
+        ParticleManager::reset();
 
         initialiseDate(1900);
         initialiseSnowLine();
@@ -222,6 +222,7 @@ namespace OpenLoco::Scenes::GameScene
 
         recordTickStartPrng();
         World::TileManager::defragmentTilePeriodic();
+        World::TileManager::reorganiseIncremental();
 
         // Back up the `madeAnyChanges` variable to ensure we only capture user changes
         bool userMadeAnyChanges = Scenario::getOptions().madeAnyChanges;
@@ -236,6 +237,7 @@ namespace OpenLoco::Scenes::GameScene
         EffectsManager::tick();
         CompanyManager::tick();
         World::AnimationManager::tick();
+        Network::updateChecksum(ScenarioManager::getScenarioTicks());
         Audio::tick();
 
         Scenario::getOptions().madeAnyChanges = userMadeAnyChanges;
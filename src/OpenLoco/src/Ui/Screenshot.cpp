@@ -13,10 +13,13 @@
 #include <OpenLoco/Core/Exception.hpp>
 #include <OpenLoco/Platform/Platform.h>
 #include <algorithm>
+#include <cassert>
 #include <cstdint>
 #include <fstream>
+#include <future>
 #include <png.h>
 #include <string>
+#include <vector>
 
 #pragma warning(disable : 4611) // interaction between '_setjmp' and C++ object destruction is non-portable
 
@@ -34,6 +37,9 @@ namespace OpenLoco::Ui
         _screenshotType = type;
     }
 
+    // Rows of the giant screenshot painted at a time, bounds the memory used regardless of map size and zoom
+    static constexpr int32_t kGiantScreenshotBandHeight = 256;
+
     static std::string saveScreenshot();
     static std::string saveGiantScreenshot();
 
@@ -79,75 +85,127 @@ namespace OpenLoco::Ui
         ostream->flush();
     }
 
-    static void saveRenderTargetToPng(const Gfx::RenderTarget& rt, std::fstream& outputStream)
+    /**
+     * Writes a paletted PNG a number of rows at a time, so an image does not have to be held in memory
+     * as a whole. Each method sets its own error handler as libpng reports errors with longjmp.
+     */
+    class PngWriter
     {
-        auto rgbaPalette = Gfx::getRgbaPalette();
-
-        png_structp pngPtr = nullptr;
-        png_colorp palette = nullptr;
-        try
+    private:
+        png_structp _pngPtr{};
+        png_infop _infoPtr{};
+        png_colorp _palette{};
+        int32_t _width{};
+
+    public:
+        PngWriter(std::ostream& outputStream, int32_t width, int32_t height)
+            : _width(width)
         {
-            pngPtr = png_create_write_struct(PNG_LIBPNG_VER_STRING, nullptr, nullptr, nullptr);
-            if (pngPtr == nullptr)
+            auto rgbaPalette = Gfx::getRgbaPalette();
+
+            _pngPtr = png_create_write_struct(PNG_LIBPNG_VER_STRING, nullptr, nullptr, nullptr);
+            if (_pngPtr == nullptr)
             {
                 throw Exception::RuntimeError("png_create_write_struct failed.");
             }
 
-            png_set_write_fn(pngPtr, &outputStream, pngWriteData, pngFlush);
+            png_set_write_fn(_pngPtr, &outputStream, pngWriteData, pngFlush);
 
             // Set error handler
-            if (setjmp(png_jmpbuf(pngPtr)))
+            if (setjmp(png_jmpbuf(_pngPtr)))
             {
+                destroy();
                 throw Exception::RuntimeError("PNG ERROR");
             }
 
-            auto infoPtr = png_create_info_struct(pngPtr);
-            if (infoPtr == nullptr)
+            _infoPtr = png_create_info_struct(_pngPtr);
+            if (_infoPtr == nullptr)
             {
+                destroy();
                 throw Exception::RuntimeError("png_create_info_struct failed.");
             }
 
-            palette = (png_colorp)png_malloc(pngPtr, 246 * sizeof(png_color));
-            if (palette == nullptr)
+            _palette = (png_colorp)png_malloc(_pngPtr, 246 * sizeof(png_color));
+            if (_palette == nullptr)
             {
+                destroy();
                 throw Exception::RuntimeError("png_malloc failed.");
             }
 
             for (size_t i = 0; i < 246; i++)
             {
-                palette[i].blue = rgbaPalette[i].b;
-                palette[i].green = rgbaPalette[i].g;
-                palette[i].red = rgbaPalette[i].r;
+                _palette[i].blue = rgbaPalette[i].b;
+                _palette[i].green = rgbaPalette[i].g;
+                _palette[i].red = rgbaPalette[i].r;
             }
-            png_set_PLTE(pngPtr, infoPtr, palette, 246);
+            png_set_PLTE(_pngPtr, _infoPtr, _palette, 246);
 
             png_byte transparentIndex = 0;
-            png_set_tRNS(pngPtr, infoPtr, &transparentIndex, 1, nullptr);
-            png_set_IHDR(pngPtr, infoPtr, rt.width, rt.height, 8, PNG_COLOR_TYPE_PALETTE, PNG_INTERLACE_NONE, PNG_COMPRESSION_TYPE_DEFAULT, PNG_FILTER_TYPE_DEFAULT);
-            png_write_info(pngPtr, infoPtr);
+            png_set_tRNS(_pngPtr, _infoPtr, &transparentIndex, 1, nullptr);
+            png_set_IHDR(_pngPtr, _infoPtr, width, height, 8, PNG_COLOR_TYPE_PALETTE, PNG_INTERLACE_NONE, PNG_COMPRESSION_TYPE_DEFAULT, PNG_FILTER_TYPE_DEFAULT);
+            png_write_info(_pngPtr, _infoPtr);
+        }
+
+        PngWriter(const PngWriter&) = delete;
+        PngWriter& operator=(const PngWriter&) = delete;
+
+        ~PngWriter()
+        {
+            destroy();
+        }
+
+        // Writes the next rows of the image, the render target must be as wide as the image
+        void writeRows(const Gfx::RenderTarget& rt)
+        {
+            assert(rt.width == _width);
+
+            if (setjmp(png_jmpbuf(_pngPtr)))
+            {
+                throw Exception::RuntimeError("PNG ERROR");
+            }
 
             uint8_t* data = rt.bits;
             for (int y = 0; y < rt.height; y++)
             {
-                png_write_row(pngPtr, data);
+                png_write_row(_pngPtr, data);
                 data += rt.pitch + rt.width;
             }
+        }
+
+        void finish()
+        {
+            if (setjmp(png_jmpbuf(_pngPtr)))
+            {
+                throw Exception::RuntimeError("PNG ERROR");
+            }
 
-            png_write_end(pngPtr, nullptr);
-            png_destroy_info_struct(pngPtr, &infoPtr);
-            png_free(pngPtr, palette);
-            png_destroy_write_struct(&pngPtr, nullptr);
+            png_write_end(_pngPtr, nullptr);
         }
-        catch (const std::exception&)
+
+    private:
+        void destroy()
         {
-            png_free(pngPtr, palette);
-            png_destroy_write_struct(&pngPtr, nullptr);
-            throw;
+            if (_pngPtr == nullptr)
+            {
+                return;
+            }
+            png_free(_pngPtr, _palette);
+            png_destroy_write_struct(&_pngPtr, _infoPtr != nullptr ? &_infoPtr : nullptr);
+            _palette = nullptr;
+            _infoPtr = nullptr;
+            _pngPtr = nullptr;
         }
+    };
+
+    static void saveRenderTargetToPng(const Gfx::RenderTarget& rt, std::fstream& outputStream)
+    {
+        PngWriter writer(outputStream, rt.width, rt.height);
+        writer.writeRows(rt);
+        writer.finish();
     }
 
     // 0x00452667
-    static std::string prepareSaveScreenshot(const Gfx::RenderTarget& rt)
+    static fs::path getScreenshotPath()
     {
         auto screenshotsFolderPath = Environment::getPathNoWarning(Environment::PathId::screenshots);
         Environment::autoCreateDirectory(screenshotsFolderPath);
@@ -177,10 +235,17 @@ namespace OpenLoco::Ui
             throw Exception::RuntimeError("Failed finding filename");
         }
 
+        return path;
+    }
+
+    static std::string prepareSaveScreenshot(const Gfx::RenderTarget& rt)
+    {
+        const auto path = getScreenshotPath();
+
         std::fstream outputStream(path.c_str(), std::ios::out | std::ios::binary);
         saveRenderTargetToPng(rt, outputStream);
 
-        return fileName;
+        return path.filename().u8string();
     }
 
     static std::string saveScreenshot()
@@ -214,12 +279,8 @@ namespace OpenLoco::Ui
         return viewport;
     }
 
-    static std::string saveGiantScreenshot()
+    void saveGiantScreenshot(const fs::path& path, const ZoomLevel zoomLevel)
     {
-        const auto& main = WindowManager::getMainWindow();
-
-        const auto zoomLevel = ZoomLevel{ std::max<int8_t>(static_cast<int8_t>(main->viewports[0]->zoom), ZoomLevel::full) };
-
         const uint16_t resolutionWidth = zoomLevel.applyInversedTo(World::kMapColumns * 32 * 2) + 8;
         const uint16_t resolutionHeight = zoomLevel.applyInversedTo(World::kMapRows * 32 * 1) + 128;
 
@@ -228,31 +289,60 @@ namespace OpenLoco::Ui
         // Ensure sprites appear regardless of rotation
         EntityManager::resetSpatialIndex();
 
-        Gfx::RenderTarget rt{};
-        rt.bits = static_cast<uint8_t*>(malloc(resolutionWidth * resolutionHeight));
-        if (rt.bits == nullptr)
+        std::fstream outputStream(path.c_str(), std::ios::out | std::ios::binary);
+        if (!outputStream.is_open())
         {
-            return {};
+            throw Exception::RuntimeError("Unable to open " + path.u8string());
+        }
+        PngWriter writer(outputStream, resolutionWidth, resolutionHeight);
+
+        // The image is painted in bands, the columns of each band are painted in parallel by the
+        // viewport while the previous band is being compressed
+        std::vector<uint8_t> buffers[2];
+        std::future<void> pendingWrite;
+        size_t bufferIndex = 0;
+        for (int32_t top = 0; top < resolutionHeight; top += kGiantScreenshotBandHeight)
+        {
+            auto& buffer = buffers[bufferIndex];
+            buffer.resize(resolutionWidth * kGiantScreenshotBandHeight);
+            bufferIndex ^= 1;
+
+            Gfx::RenderTarget rt{};
+            rt.bits = buffer.data();
+            rt.x = 0;
+            rt.y = top;
+            rt.width = resolutionWidth;
+            rt.height = std::min<int32_t>(kGiantScreenshotBandHeight, resolutionHeight - top);
+            rt.pitch = 0;
+
+            Gfx::SoftwareDrawingContext drawingCtx;
+            drawingCtx.pushRenderTarget(rt);
+            viewport.render(drawingCtx);
+            drawingCtx.popRenderTarget();
+
+            if (pendingWrite.valid())
+            {
+                pendingWrite.get();
+            }
+            pendingWrite = std::async(std::launch::async, [&writer, rt] { writer.writeRows(rt); });
         }
 
-        rt.x = 0;
-        rt.y = 0;
-        rt.width = resolutionWidth;
-        rt.height = resolutionHeight;
-        rt.pitch = 0;
-
-        auto& drawingEngine = Gfx::getDrawingEngine();
-        auto& drawingCtx = drawingEngine.getDrawingContext();
-
-        drawingCtx.pushRenderTarget(rt);
+        if (pendingWrite.valid())
+        {
+            pendingWrite.get();
+        }
+        writer.finish();
+    }
 
-        viewport.render(drawingCtx);
+    static std::string saveGiantScreenshot()
+    {
+        const auto& main = WindowManager::getMainWindow();
 
-        drawingCtx.popRenderTarget();
+        const auto zoomLevel = ZoomLevel{ std::max<int8_t>(static_cast<int8_t>(main->viewports[0]->zoom), ZoomLevel::full) };
 
-        auto fileName = prepareSaveScreenshot(rt);
-        free(rt.bits);
+        const auto path = getScreenshotPath();
+        saveGiantScreenshot(path, zoomLevel);
 
-        return fileName;
+        return path.filename().u8string();
     }
 }
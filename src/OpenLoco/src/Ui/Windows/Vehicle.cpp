@@ -4530,16 +4530,16 @@ namespace OpenLoco::Ui::Windows::Vehicle
             uint16_t bestProgress = 0;
             auto* vpOwner = WindowManager::findWindowForViewport(&viewport);
             const auto vpOffset = vpOwner != nullptr ? vpOwner->position() : Ui::Point{};
-            for (const auto& moveInfo : moveInfoArr)
+            for (uint16_t i = 0; i < moveInfoArr.size(); ++i)
             {
-                auto potentialLoc = roadFirstTile + moveInfo.loc;
+                auto potentialLoc = roadFirstTile + moveInfoArr[i].loc;
                 auto viewPos = World::gameToScreen(potentialLoc, viewport.getRotation());
                 auto uiPos = viewport.viewportToWindow(viewPos) + vpOffset;
                 auto distance = Math::Vector::manhattanDistance2D(uiPos, cursorLoc);
                 if (distance < bestDistance)
                 {
                     bestDistance = distance;
-                    bestProgress = std::distance(&*moveInfoArr.begin(), &moveInfo);
+                    bestProgress = i;
                 }
             }
             return bestProgress;
@@ -4589,7 +4589,7 @@ namespace OpenLoco::Ui::Windows::Vehicle
 
             placementArgs->head = head.id;
             const auto moveInfoArr = World::TrackData::getRoadPlacementSubPositon(placementArgs->trackAndDirection);
-            const auto& moveInfo = moveInfoArr[placementArgs->trackProgress];
+            const auto moveInfo = moveInfoArr[placementArgs->trackProgress];
 
             uint8_t unkYaw = moveInfo.yaw + (WindowManager::getCurrentRotation() << 4);
             unkYaw -= 0x37;
@@ -4637,16 +4637,16 @@ namespace OpenLoco::Ui::Windows::Vehicle
             uint16_t bestProgress = 0;
             auto* vpOwner = WindowManager::findWindowForViewport(&viewport);
             const auto vpOffset = vpOwner != nullptr ? vpOwner->position() : Ui::Point{};
-            for (const auto& moveInfo : moveInfoArr)
+            for (uint16_t i = 0; i < moveInfoArr.size(); ++i)
             {
-                auto potentialLoc = trackFirstTile + moveInfo.loc;
+                auto potentialLoc = trackFirstTile + moveInfoArr[i].loc;
                 auto viewPos = World::gameToScreen(potentialLoc, viewport.getRotation());
                 auto uiPos = viewport.viewportToWindow(viewPos) + vpOffset;
                 auto distance = Math::Vector::manhattanDistance2D(uiPos, cursorLoc);
                 if (distance < bestDistance)
                 {
                     bestDistance = distance;
-                    bestProgress = std::distance(&*moveInfoArr.begin(), &moveInfo);
+                    bestProgress = i;
                 }
             }
             return bestProgress;
@@ -4696,7 +4696,7 @@ namespace OpenLoco::Ui::Windows::Vehicle
 
             placementArgs->head = head.id;
             const auto moveInfoArr = World::TrackData::getTrackSubPositon(placementArgs->trackAndDirection);
-            const auto& moveInfo = moveInfoArr[placementArgs->trackProgress];
+            const auto moveInfo = moveInfoArr[placementArgs->trackProgress];
 
             uint8_t unkYaw = moveInfo.yaw + (WindowManager::getCurrentRotation() << 4);
             unkYaw -= 0x37;
@@ -502,27 +502,110 @@ namespace OpenLoco::Vehicles::OrderManager
     // 0x0047062B
     void removeOrdersForStation(const StationId stationId)
     {
-        for (auto i = 0U; i < orderTableLength();)
+        // Deleting the orders one at a time shifts the rest of the table and re-offsets every
+        // vehicle for each order, instead the table is compacted in a single pass. The vehicle
+        // offsets, current orders and display frames end up exactly as deleteOrder would leave them.
+        std::vector<VehicleHead*> heads;
+        for (auto* head : VehicleManager::VehicleList())
         {
-            auto& order = orders()[i];
-            auto* stationOrder = order.as<OrderStation>();
-            if (stationOrder != nullptr)
+            heads.push_back(head);
+        }
+        std::sort(heads.begin(), heads.end(), [](const VehicleHead* a, const VehicleHead* b) {
+            return a->orderTableOffset < b->orderTableOffset;
+        });
+
+        auto* table = reinterpret_cast<uint8_t*>(orders());
+
+        // Check every order before moving anything so a corrupt table is left as it was
+        for (const auto* head : heads)
+        {
+            const auto segmentEnd = head->orderTableOffset + head->sizeOfOrderTable;
+            for (auto pos = head->orderTableOffset; pos < segmentEnd;)
+            {
+                const auto type = enumValue(reinterpret_cast<const Order*>(table + pos)->getType());
+                if (type >= std::size(kOrderSizes))
+                {
+                    throw Exception::RuntimeError("Invalid order type!");
+                }
+                pos += kOrderSizes[type];
+            }
+        }
+
+        uint32_t readPos = 0;
+        uint32_t writePos = 0;
+        const auto keepUntil = [&](uint32_t end) {
+            if (writePos != readPos)
+            {
+                std::memmove(table + writePos, table + readPos, end - readPos);
+            }
+            writePos += end - readPos;
+            readPos = end;
+        };
+
+        // Start offset (before compacting) and size of each removed order
+        std::vector<std::pair<uint32_t, uint8_t>> removedOrders;
+        for (auto* head : heads)
+        {
+            // Orders not owned by any vehicle are left alone
+            keepUntil(head->orderTableOffset);
+            head->orderTableOffset = writePos;
+
+            const auto segmentEnd = readPos + head->sizeOfOrderTable;
+            uint16_t orderOffset = 0;
+            bool skipNext = false;
+            while (readPos < segmentEnd)
             {
-                if (stationOrder->getStation() == stationId)
+                const auto& order = *reinterpret_cast<const Order*>(table + readPos);
+                const auto orderSize = kOrderSizes[enumValue(order.getType())];
+
+                auto* stationOrder = order.as<OrderStation>();
+                if (!skipNext && stationOrder != nullptr && stationOrder->getStation() == stationId)
                 {
-                    // Find the vehicle that has the order
-                    for (auto* head : VehicleManager::VehicleList())
+                    removedOrders.emplace_back(readPos, orderSize);
+                    readPos += orderSize;
+
+                    // Same adjustments as deleteOrder
+                    head->sizeOfOrderTable -= orderSize;
+                    if (head->currentOrder > orderOffset)
+                    {
+                        head->currentOrder -= orderSize;
+                    }
+                    if (head->currentOrder + 1 >= head->sizeOfOrderTable)
                     {
-                        if (head->orderTableOffset <= i
-                            && i < head->orderTableOffset + head->sizeOfOrderTable)
-                        {
-                            deleteOrder(head, i - head->orderTableOffset);
-                            break;
-                        }
+                        head->currentOrder = 0;
                     }
+
+                    // The original scan stepped over the order that moved into the removed
+                    // order's place without checking it, keep that so the results match.
+                    skipNext = true;
+                    continue;
+                }
+
+                skipNext = false;
+                keepUntil(readPos + orderSize);
+                orderOffset += orderSize;
+            }
+        }
+        keepUntil(orderTableLength());
+        orderTableLength() = writePos;
+
+        if (removedOrders.empty())
+        {
+            return;
+        }
+
+        for (auto& frame : _displayFrames)
+        {
+            uint32_t removedSize = 0;
+            for (const auto& [offset, size] : removedOrders)
+            {
+                if (offset >= frame.orderOffset)
+                {
+                    break;
                 }
+                removedSize += size;
             }
-            i += kOrderSizes[enumValue(order.getType())];
+            frame.orderOffset -= removedSize;
         }
     }
 }
@@ -1,26 +1,63 @@
 #include "Vehicles/RoutingManager.h"
 #include "GameState.h"
 #include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
 
 namespace OpenLoco::Vehicles::RoutingManager
 {
+    // One bit per vehicle ref, set when routings()[ref][0] == kRoutingNull. Not part of the game
+    // state, rebuilt after loading.
+    static std::array<uint64_t, (Limits::kMaxVehicles + 63) / 64> _freeSlots{};
+
     static auto& routings() { return getGameState().routings; }
 
+    static void setSlotFree(const uint16_t vehicleRef, const bool isFree)
+    {
+        const auto bit = uint64_t(1) << (vehicleRef % 64);
+        if (isFree)
+        {
+            _freeSlots[vehicleRef / 64] |= bit;
+        }
+        else
+        {
+            _freeSlots[vehicleRef / 64] &= ~bit;
+        }
+    }
+
+    // Finds the lowest free vehicle ref, the same one a scan of the routing table would find
     static std::optional<uint16_t> findFreeRoutingVehicleRef()
     {
-        const auto& routingArr = routings();
-        const auto res = std::find_if(std::begin(routingArr), std::end(routingArr), [](const auto& route) { return route[0] == kRoutingNull; });
-        if (res == std::end(routingArr))
+        for (size_t i = 0; i < _freeSlots.size(); i++)
         {
-            return std::nullopt;
+            if (_freeSlots[i] != 0)
+            {
+                const auto vehicleRef = static_cast<uint16_t>(i * 64 + std::countr_zero(_freeSlots[i]));
+                assert(routings()[vehicleRef][0] == kRoutingNull);
+                return vehicleRef;
+            }
+        }
+        return std::nullopt;
+    }
+
+    void rebuildFreeSlots()
+    {
+        _freeSlots.fill(0);
+        for (uint16_t vehicleRef = 0; vehicleRef < Limits::kMaxVehicles; vehicleRef++)
+        {
+            if (routings()[vehicleRef][0] == kRoutingNull)
+            {
+                setSlotFree(vehicleRef, true);
+            }
         }
-        return std::distance(std::begin(routingArr), res);
     }
 
     void resetRoutings(const RoutingHandle handle)
     {
         auto& vehRoutingArr = routings()[handle.getVehicleRef()];
         std::fill(std::begin(vehRoutingArr), std::end(vehRoutingArr), kAllocatedButFreeRouting);
+        setSlotFree(handle.getVehicleRef(), false);
     }
 
     bool isEmptyRoutingSlotAvailable()
@@ -36,6 +73,7 @@ namespace OpenLoco::Vehicles::RoutingManager
         {
             auto& vehRoutingArr = routings()[*vehicleRef];
             std::fill(std::begin(vehRoutingArr), std::end(vehRoutingArr), kAllocatedButFreeRouting);
+            setSlotFree(*vehicleRef, false);
             return { RoutingHandle(*vehicleRef, 0) };
         }
         return std::nullopt;
@@ -49,6 +87,10 @@ namespace OpenLoco::Vehicles::RoutingManager
     void setRouting(const RoutingHandle handle, uint16_t routing)
     {
         routings()[handle.getVehicleRef()][handle.getIndex()] = routing;
+        if (handle.getIndex() == 0)
+        {
+            setSlotFree(handle.getVehicleRef(), routing == kRoutingNull);
+        }
     }
 
     void freeRouting(const RoutingHandle handle)
@@ -61,12 +103,14 @@ namespace OpenLoco::Vehicles::RoutingManager
     {
         auto& vehRoutingArr = routings()[handle.getVehicleRef()];
         std::fill(std::begin(vehRoutingArr), std::end(vehRoutingArr), kRoutingNull);
+        setSlotFree(handle.getVehicleRef(), true);
     }
 
     // 0x004A8810
     void resetRoutingTable()
     {
         std::fill_n(&routings()[0][0], Limits::kMaxVehicles * Limits::kMaxRoutingsPerVehicle, kRoutingNull);
+        rebuildFreeSlots();
     }
 
     RingView::Iterator::Iterator(const RoutingHandle& begin, bool isEnd, Direction direction)
@@ -473,7 +473,7 @@ namespace OpenLoco::Vehicles
             }
             // 0x0047C95B
             component.subPosition = newSubPosition;
-            const auto& moveData = World::TrackData::getRoadSubPositon(component.trackAndDirection.road._data)[newSubPosition];
+            const auto moveData = World::TrackData::getRoadSubPositon(component.trackAndDirection.road._data)[newSubPosition];
             const auto nextNewPosition = moveData.loc + World::Pos3(component.tileX, component.tileY, component.tileBaseZ * World::kSmallZStep);
             component.remainingDistance -= kMovementNibbleToDistance[getMovementNibble(intermediatePosition, nextNewPosition)];
             intermediatePosition = nextNewPosition;
@@ -531,7 +531,7 @@ namespace OpenLoco::Vehicles
                 }
                 // 0x004B1761
                 component.subPosition = newSubPosition;
-                const auto& moveData = World::TrackData::getTrackSubPositon(component.trackAndDirection.track._data)[newSubPosition];
+                const auto moveData = World::TrackData::getTrackSubPositon(component.trackAndDirection.track._data)[newSubPosition];
                 const auto nextNewPosition = moveData.loc + World::Pos3(component.tileX, component.tileY, component.tileBaseZ * World::kSmallZStep);
                 component.remainingDistance -= kMovementNibbleToDistance[getMovementNibble(intermediatePosition, nextNewPosition)];
                 intermediatePosition = nextNewPosition;
@@ -384,7 +384,7 @@ namespace OpenLoco::Vehicles
                 }
             }
             veh1.subPosition = newSubPosition;
-            const auto& moveData = World::TrackData::getRoadSubPositon(veh1.trackAndDirection.road._data)[newSubPosition];
+            const auto moveData = World::TrackData::getRoadSubPositon(veh1.trackAndDirection.road._data)[newSubPosition];
             const auto nextNewPosition = moveData.loc + World::Pos3(veh1.tileX, veh1.tileY, veh1.tileBaseZ * World::kSmallZStep);
             distanceMoved += kMovementNibbleToDistance[getMovementNibble(intermediatePosition, nextNewPosition)];
             intermediatePosition = nextNewPosition;
@@ -445,7 +445,7 @@ namespace OpenLoco::Vehicles
                 }
             }
             subPosition = newSubPosition;
-            const auto& moveData = World::TrackData::getRoadSubPositon(rad._data)[newSubPosition];
+            const auto moveData = World::TrackData::getRoadSubPositon(rad._data)[newSubPosition];
             const auto nextNewPosition = moveData.loc + pos;
             distanceMoved += kMovementNibbleToDistance[getMovementNibble(intermediatePosition, nextNewPosition)];
             intermediatePosition = nextNewPosition;
@@ -841,7 +841,7 @@ namespace OpenLoco::Vehicles
             }
             // 0x0047C95B
             this->subPosition = newSubPosition;
-            const auto& moveData = World::TrackData::getRoadSubPositon(this->trackAndDirection.road._data)[newSubPosition];
+            const auto moveData = World::TrackData::getRoadSubPositon(this->trackAndDirection.road._data)[newSubPosition];
             const auto nextNewPosition = moveData.loc + World::Pos3(this->tileX, this->tileY, this->tileBaseZ * World::kSmallZStep);
             this->remainingDistance -= kMovementNibbleToDistance[getMovementNibble(intermediatePosition, nextNewPosition)];
             intermediatePosition = nextNewPosition;
@@ -2,7 +2,7 @@
 #include "Audio/Audio.h"
 #include "Config.h"
 #include "Effects/Effect.h"
-#include "Effects/ExhaustEffect.h"
+#include "Effects/ParticleManager.h"
 #include "Entities/EntityManager.h"
 #include "GameState.h"
 #include "Graphics/Gfx.h"
@@ -977,7 +977,7 @@ namespace OpenLoco::Vehicles
 
         auto smokeLoc = bogieDifference * emitterHorizontalPos / 128 + frontBogie->position + World::Pos3(xyFactor.x, xyFactor.y, vehicleObject->animation[num].emitterVerticalPos);
 
-        Exhaust::create(smokeLoc, vehicleObject->animation[num].objectId | (soundCode ? 0 : 0x80));
+        ParticleManager::createExhaust(smokeLoc, vehicleObject->animation[num].objectId | (soundCode ? 0 : 0x80));
         if (soundCode == false)
         {
             return;
@@ -1121,7 +1121,7 @@ namespace OpenLoco::Vehicles
             auto xyFactor = Math::Trigonometry::computeXYVector(positionFactor, invertedDirection) / 2;
 
             World::Pos3 loc = position + World::Pos3(xyFactor.x, xyFactor.y, vehicleObject->animation[num].emitterVerticalPos);
-            Exhaust::create(loc, vehicleObject->animation[num].objectId);
+            ParticleManager::createExhaust(loc, vehicleObject->animation[num].objectId);
         }
         else
         {
@@ -1151,7 +1151,7 @@ namespace OpenLoco::Vehicles
 
             auto loc = bogieDifference * emitterHorizontalPos / 128 + frontBogie->position + World::Pos3(xyFactor.x, xyFactor.y, vehicleObject->animation[num].emitterVerticalPos);
 
-            Exhaust::create(loc, vehicleObject->animation[num].objectId);
+            ParticleManager::createExhaust(loc, vehicleObject->animation[num].objectId);
         }
     }
 
@@ -1208,7 +1208,7 @@ namespace OpenLoco::Vehicles
         loc.x += xyFactor.x;
         loc.y += xyFactor.y;
 
-        Exhaust::create(loc, vehicleObject->animation[num].objectId);
+        ParticleManager::createExhaust(loc, vehicleObject->animation[num].objectId);
     }
 
     // 0x004ABDAD & 0x004AB3CA
@@ -1253,7 +1253,7 @@ namespace OpenLoco::Vehicles
 
         auto loc = bogieDifference * emitterHorizontalPos / 128 + frontBogie->position + World::Pos3(xyFactor.x, xyFactor.y, vehicleObject->animation[num].emitterVerticalPos);
 
-        Exhaust::create(loc, vehicleObject->animation[num].objectId);
+        ParticleManager::createExhaust(loc, vehicleObject->animation[num].objectId);
     }
 
     // 0x004ABEC3 & 0x004AB4E0
@@ -1316,7 +1316,7 @@ namespace OpenLoco::Vehicles
         loc.x += xyFactor.x;
         loc.y += xyFactor.y;
 
-        Exhaust::create(loc, vehicleObject->animation[num].objectId);
+        ParticleManager::createExhaust(loc, vehicleObject->animation[num].objectId);
     }
 
     // 0x004ABC8A & 0x004AB2A7
@@ -1367,7 +1367,7 @@ namespace OpenLoco::Vehicles
         loc.x += xyFactor.x;
         loc.y += xyFactor.y;
 
-        Exhaust::create(loc, vehicleObject->animation[num].objectId);
+        ParticleManager::createExhaust(loc, vehicleObject->animation[num].objectId);
 
         if (vehicleObject->shipWakeSpacing == 0)
         {
@@ -1381,7 +1381,7 @@ namespace OpenLoco::Vehicles
         loc.x += xyFactor.x;
         loc.y += xyFactor.y;
 
-        Exhaust::create(loc, vehicleObject->animation[num].objectId);
+        ParticleManager::createExhaust(loc, vehicleObject->animation[num].objectId);
     }
 
     // 0x004AC039
@@ -1,7 +1,7 @@
 #include "Vehicles/VehicleBogie.h"
 #include "Audio/Audio.h"
 #include "Effects/ExplosionEffect.h"
-#include "Effects/SplashEffect.h"
+#include "Effects/ParticleManager.h"
 #include "Effects/VehicleCrashEffect.h"
 #include "Entities/EntityManager.h"
 #include "Map/RoadElement.h"
@@ -274,7 +274,7 @@ namespace OpenLoco::Vehicles
                     if (!this->hasVehicleFlags(VehicleFlags::unk_5))
                     {
                         World::Pos3 splashPos{ this->position.x, this->position.y, newTileHeight.waterHeight };
-                        Splash::create(splashPos);
+                        ParticleManager::createSplash(splashPos);
                         Audio::playSound(Audio::SoundId::splash2, Audio::ChannelId::vehicles, splashPos);
                         this->vehicleFlags |= VehicleFlags::unk_5;
                     }
@@ -4,7 +4,7 @@
 #include "Date.h"
 #include "Economy/Economy.h"
 #include "Effects/Effect.h"
-#include "Effects/SmokeEffect.h"
+#include "Effects/ParticleManager.h"
 #include "Entities/EntityManager.h"
 #include "GameCommands/GameCommands.h"
 #include "GameCommands/Vehicles/VehicleChangeRunningMode.h"
@@ -22,6 +22,7 @@
 #include "Map/Track/Track.h"
 #include "Map/Track/TrackData.h"
 #include "Map/TrackElement.h"
+#include "Map/WaterRegions.h"
 #include "MessageManager.h"
 #include "Objects/AirportObject.h"
 #include "Objects/CargoObject.h"
@@ -46,7 +47,9 @@
 #include "Vehicles/VehicleBogie.h"
 #include "Vehicles/VehicleManager.h"
 #include "Vehicles/VehicleTail.h"
+#include "Vehicles/WaterPathfinding.h"
 #include "ViewportManager.h"
+#include "World/AirportMovementGraph.h"
 #include "World/CompanyManager.h"
 #include "World/CompanyRecords.h"
 #include "World/IndustryManager.h"
@@ -460,7 +463,7 @@ namespace OpenLoco::Vehicles
                 {
                     auto v2 = car.body; // body
 
-                    Smoke::create(v2->position + World::Pos3{ 0, 0, 4 });
+                    ParticleManager::createSmoke(v2->position + World::Pos3{ 0, 0, 4 });
                 }
             }
 
@@ -1736,53 +1739,11 @@ namespace OpenLoco::Vehicles
     // 0x00426E26
     static std::pair<AirportMovementNodeFlags, World::Pos3> airportGetMovementEdgeTarget(StationId targetStation, uint8_t curEdge)
     {
-        auto station = StationManager::get(targetStation);
-
-        Pos3 stationLoc = station->airportStartPos;
-
-        auto tile = TileManager::get(stationLoc);
-
-        for (auto& el : tile)
+        const auto* graph = getAirportMovementGraph(targetStation);
+        if (graph != nullptr)
         {
-            auto* elStation = el.as<StationElement>();
-            if (elStation == nullptr)
-            {
-                continue;
-            }
-
-            if (elStation->baseZ() != stationLoc.z / 4)
-            {
-                continue;
-            }
-
-            auto airportObject = ObjectManager::get<AirportObject>(elStation->objectId());
-            const auto movementNodes = airportObject->getMovementNodes();
-            const auto movementEdges = airportObject->getMovementEdges();
-
-            auto destinationNode = movementEdges[curEdge].nextNode;
-
-            Pos2 loc2 = {
-                static_cast<int16_t>(movementNodes[destinationNode].x - 16),
-                static_cast<int16_t>(movementNodes[destinationNode].y - 16)
-            };
-            loc2 = Math::Vector::rotate(loc2, elStation->rotation());
-            auto airportMovement = movementNodes[destinationNode];
-
-            loc2.x += 16 + stationLoc.x;
-            loc2.y += 16 + stationLoc.y;
-
-            Pos3 loc = { loc2.x, loc2.y, static_cast<int16_t>(movementNodes[destinationNode].z + stationLoc.z) };
-
-            if (!airportMovement.hasFlags(AirportMovementNodeFlags::taxiing))
-            {
-                loc.z = stationLoc.z + 255;
-                if (!airportMovement.hasFlags(AirportMovementNodeFlags::inFlight))
-                {
-                    loc.z = 960;
-                }
-            }
-
-            return std::make_pair(airportMovement.flags, loc);
+            const auto& target = graph->getEdgeTarget(curEdge);
+            return std::make_pair(target.flags, target.loc);
         }
 
         // Tile not found. Todo: fail gracefully
@@ -2032,29 +1993,11 @@ namespace OpenLoco::Vehicles
             return std::make_pair(Status::travelling, targetSpeed);
         }
 
-        auto station = StationManager::get(stationId);
-
-        Pos3 loc = station->airportStartPos;
-
-        auto tile = World::TileManager::get(loc);
-        for (auto& el : tile)
+        const auto* graph = getAirportMovementGraph(stationId);
+        if (graph != nullptr)
         {
-            auto* elStation = el.as<World::StationElement>();
-            if (elStation == nullptr)
-            {
-                continue;
-            }
-
-            if (elStation->baseZ() != loc.z / 4)
-            {
-                continue;
-            }
-
-            auto airportObject = ObjectManager::get<AirportObject>(elStation->objectId());
-            const auto movementEdges = airportObject->getMovementEdges();
-
-            uint8_t al = movementEdges[airportMovementEdge].var_03;
-            uint8_t cl = movementEdges[airportMovementEdge].var_00;
+            uint8_t al = graph->edges[airportMovementEdge].var_03;
+            uint8_t cl = graph->edges[airportMovementEdge].var_00;
 
             auto veh2 = train.veh2;
             if (al != 0)
@@ -2501,139 +2444,13 @@ namespace OpenLoco::Vehicles
     {
         auto station = StationManager::get(stationId);
 
-        Pos3 loc = station->airportStartPos;
-
-        auto tile = TileManager::get(loc);
-
-        for (auto& el : tile)
+        const auto* graph = getAirportMovementGraph(stationId);
+        if (graph != nullptr)
         {
-            auto* elStation = el.as<StationElement>();
-            if (elStation == nullptr)
-            {
-                continue;
-            }
-
-            if (elStation->baseZ() != loc.z / 4)
-            {
-                continue;
-            }
-
-            auto airportObject = ObjectManager::get<AirportObject>(elStation->objectId());
-            const auto movementNodes = airportObject->getMovementNodes();
-            const auto movementEdges = airportObject->getMovementEdges();
-
-            if (curEdge == kAirportMovementNodeNull)
-            {
-                for (uint8_t movementEdge = 0; movementEdge < airportObject->numMovementEdges; movementEdge++)
-                {
-                    const auto& transition = movementEdges[movementEdge];
-                    if (!movementNodes[transition.curNode].hasFlags(AirportMovementNodeFlags::flag2))
-                    {
-                        continue;
-                    }
-
-                    if (station->airportMovementOccupiedEdges & transition.mustBeClearEdges)
-                    {
-                        continue;
-                    }
-
-                    if (transition.atLeastOneClearEdges == 0)
-                    {
-                        return movementEdge;
-                    }
-
-                    auto occupiedAreas = station->airportMovementOccupiedEdges & transition.atLeastOneClearEdges;
-                    if (occupiedAreas == transition.atLeastOneClearEdges)
-                    {
-                        continue;
-                    }
-
-                    return movementEdge;
-                }
-                return kAirportMovementNoValidEdge;
-            }
-            else
-            {
-                uint8_t targetNode = movementEdges[curEdge].nextNode;
-                if (status == Status::takingOff && movementNodes[targetNode].hasFlags(AirportMovementNodeFlags::takeoffEnd))
-                {
-                    return kAirportMovementNodeNull;
-                }
-                // 0x4272A5
-                Vehicle train(head);
-                auto vehObject = ObjectManager::get<VehicleObject>(train.cars.firstCar.front->objectId);
-                if (vehObject->hasFlags(VehicleObjectFlags::aircraftIsHelicopter))
-                {
-                    for (uint8_t movementEdge = 0; movementEdge < airportObject->numMovementEdges; movementEdge++)
-                    {
-                        const auto& transition = movementEdges[movementEdge];
-
-                        if (transition.curNode != targetNode)
-                        {
-                            continue;
-                        }
-
-                        if (movementNodes[transition.nextNode].hasFlags(AirportMovementNodeFlags::takeoffBegin))
-                        {
-                            continue;
-                        }
-
-                        if (station->airportMovementOccupiedEdges & transition.mustBeClearEdges)
-                        {
-                            continue;
-                        }
-
-                        if (transition.atLeastOneClearEdges == 0)
-                        {
-                            return movementEdge;
-                        }
-
-                        auto occupiedAreas = station->airportMovementOccupiedEdges & transition.atLeastOneClearEdges;
-                        if (occupiedAreas == transition.atLeastOneClearEdges)
-                        {
-                            continue;
-                        }
-                        return movementEdge;
-                    }
-
-                    return kAirportMovementNoValidEdge;
-                }
-                else
-                {
-                    for (uint8_t movementEdge = 0; movementEdge < airportObject->numMovementEdges; movementEdge++)
-                    {
-                        const auto& transition = movementEdges[movementEdge];
-                        if (transition.curNode != targetNode)
-                        {
-                            continue;
-                        }
-
-                        if (movementNodes[transition.nextNode].hasFlags(AirportMovementNodeFlags::heliTakeoffBegin))
-                        {
-                            continue;
-                        }
-
-                        if (station->airportMovementOccupiedEdges & transition.mustBeClearEdges)
-                        {
-                            continue;
-                        }
-
-                        if (transition.atLeastOneClearEdges == 0)
-                        {
-                            return movementEdge;
-                        }
-
-                        auto occupiedAreas = station->airportMovementOccupiedEdges & transition.atLeastOneClearEdges;
-                        if (occupiedAreas == transition.atLeastOneClearEdges)
-                        {
-                            continue;
-                        }
-
-                        return movementEdge;
-                    }
-                    return kAirportMovementNoValidEdge;
-                }
-            }
+            Vehicle train(head);
+            auto vehObject = ObjectManager::get<VehicleObject>(train.cars.firstCar.front->objectId);
+            const auto isHelicopter = vehObject->hasFlags(VehicleObjectFlags::aircraftIsHelicopter);
+            return graph->getNextEdge(curEdge, station->airportMovementOccupiedEdges, status == Status::takingOff, isHelicopter);
         }
 
         // Tile not found. Todo: fail gracefully
@@ -3643,12 +3460,6 @@ namespace OpenLoco::Vehicles
         }
     }
 
-    struct NearbyBoats
-    {
-        std::array<std::array<bool, 16>, 16> searchResult; // 0x00525BEC
-        World::TilePos2 startTile;                         // 0x00525BE8
-    };
-
     // 0x00427F1C
     static NearbyBoats findNearbyTilesWithBoats(const World::Pos2 pos)
     {
@@ -3658,7 +3469,9 @@ namespace OpenLoco::Vehicles
         NearbyBoats res{};
         res.startTile = tilePosA;
 
-        for (const auto& tileLoc : getClampedRange(tilePosA, tilePosB))
+        const auto clampedA = World::TilePos2(World::clampTileCoord(tilePosA.x), World::clampTileCoord(tilePosA.y));
+        const auto clampedB = World::TilePos2(World::clampTileCoord(tilePosB.x), World::clampTileCoord(tilePosB.y));
+        for (const auto& tileLoc : EntityManager::OccupiedTileList(clampedA, clampedB))
         {
             for (auto* entity : EntityManager::EntityTileList(World::toWorldSpace(tileLoc)))
             {
@@ -3736,77 +3549,23 @@ namespace OpenLoco::Vehicles
         return std::nullopt;
     }
 
-    struct PathFindingResult
+    // Ships can only reach a target on the water if it is on the same body of water as one of the tiles they could move to
+    static bool isTargetUnreachable(const World::TilePos2 initialTile, const MicroZ waterMicroZ, const World::TilePos2 targetOrderPos)
     {
-        uint16_t bestScore;
-        uint8_t cost;
-
-        constexpr auto operator<=>(const PathFindingResult& rhs) const = default;
-    };
-
-    // 0x00428237
-    static PathFindingResult waterPathfindToTarget(const World::TilePos2 tilePos, const MicroZ waterMicroZ, const World::TilePos2 targetOrderPos, const NearbyBoats& nearbyVehicles, uint8_t cost, const PathFindingResult& bestResult)
-    {
-        PathFindingResult result = bestResult;
-        if (!validCoords(tilePos))
+        const auto targetRegion = WaterRegions::getRegion(targetOrderPos);
+        if (targetRegion == WaterRegions::kNullRegion)
         {
-            return result;
-        }
-
-        auto tile = TileManager::get(tilePos);
-        auto* surfaceEntry = tile.surfaceEntry();
-        if (surfaceEntry == nullptr)
-        {
-            return result;
-        }
-
-        auto* surfaceEl = surfaceEntry->as<SurfaceElement>();
-        if (surfaceEl != nullptr && surfaceEl->water() != waterMicroZ)
-        {
-            return result;
-        }
-        if (!surfaceEntry->isLast())
-        {
-            auto* elObsticle = surfaceEntry->next();
-            if (elObsticle != nullptr && !elObsticle->isGhost() && !elObsticle->isAiAllocated())
-            {
-                if (elObsticle->baseZ() / kMicroToSmallZStep - waterMicroZ < 1)
-                {
-                    return result;
-                }
-            }
-        }
-
-        const auto nearbyIndex = tilePos - nearbyVehicles.startTile;
-        // Vanilla made a mistake here so we only check nearby tiles if in range
-        // TODO: When we diverge just change the cost check to >= 6 or increase the search result to 18x18
-        if (nearbyIndex.x >= 0 && nearbyIndex.x < 16 && nearbyIndex.y >= 0 && nearbyIndex.y < 16)
-        {
-            if (nearbyVehicles.searchResult[nearbyIndex.x][nearbyIndex.y])
-            {
-                return result;
-            }
+            return false;
         }
-        auto distToTarget = toWorldSpace(tilePos - targetOrderPos);
-        distToTarget.x = std::abs(distToTarget.x);
-        distToTarget.y = std::abs(distToTarget.y);
-        // Lower is better
-        const uint16_t score = std::max(distToTarget.x, distToTarget.y) + std::min(distToTarget.x, distToTarget.y) / 16;
-        auto newResult = PathFindingResult{ score, cost };
-        result = std::min(result, newResult);
-        if (score != 0)
+        for (auto i = 0U; i < 4; ++i)
         {
-            if (cost >= 7)
-            {
-                return result;
-            }
-            cost++;
-            for (auto i = 0U; i < 4; ++i)
+            const auto tilePos = initialTile + toTileSpace(kRotationOffset[i]);
+            if (WaterRegions::getRegion(tilePos) == targetRegion && TileManager::get(tilePos).surface()->water() == waterMicroZ)
             {
-                result = waterPathfindToTarget(tilePos + toTileSpace(kRotationOffset[i]), waterMicroZ, targetOrderPos, nearbyVehicles, cost, result);
+                return false;
             }
         }
-        return result;
+        return true;
     }
 
     // 0x00427FC9
@@ -3853,13 +3612,19 @@ namespace OpenLoco::Vehicles
         const auto initialTile = toTileSpace(head.position);
         const auto waterMicroZ = veh2.position.z / World::kMicroZStep;
 
+        // Give up straight away rather than wander towards a target on another body of water
+        if (isTargetUnreachable(initialTile, waterMicroZ, targetOrderPos))
+        {
+            return WaterPathingResult(toWorldSpace(initialTile) + World::Pos2(16, 16));
+        }
+
         PathFindingResult bestResult{ std::numeric_limits<uint16_t>::max(), std::numeric_limits<uint8_t>::max() };
         uint8_t bestResultDirection = 0xFFU;
         for (auto i = 0U; i < 4; ++i)
         {
             const auto tilePos = initialTile + toTileSpace(kRotationOffset[i]);
             PathFindingResult initResult{ std::numeric_limits<uint16_t>::max(), std::numeric_limits<uint8_t>::max() };
-            const auto pathResult = waterPathfindToTarget(tilePos, waterMicroZ, targetOrderPos, nearbyVehicles, 0, initResult);
+            const auto pathResult = waterPathfindToTarget(tilePos, waterMicroZ, targetOrderPos, nearbyVehicles, initResult);
             if (pathResult != initResult && (pathResult < bestResult || (pathResult == bestResult && i == curRotation)))
             {
                 bestResult = pathResult;
@@ -6628,8 +6393,8 @@ namespace OpenLoco::Vehicles
             updateRoadTileOccupancy(newPos, newTad.road, true);
         }
 
-        auto& moveInfo = mode == TransportMode::road ? World::TrackData::getRoadSubPositon(trackAndDirection.road._data)[subPosition]
-                                                     : World::TrackData::getTrackSubPositon(trackAndDirection.track._data)[subPosition];
+        const auto moveInfo = mode == TransportMode::road ? World::TrackData::getRoadSubPositon(trackAndDirection.road._data)[subPosition]
+                                                          : World::TrackData::getTrackSubPositon(trackAndDirection.track._data)[subPosition];
 
         const auto newEntityPos = newPos + moveInfo.loc;
 
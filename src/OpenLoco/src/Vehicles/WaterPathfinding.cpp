@@ -0,0 +1,114 @@
+#include "Vehicles/WaterPathfinding.h"
+#include "Map/SurfaceElement.h"
+#include "Map/Tile.h"
+#include "Map/TileManager.h"
+#include <algorithm>
+#include <cstdlib>
+#include <utility>
+
+using namespace OpenLoco::World;
+
+namespace OpenLoco::Vehicles
+{
+    // Part of 0x00428237
+    bool isWaterTilePassable(const World::TilePos2 tilePos, const MicroZ waterMicroZ, const NearbyBoats& nearbyVehicles)
+    {
+        if (!validCoords(tilePos))
+        {
+            return false;
+        }
+
+        auto tile = TileManager::get(tilePos);
+        auto* surfaceEntry = tile.surfaceEntry();
+        if (surfaceEntry == nullptr)
+        {
+            return false;
+        }
+
+        auto* surfaceEl = surfaceEntry->as<SurfaceElement>();
+        if (surfaceEl != nullptr && surfaceEl->water() != waterMicroZ)
+        {
+            return false;
+        }
+        if (!surfaceEntry->isLast())
+        {
+            auto* elObsticle = surfaceEntry->next();
+            if (elObsticle != nullptr && !elObsticle->isGhost() && !elObsticle->isAiAllocated())
+            {
+                if (elObsticle->baseZ() / kMicroToSmallZStep - waterMicroZ < 1)
+                {
+                    return false;
+                }
+            }
+        }
+
+        const auto nearbyIndex = tilePos - nearbyVehicles.startTile;
+        // Vanilla made a mistake here so we only check nearby tiles if in range
+        // TODO: When we diverge just change the cost check to >= 6 or increase the search result to 18x18
+        if (nearbyIndex.x >= 0 && nearbyIndex.x < 16 && nearbyIndex.y >= 0 && nearbyIndex.y < 16)
+        {
+            if (nearbyVehicles.searchResult[nearbyIndex.x][nearbyIndex.y])
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // 0x00428237
+    // Vanilla recursed into every path of up to 7 steps from tilePos, stopping at the target, and kept the lowest
+    // score and then cost. As the score only depends on the tile, that is the same as taking every tile within
+    // 7 steps with its shortest distance as the cost, which a breadth first search finds visiting each tile once.
+    PathFindingResult waterPathfindToTarget(const World::TilePos2 tilePos, const MicroZ waterMicroZ, const World::TilePos2 targetOrderPos, const NearbyBoats& nearbyVehicles, const PathFindingResult& bestResult)
+    {
+        constexpr uint8_t kMaxCost = 7;
+        constexpr auto kSearchSize = kMaxCost * 2 + 1;
+
+        PathFindingResult result = bestResult;
+        if (!isWaterTilePassable(tilePos, waterMicroZ, nearbyVehicles))
+        {
+            return result;
+        }
+
+        std::array<std::array<bool, kSearchSize>, kSearchSize> visited{};
+        std::array<std::pair<World::TilePos2, uint8_t>, kSearchSize * kSearchSize> queue;
+        size_t queueBegin = 0;
+        size_t queueEnd = 0;
+
+        const auto searchOrigin = tilePos - World::TilePos2(kMaxCost, kMaxCost);
+        visited[kMaxCost][kMaxCost] = true;
+        queue[queueEnd++] = { tilePos, 0 };
+        while (queueBegin != queueEnd)
+        {
+            const auto [pos, cost] = queue[queueBegin++];
+
+            auto distToTarget = toWorldSpace(pos - targetOrderPos);
+            distToTarget.x = std::abs(distToTarget.x);
+            distToTarget.y = std::abs(distToTarget.y);
+            // Lower is better
+            const uint16_t score = std::max(distToTarget.x, distToTarget.y) + std::min(distToTarget.x, distToTarget.y) / 16;
+            result = std::min(result, PathFindingResult{ score, cost });
+            if (score == 0 || cost >= kMaxCost)
+            {
+                continue;
+            }
+
+            for (auto i = 0U; i < 4; ++i)
+            {
+                const auto nextPos = pos + toTileSpace(kRotationOffset[i]);
+                const auto searchIndex = nextPos - searchOrigin;
+                auto& isVisited = visited[searchIndex.x][searchIndex.y];
+                if (isVisited)
+                {
+                    continue;
+                }
+                isVisited = true;
+                if (isWaterTilePassable(nextPos, waterMicroZ, nearbyVehicles))
+                {
+                    queue[queueEnd++] = { nextPos, static_cast<uint8_t>(cost + 1) };
+                }
+            }
+        }
+        return result;
+    }
+}
@@ -306,6 +306,21 @@ namespace OpenLoco::Ui::ViewportManager
         invalidate(rect, level);
     }
 
+    // Same as invalidating an entity sprite for things that are drawn like entities but do not keep their own sprite bounds
+    void invalidateSprite(const World::Pos3& pos, int16_t spriteWidth, int16_t spriteHeightNegative, int16_t spriteHeightPositive)
+    {
+        const auto vpPos = World::gameToScreen(pos, WindowManager::getCurrentRotation());
+
+        ViewportRect rect;
+        rect.left = vpPos.x - spriteWidth;
+        rect.top = vpPos.y - spriteHeightNegative;
+        rect.right = vpPos.x + spriteWidth;
+        rect.bottom = vpPos.y + spriteHeightPositive;
+
+        auto level = ZoomLevel{ std::min<int8_t>(Config::get().vehiclesMinScale, static_cast<int8_t>(ZoomLevel::eighth)) };
+        invalidate(rect, level);
+    }
+
     void invalidate(const World::Pos2 pos, coord_t zMin, coord_t zMax, ZoomLevel zoom, int radius)
     {
         auto axbx = World::gameToScreen(World::Pos3(pos.x + 16, pos.y + 16, zMax), WindowManager::getCurrentRotation());
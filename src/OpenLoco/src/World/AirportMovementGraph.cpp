@@ -0,0 +1,85 @@
+#include "World/AirportMovementGraph.h"
+#include "Vehicles/Vehicle.h"
+#include <OpenLoco/Math/Vector.hpp>
+
+namespace OpenLoco
+{
+    void AirportMovementGraph::build(const AirportObject& airportObj, uint8_t airportObjectId, const World::Pos3& airportStartPos, uint8_t airportRotation)
+    {
+        const auto movementNodes = airportObj.getMovementNodes();
+        const auto movementEdges = airportObj.getMovementEdges();
+
+        startPos = airportStartPos;
+        objectId = airportObjectId;
+        rotation = airportRotation;
+
+        nodes.clear();
+        for (const auto& movementNode : movementNodes)
+        {
+            auto nodeOffset = Math::Vector::rotate(World::Pos2(movementNode.x, movementNode.y) - World::Pos2(16, 16), airportRotation) + World::Pos2(16, 16);
+            auto nodeLoc = World::Pos3{ nodeOffset.x, nodeOffset.y, movementNode.z } + airportStartPos;
+            if (!movementNode.hasFlags(AirportMovementNodeFlags::taxiing))
+            {
+                nodeLoc.z = airportStartPos.z + 255;
+                if (!movementNode.hasFlags(AirportMovementNodeFlags::inFlight))
+                {
+                    nodeLoc.z = 30 * 32;
+                }
+            }
+            nodes.push_back(Node{ nodeLoc, movementNode.flags });
+        }
+
+        edges.assign(movementEdges.begin(), movementEdges.end());
+        edgesFromNode.assign(nodes.size(), {});
+        entryEdges.clear();
+        for (uint8_t i = 0; i < edges.size(); ++i)
+        {
+            const auto curNode = edges[i].curNode;
+            if (curNode >= nodes.size())
+            {
+                continue;
+            }
+            edgesFromNode[curNode].push_back(i);
+            if (nodes[curNode].hasFlags(AirportMovementNodeFlags::flag2))
+            {
+                entryEdges.push_back(i);
+            }
+        }
+    }
+
+    uint8_t AirportMovementGraph::getNextEdge(uint8_t curEdge, uint32_t occupiedEdges, bool isTakingOff, bool isHelicopter) const
+    {
+        if (curEdge == Vehicles::kAirportMovementNodeNull)
+        {
+            for (const auto movementEdge : entryEdges)
+            {
+                if (canUseEdge(movementEdge, occupiedEdges))
+                {
+                    return movementEdge;
+                }
+            }
+            return Vehicles::kAirportMovementNoValidEdge;
+        }
+
+        const auto targetNode = edges[curEdge].nextNode;
+        if (isTakingOff && nodes[targetNode].hasFlags(AirportMovementNodeFlags::takeoffEnd))
+        {
+            return Vehicles::kAirportMovementNodeNull;
+        }
+
+        // Helicopters never take the runway and planes never take the helipad
+        const auto excludedTarget = isHelicopter ? AirportMovementNodeFlags::takeoffBegin : AirportMovementNodeFlags::heliTakeoffBegin;
+        for (const auto movementEdge : getEdgesFrom(targetNode))
+        {
+            if (getEdgeTarget(movementEdge).hasFlags(excludedTarget))
+            {
+                continue;
+            }
+            if (canUseEdge(movementEdge, occupiedEdges))
+            {
+                return movementEdge;
+            }
+        }
+        return Vehicles::kAirportMovementNoValidEdge;
+    }
+}
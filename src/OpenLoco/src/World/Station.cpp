@@ -29,12 +29,14 @@
 #include "Random.h"
 #include "Ui/WindowManager.h"
 #include "ViewportManager.h"
+#include "World/AirportMovementGraph.h"
 #include "World/CompanyManager.h"
 #include "World/IndustryManager.h"
 #include "World/StationManager.h"
 #include "World/TownManager.h"
 #include <OpenLoco/Math/Bound.hpp>
 #include <algorithm>
+#include <array>
 #include <cassert>
 
 using namespace OpenLoco::World;
@@ -1375,49 +1377,88 @@ namespace OpenLoco
         return label_icons[label];
     }
 
-    // 0x00426D52
-    // used to return NodeMovementFlags on ebx
-    std::optional<World::Pos3> getAirportMovementNodeLoc(const StationId stationId, uint8_t node)
+    static World::StationElement* findAirportElement(const Station& station)
     {
-        auto* station = StationManager::get(stationId);
-        auto tile = World::TileManager::get(station->airportStartPos);
-        World::StationElement* elStation = nullptr;
+        auto tile = World::TileManager::get(station.airportStartPos);
         for (auto& el : tile)
         {
-            elStation = el.as<World::StationElement>();
+            auto* elStation = el.as<World::StationElement>();
             if (elStation == nullptr)
             {
                 continue;
             }
 
-            if (elStation->baseZ() != station->airportStartPos.z / 4)
+            if (elStation->baseZ() != station.airportStartPos.z / 4)
             {
-                elStation = nullptr;
                 continue;
             }
-            break;
+            return elStation;
         }
+        return nullptr;
+    }
 
+    struct CachedAirportMovementGraph
+    {
+        AirportMovementGraph graph;
+        bool isValid = false;
+    };
+    static std::array<CachedAirportMovementGraph, Limits::kMaxStations> _airportMovementGraphs;
+
+    const AirportMovementGraph* getAirportMovementGraph(const StationId stationId)
+    {
+        auto* station = StationManager::get(stationId);
+        if (station == nullptr)
+        {
+            return nullptr;
+        }
+
+        auto& cached = _airportMovementGraphs[enumValue(stationId)];
+        const auto* elStation = findAirportElement(*station);
         if (elStation == nullptr)
         {
-            return {};
+            cached.isValid = false;
+            return nullptr;
         }
 
-        auto* airportObj = ObjectManager::get<AirportObject>(elStation->objectId());
-        const auto movementNodes = airportObj->getMovementNodes();
+        // The airport can be replaced by another airport object or rotation without the station changing
+        if (cached.isValid && cached.graph.startPos == station->airportStartPos && cached.graph.objectId == elStation->objectId() && cached.graph.rotation == elStation->rotation())
+        {
+            return &cached.graph;
+        }
 
-        const auto& movementNode = movementNodes[node];
-        auto nodeOffset = Math::Vector::rotate(World::Pos2(movementNode.x, movementNode.y) - World::Pos2(16, 16), elStation->rotation()) + World::Pos2(16, 16);
-        auto nodeLoc = World::Pos3{ nodeOffset.x, nodeOffset.y, movementNode.z } + station->airportStartPos;
-        if (!movementNode.hasFlags(AirportMovementNodeFlags::taxiing))
+        const auto* airportObj = ObjectManager::get<AirportObject>(elStation->objectId());
+        cached.graph.build(*airportObj, elStation->objectId(), station->airportStartPos, elStation->rotation());
+        cached.isValid = true;
+        return &cached.graph;
+    }
+
+    void invalidateAirportMovementGraph(const StationId stationId)
+    {
+        const auto index = enumValue(stationId);
+        if (index < _airportMovementGraphs.size())
         {
-            nodeLoc.z = station->airportStartPos.z + 255;
-            if (!movementNode.hasFlags(AirportMovementNodeFlags::inFlight))
-            {
-                nodeLoc.z = 30 * 32;
-            }
+            _airportMovementGraphs[index].isValid = false;
+        }
+    }
+
+    void resetAirportMovementGraphs()
+    {
+        for (auto& cached : _airportMovementGraphs)
+        {
+            cached.isValid = false;
+        }
+    }
+
+    // 0x00426D52
+    // used to return NodeMovementFlags on ebx
+    std::optional<World::Pos3> getAirportMovementNodeLoc(const StationId stationId, uint8_t node)
+    {
+        const auto* graph = getAirportMovementGraph(stationId);
+        if (graph == nullptr)
+        {
+            return {};
         }
-        return { nodeLoc };
+        return { graph->nodes[node].loc };
     }
 
     // 0x0048DBC2
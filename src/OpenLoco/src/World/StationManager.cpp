@@ -19,6 +19,7 @@
 #include "Ui/Windows/Construction/Construction.h"
 #include "Vehicles/OrderManager.h"
 #include "Vehicles/VehicleManager.h"
+#include "World/AirportMovementGraph.h"
 #include "World/CompanyManager.h"
 #include "World/IndustryManager.h"
 #include "World/TownManager.h"
@@ -44,6 +45,7 @@ namespace OpenLoco::StationManager
         {
             station.name = StringIds::null;
         }
+        resetAirportMovementGraphs();
         Ui::Windows::Station::reset();
     }
 
@@ -687,6 +689,7 @@ namespace OpenLoco::StationManager
         {
             return;
         }
+        invalidateAirportMovementGraph(stationId);
 
         if ((station->flags & StationFlags::flag_5) == StationFlags::none)
         {
@@ -34,6 +34,7 @@
 #include <OpenLoco/Core/Numerics.hpp>
 #include <algorithm>
 #include <bit>
+#include <bitset>
 
 using namespace OpenLoco::World;
 
@@ -1520,15 +1521,83 @@ namespace OpenLoco
         }
     }
 
-    struct RoadExtentResult
+    // Offset of the bottom left corner of kSquareSearchRange<9> from the centre tile
+    constexpr auto kSquareSearchMin = []() {
+        World::TilePos2 min{ 0, 0 };
+        for (auto& offset : kSquareSearchRange<9>)
+        {
+            min.x = std::min(min.x, offset.x);
+            min.y = std::min(min.y, offset.y);
+        }
+        return min;
+    }();
+
+    // Inverse of kSquareSearchRange<9>: the spiral index of each tile offset from the centre
+    constexpr auto kSquareSearchIndex = []() {
+        std::array<std::array<uint8_t, 10>, 10> index{};
+        for (uint8_t i = 0; i < kSquareSearchRange<9>.size(); ++i)
+        {
+            const auto& offset = kSquareSearchRange<9>[i];
+            index[offset.x - kSquareSearchMin.x][offset.y - kSquareSearchMin.y] = i;
+        }
+        return index;
+    }();
+
+    // Growth only looks for roads within kSquareSearchRange<9> of the town centre, so each town
+    // keeps track of which entries of that spiral have had a road element on them. This is a
+    // superset: bits are set whenever a road is inserted and only cleared once findRoadExtent
+    // visits the tile and finds no road left. It is not part of the game state and is rebuilt
+    // lazily after the tile elements are replaced.
+    struct TownRoadIndex
     {
-        World::Pos3 roadStart;
-        uint16_t tad;
-        bool isBridge;
+        World::TilePos2 centre;
+        std::bitset<kSquareSearchRange<9>.size()> roadTiles;
+        bool isValid = false;
     };
+    static std::array<TownRoadIndex, Limits::kMaxTowns> _roadIndex;
+
+    static bool tileHasRoad(const World::Pos2& loc)
+    {
+        auto tile = World::TileManager::get(loc);
+        for (auto& el : tile)
+        {
+            if (el.type() == World::ElementType::road)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    static TownRoadIndex& getRoadIndex(const Town& town)
+    {
+        auto& index = _roadIndex[enumValue(town.id())];
+        const auto centre = World::toTileSpace(World::Pos2{ town.x, town.y });
+        if (index.isValid && index.centre == centre)
+        {
+            return index;
+        }
+
+        index.centre = centre;
+        index.roadTiles.reset();
+        for (size_t i = 0; i < kSquareSearchRange<9>.size(); ++i)
+        {
+            const World::Pos2 pos = World::toWorldSpace(kSquareSearchRange<9>[i]) + World::Pos2{ town.x, town.y };
+            if (World::validCoords(pos) && tileHasRoad(pos))
+            {
+                index.roadTiles.set(i);
+            }
+        }
+        index.isValid = true;
+        return index;
+    }
+
+    // Set by tests to compare the road index against walking every tile
+    static bool _useRoadIndex = true;
 
     // 0x00497FFC
-    static std::optional<RoadExtentResult> findRoadExtent(const Town& town)
+    // Picks one of the roads near the town centre at random
+    std::optional<TownRoadExtent> Town::findRoadExtent() const
     {
         struct FindResult
         {
@@ -1539,11 +1608,17 @@ namespace OpenLoco
         std::optional<FindResult> res;
 
         // 0x00497F74
-        auto validRoad = [randVal = town.prng.srand_0(), &res](const World::Pos2& loc) mutable {
+        // Returns false if the tile no longer has any road elements on it
+        auto validRoad = [randVal = prng.srand_0(), &res](const World::Pos2& loc) mutable {
             auto tile = World::TileManager::get(loc);
             bool hasPassedSurface = false;
+            bool hasRoad = false;
             for (auto& el : tile)
             {
+                if (el.type() == World::ElementType::road)
+                {
+                    hasRoad = true;
+                }
                 auto* elSurface = el.as<World::SurfaceElement>();
                 if (elSurface != nullptr)
                 {
@@ -1567,8 +1642,7 @@ namespace OpenLoco
                 {
                     continue;
                 }
-                auto* roadObj = ObjectManager::get<RoadObject>(elRoad->roadObjectId());
-                if (!roadObj->hasFlags(RoadObjectFlags::anyRoadTypeCompatible))
+                if (!(getGameState().roadObjectIdIsAnyRoadTypeCompatible & (1U << elRoad->roadObjectId())))
                 {
                     continue;
                 }
@@ -1585,9 +1659,34 @@ namespace OpenLoco
                 res = FindResult{ loc, elRoad };
                 return true;
             }
-            return true;
+            return hasRoad;
         };
-        squareSearch({ town.x, town.y }, 9, validRoad);
+
+        if (_useRoadIndex)
+        {
+            // Equivalent to squareSearch but only visits the tiles that may have roads, which is
+            // enough as tiles without an eligible road do not consume any bits of randVal.
+            auto& index = getRoadIndex(*this);
+            for (size_t i = 0; i < kSquareSearchRange<9>.size(); ++i)
+            {
+                if (!index.roadTiles.test(i))
+                {
+                    continue;
+                }
+                const World::Pos2 pos = World::toWorldSpace(kSquareSearchRange<9>[i]) + World::Pos2{ x, y };
+                if (World::validCoords(pos) && !validRoad(pos))
+                {
+                    index.roadTiles.reset(i);
+                }
+            }
+        }
+        else
+        {
+            squareSearch({ x, y }, 9, [&validRoad](const World::Pos2& loc) {
+                validRoad(loc);
+                return true;
+            });
+        }
 
         if (!res.has_value())
         {
@@ -1595,7 +1694,7 @@ namespace OpenLoco
         }
 
         auto& roadPiece = World::TrackData::getRoadPiece(res->elRoad->roadId());
-        return RoadExtentResult{
+        return TownRoadExtent{
             World::Pos3(res->loc, res->elRoad->baseHeight() - roadPiece[0].z),
             static_cast<uint16_t>((res->elRoad->roadId() << 3) | res->elRoad->rotation()),
             res->elRoad->hasBridge()
@@ -1650,7 +1749,7 @@ namespace OpenLoco
         const auto oldUpatingCompany = GameCommands::getUpdatingCompanyId();
         GameCommands::setUpdatingCompanyId(CompanyId::neutral);
 
-        const auto extent = findRoadExtent(*this);
+        const auto extent = findRoadExtent();
         if (!extent.has_value())
         {
             if ((growFlags & TownGrowFlags::buildInitialRoad) != TownGrowFlags::none)
@@ -1803,3 +1902,37 @@ namespace OpenLoco
         return StringIds::town_size_hamlet;
     }
 }
+
+namespace OpenLoco::TownManager
+{
+    void resetRoadIndex()
+    {
+        for (auto& index : _roadIndex)
+        {
+            index.isValid = false;
+        }
+    }
+
+    void setRoadIndexEnabled(bool enabled)
+    {
+        _useRoadIndex = enabled;
+    }
+
+    void registerRoadTile(const World::Pos2& loc)
+    {
+        const auto tile = World::toTileSpace(loc);
+        for (auto& index : _roadIndex)
+        {
+            if (!index.isValid)
+            {
+                continue;
+            }
+            const auto offset = tile - index.centre - kSquareSearchMin;
+            if (offset.x < 0 || offset.x >= 10 || offset.y < 0 || offset.y >= 10)
+            {
+                continue;
+            }
+            index.roadTiles.set(kSquareSearchIndex[offset.x][offset.y]);
+        }
+    }
+}
@@ -366,54 +366,44 @@ namespace OpenLoco::TownManager
             std::fill(std::begin(town.amenityCounts), std::end(town.amenityCounts), 0);
         }
 
-        for (const auto& tilePos : World::getWorldRange())
-        {
-            auto tile = World::TileManager::get(tilePos);
-            for (auto& element : tile)
+        // Only sums into the towns so the order the buildings are visited in does not matter
+        World::TileManager::forEachElement<World::BuildingElement>([](const World::BuildingElement& building, const World::TilePos2 tilePos) {
+            if (building.isGhost())
             {
-                auto* building = element.as<World::BuildingElement>();
-                if (building == nullptr)
-                {
-                    continue;
-                }
-
-                if (building->isGhost())
-                {
-                    continue;
-                }
+                return;
+            }
 
-                if (building->isMiscBuilding())
-                {
-                    continue;
-                }
+            if (building.isMiscBuilding())
+            {
+                return;
+            }
 
-                if (building->sequenceIndex() != 0)
-                {
-                    continue;
-                }
+            if (building.sequenceIndex() != 0)
+            {
+                return;
+            }
 
-                auto objectId = building->objectId();
-                auto* buildingObj = ObjectManager::get<BuildingObject>(objectId);
-                auto producedQuantity = buildingObj->producedQuantity[0];
-                uint32_t population;
-                if (!building->isConstructed())
-                {
-                    population = 0;
-                }
-                else
-                {
-                    population = producedQuantity;
-                }
-                auto* town = updateTownInfo(World::toWorldSpace(tilePos), population, producedQuantity, 0, 1);
-                if (town != nullptr)
+            auto objectId = building.objectId();
+            auto* buildingObj = ObjectManager::get<BuildingObject>(objectId);
+            auto producedQuantity = buildingObj->producedQuantity[0];
+            uint32_t population;
+            if (!building.isConstructed())
+            {
+                population = 0;
+            }
+            else
+            {
+                population = producedQuantity;
+            }
+            auto* town = updateTownInfo(World::toWorldSpace(tilePos), population, producedQuantity, 0, 1);
+            if (town != nullptr)
+            {
+                if (buildingObj->townAmenityCategory != TownAmenityCategory::none)
                 {
-                    if (buildingObj->townAmenityCategory != TownAmenityCategory::none)
-                    {
-                        town->amenityCounts[enumValue(buildingObj->townAmenityCategory)] += 1;
-                    }
+                    town->amenityCounts[enumValue(buildingObj->townAmenityCategory)] += 1;
                 }
             }
-        }
+        });
         Gfx::invalidateScreen();
     }
 
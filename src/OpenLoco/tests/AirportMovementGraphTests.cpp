@@ -0,0 +1,226 @@
+#include <OpenLoco/Math/Vector.hpp>
+#include <OpenLoco/Objects/AirportObject.h>
+#include <OpenLoco/Vehicles/Vehicle.h>
+#include <OpenLoco/World/AirportMovementGraph.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+using namespace OpenLoco;
+using namespace OpenLoco::World;
+using namespace OpenLoco::Vehicles;
+
+namespace
+{
+    constexpr AirportMovementNodeFlags kNodeFlags[] = {
+        AirportMovementNodeFlags::terminal,
+        AirportMovementNodeFlags::takeoffEnd,
+        AirportMovementNodeFlags::flag2,
+        AirportMovementNodeFlags::taxiing,
+        AirportMovementNodeFlags::inFlight,
+        AirportMovementNodeFlags::heliTakeoffBegin,
+        AirportMovementNodeFlags::takeoffBegin,
+    };
+
+    // An airport object followed by its movement nodes and edges, laid out as AirportObject::load leaves it
+    class TestAirport
+    {
+        std::vector<uint8_t> _data;
+
+    public:
+        TestAirport(const std::vector<AirportObject::MovementNode>& nodes, const std::vector<AirportObject::MovementEdge>& edges)
+        {
+            const auto nodesSize = nodes.size() * sizeof(AirportObject::MovementNode);
+            const auto edgesSize = edges.size() * sizeof(AirportObject::MovementEdge);
+            _data.resize(sizeof(AirportObject) + nodesSize + edgesSize);
+
+            AirportObject airport{};
+            airport.numMovementNodes = static_cast<uint8_t>(nodes.size());
+            airport.numMovementEdges = static_cast<uint8_t>(edges.size());
+            airport.movementNodesOffset = sizeof(AirportObject);
+            airport.movementEdgesOffset = static_cast<uint32_t>(sizeof(AirportObject) + nodesSize);
+            std::memcpy(_data.data(), &airport, sizeof(AirportObject));
+            std::memcpy(_data.data() + airport.movementNodesOffset, nodes.data(), nodesSize);
+            std::memcpy(_data.data() + airport.movementEdgesOffset, edges.data(), edgesSize);
+        }
+
+        const AirportObject& get() const
+        {
+            return *reinterpret_cast<const AirportObject*>(_data.data());
+        }
+    };
+
+    TestAirport createRandomAirport(std::mt19937& rng)
+    {
+        std::vector<AirportObject::MovementNode> nodes(1 + rng() % 24);
+        for (auto& node : nodes)
+        {
+            node.x = static_cast<int16_t>(rng() % 256) - 64;
+            node.y = static_cast<int16_t>(rng() % 256) - 64;
+            node.z = static_cast<int16_t>(rng() % 64);
+            node.flags = AirportMovementNodeFlags::none;
+            for (const auto flag : kNodeFlags)
+            {
+                if (rng() % 4 == 0)
+                {
+                    node.flags |= flag;
+                }
+            }
+        }
+
+        // Now and again an edge starts from a node the airport does not have, so it is never taken
+        const auto numFromNodes = rng() % 4 == 0 ? nodes.size() + 1 : nodes.size();
+        std::vector<AirportObject::MovementEdge> edges(1 + rng() % 32);
+        for (auto& edge : edges)
+        {
+            edge.var_00 = static_cast<uint8_t>(rng());
+            edge.curNode = static_cast<uint8_t>(rng() % numFromNodes);
+            edge.nextNode = static_cast<uint8_t>(rng() % nodes.size());
+            edge.var_03 = static_cast<uint8_t>(rng());
+            edge.mustBeClearEdges = rng() % 2 == 0 ? 0 : (1U << (rng() % 32)) | (1U << (rng() % 32));
+            edge.atLeastOneClearEdges = rng() % 2 == 0 ? 0 : (1U << (rng() % 32)) | (1U << (rng() % 32));
+        }
+        return TestAirport(nodes, edges);
+    }
+
+    // The original lookup, rotating the target node of the edge out of the airport object
+    Pos3 getEdgeTargetFromObject(const AirportObject& airport, const Pos3& stationLoc, uint8_t rotation, uint8_t curEdge)
+    {
+        const auto movementNodes = airport.getMovementNodes();
+        const auto movementEdges = airport.getMovementEdges();
+
+        auto destinationNode = movementEdges[curEdge].nextNode;
+
+        Pos2 loc2 = {
+            static_cast<int16_t>(movementNodes[destinationNode].x - 16),
+            static_cast<int16_t>(movementNodes[destinationNode].y - 16)
+        };
+        loc2 = Math::Vector::rotate(loc2, rotation);
+        auto airportMovement = movementNodes[destinationNode];
+
+        loc2.x += 16 + stationLoc.x;
+        loc2.y += 16 + stationLoc.y;
+
+        Pos3 loc = { loc2.x, loc2.y, static_cast<int16_t>(movementNodes[destinationNode].z + stationLoc.z) };
+
+        if (!airportMovement.hasFlags(AirportMovementNodeFlags::taxiing))
+        {
+            loc.z = stationLoc.z + 255;
+            if (!airportMovement.hasFlags(AirportMovementNodeFlags::inFlight))
+            {
+                loc.z = 960;
+            }
+        }
+        return loc;
+    }
+
+    bool canUseEdgeFromObject(const AirportObject::MovementEdge& transition, uint32_t occupiedEdges)
+    {
+        if (occupiedEdges & transition.mustBeClearEdges)
+        {
+            return false;
+        }
+        if (transition.atLeastOneClearEdges == 0)
+        {
+            return true;
+        }
+        auto occupiedAreas = occupiedEdges & transition.atLeastOneClearEdges;
+        return occupiedAreas != transition.atLeastOneClearEdges;
+    }
+
+    // The original edge selection, walking every edge of the airport object
+    uint8_t getNextEdgeFromObject(const AirportObject& airport, uint8_t curEdge, uint32_t occupiedEdges, bool isTakingOff, bool isHelicopter)
+    {
+        const auto movementNodes = airport.getMovementNodes();
+        const auto movementEdges = airport.getMovementEdges();
+
+        if (curEdge == kAirportMovementNodeNull)
+        {
+            for (uint8_t movementEdge = 0; movementEdge < airport.numMovementEdges; movementEdge++)
+            {
+                const auto& transition = movementEdges[movementEdge];
+                if (!movementNodes[transition.curNode].hasFlags(AirportMovementNodeFlags::flag2))
+                {
+                    continue;
+                }
+                if (canUseEdgeFromObject(transition, occupiedEdges))
+                {
+                    return movementEdge;
+                }
+            }
+            return kAirportMovementNoValidEdge;
+        }
+
+        uint8_t targetNode = movementEdges[curEdge].nextNode;
+        if (isTakingOff && movementNodes[targetNode].hasFlags(AirportMovementNodeFlags::takeoffEnd))
+        {
+            return kAirportMovementNodeNull;
+        }
+
+        const auto excludedTarget = isHelicopter ? AirportMovementNodeFlags::takeoffBegin : AirportMovementNodeFlags::heliTakeoffBegin;
+        for (uint8_t movementEdge = 0; movementEdge < airport.numMovementEdges; movementEdge++)
+        {
+            const auto& transition = movementEdges[movementEdge];
+            if (transition.curNode != targetNode)
+            {
+                continue;
+            }
+            if (movementNodes[transition.nextNode].hasFlags(excludedTarget))
+            {
+                continue;
+            }
+            if (canUseEdgeFromObject(transition, occupiedEdges))
+            {
+                return movementEdge;
+            }
+        }
+        return kAirportMovementNoValidEdge;
+    }
+}
+
+TEST(AirportMovementGraphTest, MatchesWalkingTheAirportObject)
+{
+    std::mt19937 rng(1);
+    for (auto trial = 0; trial < 500; trial++)
+    {
+        SCOPED_TRACE(trial);
+        const auto testAirport = createRandomAirport(rng);
+        const auto& airport = testAirport.get();
+        const auto startPos = Pos3(static_cast<coord_t>(rng() % 384) * 32, static_cast<coord_t>(rng() % 384) * 32, static_cast<coord_t>(rng() % 64) * 4);
+
+        for (uint8_t rotation = 0; rotation < 4; rotation++)
+        {
+            SCOPED_TRACE(rotation);
+            AirportMovementGraph graph;
+            graph.build(airport, 0, startPos, rotation);
+
+            for (uint8_t edge = 0; edge < airport.numMovementEdges; edge++)
+            {
+                const auto& target = graph.getEdgeTarget(edge);
+                ASSERT_EQ(target.loc, getEdgeTargetFromObject(airport, startPos, rotation, edge));
+                ASSERT_EQ(target.flags, airport.getMovementNodes()[airport.getMovementEdges()[edge].nextNode].flags);
+            }
+
+            for (auto i = 0; i < 40; i++)
+            {
+                // Mostly clear airports, where the bit tests decide between the edges
+                const uint32_t occupiedEdges = rng() % 2 == 0 ? rng() : rng() & rng() & rng();
+                const auto curEdge = rng() % 4 == 0 ? kAirportMovementNodeNull : static_cast<uint8_t>(rng() % airport.numMovementEdges);
+                const auto isTakingOff = rng() % 2 == 0;
+                const auto isHelicopter = rng() % 2 == 0;
+
+                // The original entry edge search would read past the nodes for an edge from a missing node
+                const auto movementEdges = airport.getMovementEdges();
+                if (curEdge == kAirportMovementNodeNull && std::any_of(movementEdges.begin(), movementEdges.end(), [&](const auto& e) { return e.curNode >= airport.numMovementNodes; }))
+                {
+                    continue;
+                }
+
+                ASSERT_EQ(graph.getNextEdge(curEdge, occupiedEdges, isTakingOff, isHelicopter), getNextEdgeFromObject(airport, curEdge, occupiedEdges, isTakingOff, isHelicopter));
+            }
+        }
+    }
+}
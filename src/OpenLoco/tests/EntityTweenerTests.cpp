@@ -0,0 +1,116 @@
+#include <OpenLoco/Entities/Entity.h>
+#include <OpenLoco/Entities/EntityManager.h>
+#include <OpenLoco/Entities/EntityTweener.h>
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+using namespace OpenLoco;
+
+namespace
+{
+    class EntityTweenerTest : public ::testing::Test
+    {
+    protected:
+        std::vector<EntityBase*> _entities;
+
+        void SetUp() override
+        {
+            EntityManager::reset();
+            EntityTweener::get().reset();
+
+            std::mt19937 rng(1);
+            for (auto i = 0; i < 500; i++)
+            {
+                auto* entity = EntityManager::createEntityMisc();
+                ASSERT_NE(entity, nullptr);
+                entity->baseType = EntityBaseType::effect;
+                entity->moveTo(World::Pos3(static_cast<coord_t>(128 + rng() % 3840), static_cast<coord_t>(128 + rng() % 3840), 0));
+                _entities.push_back(entity);
+            }
+        }
+
+        void TearDown() override
+        {
+            EntityTweener::get().reset();
+        }
+
+        // Every tile's entity list in list order
+        static std::vector<std::vector<EntityId>> captureTileLists()
+        {
+            std::vector<std::vector<EntityId>> lists;
+            for (auto y = 0; y < 136; y++)
+            {
+                for (auto x = 0; x < 136; x++)
+                {
+                    auto& list = lists.emplace_back();
+                    for (auto* entity : EntityManager::EntityTileList(World::toWorldSpace(World::TilePos2(x, y))))
+                    {
+                        list.push_back(entity->id);
+                    }
+                }
+            }
+            return lists;
+        }
+    };
+}
+
+TEST_F(EntityTweenerTest, TweeningLeavesPositionsAndSpatialIndexAlone)
+{
+    auto& tweener = EntityTweener::get();
+    tweener.preTick();
+
+    // Simulate a tick, most entities cross into a different tile
+    std::vector<World::Pos3> prevPositions;
+    std::vector<World::Pos3> postTickPositions;
+    for (auto* entity : _entities)
+    {
+        prevPositions.push_back(entity->position);
+        const auto newPos = entity->position + World::Pos3(80, -48, 16);
+        entity->moveTo(newPos);
+        postTickPositions.push_back(newPos);
+    }
+    tweener.postTick();
+    const auto tileLists = captureTileLists();
+
+    for (const auto alpha : { 0.25f, 0.5f, 0.75f })
+    {
+        tweener.tween(alpha);
+        EXPECT_EQ(captureTileLists(), tileLists);
+        for (size_t i = 0; i < _entities.size(); i++)
+        {
+            EXPECT_EQ(_entities[i]->position, postTickPositions[i]);
+        }
+
+        const auto expected = prevPositions[0] + World::Pos3(static_cast<coord_t>(80 * alpha), static_cast<coord_t>(-48 * alpha), static_cast<coord_t>(16 * alpha));
+        EXPECT_EQ(tweener.getRenderPosition(*_entities[0]), expected);
+    }
+
+    // Moved outside of a tick, the entity is drawn where it is
+    auto* moved = _entities[1];
+    const auto movedPos = moved->position + World::Pos3(32, 32, 0);
+    moved->moveTo(movedPos);
+    EXPECT_EQ(tweener.getRenderPosition(*moved), movedPos);
+    moved->moveTo(postTickPositions[1]);
+
+    tweener.restore();
+    EXPECT_EQ(captureTileLists(), tileLists);
+    for (size_t i = 0; i < _entities.size(); i++)
+    {
+        EXPECT_EQ(_entities[i]->position, postTickPositions[i]);
+        EXPECT_EQ(tweener.getRenderPosition(*_entities[i]), postTickPositions[i]);
+    }
+
+    // Removing an entity while tweening finds it where the index has it
+    tweener.tween(0.5f);
+    EntityManager::freeEntity(_entities.back());
+    _entities.pop_back();
+
+    tweener.restore();
+    tweener.reset();
+    for (size_t i = 0; i < _entities.size(); i++)
+    {
+        EXPECT_EQ(_entities[i]->position, postTickPositions[i]);
+        EXPECT_EQ(tweener.getRenderPosition(*_entities[i]), postTickPositions[i]);
+    }
+}
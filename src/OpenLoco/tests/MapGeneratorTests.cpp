@@ -0,0 +1,99 @@
+#include <OpenLoco/GameState.h>
+#include <OpenLoco/Map/MapGenerator/HeightMap.h>
+#include <OpenLoco/Map/MapGenerator/MapGenerator.h>
+#include <OpenLoco/Map/MapGenerator/SimplexTerrainGenerator.h>
+#include <OpenLoco/Map/SurfaceElement.h>
+#include <OpenLoco/Map/Tile.h>
+#include <OpenLoco/Map/TileElement.h>
+#include <OpenLoco/Map/TileManager.h>
+#include <OpenLoco/Scenario/ScenarioOptions.h>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace OpenLoco;
+using namespace OpenLoco::World;
+using namespace OpenLoco::World::MapGenerator;
+
+namespace
+{
+    using TileData = std::vector<std::array<uint8_t, kTileElementSize>>;
+
+    class MapGeneratorTest : public ::testing::Test
+    {
+    protected:
+        static void SetUpTestSuite()
+        {
+            TileManager::allocateMapElements();
+        }
+
+        void TearDown() override
+        {
+            setParallelPasses(true);
+        }
+
+        static TileData generateSurfaceTiles(uint32_t seed, bool parallel)
+        {
+            Scenario::Options options{};
+            options.generator = Scenario::LandGeneratorType::Simplex;
+            options.topographyStyle = Scenario::TopographyStyle::halfMountainsHills;
+            options.hillDensity = 50;
+            options.numTerrainSmoothingPasses = 2;
+            options.minLandHeight = 2;
+
+            HeightMap heightMap(kMapColumns, kMapRows);
+            SimplexTerrainGenerator generator;
+            generator.generate(options, heightMap, seed);
+
+            TileManager::initialise();
+            getGameState().seaLevel = 8;
+            setParallelPasses(parallel);
+            generateSurface(heightMap);
+
+            TileData result;
+            for (auto y = 0; y < kMapRows; y++)
+            {
+                for (auto x = 0; x < kMapColumns; x++)
+                {
+                    auto tile = TileManager::get(TilePos2(x, y));
+                    for (size_t i = 0; i < tile.size(); i++)
+                    {
+                        auto& bytes = result.emplace_back();
+                        std::memcpy(bytes.data(), tile[i]->rawData().data(), kTileElementSize);
+                    }
+                }
+            }
+            return result;
+        }
+    };
+}
+
+TEST_F(MapGeneratorTest, SurfaceIsSameOnOneThreadAndManyThreads)
+{
+    for (const auto seed : { 1U, 0x5EED5U })
+    {
+        SCOPED_TRACE(seed);
+        const auto serial = generateSurfaceTiles(seed, false);
+        const auto parallel = generateSurfaceTiles(seed, true);
+        ASSERT_EQ(serial.size(), parallel.size());
+        EXPECT_TRUE(serial == parallel);
+
+        // The map has both land and sea so both passes did some work
+        size_t numWater = 0;
+        size_t numSloped = 0;
+        for (auto y = 1; y < kMapRows - 1; y++)
+        {
+            for (auto x = 1; x < kMapColumns - 1; x++)
+            {
+                const auto* surface = TileManager::get(TilePos2(x, y)).surface();
+                ASSERT_NE(surface, nullptr);
+                numWater += surface->water() != 0 ? 1 : 0;
+                numSloped += surface->slope() != 0 ? 1 : 0;
+            }
+        }
+        EXPECT_GT(numWater, 0U);
+        EXPECT_GT(numSloped, 0U);
+    }
+}
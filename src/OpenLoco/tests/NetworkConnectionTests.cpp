@@ -0,0 +1,153 @@
+#include <OpenLoco/Network/Network.h>
+#include <OpenLoco/Network/NetworkConnection.h>
+#include <OpenLoco/Network/Packet.h>
+#include <OpenLoco/Network/Socket.h>
+#include <algorithm>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <optional>
+#include <vector>
+
+using namespace OpenLoco::Network;
+
+namespace
+{
+    // Two connections talking over loopback sockets. Datagrams are only delivered when the test asks for
+    // it and time only moves when the test advances it, so every run is the same.
+    class NetworkConnectionTest : public ::testing::Test
+    {
+    protected:
+        uint32_t _time{};
+        std::unique_ptr<IUdpSocket> _socketA;
+        std::unique_ptr<IUdpSocket> _socketB;
+        std::unique_ptr<NetworkConnection> _connectionA;
+        std::unique_ptr<NetworkConnection> _connectionB;
+
+        void SetUp() override
+        {
+            _time = 1;
+            setTimeSource([this] { return _time; });
+
+            _socketA = Socket::createLoopbackUdp();
+            _socketA->listen(Protocol::ipv4, 0);
+            _socketB = Socket::createLoopbackUdp();
+            _socketB->listen(Protocol::ipv4, 0);
+            _connectionA = std::make_unique<NetworkConnection>(_socketA.get(), Socket::resolveLoopback(_socketB->getPort()));
+            _connectionB = std::make_unique<NetworkConnection>(_socketB.get(), Socket::resolveLoopback(_socketA->getPort()));
+        }
+
+        void TearDown() override
+        {
+            Socket::setLoopbackPacketLoss(0);
+            setTimeSource(nullptr);
+        }
+
+        static std::optional<Packet> receive(IUdpSocket& socket)
+        {
+            Packet packet;
+            size_t received{};
+            if (socket.receiveData(&packet, sizeof(packet), &received, nullptr) != NetworkReadPacket::success)
+            {
+                return std::nullopt;
+            }
+            return packet;
+        }
+
+        // Hands every datagram waiting on a socket to its connection, keeping the payloads that come out
+        static void deliver(IUdpSocket& socket, NetworkConnection& connection, std::vector<uint32_t>& payloads)
+        {
+            while (auto packet = receive(socket))
+            {
+                connection.receivePacket(*packet);
+            }
+            while (auto packet = connection.takeNextPacket())
+            {
+                payloads.push_back(packet->cast<ChecksumPacket>()->tick);
+            }
+        }
+
+        void advance(uint32_t ms, std::vector<uint32_t>& payloadsA, std::vector<uint32_t>& payloadsB)
+        {
+            _time += ms;
+            _connectionA->update();
+            _connectionB->update();
+            deliver(*_socketB, *_connectionB, payloadsB);
+            deliver(*_socketA, *_connectionA, payloadsA);
+        }
+
+        void send(NetworkConnection& connection, uint32_t value)
+        {
+            ChecksumPacket packet;
+            packet.tick = value;
+            connection.sendPacket(packet);
+        }
+
+        static void expectEachOnce(std::vector<uint32_t> payloads, uint32_t count)
+        {
+            std::sort(payloads.begin(), payloads.end());
+            ASSERT_EQ(payloads.size(), count);
+            for (uint32_t i = 0; i < count; i++)
+            {
+                ASSERT_EQ(payloads[i], i);
+            }
+        }
+    };
+}
+
+TEST_F(NetworkConnectionTest, DeliversEachPacketOnceDespiteLoss)
+{
+    // Far more packets than fit in the window of a duplicate check that only remembers recent sequences
+    constexpr uint32_t kCount = 5000;
+    Socket::setLoopbackPacketLoss(30, 1);
+
+    std::vector<uint32_t> payloadsA;
+    std::vector<uint32_t> payloadsB;
+    for (uint32_t i = 0; i < kCount; i++)
+    {
+        send(*_connectionA, i);
+        send(*_connectionB, i);
+    }
+    for (auto i = 0; i < 100 && (payloadsA.size() < kCount || payloadsB.size() < kCount); i++)
+    {
+        advance(250, payloadsA, payloadsB);
+    }
+
+    // Acknowledgements are lost too, so packets keep being resent after they first arrived
+    for (auto i = 0; i < 20; i++)
+    {
+        advance(250, payloadsA, payloadsB);
+    }
+
+    expectEachOnce(payloadsA, kCount);
+    expectEachOnce(payloadsB, kCount);
+    EXPECT_GT(_connectionA->getStats().packetsResent, 0U);
+}
+
+TEST_F(NetworkConnectionTest, LongUnacknowledgedPacketIsNotReplaced)
+{
+    // More packets than a 16 bit sequence can tell apart are sent while the first is lost
+    constexpr uint32_t kCount = 70000;
+
+    std::vector<uint32_t> payloadsA;
+    std::vector<uint32_t> payloadsB;
+    send(*_connectionA, 0);
+    ASSERT_TRUE(receive(*_socketB).has_value());
+
+    for (uint32_t i = 1; i < kCount; i++)
+    {
+        send(*_connectionA, i);
+        if (i % 1000 == 0)
+        {
+            advance(1, payloadsA, payloadsB);
+        }
+    }
+    advance(1, payloadsA, payloadsB);
+    EXPECT_EQ(payloadsB.size(), kCount - 1);
+    EXPECT_EQ(_connectionA->getStats().packetsResent, 0U);
+
+    // Once resent the first packet still arrives with its own data, and only once
+    advance(2000, payloadsA, payloadsB);
+    advance(2000, payloadsA, payloadsB);
+    expectEachOnce(payloadsB, kCount);
+    EXPECT_EQ(_connectionA->getStats().packetsResent, 1U);
+}
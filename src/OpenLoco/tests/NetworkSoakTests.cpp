@@ -0,0 +1,492 @@
+#include <OpenLoco/Core/MemoryStream.h>
+#include <OpenLoco/Network/Network.h>
+#include <OpenLoco/Network/NetworkClient.h>
+#include <OpenLoco/Network/NetworkServer.h>
+#include <OpenLoco/Network/Packet.h>
+#include <OpenLoco/Network/Socket.h>
+#include <OpenLoco/Scenario/ScenarioManager.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <gtest/gtest.h>
+#include <optional>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Runs the real NetworkServer and a number of NetworkClients in one process over loopback sockets. Only
+// access to the game is replaced, game commands are applied to a stand in state so that no game needs
+// to be loaded. Everything runs on the test thread against a simulated clock, so a run is the same
+// every time and does not depend on how fast the machine is. The defaults are small enough for CI,
+// longer soaks can be run by setting OPENLOCO_SOAK_CLIENTS, OPENLOCO_SOAK_DURATION (simulated ms),
+// OPENLOCO_SOAK_RATE (commands per second per client), OPENLOCO_SOAK_LOSS (percent) and
+// OPENLOCO_SOAK_STATE_SIZE (bytes).
+
+using namespace OpenLoco;
+using namespace OpenLoco::Network;
+
+namespace
+{
+    // One game tick, as the game runs at normal speed
+    constexpr uint32_t kFrameTime = 25;
+    constexpr uint32_t kMaxDrainTime = 60000;
+
+    // Up to this many ticks are run in a frame when a client is behind the server, as the game does
+    constexpr uint32_t kMaxCatchUpTicks = 4;
+
+    constexpr int32_t kHostId = -1;
+
+    struct SoakOptions
+    {
+        uint32_t clients = 8;
+        uint32_t durationMs = 5000;
+        uint32_t commandsPerSecond = 20;
+        uint32_t packetLoss = 0;
+        uint32_t stateSize = 1024 * 1024;
+    };
+
+    struct SoakResults
+    {
+        uint32_t clientsConnected{};
+        uint64_t commandsSent{};
+        uint64_t commandsConfirmed{};
+        uint64_t hostCommands{};
+        std::vector<uint32_t> latenciesMs;
+        std::vector<uint32_t> stateTransferMs;
+        NetworkConnectionStats serverStats;
+        NetworkConnectionStats clientStats;
+        uint32_t elapsedMs{};
+        bool settled{};
+        bool consistent{};
+    };
+
+    uint32_t getEnvOption(const char* name, uint32_t defaultValue)
+    {
+        const auto* value = std::getenv(name);
+        return value != nullptr ? static_cast<uint32_t>(std::strtoul(value, nullptr, 10)) : defaultValue;
+    }
+
+    SoakOptions getOptions(SoakOptions options)
+    {
+        options.clients = getEnvOption("OPENLOCO_SOAK_CLIENTS", options.clients);
+        options.durationMs = getEnvOption("OPENLOCO_SOAK_DURATION", options.durationMs);
+        options.commandsPerSecond = getEnvOption("OPENLOCO_SOAK_RATE", options.commandsPerSecond);
+        options.packetLoss = getEnvOption("OPENLOCO_SOAK_LOSS", options.packetLoss);
+        options.stateSize = getEnvOption("OPENLOCO_SOAK_STATE_SIZE", options.stateSize);
+        return options;
+    }
+
+    // Stand in for the game state, game commands mix a value into one of the cells
+    class SimState
+    {
+    private:
+        std::vector<uint32_t> _cells;
+
+    public:
+        explicit SimState(size_t size)
+            : _cells(size / sizeof(uint32_t))
+        {
+            std::mt19937 rng(1);
+            for (size_t i = 0; i < _cells.size(); i++)
+            {
+                _cells[i] = (i % 16) == 0 ? rng() : static_cast<uint32_t>(i / 256);
+            }
+        }
+
+        explicit SimState(std::span<const uint8_t> data)
+            : _cells(data.size() / sizeof(uint32_t))
+        {
+            std::memcpy(_cells.data(), data.data(), _cells.size() * sizeof(uint32_t));
+        }
+
+        void apply(const GameCommands::registers& regs)
+        {
+            auto& cell = _cells[static_cast<uint32_t>(regs.eax) % _cells.size()];
+            cell = cell * 31 + static_cast<uint32_t>(regs.ebx);
+        }
+
+        void write(MemoryStream& stream) const
+        {
+            stream.write(_cells.data(), _cells.size() * sizeof(uint32_t));
+        }
+
+        bool operator==(const SimState& other) const = default;
+    };
+
+    void addStats(NetworkConnectionStats& total, const NetworkConnectionStats& stats)
+    {
+        total.packetsSent += stats.packetsSent;
+        total.packetsResent += stats.packetsResent;
+        total.packetsReceived += stats.packetsReceived;
+        total.bytesSent += stats.bytesSent;
+        total.bytesReceived += stats.bytesReceived;
+    }
+
+    // The state sent to joining clients, like a save it holds the tick along with the game state
+    struct SoakStateHeader
+    {
+        uint32_t tick;
+    };
+
+    class SoakServer final : public NetworkServer
+    {
+    private:
+        SimState _state;
+
+    protected:
+        std::unique_ptr<IUdpSocket> createSocket() override
+        {
+            return Socket::createLoopbackUdp();
+        }
+
+        std::unique_ptr<INetworkEndpoint> resolve(Protocol, const std::string&, port_t port) override
+        {
+            return Socket::resolveLoopback(port);
+        }
+
+        void exportState(MemoryStream& stream) override
+        {
+            SoakStateHeader header{ ScenarioManager::getScenarioTicks() };
+            stream.write(&header, sizeof(header));
+            _state.write(stream);
+        }
+
+        void runGameCommand(const GameCommandPacket& packet) override
+        {
+            _state.apply(packet.regs);
+        }
+
+    public:
+        explicit SoakServer(size_t stateSize)
+            : _state(stateSize)
+        {
+            setReceiveOnUpdate(true);
+        }
+
+        const SimState& getState() const
+        {
+            return _state;
+        }
+    };
+
+    class SoakClient final : public NetworkClient
+    {
+    private:
+        int32_t _id;
+        const uint32_t& _time;
+        SoakResults& _results;
+        std::optional<SimState> _state;
+        uint32_t _tick{};
+        uint32_t _connectTime{};
+        std::unordered_map<int32_t, uint32_t> _sentCommands;
+        int32_t _nextCommandTag{};
+        std::minstd_rand _rng;
+
+    protected:
+        std::unique_ptr<IUdpSocket> createSocket() override
+        {
+            return Socket::createLoopbackUdp();
+        }
+
+        std::unique_ptr<INetworkEndpoint> resolve(Protocol, const std::string&, port_t port) override
+        {
+            return Socket::resolveLoopback(port);
+        }
+
+        void loadState(std::span<uint8_t const> data) override
+        {
+            ASSERT_GE(data.size(), sizeof(SoakStateHeader));
+            SoakStateHeader header;
+            std::memcpy(&header, data.data(), sizeof(header));
+            _tick = header.tick;
+            _state.emplace(data.subspan(sizeof(header)));
+            _results.clientsConnected++;
+            _results.stateTransferMs.push_back(_time - _connectTime);
+        }
+
+        void runGameCommand(const GameCommandPacket& packet) override
+        {
+            ASSERT_TRUE(_state.has_value());
+            _state->apply(packet.regs);
+
+            // The client id and a tag travel in registers the stand in state ignores
+            auto sent = _sentCommands.find(packet.regs.edi);
+            if (packet.regs.esi == _id && sent != _sentCommands.end())
+            {
+                _results.latenciesMs.push_back(_time - sent->second);
+                _results.commandsConfirmed++;
+                _sentCommands.erase(sent);
+            }
+        }
+
+        void initStatus(std::string_view) override
+        {
+        }
+
+        void setStatus(std::string_view) override
+        {
+        }
+
+        void clearStatus() override
+        {
+        }
+
+        void endStatus(std::string_view) override
+        {
+        }
+
+    public:
+        SoakClient(int32_t id, const uint32_t& time, SoakResults& results)
+            : _id(id)
+            , _time(time)
+            , _results(results)
+            , _rng(id + 1)
+        {
+            setReceiveOnUpdate(true);
+        }
+
+        void connect(port_t port)
+        {
+            _connectTime = _time;
+            NetworkClient::connect("localhost", port);
+        }
+
+        bool isConnected() const
+        {
+            return getStatus() == NetworkClientStatus::connected;
+        }
+
+        const std::optional<SimState>& getState() const
+        {
+            return _state;
+        }
+
+        size_t getUnconfirmedCommands() const
+        {
+            return _sentCommands.size();
+        }
+
+        void sendGameCommand()
+        {
+            GameCommands::registers regs;
+            regs.eax = static_cast<int32_t>(_rng());
+            regs.ebx = static_cast<int32_t>(_rng());
+            regs.esi = _id;
+            regs.edi = _nextCommandTag++;
+            _sentCommands[regs.edi] = _time;
+            NetworkClient::sendGameCommand(CompanyId::null, regs, 0);
+            _results.commandsSent++;
+        }
+
+        // Runs the ticks the server allows, as the game loop does for a client
+        void tick()
+        {
+            if (!isConnected())
+            {
+                return;
+            }
+            for (uint32_t i = 0; i < kMaxCatchUpTicks && shouldProcessTick(_tick + 1); i++)
+            {
+                _tick++;
+                runGameCommandsForTick(_tick);
+            }
+        }
+    };
+
+    class NetworkSoakTest : public ::testing::Test
+    {
+    protected:
+        uint32_t _time{};
+
+        void SetUp() override
+        {
+            _time = 0;
+            Network::setTimeSource([this] { return _time; });
+            ScenarioManager::setScenarioTicks(0);
+        }
+
+        void TearDown() override
+        {
+            Network::setTimeSource(nullptr);
+            Socket::setLoopbackPacketLoss(0);
+        }
+
+        SoakResults runSoak(const SoakOptions& options)
+        {
+            SoakResults results;
+            Socket::setLoopbackPacketLoss(options.packetLoss, 1);
+
+            SoakServer server(options.stateSize);
+            server.listen("", 0);
+
+            // Clients join over the first half of the run so that states are sent while commands are flowing
+            std::vector<std::unique_ptr<SoakClient>> clients;
+            std::vector<uint32_t> joinTimes;
+            for (uint32_t i = 0; i < options.clients; i++)
+            {
+                clients.push_back(std::make_unique<SoakClient>(static_cast<int32_t>(i), _time, results));
+                joinTimes.push_back(i * options.durationMs / (2 * options.clients) / kFrameTime * kFrameTime);
+            }
+
+            std::minstd_rand hostRng(1234);
+            auto runFrame = [&] {
+                _time += kFrameTime;
+
+                server.update();
+                ScenarioManager::setScenarioTicks(ScenarioManager::getScenarioTicks() + 1);
+                server.runGameCommands();
+
+                for (auto& client : clients)
+                {
+                    client->update();
+                    client->tick();
+                }
+            };
+
+            // Each client sends its commands evenly spaced once it has joined, the host now and then
+            const auto commandInterval = 1000 / std::max<uint32_t>(1, options.commandsPerSecond);
+            std::vector<uint32_t> nextCommand(clients.size());
+            while (_time < options.durationMs)
+            {
+                for (size_t i = 0; i < clients.size(); i++)
+                {
+                    if (joinTimes[i] == _time)
+                    {
+                        clients[i]->connect(server.getPort());
+                    }
+                    if (!clients[i]->isConnected())
+                    {
+                        nextCommand[i] = _time;
+                        continue;
+                    }
+                    while (nextCommand[i] <= _time)
+                    {
+                        clients[i]->sendGameCommand();
+                        nextCommand[i] += commandInterval;
+                    }
+                }
+                if ((_time / kFrameTime) % 8 == 0)
+                {
+                    GameCommands::registers regs;
+                    regs.eax = static_cast<int32_t>(hostRng());
+                    regs.ebx = static_cast<int32_t>(hostRng());
+                    regs.esi = kHostId;
+                    server.queueGameCommand(CompanyId::null, regs, 0);
+                    results.hostCommands++;
+                }
+                runFrame();
+            }
+
+            // Stop sending and let every client catch up with the server
+            auto isSettled = [&] {
+                return std::all_of(clients.begin(), clients.end(), [&](const auto& client) {
+                    return client->isConnected() && client->getUnconfirmedCommands() == 0 && client->getState() == server.getState();
+                });
+            };
+            const auto drainEnd = _time + kMaxDrainTime;
+            while (!isSettled() && _time < drainEnd)
+            {
+                runFrame();
+            }
+            results.elapsedMs = _time;
+            results.settled = isSettled();
+            results.consistent = std::all_of(clients.begin(), clients.end(), [&](const auto& client) {
+                return client->getState() == server.getState();
+            });
+
+            for (const auto& client : clients)
+            {
+                addStats(results.clientStats, client->getStats());
+            }
+            results.serverStats = server.getStats();
+
+            clients.clear();
+            server.close();
+            return results;
+        }
+    };
+
+    uint32_t percentile(std::vector<uint32_t> values, double p)
+    {
+        if (values.empty())
+        {
+            return 0;
+        }
+        std::sort(values.begin(), values.end());
+        return values[std::min(values.size() - 1, static_cast<size_t>(p * values.size()))];
+    }
+
+    void recordResults(const SoakResults& results)
+    {
+        const auto serverKiBps = results.serverStats.bytesSent / 1024.0 / (results.elapsedMs / 1000.0);
+
+        testing::Test::RecordProperty("commands_sent", std::to_string(results.commandsSent));
+        testing::Test::RecordProperty("latency_p50_ms", std::to_string(percentile(results.latenciesMs, 0.5)));
+        testing::Test::RecordProperty("latency_p99_ms", std::to_string(percentile(results.latenciesMs, 0.99)));
+        testing::Test::RecordProperty("state_transfer_max_ms", std::to_string(percentile(results.stateTransferMs, 1.0)));
+        testing::Test::RecordProperty("server_kib_per_second", std::to_string(serverKiBps));
+        testing::Test::RecordProperty("resends", std::to_string(results.serverStats.packetsResent + results.clientStats.packetsResent));
+    }
+}
+
+TEST_F(NetworkSoakTest, ClientsStayConsistent)
+{
+    const auto options = getOptions({});
+    const auto results = runSoak(options);
+    recordResults(results);
+
+    EXPECT_EQ(results.clientsConnected, options.clients);
+    EXPECT_GT(results.commandsSent, 0U);
+    EXPECT_EQ(results.commandsConfirmed, results.commandsSent);
+    EXPECT_TRUE(results.settled);
+    EXPECT_TRUE(results.consistent);
+
+    // Without loss nothing should need resending, and a command takes a couple of ticks at most
+    if (options.packetLoss == 0)
+    {
+        EXPECT_EQ(results.serverStats.packetsResent + results.clientStats.packetsResent, 0U);
+        EXPECT_LE(percentile(results.latenciesMs, 1.0), 4 * kFrameTime);
+    }
+}
+
+TEST_F(NetworkSoakTest, ClientsStayConsistentWithPacketLoss)
+{
+    SoakOptions defaults;
+    defaults.clients = 4;
+    defaults.packetLoss = 5;
+    const auto options = getOptions(defaults);
+    const auto results = runSoak(options);
+    recordResults(results);
+
+    EXPECT_EQ(results.clientsConnected, options.clients);
+    EXPECT_EQ(results.commandsConfirmed, results.commandsSent);
+    if (options.packetLoss != 0)
+    {
+        EXPECT_GT(results.serverStats.packetsResent + results.clientStats.packetsResent, 0U);
+    }
+    EXPECT_TRUE(results.settled);
+    EXPECT_TRUE(results.consistent);
+}
+
+TEST_F(NetworkSoakTest, RunsAreRepeatable)
+{
+    SoakOptions options;
+    options.clients = 3;
+    options.durationMs = 2000;
+    options.packetLoss = 10;
+    options.stateSize = 64 * 1024;
+
+    const auto first = runSoak(options);
+    _time = 0;
+    ScenarioManager::setScenarioTicks(0);
+    const auto second = runSoak(options);
+
+    EXPECT_EQ(first.commandsSent, second.commandsSent);
+    EXPECT_EQ(first.latenciesMs, second.latenciesMs);
+    EXPECT_EQ(first.stateTransferMs, second.stateTransferMs);
+    EXPECT_EQ(first.serverStats.packetsSent, second.serverStats.packetsSent);
+    EXPECT_EQ(first.serverStats.packetsResent, second.serverStats.packetsResent);
+    EXPECT_EQ(first.elapsedMs, second.elapsedMs);
+}
@@ -0,0 +1,198 @@
+#include <OpenLoco/Core/FileStream.h>
+#include <OpenLoco/Core/FileSystem.hpp>
+#include <OpenLoco/Graphics/Gfx.h>
+#include <OpenLoco/Objects/ObjectManager.h>
+#include <OpenLoco/Objects/ScenarioTextObject.h>
+#include <OpenLoco/Objects/StreetLightObject.h>
+#include <OpenLoco/S5/SawyerStream.h>
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <execution>
+#include <gtest/gtest.h>
+#include <optional>
+#include <string>
+#include <vector>
+
+using namespace OpenLoco;
+
+namespace
+{
+    constexpr uint32_t kObjectChecksumMagic = 0xF369A75B;
+    constexpr size_t kNumFiles = 600;
+
+    struct IndexedFile
+    {
+        fs::path path;
+        ObjectHeader header;
+    };
+
+    struct LoadResult
+    {
+        std::optional<ObjectManager::IndexLoadResult> result;
+        bool isTemporaryObjectLoadAfter;
+        bool isIndexObjectLoadAfter;
+    };
+
+    class ObjectIndexTest : public ::testing::Test
+    {
+    protected:
+        fs::path _directory;
+        std::vector<IndexedFile> _files;
+
+        void SetUp() override
+        {
+            _directory = fs::temp_directory_path() / "openloco_object_index_test";
+            fs::create_directories(_directory);
+        }
+
+        void TearDown() override
+        {
+            std::error_code ec;
+            fs::remove_all(_directory, ec);
+        }
+
+        static uint32_t computeChecksum(const void* data, size_t size, uint32_t seed)
+        {
+            auto checksum = seed;
+            for (size_t i = 0; i < size; i++)
+            {
+                checksum = std::rotl(checksum ^ static_cast<const uint8_t*>(data)[i], 11);
+            }
+            return checksum;
+        }
+
+        static void appendString(std::vector<uint8_t>& data, const std::string& str)
+        {
+            data.push_back(0); // english_uk
+            data.insert(data.end(), str.begin(), str.end());
+            data.push_back(0);
+            data.push_back(0xFF);
+        }
+
+        // A street light with the given number of images, a truncated image table makes the load fail
+        static std::vector<uint8_t> createStreetLight(const std::string& name, uint32_t numImages, bool truncateImages)
+        {
+            std::vector<uint8_t> data(sizeof(StreetLightObject));
+            appendString(data, name);
+
+            const Gfx::G1Header g1Header{ numImages, numImages };
+            const auto* g1HeaderBytes = reinterpret_cast<const uint8_t*>(&g1Header);
+            data.insert(data.end(), g1HeaderBytes, g1HeaderBytes + sizeof(g1Header));
+            const auto numElements = truncateImages ? numImages / 2 : numImages;
+            for (uint32_t i = 0; i < numElements; i++)
+            {
+                Gfx::G1Element32 element{};
+                element.offset = i;
+                element.width = 1;
+                element.height = 1;
+                const auto* elementBytes = reinterpret_cast<const uint8_t*>(&element);
+                data.insert(data.end(), elementBytes, elementBytes + sizeof(element));
+            }
+            if (!truncateImages)
+            {
+                data.insert(data.end(), numImages, 0);
+            }
+            return data;
+        }
+
+        static std::vector<uint8_t> createScenarioText(const std::string& name)
+        {
+            std::vector<uint8_t> data(sizeof(ScenarioTextObject));
+            appendString(data, name);
+            appendString(data, name + " details");
+            return data;
+        }
+
+        void writeObject(ObjectType type, const std::string& name, const std::vector<uint8_t>& data)
+        {
+            ObjectHeader header{};
+            header.flags = enumValue(type);
+            std::fill(std::begin(header.name), std::end(header.name), ' ');
+            std::copy_n(name.begin(), std::min(name.size(), sizeof(header.name)), header.name);
+            auto checksum = computeChecksum(&header.flags, 1, kObjectChecksumMagic);
+            checksum = computeChecksum(header.name, sizeof(header.name), checksum);
+            header.checksum = computeChecksum(data.data(), data.size(), checksum);
+
+            const auto path = _directory / (name + ".DAT");
+            FileStream stream(path, StreamMode::write);
+            SawyerStreamWriter writer(stream);
+            writer.write(header);
+            writer.writeChunk(SawyerEncoding::runLengthSingle, data.data(), data.size());
+            _files.push_back(IndexedFile{ path, header });
+        }
+
+        void createObjects()
+        {
+            for (size_t i = 0; i < kNumFiles; i++)
+            {
+                const auto name = "OBJ" + std::to_string(i);
+                if (i % 3 == 0)
+                {
+                    writeObject(ObjectType::scenarioText, name, createScenarioText("Scenario " + name));
+                }
+                else
+                {
+                    const auto numImages = static_cast<uint32_t>(i % 17);
+                    writeObject(ObjectType::streetLight, name, createStreetLight("Light " + name, numImages, i % 5 == 0 && numImages > 1));
+                }
+            }
+        }
+
+        static LoadResult loadForIndex(const IndexedFile& file)
+        {
+            LoadResult result{};
+            result.result = ObjectManager::loadObjectForIndex(file.header, file.path);
+            result.isTemporaryObjectLoadAfter = ObjectManager::isTemporaryObjectLoad();
+            result.isIndexObjectLoadAfter = ObjectManager::isIndexObjectLoad();
+            return result;
+        }
+    };
+}
+
+TEST_F(ObjectIndexTest, ParallelLoadMatchesSerialLoad)
+{
+    createObjects();
+    ASSERT_EQ(_files.size(), kNumFiles);
+
+    std::vector<LoadResult> serial;
+    for (const auto& file : _files)
+    {
+        serial.push_back(loadForIndex(file));
+    }
+
+    std::vector<LoadResult> parallel(_files.size());
+    std::transform(std::execution::par, _files.begin(), _files.end(), parallel.begin(), loadForIndex);
+
+    size_t numFailed = 0;
+    for (size_t i = 0; i < _files.size(); i++)
+    {
+        SCOPED_TRACE(_files[i].path.u8string());
+        const auto& expected = serial[i];
+        const auto& actual = parallel[i];
+
+        // Failed loads must leave the thread ready for the next load
+        EXPECT_FALSE(expected.isTemporaryObjectLoadAfter);
+        EXPECT_FALSE(expected.isIndexObjectLoadAfter);
+        EXPECT_FALSE(actual.isTemporaryObjectLoadAfter);
+        EXPECT_FALSE(actual.isIndexObjectLoadAfter);
+
+        ASSERT_EQ(actual.result.has_value(), expected.result.has_value());
+        if (!expected.result.has_value())
+        {
+            numFailed++;
+            continue;
+        }
+        EXPECT_EQ(actual.result->name, expected.result->name);
+        EXPECT_EQ(actual.result->metaData.displayData.numImages, expected.result->metaData.displayData.numImages);
+        EXPECT_EQ(actual.result->metaData.fileSizeHeader.decodedFileSize, expected.result->metaData.fileSizeHeader.decodedFileSize);
+    }
+
+    // Both failing and successful loads were exercised
+    EXPECT_GT(numFailed, 0U);
+    EXPECT_LT(numFailed, _files.size());
+    EXPECT_EQ(serial[1].result->name, "Light OBJ1");
+    EXPECT_EQ(serial[1].result->metaData.displayData.numImages, 1U);
+    EXPECT_EQ(serial[3].result->name, "Scenario OBJ3");
+    EXPECT_FALSE(serial[10].result.has_value());
+}
@@ -0,0 +1,250 @@
+#include <OpenLoco/Core/Exception.hpp>
+#include <OpenLoco/Entities/EntityManager.h>
+#include <OpenLoco/Vehicles/OrderManager.h>
+#include <OpenLoco/Vehicles/Orders.h>
+#include <OpenLoco/Vehicles/Vehicle.h>
+#include <OpenLoco/Vehicles/VehicleHead.h>
+#include <OpenLoco/Vehicles/VehicleManager.h>
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+using namespace OpenLoco;
+using namespace OpenLoco::Vehicles;
+
+namespace
+{
+    constexpr std::array<uint8_t, 6> kOrderSizes = {
+        sizeof(OrderEnd),
+        sizeof(OrderStopAt),
+        sizeof(OrderRouteThrough),
+        sizeof(OrderRouteWaypoint),
+        sizeof(OrderUnloadAll),
+        sizeof(OrderWaitFor),
+    };
+    constexpr auto kNumStations = 3;
+
+    struct HeadState
+    {
+        uint32_t orderTableOffset;
+        uint16_t currentOrder;
+        uint16_t sizeOfOrderTable;
+
+        bool operator==(const HeadState&) const = default;
+    };
+
+    struct OrderTableState
+    {
+        std::vector<uint8_t> table;
+        std::vector<HeadState> heads;
+        std::vector<uint32_t> frameOffsets;
+
+        bool operator==(const OrderTableState&) const = default;
+    };
+
+    class OrderManagerTest : public ::testing::Test
+    {
+    protected:
+        std::vector<VehicleHead*> _heads;
+        VehicleHead* _framesHead = nullptr;
+
+        void SetUp() override
+        {
+            EntityManager::reset();
+            OrderManager::reset();
+        }
+
+        VehicleHead* createHead()
+        {
+            auto* base = EntityManager::createEntityVehicle();
+            base->baseType = EntityBaseType::vehicle;
+            auto* vehicleBase = base->asBase<VehicleBase>();
+            vehicleBase->setSubType(VehicleEntityType::head);
+            EntityManager::moveEntityToList(base, EntityManager::EntityListType::vehicleHead);
+            auto* head = static_cast<VehicleHead*>(vehicleBase);
+            _heads.push_back(head);
+            return head;
+        }
+
+        static void appendOrder(std::vector<uint8_t>& table, const Order& order)
+        {
+            const auto* bytes = reinterpret_cast<const uint8_t*>(&order);
+            table.insert(table.end(), bytes, bytes + kOrderSizes[enumValue(order.getType())]);
+        }
+
+        static void appendRandomOrder(std::vector<uint8_t>& table, std::mt19937& rng, bool allowCargo)
+        {
+            const auto station = StationId(rng() % kNumStations);
+            switch (rng() % (allowCargo ? 5 : 3))
+            {
+                case 0:
+                    appendOrder(table, OrderStopAt(station));
+                    break;
+                case 1:
+                    appendOrder(table, OrderRouteThrough(station));
+                    break;
+                case 2:
+                    appendOrder(table, OrderRouteWaypoint(World::TilePos2(rng() % 64, rng() % 64), rng() % 32, rng() % 4, rng() % 44));
+                    break;
+                case 3:
+                    appendOrder(table, OrderUnloadAll(rng() % 32));
+                    break;
+                default:
+                    appendOrder(table, OrderWaitFor(rng() % 32));
+                    break;
+            }
+        }
+
+        // Vehicles are laid out in the table in a different order to the vehicle list with unowned orders
+        // in between. Every vehicle's orders finish with an end order, as allocateOrders leaves them.
+        void createRandomOrderTable(std::mt19937& rng)
+        {
+            const auto numHeads = 1 + rng() % 8;
+            for (auto i = 0U; i < numHeads; i++)
+            {
+                createHead();
+            }
+            auto layout = _heads;
+            std::shuffle(layout.begin(), layout.end(), rng);
+            _framesHead = layout[rng() % layout.size()];
+
+            std::vector<uint8_t> table;
+            for (auto* head : layout)
+            {
+                for (auto numGapOrders = rng() % 3; numGapOrders > 0; numGapOrders--)
+                {
+                    appendRandomOrder(table, rng, true);
+                }
+
+                head->orderTableOffset = static_cast<uint32_t>(table.size());
+                std::vector<uint16_t> orderOffsets;
+                for (auto numOrders = rng() % 12; numOrders > 0; numOrders--)
+                {
+                    orderOffsets.push_back(static_cast<uint16_t>(table.size() - head->orderTableOffset));
+                    // The display frames need cargo objects to describe cargo orders
+                    appendRandomOrder(table, rng, head != _framesHead);
+                }
+                orderOffsets.push_back(static_cast<uint16_t>(table.size() - head->orderTableOffset));
+                appendOrder(table, OrderEnd());
+
+                head->sizeOfOrderTable = static_cast<uint16_t>(table.size() - head->orderTableOffset);
+                head->currentOrder = orderOffsets[rng() % orderOffsets.size()];
+            }
+
+            std::memcpy(OrderManager::orders(), table.data(), table.size());
+            OrderManager::orderTableLength() = static_cast<uint32_t>(table.size());
+            OrderManager::generateNumDisplayFrames(_framesHead);
+        }
+
+        OrderTableState captureState() const
+        {
+            OrderTableState state;
+            const auto* table = reinterpret_cast<const uint8_t*>(OrderManager::orders());
+            state.table.assign(table, table + OrderManager::orderTableLength());
+            for (const auto* head : _heads)
+            {
+                state.heads.push_back(HeadState{ head->orderTableOffset, head->currentOrder, head->sizeOfOrderTable });
+            }
+            for (const auto& frame : OrderManager::displayFrames())
+            {
+                state.frameOffsets.push_back(frame.orderOffset);
+            }
+            return state;
+        }
+
+        void restoreState(const OrderTableState& state)
+        {
+            std::memcpy(OrderManager::orders(), state.table.data(), state.table.size());
+            OrderManager::orderTableLength() = static_cast<uint32_t>(state.table.size());
+            for (size_t i = 0; i < _heads.size(); i++)
+            {
+                _heads[i]->orderTableOffset = state.heads[i].orderTableOffset;
+                _heads[i]->currentOrder = state.heads[i].currentOrder;
+                _heads[i]->sizeOfOrderTable = state.heads[i].sizeOfOrderTable;
+            }
+            OrderManager::generateNumDisplayFrames(_framesHead);
+        }
+
+        // The original implementation, deleting each order as the table is scanned
+        static void removeOrdersOneAtATime(const StationId stationId)
+        {
+            for (auto i = 0U; i < OrderManager::orderTableLength();)
+            {
+                auto& order = OrderManager::orders()[i];
+                auto* stationOrder = order.as<OrderStation>();
+                if (stationOrder != nullptr && stationOrder->getStation() == stationId)
+                {
+                    for (auto* head : VehicleManager::VehicleList())
+                    {
+                        if (head->orderTableOffset <= i && i < head->orderTableOffset + head->sizeOfOrderTable)
+                        {
+                            OrderManager::deleteOrder(head, i - head->orderTableOffset);
+                            break;
+                        }
+                    }
+                }
+                i += kOrderSizes[enumValue(order.getType())];
+            }
+        }
+    };
+}
+
+TEST_F(OrderManagerTest, RemoveOrdersForStationMatchesDeletingEachOrder)
+{
+    for (auto seed = 0U; seed < 2000; seed++)
+    {
+        SCOPED_TRACE(seed);
+        SetUp();
+        _heads.clear();
+
+        std::mt19937 rng(seed);
+        createRandomOrderTable(rng);
+        const auto stationId = StationId(rng() % kNumStations);
+
+        const auto initial = captureState();
+        removeOrdersOneAtATime(stationId);
+        const auto expected = captureState();
+
+        restoreState(initial);
+        OrderManager::removeOrdersForStation(stationId);
+        const auto actual = captureState();
+
+        ASSERT_EQ(actual.table, expected.table);
+        ASSERT_EQ(actual.heads, expected.heads);
+        ASSERT_EQ(actual.frameOffsets, expected.frameOffsets);
+    }
+}
+
+TEST_F(OrderManagerTest, RemoveOrdersForStationLeavesCorruptTableUnchanged)
+{
+    auto* first = createHead();
+    auto* second = createHead();
+
+    std::vector<uint8_t> table;
+    first->orderTableOffset = 0;
+    appendOrder(table, OrderStopAt(StationId(1)));
+    appendOrder(table, OrderEnd());
+    first->sizeOfOrderTable = static_cast<uint16_t>(table.size());
+    first->currentOrder = 0;
+
+    // The invalid order comes after an order that would be removed
+    second->orderTableOffset = static_cast<uint32_t>(table.size());
+    appendOrder(table, OrderRouteThrough(StationId(1)));
+    table.push_back(7);
+    appendOrder(table, OrderEnd());
+    second->sizeOfOrderTable = static_cast<uint16_t>(table.size() - second->orderTableOffset);
+    second->currentOrder = 0;
+
+    _framesHead = first;
+    std::memcpy(OrderManager::orders(), table.data(), table.size());
+    OrderManager::orderTableLength() = static_cast<uint32_t>(table.size());
+    OrderManager::generateNumDisplayFrames(_framesHead);
+
+    const auto before = captureState();
+    EXPECT_THROW(OrderManager::removeOrdersForStation(StationId(1)), Exception::RuntimeError);
+    EXPECT_EQ(captureState(), before);
+}
@@ -0,0 +1,113 @@
+#include <OpenLoco/Effects/ParticleManager.h>
+#include <OpenLoco/Map/TileManager.h>
+#include <gtest/gtest.h>
+
+using namespace OpenLoco;
+using namespace OpenLoco::ParticleManager;
+
+namespace
+{
+    size_t countOnTile(const World::Pos2& loc)
+    {
+        size_t count = 0;
+        for (auto id = firstOnTile(loc); id != kNullParticle; id = nextOnTile(id))
+        {
+            count++;
+        }
+        return count;
+    }
+
+    class ParticleManagerTest : public ::testing::Test
+    {
+    protected:
+        void SetUp() override
+        {
+            ParticleManager::reset();
+        }
+    };
+}
+
+TEST_F(ParticleManagerTest, DropsParticlesOverBudget)
+{
+    const auto budget = getBudget(ParticleType::smoke);
+    for (size_t i = 0; i < budget + 10; i++)
+    {
+        createSmoke(World::Pos3(100, 100, 200));
+    }
+    EXPECT_EQ(getCount(ParticleType::smoke), budget);
+    EXPECT_EQ(countOnTile({ 100, 100 }), budget);
+
+    // Other types have their own budget
+    createExplosionSmoke(World::Pos3(100, 100, 200));
+    EXPECT_EQ(getCount(ParticleType::explosionSmoke), 1);
+}
+
+TEST_F(ParticleManagerTest, ParticlesExpire)
+{
+    createSmoke(World::Pos3(100, 100, 200));
+    createSplash(World::Pos3(1000, 1000, 100));
+    createExplosionSmoke(World::Pos3(2000, 2000, 100));
+
+    const auto smoke = get(firstOnTile({ 100, 100 }));
+    EXPECT_EQ(smoke.type, ParticleType::smoke);
+    EXPECT_EQ(smoke.position, World::Pos3(100, 100, 200));
+
+    // Splash lasts the longest at 0x1C00 / 0x55 ticks
+    for (auto i = 0; i < 0x1C00 / 0x55 + 1; i++)
+    {
+        ParticleManager::tick();
+    }
+    EXPECT_EQ(getCount(ParticleType::smoke), 0);
+    EXPECT_EQ(getCount(ParticleType::splash), 0);
+    EXPECT_EQ(getCount(ParticleType::explosionSmoke), 0);
+    EXPECT_EQ(firstOnTile({ 100, 100 }), kNullParticle);
+    EXPECT_EQ(firstOnTile({ 1000, 1003 }), kNullParticle);
+}
+
+TEST_F(ParticleManagerTest, SmokeRisesAndFreedSlotsAreReused)
+{
+    createSmoke(World::Pos3(100, 100, 200));
+    ParticleManager::tick();
+    EXPECT_EQ(get(firstOnTile({ 100, 100 })).position.z, 201);
+
+    const auto budget = getBudget(ParticleType::smoke);
+    for (auto i = 0; i < 0xC00 / 0x55 + 1; i++)
+    {
+        ParticleManager::tick();
+        createSmoke(World::Pos3(100, 100, 200));
+    }
+    EXPECT_LE(getCount(ParticleType::smoke), budget);
+    EXPECT_GT(getCount(ParticleType::smoke), 0);
+    EXPECT_EQ(countOnTile({ 100, 100 }), getCount(ParticleType::smoke));
+}
+
+TEST_F(ParticleManagerTest, LoadingOverLiveParticles)
+{
+    World::TileManager::allocateMapElements();
+    World::TileManager::initialise();
+
+    // No steam objects are loaded, as if the exhaust came from the previous game's object set
+    createExhaust(World::Pos3(100, 100, 200), 3);
+    createSmoke(World::Pos3(100, 100, 200));
+    createSplash(World::Pos3(1000, 1000, 100));
+    createExplosionSmoke(World::Pos3(2000, 2000, 100));
+    EXPECT_EQ(getCount(ParticleType::exhaust), 1);
+    EXPECT_EQ(get(firstOnTile({ 100, 100 })).spriteWidth, 44);
+
+    // What loading a save does
+    ParticleManager::reset();
+    for (auto type : { ParticleType::exhaust, ParticleType::splash, ParticleType::explosionSmoke, ParticleType::smoke })
+    {
+        EXPECT_EQ(getCount(type), 0);
+    }
+    EXPECT_EQ(firstOnTile({ 100, 100 }), kNullParticle);
+    EXPECT_EQ(firstOnTile({ 1000, 1003 }), kNullParticle);
+    EXPECT_EQ(firstOnTile({ 2000, 2000 }), kNullParticle);
+
+    // Exhaust whose steam object is missing is dropped rather than dereferenced
+    createExhaust(World::Pos3(100, 100, 200), 3);
+    EXPECT_EQ(get(firstOnTile({ 100, 100 })).spriteWidth, 0);
+    ParticleManager::tick();
+    EXPECT_EQ(getCount(ParticleType::exhaust), 0);
+    EXPECT_EQ(firstOnTile({ 100, 100 }), kNullParticle);
+}
@@ -0,0 +1,109 @@
+#include <OpenLoco/GameState.h>
+#include <OpenLoco/Vehicles/RoutingManager.h>
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <optional>
+#include <random>
+
+using namespace OpenLoco;
+using namespace OpenLoco::Vehicles;
+
+namespace
+{
+    // What the allocator used to do, scan the table for the first unallocated slot
+    std::optional<uint16_t> findFirstFreeSlot()
+    {
+        const auto& routings = getGameState().routings;
+        for (uint16_t i = 0; i < Limits::kMaxVehicles; i++)
+        {
+            if (routings[i][0] == RoutingManager::kRoutingNull)
+            {
+                return i;
+            }
+        }
+        return std::nullopt;
+    }
+
+    class RoutingManagerTest : public ::testing::Test
+    {
+    protected:
+        void SetUp() override
+        {
+            RoutingManager::resetRoutingTable();
+        }
+    };
+}
+
+TEST_F(RoutingManagerTest, AllocatesLowestFreeSlot)
+{
+    for (uint16_t i = 0; i < 3; i++)
+    {
+        auto handle = RoutingManager::getAndAllocateFreeRoutingHandle();
+        ASSERT_TRUE(handle.has_value());
+        EXPECT_EQ(handle->getVehicleRef(), i);
+    }
+
+    RoutingManager::freeRoutingHandle(RoutingHandle(1, 0));
+    auto handle = RoutingManager::getAndAllocateFreeRoutingHandle();
+    ASSERT_TRUE(handle.has_value());
+    EXPECT_EQ(handle->getVehicleRef(), 1);
+}
+
+TEST_F(RoutingManagerTest, FullTable)
+{
+    for (uint16_t i = 0; i < Limits::kMaxVehicles; i++)
+    {
+        ASSERT_TRUE(RoutingManager::getAndAllocateFreeRoutingHandle().has_value());
+    }
+    EXPECT_FALSE(RoutingManager::isEmptyRoutingSlotAvailable());
+    EXPECT_FALSE(RoutingManager::getAndAllocateFreeRoutingHandle().has_value());
+
+    RoutingManager::freeRoutingHandle(RoutingHandle(Limits::kMaxVehicles - 1, 0));
+    EXPECT_TRUE(RoutingManager::isEmptyRoutingSlotAvailable());
+    auto handle = RoutingManager::getAndAllocateFreeRoutingHandle();
+    ASSERT_TRUE(handle.has_value());
+    EXPECT_EQ(handle->getVehicleRef(), Limits::kMaxVehicles - 1);
+}
+
+TEST_F(RoutingManagerTest, MatchesTableScan)
+{
+    std::mt19937 rng(1234);
+    std::vector<uint16_t> allocated;
+    for (int i = 0; i < 20000; i++)
+    {
+        if (allocated.empty() || rng() % 3 != 0)
+        {
+            const auto expected = findFirstFreeSlot();
+            const auto handle = RoutingManager::getAndAllocateFreeRoutingHandle();
+            ASSERT_EQ(handle.has_value(), expected.has_value());
+            if (handle)
+            {
+                ASSERT_EQ(handle->getVehicleRef(), *expected);
+                allocated.push_back(handle->getVehicleRef());
+            }
+        }
+        else
+        {
+            const auto index = rng() % allocated.size();
+            RoutingManager::freeRoutingHandle(RoutingHandle(allocated[index], 0));
+            allocated.erase(allocated.begin() + index);
+        }
+    }
+}
+
+TEST_F(RoutingManagerTest, RebuildAfterLoad)
+{
+    // Simulate a loaded table where only slot 5 is unallocated
+    auto& routings = getGameState().routings;
+    for (auto& vehRoutings : routings)
+    {
+        std::fill(std::begin(vehRoutings), std::end(vehRoutings), RoutingManager::kAllocatedButFreeRouting);
+    }
+    routings[5][0] = RoutingManager::kRoutingNull;
+    RoutingManager::rebuildFreeSlots();
+
+    auto handle = RoutingManager::getAndAllocateFreeRoutingHandle();
+    ASSERT_TRUE(handle.has_value());
+    EXPECT_EQ(handle->getVehicleRef(), 5);
+    EXPECT_FALSE(RoutingManager::isEmptyRoutingSlotAvailable());
+}
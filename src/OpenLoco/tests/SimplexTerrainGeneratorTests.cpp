@@ -0,0 +1,321 @@
+#include <OpenLoco/Map/MapGenerator/HeightMap.h>
+#include <OpenLoco/Map/MapGenerator/SimplexTerrainGenerator.h>
+#include <OpenLoco/Scenario/ScenarioOptions.h>
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <random>
+
+using namespace OpenLoco;
+using namespace OpenLoco::World;
+using namespace OpenLoco::World::MapGenerator;
+
+namespace
+{
+    struct GeneratedMap
+    {
+        uint64_t hash;
+        uint8_t minHeight;
+        uint8_t maxHeight;
+    };
+
+    // The original per cell generator, kept as a reference for the output of the row block version
+    class ReferenceGenerator
+    {
+        std::mt19937 _pprng;
+
+        struct Settings
+        {
+            int32_t low = 2;
+            int32_t high = 24;
+            float baseFreq = 1.25f;
+            int32_t octaves = 4;
+            int32_t smooth = 2;
+        };
+
+        static int32_t fastFloor(float x)
+        {
+            return (x > 0) ? (static_cast<int32_t>(x)) : ((static_cast<int32_t>(x)) - 1);
+        }
+
+        static float grad(int32_t hash, float x, float y)
+        {
+            int32_t h = hash & 7;
+            float u = h < 4 ? x : y;
+            float v = h < 4 ? y : x;
+            return ((h & 1) != 0 ? -u : u) + ((h & 2) != 0 ? -2.0f * v : 2.0f * v);
+        }
+
+        static float generateNoise(const uint8_t* perm, float x, float y)
+        {
+            const float F2 = 0.366025403f;
+            const float G2 = 0.211324865f;
+
+            float n0, n1, n2;
+
+            float s = (x + y) * F2;
+            float xs = x + s;
+            float ys = y + s;
+            int32_t i = fastFloor(xs);
+            int32_t j = fastFloor(ys);
+
+            float t = static_cast<float>(i + j) * G2;
+            float X0 = i - t;
+            float Y0 = j - t;
+            float x0 = x - X0;
+            float y0 = y - Y0;
+
+            int32_t i1, j1;
+            if (x0 > y0)
+            {
+                i1 = 1;
+                j1 = 0;
+            }
+            else
+            {
+                i1 = 0;
+                j1 = 1;
+            }
+
+            float x1 = x0 - i1 + G2;
+            float y1 = y0 - j1 + G2;
+            float x2 = x0 - 1.0f + 2.0f * G2;
+            float y2 = y0 - 1.0f + 2.0f * G2;
+
+            int32_t ii = i % 256;
+            int32_t jj = j % 256;
+
+            float t0 = 0.5f - x0 * x0 - y0 * y0;
+            if (t0 < 0.0f)
+            {
+                n0 = 0.0f;
+            }
+            else
+            {
+                t0 *= t0;
+                n0 = t0 * t0 * grad(perm[ii + perm[jj]], x0, y0);
+            }
+
+            float t1 = 0.5f - x1 * x1 - y1 * y1;
+            if (t1 < 0.0f)
+            {
+                n1 = 0.0f;
+            }
+            else
+            {
+                t1 *= t1;
+                n1 = t1 * t1 * grad(perm[ii + i1 + perm[jj + j1]], x1, y1);
+            }
+
+            float t2 = 0.5f - x2 * x2 - y2 * y2;
+            if (t2 < 0.0f)
+            {
+                n2 = 0.0f;
+            }
+            else
+            {
+                t2 *= t2;
+                n2 = t2 * t2 * grad(perm[ii + 1 + perm[jj + 1]], x2, y2);
+            }
+
+            return 40.0f * (n0 + n1 + n2);
+        }
+
+        static float noiseFractal(const uint8_t* perm, int32_t x, int32_t y, float frequency, int32_t octaves, float lacunarity, float persistence)
+        {
+            float total = 0.0f;
+            float amplitude = persistence;
+            for (int32_t i = 0; i < octaves; i++)
+            {
+                total += generateNoise(perm, x * frequency, y * frequency) * amplitude;
+                frequency *= lacunarity;
+                amplitude *= persistence;
+            }
+            return total;
+        }
+
+        void generate(const Settings& settings, HeightMapRange heightMap)
+        {
+            auto freq = settings.baseFreq * (1.0f / std::max(heightMap.width, heightMap.height));
+
+            // The cell at the origin hashes perm[-1] for a corner that does not contribute
+            std::array<uint8_t, 513> permStorage{};
+            auto* perm = permStorage.data() + 1;
+            for (size_t i = 0; i < 512; i++)
+            {
+                perm[i] = _pprng() & 0xFF;
+            }
+
+            for (int32_t y = 0; y < heightMap.height; y++)
+            {
+                for (int32_t x = 0; x < heightMap.width; x++)
+                {
+                    auto noiseValue = std::clamp(noiseFractal(perm, x, y, freq, settings.octaves, 2.0f, 0.65f), -1.0f, 1.0f);
+                    auto normalisedNoiseValue = (noiseValue + 1.0f) / 2.0f;
+                    auto height = settings.low + static_cast<int32_t>(normalisedNoiseValue * settings.high);
+                    heightMap[TilePos2(x, y)] = height;
+                }
+            }
+
+            for (int32_t i = 0; i < settings.smooth; i++)
+            {
+                for (int32_t y = 1; y < heightMap.width - 1; y++)
+                {
+                    for (int32_t x = 1; x < heightMap.height - 1; x++)
+                    {
+                        int32_t total = 0;
+                        for (int32_t yy = -1; yy <= 1; yy++)
+                        {
+                            for (int32_t xx = -1; xx <= 1; xx++)
+                            {
+                                total += heightMap[TilePos2(x + xx, y + yy)];
+                            }
+                        }
+                        heightMap[TilePos2(x, y)] = total / 9;
+                    }
+                }
+            }
+        }
+
+    public:
+        void generate(const Scenario::Options& options, HeightMapRange heightMap, uint32_t seed)
+        {
+            _pprng.seed(seed);
+
+            auto hillDensity = std::clamp<uint8_t>(options.hillDensity, 0, 100) / 100.0f;
+
+            Settings settings;
+            settings.low = options.minLandHeight;
+            settings.smooth = std::clamp<uint8_t>(options.numTerrainSmoothingPasses, 1, 5);
+
+            switch (options.topographyStyle)
+            {
+                case Scenario::TopographyStyle::flatLand:
+                    settings.high = options.minLandHeight + 8;
+                    settings.baseFreq = 4.0f * hillDensity;
+                    settings.octaves = 5;
+                    break;
+                case Scenario::TopographyStyle::smallHills:
+                    settings.high = options.minLandHeight + 14;
+                    settings.baseFreq = 6.0f * hillDensity;
+                    settings.octaves = 6;
+                    break;
+                case Scenario::TopographyStyle::mountains:
+                    settings.high = 32;
+                    settings.baseFreq = 4.0f * hillDensity;
+                    settings.octaves = 6;
+                    break;
+                case Scenario::TopographyStyle::halfMountainsHills:
+                    settings.high = 32;
+                    settings.baseFreq = 8.0f * hillDensity;
+                    settings.octaves = 6;
+                    break;
+                case Scenario::TopographyStyle::halfMountainsFlat:
+                    settings.high = 32;
+                    settings.baseFreq = 6.0f * hillDensity;
+                    settings.octaves = 5;
+                    break;
+            }
+            generate(settings, heightMap);
+        }
+    };
+
+    Scenario::Options makeOptions(Scenario::TopographyStyle style, uint8_t hillDensity, uint8_t smoothingPasses, uint8_t minLandHeight)
+    {
+        Scenario::Options options{};
+        options.generator = Scenario::LandGeneratorType::Simplex;
+        options.topographyStyle = style;
+        options.hillDensity = hillDensity;
+        options.numTerrainSmoothingPasses = smoothingPasses;
+        options.minLandHeight = minLandHeight;
+        return options;
+    }
+
+    GeneratedMap generate(Scenario::TopographyStyle style, uint8_t hillDensity, uint8_t smoothingPasses, uint8_t minLandHeight, uint32_t seed)
+    {
+        const auto options = makeOptions(style, hillDensity, smoothingPasses, minLandHeight);
+
+        HeightMap heightMap(kMapColumns, kMapRows);
+        SimplexTerrainGenerator generator;
+        generator.generate(options, heightMap, seed);
+
+        // FNV-1a
+        GeneratedMap result{ 0xCBF29CE484222325ULL, 0xFF, 0 };
+        for (size_t i = 0; i < heightMap.size(); i++)
+        {
+            const auto height = heightMap.data()[i];
+            result.hash ^= height;
+            result.hash *= 0x100000001B3ULL;
+            result.minHeight = std::min(result.minHeight, height);
+            result.maxHeight = std::max(result.maxHeight, height);
+        }
+        return result;
+    }
+}
+
+// The expected values pin the exact output of the generator for a given seed. They must only
+// change along with a deliberate change to the noise or smoothing.
+TEST(SimplexTerrainGeneratorTest, GoldenMountains)
+{
+    const auto map = generate(Scenario::TopographyStyle::mountains, 50, 2, 4, 12345);
+    EXPECT_EQ(map.hash, 6931479252170621932ULL);
+    EXPECT_EQ(map.minHeight, 4);
+    EXPECT_EQ(map.maxHeight, 34);
+}
+
+TEST(SimplexTerrainGeneratorTest, GoldenSmallHills)
+{
+    const auto map = generate(Scenario::TopographyStyle::smallHills, 80, 5, 8, 42);
+    EXPECT_EQ(map.hash, 6669133007075797363ULL);
+    EXPECT_EQ(map.minHeight, 8);
+    EXPECT_EQ(map.maxHeight, 30);
+}
+
+TEST(SimplexTerrainGeneratorTest, SameSeedSameMap)
+{
+    const auto a = generate(Scenario::TopographyStyle::halfMountainsHills, 65, 3, 6, 7);
+    const auto b = generate(Scenario::TopographyStyle::halfMountainsHills, 65, 3, 6, 7);
+    EXPECT_EQ(a.hash, b.hash);
+}
+
+TEST(SimplexTerrainGeneratorTest, MatchesReferenceGenerator)
+{
+    struct Case
+    {
+        Scenario::TopographyStyle style;
+        uint8_t hillDensity;
+        uint8_t smoothingPasses;
+        uint8_t minLandHeight;
+        uint32_t seed;
+    };
+    const Case cases[] = {
+        { Scenario::TopographyStyle::flatLand, 20, 1, 2, 1 },
+        { Scenario::TopographyStyle::smallHills, 80, 5, 8, 42 },
+        { Scenario::TopographyStyle::mountains, 50, 2, 4, 12345 },
+        { Scenario::TopographyStyle::halfMountainsHills, 100, 3, 6, 0xDEADBEEF },
+        { Scenario::TopographyStyle::halfMountainsFlat, 0, 4, 12, 77 },
+        // Dense hills with one pass leave the roughest terrain for the smoothing to work on
+        { Scenario::TopographyStyle::halfMountainsHills, 100, 1, 0, 3 },
+        { Scenario::TopographyStyle::smallHills, 100, 5, 0, 0x5EED5 },
+    };
+
+    for (const auto& c : cases)
+    {
+        const auto options = makeOptions(c.style, c.hillDensity, c.smoothingPasses, c.minLandHeight);
+
+        HeightMap expected(kMapColumns, kMapRows);
+        ReferenceGenerator().generate(options, expected, c.seed);
+
+        HeightMap actual(kMapColumns, kMapRows);
+        SimplexTerrainGenerator().generate(options, actual, c.seed);
+
+        ASSERT_EQ(expected.size(), actual.size());
+        size_t mismatches = 0;
+        for (size_t i = 0; i < expected.size(); i++)
+        {
+            mismatches += expected.data()[i] != actual.data()[i] ? 1 : 0;
+        }
+        EXPECT_EQ(mismatches, 0U) << "seed " << c.seed;
+    }
+}
@@ -0,0 +1,105 @@
+#include <OpenLoco/Network/Socket.h>
+#include <chrono>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <span>
+#include <thread>
+#include <vector>
+
+using namespace OpenLoco::Network;
+
+namespace
+{
+    // Long enough that returning early can only be caused by data or a wakeup
+    constexpr uint32_t kLongTimeout = 5000;
+
+    // Waits on another thread while the given function runs on this one. The wait has to end whether the
+    // function runs before or during the wait, so the test does not depend on how the threads interleave.
+    template<typename TFunc>
+    std::chrono::milliseconds waitWhile(ISocketPoller& poller, std::span<const std::unique_ptr<IUdpSocket>> sockets, TFunc&& func)
+    {
+        std::chrono::milliseconds elapsed{};
+        std::thread waitThread([&] {
+            const auto start = std::chrono::steady_clock::now();
+            poller.wait(sockets, kLongTimeout);
+            elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+        });
+        func();
+        waitThread.join();
+        return elapsed;
+    }
+
+    void expectWaitEndsOnData(std::unique_ptr<IUdpSocket> receiver, std::unique_ptr<IUdpSocket> sender, const INetworkEndpoint& destination)
+    {
+        std::vector<std::unique_ptr<IUdpSocket>> sockets;
+        sockets.push_back(std::move(receiver));
+        auto poller = sockets.front()->createPoller();
+
+        const auto elapsed = waitWhile(*poller, sockets, [&] {
+            const uint32_t value = 0x12345678;
+            sender->sendData(destination, &value, sizeof(value));
+        });
+        EXPECT_LT(elapsed.count(), kLongTimeout / 2);
+
+        uint32_t value{};
+        size_t received{};
+        EXPECT_EQ(sockets.front()->receiveData(&value, sizeof(value), &received, nullptr), NetworkReadPacket::success);
+        EXPECT_EQ(value, 0x12345678U);
+    }
+
+    void expectWaitEndsOnWakeup(std::unique_ptr<IUdpSocket> socket)
+    {
+        std::vector<std::unique_ptr<IUdpSocket>> sockets;
+        sockets.push_back(std::move(socket));
+        auto poller = sockets.front()->createPoller();
+
+        const auto elapsed = waitWhile(*poller, sockets, [&] { poller->wakeup(); });
+        EXPECT_LT(elapsed.count(), kLongTimeout / 2);
+    }
+}
+
+TEST(SocketPollerTest, LoopbackWaitEndsOnData)
+{
+    auto receiver = Socket::createLoopbackUdp();
+    receiver->listen(Protocol::ipv4, 0);
+    const auto destination = Socket::resolveLoopback(receiver->getPort());
+    expectWaitEndsOnData(std::move(receiver), Socket::createLoopbackUdp(), *destination);
+}
+
+TEST(SocketPollerTest, LoopbackWaitEndsOnWakeup)
+{
+    auto socket = Socket::createLoopbackUdp();
+    socket->listen(Protocol::ipv4, 0);
+    expectWaitEndsOnWakeup(std::move(socket));
+}
+
+TEST(SocketPollerTest, LoopbackWakeupBeforeWait)
+{
+    auto socket = Socket::createLoopbackUdp();
+    socket->listen(Protocol::ipv4, 0);
+    std::vector<std::unique_ptr<IUdpSocket>> sockets;
+    sockets.push_back(std::move(socket));
+    auto poller = sockets.front()->createPoller();
+
+    // A wakeup that happens just before the wait must not be lost
+    poller->wakeup();
+    const auto start = std::chrono::steady_clock::now();
+    poller->wait(sockets, kLongTimeout);
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(kLongTimeout / 2));
+}
+
+TEST(SocketPollerTest, UdpWaitEndsOnData)
+{
+    auto receiver = Socket::createUdp();
+    receiver->listen(Protocol::ipv4, "127.0.0.1", 0);
+    ASSERT_NE(receiver->getPort(), 0);
+    const auto destination = Socket::resolve(Protocol::ipv4, "127.0.0.1", receiver->getPort());
+    expectWaitEndsOnData(std::move(receiver), Socket::createUdp(), *destination);
+}
+
+TEST(SocketPollerTest, UdpWaitEndsOnWakeup)
+{
+    auto socket = Socket::createUdp();
+    socket->listen(Protocol::ipv4, "127.0.0.1", 0);
+    expectWaitEndsOnWakeup(std::move(socket));
+}
@@ -0,0 +1,102 @@
+#include <OpenLoco/GameState.h>
+#include <OpenLoco/Map/SurfaceElement.h>
+#include <OpenLoco/Map/TileManager.h>
+#include <OpenLoco/Network/StateChecksum.h>
+#include <gtest/gtest.h>
+
+using namespace OpenLoco;
+using namespace OpenLoco::Network;
+
+namespace
+{
+    constexpr uint32_t kFirstTick = 1000 * StateChecksum::kInterval;
+
+    class StateChecksumTest : public ::testing::Test
+    {
+    protected:
+        static void SetUpTestSuite()
+        {
+            World::TileManager::allocateMapElements();
+        }
+
+        void SetUp() override
+        {
+            World::TileManager::initialise();
+
+            auto& gameState = getGameState();
+            gameState.rng = Core::Prng(0x1234, 0x5678);
+            for (auto& entity : gameState.entities)
+            {
+                entity.baseType = EntityBaseType::null;
+            }
+            auto& entity = gameState.entities[10];
+            entity.baseType = EntityBaseType::effect;
+            entity.id = EntityId(10);
+            entity.position = World::Pos3(1000, 2000, 32);
+        }
+
+        void TearDown() override
+        {
+            getGameState().entities[10].baseType = EntityBaseType::null;
+        }
+
+        // Runs a whole interval from the same tick and the same starting point, as a client does after
+        // receiving the state
+        static uint32_t runInterval()
+        {
+            StateChecksum::reset();
+            for (auto tick = kFirstTick; tick < kFirstTick + StateChecksum::kInterval - 1; tick++)
+            {
+                EXPECT_FALSE(StateChecksum::update(tick));
+            }
+            EXPECT_TRUE(StateChecksum::update(kFirstTick + StateChecksum::kInterval - 1));
+            return StateChecksum::getLastChecksum();
+        }
+    };
+}
+
+TEST_F(StateChecksumTest, IdenticalRunsMatch)
+{
+    const auto checksum = runInterval();
+    EXPECT_EQ(runInterval(), checksum);
+    EXPECT_EQ(runInterval(), checksum);
+}
+
+TEST_F(StateChecksumTest, StateChangesAreDetected)
+{
+    const auto checksum = runInterval();
+    auto& gameState = getGameState();
+
+    gameState.rng.randNext();
+    EXPECT_NE(runInterval(), checksum);
+    gameState.rng = Core::Prng(0x1234, 0x5678);
+    EXPECT_EQ(runInterval(), checksum);
+
+    gameState.entities[10].position.x += 1;
+    EXPECT_NE(runInterval(), checksum);
+    gameState.entities[10].position.x -= 1;
+    EXPECT_EQ(runInterval(), checksum);
+
+    // Tile rows are spread over the interval, a change anywhere on the map is still found
+    auto* surface = World::TileManager::get(World::TilePos2(World::kMapColumns - 2, World::kMapRows - 2)).surface();
+    ASSERT_NE(surface, nullptr);
+    surface->setWater(4);
+    EXPECT_NE(runInterval(), checksum);
+    surface->setWater(0);
+    EXPECT_EQ(runInterval(), checksum);
+}
+
+TEST_F(StateChecksumTest, GhostElementsAreIgnored)
+{
+    const auto checksum = runInterval();
+
+    // Ghosts only exist on the client placing them
+    const auto pos = World::toWorldSpace(World::TilePos2(20, 20));
+    auto* ghost = World::TileManager::insertElement(World::ElementType::tree, pos, 8, 0);
+    ASSERT_NE(ghost, nullptr);
+    ghost->setGhost(true);
+    EXPECT_EQ(runInterval(), checksum);
+
+    ghost->setGhost(false);
+    EXPECT_NE(runInterval(), checksum);
+}
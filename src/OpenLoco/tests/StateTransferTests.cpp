@@ -0,0 +1,196 @@
+#include <OpenLoco/Network/NetworkConnection.h>
+#include <OpenLoco/Network/Packet.h>
+#include <OpenLoco/Network/Socket.h>
+#include <OpenLoco/Network/StateTransfer.h>
+#include <cstdint>
+#include <cstring>
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+using namespace OpenLoco::Network;
+
+namespace
+{
+    // Mostly repetitive data with some noise, roughly what a save looks like to the compressor
+    std::vector<uint8_t> makeState(size_t size, uint32_t seed)
+    {
+        std::mt19937 rng(seed);
+        std::vector<uint8_t> data(size);
+        for (size_t i = 0; i < size; i++)
+        {
+            data[i] = (rng() % 8) == 0 ? static_cast<uint8_t>(rng()) : static_cast<uint8_t>(i / 64);
+        }
+        return data;
+    }
+
+    template<typename T>
+    void appendValue(std::vector<uint8_t>& payload, const T& value)
+    {
+        const auto* bytes = reinterpret_cast<const uint8_t*>(&value);
+        payload.insert(payload.end(), bytes, bytes + sizeof(T));
+    }
+
+    void pumpSocket(IUdpSocket& socket, NetworkConnection& connection)
+    {
+        Packet packet;
+        size_t packetSize{};
+        while (socket.receiveData(&packet, sizeof(Packet), &packetSize, nullptr) == NetworkReadPacket::success)
+        {
+            connection.receivePacket(packet);
+        }
+    }
+}
+
+TEST(StateTransferTest, FullRoundTrip)
+{
+    const auto data = makeState(StateSnapshot::kBlockSize * 5 + 123, 1);
+    StateSnapshot snapshot(data);
+
+    const auto payload = snapshot.encode(nullptr);
+    EXPECT_LT(payload.size(), data.size());
+
+    const auto decoded = StateSnapshot::decode(payload, nullptr);
+    ASSERT_TRUE(decoded.has_value());
+    EXPECT_EQ(*decoded, data);
+}
+
+TEST(StateTransferTest, DeltaOnlyContainsChangedBlocks)
+{
+    const auto oldData = makeState(StateSnapshot::kBlockSize * 8, 2);
+    auto newData = oldData;
+    newData[StateSnapshot::kBlockSize * 3 + 10] ^= 0xFF;
+
+    StateSnapshot base(oldData);
+    StateSnapshot snapshot(newData);
+    EXPECT_NE(base.getHash(), snapshot.getHash());
+
+    const auto full = snapshot.encode(nullptr);
+    const auto delta = snapshot.encode(&base);
+    EXPECT_LT(delta.size() * 4, full.size());
+
+    const auto decoded = StateSnapshot::decode(delta, &base);
+    ASSERT_TRUE(decoded.has_value());
+    EXPECT_EQ(*decoded, newData);
+}
+
+TEST(StateTransferTest, DeltaHandlesGrowingState)
+{
+    const auto oldData = makeState(StateSnapshot::kBlockSize * 2 + 50, 3);
+    auto newData = oldData;
+    newData.resize(StateSnapshot::kBlockSize * 4 + 7, 0x42);
+
+    StateSnapshot base(oldData);
+    StateSnapshot snapshot(newData);
+
+    const auto decoded = StateSnapshot::decode(snapshot.encode(&base), &base);
+    ASSERT_TRUE(decoded.has_value());
+    EXPECT_EQ(*decoded, newData);
+}
+
+TEST(StateTransferTest, DeltaRejectedWithWrongBase)
+{
+    StateSnapshot base(makeState(StateSnapshot::kBlockSize * 2, 4));
+    StateSnapshot other(makeState(StateSnapshot::kBlockSize * 2, 5));
+    StateSnapshot snapshot(makeState(StateSnapshot::kBlockSize * 2, 6));
+
+    const auto delta = snapshot.encode(&base);
+    EXPECT_FALSE(StateSnapshot::decode(delta, nullptr).has_value());
+    EXPECT_FALSE(StateSnapshot::decode(delta, &other).has_value());
+}
+
+TEST(StateTransferTest, CorruptPayloadRejected)
+{
+    StateSnapshot snapshot(makeState(StateSnapshot::kBlockSize, 7));
+    auto payload = snapshot.encode(nullptr);
+    payload.resize(payload.size() / 2);
+    EXPECT_FALSE(StateSnapshot::decode(payload, nullptr).has_value());
+}
+
+TEST(StateTransferTest, OversizedStateRejected)
+{
+    StateSnapshot snapshot(makeState(StateSnapshot::kBlockSize, 9));
+    auto payload = snapshot.encode(nullptr);
+
+    // The data size follows the two hashes at the start of the payload
+    const uint32_t dataSize = 0xFFFFFFFF;
+    std::memcpy(payload.data() + 2 * sizeof(snapshot_hash_t), &dataSize, sizeof(dataSize));
+    EXPECT_FALSE(StateSnapshot::decode(payload, nullptr).has_value());
+}
+
+TEST(StateTransferTest, UncompressedBlocksDecoded)
+{
+    // Blocks that failed to compress are sent as they are
+    const auto data = makeState(StateSnapshot::kBlockSize + 100, 10);
+    StateSnapshot snapshot(data);
+
+    std::vector<uint8_t> payload;
+    appendValue(payload, snapshot.getHash());
+    appendValue(payload, snapshot_hash_t{ 0 });
+    appendValue(payload, static_cast<uint32_t>(data.size()));
+    appendValue(payload, StateSnapshot::kBlockSize);
+    appendValue(payload, uint32_t{ 2 });
+    for (uint32_t index = 0; index < 2; index++)
+    {
+        const auto offset = index * StateSnapshot::kBlockSize;
+        const auto size = std::min<uint32_t>(StateSnapshot::kBlockSize, static_cast<uint32_t>(data.size()) - offset);
+        appendValue(payload, index);
+        appendValue(payload, size);
+        appendValue(payload, uint8_t{ 0 });
+        payload.insert(payload.end(), data.begin() + offset, data.begin() + offset + size);
+    }
+
+    const auto decoded = StateSnapshot::decode(payload, nullptr);
+    ASSERT_TRUE(decoded.has_value());
+    EXPECT_EQ(*decoded, data);
+}
+
+TEST(StateTransferTest, TransferOverLoopback)
+{
+    constexpr uint16_t kServerPort = 20001;
+    constexpr uint32_t kCookie = 0x1234;
+
+    auto serverSocket = Socket::createLoopbackUdp();
+    serverSocket->listen(Protocol::ipv4, kServerPort);
+    auto clientSocket = Socket::createLoopbackUdp();
+
+    NetworkConnection clientConnection(clientSocket.get(), Socket::resolveLoopback(kServerPort));
+
+    // Let the server learn the client endpoint from the first packet, as NetworkServer does
+    RequestStatePacket request;
+    request.cookie = kCookie;
+    clientConnection.sendPacket(request);
+
+    Packet packet;
+    size_t packetSize{};
+    std::unique_ptr<INetworkEndpoint> clientEndpoint;
+    ASSERT_EQ(serverSocket->receiveData(&packet, sizeof(Packet), &packetSize, &clientEndpoint), NetworkReadPacket::success);
+    NetworkConnection serverConnection(serverSocket.get(), std::move(clientEndpoint));
+    serverConnection.receivePacket(packet);
+
+    const auto data = makeState(StateSnapshot::kBlockSize * 3 + 999, 8);
+    StateSnapshot snapshot(data);
+    const auto payload = snapshot.encode(nullptr);
+    sendStatePayload(serverConnection, kCookie, payload);
+
+    StatePayloadReceiver receiver;
+    receiver.reset(kCookie);
+    pumpSocket(*clientSocket, clientConnection);
+    while (auto received = clientConnection.takeNextPacket())
+    {
+        if (received->header.kind == PacketKind::requestStateResponse)
+        {
+            receiver.receive(*received->cast<RequestStateResponse>());
+        }
+        else if (received->header.kind == PacketKind::requestStateResponseChunk)
+        {
+            receiver.receive(*received->cast<RequestStateResponseChunk>());
+        }
+    }
+    ASSERT_TRUE(receiver.isComplete());
+    EXPECT_EQ(receiver.getReceivedBytes(), payload.size());
+
+    const auto decoded = StateSnapshot::decode(receiver.takePayload(), nullptr);
+    ASSERT_TRUE(decoded.has_value());
+    EXPECT_EQ(*decoded, data);
+}
@@ -0,0 +1,86 @@
+#include <OpenLoco/Entities/Entity.h>
+#include <OpenLoco/GameState.h>
+#include <OpenLoco/Map/Track/SubpositionData.h>
+#include <gtest/gtest.h>
+
+using namespace OpenLoco;
+using namespace OpenLoco::World::TrackData;
+
+namespace
+{
+    constexpr uint16_t kNumTrackAndDirections = 44 * 8;
+    constexpr uint16_t kNumRoadAndDirections = 10 * 8;
+
+    // FNV-1a over the size and every entry of each table, the expected values were taken from the
+    // MoveInfo tables before they were stored packed.
+    template<typename TGetter>
+    uint64_t hashTables(const uint16_t count, TGetter&& getter)
+    {
+        uint64_t hash = 0xCBF29CE484222325ULL;
+        auto add = [&hash](const int32_t value) {
+            for (auto i = 0; i < 4; i++)
+            {
+                hash ^= static_cast<uint8_t>(value >> (i * 8));
+                hash *= 0x100000001B3ULL;
+            }
+        };
+
+        for (uint16_t i = 0; i < count; i++)
+        {
+            const auto table = getter(i);
+            add(static_cast<int32_t>(table.size()));
+            for (size_t j = 0; j < table.size(); j++)
+            {
+                const auto moveInfo = table[j];
+                add(moveInfo.loc.x);
+                add(moveInfo.loc.y);
+                add(moveInfo.loc.z);
+                add(moveInfo.yaw);
+                add(static_cast<int32_t>(moveInfo.pitch));
+            }
+        }
+        return hash;
+    }
+
+    // All four lane and turnaround variants for each road piece and direction
+    uint16_t toRoadAndDirection(const uint16_t index)
+    {
+        return ((index / kNumRoadAndDirections) << 7) | (index % kNumRoadAndDirections);
+    }
+}
+
+TEST(SubpositionDataTest, TrackTablesMatch)
+{
+    EXPECT_EQ(hashTables(kNumTrackAndDirections, getTrackSubPositon), 16419780897696517013ULL);
+}
+
+TEST(SubpositionDataTest, RoadTablesMatch)
+{
+    getGameState().trafficHandedness = false;
+    EXPECT_EQ(hashTables(kNumRoadAndDirections * 4, [](uint16_t i) { return getRoadSubPositon(toRoadAndDirection(i)); }), 8932470565522174301ULL);
+
+    getGameState().trafficHandedness = true;
+    EXPECT_EQ(hashTables(kNumRoadAndDirections * 4, [](uint16_t i) { return getRoadSubPositon(toRoadAndDirection(i)); }), 2362416183012792093ULL);
+}
+
+TEST(SubpositionDataTest, RoadPlacementTablesMatch)
+{
+    EXPECT_EQ(hashTables(kNumRoadAndDirections, getRoadPlacementSubPositon), 9905005304448276837ULL);
+}
+
+TEST(SubpositionDataTest, PackRoundTrip)
+{
+    for (const auto& moveInfo : { MoveInfo{ World::Pos3(-64, 95, -32), 62, static_cast<Pitch>(12) }, MoveInfo{ World::Pos3(95, -64, 31), 0, static_cast<Pitch>(0) } })
+    {
+        const auto unpacked = PackedMoveInfo::pack(moveInfo).unpack();
+        EXPECT_EQ(unpacked.loc, moveInfo.loc);
+        EXPECT_EQ(unpacked.yaw, moveInfo.yaw);
+        EXPECT_EQ(unpacked.pitch, moveInfo.pitch);
+    }
+
+    const auto straight = getTrackSubPositon(0);
+    ASSERT_FALSE(straight.empty());
+    EXPECT_EQ(straight[0].loc, World::Pos3(31, 16, 0));
+    EXPECT_EQ(straight[straight.size() - 1].loc, World::Pos3(0, 16, 0));
+    EXPECT_EQ(straight[0].yaw, 0);
+}
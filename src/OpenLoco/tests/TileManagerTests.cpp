@@ -60,6 +60,55 @@ namespace
         }
     };
 
+    // Scatters trees over the map and removes some again so that the element array ends up fragmented.
+    // Returns the tiles that were touched.
+    std::vector<TilePos2> fragmentMap()
+    {
+        std::vector<TilePos2> touched;
+        for (uint32_t i = 0; i < 3000; ++i)
+        {
+            const auto pos = TilePos2(static_cast<OpenLoco::tile_coord_t>(1 + (i * 7919) % 380), static_cast<OpenLoco::tile_coord_t>(1 + (i * 104729) % 380));
+            TileManager::insertElement(ElementType::tree, toWorldSpace(pos), static_cast<uint8_t>(8 + (i % 8) * 4), 0);
+            touched.push_back(pos);
+        }
+        for (size_t i = 0; i < touched.size(); i += 3)
+        {
+            for (auto& el : TileManager::get(touched[i]))
+            {
+                if (el.type() == ElementType::tree)
+                {
+                    TileManager::removeElement(el);
+                    break;
+                }
+            }
+        }
+        std::ranges::sort(touched, TileManager::isBeforeInMapOrder);
+        const auto [first, last] = std::ranges::unique(touched);
+        touched.erase(first, last);
+        return touched;
+    }
+
+    // The layout reorganise produces, every tile's elements one after the other in map order
+    void expectPackedInMapOrder()
+    {
+        const auto entries = TileManager::getEntries();
+        size_t offset = 0;
+        for (OpenLoco::tile_coord_t y = 0; y < kMapRows; ++y)
+        {
+            for (OpenLoco::tile_coord_t x = 0; x < kMapColumns; ++x)
+            {
+                auto tile = TileManager::get(TilePos2(x, y));
+                if (&*tile.begin() != entries.data() + offset)
+                {
+                    ADD_FAILURE() << "tile (" << x << "," << y << ") is not packed in map order";
+                    return;
+                }
+                offset += tile.size();
+            }
+        }
+        EXPECT_EQ(offset, entries.size());
+    }
+
     constexpr TilePos2 kTestTile{ 10, 5 };
     constexpr TilePos2 kOtherTile{ 11, 5 };
 }
@@ -975,3 +1024,308 @@ TEST_F(TileManagerTest, ReorganiseAfterChurnMatchesByteShadow)
             << "tile (" << tilesOfInterest[i].x << "," << tilesOfInterest[i].y << ") diverged after reorganise";
     }
 }
+
+TEST_F(TileManagerTest, ForEachElementVisitsPlacedElementsWithTheirTile)
+{
+    ASSERT_NE(TileManager::insertElement(ElementType::track, toWorldSpace(kTestTile), 8, 0), nullptr);
+    ASSERT_NE(TileManager::insertElement(ElementType::track, toWorldSpace(kOtherTile), 8, 0), nullptr);
+    ASSERT_NE(TileManager::insertElement(ElementType::track, toWorldSpace(kTestTile), 12, 0), nullptr);
+
+    std::vector<TilePos2> visited;
+    TileManager::forEachElement<TrackElement>([&visited](TrackElement&, const TilePos2 pos) {
+        visited.push_back(pos);
+    });
+    std::ranges::sort(visited, TileManager::isBeforeInMapOrder);
+
+    const std::vector<TilePos2> expected{ kTestTile, kTestTile, kOtherTile };
+    EXPECT_EQ(visited, expected);
+}
+
+TEST_F(TileManagerTest, ForEachElementSkipsElementsNotOnTheMap)
+{
+    // Construction previews allocate elements without ever placing them on a tile
+    const auto preview = TileManager::allocElement(TrackElement{});
+    ASSERT_NE(TileManager::insertElement(ElementType::track, toWorldSpace(kTestTile), 8, 0), nullptr);
+
+    size_t count = 0;
+    TileManager::forEachElement<TrackElement>([&count](TrackElement&, const TilePos2 pos) {
+        EXPECT_EQ(pos, kTestTile);
+        count++;
+    });
+    EXPECT_EQ(count, 1u);
+
+    TileManager::destroyElement(preview);
+}
+
+TEST_F(TileManagerTest, ForEachElementOwnedByFiltersOnOwner)
+{
+    auto* mine = TileManager::insertElement(ElementType::road, toWorldSpace(kTestTile), 8, 0);
+    ASSERT_NE(mine, nullptr);
+    mine->as<RoadElement>()->setOwner(OpenLoco::CompanyId(1));
+    auto* neutral = TileManager::insertElement(ElementType::road, toWorldSpace(kOtherTile), 8, 0);
+    ASSERT_NE(neutral, nullptr);
+    neutral->as<RoadElement>()->setOwner(OpenLoco::CompanyId::neutral);
+
+    std::vector<TilePos2> visited;
+    TileManager::forEachElementOwnedBy<RoadElement>(OpenLoco::CompanyId(1), [&visited](RoadElement&, const TilePos2 pos) {
+        visited.push_back(pos);
+    });
+    ASSERT_EQ(visited.size(), 1u);
+    EXPECT_EQ(visited[0], kTestTile);
+}
+
+TEST_F(TileManagerTest, GetTilesWithElementIsSortedAndUnique)
+{
+    const std::vector<TilePos2> placed{
+        TilePos2{ 20, 3 }, TilePos2{ 5, 7 }, TilePos2{ 5, 7 }, TilePos2{ 9, 3 }
+    };
+    uint8_t baseZ = 8;
+    for (auto pos : placed)
+    {
+        ASSERT_NE(TileManager::insertElement(ElementType::tree, toWorldSpace(pos), baseZ, 0), nullptr);
+        baseZ += 4;
+    }
+
+    const std::vector<TilePos2> expected{ TilePos2{ 9, 3 }, TilePos2{ 20, 3 }, TilePos2{ 5, 7 } };
+    EXPECT_EQ(TileManager::getTilesWithElement<TreeElement>(), expected);
+
+    const auto high = TileManager::getTilesWithElement<TreeElement>([](const TreeElement& el) { return el.baseZ() >= 16; });
+    const std::vector<TilePos2> expectedHigh{ TilePos2{ 9, 3 }, TilePos2{ 5, 7 } };
+    EXPECT_EQ(high, expectedHigh);
+}
+
+TEST_F(TileManagerTest, ElementTilesSurviveRemovalAndReorganise)
+{
+    ASSERT_NE(TileManager::insertElement(ElementType::tree, toWorldSpace(kTestTile), 8, 0), nullptr);
+    ASSERT_NE(TileManager::insertElement(ElementType::tree, toWorldSpace(kOtherTile), 8, 0), nullptr);
+
+    for (auto& el : TileManager::get(kTestTile))
+    {
+        if (el.type() == ElementType::tree)
+        {
+            TileManager::removeElement(el);
+            break;
+        }
+    }
+    TileManager::reorganise();
+
+    const std::vector<TilePos2> expected{ kOtherTile };
+    EXPECT_EQ(TileManager::getTilesWithElement<TreeElement>(), expected);
+}
+
+TEST_F(TileManagerTest, ReorganiseKeepsElementAddresses)
+{
+    // Callers may hold element pointers over an insert, which can reorganise when running out of space
+    std::vector<std::pair<TilePos2, const TileElement*>> trees;
+    for (OpenLoco::tile_coord_t x = 1; x <= 100; ++x)
+    {
+        const auto pos = TilePos2{ x, 40 };
+        auto* el = TileManager::insertElement(ElementType::tree, toWorldSpace(pos), static_cast<uint8_t>(8 + (x % 4) * 4), 0);
+        ASSERT_NE(el, nullptr);
+        if (x % 10 == 0)
+        {
+            trees.emplace_back(pos, &TileManager::resolveEntry(el));
+        }
+    }
+    for (OpenLoco::tile_coord_t x = 1; x <= 100; ++x)
+    {
+        if (x % 10 == 0)
+        {
+            continue;
+        }
+        for (auto& el : TileManager::get(TilePos2{ x, 40 }))
+        {
+            if (el.type() == ElementType::tree)
+            {
+                TileManager::removeElement(el);
+                break;
+            }
+        }
+    }
+    ASSERT_EQ(TileManager::getStore<TreeElement>().capacity(), 100u);
+
+    TileManager::reorganise();
+
+    EXPECT_EQ(TileManager::getStore<TreeElement>().capacity(), 100u);
+    for (const auto& [pos, element] : trees)
+    {
+        const TileElement* found = nullptr;
+        for (auto& el : TileManager::get(pos))
+        {
+            if (el.type() == ElementType::tree)
+            {
+                found = &TileManager::resolveEntry(&el);
+            }
+        }
+        EXPECT_EQ(found, element) << "tree at x " << pos.x << " moved by reorganise";
+    }
+}
+
+TEST_F(TileManagerTest, CompactElementStoresKeepsElements)
+{
+    for (OpenLoco::tile_coord_t x = 1; x <= 100; ++x)
+    {
+        ASSERT_NE(TileManager::insertElement(ElementType::tree, toWorldSpace(TilePos2{ x, 40 }), static_cast<uint8_t>(8 + (x % 4) * 4), 0), nullptr);
+    }
+    for (OpenLoco::tile_coord_t x = 1; x <= 100; ++x)
+    {
+        if (x % 10 == 0)
+        {
+            continue;
+        }
+        for (auto& el : TileManager::get(TilePos2{ x, 40 }))
+        {
+            if (el.type() == ElementType::tree)
+            {
+                TileManager::removeElement(el);
+                break;
+            }
+        }
+    }
+    ASSERT_EQ(TileManager::getStore<TreeElement>().size(), 10u);
+    ASSERT_EQ(TileManager::getStore<TreeElement>().capacity(), 100u);
+
+    TileManager::reorganise();
+    TileManager::compactElementStores();
+
+    EXPECT_EQ(TileManager::getStore<TreeElement>().capacity(), 10u);
+    for (OpenLoco::tile_coord_t x = 10; x <= 100; x += 10)
+    {
+        bool found = false;
+        for (auto& el : TileManager::get(TilePos2{ x, 40 }))
+        {
+            found |= el.type() == ElementType::tree && el.baseZ() == 8 + (x % 4) * 4;
+        }
+        EXPECT_TRUE(found) << "tree at x " << x << " lost after compaction";
+    }
+    EXPECT_EQ(TileManager::getTilesWithElement<TreeElement>().size(), 10u);
+}
+
+TEST_F(TileManagerTest, ReorganisePacksTilesInMapOrder)
+{
+    const auto touched = fragmentMap();
+    std::vector<TileBytes> before;
+    for (auto pos : touched)
+    {
+        before.push_back(snapshotBytes(TileManager::get(pos)));
+    }
+
+    TileManager::reorganise();
+
+    expectPackedInMapOrder();
+    for (size_t i = 0; i < touched.size(); ++i)
+    {
+        EXPECT_EQ(before[i], snapshotBytes(TileManager::get(touched[i])));
+    }
+}
+
+TEST_F(TileManagerTest, ReorganiseIncrementalMatchesReorganise)
+{
+    const auto touched = fragmentMap();
+    std::vector<TileBytes> before;
+    for (auto pos : touched)
+    {
+        before.push_back(snapshotBytes(TileManager::get(pos)));
+    }
+
+    TileManager::beginReorganiseIncremental();
+    size_t numSlices = 0;
+    while (TileManager::reorganiseIncremental())
+    {
+        numSlices++;
+    }
+    EXPECT_GT(numSlices, 1u);
+
+    expectPackedInMapOrder();
+    for (size_t i = 0; i < touched.size(); ++i)
+    {
+        EXPECT_EQ(before[i], snapshotBytes(TileManager::get(touched[i])));
+    }
+    EXPECT_EQ(TileManager::getTilesWithElement<TreeElement>(), touched);
+}
+
+TEST_F(TileManagerTest, ReorganiseIncrementalSurvivesChangesBetweenSlices)
+{
+    auto touched = fragmentMap();
+
+    TileManager::beginReorganiseIncremental();
+    TileManager::reorganiseIncremental();
+    TileManager::reorganiseIncremental();
+
+    // Change tiles on both sides of the cursor and let the periodic defrag move things about as the game would
+    const std::vector<TilePos2> changed{ TilePos2{ 3, 2 }, TilePos2{ 200, 100 }, TilePos2{ 379, 379 } };
+    for (auto pos : changed)
+    {
+        ASSERT_NE(TileManager::insertElement(ElementType::tree, toWorldSpace(pos), 60, 0), nullptr);
+        touched.push_back(pos);
+    }
+    for (auto i = 0; i < 500; ++i)
+    {
+        TileManager::defragmentTilePeriodic();
+    }
+
+    std::ranges::sort(touched, TileManager::isBeforeInMapOrder);
+    const auto [first, last] = std::ranges::unique(touched);
+    touched.erase(first, last);
+    std::vector<TileBytes> before;
+    for (auto pos : touched)
+    {
+        before.push_back(snapshotBytes(TileManager::get(pos)));
+    }
+
+    while (TileManager::reorganiseIncremental())
+    {
+    }
+
+    for (size_t i = 0; i < touched.size(); ++i)
+    {
+        EXPECT_EQ(before[i], snapshotBytes(TileManager::get(touched[i])));
+    }
+    EXPECT_EQ(TileManager::getTilesWithElement<TreeElement>(), touched);
+
+    // A full reorganise afterwards still gives the usual layout
+    TileManager::reorganise();
+    expectPackedInMapOrder();
+}
+
+TEST_F(TileManagerTest, ReorganiseIncrementalOnlyStartsWithSomethingToReclaim)
+{
+    // Fill the map until free elements are low, then pack it so that there is nothing left to reclaim
+    for (uint32_t i = 0; i < 240000; ++i)
+    {
+        const auto pos = TilePos2(static_cast<OpenLoco::tile_coord_t>(i % kMapColumns), static_cast<OpenLoco::tile_coord_t>((i / kMapColumns) % kMapRows));
+        ASSERT_NE(TileManager::insertElement(ElementType::tree, toWorldSpace(pos), static_cast<uint8_t>(8 + (i / (kMapColumns * kMapRows)) * 4), 0), nullptr);
+    }
+    TileManager::reorganise();
+    ASSERT_LE(TileManager::numFreeElements(), TileManager::kMaxElements / 8);
+
+    // Nothing would be gained so no pass starts, tick after tick
+    for (auto i = 0; i < 10; ++i)
+    {
+        EXPECT_FALSE(TileManager::reorganiseIncremental());
+    }
+
+    // Once enough elements have been removed a pass starts and runs to completion
+    uint32_t removed = 0;
+    for (OpenLoco::tile_coord_t y = 0; y < kMapRows && removed < TileManager::kMaxElements / 16; ++y)
+    {
+        for (OpenLoco::tile_coord_t x = 0; x < kMapColumns; ++x)
+        {
+            for (auto& el : TileManager::get(TilePos2(x, y)))
+            {
+                if (el.type() == ElementType::tree)
+                {
+                    TileManager::removeElement(el);
+                    removed++;
+                    break;
+                }
+            }
+        }
+    }
+    EXPECT_TRUE(TileManager::reorganiseIncremental());
+    while (TileManager::reorganiseIncremental())
+    {
+    }
+    expectPackedInMapOrder();
+    EXPECT_FALSE(TileManager::reorganiseIncremental());
+}
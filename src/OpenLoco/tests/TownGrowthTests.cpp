@@ -0,0 +1,219 @@
+#include <OpenLoco/GameState.h>
+#include <OpenLoco/Map/RoadElement.h>
+#include <OpenLoco/Map/Tile.h>
+#include <OpenLoco/Map/TileElement.h>
+#include <OpenLoco/Map/TileManager.h>
+#include <OpenLoco/World/Town.h>
+#include <OpenLoco/World/TownManager.h>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <gtest/gtest.h>
+#include <optional>
+#include <random>
+#include <vector>
+
+using namespace OpenLoco;
+using namespace OpenLoco::World;
+
+namespace
+{
+    constexpr auto kNumTowns = 6;
+    constexpr auto kNumRounds = 400;
+    // Road objects 0 and 2 are usable by towns, 1 and 3 are not
+    constexpr uint32_t kCompatibleRoadObjects = 0b0101;
+
+    struct GrowthResult
+    {
+        std::vector<std::optional<TownRoadExtent>> extents;
+        std::vector<std::array<uint8_t, kTileElementSize>> tiles;
+        std::vector<std::array<uint8_t, sizeof(Town)>> towns;
+        size_t numRemoved = 0;
+    };
+
+    class TownGrowthTest : public ::testing::Test
+    {
+    protected:
+        static void SetUpTestSuite()
+        {
+            TileManager::allocateMapElements();
+        }
+
+        void TearDown() override
+        {
+            TownManager::setRoadIndexEnabled(true);
+        }
+
+        // A road piece with random properties, sometimes one that growth must skip
+        static void addRoad(const TilePos2& pos, std::mt19937& rng)
+        {
+            if (!validCoords(pos))
+            {
+                return;
+            }
+            // Now and again the road is in a tunnel below the surface
+            const uint8_t baseZ = rng() % 8 == 0 ? 0 : 4 + (rng() % 4) * 4;
+            // Both ways of inserting a road have to keep the index up to date
+            auto* entry = rng() % 2 == 0 ? TileManager::insertElementRoad(toWorldSpace(pos), baseZ, 0xF) : TileManager::insertElement<RoadElement>(toWorldSpace(pos), baseZ, 0xF);
+            if (entry == nullptr)
+            {
+                return;
+            }
+            auto& road = entry->get<RoadElement>();
+            road.setClearZ(baseZ + 8);
+            road.setRotation(rng() % 4);
+            road.setRoadId(rng() % 10);
+            road.setRoadObjectId(rng() % 4);
+            road.setSequenceIndex(rng() % 4 == 0 ? 1 : 0);
+            road.setGhost(rng() % 16 == 0);
+            road.setOwner(CompanyId::neutral);
+        }
+
+        static bool removeRoad(const TilePos2& pos)
+        {
+            if (!validCoords(pos))
+            {
+                return false;
+            }
+            auto tile = TileManager::get(pos);
+            for (auto& el : tile)
+            {
+                if (el.type() == ElementType::road)
+                {
+                    TileManager::removeElement(el);
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        static TilePos2 randomTileNear(const TilePos2& centre, std::mt19937& rng)
+        {
+            return centre + TilePos2(static_cast<coord_t>(rng() % 15) - 7, static_cast<coord_t>(rng() % 15) - 7);
+        }
+
+        static void createTowns(std::mt19937& rng)
+        {
+            TownManager::reset();
+            // Towns at the map edges search off the map, and the two close towns share road tiles
+            const std::array<TilePos2, kNumTowns> centres = {
+                TilePos2(1, 2),
+                TilePos2(kMapColumns - 3, 4),
+                TilePos2(60, kMapRows - 2),
+                TilePos2(150, 150),
+                TilePos2(154, 147),
+                TilePos2(static_cast<coord_t>(20 + rng() % 300), static_cast<coord_t>(20 + rng() % 300)),
+            };
+            for (auto i = 0; i < kNumTowns; i++)
+            {
+                auto* town = TownManager::get(TownId(i));
+                std::memset(static_cast<void*>(town), 0, sizeof(Town));
+                town->name = 1;
+                const auto pos = toWorldSpace(centres[i]) + Pos2(rng() % 32, rng() % 32);
+                town->x = pos.x;
+                town->y = pos.y;
+                town->prng = Core::Prng(rng(), rng());
+            }
+        }
+
+        // Grows the towns with both the road index and the original walk over every tile around the centre.
+        // No road objects are loaded so growth stops once it has picked a road, the test builds on from
+        // that road in its place.
+        static GrowthResult growTowns(uint32_t seed, bool useRoadIndex)
+        {
+            TileManager::initialise();
+            getGameState().roadObjectIdIsAnyRoadTypeCompatible = kCompatibleRoadObjects;
+            TownManager::setRoadIndexEnabled(useRoadIndex);
+
+            std::mt19937 rng(seed);
+            createTowns(rng);
+
+            GrowthResult result;
+            for (auto round = 0; round < kNumRounds; round++)
+            {
+                for (auto i = 0; i < kNumTowns; i++)
+                {
+                    auto& town = *TownManager::get(TownId(i));
+                    town.grow(TownGrowFlags::buildInitialRoad | TownGrowFlags::allowRoadExpansion | TownGrowFlags::allowRoadBranching);
+
+                    const auto extent = town.findRoadExtent();
+                    result.extents.push_back(extent);
+                    const auto centre = toTileSpace(Pos2(town.x, town.y));
+                    if (extent.has_value())
+                    {
+                        const auto direction = town.prng.randNext(3);
+                        addRoad(toTileSpace(extent->roadStart) + toTileSpace(kRotationOffset[direction]), rng);
+                    }
+                    else
+                    {
+                        addRoad(randomTileNear(centre, rng), rng);
+                    }
+
+                    // Roads are also demolished, leaving the index with tiles that no longer have a road
+                    if (rng() % 3 == 0)
+                    {
+                        result.numRemoved += removeRoad(randomTileNear(centre, rng)) ? 1 : 0;
+                    }
+                }
+
+                // A town that moves has its index rebuilt
+                if (round % 97 == 96)
+                {
+                    auto& town = *TownManager::get(TownId(rng() % kNumTowns));
+                    town.x += 32;
+                }
+            }
+
+            for (auto y = 0; y < kMapRows; y++)
+            {
+                for (auto x = 0; x < kMapColumns; x++)
+                {
+                    auto tile = TileManager::get(TilePos2(x, y));
+                    for (size_t i = 0; i < tile.size(); i++)
+                    {
+                        auto& bytes = result.tiles.emplace_back();
+                        std::memcpy(bytes.data(), tile[i]->rawData().data(), kTileElementSize);
+                    }
+                }
+            }
+            for (auto i = 0; i < kNumTowns; i++)
+            {
+                auto& bytes = result.towns.emplace_back();
+                std::memcpy(bytes.data(), static_cast<const void*>(TownManager::get(TownId(i))), sizeof(Town));
+            }
+            return result;
+        }
+    };
+}
+
+TEST_F(TownGrowthTest, RoadIndexMatchesWalkingEveryTile)
+{
+    for (const auto seed : { 1U, 0x5EED5U, 77U })
+    {
+        SCOPED_TRACE(seed);
+        const auto expected = growTowns(seed, false);
+        const auto actual = growTowns(seed, true);
+
+        ASSERT_EQ(actual.extents.size(), expected.extents.size());
+        size_t numFound = 0;
+        for (size_t i = 0; i < expected.extents.size(); i++)
+        {
+            SCOPED_TRACE(i);
+            ASSERT_EQ(actual.extents[i].has_value(), expected.extents[i].has_value());
+            if (expected.extents[i].has_value())
+            {
+                ASSERT_EQ(actual.extents[i]->roadStart, expected.extents[i]->roadStart);
+                ASSERT_EQ(actual.extents[i]->tad, expected.extents[i]->tad);
+                ASSERT_EQ(actual.extents[i]->isBridge, expected.extents[i]->isBridge);
+                numFound++;
+            }
+        }
+        EXPECT_TRUE(actual.tiles == expected.tiles);
+        EXPECT_TRUE(actual.towns == expected.towns);
+        EXPECT_EQ(actual.numRemoved, expected.numRemoved);
+
+        // Growth found roads and roads were demolished, so stale index entries were visited
+        EXPECT_GT(numFound, expected.extents.size() / 2);
+        EXPECT_GT(expected.numRemoved, 0U);
+    }
+}
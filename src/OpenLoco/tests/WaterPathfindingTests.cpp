@@ -0,0 +1,121 @@
+#include <OpenLoco/Map/SurfaceElement.h>
+#include <OpenLoco/Map/Tile.h>
+#include <OpenLoco/Map/TileManager.h>
+#include <OpenLoco/Vehicles/WaterPathfinding.h>
+#include <algorithm>
+#include <cstdlib>
+#include <gtest/gtest.h>
+#include <limits>
+#include <random>
+
+using namespace OpenLoco;
+using namespace OpenLoco::World;
+using namespace OpenLoco::Vehicles;
+
+namespace
+{
+    constexpr MicroZ kWaterLevel = 4;
+    constexpr auto kAreaSize = 40;
+
+    class WaterPathfindingTest : public ::testing::Test
+    {
+    protected:
+        static void SetUpTestSuite()
+        {
+            TileManager::allocateMapElements();
+        }
+
+        void SetUp() override
+        {
+            TileManager::initialise();
+        }
+
+        // Vanilla's search, recursing into every path of up to 7 steps
+        static PathFindingResult recursivePathfind(const TilePos2 tilePos, const MicroZ waterMicroZ, const TilePos2 targetOrderPos, const NearbyBoats& nearbyVehicles, uint8_t cost, const PathFindingResult& bestResult)
+        {
+            PathFindingResult result = bestResult;
+            if (!isWaterTilePassable(tilePos, waterMicroZ, nearbyVehicles))
+            {
+                return result;
+            }
+
+            auto distToTarget = toWorldSpace(tilePos - targetOrderPos);
+            distToTarget.x = std::abs(distToTarget.x);
+            distToTarget.y = std::abs(distToTarget.y);
+            const uint16_t score = std::max(distToTarget.x, distToTarget.y) + std::min(distToTarget.x, distToTarget.y) / 16;
+            result = std::min(result, PathFindingResult{ score, cost });
+            if (score != 0)
+            {
+                if (cost >= 7)
+                {
+                    return result;
+                }
+                cost++;
+                for (auto i = 0U; i < 4; ++i)
+                {
+                    result = recursivePathfind(tilePos + toTileSpace(kRotationOffset[i]), waterMicroZ, targetOrderPos, nearbyVehicles, cost, result);
+                }
+            }
+            return result;
+        }
+
+        // Floods the area with water, leaving land and water at another level in a random share of the tiles
+        static void createRandomWater(const TilePos2 origin, std::mt19937& rng)
+        {
+            const auto landChance = rng() % 60;
+            for (auto x = origin.x; x < origin.x + kAreaSize; x++)
+            {
+                for (auto y = origin.y; y < origin.y + kAreaSize; y++)
+                {
+                    const auto roll = rng() % 100;
+                    const MicroZ level = roll < landChance ? 0 : (roll < landChance + 5 ? kWaterLevel + 1 : kWaterLevel);
+                    TileManager::get(TilePos2(x, y)).surface()->setWater(level);
+                }
+            }
+        }
+    };
+}
+
+TEST_F(WaterPathfindingTest, BreadthFirstSearchMatchesRecursiveSearch)
+{
+    std::mt19937 rng(1);
+    size_t numReached = 0;
+    for (auto trial = 0; trial < 600; trial++)
+    {
+        SCOPED_TRACE(trial);
+
+        // Every other area is at the map corner so the search runs off the edge of the map
+        const auto origin = trial % 2 == 0 ? TilePos2(0, 0) : TilePos2(100, 100);
+        createRandomWater(origin, rng);
+
+        const auto start = origin + TilePos2(rng() % kAreaSize, rng() % kAreaSize);
+        // Targets are mostly nearby, and sometimes too far away to be reached within the search
+        const auto targetRange = trial % 4 == 0 ? kAreaSize : 9;
+        const auto target = start + TilePos2(static_cast<coord_t>(rng() % targetRange) - targetRange / 2, static_cast<coord_t>(rng() % targetRange) - targetRange / 2);
+
+        NearbyBoats nearbyVehicles{};
+        nearbyVehicles.startTile = start - TilePos2(7, 7);
+        for (auto& column : nearbyVehicles.searchResult)
+        {
+            for (auto& hasBoat : column)
+            {
+                hasBoat = rng() % 20 == 0;
+            }
+        }
+
+        PathFindingResult initResult{ std::numeric_limits<uint16_t>::max(), std::numeric_limits<uint8_t>::max() };
+        if (trial % 5 == 0)
+        {
+            initResult = PathFindingResult{ static_cast<uint16_t>(rng() % 512), static_cast<uint8_t>(rng() % 8) };
+        }
+
+        const auto expected = recursivePathfind(start, kWaterLevel, target, nearbyVehicles, 0, initResult);
+        const auto actual = waterPathfindToTarget(start, kWaterLevel, target, nearbyVehicles, initResult);
+        ASSERT_EQ(actual.bestScore, expected.bestScore);
+        ASSERT_EQ(actual.cost, expected.cost);
+        numReached += expected.bestScore == 0 ? 1 : 0;
+    }
+
+    // Some searches found the target and stopped early
+    EXPECT_GT(numReached, 0U);
+}
@@ -0,0 +1,89 @@
+#include <OpenLoco/Map/SurfaceElement.h>
+#include <OpenLoco/Map/TileManager.h>
+#include <OpenLoco/Map/WaterRegions.h>
+#include <gtest/gtest.h>
+
+using namespace OpenLoco::World;
+
+namespace
+{
+    class WaterRegionsTest : public ::testing::Test
+    {
+    protected:
+        static void SetUpTestSuite()
+        {
+            TileManager::allocateMapElements();
+        }
+
+        void SetUp() override
+        {
+            TileManager::initialise();
+        }
+
+        static void setWater(const TilePos2& pos, uint8_t level)
+        {
+            TileManager::get(pos).surface()->setWater(level);
+            WaterRegions::invalidateTile(pos);
+        }
+
+        static void fillWater(const TilePos2& from, const TilePos2& to, uint8_t level)
+        {
+            for (auto x = from.x; x <= to.x; ++x)
+            {
+                for (auto y = from.y; y <= to.y; ++y)
+                {
+                    setWater(TilePos2(x, y), level);
+                }
+            }
+        }
+    };
+}
+
+TEST_F(WaterRegionsTest, SeparateBodiesOfWater)
+{
+    fillWater({ 10, 10 }, { 20, 20 }, 4);
+    fillWater({ 22, 10 }, { 30, 20 }, 4);
+    fillWater({ 10, 22 }, { 20, 30 }, 5);
+    fillWater({ 10, 31 }, { 20, 35 }, 4);
+
+    const auto lake = WaterRegions::getRegion({ 10, 10 });
+    EXPECT_NE(lake, WaterRegions::kNullRegion);
+    EXPECT_EQ(WaterRegions::getRegion({ 20, 20 }), lake);
+    EXPECT_EQ(WaterRegions::getRegion({ 21, 15 }), WaterRegions::kNullRegion);
+    EXPECT_NE(WaterRegions::getRegion({ 22, 15 }), lake);
+
+    // Neighbouring water at a different level is not connected
+    EXPECT_NE(WaterRegions::getRegion({ 10, 22 }), lake);
+    EXPECT_NE(WaterRegions::getRegion({ 10, 31 }), WaterRegions::getRegion({ 10, 22 }));
+    EXPECT_NE(WaterRegions::getRegion({ 10, 31 }), lake);
+
+    EXPECT_EQ(WaterRegions::getRegion({ -1, 10 }), WaterRegions::kNullRegion);
+    EXPECT_EQ(WaterRegions::getRegion({ 0, 0 }), WaterRegions::kNullRegion);
+}
+
+TEST_F(WaterRegionsTest, ChangesJoinAndSplitRegions)
+{
+    fillWater({ 10, 10 }, { 20, 20 }, 4);
+    fillWater({ 22, 10 }, { 30, 20 }, 4);
+    EXPECT_NE(WaterRegions::getRegion({ 10, 10 }), WaterRegions::getRegion({ 30, 20 }));
+
+    // Dig a channel between them
+    setWater({ 21, 15 }, 4);
+    EXPECT_EQ(WaterRegions::getRegion({ 10, 10 }), WaterRegions::getRegion({ 30, 20 }));
+    EXPECT_EQ(WaterRegions::getRegion({ 21, 15 }), WaterRegions::getRegion({ 30, 20 }));
+
+    // And fill it in again
+    setWater({ 21, 15 }, 0);
+    EXPECT_NE(WaterRegions::getRegion({ 10, 10 }), WaterRegions::getRegion({ 30, 20 }));
+    EXPECT_EQ(WaterRegions::getRegion({ 21, 15 }), WaterRegions::kNullRegion);
+
+    // Splitting a lake in two through the middle
+    fillWater({ 15, 10 }, { 15, 20 }, 0);
+    EXPECT_NE(WaterRegions::getRegion({ 14, 15 }), WaterRegions::getRegion({ 16, 15 }));
+    EXPECT_EQ(WaterRegions::getRegion({ 14, 10 }), WaterRegions::getRegion({ 10, 20 }));
+    EXPECT_EQ(WaterRegions::getRegion({ 16, 10 }), WaterRegions::getRegion({ 20, 20 }));
+
+    // Regions are forgotten when the map is replaced
+    TileManager::initialise();
+    EXPECT_EQ(WaterRegions::getRegion({ 10, 10 }), WaterRegions::kNullRegion);
+}
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <functional>
 #include <string>
 
 namespace OpenLoco::CrashHandler
@@ -10,6 +11,8 @@ namespace OpenLoco::CrashHandler
     {
         std::string name;
         std::string version;
+        // Called first when a crash is caught, e.g. to write out buffered logs
+        std::function<void()> onCrash;
     };
 
     Handle init(const AppInfo& appInfo);